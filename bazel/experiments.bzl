@@ -35,6 +35,7 @@ EXPERIMENTS = {
             "tcp_read_chunks",
         ],
         "event_engine_client_test": [
+            "event_engine_callback_cq",
             "event_engine_client",
         ],
         "flow_control_test": [
@@ -316,6 +316,7 @@
         'src/core/lib/gpr/cpu_windows.cc',
         'src/core/lib/gpr/log.cc',
         'src/core/lib/gpr/log_android.cc',
+        'src/core/lib/gpr/log_async.cc',
         'src/core/lib/gpr/log_linux.cc',
         'src/core/lib/gpr/log_posix.cc',
         'src/core/lib/gpr/log_windows.cc',
@@ -386,6 +387,7 @@
         'src/core/ext/filters/client_channel/dynamic_filters.cc',
         'src/core/ext/filters/client_channel/global_subchannel_pool.cc',
         'src/core/ext/filters/client_channel/health/health_check_client.cc',
+        'src/core/ext/filters/client_channel/health/health_check_stream_registry.cc',
         'src/core/ext/filters/client_channel/http_proxy.cc',
         'src/core/ext/filters/client_channel/lb_policy/address_filtering.cc',
         'src/core/ext/filters/client_channel/lb_policy/child_policy_handler.cc',
@@ -394,6 +396,7 @@
         'src/core/ext/filters/client_channel/lb_policy/grpclb/grpclb_balancer_addresses.cc',
         'src/core/ext/filters/client_channel/lb_policy/grpclb/grpclb_client_stats.cc',
         'src/core/ext/filters/client_channel/lb_policy/grpclb/load_balancer_api.cc',
+        'src/core/ext/filters/client_channel/lb_policy/least_request/least_request.cc',
         'src/core/ext/filters/client_channel/lb_policy/oob_backend_metric.cc',
         'src/core/ext/filters/client_channel/lb_policy/outlier_detection/outlier_detection.cc',
         'src/core/ext/filters/client_channel/lb_policy/pick_first/pick_first.cc',
@@ -451,6 +454,7 @@
         'src/core/ext/transport/chttp2/transport/chttp2_transport.cc',
         'src/core/ext/transport/chttp2/transport/context_list.cc',
         'src/core/ext/transport/chttp2/transport/decode_huff.cc',
+        'src/core/ext/transport/chttp2/transport/decode_huff_fast.cc',
         'src/core/ext/transport/chttp2/transport/flow_control.cc',
         'src/core/ext/transport/chttp2/transport/frame_data.cc',
         'src/core/ext/transport/chttp2/transport/frame_goaway.cc',
@@ -471,6 +475,8 @@
         'src/core/ext/transport/chttp2/transport/writing.cc',
         'src/core/ext/transport/inproc/inproc_plugin.cc',
         'src/core/ext/transport/inproc/inproc_transport.cc',
+        'src/core/ext/transport/shm/shm_endpoint.cc',
+        'src/core/ext/transport/shm/shm_transport.cc',
         'src/core/ext/upb-generated/envoy/admin/v3/certs.upb.c',
         'src/core/ext/upb-generated/envoy/admin/v3/clusters.upb.c',
         'src/core/ext/upb-generated/envoy/admin/v3/config_dump.upb.c',
@@ -782,6 +788,7 @@
         'src/core/lib/address_utils/parse_address.cc',
         'src/core/lib/address_utils/sockaddr_utils.cc',
         'src/core/lib/backoff/backoff.cc',
+        'src/core/lib/channel/call_tracer_sampler.cc',
         'src/core/lib/channel/channel_args.cc',
         'src/core/lib/channel/channel_args_preconditioning.cc',
         'src/core/lib/channel/channel_stack.cc',
@@ -797,6 +804,7 @@
         'src/core/lib/compression/compression_internal.cc',
         'src/core/lib/compression/message_compress.cc',
         'src/core/lib/config/core_configuration.cc',
+        'src/core/lib/debug/call_stage_profiler.cc',
         'src/core/lib/debug/event_log.cc',
         'src/core/lib/debug/stats.cc',
         'src/core/lib/debug/stats_data.cc',
@@ -914,6 +922,7 @@
         'src/core/lib/load_balancing/lb_policy_registry.cc',
         'src/core/lib/matchers/matchers.cc',
         'src/core/lib/promise/activity.cc',
+        'src/core/lib/promise/group_wakeup_scheduler.cc',
         'src/core/lib/promise/sleep.cc',
         'src/core/lib/resolver/resolver.cc',
         'src/core/lib/resolver/resolver_registry.cc',
@@ -1142,6 +1151,7 @@
         'src/core/ext/filters/client_channel/dynamic_filters.cc',
         'src/core/ext/filters/client_channel/global_subchannel_pool.cc',
         'src/core/ext/filters/client_channel/health/health_check_client.cc',
+        'src/core/ext/filters/client_channel/health/health_check_stream_registry.cc',
         'src/core/ext/filters/client_channel/http_proxy.cc',
         'src/core/ext/filters/client_channel/lb_policy/address_filtering.cc',
         'src/core/ext/filters/client_channel/lb_policy/child_policy_handler.cc',
@@ -1150,6 +1160,7 @@
         'src/core/ext/filters/client_channel/lb_policy/grpclb/grpclb_balancer_addresses.cc',
         'src/core/ext/filters/client_channel/lb_policy/grpclb/grpclb_client_stats.cc',
         'src/core/ext/filters/client_channel/lb_policy/grpclb/load_balancer_api.cc',
+        'src/core/ext/filters/client_channel/lb_policy/least_request/least_request.cc',
         'src/core/ext/filters/client_channel/lb_policy/oob_backend_metric.cc',
         'src/core/ext/filters/client_channel/lb_policy/outlier_detection/outlier_detection.cc',
         'src/core/ext/filters/client_channel/lb_policy/pick_first/pick_first.cc',
@@ -1196,6 +1207,7 @@
         'src/core/ext/transport/chttp2/transport/chttp2_transport.cc',
         'src/core/ext/transport/chttp2/transport/context_list.cc',
         'src/core/ext/transport/chttp2/transport/decode_huff.cc',
+        'src/core/ext/transport/chttp2/transport/decode_huff_fast.cc',
         'src/core/ext/transport/chttp2/transport/flow_control.cc',
         'src/core/ext/transport/chttp2/transport/frame_data.cc',
         'src/core/ext/transport/chttp2/transport/frame_goaway.cc',
@@ -1216,6 +1228,8 @@
         'src/core/ext/transport/chttp2/transport/writing.cc',
         'src/core/ext/transport/inproc/inproc_plugin.cc',
         'src/core/ext/transport/inproc/inproc_transport.cc',
+        'src/core/ext/transport/shm/shm_endpoint.cc',
+        'src/core/ext/transport/shm/shm_transport.cc',
         'src/core/ext/upb-generated/google/api/annotations.upb.c',
         'src/core/ext/upb-generated/google/api/http.upb.c',
         'src/core/ext/upb-generated/google/protobuf/any.upb.c',
@@ -1235,6 +1249,7 @@
         'src/core/lib/address_utils/parse_address.cc',
         'src/core/lib/address_utils/sockaddr_utils.cc',
         'src/core/lib/backoff/backoff.cc',
+        'src/core/lib/channel/call_tracer_sampler.cc',
         'src/core/lib/channel/channel_args.cc',
         'src/core/lib/channel/channel_args_preconditioning.cc',
         'src/core/lib/channel/channel_stack.cc',
@@ -1250,6 +1265,7 @@
         'src/core/lib/compression/compression_internal.cc',
         'src/core/lib/compression/message_compress.cc',
         'src/core/lib/config/core_configuration.cc',
+        'src/core/lib/debug/call_stage_profiler.cc',
         'src/core/lib/debug/event_log.cc',
         'src/core/lib/debug/stats.cc',
         'src/core/lib/debug/stats_data.cc',
@@ -1365,6 +1381,7 @@
         'src/core/lib/load_balancing/lb_policy.cc',
         'src/core/lib/load_balancing/lb_policy_registry.cc',
         'src/core/lib/promise/activity.cc',
+        'src/core/lib/promise/group_wakeup_scheduler.cc',
         'src/core/lib/promise/sleep.cc',
         'src/core/lib/resolver/resolver.cc',
         'src/core/lib/resolver/resolver_registry.cc',
@@ -1521,6 +1538,7 @@
         'src/cpp/codegen/codegen_init.cc',
         'src/cpp/common/alarm.cc',
         'src/cpp/common/auth_property_iterator.cc',
+        'src/cpp/common/call_stage_timings.cc',
         'src/cpp/common/channel_arguments.cc',
         'src/cpp/common/channel_filter.cc',
         'src/cpp/common/completion_queue_cc.cc',
@@ -1545,6 +1563,8 @@
         'src/cpp/server/insecure_server_credentials.cc',
         'src/cpp/server/orca/call_metric_recorder.cc',
         'src/cpp/server/secure_server_credentials.cc',
+        'src/cpp/server/numa_placement.cc',
+        'src/cpp/server/numa_placement_server_builder_option.cc',
         'src/cpp/server/server_builder.cc',
         'src/cpp/server/server_callback.cc',
         'src/cpp/server/server_cc.cc',
@@ -1554,6 +1574,7 @@
         'src/cpp/server/xds_server_credentials.cc',
         'src/cpp/thread_manager/thread_manager.cc',
         'src/cpp/util/byte_buffer_cc.cc',
+        'src/cpp/util/proto_buffer_pool.cc',
         'src/cpp/util/status.cc',
         'src/cpp/util/string_ref.cc',
         'src/cpp/util/time_cc.cc',
@@ -1663,6 +1684,7 @@
         'src/cpp/client/insecure_credentials.cc',
         'src/cpp/codegen/codegen_init.cc',
         'src/cpp/common/alarm.cc',
+        'src/cpp/common/call_stage_timings.cc',
         'src/cpp/common/channel_arguments.cc',
         'src/cpp/common/channel_filter.cc',
         'src/cpp/common/completion_queue_cc.cc',
@@ -1681,6 +1703,8 @@
         'src/cpp/server/health/health_check_service_server_builder_option.cc',
         'src/cpp/server/insecure_server_credentials.cc',
         'src/cpp/server/orca/call_metric_recorder.cc',
+        'src/cpp/server/numa_placement.cc',
+        'src/cpp/server/numa_placement_server_builder_option.cc',
         'src/cpp/server/server_builder.cc',
         'src/cpp/server/server_callback.cc',
         'src/cpp/server/server_cc.cc',
@@ -1689,6 +1713,7 @@
         'src/cpp/server/server_posix.cc',
         'src/cpp/thread_manager/thread_manager.cc',
         'src/cpp/util/byte_buffer_cc.cc',
+        'src/cpp/util/proto_buffer_pool.cc',
         'src/cpp/util/status.cc',
         'src/cpp/util/string_ref.cc',
         'src/cpp/util/time_cc.cc',
@@ -124,6 +124,23 @@ GRPCAPI grpc_event grpc_completion_queue_next(grpc_completion_queue* cq,
                                               gpr_timespec deadline,
                                               void* reserved);
 
+/** Harvests up to \a max_events events in one call. Blocks like
+    grpc_completion_queue_next until at least one event is available, the
+    completion queue is being shut down, or deadline is reached, then
+    additionally drains - without further blocking - whatever events are
+    already queued, up to \a max_events in total.
+
+    Returns the number of events written to \a events: either one or more
+    events of type GRPC_OP_COMPLETE, or a single event carrying
+    GRPC_QUEUE_TIMEOUT or GRPC_QUEUE_SHUTDOWN as grpc_completion_queue_next
+    would return. May only be used on completion queues of type GRPC_CQ_NEXT,
+    under the same constraints as grpc_completion_queue_next. */
+GRPCAPI size_t grpc_completion_queue_next_batch(grpc_completion_queue* cq,
+                                                grpc_event* events,
+                                                size_t max_events,
+                                                gpr_timespec deadline,
+                                                void* reserved);
+
 /** Blocks until an event with tag 'tag' is available, the completion queue is
     being shutdown or deadline is reached.
 
@@ -249,6 +266,22 @@ GRPCAPI grpc_call_error grpc_call_start_batch(grpc_call* call,
                                               const grpc_op* ops, size_t nops,
                                               void* tag, void* reserved);
 
+/** Starts batches on several calls in one submission. Semantically
+    equivalent to calling grpc_call_start_batch for each element of
+    \a batches in order, but all batches are started under a single
+    execution context flush: work bound for the same transport is coalesced,
+    so streams on one connection are marked writable together and a single
+    write cycle is initiated instead of one wakeup per call.
+
+    Processing stops at the first batch that fails to start; that batch's
+    error is returned and, if \a first_error_index is non-NULL, its index is
+    written there. Batches before it have been started and their tags will
+    still be delivered. Returns GRPC_CALL_OK if every batch started. */
+GRPCAPI grpc_call_error grpc_call_start_batch_bulk(grpc_call_batch* batches,
+                                                   size_t count,
+                                                   size_t* first_error_index,
+                                                   void* reserved);
+
 /** Returns a newly allocated string representing the endpoint to which this
     call is communicating with. The string is in the uri format accepted by
     grpc_channel_create.
@@ -480,6 +513,15 @@ GRPCAPI void grpc_server_shutdown_and_notify(grpc_server* server,
                                              grpc_completion_queue* cq,
                                              void* tag);
 
+/** Report graceful drain progress after grpc_server_shutdown_and_notify:
+    *channels_at_shutdown is set to the number of connections that were open
+    when shutdown began and *channels_remaining to the number still draining.
+    Both are set to zero if shutdown has not been called. May be polled from
+    any thread. */
+GRPCAPI void grpc_server_drain_progress(grpc_server* server,
+                                        size_t* channels_at_shutdown,
+                                        size_t* channels_remaining);
+
 /** Cancel all in-progress calls.
     Only usable after shutdown. */
 GRPCAPI void grpc_server_cancel_all_calls(grpc_server* server);
@@ -560,6 +602,21 @@ GRPCAPI char* grpc_channelz_get_top_channels(intptr_t start_channel_id);
 /* Gets all servers that exist in the process. */
 GRPCAPI char* grpc_channelz_get_servers(intptr_t start_server_id);
 
+/* Streaming variants of grpc_channelz_get_top_channels() and
+   grpc_channelz_get_servers(): render at most max_results entities per call
+   and write the cursor for the next call to *next_channel_id (resp.
+   *next_server_id), or 0 once iteration is complete. Cursors are stable
+   against concurrent entity creation and destruction, so large registries
+   can be scraped incrementally in bounded chunks. Returns NULL if
+   max_results is not positive or the cursor out-param is NULL. The returned
+   string is allocated and must be freed by the application. */
+GRPCAPI char* grpc_channelz_get_top_channels_batch(intptr_t start_channel_id,
+                                                   intptr_t max_results,
+                                                   intptr_t* next_channel_id);
+GRPCAPI char* grpc_channelz_get_servers_batch(intptr_t start_server_id,
+                                              intptr_t max_results,
+                                              intptr_t* next_server_id);
+
 /* Returns a single Server, or else a NOT_FOUND code. */
 GRPCAPI char* grpc_channelz_get_server(intptr_t server_id);
 
@@ -580,6 +637,12 @@ GRPCAPI char* grpc_channelz_get_subchannel(intptr_t subchannel_id);
    is allocated and must be freed by the application. */
 GRPCAPI char* grpc_channelz_get_socket(intptr_t socket_id);
 
+/* Returns a JSON snapshot of the per-call stage latency histograms (one
+   log2-of-cycles bucket array per named stage). Returns an all-zero snapshot
+   when gRPC was built with GRPC_DISABLE_CALL_STAGE_PROFILER. The returned
+   string is allocated and must be freed by the application. */
+GRPCAPI char* grpc_call_stage_timings_json(void);
+
 /**
  * EXPERIMENTAL - Subject to change.
  * Fetch a vtable for grpc_channel_arg that points to
@@ -603,6 +603,14 @@ typedef struct {
 GRPCAPI void grpc_server_credentials_set_auth_metadata_processor(
     grpc_server_credentials* creds, grpc_auth_metadata_processor processor);
 
+/** EXPERIMENTAL API - Subject to change.
+   Invalidates any authentication results cached under
+   GRPC_ARG_SERVER_AUTH_RESULT_CACHE_TTL_MS for \a creds, e.g. after a key
+   rotation or a token revocation. Subsequent RPCs re-run the auth metadata
+   processor even if their token was cached before this call. */
+GRPCAPI void grpc_server_credentials_invalidate_auth_result_cache(
+    grpc_server_credentials* creds);
+
 /** --- ALTS channel/server credentials --- **/
 
 /**
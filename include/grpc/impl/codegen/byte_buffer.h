@@ -92,6 +92,17 @@ GRPCAPI int grpc_byte_buffer_reader_peek(grpc_byte_buffer_reader* reader,
 GRPCAPI grpc_slice
 grpc_byte_buffer_reader_readall(grpc_byte_buffer_reader* reader);
 
+/** EXPERIMENTAL API - This function may be removed and changed, in the future.
+ *
+ * Returns a single contiguous slice holding all data from \a reader. When the
+ * underlying byte buffer consists of a single slice (the common case for small
+ * messages), that slice is returned by reference and no data is copied;
+ * otherwise the data is flattened into a freshly allocated slice exactly as
+ * grpc_byte_buffer_reader_readall would. Either way the caller owns a
+ * reference to the result and must call grpc_slice_unref on it. */
+GRPCAPI grpc_slice
+grpc_byte_buffer_reader_view(grpc_byte_buffer_reader* reader);
+
 /** Returns a RAW byte buffer instance from the output of \a reader. */
 GRPCAPI grpc_byte_buffer* grpc_raw_byte_buffer_from_reader(
     grpc_byte_buffer_reader* reader);
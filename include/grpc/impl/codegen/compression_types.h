@@ -53,6 +53,11 @@ extern "C" {
  * be ignored). */
 #define GRPC_COMPRESSION_CHANNEL_ENABLED_ALGORITHMS_BITSET \
   "grpc.compression_enabled_algorithms_bitset"
+/** Id of a pre-shared compression dictionary to prime message compression
+ * with (an int; 0, the default, means no dictionary). The same dictionary
+ * bytes must be registered under this id on both peers. Only meaningful for
+ * algorithms with preset-dictionary support (deflate, zstd). Experimental. */
+#define GRPC_COMPRESSION_CHANNEL_DICTIONARY_ID "grpc.compression_dictionary_id"
 /** \} */
 
 /** The various compression algorithms supported by gRPC (not sorted by
@@ -61,6 +66,9 @@ typedef enum {
   GRPC_COMPRESS_NONE = 0,
   GRPC_COMPRESS_DEFLATE,
   GRPC_COMPRESS_GZIP,
+  /** Available only when gRPC is built against libzstd; otherwise the
+     algorithm is never advertised and decompression of it fails. */
+  GRPC_COMPRESS_ZSTD,
   /* TODO(ctiller): snappy */
   GRPC_COMPRESS_ALGORITHMS_COUNT
 } grpc_compression_algorithm;
@@ -262,6 +262,37 @@ typedef struct {
 /** The time between the first and second connection attempts, in ms */
 #define GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS \
   "grpc.initial_reconnect_backoff_ms"
+/** How long to wait for an in-flight connection attempt before starting a
+    staggered attempt to the next address in parallel (RFC 8305 style),
+    in ms. The first attempt to become ready is used and the others are
+    discarded. 0 disables staggering, making attempts strictly sequential.
+    Defaults to 250. */
+#define GRPC_ARG_HAPPY_EYEBALLS_CONNECTION_ATTEMPT_DELAY_MS \
+  "grpc.happy_eyeballs_connection_attempt_delay_ms"
+/** If non-zero, a subchannel that receives a graceful GOAWAY (e.g. from a
+    server rotating connections via max connection age) immediately starts
+    establishing a replacement connection, overlapping the new handshake with
+    the server's drain grace period instead of waiting for the next RPC to
+    trigger a reconnect. Enabled by default. */
+#define GRPC_ARG_PROACTIVE_RECONNECT_ON_GOAWAY \
+  "grpc.proactive_reconnect_on_goaway"
+/** Maximum number of parallel connections a subchannel may establish to the
+    same address. When greater than 1, the subchannel adds connections as the
+    peer's MAX_CONCURRENT_STREAMS limit saturates the existing ones, and new
+    calls are spread across the connections. Defaults to 1 (a single
+    connection per subchannel, with excess calls queued in the transport). */
+#define GRPC_ARG_MAX_CONNECTIONS_PER_SUBCHANNEL \
+  "grpc.max_connections_per_subchannel"
+/** If non-zero, the HTTP/2 transport records, for every stream write, the
+    latency from the write being queued in the transport until the kernel
+    reports the bytes ACKed by the peer (via TX timestamping on the socket
+    error queue). Per-stream latency histograms are exported through the
+    channelz socket node, separating transport queueing time from network
+    time. Only effective on platforms with SO_TIMESTAMPING support (Linux);
+    elsewhere the argument is accepted but no data is collected. Disabled by
+    default. */
+#define GRPC_ARG_HTTP2_TX_BYTE_LATENCY_TRACING \
+  "grpc.http2.tx_byte_latency_tracing"
 /** Minimum amount of time between DNS resolutions, in ms */
 #define GRPC_ARG_DNS_MIN_TIME_BETWEEN_RESOLUTIONS_MS \
   "grpc.dns_min_time_between_resolutions_ms"
@@ -284,11 +315,55 @@ typedef struct {
  *  protector.
  */
 #define GRPC_ARG_TSI_MAX_FRAME_SIZE "grpc.tsi.max_frame_size"
+/** If non-zero, run the CPU-heavy portion of TSI handshakes (e.g. TLS
+ *  asymmetric crypto) on a bounded number of EventEngine threads instead of
+ *  the polling thread, so that bursts of new connections do not stall reads
+ *  on established connections. Defaults to zero (handshake computation runs
+ *  inline on the polling thread).
+ */
+#define GRPC_ARG_TSI_HANDSHAKE_OFFLOAD "grpc.tsi.handshake_offload"
+/** If non-negative, outgoing messages of at least this many bytes are
+ *  compressed on an EventEngine thread instead of inline on the transport
+ *  write path, so that large payloads do not stall other streams sharing
+ *  the connection. Defaults to -1 (compression runs inline). */
+#define GRPC_ARG_COMPRESSION_OFFLOAD_THRESHOLD \
+  "grpc.experimental.compression_offload_threshold"
+/** If non-zero, cache successful auth metadata processor results on the
+ *  server for this many milliseconds, keyed by the consumed metadata (e.g.
+ *  the authorization token), so that repeated tokens skip re-running the
+ *  processor's crypto checks on every RPC of a connection. Defaults to zero
+ *  (every RPC invokes the processor). */
+#define GRPC_ARG_SERVER_AUTH_RESULT_CACHE_TTL_MS \
+  "grpc.server_auth_result_cache_ttl_ms"
+/** If non-zero, fuse runs of adjacent metadata-only promise-based filters
+ *  into a single composite filter when the channel stack is built, reducing
+ *  per-call element count and indirect calls. Defaults to zero (filters are
+ *  instantiated individually). */
+#define GRPC_ARG_ENABLE_FILTER_FUSION "grpc.experimental.enable_filter_fusion"
 /** Maximum metadata size, in bytes. Note this limit applies to the max sum of
     all metadata key-value entries in a batch of headers. */
 #define GRPC_ARG_MAX_METADATA_SIZE "grpc.max_metadata_size"
 /** If non-zero, allow the use of SO_REUSEPORT if it's available (default 1) */
 #define GRPC_ARG_ALLOW_REUSEPORT "grpc.so_reuseport"
+/** Number of SO_REUSEPORT acceptor shards (listening fds) to create per
+ *  listening address. Each shard is polled independently, so this bounds
+ *  accept parallelism explicitly instead of deriving it from the polling
+ *  thread count. Zero (the default) keeps one shard per server pollset.
+ *  Only effective where SO_REUSEPORT is supported. */
+#define GRPC_ARG_TCP_ACCEPT_SHARDS "grpc.tcp_accept_shards"
+/** If non-zero, an acceptor shard whose accepted-connection count exceeds
+ *  the least-loaded shard of the same address by more than this many
+ *  connections closes new accepts instead of handing them off; the client's
+ *  reconnect re-enters the kernel's SO_REUSEPORT hash from a new source
+ *  port and usually lands on another shard. Long-lived-connection servers
+ *  use this to keep shards balanced. Zero (the default) never rejects. */
+#define GRPC_ARG_TCP_ACCEPT_SHARD_MAX_IMBALANCE \
+  "grpc.tcp_accept_shard_max_imbalance"
+/** If non-zero, a C++ sync server distributes its completion queues across
+ *  NUMA nodes round robin and pins each queue's polling threads to the CPUs
+ *  of the node owning the queue. Only effective on Linux; ignored elsewhere
+ *  or when the topology cannot be determined. Defaults to zero. */
+#define GRPC_ARG_SERVER_NUMA_PLACEMENT "grpc.server_numa_placement"
 /** If non-zero, a pointer to a buffer pool (a pointer of type
  * grpc_resource_quota*). (use grpc_resource_quota_arg_vtable() to fetch an
  * appropriate pointer arg vtable) */
@@ -317,6 +392,12 @@ typedef struct {
  * level. Disabling channelz naturally disables channel tracing. The default
  * is for channelz to be enabled. */
 #define GRPC_ARG_ENABLE_CHANNELZ "grpc.enable_channelz"
+/** If greater than 1, only one out of every N transport sockets records
+ * per-socket channelz detail (stream, message and keepalive counters). The
+ * remaining sockets are still listed by channelz but render without counter
+ * data. Values of 0 and 1 (the default) record detail on every socket. */
+#define GRPC_ARG_CHANNELZ_SOCKET_SAMPLING_PERIOD \
+  "grpc.channelz_socket_sampling_period"
 /** If non-zero, Cronet transport will coalesce packets to fewer frames
  * when possible. */
 #define GRPC_ARG_USE_CRONET_PACKET_COALESCING \
@@ -346,6 +427,14 @@ typedef struct {
    issued by the tcp_write(). By default, this is set to 4. */
 #define GRPC_ARG_TCP_TX_ZEROCOPY_MAX_SIMULT_SENDS \
   "grpc.experimental.tcp_tx_zerocopy_max_simultaneous_sends"
+/* TCP Fast Open on client connections: zero is disabled, non-zero requests
+   TFO on the connect path, so that reconnections to a peer that handed out a
+   TFO cookie carry the first flight of data in the SYN. Note that with TFO
+   the connect itself always succeeds immediately and unreachable peers are
+   only detected at the first write. Best effort: platforms or kernels
+   without TFO support fall back to a regular handshake. By default, it is
+   disabled. */
+#define GRPC_ARG_TCP_FASTOPEN_CONNECT "grpc.experimental.tcp_fastopen_connect"
 /* Timeout in milliseconds to use for calls to the grpclb load balancer.
    If 0 or unset, the balancer calls will have no deadline. */
 #define GRPC_ARG_GRPCLB_CALL_TIMEOUT_MS "grpc.grpclb_call_timeout_ms"
@@ -396,6 +485,13 @@ typedef struct {
           also the GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING arg below.
  */
 #define GRPC_ARG_ENABLE_RETRIES "grpc.enable_retries"
+/** If non-zero, eagerly kick off name resolution and connection
+    establishment (including any TLS handshake) when the channel is created,
+    instead of waiting for the first RPC or an explicit
+    grpc_channel_check_connectivity_state(channel, 1) call. To await the
+    warmed state, watch for GRPC_CHANNEL_READY via
+    grpc_channel_watch_connectivity_state. Default is false. */
+#define GRPC_ARG_EAGER_CONNECT "grpc.eager_connect"
 /** Enables hedging functionality, as described in:
       https://github.com/grpc/proposal/blob/master/A6-client-retries.md
     Default is currently false, since this functionality is not yet
@@ -424,6 +520,15 @@ typedef struct {
 /** If set, inhibits health checking (which may be enabled via the
  *  service config.) */
 #define GRPC_ARG_INHIBIT_HEALTH_CHECKING "grpc.inhibit_health_checking"
+/** If set to non zero, subchannels in this process that connect to the same
+ *  address and watch the same health check service name share a single
+ *  health check watch stream instead of opening one stream per subchannel.
+ *  This greatly reduces stream count and backend health-RPC load when many
+ *  channels target the same backends, at the cost of per-connection health
+ *  accuracy: the shared stream reports the serving status observed over one
+ *  of the connections. */
+#define GRPC_ARG_EXPERIMENTAL_SHARE_HEALTH_CHECK_STREAMS \
+  "grpc.experimental.share_health_check_streams"
 /** If enabled, the channel's DNS resolver queries for SRV records.
  *  This is useful only when using the "grpclb" load balancing policy,
  *  as described in the following documents:
@@ -440,6 +545,14 @@ typedef struct {
  * timeouts/backoff/retry logic, and so the actual DNS resolution may time out
  * sooner than the value specified here. */
 #define GRPC_ARG_DNS_ARES_QUERY_TIMEOUT_MS "grpc.dns_ares_query_timeout"
+/** If non-zero, the c-ares based DNS resolver shares resolution results with
+ * other channels in the process through a process-wide cache: a recently
+ * resolved target is served from the cache, and when an entry goes stale a
+ * single channel revalidates it while the others keep using the stale result.
+ * This bounds the DNS query load per target regardless of how many channels
+ * resolve it. Note that this works only with the "ares" DNS resolver; it
+ * isn't supported by the "native" DNS resolver. Default is false. */
+#define GRPC_ARG_DNS_ENABLE_SHARED_CACHE "grpc.dns_enable_shared_cache"
 /** If set, uses a local subchannel pool within the channel. Otherwise, uses the
  * global subchannel pool. */
 #define GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL "grpc.use_local_subchannel_pool"
@@ -713,6 +826,19 @@ typedef struct grpc_op {
   } data;
 } grpc_op;
 
+/** One call's batch within a grpc_call_start_batch_bulk submission. */
+typedef struct grpc_call_batch {
+  /** Call to start the batch on */
+  grpc_call* call;
+  /** Array of operations, with the same constraints as for
+      grpc_call_start_batch */
+  const grpc_op* ops;
+  /** Number of operations in \a ops */
+  size_t nops;
+  /** Completion tag for this call's batch */
+  void* tag;
+} grpc_call_batch;
+
 /** Information requested from the channel. */
 typedef struct {
   /** If non-NULL, will be set to point to a string indicating the LB
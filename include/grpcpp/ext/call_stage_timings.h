@@ -0,0 +1,37 @@
+/*
+ *
+ * Copyright 2022 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPCPP_EXT_CALL_STAGE_TIMINGS_H
+#define GRPCPP_EXT_CALL_STAGE_TIMINGS_H
+
+#include <string>
+
+namespace grpc {
+namespace experimental {
+
+/// Returns a JSON snapshot of the per-call stage latency histograms recorded
+/// by the core: one log2-of-cycles bucket array per named stage (lb_pick,
+/// metadata_encode, transport_queue, write, remote, read,
+/// surface_completion). All buckets are zero when gRPC was built with
+/// GRPC_DISABLE_CALL_STAGE_PROFILER.
+std::string GetCallStageTimingsJson();
+
+}  // namespace experimental
+}  // namespace grpc
+
+#endif  // GRPCPP_EXT_CALL_STAGE_TIMINGS_H
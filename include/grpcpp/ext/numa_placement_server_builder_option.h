@@ -0,0 +1,48 @@
+/*
+ *
+ * Copyright 2022 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPCPP_EXT_NUMA_PLACEMENT_SERVER_BUILDER_OPTION_H
+#define GRPCPP_EXT_NUMA_PLACEMENT_SERVER_BUILDER_OPTION_H
+
+#include <memory>
+#include <vector>
+
+#include <grpcpp/impl/server_builder_option.h>
+#include <grpcpp/support/config.h>
+
+namespace grpc {
+
+/// Enables NUMA-aware placement for a sync server: completion queues are
+/// distributed across NUMA nodes round robin and each queue's polling threads
+/// are pinned to the CPUs of the node owning that queue. Only effective on
+/// Linux; a no-op elsewhere or when the topology cannot be determined.
+class NumaPlacementServerBuilderOption : public ServerBuilderOption {
+ public:
+  explicit NumaPlacementServerBuilderOption(bool enabled = true);
+  ~NumaPlacementServerBuilderOption() override {}
+  void UpdateArguments(ChannelArguments* args) override;
+  void UpdatePlugins(
+      std::vector<std::unique_ptr<ServerBuilderPlugin>>* plugins) override;
+
+ private:
+  bool enabled_;
+};
+
+}  // namespace grpc
+
+#endif  // GRPCPP_EXT_NUMA_PLACEMENT_SERVER_BUILDER_OPTION_H
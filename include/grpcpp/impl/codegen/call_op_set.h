@@ -24,6 +24,7 @@
 #include <cstring>
 #include <map>
 #include <memory>
+#include <utility>
 
 #include <grpc/impl/codegen/compression_types.h>
 #include <grpc/impl/codegen/grpc_types.h>
@@ -299,6 +300,17 @@ class CallOpSendMessage {
   template <class M>
   Status SendMessage(const M& message) GRPC_MUST_USE_RESULT;
 
+  /// Send \a message by transferring ownership of its contents into the op,
+  /// using \a options for the write. The \a options are cleared after use.
+  /// No serialization or buffer reconstruction takes place: the message's
+  /// slice references are handed directly to the call's send path. This is
+  /// the pass-through form used when forwarding a received message (e.g. by
+  /// generic proxies).
+  Status SendMessage(ByteBuffer&& message,
+                     WriteOptions options) GRPC_MUST_USE_RESULT;
+
+  Status SendMessage(ByteBuffer&& message) GRPC_MUST_USE_RESULT;
+
   /// Send \a message using \a options for the write. The \a options are cleared
   /// after use. This form of SendMessage allows gRPC to reference \a message
   /// beyond the lifetime of SendMessage.
@@ -400,6 +412,17 @@ Status CallOpSendMessage::SendMessage(const M& message) {
   return SendMessage(message, WriteOptions());
 }
 
+inline Status CallOpSendMessage::SendMessage(ByteBuffer&& message,
+                                             WriteOptions options) {
+  write_options_ = options;
+  send_buf_ = std::move(message);
+  return Status();
+}
+
+inline Status CallOpSendMessage::SendMessage(ByteBuffer&& message) {
+  return SendMessage(std::move(message), WriteOptions());
+}
+
 template <class M>
 Status CallOpSendMessage::SendMessagePtr(const M* message,
                                          WriteOptions options) {
@@ -882,6 +905,7 @@ class CallOpSet : public CallOpSetInterface,
         return_tag_(this),
         call_(other.call_),
         done_intercepting_(false),
+        no_interceptors_(false),
         interceptor_methods_(InterceptorBatchMethodsImpl()) {}
 
   CallOpSet& operator=(const CallOpSet& other) {
@@ -892,6 +916,7 @@ class CallOpSet : public CallOpSetInterface,
     return_tag_ = this;
     call_ = other.call_;
     done_intercepting_ = false;
+    no_interceptors_ = false;
     interceptor_methods_ = InterceptorBatchMethodsImpl();
     return *this;
   }
@@ -902,6 +927,15 @@ class CallOpSet : public CallOpSetInterface,
     call_ =
         *call;  // It's fine to create a copy of call since it's just pointers
 
+    // Fast path: with no interceptors registered on this call there is no
+    // hook-point state to populate, so skip the per-op interception setup
+    // (and the matching post-recv pass in FinalizeResult) entirely.
+    no_interceptors_ =
+        InterceptorBatchMethodsImpl::NoInterceptorsForCall(&call_);
+    if (no_interceptors_) {
+      ContinueFillOpsAfterInterception();
+      return;
+    }
     if (RunInterceptors()) {
       ContinueFillOpsAfterInterception();
     } else {
@@ -930,7 +964,7 @@ class CallOpSet : public CallOpSetInterface,
     this->Op5::FinishOp(status);
     this->Op6::FinishOp(status);
     saved_status_ = *status;
-    if (RunInterceptorsPostRecv()) {
+    if (no_interceptors_ || RunInterceptorsPostRecv()) {
       *tag = return_tag_;
       g_core_codegen_interface->grpc_call_unref(call_.call());
       return true;
@@ -1035,6 +1069,9 @@ class CallOpSet : public CallOpSetInterface,
   void* return_tag_;
   Call call_;
   bool done_intercepting_ = false;
+  // Set by FillOps; true means this batch took the static no-interceptor
+  // path and FinalizeResult must not run the post-recv interception pass.
+  bool no_interceptors_ = false;
   InterceptorBatchMethodsImpl interceptor_methods_;
   bool saved_status_;
 };
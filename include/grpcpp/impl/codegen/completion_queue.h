@@ -59,6 +59,7 @@ class ServerReader;
 template <class W>
 class ServerWriter;
 namespace internal {
+class ReadAheadState;
 template <class W, class R>
 class ServerReaderWriterBody;
 
@@ -204,6 +205,31 @@ class CompletionQueue : private grpc::GrpcLibraryCodegen {
     return AsyncNextInternal(tag, ok, deadline_tp.raw_time());
   }
 
+  /// EXPERIMENTAL
+  /// Read up to \a max_events events from the queue in one call, blocking up
+  /// to \a deadline (or the queue's shutdown) for the first one; the rest are
+  /// harvested without further blocking if they are already queued. Event
+  /// loops that drain a queue from a single thread can use this to amortize
+  /// the synchronization cost of waking up over several events.
+  ///
+  /// \param[out] tags Array of at least \a max_events tag slots.
+  /// \param[out] oks Array of at least \a max_events ok slots, updated in
+  ///        lockstep with \a tags.
+  /// \param[in] max_events Maximum number of events to harvest.
+  /// \param[out] num_events Number of tag/ok pairs written; non-zero exactly
+  ///        when GOT_EVENT is returned.
+  /// \param[in] deadline How long to block in wait for the first event.
+  ///
+  /// \return The type of the read: GOT_EVENT if at least one event was
+  ///         harvested, otherwise TIMEOUT or SHUTDOWN as with \a AsyncNext.
+  template <typename T>
+  NextStatus AsyncNextBatch(void** tags, bool* oks, size_t max_events,
+                            size_t* num_events, const T& deadline) {
+    grpc::TimePoint<T> deadline_tp(deadline);
+    return AsyncNextBatchInternal(tags, oks, max_events, num_events,
+                                  deadline_tp.raw_time());
+  }
+
   /// EXPERIMENTAL
   /// First executes \a F, then reads from the queue, blocking up to
   /// \a deadline (or the queue's shutdown).
@@ -278,6 +304,7 @@ class CompletionQueue : private grpc::GrpcLibraryCodegen {
   friend class grpc::ServerWriter;
   template <class W, class R>
   friend class grpc::internal::ServerReaderWriterBody;
+  friend class grpc::internal::ReadAheadState;
   template <class ResponseType>
   friend void grpc::internal::UnaryRunHandlerHelper(
       const grpc::internal::MethodHandler::HandlerParameter&, ResponseType*,
@@ -319,6 +346,9 @@ class CompletionQueue : private grpc::GrpcLibraryCodegen {
 
   NextStatus AsyncNextInternal(void** tag, bool* ok, gpr_timespec deadline);
 
+  NextStatus AsyncNextBatchInternal(void** tags, bool* oks, size_t max_events,
+                                    size_t* num_events, gpr_timespec deadline);
+
   /// Wraps \a grpc_completion_queue_pluck.
   /// \warning Must not be mixed with calls to \a Next.
   bool Pluck(grpc::internal::CompletionQueueTag* tag) {
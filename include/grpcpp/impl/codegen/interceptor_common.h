@@ -219,6 +219,20 @@ class InterceptorBatchMethodsImpl
   // Alternatively, RunInterceptors(std::function<void(void)> f) can be used.
   void SetCallOpSetInterface(CallOpSetInterface* ops) { ops_ = ops; }
 
+  // Returns true if \a call has no interceptors registered. Unlike
+  // InterceptorsListEmpty, this needs no per-batch state at all, so call op
+  // sets can consult it before doing any interception setup and take a
+  // static fast path when the answer is true.
+  static bool NoInterceptorsForCall(Call* call) {
+    auto* client_rpc_info = call->client_rpc_info();
+    if (client_rpc_info != nullptr) {
+      return client_rpc_info->interceptors_.empty();
+    }
+
+    auto* server_rpc_info = call->server_rpc_info();
+    return server_rpc_info == nullptr || server_rpc_info->interceptors_.empty();
+  }
+
   // SetCall should have been called before this.
   // Returns true if the interceptors list is empty
   bool InterceptorsListEmpty() {
@@ -41,6 +41,14 @@ extern CoreCodegenInterface* g_core_codegen_interface;
 // Forward declaration for testing use only
 namespace internal {
 class ProtoBufferWriterPeer;
+
+/// Provision a serialization block of at least \a length bytes. Blocks of
+/// common sizes are drawn from a process-wide freelist (bucketed by
+/// power-of-two size) instead of the allocator, and return to it when the
+/// last reference to the produced slice is dropped. The returned slice may
+/// be longer than requested; very small and very large requests fall back to
+/// a plain slice allocation.
+grpc_slice AcquireProtoBufferBlock(size_t length);
 }  // namespace internal
 
 const int kProtoBufferWriterMaxBufferLength = 1024 * 1024;
@@ -101,10 +109,15 @@ class ProtoBufferWriter : public grpc::protobuf::io::ZeroCopyOutputStream {
       // But make sure the allocated slice is not inlined.
       size_t allocate_length =
           remain > static_cast<size_t>(block_size_) ? block_size_ : remain;
-      slice_ = g_core_codegen_interface->grpc_slice_malloc(
+      slice_ = internal::AcquireProtoBufferBlock(
           allocate_length > GRPC_SLICE_INLINED_SIZE
               ? allocate_length
               : GRPC_SLICE_INLINED_SIZE + 1);
+      // A pooled block may be larger than requested; never hand the proto
+      // layer more than it still needs.
+      if (GRPC_SLICE_LENGTH(slice_) > remain) {
+        GRPC_SLICE_SET_LENGTH(slice_, remain);
+      }
     }
     *data = GRPC_SLICE_START_PTR(slice_);
     // On win x64, int is only 32bit
@@ -143,6 +143,59 @@ class WriterInterface {
   }
 };
 
+/// Library-owned state for opt-in message prefetch on the synchronous stream
+/// readers. When enabled, one recv op is kept in flight with the transport
+/// while the application processes the current message: Read() takes the
+/// completed wire bytes, immediately rearms the next recv, and only then
+/// deserializes. Core permits a single pending recv op per call, so the
+/// effective window is one message ahead plus whatever the transport buffers
+/// under its flow-control window.
+class ReadAheadState {
+ public:
+  void Enable() { enabled_ = true; }
+  bool enabled() const { return enabled_; }
+  bool armed() const { return armed_; }
+  bool done() const { return done_; }
+  void MarkDone() { done_ = true; }
+
+  /// Start receiving the next message into the library-owned buffer.
+  void Arm(Call* call) {
+    ops_ = CallOpSet<CallOpRecvMessage<ByteBuffer>>();
+    ops_.RecvMessage(&buf_);
+    call->PerformOps(&ops_);
+    armed_ = true;
+  }
+
+  /// Block for the armed recv and move the wire bytes into \a bytes.
+  /// Returns false at end of stream or on failure.
+  bool Take(grpc::CompletionQueue* cq, ByteBuffer* bytes) {
+    bool ok = cq->Pluck(&ops_) && ops_.got_message;
+    armed_ = false;
+    if (!ok) {
+      done_ = true;
+      return false;
+    }
+    bytes->Swap(&buf_);
+    return true;
+  }
+
+  /// Discard a still-armed recv (blocking for its completion) so the call
+  /// can be torn down with no batch outstanding.
+  void Drain(grpc::CompletionQueue* cq) {
+    if (!armed_) return;
+    cq->Pluck(&ops_);
+    armed_ = false;
+    done_ = true;
+  }
+
+ private:
+  CallOpSet<CallOpRecvMessage<ByteBuffer>> ops_;
+  ByteBuffer buf_;
+  bool enabled_ = false;
+  bool armed_ = false;
+  bool done_ = false;
+};
+
 }  // namespace internal
 
 /// Client-side interface for streaming reads of message of type \a R.
@@ -199,12 +252,25 @@ class ClientReader final : public ClientReaderInterface<R> {
     return true;
   }
 
+  /// Enable library-side prefetch of incoming messages: after each
+  /// successful Read() the next recv stays in flight with the transport
+  /// while the application processes the current message. Must be called
+  /// before the first Read(). Once enabled, keep calling Read() until it
+  /// returns false, or call Finish(), which drains any pending prefetch.
+  /// Calls with interceptors registered ignore the hint.
+  void EnableMessagePrefetch() { read_ahead_.Enable(); }
+
   /// See the \a ReaderInterface.Read method for semantics.
   /// Side effect:
   ///   This also receives initial metadata from the server, if not
   ///   already received (if initial metadata is received, it can be then
   ///   accessed through the \a ClientContext associated with this call).
   bool Read(R* msg) override {
+    if (read_ahead_.enabled() &&
+        grpc::internal::InterceptorBatchMethodsImpl::NoInterceptorsForCall(
+            &call_)) {
+      return PrefetchingRead(msg);
+    }
     grpc::internal::CallOpSet<grpc::internal::CallOpRecvInitialMetadata,
                               grpc::internal::CallOpRecvMessage<R>>
         ops;
@@ -222,6 +288,7 @@ class ClientReader final : public ClientReaderInterface<R> {
   ///   The \a ClientContext associated with this call is updated with
   ///   possible metadata received from the server.
   grpc::Status Finish() override {
+    read_ahead_.Drain(&cq_);
     grpc::internal::CallOpSet<grpc::internal::CallOpRecvInitialMetadata,
                               grpc::internal::CallOpClientRecvStatus>
         ops;
@@ -240,6 +307,36 @@ class ClientReader final : public ClientReaderInterface<R> {
   grpc::ClientContext* context_;
   grpc::CompletionQueue cq_;
   grpc::internal::Call call_;
+  grpc::internal::ReadAheadState read_ahead_;
+
+  bool PrefetchingRead(R* msg) {
+    if (read_ahead_.done()) return false;
+    if (!read_ahead_.armed()) {
+      // First read: take the message (and initial metadata) directly, then
+      // arm the prefetch for the messages that follow.
+      grpc::internal::CallOpSet<grpc::internal::CallOpRecvInitialMetadata,
+                                grpc::internal::CallOpRecvMessage<R>>
+          ops;
+      if (!context_->initial_metadata_received_) {
+        ops.RecvInitialMetadata(context_);
+      }
+      ops.RecvMessage(msg);
+      call_.PerformOps(&ops);
+      if (!(cq_.Pluck(&ops) && ops.got_message)) {
+        read_ahead_.MarkDone();
+        return false;
+      }
+      read_ahead_.Arm(&call_);
+      return true;
+    }
+    grpc::ByteBuffer bytes;
+    if (!read_ahead_.Take(&cq_, &bytes)) return false;
+    // Rearm before deserializing so the transport refills the pipeline
+    // while we decode.
+    read_ahead_.Arm(&call_);
+    grpc::internal::DeserializeFuncType<R> deserialize(msg);
+    return deserialize.Deserialize(&bytes).ok();
+  }
 
   /// Block to create a stream and write the initial metadata and \a request
   /// out. Note that \a context will be used to fill in custom initial
@@ -470,11 +567,24 @@ class ClientReaderWriter final : public ClientReaderWriterInterface<W, R> {
     return true;
   }
 
+  /// Enable library-side prefetch of incoming messages: after each
+  /// successful Read() the next recv stays in flight with the transport
+  /// while the application processes the current message. Must be called
+  /// before the first Read(). Once enabled, keep calling Read() until it
+  /// returns false, or call Finish(), which drains any pending prefetch.
+  /// Calls with interceptors registered ignore the hint.
+  void EnableMessagePrefetch() { read_ahead_.Enable(); }
+
   /// See the \a ReaderInterface.Read method for semantics.
   /// Side effect:
   ///   Also receives initial metadata if not already received (updates the \a
   ///   ClientContext associated with this call in that case).
   bool Read(R* msg) override {
+    if (read_ahead_.enabled() &&
+        grpc::internal::InterceptorBatchMethodsImpl::NoInterceptorsForCall(
+            &call_)) {
+      return PrefetchingRead(msg);
+    }
     grpc::internal::CallOpSet<grpc::internal::CallOpRecvInitialMetadata,
                               grpc::internal::CallOpRecvMessage<R>>
         ops;
@@ -528,6 +638,7 @@ class ClientReaderWriter final : public ClientReaderWriterInterface<W, R> {
   ///   - the \a ClientContext associated with this call is updated with
   ///     possible trailing metadata sent from the server.
   grpc::Status Finish() override {
+    read_ahead_.Drain(&cq_);
     grpc::internal::CallOpSet<grpc::internal::CallOpRecvInitialMetadata,
                               grpc::internal::CallOpClientRecvStatus>
         ops;
@@ -547,6 +658,36 @@ class ClientReaderWriter final : public ClientReaderWriterInterface<W, R> {
   grpc::ClientContext* context_;
   grpc::CompletionQueue cq_;
   grpc::internal::Call call_;
+  grpc::internal::ReadAheadState read_ahead_;
+
+  bool PrefetchingRead(R* msg) {
+    if (read_ahead_.done()) return false;
+    if (!read_ahead_.armed()) {
+      // First read: take the message (and initial metadata) directly, then
+      // arm the prefetch for the messages that follow.
+      grpc::internal::CallOpSet<grpc::internal::CallOpRecvInitialMetadata,
+                                grpc::internal::CallOpRecvMessage<R>>
+          ops;
+      if (!context_->initial_metadata_received_) {
+        ops.RecvInitialMetadata(context_);
+      }
+      ops.RecvMessage(msg);
+      call_.PerformOps(&ops);
+      if (!(cq_.Pluck(&ops) && ops.got_message)) {
+        read_ahead_.MarkDone();
+        return false;
+      }
+      read_ahead_.Arm(&call_);
+      return true;
+    }
+    grpc::ByteBuffer bytes;
+    if (!read_ahead_.Take(&cq_, &bytes)) return false;
+    // Rearm before deserializing so the transport refills the pipeline
+    // while we decode.
+    read_ahead_.Arm(&call_);
+    grpc::internal::DeserializeFuncType<R> deserialize(msg);
+    return deserialize.Deserialize(&bytes).ok();
+  }
 
   /// Block to create a stream and write the initial metadata and \a request
   /// out. Note that \a context will be used to fill in custom initial metadata
@@ -603,7 +744,20 @@ class ServerReader final : public ServerReaderInterface<R> {
     return true;
   }
 
+  /// Enable library-side prefetch of incoming messages: after each
+  /// successful Read() the next recv stays in flight with the transport
+  /// while the handler processes the current message. Must be called before
+  /// the first Read(). Once enabled, the handler must keep calling Read()
+  /// until it returns false before returning, so that no recv op is left
+  /// outstanding. Calls with interceptors registered ignore the hint.
+  void EnableMessagePrefetch() { read_ahead_.Enable(); }
+
   bool Read(R* msg) override {
+    if (read_ahead_.enabled() &&
+        grpc::internal::InterceptorBatchMethodsImpl::NoInterceptorsForCall(
+            call_)) {
+      return PrefetchingRead(msg);
+    }
     grpc::internal::CallOpSet<grpc::internal::CallOpRecvMessage<R>> ops;
     ops.RecvMessage(msg);
     call_->PerformOps(&ops);
@@ -617,12 +771,41 @@ class ServerReader final : public ServerReaderInterface<R> {
  private:
   grpc::internal::Call* const call_;
   ServerContext* const ctx_;
+  grpc::internal::ReadAheadState read_ahead_;
 
   template <class ServiceType, class RequestType, class ResponseType>
   friend class internal::ClientStreamingHandler;
 
   ServerReader(grpc::internal::Call* call, grpc::ServerContext* ctx)
       : call_(call), ctx_(ctx) {}
+
+  bool PrefetchingRead(R* msg) {
+    if (read_ahead_.done()) return false;
+    if (!read_ahead_.armed()) {
+      // First read: take the message directly, then arm the prefetch for
+      // the messages that follow.
+      grpc::internal::CallOpSet<grpc::internal::CallOpRecvMessage<R>> ops;
+      ops.RecvMessage(msg);
+      call_->PerformOps(&ops);
+      if (!(call_->cq()->Pluck(&ops) && ops.got_message)) {
+        read_ahead_.MarkDone();
+        ctx_->MaybeMarkCancelledOnRead();
+        return false;
+      }
+      read_ahead_.Arm(call_);
+      return true;
+    }
+    grpc::ByteBuffer bytes;
+    if (!read_ahead_.Take(call_->cq(), &bytes)) {
+      ctx_->MaybeMarkCancelledOnRead();
+      return false;
+    }
+    // Rearm before deserializing so the transport refills the pipeline
+    // while we decode.
+    read_ahead_.Arm(call_);
+    grpc::internal::DeserializeFuncType<R> deserialize(msg);
+    return deserialize.Deserialize(&bytes).ok();
+  }
 };
 
 /// Server-side interface for streaming writes of message of type \a W.
@@ -733,7 +916,14 @@ class ServerReaderWriterBody final {
     return true;
   }
 
+  void EnableMessagePrefetch() { read_ahead_.Enable(); }
+
   bool Read(R* msg) {
+    if (read_ahead_.enabled() &&
+        grpc::internal::InterceptorBatchMethodsImpl::NoInterceptorsForCall(
+            call_)) {
+      return PrefetchingRead(msg);
+    }
     grpc::internal::CallOpSet<grpc::internal::CallOpRecvMessage<R>> ops;
     ops.RecvMessage(msg);
     call_->PerformOps(&ops);
@@ -774,6 +964,35 @@ class ServerReaderWriterBody final {
  private:
   grpc::internal::Call* const call_;
   grpc::ServerContext* const ctx_;
+  grpc::internal::ReadAheadState read_ahead_;
+
+  bool PrefetchingRead(R* msg) {
+    if (read_ahead_.done()) return false;
+    if (!read_ahead_.armed()) {
+      // First read: take the message directly, then arm the prefetch for
+      // the messages that follow.
+      grpc::internal::CallOpSet<grpc::internal::CallOpRecvMessage<R>> ops;
+      ops.RecvMessage(msg);
+      call_->PerformOps(&ops);
+      if (!(call_->cq()->Pluck(&ops) && ops.got_message)) {
+        read_ahead_.MarkDone();
+        ctx_->MaybeMarkCancelledOnRead();
+        return false;
+      }
+      read_ahead_.Arm(call_);
+      return true;
+    }
+    grpc::ByteBuffer bytes;
+    if (!read_ahead_.Take(call_->cq(), &bytes)) {
+      ctx_->MaybeMarkCancelledOnRead();
+      return false;
+    }
+    // Rearm before deserializing so the transport refills the pipeline
+    // while we decode.
+    read_ahead_.Arm(call_);
+    grpc::internal::DeserializeFuncType<R> deserialize(msg);
+    return deserialize.Deserialize(&bytes).ok();
+  }
 };
 
 }  // namespace internal
@@ -794,6 +1013,14 @@ class ServerReaderWriter final : public ServerReaderWriterInterface<W, R> {
     return body_.NextMessageSize(sz);
   }
 
+  /// Enable library-side prefetch of incoming messages: after each
+  /// successful Read() the next recv stays in flight with the transport
+  /// while the handler processes the current message. Must be called before
+  /// the first Read(). Once enabled, the handler must keep calling Read()
+  /// until it returns false before returning, so that no recv op is left
+  /// outstanding. Calls with interceptors registered ignore the hint.
+  void EnableMessagePrefetch() { body_.EnableMessagePrefetch(); }
+
   bool Read(R* msg) override { return body_.Read(msg); }
 
   /// See the \a WriterInterface.Write(const W& msg, WriteOptions options)
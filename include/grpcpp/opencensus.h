@@ -42,6 +42,18 @@ void RegisterOpenCensusViewsForExport();
 // Returns the tracing Span for the current RPC.
 ::opencensus::trace::Span GetSpanFromServerContext(ServerContext* context);
 
+namespace experimental {
+
+// Buffers RPC stats measurements in per-CPU buffers and flushes them into the
+// OpenCensus stats maps on a periodic timer, instead of walking the
+// (mutex-protected) maps on every RPC. This removes most of the per-RPC cost
+// of the OpenCensus plugin; in exchange, view data lags recording by up to
+// the flush interval (100ms). Takes effect for measurements recorded after
+// the call and cannot be undone.
+void EnableOpenCensusStatsBuffering();
+
+}  // namespace experimental
+
 }  // namespace grpc
 
 #endif  // GRPCPP_OPENCENSUS_H
@@ -19,6 +19,8 @@
 #ifndef GRPCPP_SUPPORT_ASYNC_STREAM_H
 #define GRPCPP_SUPPORT_ASYNC_STREAM_H
 
+#include <utility>
+
 #include <grpc/grpc.h>
 #include <grpcpp/impl/call.h>
 #include <grpcpp/impl/codegen/channel_interface.h>
@@ -577,6 +579,31 @@ class ClientAsyncReaderWriter final
     call_.PerformOps(&write_ops_);
   }
 
+  /// Write \a msg by transferring ownership of its contents to the write. For
+  /// \a ByteBuffer messages (e.g. a generic proxy forwarding a payload it
+  /// received) this hands the message's slice references directly to the
+  /// outgoing call without reconstructing the buffer; other message types are
+  /// serialized as usual.
+  void Write(W&& msg, void* tag) {
+    GPR_CODEGEN_ASSERT(started_);
+    write_ops_.set_output_tag(tag);
+    // TODO(ctiller): don't assert
+    GPR_CODEGEN_ASSERT(write_ops_.SendMessage(std::move(msg)).ok());
+    call_.PerformOps(&write_ops_);
+  }
+
+  void Write(W&& msg, grpc::WriteOptions options, void* tag) {
+    GPR_CODEGEN_ASSERT(started_);
+    write_ops_.set_output_tag(tag);
+    if (options.is_last_message()) {
+      options.set_buffer_hint();
+      write_ops_.ClientSendClose();
+    }
+    // TODO(ctiller): don't assert
+    GPR_CODEGEN_ASSERT(write_ops_.SendMessage(std::move(msg), options).ok());
+    call_.PerformOps(&write_ops_);
+  }
+
   void WritesDone(void* tag) override {
     GPR_CODEGEN_ASSERT(started_);
     write_ops_.set_output_tag(tag);
@@ -1057,6 +1084,29 @@ class ServerAsyncReaderWriter final
     call_.PerformOps(&write_ops_);
   }
 
+  /// Write \a msg by transferring ownership of its contents to the write. For
+  /// \a ByteBuffer messages (e.g. a generic proxy forwarding a payload it
+  /// received) this hands the message's slice references directly to the
+  /// outgoing call without reconstructing the buffer; other message types are
+  /// serialized as usual.
+  void Write(W&& msg, void* tag) {
+    write_ops_.set_output_tag(tag);
+    EnsureInitialMetadataSent(&write_ops_);
+    // TODO(ctiller): don't assert
+    GPR_CODEGEN_ASSERT(write_ops_.SendMessage(std::move(msg)).ok());
+    call_.PerformOps(&write_ops_);
+  }
+
+  void Write(W&& msg, grpc::WriteOptions options, void* tag) {
+    write_ops_.set_output_tag(tag);
+    if (options.is_last_message()) {
+      options.set_buffer_hint();
+    }
+    EnsureInitialMetadataSent(&write_ops_);
+    GPR_CODEGEN_ASSERT(write_ops_.SendMessage(std::move(msg), options).ok());
+    call_.PerformOps(&write_ops_);
+  }
+
   /// See the \a ServerAsyncReaderWriterInterface.WriteAndFinish
   /// method for semantics.
   ///
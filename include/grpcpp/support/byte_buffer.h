@@ -95,6 +95,13 @@ class ByteBuffer final {
   /// size-independent.
   ByteBuffer(const ByteBuffer& buf) : buffer_(nullptr) { operator=(buf); }
 
+  /// Construct a byte buffer by taking ownership of \a buf's contents,
+  /// leaving \a buf empty. Unlike copy construction this neither allocates
+  /// nor touches slice reference counts.
+  ByteBuffer(ByteBuffer&& buf) noexcept : buffer_(buf.buffer_) {
+    buf.buffer_ = nullptr;
+  }
+
   ~ByteBuffer() {
     if (buffer_) {
       g_core_codegen_interface->grpc_byte_buffer_destroy(buffer_);
@@ -115,6 +122,17 @@ class ByteBuffer final {
     return *this;
   }
 
+  /// Take ownership of \a buf's contents, leaving \a buf empty. Neither
+  /// allocates nor touches slice reference counts.
+  ByteBuffer& operator=(ByteBuffer&& buf) noexcept {
+    if (this != &buf) {
+      Clear();
+      buffer_ = buf.buffer_;
+      buf.buffer_ = nullptr;
+    }
+    return *this;
+  }
+
   // If this ByteBuffer's representation is a single flat slice, returns a
   // slice referencing that array.
   Status TrySingleSlice(Slice* slice) const;
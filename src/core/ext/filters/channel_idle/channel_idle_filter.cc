@@ -233,36 +233,36 @@ bool ChannelIdleFilter::StartTransportOp(grpc_transport_op* op) {
 }
 
 void ChannelIdleFilter::Shutdown() {
-  // IncreaseCallCount() introduces a phony call and prevent the timer from
-  // being reset by other threads.
-  IncreaseCallCount();
+  // Record a phony call start so that a concurrently running probe can never
+  // observe idleness while we tear the activity down.
+  idle_state_->RecordCallStart();
   activity_.Reset();
 }
 
 void ChannelIdleFilter::IncreaseCallCount() {
-  idle_filter_state_->IncreaseCallCount();
+  idle_state_->RecordCallStart();
+  // The probe runs for the lifetime of the channel once the first call
+  // arrives; after that TryStartTimer() is a single uncontended load.
+  if (idle_state_->TryStartTimer()) StartIdleTimer();
 }
 
 void ChannelIdleFilter::DecreaseCallCount() {
-  if (idle_filter_state_->DecreaseCallCount()) {
-    // If there are no more calls in progress, start the idle timer.
-    StartIdleTimer();
-  }
+  idle_state_->RecordCallFinish();
 }
 
 void ChannelIdleFilter::StartIdleTimer() {
   GRPC_IDLE_FILTER_LOG("timer has started");
-  auto idle_filter_state = idle_filter_state_;
+  auto idle_state = idle_state_;
   // Hold a ref to the channel stack for the timer callback.
   auto channel_stack = channel_stack_->Ref();
   auto timeout = client_idle_timeout_;
-  auto promise = Loop([timeout, idle_filter_state]() {
+  auto promise = Loop([timeout, idle_state]() {
     return TrySeq(Sleep(Timestamp::Now() + timeout),
-                  [idle_filter_state]() -> Poll<LoopCtl<absl::Status>> {
-                    if (idle_filter_state->CheckTimer()) {
-                      return Continue{};
-                    } else {
+                  [idle_state]() -> Poll<LoopCtl<absl::Status>> {
+                    if (idle_state->CheckIdle()) {
                       return absl::OkStatus();
+                    } else {
+                      return Continue{};
                     }
                   });
   });
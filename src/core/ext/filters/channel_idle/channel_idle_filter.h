@@ -87,8 +87,9 @@ class ChannelIdleFilter : public ChannelFilter {
   // The channel stack to which we take refs for pending callbacks.
   grpc_channel_stack* channel_stack_;
   Duration client_idle_timeout_;
-  std::shared_ptr<IdleFilterState> idle_filter_state_{
-      std::make_shared<IdleFilterState>(false)};
+  // Shared with the probe activity, which may outlive the filter.
+  std::shared_ptr<PerCpuIdleState> idle_state_{
+      std::make_shared<PerCpuIdleState>()};
 
   SingleSetActivityPtr activity_;
   std::shared_ptr<grpc_event_engine::experimental::EventEngine> engine_;
@@ -93,4 +93,29 @@ bool IdleFilterState::CheckTimer() {
   return start_timer;
 }
 
+bool PerCpuIdleState::TryStartTimer() {
+  if (timer_started_.load(std::memory_order_acquire)) return false;
+  return !timer_started_.exchange(true, std::memory_order_acq_rel);
+}
+
+bool PerCpuIdleState::CheckIdle() {
+  // Sum finishes before starts: both counters only ever grow, so every
+  // finish we count here belongs to a start we will also count, and equal
+  // totals prove there was an instant between the two sums at which no call
+  // was in flight.
+  uint64_t finishes = 0;
+  for (Shard& shard : shards_) {
+    finishes += shard.finishes.load(std::memory_order_acquire);
+  }
+  uint64_t starts = 0;
+  for (Shard& shard : shards_) {
+    starts += shard.starts.load(std::memory_order_acquire);
+  }
+  if (starts != finishes || starts != last_starts_seen_) {
+    last_starts_seen_ = starts;
+    return false;
+  }
+  return true;
+}
+
 }  // namespace grpc_core
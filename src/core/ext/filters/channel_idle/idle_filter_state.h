@@ -21,6 +21,8 @@
 
 #include <atomic>
 
+#include "src/core/lib/gprpp/per_cpu.h"
+
 namespace grpc_core {
 
 // State machine for the idle filter.
@@ -63,6 +65,55 @@ class IdleFilterState {
   std::atomic<uintptr_t> state_;
 };
 
+// Epoch-sampled idleness tracking.
+// Call starts and finishes bump monotone per-CPU counters — a relaxed
+// fetch_add on a (usually) CPU-local cacheline — and a periodic probe sums
+// them to decide whether the channel went idle. Compared with
+// IdleFilterState there is no shared read-modify-write on the call path; in
+// exchange the probe timer keeps firing while the channel is busy.
+class PerCpuIdleState {
+ public:
+  PerCpuIdleState() = default;
+  ~PerCpuIdleState() = default;
+
+  PerCpuIdleState(const PerCpuIdleState&) = delete;
+  PerCpuIdleState& operator=(const PerCpuIdleState&) = delete;
+
+  // Record that a call started on this CPU.
+  void RecordCallStart() {
+    shards_.this_cpu().starts.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // Record that a call finished on this CPU (not necessarily the CPU it
+  // started on; only the sums matter).
+  void RecordCallFinish() {
+    shards_.this_cpu().finishes.fetch_add(1, std::memory_order_release);
+  }
+
+  // Returns true exactly once, for the caller that should start the probe
+  // timer. Afterwards this is a read of a never-changing flag.
+  GRPC_MUST_USE_RESULT bool TryStartTimer();
+
+  // Called by the probe timer. Returns true if the channel both passed
+  // through a point with no call in progress during this probe and saw no
+  // new call since the previous probe — i.e. it has been idle for a full
+  // probe cycle. Must not be called concurrently with itself (in the filter
+  // it only runs inside the single probe activity).
+  GRPC_MUST_USE_RESULT bool CheckIdle();
+
+ private:
+  struct Shard {
+    std::atomic<uint64_t> starts{0};
+    std::atomic<uint64_t> finishes{0};
+  };
+
+  PerCpu<Shard> shards_;
+  std::atomic<bool> timer_started_{false};
+  // Total starts observed by the previous CheckIdle(); only the probe
+  // touches it.
+  uint64_t last_starts_seen_ = 0;
+};
+
 }  // namespace grpc_core
 
 #endif  // GRPC_CORE_EXT_FILTERS_CHANNEL_IDLE_IDLE_FILTER_STATE_H
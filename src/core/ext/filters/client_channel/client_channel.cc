@@ -61,6 +61,8 @@
 #include "src/core/lib/channel/channel_trace.h"
 #include "src/core/lib/channel/status_util.h"
 #include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/debug/call_stage_profiler.h"
+#include "src/core/lib/debug/stats.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/debug_location.h"
@@ -73,6 +75,7 @@
 #include "src/core/lib/json/json.h"
 #include "src/core/lib/load_balancing/lb_policy_registry.h"
 #include "src/core/lib/load_balancing/subchannel_interface.h"
+#include "src/core/lib/resolver/resolver_factory.h"
 #include "src/core/lib/resolver/resolver_registry.h"
 #include "src/core/lib/resolver/server_address.h"
 #include "src/core/lib/service_config/service_config_call_data.h"
@@ -82,6 +85,7 @@
 #include "src/core/lib/transport/connectivity_state.h"
 #include "src/core/lib/transport/error_utils.h"
 #include "src/core/lib/transport/metadata_batch.h"
+#include "src/core/lib/uri/uri_parser.h"
 
 //
 // Client channel filter
@@ -978,6 +982,9 @@ ClientChannel::ClientChannel(grpc_channel_element_args* args,
                              grpc_error_handle* error)
     : channel_args_(ChannelArgs::FromC(args->channel_args)),
       deadline_checking_enabled_(grpc_deadline_checking_enabled(channel_args_)),
+      lb_pick_cache_enabled_(
+          channel_args_.GetBool(GRPC_ARG_ENABLE_LB_PICK_CACHE)
+              .value_or(false)),
       owning_stack_(args->channel_stack),
       client_channel_factory_(channel_args_.GetObject<ClientChannelFactory>()),
       channelz_node_(channel_args_.GetObject<channelz::ChannelNode>()),
@@ -1053,6 +1060,28 @@ ClientChannel::ClientChannel(grpc_channel_element_args* args,
   } else {
     default_authority_ = std::move(*default_authority);
   }
+  // If requested, start resolving literal targets now, so that the LB
+  // policy is already constructed by the time the channel is first used.
+  // The sockaddr resolvers report their result inline from StartLocked(),
+  // so this completes before the constructor returns in the common case
+  // where nothing else holds the work serializer.
+  if (channel_args_.GetBool(GRPC_ARG_EAGER_LITERAL_TARGET_RESOLUTION)
+          .value_or(false)) {
+    absl::StatusOr<URI> uri = URI::Parse(uri_to_resolve_);
+    if (uri.ok()) {
+      ResolverFactory* factory =
+          CoreConfiguration::Get().resolver_registry().LookupResolverFactory(
+              uri->scheme());
+      if (factory != nullptr && factory->ResolvesSynchronously()) {
+        GRPC_CHANNEL_STACK_REF(owning_stack_, "TryToConnect");
+        work_serializer_->Run(
+            [this]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(*work_serializer_) {
+              TryToConnectLocked();
+            },
+            DEBUG_LOCATION);
+      }
+    }
+  }
   // Success.
   *error = absl::OkStatus();
 }
@@ -1571,6 +1600,8 @@ void ClientChannel::UpdateStateAndPickerLocked(
     // Swap out the picker.
     // Note: Original value will be destroyed after the lock is released.
     picker_.swap(picker);
+    // Any cached pick came from the old picker.
+    lb_pick_cache_subchannel_.reset();
     // Re-process queued picks.
     for (LbQueuedCall* call = lb_queued_calls_; call != nullptr;
          call = call->next) {
@@ -3082,8 +3113,29 @@ void ClientChannel::LoadBalancedCall::PickSubchannel(void* arg,
 
 bool ClientChannel::LoadBalancedCall::PickSubchannelLocked(
     grpc_error_handle* error) {
+  ScopedCallStageTimer timer(CallStage::kLbPick);
   GPR_ASSERT(connected_subchannel_ == nullptr);
   GPR_ASSERT(subchannel_call_ == nullptr);
+  // Fast path: if the current picker has already produced a cacheable pick,
+  // reuse its subchannel instead of re-running the picker.
+  if (chand_->lb_pick_cache_subchannel_ != nullptr) {
+    SubchannelWrapper* subchannel = static_cast<SubchannelWrapper*>(
+        chand_->lb_pick_cache_subchannel_.get());
+    connected_subchannel_ = subchannel->connected_subchannel();
+    if (connected_subchannel_ != nullptr) {
+      GRPC_STATS_INC_LB_PICK_CACHE_HITS();
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_lb_call_trace)) {
+        gpr_log(GPR_INFO,
+                "chand=%p lb_call=%p: reusing cached pick: subchannel=%p",
+                chand_, this, subchannel);
+      }
+      MaybeRemoveCallFromLbQueuedCallsLocked();
+      return true;
+    }
+    // The cached subchannel lost its connection; fall back to a full pick.
+    chand_->lb_pick_cache_subchannel_.reset();
+  }
+  if (chand_->lb_pick_cache_enabled_) GRPC_STATS_INC_LB_PICK_CACHE_MISSES();
   // Grab initial metadata.
   auto& send_initial_metadata =
       pending_batches_[0]->payload->send_initial_metadata;
@@ -3131,6 +3183,10 @@ bool ClientChannel::LoadBalancedCall::PickSubchannelLocked(
                 std::move(complete_pick->subchannel_call_tracker);
             if (lb_subchannel_call_tracker_ != nullptr) {
               lb_subchannel_call_tracker_->Start();
+            } else if (chand_->lb_pick_cache_enabled_) {
+              // The policy attached no per-call tracker, so it does not need
+              // to observe every pick; cache the subchannel for reuse.
+              chand_->lb_pick_cache_subchannel_ = complete_pick->subchannel;
             }
             MaybeRemoveCallFromLbQueuedCallsLocked();
             return true;
@@ -92,6 +92,23 @@
 // Channel arg containing a pointer to the ClientChannel object.
 #define GRPC_ARG_CLIENT_CHANNEL "grpc.internal.client_channel"
 
+// If non-zero, cache the most recent successful LB pick on the channel and
+// reuse its subchannel for subsequent RPCs until the picker is swapped or
+// the subchannel disconnects. Only suitable for workloads where every RPC
+// on the channel should go to the same subchannel (e.g. pick_first); picks
+// that attach a per-call tracker are never cached, since the policy needs
+// to observe each pick. Default is false.
+#define GRPC_ARG_ENABLE_LB_PICK_CACHE "grpc.internal.enable_lb_pick_cache"
+
+// If non-zero and the channel target resolves synchronously (e.g., a literal
+// "ipv4:"/"ipv6:"/"unix:" address), start name resolution at channel creation
+// instead of waiting for the first RPC or connectivity check, so that the LB
+// policy is already constructed by the time the channel is first used. Note
+// that such channels report CONNECTING rather than IDLE immediately after
+// creation. Default is false.
+#define GRPC_ARG_EAGER_LITERAL_TARGET_RESOLUTION \
+  "grpc.internal.eager_literal_target_resolution"
+
 // Max number of batches that can be pending on a call at any given
 // time.  This includes one batch for each of the following ops:
 //   recv_initial_metadata
@@ -302,6 +319,7 @@ class ClientChannel {
   //
   ChannelArgs channel_args_;
   const bool deadline_checking_enabled_;
+  const bool lb_pick_cache_enabled_;
   grpc_channel_stack* owning_stack_;
   ClientChannelFactory* client_channel_factory_;
   RefCountedPtr<ServiceConfig> default_service_config_;
@@ -334,6 +352,11 @@ class ClientChannel {
   mutable Mutex data_plane_mu_;
   std::unique_ptr<LoadBalancingPolicy::SubchannelPicker> picker_
       ABSL_GUARDED_BY(data_plane_mu_);
+  // Subchannel from the most recent cacheable pick, if pick caching is
+  // enabled.  Reset whenever the picker is swapped.  See
+  // GRPC_ARG_ENABLE_LB_PICK_CACHE.
+  RefCountedPtr<SubchannelInterface> lb_pick_cache_subchannel_
+      ABSL_GUARDED_BY(data_plane_mu_);
   // Linked list of calls queued waiting for LB pick.
   LbQueuedCall* lb_queued_calls_ ABSL_GUARDED_BY(data_plane_mu_) = nullptr;
 
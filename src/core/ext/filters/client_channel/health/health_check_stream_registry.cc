@@ -0,0 +1,128 @@
+//
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/filters/client_channel/health/health_check_stream_registry.h"
+
+#include <algorithm>
+
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+
+namespace grpc_core {
+
+HealthCheckStreamRegistry* HealthCheckStreamRegistry::Get() {
+  static HealthCheckStreamRegistry* registry = new HealthCheckStreamRegistry();
+  return registry;
+}
+
+void HealthCheckStreamRegistry::Register(
+    const std::string& key, RefCountedPtr<Subscription> subscription) {
+  MutexLock lock(&mu_);
+  entries_[key].subscriptions.push_back(std::move(subscription));
+}
+
+void HealthCheckStreamRegistry::Unregister(const std::string& key,
+                                           Subscription* subscription) {
+  MutexLock lock(&mu_);
+  auto it = entries_.find(key);
+  if (it == entries_.end()) return;
+  Entry& entry = it->second;
+  entry.subscriptions.erase(
+      std::remove_if(entry.subscriptions.begin(), entry.subscriptions.end(),
+                     [&](const RefCountedPtr<Subscription>& s) {
+                       return s.get() == subscription;
+                     }),
+      entry.subscriptions.end());
+  if (entry.subscriptions.empty()) {
+    entries_.erase(it);
+    return;
+  }
+  if (entry.owner == subscription) {
+    entry.owner = nullptr;
+    NotifyOwnerLostLocked(&entry);
+  }
+}
+
+bool HealthCheckStreamRegistry::TryAcquire(
+    const std::string& key, Subscription* subscription,
+    absl::optional<grpc_connectivity_state>* state, absl::Status* status) {
+  MutexLock lock(&mu_);
+  auto it = entries_.find(key);
+  if (it == entries_.end()) return false;
+  Entry& entry = it->second;
+  if (entry.owner == nullptr || entry.owner == subscription) {
+    entry.owner = subscription;
+    return true;
+  }
+  *state = entry.last_state;
+  *status = entry.last_status;
+  return false;
+}
+
+void HealthCheckStreamRegistry::Release(const std::string& key,
+                                        Subscription* subscription) {
+  MutexLock lock(&mu_);
+  auto it = entries_.find(key);
+  if (it == entries_.end()) return;
+  Entry& entry = it->second;
+  if (entry.owner != subscription) return;
+  entry.owner = nullptr;
+  NotifyOwnerLostLocked(&entry);
+}
+
+void HealthCheckStreamRegistry::Publish(const std::string& key,
+                                        Subscription* subscription,
+                                        grpc_connectivity_state state,
+                                        const absl::Status& status) {
+  std::vector<RefCountedPtr<Subscription>> targets;
+  {
+    MutexLock lock(&mu_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) return;
+    Entry& entry = it->second;
+    if (entry.owner != subscription) return;
+    entry.last_state = state;
+    entry.last_status = status;
+    for (const auto& s : entry.subscriptions) {
+      if (s.get() != subscription) targets.push_back(s);
+    }
+  }
+  if (targets.empty()) return;
+  grpc_event_engine::experimental::GetDefaultEventEngine()->Run(
+      [targets = std::move(targets), state, status]() {
+        ApplicationCallbackExecCtx callback_exec_ctx;
+        ExecCtx exec_ctx;
+        for (const auto& target : targets) {
+          target->on_update_(state, status);
+        }
+      });
+}
+
+void HealthCheckStreamRegistry::NotifyOwnerLostLocked(Entry* entry) {
+  std::vector<RefCountedPtr<Subscription>> targets = entry->subscriptions;
+  grpc_event_engine::experimental::GetDefaultEventEngine()->Run(
+      [targets = std::move(targets)]() {
+        ApplicationCallbackExecCtx callback_exec_ctx;
+        ExecCtx exec_ctx;
+        for (const auto& target : targets) {
+          target->on_owner_lost_();
+        }
+      });
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,124 @@
+//
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_CORE_EXT_FILTERS_CLIENT_CHANNEL_HEALTH_HEALTH_CHECK_STREAM_REGISTRY_H
+#define GRPC_CORE_EXT_FILTERS_CLIENT_CHANNEL_HEALTH_HEALTH_CHECK_STREAM_REGISTRY_H
+
+#include <grpc/support/port_platform.h>
+
+#include <functional>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/status/status.h"
+#include "absl/types/optional.h"
+
+#include <grpc/impl/codegen/connectivity_state.h>
+
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+
+namespace grpc_core {
+
+// Deduplicates client-side health check watch streams across subchannels
+// that connect to the same address and watch the same service name.  At any
+// time at most one subscriber per key (the "owner") runs an actual stream on
+// its own connection; the state it reports is fanned out to the remaining
+// subscribers.  When the owner's connection goes away, the surviving
+// subscribers race to take the stream over.
+//
+// Sharing is opt-in (see GRPC_ARG_EXPERIMENTAL_SHARE_HEALTH_CHECK_STREAMS):
+// a shared stream reports the serving status seen over the owner's
+// connection, so subscribing subchannels give up the strictly per-connection
+// health semantics they would get from a dedicated stream.
+//
+// Lock ordering: subscribers call into the registry while holding their own
+// subchannel's lock, so the registry never invokes a subscriber callback
+// synchronously; all callbacks are delivered on EventEngine threads with no
+// locks held.
+class HealthCheckStreamRegistry {
+ public:
+  // One subchannel's interest in a shared stream.  Both callbacks are
+  // invoked with no locks held and must tolerate arriving after the
+  // subscription has been unregistered.
+  class Subscription : public RefCounted<Subscription> {
+   public:
+    Subscription(
+        std::function<void(grpc_connectivity_state, const absl::Status&)>
+            on_update,
+        std::function<void()> on_owner_lost)
+        : on_update_(std::move(on_update)),
+          on_owner_lost_(std::move(on_owner_lost)) {}
+
+   private:
+    friend class HealthCheckStreamRegistry;
+
+    std::function<void(grpc_connectivity_state, const absl::Status&)>
+        on_update_;
+    std::function<void()> on_owner_lost_;
+  };
+
+  static HealthCheckStreamRegistry* Get();
+
+  // Adds \a subscription to the entry for \a key.
+  void Register(const std::string& key,
+                RefCountedPtr<Subscription> subscription);
+
+  // Removes \a subscription.  If it was the owner, the remaining
+  // subscribers are notified via on_owner_lost so that one of them can
+  // claim the stream.
+  void Unregister(const std::string& key, Subscription* subscription);
+
+  // Attempts to make \a subscription the stream owner.  Returns true if it
+  // now owns the stream (or already did).  On failure, *state and *status
+  // receive the owner's last published report, if there has been one.
+  bool TryAcquire(const std::string& key, Subscription* subscription,
+                  absl::optional<grpc_connectivity_state>* state,
+                  absl::Status* status);
+
+  // Called by the owner when it can no longer run the stream (typically
+  // because its connection was lost).  The remaining subscribers are
+  // notified via on_owner_lost.
+  void Release(const std::string& key, Subscription* subscription);
+
+  // Publishes the owning subscription's latest report to all other
+  // subscribers.  No-op if \a subscription is not the owner.
+  void Publish(const std::string& key, Subscription* subscription,
+               grpc_connectivity_state state, const absl::Status& status);
+
+ private:
+  struct Entry {
+    Subscription* owner = nullptr;
+    std::vector<RefCountedPtr<Subscription>> subscriptions;
+    // Last report published by an owner.  Retained across owner changes so
+    // that late subscribers start from the most recent known state.
+    absl::optional<grpc_connectivity_state> last_state;
+    absl::Status last_status;
+  };
+
+  void NotifyOwnerLostLocked(Entry* entry) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  Mutex mu_;
+  std::map<std::string, Entry> entries_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_CORE_EXT_FILTERS_CLIENT_CHANNEL_HEALTH_HEALTH_CHECK_STREAM_REGISTRY_H
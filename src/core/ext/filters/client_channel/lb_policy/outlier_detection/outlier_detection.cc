@@ -50,6 +50,7 @@
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/env.h"
 #include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/per_cpu.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/validation_errors.h"
@@ -225,29 +226,55 @@ class OutlierDetectionLb : public LoadBalancingPolicy {
 
   class SubchannelState : public RefCounted<SubchannelState> {
    public:
+    // Call results are recorded into per-CPU shards so that high recording
+    // rates do not contend on a single cache line; the ejection sweep merges
+    // the shards after rotating the buckets.
     struct Bucket {
-      std::atomic<uint64_t> successes;
-      std::atomic<uint64_t> failures;
+      struct Shard {
+        std::atomic<uint64_t> successes{0};
+        std::atomic<uint64_t> failures{0};
+      };
+
+      void Reset() {
+        for (Shard& shard : shards) {
+          shard.successes.store(0, std::memory_order_relaxed);
+          shard.failures.store(0, std::memory_order_relaxed);
+        }
+      }
+
+      uint64_t successes() {
+        uint64_t total = 0;
+        for (Shard& shard : shards) {
+          total += shard.successes.load(std::memory_order_relaxed);
+        }
+        return total;
+      }
+
+      uint64_t failures() {
+        uint64_t total = 0;
+        for (Shard& shard : shards) {
+          total += shard.failures.load(std::memory_order_relaxed);
+        }
+        return total;
+      }
+
+      PerCpu<Shard> shards;
     };
 
     void RotateBucket() {
-      backup_bucket_->successes = 0;
-      backup_bucket_->failures = 0;
+      backup_bucket_->Reset();
       current_bucket_.swap(backup_bucket_);
       active_bucket_.store(current_bucket_.get());
     }
 
     absl::optional<std::pair<double, uint64_t>> GetSuccessRateAndVolume() {
-      uint64_t total_request =
-          backup_bucket_->successes + backup_bucket_->failures;
+      uint64_t successes = backup_bucket_->successes();
+      uint64_t total_request = successes + backup_bucket_->failures();
       if (total_request == 0) {
         return absl::nullopt;
       }
-      double success_rate =
-          backup_bucket_->successes * 100.0 /
-          (backup_bucket_->successes + backup_bucket_->failures);
-      return {
-          {success_rate, backup_bucket_->successes + backup_bucket_->failures}};
+      double success_rate = successes * 100.0 / total_request;
+      return {{success_rate, total_request}};
     }
 
     void AddSubchannel(SubchannelWrapper* wrapper) {
@@ -258,9 +285,23 @@ class OutlierDetectionLb : public LoadBalancingPolicy {
       subchannels_.erase(wrapper);
     }
 
-    void AddSuccessCount() { active_bucket_.load()->successes.fetch_add(1); }
+    void AddSuccessCount() {
+      active_bucket_.load()->shards.this_cpu().successes.fetch_add(
+          1, std::memory_order_relaxed);
+      MarkSawNewResults();
+    }
+
+    void AddFailureCount() {
+      active_bucket_.load()->shards.this_cpu().failures.fetch_add(
+          1, std::memory_order_relaxed);
+      MarkSawNewResults();
+    }
 
-    void AddFailureCount() { active_bucket_.load()->failures.fetch_add(1); }
+    // Returns true if any call results were recorded since the last call.
+    // The ejection sweep uses this to skip addresses with no new data.
+    bool TakeSawNewResults() {
+      return saw_new_results_.exchange(false, std::memory_order_acq_rel);
+    }
 
     absl::optional<Timestamp> ejection_time() const { return ejection_time_; }
 
@@ -306,11 +347,19 @@ class OutlierDetectionLb : public LoadBalancingPolicy {
     }
 
    private:
+    void MarkSawNewResults() {
+      // Avoid dirtying the shared cache line on every record.
+      if (!saw_new_results_.load(std::memory_order_relaxed)) {
+        saw_new_results_.store(true, std::memory_order_release);
+      }
+    }
+
     std::unique_ptr<Bucket> current_bucket_ = std::make_unique<Bucket>();
     std::unique_ptr<Bucket> backup_bucket_ = std::make_unique<Bucket>();
     // The bucket used to update call counts.
     // Points to either current_bucket or active_bucket.
     std::atomic<Bucket*> active_bucket_{current_bucket_.get()};
+    std::atomic<bool> saw_new_results_{false};
     uint32_t multiplier_ = 0;
     absl::optional<Timestamp> ejection_time_;
     std::set<SubchannelWrapper*> subchannels_;
@@ -833,14 +882,19 @@ void OutlierDetectionLb::EjectionTimer::OnTimerLocked(grpc_error_handle error) {
     auto& config = parent_->config_->outlier_detection_config();
     for (auto& state : parent_->subchannel_state_map_) {
       auto* subchannel_state = state.second.get();
+      if (subchannel_state->ejection_time().has_value()) {
+        ++ejected_host_count;
+      }
+      // Skip addresses that recorded no call results this interval: their
+      // rotated bucket would be empty, so they could never be ejection
+      // candidates, and this keeps the sweep cost proportional to the
+      // number of active addresses.
+      if (!subchannel_state->TakeSawNewResults()) continue;
       // For each address, swap the call counter's buckets in that address's
       // map entry.
       subchannel_state->RotateBucket();
       // Gather data to run success rate algorithm or failure percentage
       // algorithm.
-      if (subchannel_state->ejection_time().has_value()) {
-        ++ejected_host_count;
-      }
       absl::optional<std::pair<double, uint64_t>> host_success_rate_and_volume =
           subchannel_state->GetSuccessRateAndVolume();
       if (!host_success_rate_and_volume.has_value()) {
@@ -42,6 +42,12 @@
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/orphanable.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/gprpp/work_serializer.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/timer.h"
 #include "src/core/lib/json/json.h"
 #include "src/core/lib/load_balancing/lb_policy.h"
 #include "src/core/lib/load_balancing/lb_policy_factory.h"
@@ -112,6 +118,10 @@ class PickFirst : public LoadBalancingPolicy {
       // any references to subchannels, since the subchannels'
       // pollset_sets will include the LB policy's pollset_set.
       policy->Ref(DEBUG_LOCATION, "subchannel_list").release();
+      stagger_delay_ = Duration::Milliseconds(std::max(
+          0, args.GetInt(GRPC_ARG_HAPPY_EYEBALLS_CONNECTION_ATTEMPT_DELAY_MS)
+                 .value_or(250)));
+      GRPC_CLOSURE_INIT(&on_stagger_timer_, &OnStaggerTimer, this, nullptr);
       // Note that we do not start trying to connect to any subchannel here,
       // since we will wait until we see the initial connectivity state for all
       // subchannels before doing that.
@@ -137,9 +147,83 @@ class PickFirst : public LoadBalancingPolicy {
       return true;
     }
 
+    // Arms the happy-eyeballs stagger timer, if staggering is enabled, the
+    // timer is not already pending, and there is at least one subchannel
+    // after the one we're currently attempting.  Called whenever we start
+    // (or advance to) a connection attempt.
+    void MaybeStartStaggerTimerLocked() {
+      if (stagger_delay_ <= Duration::Zero()) return;
+      if (stagger_timer_pending_ || shutting_down()) return;
+      if (attempting_index_ + 1 >= num_subchannels()) return;
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_pick_first_trace)) {
+        gpr_log(GPR_INFO,
+                "[PF %p] subchannel list %p: starting stagger timer for "
+                "%" PRId64 "ms (attempting index %" PRIuPTR ")",
+                policy(), this, stagger_delay_.millis(), attempting_index_);
+      }
+      stagger_timer_pending_ = true;
+      WeakRef(DEBUG_LOCATION, "stagger_timer").release();
+      grpc_timer_init(&stagger_timer_, Timestamp::Now() + stagger_delay_,
+                      &on_stagger_timer_);
+    }
+
+    void MaybeCancelStaggerTimerLocked() {
+      if (stagger_timer_pending_) grpc_timer_cancel(&stagger_timer_);
+    }
+
+    void Orphan() override {
+      MaybeCancelStaggerTimerLocked();
+      SubchannelList::Orphan();
+    }
+
    private:
+    static void OnStaggerTimer(void* arg, grpc_error_handle error) {
+      auto* self = static_cast<PickFirstSubchannelList*>(arg);
+      auto* p = static_cast<PickFirst*>(self->policy());
+      p->work_serializer()->Run(
+          [self, error]() { self->OnStaggerTimerLocked(error); },
+          DEBUG_LOCATION);
+    }
+
+    void OnStaggerTimerLocked(grpc_error_handle error) {
+      stagger_timer_pending_ = false;
+      if (error.ok() && !shutting_down() &&
+          attempting_index_ + 1 < num_subchannels()) {
+        // Only race ahead if the current attempt is still in flight; if it
+        // has already failed, the TRANSIENT_FAILURE handler has advanced
+        // for us (or will trigger a retry when the subchannel reports IDLE).
+        auto current_state = subchannel(attempting_index_)->connectivity_state();
+        if (current_state.has_value() &&
+            *current_state == GRPC_CHANNEL_CONNECTING) {
+          ++attempting_index_;
+          if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_pick_first_trace)) {
+            gpr_log(GPR_INFO,
+                    "[PF %p] subchannel list %p: stagger timer fired; also "
+                    "attempting subchannel %" PRIuPTR " in parallel",
+                    policy(), this, attempting_index_);
+          }
+          PickFirstSubchannelData* sd = subchannel(attempting_index_);
+          auto sd_state = sd->connectivity_state();
+          if (sd_state.has_value() && *sd_state == GRPC_CHANNEL_IDLE) {
+            sd->subchannel()->RequestConnection();
+          }
+          MaybeStartStaggerTimerLocked();
+        }
+      }
+      WeakUnref(DEBUG_LOCATION, "stagger_timer");
+    }
+
     bool in_transient_failure_ = false;
     size_t attempting_index_ = 0;
+    // Stagger between parallel connection attempts (RFC 8305); see
+    // GRPC_ARG_HAPPY_EYEBALLS_CONNECTION_ATTEMPT_DELAY_MS.  Earlier attempts
+    // are left running when the timer advances to the next subchannel, and
+    // the first one to report READY is selected via the usual path, which
+    // shuts down the rest.
+    Duration stagger_delay_;
+    grpc_timer stagger_timer_;
+    grpc_closure on_stagger_timer_;
+    bool stagger_timer_pending_ = false;
   };
 
   class Picker : public SubchannelPicker {
@@ -387,6 +471,7 @@ void PickFirst::PickFirstSubchannelData::ProcessConnectivityChangeLocked(
   if (!old_state.has_value()) {
     if (subchannel_list()->AllSubchannelsSeenInitialState()) {
       subchannel_list()->subchannel(0)->subchannel()->RequestConnection();
+      subchannel_list()->MaybeStartStaggerTimerLocked();
     }
     return;
   }
@@ -448,10 +533,12 @@ void PickFirst::PickFirstSubchannelData::ProcessConnectivityChangeLocked(
       if (sd_state.has_value() && *sd_state == GRPC_CHANNEL_IDLE) {
         sd->subchannel()->RequestConnection();
       }
+      subchannel_list()->MaybeStartStaggerTimerLocked();
       break;
     }
     case GRPC_CHANNEL_IDLE: {
       subchannel()->RequestConnection();
+      subchannel_list()->MaybeStartStaggerTimerLocked();
       break;
     }
     case GRPC_CHANNEL_CONNECTING: {
@@ -503,6 +590,9 @@ void PickFirst::PickFirstSubchannelData::ProcessUnselectedReadyLocked() {
   p->channel_control_helper()->UpdateState(
       GRPC_CHANNEL_READY, absl::Status(),
       std::make_unique<Picker>(subchannel()->Ref()));
+  // We won the race; any staggered attempts to other addresses are
+  // abandoned along with their subchannels below.
+  subchannel_list()->MaybeCancelStaggerTimerLocked();
   for (size_t i = 0; i < subchannel_list()->num_subchannels(); ++i) {
     if (i != Index()) {
       subchannel_list()->subchannel(i)->ShutdownLocked();
@@ -106,6 +106,7 @@ class PriorityLbConfig : public LoadBalancingPolicy::Config {
     return children_;
   }
   const std::vector<std::string>& priorities() const { return priorities_; }
+  uint32_t warm_standby_priorities() const { return warm_standby_priorities_; }
 
   static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
   void JsonPostLoad(const Json& json, const JsonArgs&,
@@ -114,6 +115,11 @@ class PriorityLbConfig : public LoadBalancingPolicy::Config {
  private:
   std::map<std::string, PriorityLbChild> children_;
   std::vector<std::string> priorities_;
+  // Number of priorities below the current one to keep connected as warm
+  // standbys, so that failover is a picker swap instead of a cold
+  // connection attempt.  0 (the default) preserves the historical
+  // behavior of deactivating everything below the current priority.
+  uint32_t warm_standby_priorities_ = 0;
 };
 
 // priority LB policy.
@@ -515,11 +521,44 @@ void PriorityLb::SetCurrentPriorityLocked(int32_t priority,
   }
   current_priority_ = priority;
   if (deactivate_lower_priorities) {
+    // Keep the next warm_standby_priorities children created and
+    // connecting, so that if this priority fails we can swap pickers
+    // instead of waiting for cold connection establishment.  Avoid
+    // reentrant ChoosePriorityLocked() calls while doing so: the standby
+    // children's initial CONNECTING reports must not change the priority
+    // we just chose.
+    const uint32_t num_warm_standbys = config_->warm_standby_priorities();
+    update_in_progress_ = true;
     for (uint32_t p = priority + 1; p < config_->priorities().size(); ++p) {
       const std::string& child_name = config_->priorities()[p];
+      if (p <= static_cast<uint32_t>(priority) + num_warm_standbys) {
+        if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_priority_trace)) {
+          gpr_log(GPR_INFO,
+                  "[priority_lb %p] keeping priority %u, child %s as warm "
+                  "standby",
+                  this, p, child_name.c_str());
+        }
+        auto& child = children_[child_name];
+        if (child == nullptr) {
+          child = MakeOrphanable<ChildPriority>(
+              Ref(DEBUG_LOCATION, "ChildPriority"), child_name);
+          auto child_config = config_->children().find(child_name);
+          GPR_DEBUG_ASSERT(child_config != config_->children().end());
+          (void)child->UpdateLocked(
+              child_config->second.config,
+              child_config->second.ignore_reresolution_requests);
+        } else {
+          child->MaybeReactivateLocked();
+        }
+        // Make sure the standby child is actually connecting rather than
+        // sitting in IDLE waiting for picks it will never get.
+        child->ExitIdleLocked();
+        continue;
+      }
       auto it = children_.find(child_name);
       if (it != children_.end()) it->second->MaybeDeactivateLocked();
     }
+    update_in_progress_ = false;
   }
   auto& child = children_[config_->priorities()[priority]];
   GPR_ASSERT(child != nullptr);
@@ -896,6 +935,8 @@ const JsonLoaderInterface* PriorityLbConfig::JsonLoader(const JsonArgs&) {
       JsonObjectLoader<PriorityLbConfig>()
           .Field("children", &PriorityLbConfig::children_)
           .Field("priorities", &PriorityLbConfig::priorities_)
+          .OptionalField("warm_standby_priorities",
+                         &PriorityLbConfig::warm_standby_priorities_)
           .Finish();
   return loader;
 }
@@ -84,6 +84,7 @@ const JsonLoaderInterface* RingHashConfig::JsonLoader(const JsonArgs&) {
       JsonObjectLoader<RingHashConfig>()
           .OptionalField("min_ring_size", &RingHashConfig::min_ring_size)
           .OptionalField("max_ring_size", &RingHashConfig::max_ring_size)
+          .OptionalField("lookup_mode", &RingHashConfig::lookup_mode)
           .Finish();
   return loader;
 }
@@ -107,6 +108,13 @@ void RingHashConfig::JsonPostLoad(const Json&, const JsonArgs&,
   if (min_ring_size > max_ring_size) {
     errors->AddError("max_ring_size cannot be smaller than min_ring_size");
   }
+  {
+    ValidationErrors::ScopedField field(errors, ".lookup_mode");
+    if (!errors->FieldHasErrors() && lookup_mode != "ring" &&
+        lookup_mode != "maglev") {
+      errors->AddError("must be \"ring\" or \"maglev\"");
+    }
+  }
 }
 
 namespace {
@@ -115,15 +123,19 @@ constexpr absl::string_view kRingHash = "ring_hash_experimental";
 
 class RingHashLbConfig : public LoadBalancingPolicy::Config {
  public:
-  RingHashLbConfig(size_t min_ring_size, size_t max_ring_size)
-      : min_ring_size_(min_ring_size), max_ring_size_(max_ring_size) {}
+  RingHashLbConfig(size_t min_ring_size, size_t max_ring_size, bool use_maglev)
+      : min_ring_size_(min_ring_size),
+        max_ring_size_(max_ring_size),
+        use_maglev_(use_maglev) {}
   absl::string_view name() const override { return kRingHash; }
   size_t min_ring_size() const { return min_ring_size_; }
   size_t max_ring_size() const { return max_ring_size_; }
+  bool use_maglev() const { return use_maglev_; }
 
  private:
   size_t min_ring_size_;
   size_t max_ring_size_;
+  bool use_maglev_;
 };
 
 //
@@ -211,6 +223,12 @@ class RingHash : public LoadBalancingPolicy {
 
     const std::vector<RingEntry>& ring() const { return ring_; }
 
+    // Non-empty iff the config selected maglev lookup; in that mode
+    // ring_ is left empty.
+    const std::vector<RingHashSubchannelData*>& maglev_table() const {
+      return maglev_table_;
+    }
+
     // Updates the counters of subchannels in each state when a
     // subchannel transitions from old_state to new_state.
     void UpdateStateCountersLocked(grpc_connectivity_state old_state,
@@ -241,6 +259,7 @@ class RingHash : public LoadBalancingPolicy {
     size_t num_transient_failure_ = 0;
 
     std::vector<RingEntry> ring_;
+    std::vector<RingHashSubchannelData*> maglev_table_;
 
     // The index of the subchannel currently doing an internally
     // triggered connection attempt, if any.
@@ -358,31 +377,45 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
         absl::InternalError("ring hash value is not a number"));
   }
   const auto& ring = subchannel_list_->ring();
-  // Ported from https://github.com/RJ/ketama/blob/master/libketama/ketama.c
-  // (ketama_get_server) NOTE: The algorithm depends on using signed integers
-  // for lowp, highp, and first_index. Do not change them!
-  size_t lowp = 0;
-  size_t highp = ring.size();
+  const auto& maglev_table = subchannel_list_->maglev_table();
+  const bool use_maglev = !maglev_table.empty();
+  const size_t table_size = use_maglev ? maglev_table.size() : ring.size();
+  // Returns the subchannel owning the given ring or table slot.  In
+  // maglev mode consecutive slots belong to effectively random hosts, so
+  // scanning forward from the first slot below mirrors walking the ring.
+  auto subchannel_at = [&](size_t index) {
+    return use_maglev ? maglev_table[index] : ring[index].subchannel;
+  };
   size_t first_index = 0;
-  while (true) {
-    first_index = (lowp + highp) / 2;
-    if (first_index == ring.size()) {
-      first_index = 0;
-      break;
-    }
-    uint64_t midval = ring[first_index].hash;
-    uint64_t midval1 = first_index == 0 ? 0 : ring[first_index - 1].hash;
-    if (h <= midval && h > midval1) {
-      break;
-    }
-    if (midval < h) {
-      lowp = first_index + 1;
-    } else {
-      highp = first_index - 1;
-    }
-    if (lowp > highp) {
-      first_index = 0;
-      break;
+  if (use_maglev) {
+    // Maglev lookup is a single indexed load.
+    first_index = h % table_size;
+  } else {
+    // Ported from https://github.com/RJ/ketama/blob/master/libketama/ketama.c
+    // (ketama_get_server) NOTE: The algorithm depends on using signed integers
+    // for lowp, highp, and first_index. Do not change them!
+    size_t lowp = 0;
+    size_t highp = ring.size();
+    while (true) {
+      first_index = (lowp + highp) / 2;
+      if (first_index == ring.size()) {
+        first_index = 0;
+        break;
+      }
+      uint64_t midval = ring[first_index].hash;
+      uint64_t midval1 = first_index == 0 ? 0 : ring[first_index - 1].hash;
+      if (h <= midval && h > midval1) {
+        break;
+      }
+      if (midval < h) {
+        lowp = first_index + 1;
+      } else {
+        highp = first_index - 1;
+      }
+      if (lowp > highp) {
+        first_index = 0;
+        break;
+      }
     }
   }
   OrphanablePtr<SubchannelConnectionAttempter> subchannel_connection_attempter;
@@ -396,41 +429,40 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
         }
         subchannel_connection_attempter->AddSubchannel(std::move(subchannel));
       };
-  switch (ring[first_index].subchannel->GetConnectivityState()) {
+  RingHashSubchannelData* first_subchannel = subchannel_at(first_index);
+  switch (first_subchannel->GetConnectivityState()) {
     case GRPC_CHANNEL_READY:
-      return PickResult::Complete(
-          ring[first_index].subchannel->subchannel()->Ref());
+      return PickResult::Complete(first_subchannel->subchannel()->Ref());
     case GRPC_CHANNEL_IDLE:
-      ScheduleSubchannelConnectionAttempt(
-          ring[first_index].subchannel->subchannel()->Ref());
+      ScheduleSubchannelConnectionAttempt(first_subchannel->subchannel()->Ref());
       ABSL_FALLTHROUGH_INTENDED;
     case GRPC_CHANNEL_CONNECTING:
       return PickResult::Queue();
     default:  // GRPC_CHANNEL_TRANSIENT_FAILURE
       break;
   }
-  ScheduleSubchannelConnectionAttempt(
-      ring[first_index].subchannel->subchannel()->Ref());
+  ScheduleSubchannelConnectionAttempt(first_subchannel->subchannel()->Ref());
   // Loop through remaining subchannels to find one in READY.
   // On the way, we make sure the right set of connection attempts
   // will happen.
   bool found_second_subchannel = false;
   bool found_first_non_failed = false;
-  for (size_t i = 1; i < ring.size(); ++i) {
-    const auto& entry = ring[(first_index + i) % ring.size()];
-    if (entry.subchannel == ring[first_index].subchannel) {
+  for (size_t i = 1; i < table_size; ++i) {
+    RingHashSubchannelData* entry_subchannel =
+        subchannel_at((first_index + i) % table_size);
+    if (entry_subchannel == first_subchannel) {
       continue;
     }
     grpc_connectivity_state connectivity_state =
-        entry.subchannel->GetConnectivityState();
+        entry_subchannel->GetConnectivityState();
     if (connectivity_state == GRPC_CHANNEL_READY) {
-      return PickResult::Complete(entry.subchannel->subchannel()->Ref());
+      return PickResult::Complete(entry_subchannel->subchannel()->Ref());
     }
     if (!found_second_subchannel) {
       switch (connectivity_state) {
         case GRPC_CHANNEL_IDLE:
           ScheduleSubchannelConnectionAttempt(
-              entry.subchannel->subchannel()->Ref());
+              entry_subchannel->subchannel()->Ref());
           ABSL_FALLTHROUGH_INTENDED;
         case GRPC_CHANNEL_CONNECTING:
           return PickResult::Queue();
@@ -442,11 +474,11 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
     if (!found_first_non_failed) {
       if (connectivity_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
         ScheduleSubchannelConnectionAttempt(
-            entry.subchannel->subchannel()->Ref());
+            entry_subchannel->subchannel()->Ref());
       } else {
         if (connectivity_state == GRPC_CHANNEL_IDLE) {
           ScheduleSubchannelConnectionAttempt(
-              entry.subchannel->subchannel()->Ref());
+              entry_subchannel->subchannel()->Ref());
         }
         found_first_non_failed = true;
       }
@@ -454,13 +486,29 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
   }
   return PickResult::Fail(absl::UnavailableError(absl::StrCat(
       "ring hash cannot find a connected subchannel; first failure: ",
-      ring[first_index].subchannel->GetConnectivityStatus().ToString())));
+      first_subchannel->GetConnectivityStatus().ToString())));
 }
 
 //
 // RingHash::RingHashSubchannelList
 //
 
+// Returns true if n is prime.  Used to size the maglev table, whose
+// permutation step requires a prime number of slots.
+bool IsPrime(uint64_t n) {
+  if (n < 4) return n > 1;
+  if (n % 2 == 0) return false;
+  for (uint64_t divisor = 3; divisor * divisor <= n; divisor += 2) {
+    if (n % divisor == 0) return false;
+  }
+  return true;
+}
+
+uint64_t NextPrime(uint64_t n) {
+  while (!IsPrime(n)) ++n;
+  return n;
+}
+
 RingHash::RingHashSubchannelList::RingHashSubchannelList(
     RingHash* policy, ServerAddressList addresses, const ChannelArgs& args)
     : SubchannelList(policy,
@@ -512,6 +560,65 @@ RingHash::RingHashSubchannelList::RingHashSubchannelList(
     max_normalized_weight =
         std::max(address.normalized_weight, max_normalized_weight);
   }
+  if (policy->config_->use_maglev() && num_subchannels() > 0) {
+    // Maglev lookup: fill a prime-sized table by walking each host's
+    // pseudo-random permutation of the slots (offset + next * skip),
+    // with hosts taking turns in proportion to their normalized weights.
+    // Construction is O(table size) with no sort, and the permutations
+    // retain the minimal-disruption property of consistent hashing:
+    // adding or removing one host moves only ~1/N of the slots.
+    const uint64_t table_size = NextPrime(std::max<uint64_t>(
+        policy->config_->min_ring_size(), num_subchannels()));
+    struct TableBuildEntry {
+      RingHashSubchannelData* subchannel;
+      uint64_t offset;
+      uint64_t skip;
+      uint64_t next = 0;
+      double relative_weight;
+      double target_weight = 0.0;
+    };
+    std::vector<TableBuildEntry> entries;
+    entries.reserve(num_subchannels());
+    for (size_t i = 0; i < num_subchannels(); ++i) {
+      const std::string& address_string = address_weights[i].address;
+      TableBuildEntry entry;
+      entry.subchannel = subchannel(i);
+      entry.offset =
+          XXH64(address_string.data(), address_string.size(), 0) % table_size;
+      entry.skip = XXH64(address_string.data(), address_string.size(), 1) %
+                       (table_size - 1) +
+                   1;
+      entry.relative_weight =
+          address_weights[i].normalized_weight / max_normalized_weight;
+      entries.push_back(entry);
+    }
+    maglev_table_.assign(table_size, nullptr);
+    uint64_t filled = 0;
+    for (uint64_t iteration = 1; filled < table_size; ++iteration) {
+      for (auto& entry : entries) {
+        if (filled == table_size) break;
+        // A host with the maximum weight takes a slot on every iteration;
+        // a host with half that weight takes one every other iteration, etc.
+        if (iteration * entry.relative_weight < entry.target_weight) continue;
+        entry.target_weight += 1.0;
+        uint64_t slot = (entry.offset + entry.skip * entry.next) % table_size;
+        while (maglev_table_[slot] != nullptr) {
+          ++entry.next;
+          slot = (entry.offset + entry.skip * entry.next) % table_size;
+        }
+        maglev_table_[slot] = entry.subchannel;
+        ++entry.next;
+        ++filled;
+      }
+    }
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_ring_hash_trace)) {
+      gpr_log(GPR_INFO,
+              "[RH %p] created subchannel list %p with %" PRIuPTR
+              " maglev table slots",
+              policy, this, maglev_table_.size());
+    }
+    return;
+  }
   // Scale up the number of hashes per host such that the least-weighted host
   // gets a whole number of hashes on the ring. Other hosts might not end up
   // with whole numbers, and that's fine (the ring-building algorithm below can
@@ -876,7 +983,8 @@ class RingHashFactory : public LoadBalancingPolicyFactory {
         json, JsonArgs(), "errors validating ring_hash LB policy config");
     if (!config.ok()) return config.status();
     return MakeRefCounted<RingHashLbConfig>(config->min_ring_size,
-                                            config->max_ring_size);
+                                            config->max_ring_size,
+                                            config->lookup_mode == "maglev");
   }
 };
 
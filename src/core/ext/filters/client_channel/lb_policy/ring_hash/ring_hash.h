@@ -21,6 +21,8 @@
 
 #include <stdint.h>
 
+#include <string>
+
 #include "src/core/lib/gprpp/unique_type_name.h"
 #include "src/core/lib/gprpp/validation_errors.h"
 #include "src/core/lib/json/json.h"
@@ -36,6 +38,11 @@ UniqueTypeName RequestHashAttributeName();
 struct RingHashConfig {
   uint64_t min_ring_size = 1024;
   uint64_t max_ring_size = 8388608;
+  // "ring" (the default) uses a ketama-style binary search over a sorted
+  // ring.  "maglev" uses a prime-sized lookup table indexed directly by
+  // the request hash, which makes each pick O(1) at the cost of slightly
+  // larger remapping when an endpoint is added or removed.
+  std::string lookup_mode = "ring";
 
   static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
   void JsonPostLoad(const Json& json, const JsonArgs&,
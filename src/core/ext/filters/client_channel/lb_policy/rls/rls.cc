@@ -465,6 +465,27 @@ class RlsLb : public LoadBalancingPolicy {
         grpc_closure backoff_timer_callback_;
       };
 
+      // Proactively refreshes the entry when it goes stale, so that a key
+      // that is being picked regularly does not have to wait for the first
+      // stale pick (or, worse, for expiry) to trigger the lookup.
+      class PrefetchTimer : public InternallyRefCounted<PrefetchTimer> {
+       public:
+        PrefetchTimer(RefCountedPtr<Entry> entry, Timestamp stale_time);
+
+        // Note: We are forced to disable lock analysis here because
+        // Orphan() is called by OrphanablePtr<>, which cannot have lock
+        // annotations for this particular caller.
+        void Orphan() override ABSL_NO_THREAD_SAFETY_ANALYSIS;
+
+       private:
+        static void OnPrefetchTimer(void* args, grpc_error_handle error);
+
+        RefCountedPtr<Entry> entry_;
+        bool armed_ ABSL_GUARDED_BY(&RlsLb::mu_) = true;
+        grpc_timer prefetch_timer_;
+        grpc_closure prefetch_timer_callback_;
+      };
+
       RefCountedPtr<RlsLb> lb_policy_;
 
       bool is_shutdown_ ABSL_GUARDED_BY(&RlsLb::mu_) = false;
@@ -485,6 +506,10 @@ class RlsLb : public LoadBalancingPolicy {
       Timestamp data_expiration_time_ ABSL_GUARDED_BY(&RlsLb::mu_) =
           Timestamp::InfPast();
       Timestamp stale_time_ ABSL_GUARDED_BY(&RlsLb::mu_) = Timestamp::InfPast();
+      OrphanablePtr<PrefetchTimer> prefetch_timer_;
+      // Whether the entry was picked since the last RLS response; only
+      // such entries are refreshed by the prefetch timer.
+      bool used_since_refresh_ ABSL_GUARDED_BY(&RlsLb::mu_) = false;
 
       Timestamp min_expiration_time_ ABSL_GUARDED_BY(&RlsLb::mu_);
       Cache::Iterator lru_iterator_ ABSL_GUARDED_BY(&RlsLb::mu_);
@@ -1150,6 +1175,60 @@ void RlsLb::Cache::Entry::BackoffTimer::OnBackoffTimer(
       DEBUG_LOCATION);
 }
 
+//
+// RlsLb::Cache::Entry::PrefetchTimer
+//
+
+RlsLb::Cache::Entry::PrefetchTimer::PrefetchTimer(RefCountedPtr<Entry> entry,
+                                                  Timestamp stale_time)
+    : entry_(std::move(entry)) {
+  GRPC_CLOSURE_INIT(&prefetch_timer_callback_, OnPrefetchTimer, this, nullptr);
+  Ref(DEBUG_LOCATION, "PrefetchTimer").release();
+  grpc_timer_init(&prefetch_timer_, stale_time, &prefetch_timer_callback_);
+}
+
+void RlsLb::Cache::Entry::PrefetchTimer::Orphan() {
+  if (armed_) {
+    armed_ = false;
+    grpc_timer_cancel(&prefetch_timer_);
+  }
+  Unref(DEBUG_LOCATION, "Orphan");
+}
+
+void RlsLb::Cache::Entry::PrefetchTimer::OnPrefetchTimer(
+    void* arg, grpc_error_handle /*error*/) {
+  auto* self = static_cast<PrefetchTimer*>(arg);
+  self->entry_->lb_policy_->work_serializer()->Run(
+      [self]() {
+        RefCountedPtr<PrefetchTimer> prefetch_timer(self);
+        Entry* entry = self->entry_.get();
+        RlsLb* lb_policy = entry->lb_policy_.get();
+        MutexLock lock(&lb_policy->mu_);
+        bool cancelled = !self->armed_;
+        self->armed_ = false;
+        if (cancelled || entry->is_shutdown_ || lb_policy->is_shutdown_) {
+          return;
+        }
+        // Only refresh entries that were actually picked since the last
+        // response; a cold entry can wait for the next pick (or expire).
+        if (!entry->used_since_refresh_) return;
+        if (entry->backoff_time_ >= Timestamp::Now()) return;
+        const RequestKey& key = *entry->lru_iterator_;
+        if (lb_policy->request_map_.find(key) !=
+            lb_policy->request_map_.end()) {
+          return;
+        }
+        if (lb_policy->rls_channel_->ShouldThrottle()) return;
+        if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_rls_trace)) {
+          gpr_log(GPR_INFO,
+                  "[rlslb %p] cache entry=%p %s: prefetching stale entry",
+                  lb_policy, entry, entry->lru_iterator_->ToString().c_str());
+        }
+        lb_policy->rls_channel_->StartRlsCall(key, entry);
+      },
+      DEBUG_LOCATION);
+}
+
 //
 // RlsLb::Cache::Entry
 //
@@ -1186,6 +1265,7 @@ void RlsLb::Cache::Entry::Orphan() {
     backoff_timer_.reset();
     lb_policy_->UpdatePickerAsync();
   }
+  prefetch_timer_.reset();
   child_policy_wrappers_.clear();
   Unref(DEBUG_LOCATION, "Orphan");
 }
@@ -1257,6 +1337,7 @@ bool RlsLb::Cache::Entry::CanEvict() const {
 }
 
 void RlsLb::Cache::Entry::MarkUsed() {
+  used_since_refresh_ = true;
   auto& lru_list = lb_policy_->cache_.lru_list_;
   auto new_it = lru_list.insert(lru_list.end(), *lru_iterator_);
   lru_list.erase(lru_iterator_);
@@ -1290,6 +1371,12 @@ RlsLb::Cache::Entry::OnRlsResponseLocked(
   Timestamp now = Timestamp::Now();
   data_expiration_time_ = now + lb_policy_->config_->max_age();
   stale_time_ = now + lb_policy_->config_->stale_age();
+  // Arm a refresh for when the data goes stale.  If the entry is picked
+  // again before then, the timer starts the lookup proactively instead of
+  // waiting for the first stale pick to trigger it.
+  used_since_refresh_ = false;
+  prefetch_timer_ = MakeOrphanable<PrefetchTimer>(
+      Ref(DEBUG_LOCATION, "PrefetchTimer"), stale_time_);
   status_ = absl::OkStatus();
   backoff_state_.reset();
   backoff_time_ = Timestamp::InfPast();
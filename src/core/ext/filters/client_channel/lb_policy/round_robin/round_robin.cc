@@ -20,6 +20,7 @@
 #include <stdlib.h>
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <string>
 #include <utility>
@@ -40,7 +41,9 @@
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/per_cpu.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/json/json.h"
 #include "src/core/lib/load_balancing/lb_policy.h"
 #include "src/core/lib/load_balancing/lb_policy_factory.h"
@@ -172,10 +175,23 @@ class RoundRobin : public LoadBalancingPolicy {
     PickResult Pick(PickArgs args) override;
 
    private:
+    // One round-robin cursor per CPU, padded so that concurrent picks on
+    // different CPUs don't contend on a shared cache line.
+    struct alignas(GPR_CACHELINE_SIZE) PerCpuIndex {
+      std::atomic<size_t> value{0};
+    };
+
+    PerCpuIndex& CurrentCpuIndex() {
+      // PerCpu keys off the current ExecCtx; without one, fall back to the
+      // first slot.
+      if (ExecCtx::Get() == nullptr) return *per_cpu_index_.begin();
+      return per_cpu_index_.this_cpu();
+    }
+
     // Using pointer value only, no ref held -- do not dereference!
     RoundRobin* parent_;
 
-    size_t last_picked_index_;
+    PerCpu<PerCpuIndex> per_cpu_index_;
     std::vector<RefCountedPtr<SubchannelInterface>> subchannels_;
   };
 
@@ -208,27 +224,33 @@ RoundRobin::Picker::Picker(RoundRobin* parent,
   }
   // For discussion on why we generate a random starting index for
   // the picker, see https://github.com/grpc/grpc-go/issues/2580.
+  // Each CPU's cursor gets its own random start, which also de-correlates
+  // the pick sequences of different CPUs.
   // TODO(roth): rand(3) is not thread-safe.  This should be replaced with
   // something better as part of https://github.com/grpc/grpc/issues/17891.
-  last_picked_index_ = rand() % subchannels_.size();
+  for (PerCpuIndex& index : per_cpu_index_) {
+    index.value.store(rand() % subchannels_.size(), std::memory_order_relaxed);
+  }
   if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_round_robin_trace)) {
     gpr_log(GPR_INFO,
             "[RR %p picker %p] created picker from subchannel_list=%p "
-            "with %" PRIuPTR " READY subchannels; last_picked_index_=%" PRIuPTR,
-            parent_, this, subchannel_list, subchannels_.size(),
-            last_picked_index_);
+            "with %" PRIuPTR " READY subchannels",
+            parent_, this, subchannel_list, subchannels_.size());
   }
 }
 
 RoundRobin::PickResult RoundRobin::Picker::Pick(PickArgs /*args*/) {
-  last_picked_index_ = (last_picked_index_ + 1) % subchannels_.size();
+  // Relaxed is fine: the cursor carries no data dependencies, and picks on
+  // the same CPU still advance it monotonically.
+  size_t index =
+      CurrentCpuIndex().value.fetch_add(1, std::memory_order_relaxed) %
+      subchannels_.size();
   if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_round_robin_trace)) {
     gpr_log(GPR_INFO,
             "[RR %p picker %p] returning index %" PRIuPTR ", subchannel=%p",
-            parent_, this, last_picked_index_,
-            subchannels_[last_picked_index_].get());
+            parent_, this, index, subchannels_[index].get());
   }
-  return PickResult::Complete(subchannels_[last_picked_index_]);
+  return PickResult::Complete(subchannels_[index]);
 }
 
 //
@@ -84,6 +84,10 @@ class WeightedTargetLbConfig : public LoadBalancingPolicy::Config {
   struct ChildConfig {
     uint32_t weight;
     RefCountedPtr<LoadBalancingPolicy::Config> config;
+    // The raw JSON that config was parsed from.  Retained so that
+    // WeightedChild can cheaply detect updates in which nothing but the
+    // weight changed and skip re-delivering them to the child policy.
+    Json config_json;
 
     static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
     void JsonPostLoad(const Json& json, const JsonArgs&,
@@ -136,20 +140,26 @@ class WeightedTargetLb : public LoadBalancingPolicy {
   // child's picker.
   class WeightedPicker : public SubchannelPicker {
    public:
-    // Maintains a weighted list of pickers from each child that is in
-    // ready state. The first element in the pair represents the end of a
-    // range proportional to the child's weight. The start of the range
-    // is the previous value in the vector and is 0 for the first element.
+    // A weighted list of pickers from each child that is in a given
+    // state.  The first element in the pair is the child's weight.
     using PickerList =
         std::vector<std::pair<uint32_t, RefCountedPtr<ChildPickerWrapper>>>;
 
-    explicit WeightedPicker(PickerList pickers)
-        : pickers_(std::move(pickers)) {}
+    explicit WeightedPicker(const PickerList& pickers);
 
     PickResult Pick(PickArgs args) override;
 
    private:
-    PickerList pickers_;
+    // One slot of an alias table (Walker's method).  A pick draws a
+    // uniformly random slot and then a coin biased by threshold to
+    // choose between the slot's primary picker and its alias, which
+    // makes each weighted pick O(1) instead of a binary search.
+    struct TableEntry {
+      double threshold;
+      RefCountedPtr<ChildPickerWrapper> primary;
+      RefCountedPtr<ChildPickerWrapper> alias;
+    };
+    std::vector<TableEntry> table_;
   };
 
   // Each WeightedChild holds a ref to its parent WeightedTargetLb.
@@ -233,6 +243,13 @@ class WeightedTargetLb : public LoadBalancingPolicy {
     RefCountedPtr<ChildPickerWrapper> picker_wrapper_;
     grpc_connectivity_state connectivity_state_ = GRPC_CHANNEL_CONNECTING;
 
+    // Snapshot of the last update delivered to the child policy, used
+    // to skip re-delivery when only the weight changed.
+    Json last_config_json_;
+    absl::StatusOr<ServerAddressList> last_addresses_;
+    std::string last_resolution_note_;
+    ChannelArgs last_args_;
+
     OrphanablePtr<DelayedRemovalTimer> delayed_removal_timer_;
   };
 
@@ -257,30 +274,49 @@ class WeightedTargetLb : public LoadBalancingPolicy {
 // WeightedTargetLb::WeightedPicker
 //
 
+WeightedTargetLb::WeightedPicker::WeightedPicker(const PickerList& pickers) {
+  const size_t num_pickers = pickers.size();
+  table_.resize(num_pickers);
+  uint64_t total_weight = 0;
+  for (const auto& p : pickers) total_weight += p.first;
+  // Scale each weight so that the average slot probability is 1, then
+  // pair each under-full slot with an over-full one, giving the
+  // under-full slot's leftover probability to the over-full picker.
+  std::vector<double> scaled_weights(num_pickers);
+  std::vector<size_t> underfull;
+  std::vector<size_t> overfull;
+  for (size_t i = 0; i < num_pickers; ++i) {
+    scaled_weights[i] =
+        static_cast<double>(pickers[i].first) * num_pickers / total_weight;
+    (scaled_weights[i] < 1.0 ? underfull : overfull).push_back(i);
+  }
+  while (!underfull.empty() && !overfull.empty()) {
+    const size_t under = underfull.back();
+    underfull.pop_back();
+    const size_t over = overfull.back();
+    table_[under] = {scaled_weights[under], pickers[under].second,
+                     pickers[over].second};
+    scaled_weights[over] -= 1.0 - scaled_weights[under];
+    if (scaled_weights[over] < 1.0) {
+      overfull.pop_back();
+      underfull.push_back(over);
+    }
+  }
+  // Any slots left over in either list have probability 1 (modulo
+  // floating-point error) and never fall through to an alias.
+  for (size_t i : underfull) table_[i] = {1.0, pickers[i].second, nullptr};
+  for (size_t i : overfull) table_[i] = {1.0, pickers[i].second, nullptr};
+}
+
 WeightedTargetLb::PickResult WeightedTargetLb::WeightedPicker::Pick(
     PickArgs args) {
-  // Generate a random number in [0, total weight).
-  const uint32_t key = rand() % pickers_[pickers_.size() - 1].first;
-  // Find the index in pickers_ corresponding to key.
-  size_t mid = 0;
-  size_t start_index = 0;
-  size_t end_index = pickers_.size() - 1;
-  size_t index = 0;
-  while (end_index > start_index) {
-    mid = (start_index + end_index) / 2;
-    if (pickers_[mid].first > key) {
-      end_index = mid;
-    } else if (pickers_[mid].first < key) {
-      start_index = mid + 1;
-    } else {
-      index = mid + 1;
-      break;
-    }
+  const TableEntry& entry = table_[rand() % table_.size()];
+  if (entry.alias != nullptr &&
+      static_cast<double>(rand()) / RAND_MAX >= entry.threshold) {
+    return entry.alias->Pick(args);
   }
-  if (index == 0) index = start_index;
-  GPR_ASSERT(pickers_[index].first > key);
   // Delegate to the child picker.
-  return pickers_[index].second->Pick(args);
+  return entry.primary->Pick(args);
 }
 
 //
@@ -389,13 +425,9 @@ void WeightedTargetLb::UpdateStateLocked() {
   }
   // Construct lists of child pickers with associated weights, one for
   // children that are in state READY and another for children that are
-  // in state TRANSIENT_FAILURE.  Each child is represented by a portion of
-  // the range proportional to its weight, such that the total range is the
-  // sum of the weights of all children.
+  // in state TRANSIENT_FAILURE.
   WeightedPicker::PickerList ready_picker_list;
-  uint32_t ready_end = 0;
   WeightedPicker::PickerList tf_picker_list;
-  uint32_t tf_end = 0;
   // Also count the number of children in CONNECTING and IDLE, to determine
   // the aggregated state.
   size_t num_connecting = 0;
@@ -417,8 +449,8 @@ void WeightedTargetLb::UpdateStateLocked() {
     switch (child->connectivity_state()) {
       case GRPC_CHANNEL_READY: {
         GPR_ASSERT(child->weight() > 0);
-        ready_end += child->weight();
-        ready_picker_list.emplace_back(ready_end, child->picker_wrapper());
+        ready_picker_list.emplace_back(child->weight(),
+                                       child->picker_wrapper());
         break;
       }
       case GRPC_CHANNEL_CONNECTING: {
@@ -431,8 +463,7 @@ void WeightedTargetLb::UpdateStateLocked() {
       }
       case GRPC_CHANNEL_TRANSIENT_FAILURE: {
         GPR_ASSERT(child->weight() > 0);
-        tf_end += child->weight();
-        tf_picker_list.emplace_back(tf_end, child->picker_wrapper());
+        tf_picker_list.emplace_back(child->weight(), child->picker_wrapper());
         break;
       }
       default:
@@ -597,9 +628,30 @@ absl::Status WeightedTargetLb::WeightedChild::UpdateLocked(
     delayed_removal_timer_.reset();
   }
   // Create child policy if needed.
+  bool created_policy = false;
   if (child_policy_ == nullptr) {
     child_policy_ = CreateChildPolicyLocked(args);
+    created_policy = true;
+  }
+  // If nothing the child policy cares about has changed since the last
+  // update we delivered, skip re-delivering it.  The weight is consumed
+  // here rather than by the child, so weight-only updates (the common
+  // case for EDS load redistribution) don't churn the children.
+  if (!created_policy && config.config_json == last_config_json_ &&
+      addresses == last_addresses_ &&
+      resolution_note == last_resolution_note_ && args == last_args_) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_weighted_target_trace)) {
+      gpr_log(GPR_INFO,
+              "[weighted_target_lb %p] WeightedChild %p %s: config, "
+              "addresses, and args unchanged; skipping child policy update",
+              weighted_target_policy_.get(), this, name_.c_str());
+    }
+    return absl::OkStatus();
   }
+  last_config_json_ = config.config_json;
+  last_addresses_ = addresses;
+  last_resolution_note_ = resolution_note;
+  last_args_ = args;
   // Construct update args.
   UpdateArgs update_args;
   update_args.config = config.config;
@@ -731,6 +783,7 @@ void WeightedTargetLbConfig::ChildConfig::JsonPostLoad(
     return;
   }
   config = std::move(*lb_config);
+  config_json = it->second;
 }
 
 const JsonLoaderInterface* WeightedTargetLbConfig::JsonLoader(const JsonArgs&) {
@@ -356,6 +356,19 @@ class XdsClusterResolverLb : public LoadBalancingPolicy {
     // State used to retain child policy names for priority policy.
     std::vector<size_t /*child_number*/> priority_child_numbers;
     size_t next_available_child_number = 0;
+    // Child policy fragments built from latest_update, invalidated when
+    // this mechanism reports a new update or the policy config changes.
+    // The xds client only notifies on actual changes, so an update to one
+    // mechanism does not rebuild the other mechanisms' fragments.
+    absl::optional<ServerAddressList> cached_addresses;
+    absl::optional<Json::Object> cached_priority_children;
+    absl::optional<Json::Array> cached_priority_names;
+
+    void InvalidateCachedFragments() {
+      cached_addresses.reset();
+      cached_priority_children.reset();
+      cached_priority_names.reset();
+    }
 
     const XdsClusterResolverLbConfig::DiscoveryMechanism& config() const;
 
@@ -638,6 +651,11 @@ absl::Status XdsClusterResolverLb::UpdateLocked(UpdateArgs args) {
   // Update config.
   auto old_config = std::move(config_);
   config_ = std::move(args.config);
+  // The generated child policy fragments depend on the policy config, so
+  // a new config invalidates every mechanism's cached fragments.
+  for (DiscoveryMechanismEntry& mechanism : discovery_mechanisms_) {
+    mechanism.InvalidateCachedFragments();
+  }
   // Update args.
   args_ = std::move(args.args);
   // Update child policy if needed.
@@ -764,6 +782,8 @@ void XdsClusterResolverLb::OnEndpointChanged(size_t index,
   discovery_entry.latest_update = std::move(update);
   discovery_entry.resolution_note = std::move(resolution_note);
   discovery_entry.priority_child_numbers = std::move(priority_child_numbers);
+  // Only this mechanism's fragments need rebuilding.
+  discovery_entry.InvalidateCachedFragments();
   // If any discovery mechanism has not received its first update,
   // wait until that happens before creating the child policy.
   // TODO(roth): If this becomes problematic in the future (e.g., a
@@ -812,42 +832,50 @@ void XdsClusterResolverLb::OnResourceDoesNotExist(size_t index,
 
 ServerAddressList XdsClusterResolverLb::CreateChildPolicyAddressesLocked() {
   ServerAddressList addresses;
-  for (const auto& discovery_entry : discovery_mechanisms_) {
-    for (size_t priority = 0;
-         priority < discovery_entry.latest_update->priorities.size();
-         ++priority) {
-      const auto& priority_entry =
-          discovery_entry.latest_update->priorities[priority];
-      std::string priority_child_name =
-          discovery_entry.GetChildPolicyName(priority);
-      for (const auto& p : priority_entry.localities) {
-        const auto& locality_name = p.first;
-        const auto& locality = p.second;
-        std::vector<std::string> hierarchical_path = {
-            priority_child_name, locality_name->AsHumanReadableString()};
-        for (const auto& endpoint : locality.endpoints) {
-          const ServerAddressWeightAttribute* weight_attribute = static_cast<
-              const ServerAddressWeightAttribute*>(endpoint.GetAttribute(
-              ServerAddressWeightAttribute::kServerAddressWeightAttributeKey));
-          uint32_t weight = locality.lb_weight;
-          if (weight_attribute != nullptr) {
-            weight = locality.lb_weight * weight_attribute->weight();
+  for (auto& discovery_entry : discovery_mechanisms_) {
+    // Rebuild only the fragments of mechanisms whose update changed.
+    if (!discovery_entry.cached_addresses.has_value()) {
+      ServerAddressList fragment;
+      for (size_t priority = 0;
+           priority < discovery_entry.latest_update->priorities.size();
+           ++priority) {
+        const auto& priority_entry =
+            discovery_entry.latest_update->priorities[priority];
+        std::string priority_child_name =
+            discovery_entry.GetChildPolicyName(priority);
+        for (const auto& p : priority_entry.localities) {
+          const auto& locality_name = p.first;
+          const auto& locality = p.second;
+          std::vector<std::string> hierarchical_path = {
+              priority_child_name, locality_name->AsHumanReadableString()};
+          for (const auto& endpoint : locality.endpoints) {
+            const ServerAddressWeightAttribute* weight_attribute = static_cast<
+                const ServerAddressWeightAttribute*>(endpoint.GetAttribute(
+                ServerAddressWeightAttribute::kServerAddressWeightAttributeKey));
+            uint32_t weight = locality.lb_weight;
+            if (weight_attribute != nullptr) {
+              weight = locality.lb_weight * weight_attribute->weight();
+            }
+            fragment.emplace_back(
+                endpoint
+                    .WithAttribute(
+                        kHierarchicalPathAttributeKey,
+                        MakeHierarchicalPathAttribute(hierarchical_path))
+                    .WithAttribute(kXdsLocalityNameAttributeKey,
+                                   std::make_unique<XdsLocalityAttribute>(
+                                       locality_name->Ref()))
+                    .WithAttribute(
+                        ServerAddressWeightAttribute::
+                            kServerAddressWeightAttributeKey,
+                        std::make_unique<ServerAddressWeightAttribute>(
+                            weight)));
           }
-          addresses.emplace_back(
-              endpoint
-                  .WithAttribute(
-                      kHierarchicalPathAttributeKey,
-                      MakeHierarchicalPathAttribute(hierarchical_path))
-                  .WithAttribute(kXdsLocalityNameAttributeKey,
-                                 std::make_unique<XdsLocalityAttribute>(
-                                     locality_name->Ref()))
-                  .WithAttribute(
-                      ServerAddressWeightAttribute::
-                          kServerAddressWeightAttributeKey,
-                      std::make_unique<ServerAddressWeightAttribute>(weight)));
         }
       }
+      discovery_entry.cached_addresses = std::move(fragment);
     }
+    addresses.insert(addresses.end(), discovery_entry.cached_addresses->begin(),
+                     discovery_entry.cached_addresses->end());
   }
   return addresses;
 }
@@ -866,7 +894,19 @@ RefCountedPtr<LoadBalancingPolicy::Config>
 XdsClusterResolverLb::CreateChildPolicyConfigLocked() {
   Json::Object priority_children;
   Json::Array priority_priorities;
-  for (const auto& discovery_entry : discovery_mechanisms_) {
+  for (auto& discovery_entry : discovery_mechanisms_) {
+    // Rebuild only the fragments of mechanisms whose update changed.
+    if (discovery_entry.cached_priority_children.has_value()) {
+      for (const auto& p : *discovery_entry.cached_priority_children) {
+        priority_children[p.first] = p.second;
+      }
+      for (const Json& name : *discovery_entry.cached_priority_names) {
+        priority_priorities.push_back(name);
+      }
+      continue;
+    }
+    Json::Object entry_children;
+    Json::Array entry_priority_names;
     const auto& discovery_config = discovery_entry.config();
     for (size_t priority = 0;
          priority < discovery_entry.latest_update->priorities.size();
@@ -974,15 +1014,23 @@ XdsClusterResolverLb::CreateChildPolicyConfigLocked() {
       }
       // Add priority entry, with the appropriate child name.
       std::string child_name = discovery_entry.GetChildPolicyName(priority);
-      priority_priorities.emplace_back(child_name);
+      entry_priority_names.emplace_back(child_name);
       Json::Object child_config = {
           {"config", std::move(locality_picking_policy)},
       };
       if (discovery_entry.discovery_mechanism->disable_reresolution()) {
         child_config["ignore_reresolution_requests"] = true;
       }
-      priority_children[child_name] = std::move(child_config);
+      entry_children[child_name] = std::move(child_config);
+    }
+    for (const auto& p : entry_children) {
+      priority_children[p.first] = p.second;
+    }
+    for (const Json& name : entry_priority_names) {
+      priority_priorities.push_back(name);
     }
+    discovery_entry.cached_priority_children = std::move(entry_children);
+    discovery_entry.cached_priority_names = std::move(entry_priority_names);
   }
   Json json = Json::Array{Json::Object{
       {"priority_experimental",
@@ -38,6 +38,7 @@
 #include <grpc/impl/codegen/grpc_types.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
+#include <grpc/support/string_util.h>
 
 #include "src/core/lib/config/core_configuration.h"
 #include "src/core/lib/debug/trace.h"
@@ -50,6 +51,7 @@
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/iomgr_fwd.h"
 #include "src/core/lib/iomgr/pollset_set.h"
 #include "src/core/lib/iomgr/resolved_address.h"
@@ -93,6 +95,113 @@ namespace grpc_core {
 
 namespace {
 
+// How long a cached resolution result is served without triggering
+// revalidation.
+constexpr Duration kDnsCacheFreshAge = Duration::Seconds(30);
+// Oldest cached result that may still be served, either while a
+// revalidation is in flight or after one has failed.
+constexpr Duration kDnsCacheMaxStaleAge = Duration::Minutes(10);
+
+// A process-wide cache of c-ares resolution results, shared by all ares
+// client channel resolvers.  Without it, N channels resolving the same
+// target each issue their own periodic DNS queries; with it, a single
+// resolver revalidates the entry once it goes stale while the others are
+// served the cached result, so the steady-state DNS query load per target
+// is independent of the number of channels.  Enabled per channel via
+// GRPC_ARG_DNS_ENABLE_SHARED_CACHE.
+class AresResolutionCache {
+ public:
+  // The raw outputs of a successful resolution plus the time it was
+  // obtained.
+  struct CachedResult {
+    std::unique_ptr<ServerAddressList> addresses;
+    std::unique_ptr<ServerAddressList> balancer_addresses;
+    absl::optional<std::string> service_config_json;
+    Timestamp resolved_at;
+  };
+
+  static AresResolutionCache* Get() {
+    static AresResolutionCache* cache = new AresResolutionCache();
+    return cache;
+  }
+
+  // Returns a copy of the entry for key if the caller should be served
+  // from the cache: either the entry is fresh, or it is stale but another
+  // resolver is already revalidating it.  Otherwise returns nullopt and
+  // marks the entry as being revalidated; the caller must resolve for
+  // itself and then call either Update() or OnResolutionFailed().
+  absl::optional<CachedResult> Lookup(const std::string& key) {
+    MutexLock lock(&mu_);
+    Timestamp now = Timestamp::Now();
+    Entry& entry = cache_[key];
+    if (entry.result.has_value()) {
+      Duration age = now - entry.result->resolved_at;
+      if (age > kDnsCacheMaxStaleAge) {
+        entry.result.reset();
+      } else if (age <= kDnsCacheFreshAge || entry.revalidating) {
+        return Copy(*entry.result);
+      }
+    }
+    if (entry.revalidating) {
+      // A query for this key is already in flight but there is no usable
+      // result yet (cold start): resolve independently rather than wait.
+      return absl::nullopt;
+    }
+    entry.revalidating = true;
+    return absl::nullopt;
+  }
+
+  // Records a successful resolution and clears the revalidation marker.
+  void Update(const std::string& key, CachedResult result) {
+    result.resolved_at = Timestamp::Now();
+    MutexLock lock(&mu_);
+    Entry& entry = cache_[key];
+    entry.result = std::move(result);
+    entry.revalidating = false;
+  }
+
+  // Clears the revalidation marker after a failed resolution and returns
+  // a copy of any not-too-stale entry, so the caller can serve that
+  // instead of reporting the failure.
+  absl::optional<CachedResult> OnResolutionFailed(const std::string& key) {
+    MutexLock lock(&mu_);
+    auto it = cache_.find(key);
+    if (it == cache_.end()) return absl::nullopt;
+    Entry& entry = it->second;
+    entry.revalidating = false;
+    if (!entry.result.has_value() ||
+        Timestamp::Now() - entry.result->resolved_at > kDnsCacheMaxStaleAge) {
+      cache_.erase(it);
+      return absl::nullopt;
+    }
+    return Copy(*entry.result);
+  }
+
+ private:
+  struct Entry {
+    absl::optional<CachedResult> result;
+    // True while some resolver's query for this key is in flight.
+    bool revalidating = false;
+  };
+
+  static CachedResult Copy(const CachedResult& result) {
+    CachedResult copy;
+    if (result.addresses != nullptr) {
+      copy.addresses = std::make_unique<ServerAddressList>(*result.addresses);
+    }
+    if (result.balancer_addresses != nullptr) {
+      copy.balancer_addresses =
+          std::make_unique<ServerAddressList>(*result.balancer_addresses);
+    }
+    copy.service_config_json = result.service_config_json;
+    copy.resolved_at = result.resolved_at;
+    return copy;
+  }
+
+  Mutex mu_;
+  std::map<std::string, Entry> cache_ ABSL_GUARDED_BY(mu_);
+};
+
 class AresClientChannelDNSResolver : public PollingResolver {
  public:
   AresClientChannelDNSResolver(ResolverArgs args,
@@ -109,6 +218,31 @@ class AresClientChannelDNSResolver : public PollingResolver {
       // TODO(hork): replace this callback bookkeeping with promises.
       // Locking to prevent completion before all records are queried
       MutexLock lock(&on_resolved_mu_);
+      if (resolver_->enable_shared_dns_cache_) {
+        cache_key_ = MakeCacheKey();
+        absl::optional<AresResolutionCache::CachedResult> cached =
+            AresResolutionCache::Get()->Lookup(cache_key_);
+        if (cached.has_value()) {
+          GRPC_CARES_TRACE_LOG(
+              "resolver:%p serving shared DNS cache entry for %s",
+              resolver_.get(), cache_key_.c_str());
+          served_from_cache_ = true;
+          addresses_ = std::move(cached->addresses);
+          balancer_addresses_ = std::move(cached->balancer_addresses);
+          if (cached->service_config_json.has_value()) {
+            service_config_json_ =
+                gpr_strdup(cached->service_config_json->c_str());
+          }
+          // Complete via the usual callback path so that the result is
+          // delivered outside of StartRequest().
+          Ref(DEBUG_LOCATION, "OnHostnameResolved").release();
+          GRPC_CLOSURE_INIT(&on_hostname_resolved_, OnHostnameResolved, this,
+                            nullptr);
+          ExecCtx::Run(DEBUG_LOCATION, &on_hostname_resolved_,
+                       GRPC_ERROR_NONE);
+          return;
+        }
+      }
       Ref(DEBUG_LOCATION, "OnHostnameResolved").release();
       GRPC_CLOSURE_INIT(&on_hostname_resolved_, OnHostnameResolved, this,
                         nullptr);
@@ -176,8 +310,20 @@ class AresClientChannelDNSResolver : public PollingResolver {
     absl::optional<Result> OnResolvedLocked(grpc_error_handle error)
         ABSL_EXCLUSIVE_LOCKS_REQUIRED(on_resolved_mu_);
 
+    std::string MakeCacheKey() const {
+      return absl::StrCat(resolver_->authority(), "/",
+                          resolver_->name_to_resolve(),
+                          resolver_->enable_srv_queries_ ? "?srv" : "",
+                          resolver_->request_service_config_ ? "?txt" : "");
+    }
+
     Mutex on_resolved_mu_;
     RefCountedPtr<AresClientChannelDNSResolver> resolver_;
+    // Key into the shared resolution cache; empty if caching is disabled.
+    std::string cache_key_ ABSL_GUARDED_BY(on_resolved_mu_);
+    // Whether this request was answered from the shared cache; such
+    // results must not be written back to it.
+    bool served_from_cache_ ABSL_GUARDED_BY(on_resolved_mu_) = false;
     grpc_closure on_hostname_resolved_;
     std::unique_ptr<grpc_ares_request> hostname_request_
         ABSL_GUARDED_BY(on_resolved_mu_);
@@ -201,6 +347,9 @@ class AresClientChannelDNSResolver : public PollingResolver {
   const bool request_service_config_;
   // whether or not to enable SRV DNS queries
   const bool enable_srv_queries_;
+  // whether to share resolution results with other channels through the
+  // process-wide cache
+  const bool enable_shared_dns_cache_;
   // timeout in milliseconds for active DNS queries
   const int query_timeout_ms_;
 };
@@ -227,6 +376,9 @@ AresClientChannelDNSResolver::AresClientChannelDNSResolver(
                .value_or(true)),
       enable_srv_queries_(channel_args.GetBool(GRPC_ARG_DNS_ENABLE_SRV_QUERIES)
                               .value_or(false)),
+      enable_shared_dns_cache_(
+          channel_args.GetBool(GRPC_ARG_DNS_ENABLE_SHARED_CACHE)
+              .value_or(false)),
       query_timeout_ms_(
           std::max(0, channel_args.GetInt(GRPC_ARG_DNS_ARES_QUERY_TIMEOUT_MS)
                           .value_or(GRPC_DNS_ARES_DEFAULT_QUERY_TIMEOUT_MS))) {}
@@ -395,6 +547,42 @@ AresClientChannelDNSResolver::AresRequestWrapper::OnResolvedLocked(
     return absl::nullopt;
   }
   GRPC_CARES_TRACE_LOG("resolver:%p OnResolved() proceeding", this);
+  if (resolver_->enable_shared_dns_cache_ && !served_from_cache_) {
+    if (addresses_ != nullptr || balancer_addresses_ != nullptr) {
+      // Publish the fresh result for other channels resolving this target.
+      AresResolutionCache::CachedResult to_cache;
+      if (addresses_ != nullptr) {
+        to_cache.addresses = std::make_unique<ServerAddressList>(*addresses_);
+      }
+      if (balancer_addresses_ != nullptr) {
+        to_cache.balancer_addresses =
+            std::make_unique<ServerAddressList>(*balancer_addresses_);
+      }
+      if (service_config_json_ != nullptr) {
+        to_cache.service_config_json = service_config_json_;
+      }
+      AresResolutionCache::Get()->Update(cache_key_, std::move(to_cache));
+    } else {
+      // Resolution failed; serve a stale cache entry, if one remains,
+      // rather than reporting the failure.
+      absl::optional<AresResolutionCache::CachedResult> stale =
+          AresResolutionCache::Get()->OnResolutionFailed(cache_key_);
+      if (stale.has_value()) {
+        GRPC_CARES_TRACE_LOG(
+            "resolver:%p serving stale shared DNS cache entry for %s after "
+            "failed resolution",
+            this, cache_key_.c_str());
+        served_from_cache_ = true;
+        addresses_ = std::move(stale->addresses);
+        balancer_addresses_ = std::move(stale->balancer_addresses);
+        gpr_free(service_config_json_);
+        service_config_json_ =
+            stale->service_config_json.has_value()
+                ? gpr_strdup(stale->service_config_json->c_str())
+                : nullptr;
+      }
+    }
+  }
   Result result;
   result.args = resolver_->channel_args();
   // TODO(roth): Change logic to be able to report failures for addresses
@@ -840,6 +1028,7 @@ void RegisterAresDnsResolver(CoreConfiguration::Builder* builder) {
 void grpc_resolver_dns_ares_init() {
   if (grpc_core::UseAresDnsResolver()) {
     address_sorting_init();
+    grpc_cares_wrapper_enable_address_sorting_cache();
     grpc_error_handle error = grpc_ares_init();
     if (!error.ok()) {
       GRPC_LOG_IF_ERROR("grpc_ares_init() failed", error);
@@ -37,6 +37,7 @@
 #include <string.h>
 #include <sys/types.h>  // IWYU pragma: keep
 
+#include <map>
 #include <string>
 #include <utility>
 
@@ -53,6 +54,7 @@
 #include <grpc/support/log.h>
 #include <grpc/support/string_util.h>
 #include <grpc/support/sync.h>
+#include <grpc/support/time.h>
 
 #include "src/core/ext/filters/client_channel/resolver/dns/c_ares/grpc_ares_ev_driver.h"
 #include "src/core/ext/filters/client_channel/resolver/dns/c_ares/grpc_ares_wrapper.h"
@@ -62,6 +64,7 @@
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/host_port.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
@@ -543,6 +546,103 @@ grpc_error_handle grpc_ares_ev_driver_create_locked(
   return absl::OkStatus();
 }
 
+namespace {
+
+// How long a cached source-address snapshot stays valid. Ideally the cache
+// would be invalidated when the route table changes (e.g., via netlink on
+// Linux), but no such notification mechanism is available portably, so the
+// snapshot simply expires after this interval.
+constexpr int64_t kSourceAddrCacheValiditySeconds = 30;
+
+// A source address factory that caches the source address discovered for
+// each destination. The platform factory issues socket()/connect()/
+// getsockname() syscalls per destination, which is wasteful when large
+// resolution results are re-sorted on every refresh; the network topology
+// that determines the answers changes rarely.
+struct CachingSourceAddrFactory {
+  explicit CachingSourceAddrFactory(
+      address_sorting_source_addr_factory* delegate);
+
+  struct CachedSourceAddr {
+    bool exists;
+    address_sorting_address source_addr;
+  };
+
+  address_sorting_source_addr_factory base;
+  address_sorting_source_addr_factory* delegate;
+  grpc_core::Mutex mu;
+  // When the current snapshot was taken; entries are dropped wholesale when
+  // it expires.
+  gpr_timespec snapshot_time ABSL_GUARDED_BY(mu);
+  std::map<std::string /* dest addr bytes */, CachedSourceAddr> entries
+      ABSL_GUARDED_BY(mu);
+};
+
+bool caching_source_addr_factory_get_source_addr(
+    address_sorting_source_addr_factory* factory,
+    const address_sorting_address* dest_addr,
+    address_sorting_address* source_addr) {
+  CachingSourceAddrFactory* self =
+      reinterpret_cast<CachingSourceAddrFactory*>(factory);
+  std::string key(dest_addr->addr, dest_addr->len);
+  {
+    grpc_core::MutexLock lock(&self->mu);
+    gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
+    if (gpr_time_cmp(gpr_time_sub(now, self->snapshot_time),
+                     gpr_time_from_seconds(kSourceAddrCacheValiditySeconds,
+                                           GPR_TIMESPAN)) > 0) {
+      self->entries.clear();
+      self->snapshot_time = now;
+    }
+    auto it = self->entries.find(key);
+    if (it != self->entries.end()) {
+      *source_addr = it->second.source_addr;
+      return it->second.exists;
+    }
+  }
+  bool exists = self->delegate->vtable->get_source_addr(self->delegate,
+                                                        dest_addr, source_addr);
+  grpc_core::MutexLock lock(&self->mu);
+  CachingSourceAddrFactory::CachedSourceAddr& entry = self->entries[key];
+  entry.exists = exists;
+  if (exists) {
+    entry.source_addr = *source_addr;
+  } else {
+    // The sorter pre-zeroes the source address field, so a cache hit for a
+    // destination with no source address must hand back zeroes as well.
+    memset(&entry.source_addr, 0, sizeof(entry.source_addr));
+  }
+  return exists;
+}
+
+void caching_source_addr_factory_destroy(
+    address_sorting_source_addr_factory* factory) {
+  CachingSourceAddrFactory* self =
+      reinterpret_cast<CachingSourceAddrFactory*>(factory);
+  self->delegate->vtable->destroy(self->delegate);
+  delete self;
+}
+
+const address_sorting_source_addr_factory_vtable
+    caching_source_addr_factory_vtable = {
+        caching_source_addr_factory_get_source_addr,
+        caching_source_addr_factory_destroy,
+};
+
+CachingSourceAddrFactory::CachingSourceAddrFactory(
+    address_sorting_source_addr_factory* delegate)
+    : delegate(delegate), snapshot_time(gpr_now(GPR_CLOCK_MONOTONIC)) {
+  base.vtable = &caching_source_addr_factory_vtable;
+}
+
+}  // namespace
+
+void grpc_cares_wrapper_enable_address_sorting_cache(void) {
+  CachingSourceAddrFactory* factory = new CachingSourceAddrFactory(
+      address_sorting_create_source_addr_factory_for_current_platform());
+  address_sorting_override_source_addr_factory(&factory->base);
+}
+
 static void log_address_sorting_list(const grpc_ares_request* r,
                                      const ServerAddressList& addresses,
                                      const char* input_output_str) {
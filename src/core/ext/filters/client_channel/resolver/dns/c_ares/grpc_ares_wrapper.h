@@ -130,6 +130,14 @@ bool grpc_ares_query_ipv6();
 void grpc_cares_wrapper_address_sorting_sort(
     const grpc_ares_request* request, grpc_core::ServerAddressList* addresses);
 
+/* Replaces the address sorting source address factory with one that caches
+   the source address discovered for each destination, so that re-sorting
+   large resolution results does not redo the per-destination test-connect
+   syscalls. The cached topology snapshot expires after a short validity
+   period, since route table changes cannot be observed portably. Must be
+   called after address_sorting_init(). */
+void grpc_cares_wrapper_enable_address_sorting_cache(void);
+
 /* Exposed in this header for C-core tests only */
 extern void (*grpc_ares_test_only_inject_config)(ares_channel channel);
 
@@ -20,6 +20,7 @@
 
 #include <inttypes.h>
 
+#include <algorithm>
 #include <functional>
 #include <utility>
 #include <vector>
@@ -80,6 +81,19 @@ void PollingResolver::RequestReresolutionLocked() {
         ResultStatusState::kResultHealthCallbackPending) {
       result_status_state_ =
           ResultStatusState::kReresolutionRequestedWhileCallbackWasPending;
+    } else if (std::exchange(fast_reresolution_available_, false) &&
+               !have_next_resolution_timer_) {
+      // Fast lane: the first re-resolution request after a healthy result
+      // skips the cooldown, so that recovery from a fresh failure is not
+      // delayed.  Subsequent requests go through the (adaptive) cooldown
+      // until the channel reports a healthy result again.
+      if (GPR_UNLIKELY(tracer_ != nullptr && tracer_->enabled())) {
+        gpr_log(GPR_INFO,
+                "[polling resolver %p] first re-resolution request after "
+                "healthy result; skipping cooldown",
+                this);
+      }
+      StartResolvingLocked();
     } else {
       MaybeStartResolvingLocked();
     }
@@ -153,6 +167,16 @@ void PollingResolver::OnRequestCompleteLocked(Result result) {
                                .c_str())
                   : result.service_config.status().ToString().c_str());
     }
+    // Track consecutive identical results, which stretch the effective
+    // cooldown in MaybeStartResolvingLocked(): while re-resolution keeps
+    // yielding the same answer, polling more often cannot help.
+    if (last_result_addresses_.has_value() &&
+        result.addresses == *last_result_addresses_) {
+      ++consecutive_identical_results_;
+    } else {
+      consecutive_identical_results_ = 0;
+    }
+    last_result_addresses_ = result.addresses;
     GPR_ASSERT(result.result_health_callback == nullptr);
     RefCountedPtr<PollingResolver> self =
         Ref(DEBUG_LOCATION, "result_health_callback");
@@ -175,8 +199,15 @@ void PollingResolver::GetResultStatus(absl::Status status) {
     // Reset backoff state so that we start from the beginning when the
     // next request gets triggered.
     backoff_.Reset();
+    // A healthy result means that any future failure is fresh, so the next
+    // re-resolution request may skip the cooldown.
+    fast_reresolution_available_ = true;
     // If a re-resolution attempt was requested while the result-status
-    // callback was pending, trigger a new request now.
+    // callback was pending, trigger a new request now.  Note that we do
+    // not use the fast lane here: the request has already been delayed by
+    // the callback, and skipping the cooldown whenever failures keep
+    // arriving during healthy results would degenerate into polling as
+    // fast as resolutions complete.
     if (std::exchange(result_status_state_, ResultStatusState::kNone) ==
         ResultStatusState::kReresolutionRequestedWhileCallbackWasPending) {
       MaybeStartResolvingLocked();
@@ -218,8 +249,14 @@ void PollingResolver::MaybeStartResolvingLocked() {
     // in a loop while draining the currently-held WorkSerializer.
     // Also see https://github.com/grpc/grpc/issues/26079.
     ExecCtx::Get()->InvalidateNow();
+    // Each consecutive identical result doubles the effective cooldown,
+    // up to 16x the configured minimum.  The multiplier drops back to 1
+    // as soon as a resolution yields a different result.
+    const Duration effective_min_time_between_resolutions =
+        min_time_between_resolutions_ *
+        (1 << std::min(consecutive_identical_results_, 4));
     const Timestamp earliest_next_resolution =
-        *last_resolution_timestamp_ + min_time_between_resolutions_;
+        *last_resolution_timestamp_ + effective_min_time_between_resolutions;
     const Duration time_until_next_resolution =
         earliest_next_resolution - Timestamp::Now();
     if (time_until_next_resolution > Duration::Zero()) {
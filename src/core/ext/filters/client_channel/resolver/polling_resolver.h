@@ -23,6 +23,7 @@
 #include <string>
 
 #include "absl/status/status.h"
+#include "absl/status/statusor.h"
 #include "absl/types/optional.h"
 
 #include "src/core/lib/backoff/backoff.h"
@@ -37,6 +38,7 @@
 #include "src/core/lib/iomgr/timer.h"
 #include "src/core/lib/resolver/resolver.h"
 #include "src/core/lib/resolver/resolver_factory.h"
+#include "src/core/lib/resolver/server_address.h"
 
 namespace grpc_core {
 
@@ -106,6 +108,18 @@ class PollingResolver : public Resolver {
   Duration min_time_between_resolutions_;
   /// timestamp of last DNS request
   absl::optional<Timestamp> last_resolution_timestamp_;
+  /// addresses from the last resolution result, used to detect consecutive
+  /// identical results
+  absl::optional<absl::StatusOr<ServerAddressList>> last_result_addresses_;
+  /// number of consecutive results identical to last_result_addresses_;
+  /// each one doubles the effective cooldown (up to a cap), so that we
+  /// poll less aggressively while re-resolution keeps yielding the same
+  /// answer (e.g., while a backend flaps)
+  int consecutive_identical_results_ = 0;
+  /// whether the next re-resolution request may skip the cooldown; armed
+  /// whenever the channel reports a healthy result, so that the first
+  /// failure after a period of stability triggers an immediate re-resolution
+  bool fast_reresolution_available_ = true;
   /// retry backoff state
   BackOff backoff_;
   /// state for handling interactions between re-resolution requests and
@@ -122,6 +122,8 @@ class IPv4ResolverFactory : public ResolverFactory {
     return CreateSockaddrResolver(std::move(args), grpc_parse_ipv4);
   }
 
+  bool ResolvesSynchronously() const override { return true; }
+
   absl::string_view scheme() const override { return "ipv4"; }
 };
 
@@ -135,6 +137,8 @@ class IPv6ResolverFactory : public ResolverFactory {
     return CreateSockaddrResolver(std::move(args), grpc_parse_ipv6);
   }
 
+  bool ResolvesSynchronously() const override { return true; }
+
   absl::string_view scheme() const override { return "ipv6"; }
 };
 
@@ -149,6 +153,8 @@ class UnixResolverFactory : public ResolverFactory {
     return CreateSockaddrResolver(std::move(args), grpc_parse_unix);
   }
 
+  bool ResolvesSynchronously() const override { return true; }
+
   std::string GetDefaultAuthority(const URI& /*uri*/) const override {
     return "localhost";
   }
@@ -168,6 +174,8 @@ class UnixAbstractResolverFactory : public ResolverFactory {
     return CreateSockaddrResolver(std::move(args), grpc_parse_unix_abstract);
   }
 
+  bool ResolvesSynchronously() const override { return true; }
+
   std::string GetDefaultAuthority(const URI& /*uri*/) const override {
     return "localhost";
   }
@@ -50,6 +50,7 @@
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/context.h"
 #include "src/core/lib/channel/status_util.h"
+#include "src/core/lib/debug/stats.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/construct_destruct.h"
@@ -461,6 +462,12 @@ class RetryFilter::CallData {
     grpc_transport_stream_op_batch_payload batch_payload_;
     // For send_initial_metadata.
     grpc_metadata_batch send_initial_metadata_{calld_->arena_};
+    // For send_message.  Holds a shallow ref-copy of the cached slices for
+    // the send_message op currently in flight on this attempt, so that
+    // filters below us that mutate the buffer they are given in place
+    // cannot corrupt the cache for later replays.  Note that we can only
+    // have one send_message op in flight at a time, so one buffer suffices.
+    SliceBuffer send_message_;
     // For send_trailing_metadata.
     grpc_metadata_batch send_trailing_metadata_{calld_->arena_};
     // For intercepting recv_initial_metadata.
@@ -1279,11 +1286,16 @@ void RetryFilter::CallData::CallAttempt::OnPerAttemptRecvTimerLocked(
     // Cancel this attempt.
     // TODO(roth): When implementing hedging, we should not cancel the
     // current attempt.
-    call_attempt->MaybeAddBatchForCancelOp(
-        grpc_error_set_int(GRPC_ERROR_CREATE_FROM_STATIC_STRING(
-                               "retry perAttemptRecvTimeout exceeded"),
-                           GRPC_ERROR_INT_GRPC_STATUS, GRPC_STATUS_CANCELLED),
-        &closures);
+    // Interned, since this fires for every attempt that hits the
+    // perAttemptRecvTimeout and the status never varies.
+    static const absl::Status* const kPerAttemptRecvTimeoutError = [] {
+      return new absl::Status(grpc_error_set_int(
+          GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+              "retry perAttemptRecvTimeout exceeded"),
+          GRPC_ERROR_INT_GRPC_STATUS, GRPC_STATUS_CANCELLED));
+    }();
+    call_attempt->MaybeAddBatchForCancelOp(*kPerAttemptRecvTimeoutError,
+                                           &closures);
     // Check whether we should retry.
     if (call_attempt->ShouldRetry(/*status=*/absl::nullopt,
                                   /*server_pushback_ms=*/absl::nullopt)) {
@@ -1777,14 +1789,16 @@ void RetryFilter::CallData::CallAttempt::BatchData::RecvTrailingMetadataReady(
     // If we're retrying, do so.
     if (retry != kNoRetry) {
       CallCombinerClosureList closures;
-      // Cancel call attempt.
+      // Cancel call attempt.  The cancellation status is interned: retrying
+      // workloads cancel an attempt this way on every retried RPC, and
+      // rebuilding the same payload chain each time showed up in profiles.
+      static const absl::Status* const kCallAttemptFailedError = [] {
+        return new absl::Status(grpc_error_set_int(
+            GRPC_ERROR_CREATE_FROM_STATIC_STRING("call attempt failed"),
+            GRPC_ERROR_INT_GRPC_STATUS, GRPC_STATUS_CANCELLED));
+      }();
       call_attempt->MaybeAddBatchForCancelOp(
-          error.ok()
-              ? grpc_error_set_int(
-                    GRPC_ERROR_CREATE_FROM_STATIC_STRING("call attempt failed"),
-                    GRPC_ERROR_INT_GRPC_STATUS, GRPC_STATUS_CANCELLED)
-              : error,
-          &closures);
+          error.ok() ? *kCallAttemptFailedError : error, &closures);
       // For transparent retries, add a closure to immediately start a new
       // call attempt.
       // For configurable retries, start retry timer.
@@ -2008,7 +2022,17 @@ void RetryFilter::CallData::CallAttempt::BatchData::
       calld->send_messages_[call_attempt_->started_send_message_count_];
   ++call_attempt_->started_send_message_count_;
   batch_.send_message = true;
-  batch_.payload->send_message.send_message = cache.slices;
+  // Send the attempt a shallow ref-copy of the cached slices instead of
+  // the cache itself: filters below us (e.g., message compression) may
+  // mutate the buffer they are given in place, which would corrupt the
+  // cache for later replays.  This costs one refcount bump per slice; the
+  // payload bytes are never copied.
+  call_attempt_->send_message_.Clear();
+  for (size_t i = 0; i < cache.slices->Count(); ++i) {
+    call_attempt_->send_message_.Append(cache.slices->RefSlice(i));
+  }
+  GRPC_STATS_ADD_RETRY_REPLAY_BYTES_SHARED(cache.slices->Length());
+  batch_.payload->send_message.send_message = &call_attempt_->send_message_;
   batch_.payload->send_message.flags = cache.flags;
 }
 
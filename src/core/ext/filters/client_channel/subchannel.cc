@@ -22,10 +22,13 @@
 #include <limits.h>
 
 #include <algorithm>
+#include <map>
 #include <memory>
 #include <new>
+#include <string>
 #include <utility>
 
+#include "absl/random/random.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/cord.h"
 #include "absl/strings/str_cat.h"
@@ -37,6 +40,7 @@
 #include <grpc/support/log.h>
 
 #include "src/core/ext/filters/client_channel/health/health_check_client.h"
+#include "src/core/ext/filters/client_channel/health/health_check_stream_registry.h"
 #include "src/core/ext/filters/client_channel/subchannel_pool_interface.h"
 #include "src/core/ext/filters/client_channel/subchannel_stream_client.h"
 #include "src/core/lib/address_utils/sockaddr_utils.h"
@@ -54,6 +58,7 @@
 #include "src/core/lib/gpr/alloc.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/debug_location.h"
+#include "src/core/lib/gprpp/no_destruct.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/handshaker/proxy_mapper_registry.h"
@@ -115,6 +120,16 @@ void ConnectedSubchannel::StartWatch(
   elem->filter->start_transport_op(elem, op);
 }
 
+void ConnectedSubchannel::SetStreamsSaturatedCallback(
+    void (*fn)(void* user_data), void* user_data, grpc_closure* on_consumed) {
+  grpc_transport_op* op = grpc_make_transport_op(on_consumed);
+  op->set_streams_saturated = true;
+  op->set_streams_saturated_fn = fn;
+  op->set_streams_saturated_user_data = user_data;
+  grpc_channel_element* elem = grpc_channel_stack_element(channel_stack_, 0);
+  elem->filter->start_transport_op(elem, op);
+}
+
 void ConnectedSubchannel::Ping(grpc_closure* on_initiate,
                                grpc_closure* on_ack) {
   grpc_transport_op* op = grpc_make_transport_op(nullptr);
@@ -297,8 +312,9 @@ class Subchannel::ConnectedSubchannelStateWatcher
     : public AsyncConnectivityStateWatcherInterface {
  public:
   // Must be instantiated while holding c->mu.
-  explicit ConnectedSubchannelStateWatcher(WeakRefCountedPtr<Subchannel> c)
-      : subchannel_(std::move(c)) {}
+  ConnectedSubchannelStateWatcher(WeakRefCountedPtr<Subchannel> c,
+                                  ConnectedSubchannel* connection)
+      : subchannel_(std::move(c)), connection_(connection) {}
 
   ~ConnectedSubchannelStateWatcher() override {
     subchannel_.reset(DEBUG_LOCATION, "state_watcher");
@@ -310,36 +326,71 @@ class Subchannel::ConnectedSubchannelStateWatcher
     Subchannel* c = subchannel_.get();
     MutexLock lock(&c->mu_);
     // If we're either shutting down or have already seen this connection
-    // failure (i.e., c->connected_subchannel_ is null), do nothing.
+    // failure (i.e., the connection we watch is no longer present), do
+    // nothing.
     //
     // The transport reports TRANSIENT_FAILURE upon GOAWAY but SHUTDOWN
     // upon connection close.  So if the server gracefully shuts down,
     // we will see TRANSIENT_FAILURE followed by SHUTDOWN, but if not, we
     // will see only SHUTDOWN.  Either way, we react to the first one we
     // see, ignoring anything that happens after that.
-    if (c->connected_subchannel_ == nullptr) return;
     if (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE ||
         new_state == GRPC_CHANNEL_SHUTDOWN) {
       if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_subchannel)) {
         gpr_log(GPR_INFO,
                 "subchannel %p %s: Connected subchannel %p reports %s: %s", c,
-                c->key_.ToString().c_str(), c->connected_subchannel_.get(),
+                c->key_.ToString().c_str(), connection_,
                 ConnectivityStateName(new_state), status.ToString().c_str());
       }
+      // If this watcher covers an extra connection, just drop that
+      // connection; the subchannel's state is driven by the primary one.
+      for (auto it = c->extra_connected_subchannels_.begin();
+           it != c->extra_connected_subchannels_.end(); ++it) {
+        if (it->get() == connection_) {
+          c->UnregisterSaturationCallback(connection_);
+          c->extra_connected_subchannels_.erase(it);
+          return;
+        }
+      }
+      if (c->connected_subchannel_.get() != connection_) return;
+      c->UnregisterSaturationCallback(connection_);
       c->connected_subchannel_.reset();
       if (c->channelz_node() != nullptr) {
         c->channelz_node()->SetChildSocket(nullptr);
       }
+      // If extra connections exist, promote one to primary so that the
+      // subchannel stays READY and calls keep flowing.
+      if (!c->extra_connected_subchannels_.empty()) {
+        c->connected_subchannel_ =
+            std::move(c->extra_connected_subchannels_.front());
+        c->extra_connected_subchannels_.erase(
+            c->extra_connected_subchannels_.begin());
+        return;
+      }
       // Even though we're reporting IDLE instead of TRANSIENT_FAILURE here,
       // pass along the status from the transport, since it may have
       // keepalive info attached to it that the channel needs.
       // TODO(roth): Consider whether there's a cleaner way to do this.
       c->SetConnectivityStateLocked(GRPC_CHANNEL_IDLE, status);
       c->backoff_.Reset();
+      // A TRANSIENT_FAILURE report from a READY transport means the
+      // server sent a graceful GOAWAY and will keep serving established
+      // streams for its drain grace period.  Start the replacement
+      // connection now, so that the TCP/TLS/HTTP2 setup overlaps the
+      // drain and new calls migrate to the fresh connection as soon as
+      // it is published, instead of paying the full handshake latency
+      // on the next pick.
+      if (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE &&
+          c->proactive_reconnect_on_goaway_) {
+        c->StartConnectingLocked();
+      }
     }
   }
 
   WeakRefCountedPtr<Subchannel> subchannel_;
+  // The connection this watcher covers.  Only used for identity
+  // comparisons under the subchannel's lock; never dereferenced.
+  ConnectedSubchannel* connection_;
 };
 
 // Asynchronously notifies the \a watcher of a change in the connectvity state
@@ -406,6 +457,11 @@ class Subchannel::HealthWatcherMap::HealthWatcher
         state_(subchannel_->state_ == GRPC_CHANNEL_READY
                    ? GRPC_CHANNEL_CONNECTING
                    : subchannel_->state_) {
+    if (subchannel_->args_
+            .GetBool(GRPC_ARG_EXPERIMENTAL_SHARE_HEALTH_CHECK_STREAMS)
+            .value_or(false)) {
+      MaybeRegisterSharedStreamSubscription();
+    }
     // If the subchannel is already connected, start health checking.
     if (subchannel_->state_ == GRPC_CHANNEL_READY) StartHealthCheckingLocked();
   }
@@ -453,12 +509,51 @@ class Subchannel::HealthWatcherMap::HealthWatcher
       watcher_list_.NotifyLocked(state_, status);
       // We're not connected, so stop health checking.
       health_check_client_.reset();
+      if (subscription_ != nullptr) {
+        mirroring_ = false;
+        // If we owned the shared stream, let another subchannel take over.
+        HealthCheckStreamRegistry::Get()->Release(registry_key_,
+                                                 subscription_.get());
+      }
+    }
+  }
+
+  // Applies a report fanned out from the shared stream's owner.  Requires
+  // the subchannel's lock.
+  void OnSharedHealthUpdateLocked(grpc_connectivity_state state,
+                                  const absl::Status& status) {
+    if (!mirroring_) return;
+    state_ = state;
+    status_ = status;
+    watcher_list_.NotifyLocked(state_, status);
+  }
+
+  // Called when the shared stream's owner went away.  Requires the
+  // subchannel's lock.
+  void OnSharedStreamOwnerLostLocked() {
+    // Only a connected mirror is in a position to take the stream over;
+    // disconnected subscribers try again when they next become READY.
+    if (!mirroring_) return;
+    absl::optional<grpc_connectivity_state> shared_state;
+    absl::Status shared_status;
+    if (HealthCheckStreamRegistry::Get()->TryAcquire(
+            registry_key_, subscription_.get(), &shared_state,
+            &shared_status)) {
+      mirroring_ = false;
+      health_check_client_ = MakeHealthCheckClient(
+          health_check_service_name_, subchannel_->connected_subchannel_,
+          subchannel_->pollset_set_, subchannel_->channelz_node_, Ref());
     }
   }
 
   void Orphan() override {
     watcher_list_.Clear();
     health_check_client_.reset();
+    if (subscription_ != nullptr) {
+      HealthCheckStreamRegistry::Get()->Unregister(registry_key_,
+                                                   subscription_.get());
+      subscription_.reset();
+    }
     Unref();
   }
 
@@ -470,12 +565,60 @@ class Subchannel::HealthWatcherMap::HealthWatcher
       state_ = new_state;
       status_ = status;
       watcher_list_.NotifyLocked(new_state, status);
+      if (subscription_ != nullptr) {
+        HealthCheckStreamRegistry::Get()->Publish(
+            registry_key_, subscription_.get(), new_state, status);
+      }
     }
   }
 
+  void MaybeRegisterSharedStreamSubscription()
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(subchannel_->mu_) {
+    auto address = grpc_sockaddr_to_uri(&subchannel_->key_.address());
+    if (!address.ok()) return;
+    registry_key_ = absl::StrCat(*address, "/", health_check_service_name_);
+    // Both callbacks are delivered with no locks held; they re-enter the
+    // subchannel through its lock, and no-op if this watcher has already
+    // been removed from the map.
+    subscription_ = MakeRefCounted<HealthCheckStreamRegistry::Subscription>(
+        [subchannel = subchannel_->WeakRef(DEBUG_LOCATION, "health_sharing"),
+         service_name = health_check_service_name_](
+            grpc_connectivity_state state, const absl::Status& status) {
+          MutexLock lock(&subchannel->mu_);
+          auto it = subchannel->health_watcher_map_.map_.find(service_name);
+          if (it == subchannel->health_watcher_map_.map_.end()) return;
+          it->second->OnSharedHealthUpdateLocked(state, status);
+        },
+        [subchannel = subchannel_->WeakRef(DEBUG_LOCATION, "health_sharing"),
+         service_name = health_check_service_name_]() {
+          MutexLock lock(&subchannel->mu_);
+          auto it = subchannel->health_watcher_map_.map_.find(service_name);
+          if (it == subchannel->health_watcher_map_.map_.end()) return;
+          it->second->OnSharedStreamOwnerLostLocked();
+        });
+    HealthCheckStreamRegistry::Get()->Register(registry_key_, subscription_);
+  }
+
   void StartHealthCheckingLocked()
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(subchannel_->mu_) {
     GPR_ASSERT(health_check_client_ == nullptr);
+    if (subscription_ != nullptr) {
+      absl::optional<grpc_connectivity_state> shared_state;
+      absl::Status shared_status;
+      if (!HealthCheckStreamRegistry::Get()->TryAcquire(
+              registry_key_, subscription_.get(), &shared_state,
+              &shared_status)) {
+        // Another subchannel owns the stream for this address and service
+        // name; mirror its reports instead of opening our own stream.
+        mirroring_ = true;
+        if (shared_state.has_value()) {
+          state_ = *shared_state;
+          status_ = shared_status;
+          watcher_list_.NotifyLocked(state_, status_);
+        }
+        return;
+      }
+    }
     health_check_client_ = MakeHealthCheckClient(
         health_check_service_name_, subchannel_->connected_subchannel_,
         subchannel_->pollset_set_, subchannel_->channelz_node_, Ref());
@@ -487,6 +630,13 @@ class Subchannel::HealthWatcherMap::HealthWatcher
   grpc_connectivity_state state_;
   absl::Status status_;
   ConnectivityStateWatcherList watcher_list_;
+  // Set when this subchannel shares its health check stream (see
+  // GRPC_ARG_EXPERIMENTAL_SHARE_HEALTH_CHECK_STREAMS).
+  std::string registry_key_;
+  RefCountedPtr<HealthCheckStreamRegistry::Subscription> subscription_;
+  // True while another subchannel owns the shared stream and this one
+  // mirrors its reports.
+  bool mirroring_ = false;
 };
 
 //
@@ -575,6 +725,67 @@ Subchannel::ConnectivityStateWatcherInterface::PopConnectivityStateChange() {
 
 namespace {
 
+// Process-wide reconnect throttle shared by all subchannels connecting to
+// the same address.  Each subchannel backs off independently, so when a
+// backend dies, subchannels from many channels end up retrying on
+// synchronized schedules and hammer the recovering host.  This registry
+// assigns each retry the next free, jittered slot for its address, spacing
+// reconnect attempts out across the whole process.
+class PerAddressBackoffThrottle {
+ public:
+  static PerAddressBackoffThrottle* Get() {
+    static NoDestruct<PerAddressBackoffThrottle> throttle;
+    return throttle.get();
+  }
+
+  // Returns the time at which the caller may retry connecting to \a address,
+  // no earlier than \a earliest (the caller's own backoff time).  Attempts
+  // to one address are spaced at least 100ms apart; the spacing for each
+  // slot is jittered up to 2x so that the slots themselves do not become a
+  // new synchronized schedule.
+  Timestamp ReserveAttemptSlot(const grpc_resolved_address& address,
+                               Timestamp earliest) {
+    std::string key(address.addr, address.len);
+    MutexLock lock(&mu_);
+    // Opportunistically prune stale entries for addresses that stopped
+    // failing without ever connecting again.
+    if (next_slots_.size() > kMaxTrackedAddresses) {
+      const Timestamp now = Timestamp::Now();
+      for (auto it = next_slots_.begin(); it != next_slots_.end();) {
+        if (it->second < now) {
+          it = next_slots_.erase(it);
+        } else {
+          ++it;
+        }
+      }
+    }
+    Timestamp& next_slot = next_slots_[key];
+    const Timestamp slot = std::max(earliest, next_slot);
+    const Duration spacing =
+        Duration::Milliseconds(absl::Uniform(rand_gen_, kMinSlotSpacingMillis,
+                                             2 * kMinSlotSpacingMillis));
+    next_slot = slot + spacing;
+    return slot;
+  }
+
+  // Called when a connection to \a address succeeds; retries no longer need
+  // to be throttled.
+  void ReportSuccess(const grpc_resolved_address& address) {
+    std::string key(address.addr, address.len);
+    MutexLock lock(&mu_);
+    next_slots_.erase(key);
+  }
+
+ private:
+  static constexpr int64_t kMinSlotSpacingMillis = 100;
+  static constexpr size_t kMaxTrackedAddresses = 1024;
+
+  Mutex mu_;
+  // Next free retry slot, keyed by raw address bytes.
+  std::map<std::string, Timestamp> next_slots_ ABSL_GUARDED_BY(mu_);
+  absl::BitGen rand_gen_ ABSL_GUARDED_BY(mu_);
+};
+
 BackOff::Options ParseArgsForBackoffValues(const ChannelArgs& args,
                                            Duration* min_connect_timeout) {
   const absl::optional<Duration> fixed_reconnect_backoff =
@@ -643,6 +854,11 @@ Subchannel::Subchannel(SubchannelKey key,
                              .proxy_mapper_registry()
                              .MapAddress(key_.address(), &args_)
                              .value_or(key_.address());
+  proactive_reconnect_on_goaway_ =
+      args_.GetBool(GRPC_ARG_PROACTIVE_RECONNECT_ON_GOAWAY).value_or(true);
+  max_connections_ = static_cast<size_t>(Clamp(
+      args_.GetInt(GRPC_ARG_MAX_CONNECTIONS_PER_SUBCHANNEL).value_or(1), 1,
+      100));
   // Initialize channelz.
   const bool channelz_enabled = args_.GetBool(GRPC_ARG_ENABLE_CHANNELZ)
                                     .value_or(GRPC_ENABLE_CHANNELZ_DEFAULT);
@@ -779,7 +995,14 @@ void Subchannel::Orphan() {
   GPR_ASSERT(!shutdown_);
   shutdown_ = true;
   connector_.reset();
+  if (connected_subchannel_ != nullptr) {
+    UnregisterSaturationCallback(connected_subchannel_.get());
+  }
+  for (const auto& connection : extra_connected_subchannels_) {
+    UnregisterSaturationCallback(connection.get());
+  }
   connected_subchannel_.reset();
+  extra_connected_subchannels_.clear();
   health_watcher_map_.ShutdownLocked();
 }
 
@@ -867,11 +1090,15 @@ void Subchannel::OnRetryTimerLocked() {
 }
 
 void Subchannel::StartConnectingLocked() {
+  // Report CONNECTING.
+  SetConnectivityStateLocked(GRPC_CHANNEL_CONNECTING, absl::OkStatus());
+  // If the connector is busy with an extra-connection attempt, the result
+  // of that attempt will be used as the primary connection when it
+  // completes.
+  if (extra_connection_in_progress_) return;
   // Set next attempt time.
   const Timestamp min_deadline = min_connect_timeout_ + Timestamp::Now();
   next_attempt_time_ = backoff_.NextAttemptTime();
-  // Report CONNECTING.
-  SetConnectivityStateLocked(GRPC_CHANNEL_CONNECTING, absl::OkStatus());
   // Start connection attempt.
   SubchannelConnector::Args args;
   args.address = &address_for_connect_;
@@ -882,6 +1109,57 @@ void Subchannel::StartConnectingLocked() {
   connector_->Connect(args, &connecting_result_, &on_connecting_finished_);
 }
 
+void Subchannel::OnStreamsSaturated(void* arg) {
+  // Invoked by the transport when it cannot start new streams because the
+  // peer's MAX_CONCURRENT_STREAMS limit has been reached.  The argument
+  // holds a weak ref taken at registration time.
+  Subchannel* c = static_cast<Subchannel*>(arg);
+  MutexLock lock(&c->mu_);
+  c->MaybeStartExtraConnectionLocked();
+}
+
+void Subchannel::MaybeStartExtraConnectionLocked() {
+  if (shutdown_ || state_ != GRPC_CHANNEL_READY) return;
+  if (extra_connection_in_progress_) return;
+  if (1 + extra_connected_subchannels_.size() >= max_connections_) return;
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_subchannel)) {
+    gpr_log(GPR_INFO,
+            "subchannel %p %s: streams saturated; starting connection "
+            "%" PRIuPTR " of at most %" PRIuPTR,
+            this, key_.ToString().c_str(),
+            2 + extra_connected_subchannels_.size(), max_connections_);
+  }
+  extra_connection_in_progress_ = true;
+  SubchannelConnector::Args args;
+  args.address = &address_for_connect_;
+  args.interested_parties = pollset_set_;
+  args.deadline = Timestamp::Now() + min_connect_timeout_;
+  args.channel_args = args_;
+  WeakRef(DEBUG_LOCATION, "Connect").release();  // Ref held by callback.
+  connector_->Connect(args, &connecting_result_, &on_connecting_finished_);
+}
+
+void Subchannel::RegisterSaturationCallbackLocked(
+    ConnectedSubchannel* connection) {
+  connection->SetStreamsSaturatedCallback(
+      &Subchannel::OnStreamsSaturated,
+      WeakRef(DEBUG_LOCATION, "streams_saturated").release());
+}
+
+void Subchannel::UnregisterSaturationCallback(ConnectedSubchannel* connection) {
+  if (max_connections_ <= 1) return;  // Never registered.
+  // Clear the callback; release the weak ref held by the registration once
+  // the transport has processed the change and can no longer invoke it.
+  connection->SetStreamsSaturatedCallback(
+      nullptr, nullptr,
+      GRPC_CLOSURE_CREATE(
+          [](void* arg, grpc_error_handle /*error*/) {
+            static_cast<Subchannel*>(arg)->WeakUnref(DEBUG_LOCATION,
+                                                     "streams_saturated");
+          },
+          this, grpc_schedule_on_exec_ctx));
+}
+
 void Subchannel::OnConnectingFinished(void* arg, grpc_error_handle error) {
   WeakRefCountedPtr<Subchannel> c(static_cast<Subchannel*>(arg));
   {
@@ -895,12 +1173,30 @@ void Subchannel::OnConnectingFinishedLocked(grpc_error_handle error) {
   if (shutdown_) {
     return;
   }
+  if (extra_connection_in_progress_) {
+    extra_connection_in_progress_ = false;
+    if (connected_subchannel_ != nullptr) {
+      // A failed extra-connection attempt is simply dropped; the next
+      // saturation signal will trigger another one.
+      if (connecting_result_.transport != nullptr) {
+        PublishTransportLocked(/*for_extra_connection=*/true);
+      }
+      return;
+    }
+    // The primary connection went away while this attempt was in flight;
+    // use the result as the primary connection instead.
+  }
   // If we didn't get a transport or we fail to publish it, report
   // TRANSIENT_FAILURE and start the retry timer.
   // Note that if the connection attempt took longer than the backoff
   // time, then the timer will fire immediately, and we will quickly
   // transition back to IDLE.
   if (connecting_result_.transport == nullptr || !PublishTransportLocked()) {
+    // Space the retry out across all subchannels connecting to the same
+    // address, so that a recovering backend sees a bounded trickle of
+    // reconnect attempts instead of a synchronized herd.
+    next_attempt_time_ = PerAddressBackoffThrottle::Get()->ReserveAttemptSlot(
+        address_for_connect_, next_attempt_time_);
     const Duration time_until_next_attempt =
         next_attempt_time_ - Timestamp::Now();
     gpr_log(GPR_INFO,
@@ -926,10 +1222,14 @@ void Subchannel::OnConnectingFinishedLocked(grpc_error_handle error) {
             self.reset();
           }
         });
+  } else {
+    // Connected; drop any shared throttle state for this address so that
+    // future failures start with a clean slate.
+    PerAddressBackoffThrottle::Get()->ReportSuccess(address_for_connect_);
   }
 }
 
-bool Subchannel::PublishTransportLocked() {
+bool Subchannel::PublishTransportLocked(bool for_extra_connection) {
   // Construct channel stack.
   ChannelStackBuilderImpl builder("subchannel", GRPC_CLIENT_SUBCHANNEL);
   builder.SetChannelArgs(connecting_result_.channel_args)
@@ -951,19 +1251,30 @@ bool Subchannel::PublishTransportLocked() {
   connecting_result_.Reset();
   if (shutdown_) return false;
   // Publish.
-  connected_subchannel_.reset(
+  RefCountedPtr<ConnectedSubchannel> connected(
       new ConnectedSubchannel(stk->release(), args_, channelz_node_));
   if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_subchannel)) {
-    gpr_log(GPR_INFO, "subchannel %p %s: new connected subchannel at %p", this,
-            key_.ToString().c_str(), connected_subchannel_.get());
+    gpr_log(GPR_INFO, "subchannel %p %s: new %sconnected subchannel at %p",
+            this, key_.ToString().c_str(),
+            for_extra_connection ? "extra " : "", connected.get());
   }
+  // Start watching connected subchannel.
+  connected->StartWatch(
+      pollset_set_,
+      MakeOrphanable<ConnectedSubchannelStateWatcher>(
+          WeakRef(DEBUG_LOCATION, "state_watcher"), connected.get()));
+  // Ask the transport for saturation signals if we may scale out.
+  if (max_connections_ > 1) {
+    RegisterSaturationCallbackLocked(connected.get());
+  }
+  if (for_extra_connection) {
+    extra_connected_subchannels_.push_back(std::move(connected));
+    return true;
+  }
+  connected_subchannel_ = std::move(connected);
   if (channelz_node_ != nullptr) {
     channelz_node_->SetChildSocket(std::move(socket));
   }
-  // Start watching connected subchannel.
-  connected_subchannel_->StartWatch(
-      pollset_set_, MakeOrphanable<ConnectedSubchannelStateWatcher>(
-                        WeakRef(DEBUG_LOCATION, "state_watcher")));
   // Report initial state.
   SetConnectivityStateLocked(GRPC_CHANNEL_READY, absl::Status());
   return true;
@@ -24,6 +24,7 @@
 #include <deque>
 #include <functional>
 #include <map>
+#include <vector>
 #include <memory>
 #include <string>
 
@@ -76,6 +77,13 @@ class ConnectedSubchannel : public RefCounted<ConnectedSubchannel> {
   void StartWatch(grpc_pollset_set* interested_parties,
                   OrphanablePtr<ConnectivityStateWatcherInterface> watcher);
 
+  // Sets (or, with a null fn, clears) the transport's stream-saturation
+  // callback.  If on_consumed is non-null, it is scheduled once the
+  // transport has processed the change.
+  void SetStreamsSaturatedCallback(void (*fn)(void* user_data),
+                                   void* user_data,
+                                   grpc_closure* on_consumed = nullptr);
+
   void Ping(grpc_closure* on_initiate, grpc_closure* on_ack);
 
   grpc_channel_stack* channel_stack() const { return channel_stack_; }
@@ -261,9 +269,18 @@ class Subchannel : public DualRefCounted<Subchannel> {
       const absl::optional<std::string>& health_check_service_name,
       ConnectivityStateWatcherInterface* watcher) ABSL_LOCKS_EXCLUDED(mu_);
 
+  // Returns a connection for a new call.  When the subchannel maintains
+  // multiple parallel connections, calls are spread across them
+  // round-robin.
   RefCountedPtr<ConnectedSubchannel> connected_subchannel()
       ABSL_LOCKS_EXCLUDED(mu_) {
     MutexLock lock(&mu_);
+    if (!extra_connected_subchannels_.empty() &&
+        connected_subchannel_ != nullptr) {
+      const size_t index = next_connection_index_++ %
+                           (1 + extra_connected_subchannels_.size());
+      if (index > 0) return extra_connected_subchannels_[index - 1];
+    }
     return connected_subchannel_;
   }
 
@@ -372,7 +389,16 @@ class Subchannel : public DualRefCounted<Subchannel> {
       ABSL_LOCKS_EXCLUDED(mu_);
   void OnConnectingFinishedLocked(grpc_error_handle error)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
-  bool PublishTransportLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  bool PublishTransportLocked(bool for_extra_connection = false)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  // Methods for maintaining extra parallel connections when the peer's
+  // MAX_CONCURRENT_STREAMS limit saturates the existing ones.
+  static void OnStreamsSaturated(void* arg);
+  void MaybeStartExtraConnectionLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void RegisterSaturationCallbackLocked(ConnectedSubchannel* connection)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void UnregisterSaturationCallback(ConnectedSubchannel* connection);
 
   // The subchannel pool this subchannel is in.
   RefCountedPtr<SubchannelPoolInterface> subchannel_pool_;
@@ -389,6 +415,11 @@ class Subchannel : public DualRefCounted<Subchannel> {
   RefCountedPtr<channelz::SubchannelNode> channelz_node_;
   // Minimum connection timeout.
   Duration min_connect_timeout_;
+  // Whether a graceful GOAWAY triggers an immediate replacement
+  // connection attempt.
+  bool proactive_reconnect_on_goaway_ = true;
+  // Maximum number of parallel connections to the backend.
+  size_t max_connections_ = 1;
 
   // Connection state.
   OrphanablePtr<SubchannelConnector> connector_;
@@ -416,6 +447,15 @@ class Subchannel : public DualRefCounted<Subchannel> {
 
   // Active connection, or null.
   RefCountedPtr<ConnectedSubchannel> connected_subchannel_ ABSL_GUARDED_BY(mu_);
+  // Extra parallel connections beyond connected_subchannel_, created in
+  // response to stream-saturation signals from the transport.  Non-empty
+  // only when GRPC_ARG_MAX_CONNECTIONS_PER_SUBCHANNEL > 1.
+  std::vector<RefCountedPtr<ConnectedSubchannel>> extra_connected_subchannels_
+      ABSL_GUARDED_BY(mu_);
+  // Round-robin counter for spreading calls across connections.
+  size_t next_connection_index_ ABSL_GUARDED_BY(mu_) = 0;
+  // Whether an extra connection attempt is in flight.
+  bool extra_connection_in_progress_ ABSL_GUARDED_BY(mu_) = false;
 
   // Backoff state.
   BackOff backoff_ ABSL_GUARDED_BY(mu_);
@@ -18,6 +18,7 @@
 
 #include "src/core/ext/filters/deadline/deadline_filter.h"
 
+#include <map>
 #include <new>
 
 #include "absl/status/status.h"
@@ -26,11 +27,13 @@
 #include <grpc/impl/codegen/grpc_types.h>
 #include <grpc/status.h>
 #include <grpc/support/log.h>
+#include <grpc/support/sync.h>
 
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_stack_builder.h"
 #include "src/core/lib/config/core_configuration.h"
 #include "src/core/lib/gprpp/debug_location.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/timer.h"
@@ -40,6 +43,54 @@
 
 namespace grpc_core {
 
+class TimerState;
+
+namespace {
+
+// Deadlines are rounded up to multiples of this quantum, and all calls
+// whose rounded deadlines coincide share a single timer.  Most workloads
+// start many calls per quantum with identical timeouts, so this replaces
+// one timer_init/timer_cancel pair per call with one per bucket, at the
+// cost of firing deadlines up to the quantum late.
+constexpr Duration kDeadlineQuantum = Duration::Milliseconds(10);
+
+// Calls registered against the same quantized deadline.  Created when the
+// first call arrives for a given quantum and deleted when the last
+// reference drops: the timer callback (guaranteed to run exactly once,
+// with CancelledError if the last call left the bucket early) holds one
+// ref, and a last-out canceller pins a second across its timer_cancel.
+struct DeadlineBucket {
+  int64_t key;  // Quantized deadline, in millis after process epoch.
+  grpc_timer timer;
+  grpc_closure closure;
+  // Head of an intrusive doubly-linked list of TimerState, guarded by the
+  // owning shard's mutex.
+  TimerState* head = nullptr;
+  // One ref is held on behalf of the pending timer callback; a last-out
+  // canceller takes a second before dropping the shard lock, so the bucket
+  // (and its grpc_timer) outlive a grpc_timer_cancel that races with the
+  // timer firing.
+  gpr_refcount refs;
+};
+
+// Buckets are sharded by quantum so that calls with different deadlines do
+// not contend on one mutex; calls in the same bucket share a shard by
+// design, since they must serialize on the bucket's list anyway.
+struct BucketShard {
+  Mutex mu;
+  std::map<int64_t, DeadlineBucket*> buckets ABSL_GUARDED_BY(mu);
+};
+
+constexpr size_t kNumBucketShards = 16;
+
+BucketShard* GetBucketShard(int64_t key) {
+  static BucketShard* shards = new BucketShard[kNumBucketShards];
+  return &shards[static_cast<uint64_t>(key / kDeadlineQuantum.millis()) %
+                 kNumBucketShards];
+}
+
+}  // namespace
+
 // A fire-and-forget class representing a pending deadline timer.
 // Allocated on the call arena.
 class TimerState {
@@ -48,13 +99,98 @@ class TimerState {
     grpc_deadline_state* deadline_state =
         static_cast<grpc_deadline_state*>(elem_->call_data);
     GRPC_CALL_STACK_REF(deadline_state->call_stack, "DeadlineTimerState");
-    GRPC_CLOSURE_INIT(&closure_, TimerCallback, this, nullptr);
-    grpc_timer_init(&timer_, deadline, &closure_);
+    // Round the deadline up to the next quantum boundary, so we never fire
+    // early, and join (or create) that quantum's bucket.
+    const int64_t key =
+        ((static_cast<int64_t>(deadline.milliseconds_after_process_epoch()) +
+          kDeadlineQuantum.millis() - 1) /
+         kDeadlineQuantum.millis()) *
+        kDeadlineQuantum.millis();
+    shard_ = GetBucketShard(key);
+    MutexLock lock(&shard_->mu);
+    auto it = shard_->buckets.find(key);
+    if (it == shard_->buckets.end()) {
+      DeadlineBucket* new_bucket = new DeadlineBucket();
+      new_bucket->key = key;
+      gpr_ref_init(&new_bucket->refs, 1);
+      GRPC_CLOSURE_INIT(&new_bucket->closure, BucketTimerCallback, new_bucket,
+                        nullptr);
+      it = shard_->buckets.emplace(key, new_bucket).first;
+      grpc_timer_init(&new_bucket->timer,
+                      Timestamp::FromMillisecondsAfterProcessEpoch(key),
+                      &new_bucket->closure);
+    }
+    bucket_ = it->second;
+    next_ = bucket_->head;
+    if (next_ != nullptr) next_->prev_ = this;
+    bucket_->head = this;
   }
 
-  void Cancel() { grpc_timer_cancel(&timer_); }
+  // Called when the call completes before its deadline.  If the bucket's
+  // timer has not yet claimed this entry, unlinks it; cancelling the shared
+  // timer itself only happens when the bucket empties.
+  void Cancel() {
+    bool last_out = false;
+    DeadlineBucket* bucket;
+    {
+      MutexLock lock(&shard_->mu);
+      bucket = bucket_;
+      if (bucket == nullptr) return;  // Timer callback already claimed us.
+      bucket_ = nullptr;
+      if (prev_ != nullptr) prev_->next_ = next_;
+      if (next_ != nullptr) next_->prev_ = prev_;
+      if (bucket->head == this) bucket->head = next_;
+      if (bucket->head == nullptr) {
+        // Remove the bucket from the map before cancelling its timer, so a
+        // call arriving for the same quantum starts a fresh bucket instead
+        // of joining one whose timer will never fire.
+        shard_->buckets.erase(bucket->key);
+        // Keep the bucket alive across the grpc_timer_cancel below: the
+        // timer may fire concurrently, and its callback drops the ref it
+        // holds (deleting the bucket if we did not pin it here).
+        gpr_ref(&bucket->refs);
+        last_out = true;
+      }
+    }
+    // The call stack unref may destroy the call, which re-enters Cancel()
+    // via the filter's destructor, so it must happen outside the lock.
+    grpc_deadline_state* deadline_state =
+        static_cast<grpc_deadline_state*>(elem_->call_data);
+    GRPC_CALL_STACK_UNREF(deadline_state->call_stack, "DeadlineTimerState");
+    if (last_out) {
+      grpc_timer_cancel(&bucket->timer);
+      if (gpr_unref(&bucket->refs)) delete bucket;
+    }
+  }
+
+  // Shared timer callback for a bucket: detaches the bucket's list under
+  // the shard lock, then fires the deadline for each call still registered.
+  static void BucketTimerCallback(void* arg, grpc_error_handle error) {
+    DeadlineBucket* bucket = static_cast<DeadlineBucket*>(arg);
+    BucketShard* shard = GetBucketShard(bucket->key);
+    TimerState* entries;
+    {
+      MutexLock lock(&shard->mu);
+      entries = bucket->head;
+      bucket->head = nullptr;
+      for (TimerState* s = entries; s != nullptr; s = s->next_) {
+        s->bucket_ = nullptr;
+      }
+      auto it = shard->buckets.find(bucket->key);
+      if (it != shard->buckets.end() && it->second == bucket) {
+        shard->buckets.erase(it);
+      }
+    }
+    while (entries != nullptr) {
+      TimerState* next = entries->next_;
+      TimerCallback(entries, error);
+      entries = next;
+    }
+    if (gpr_unref(&bucket->refs)) delete bucket;
+  }
 
  private:
+
   // The on_complete callback used when sending a cancel_error batch down the
   // filter stack.  Yields the call combiner when the batch returns.
   static void YieldCallCombiner(void* arg, grpc_error_handle /*ignored*/) {
@@ -105,8 +241,14 @@ class TimerState {
   // finishes and (b) the filter sees the call completion and attempts
   // to cancel the timer.
   grpc_call_element* elem_;
-  grpc_timer timer_;
   grpc_closure closure_;
+  // Links in the owning bucket's list, guarded by shard_->mu.  bucket_ is
+  // nulled once this entry has been claimed, by either Cancel() or the
+  // bucket's timer callback, whichever gets there first.
+  BucketShard* shard_;
+  DeadlineBucket* bucket_ = nullptr;
+  TimerState* prev_ = nullptr;
+  TimerState* next_ = nullptr;
 };
 
 }  // namespace grpc_core
@@ -144,7 +144,16 @@ FaultInjectionFilter::FaultInjectionFilter(ChannelFilter::Args filter_args)
 // Construct a promise for one call.
 ArenaPromise<ServerMetadataHandle> FaultInjectionFilter::MakeCallPromise(
     CallArgs call_args, NextPromiseFactory next_promise_factory) {
-  auto decision = MakeInjectionDecision(call_args.client_initial_metadata);
+  auto* fi_policy = ResolvePolicy();
+  // Fast path: no policy is configured for this method, or the policy can
+  // never inject anything (typical when the filter is installed fleet-wide
+  // by xDS but faults are enabled on a handful of routes). The call passes
+  // straight through with no decision, no lock and no Sleep node.
+  if (fi_policy == nullptr || fi_policy->IsNoOp()) {
+    return next_promise_factory(std::move(call_args));
+  }
+  auto decision =
+      MakeInjectionDecision(fi_policy, call_args.client_initial_metadata);
   if (GRPC_TRACE_FLAG_ENABLED(grpc_fault_injection_filter_trace)) {
     gpr_log(GPR_INFO, "chand=%p: Fault injection triggered %s", this,
             decision.ToString().c_str());
@@ -156,24 +165,26 @@ ArenaPromise<ServerMetadataHandle> FaultInjectionFilter::MakeCallPromise(
       next_promise_factory(std::move(call_args)));
 }
 
-FaultInjectionFilter::InjectionDecision
-FaultInjectionFilter::MakeInjectionDecision(
-    const ClientMetadataHandle& initial_metadata) {
+const FaultInjectionMethodParsedConfig::FaultInjectionPolicy*
+FaultInjectionFilter::ResolvePolicy() {
   // Fetch the fault injection policy from the service config, based on the
-  // relative index for which policy should this CallData use.
+  // relative index for which policy should this call use.
   auto* service_config_call_data = static_cast<ServiceConfigCallData*>(
       GetContext<
           grpc_call_context_element>()[GRPC_CONTEXT_SERVICE_CONFIG_CALL_DATA]
           .value);
+  if (service_config_call_data == nullptr) return nullptr;
   auto* method_params = static_cast<FaultInjectionMethodParsedConfig*>(
       service_config_call_data->GetMethodParsedConfig(
           service_config_parser_index_));
-  const FaultInjectionMethodParsedConfig::FaultInjectionPolicy* fi_policy =
-      nullptr;
-  if (method_params != nullptr) {
-    fi_policy = method_params->fault_injection_policy(index_);
-  }
+  if (method_params == nullptr) return nullptr;
+  return method_params->fault_injection_policy(index_);
+}
 
+FaultInjectionFilter::InjectionDecision
+FaultInjectionFilter::MakeInjectionDecision(
+    const FaultInjectionMethodParsedConfig::FaultInjectionPolicy* fi_policy,
+    const ClientMetadataHandle& initial_metadata) {
   grpc_status_code abort_code = fi_policy->abort_code;
   uint32_t abort_percentage_numerator = fi_policy->abort_percentage_numerator;
   uint32_t delay_percentage_numerator = fi_policy->delay_percentage_numerator;
@@ -27,6 +27,7 @@
 #include "absl/random/random.h"
 #include "absl/status/statusor.h"
 
+#include "src/core/ext/filters/fault_injection/service_config_parser.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_fwd.h"
 #include "src/core/lib/channel/promise_based_filter.h"
@@ -59,8 +60,13 @@ class FaultInjectionFilter : public ChannelFilter {
  private:
   explicit FaultInjectionFilter(ChannelFilter::Args filter_args);
 
+  // Returns the fault injection policy configured for this call, or nullptr
+  // if there is none.
+  const FaultInjectionMethodParsedConfig::FaultInjectionPolicy* ResolvePolicy();
+
   class InjectionDecision;
   InjectionDecision MakeInjectionDecision(
+      const FaultInjectionMethodParsedConfig::FaultInjectionPolicy* fi_policy,
       const ClientMetadataHandle& initial_metadata);
 
   // The relative index of instances of the same filter.
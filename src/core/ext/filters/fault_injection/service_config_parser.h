@@ -60,6 +60,17 @@ class FaultInjectionMethodParsedConfig
 
     // By default, the max allowed active faults are unlimited.
     uint32_t max_faults = std::numeric_limits<uint32_t>::max();
+
+    // Returns true if this policy can never inject a fault: no abort or
+    // delay is configured statically, and neither can be enabled through
+    // request headers. Such policies are skipped entirely on the call path.
+    bool IsNoOp() const {
+      const bool abort_possible =
+          abort_code != GRPC_STATUS_OK || !abort_code_header.empty();
+      const bool delay_possible =
+          delay != Duration::Zero() || !delay_header.empty();
+      return !abort_possible && !delay_possible;
+    }
   };
 
   explicit FaultInjectionMethodParsedConfig(
@@ -30,8 +30,10 @@
 
 #include <grpc/impl/codegen/grpc_types.h>
 
+#include "src/core/ext/filters/http/client/http_client_filter.h"
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/channel_stack_builder.h"
+#include "src/core/lib/channel/promise_based_filter.h"
 #include "src/core/lib/config/core_configuration.h"
 #include "src/core/lib/surface/channel_init.h"
 #include "src/core/lib/surface/channel_stack_type.h"
@@ -70,6 +72,16 @@ const grpc_channel_filter ClientAuthorityFilter::kFilter =
         "authority");
 
 namespace {
+
+// Statically composed form of the [authority, http-client] run that client
+// stacks produce: channel data layout and promise composition are fixed at
+// compile time, avoiding the dynamic composite's per-child indirection.
+const grpc_channel_filter kClientAuthorityHttpClientFilter =
+    MakePromiseBasedFilter<
+        StaticFusedFilter<ClientAuthorityFilter, HttpClientFilter>,
+        FilterEndpoint::kClient, kFilterExaminesServerInitialMetadata>(
+        "authority+http-client");
+
 bool add_client_authority_filter(ChannelStackBuilder* builder) {
   if (builder->channel_args()
           .GetBool(GRPC_ARG_DISABLE_CLIENT_AUTHORITY_FILTER)
@@ -86,6 +98,13 @@ void RegisterClientAuthorityFilter(CoreConfiguration::Builder* builder) {
                                          add_client_authority_filter);
   builder->channel_init()->RegisterStage(GRPC_CLIENT_DIRECT_CHANNEL, INT_MAX,
                                          add_client_authority_filter);
+  // Metadata-only, so eligible for fusion with adjacent fusable filters (see
+  // GRPC_ARG_ENABLE_FILTER_FUSION).
+  builder->channel_init()->RegisterFusableFilter(&ClientAuthorityFilter::kFilter,
+                                                 0);
+  builder->channel_init()->RegisterFusedFilterSpecialization(
+      {&ClientAuthorityFilter::kFilter, &HttpClientFilter::kFilter},
+      &kClientAuthorityHttpClientFilter);
 }
 
 }  // namespace grpc_core
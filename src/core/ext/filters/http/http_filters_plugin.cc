@@ -31,6 +31,7 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_fwd.h"
 #include "src/core/lib/channel/channel_stack_builder.h"
+#include "src/core/lib/channel/promise_based_filter.h"
 #include "src/core/lib/config/core_configuration.h"
 #include "src/core/lib/surface/channel_init.h"
 #include "src/core/lib/surface/channel_stack_type.h"
@@ -93,5 +94,11 @@ void RegisterHttpFilters(CoreConfiguration::Builder* builder) {
   required(GRPC_CLIENT_SUBCHANNEL, &HttpClientFilter::kFilter);
   required(GRPC_CLIENT_DIRECT_CHANNEL, &HttpClientFilter::kFilter);
   required(GRPC_SERVER_CHANNEL, &HttpServerFilter::kFilter);
+  // Both filters touch metadata only, so adjacent instances may be fused into
+  // a composite filter (see GRPC_ARG_ENABLE_FILTER_FUSION).
+  builder->channel_init()->RegisterFusableFilter(
+      &HttpClientFilter::kFilter, kFilterExaminesServerInitialMetadata);
+  builder->channel_init()->RegisterFusableFilter(
+      &HttpServerFilter::kFilter, kFilterExaminesServerInitialMetadata);
 }
 }  // namespace grpc_core
@@ -21,13 +21,17 @@
 #include "src/core/ext/filters/http/message_compress/message_compress_filter.h"
 
 #include <inttypes.h>
+#include <limits.h>
 #include <stdlib.h>
 
+#include <map>
 #include <new>
+#include <string>
 #include <utility>
 
 #include "absl/meta/type_traits.h"
 #include "absl/status/status.h"
+#include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 
 #include <grpc/compression.h>
@@ -35,12 +39,16 @@
 #include <grpc/impl/codegen/grpc_types.h>
 #include <grpc/support/log.h>
 
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/compression/compression_internal.h"
 #include "src/core/lib/compression/message_compress.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/call_combiner.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/surface/call.h"
 #include "src/core/lib/transport/metadata_batch.h"
@@ -48,6 +56,62 @@
 
 namespace {
 
+// Tracks, per (method, size-bucket), how often compression actually shrank
+// the payload. Methods whose payloads historically do not shrink (e.g.
+// already-compressed media) are sent uncompressed, with an occasional probe
+// so the decision can revert if the traffic mix changes.
+class CompressionStats {
+ public:
+  // Returns true if compression should be skipped for a payload of 'length'
+  // bytes on 'path', based on past outcomes on this channel.
+  bool ShouldBypass(absl::string_view path, size_t length) {
+    grpc_core::MutexLock lock(&mu_);
+    auto it = buckets_.find(Key(path, length));
+    if (it == buckets_.end()) return false;
+    Bucket& bucket = it->second;
+    if (bucket.attempts < kMinSamples) return false;
+    if (bucket.shrank * 4 >= bucket.attempts) return false;
+    // Attempt an occasional probe anyway so that a change in traffic can
+    // flip the decision back.
+    return ++bucket.bypassed % kProbeInterval != 0;
+  }
+
+  void RecordAttempt(absl::string_view path, size_t length, bool shrank) {
+    grpc_core::MutexLock lock(&mu_);
+    Bucket& bucket = buckets_[Key(path, length)];
+    ++bucket.attempts;
+    if (shrank) ++bucket.shrank;
+  }
+
+ private:
+  struct Bucket {
+    uint32_t attempts = 0;
+    uint32_t shrank = 0;
+    uint32_t bypassed = 0;
+  };
+
+  // Minimum attempts in a bucket before bypassing is considered.
+  static constexpr uint32_t kMinSamples = 8;
+  // While bypassing, every kProbeInterval-th payload is still compressed.
+  static constexpr uint32_t kProbeInterval = 64;
+
+  // Sizes are bucketed by power of two: a payload that does not shrink at
+  // 100KB says little about the 1KB payloads on the same method.
+  static std::pair<std::string, size_t> Key(absl::string_view path,
+                                            size_t length) {
+    size_t bucket = 0;
+    while (length > 1) {
+      length >>= 1;
+      ++bucket;
+    }
+    return {std::string(path), bucket};
+  }
+
+  grpc_core::Mutex mu_;
+  std::map<std::pair<std::string, size_t>, Bucket> buckets_
+      ABSL_GUARDED_BY(mu_);
+};
+
 class ChannelData {
  public:
   explicit ChannelData(grpc_channel_element_args* args) {
@@ -71,6 +135,24 @@ class ChannelData {
               name);
       default_compression_algorithm_ = GRPC_COMPRESS_NONE;
     }
+    // Optional pre-shared dictionary to prime message compression with.
+    dictionary_id_ = static_cast<uint32_t>(grpc_channel_args_find_integer(
+        args->channel_args, GRPC_COMPRESSION_CHANNEL_DICTIONARY_ID,
+        grpc_integer_options{0, 0, INT_MAX}));
+    if (dictionary_id_ != 0 &&
+        (!grpc_core::CompressionAlgorithmSupportsDictionary(
+             default_compression_algorithm_) ||
+         !grpc_core::LookupCompressionDictionary(dictionary_id_)
+              .has_value())) {
+      gpr_log(GPR_ERROR,
+              "compression dictionary %u not registered or not supported by "
+              "the default algorithm: disabling dictionary compression",
+              dictionary_id_);
+      dictionary_id_ = 0;
+    }
+    offload_threshold_ = grpc_channel_args_find_integer(
+        args->channel_args, GRPC_ARG_COMPRESSION_OFFLOAD_THRESHOLD,
+        grpc_integer_options{-1, -1, INT_MAX});
     GPR_ASSERT(!args->is_last);
   }
 
@@ -82,11 +164,24 @@ class ChannelData {
     return enabled_compression_algorithms_;
   }
 
+  uint32_t dictionary_id() const { return dictionary_id_; }
+
+  int offload_threshold() const { return offload_threshold_; }
+
+  CompressionStats* compression_stats() { return &compression_stats_; }
+
  private:
   /** The default, channel-level, compression algorithm */
   grpc_compression_algorithm default_compression_algorithm_;
   /** Enabled compression algorithms */
   grpc_core::CompressionAlgorithmSet enabled_compression_algorithms_;
+  /** Id of the pre-shared compression dictionary (0 for none) */
+  uint32_t dictionary_id_ = 0;
+  /** Payload size (bytes) at or above which compression runs on an
+      EventEngine thread instead of inline; -1 disables offloading */
+  int offload_threshold_ = -1;
+  /** Per-(method, size-bucket) outcomes driving the adaptive bypass */
+  CompressionStats compression_stats_;
 };
 
 class CallData {
@@ -102,9 +197,15 @@ class CallData {
     }
     GRPC_CLOSURE_INIT(&forward_send_message_batch_in_call_combiner_,
                       ForwardSendMessageBatch, elem, grpc_schedule_on_exec_ctx);
+    GRPC_CLOSURE_INIT(&forward_compressed_batch_in_call_combiner_,
+                      ForwardCompressedSendMessageBatch, elem,
+                      grpc_schedule_on_exec_ctx);
   }
 
-  ~CallData() { GRPC_ERROR_UNREF(cancel_error_); }
+  ~CallData() {
+    grpc_msg_compress_context_destroy(compression_ctx_);
+    GRPC_ERROR_UNREF(cancel_error_);
+  }
 
   void CompressStartTransportStreamOpBatch(
       grpc_call_element* elem, grpc_transport_stream_op_batch* batch);
@@ -112,6 +213,7 @@ class CallData {
  private:
   bool SkipMessageCompression();
   void FinishSendMessage(grpc_call_element* elem);
+  void CompressPayload(grpc_call_element* elem);
 
   void ProcessSendInitialMetadata(grpc_call_element* elem,
                                   grpc_metadata_batch* initial_metadata);
@@ -120,13 +222,23 @@ class CallData {
   static void FailSendMessageBatchInCallCombiner(void* calld_arg,
                                                  grpc_error_handle error);
   static void ForwardSendMessageBatch(void* elem_arg, grpc_error_handle unused);
+  static void ForwardCompressedSendMessageBatch(void* elem_arg,
+                                                grpc_error_handle unused);
 
   grpc_core::CallCombiner* call_combiner_;
   grpc_compression_algorithm compression_algorithm_ = GRPC_COMPRESS_NONE;
+  // Reusable codec state, created on the first compressed message: streams
+  // with many messages pay codec setup once instead of once per message.
+  grpc_msg_compress_context* compression_ctx_ = nullptr;
+  // Id of the pre-shared dictionary advertised for this call (0 for none).
+  uint32_t dictionary_id_ = 0;
+  // The call's method, for the adaptive bypass statistics.
+  std::string path_;
   grpc_error_handle cancel_error_;
   grpc_transport_stream_op_batch* send_message_batch_ = nullptr;
   bool seen_initial_metadata_ = false;
   grpc_closure forward_send_message_batch_in_call_combiner_;
+  grpc_closure forward_compressed_batch_in_call_combiner_;
 };
 
 // Returns true if we should skip message compression for the current message.
@@ -145,6 +257,11 @@ bool CallData::SkipMessageCompression() {
 void CallData::ProcessSendInitialMetadata(
     grpc_call_element* elem, grpc_metadata_batch* initial_metadata) {
   ChannelData* channeld = static_cast<ChannelData*>(elem->channel_data);
+  // Remember the method: the adaptive bypass keeps its statistics per
+  // (method, size-bucket).
+  const grpc_core::Slice* path =
+      initial_metadata->get_pointer(grpc_core::HttpPathMetadata());
+  if (path != nullptr) path_ = std::string(path->as_string_view());
   // Find the compression algorithm.
   compression_algorithm_ =
       initial_metadata->Take(grpc_core::GrpcInternalEncodingRequest())
@@ -154,54 +271,108 @@ void CallData::ProcessSendInitialMetadata(
       break;
     case GRPC_COMPRESS_DEFLATE:
     case GRPC_COMPRESS_GZIP:
+    case GRPC_COMPRESS_ZSTD:
       initial_metadata->Set(grpc_core::GrpcEncodingMetadata(),
                             compression_algorithm_);
       break;
     case GRPC_COMPRESS_ALGORITHMS_COUNT:
       abort();
   }
+  // Advertise the pre-shared dictionary the payloads will be primed with, so
+  // the peer can prime its decompressor before the first message arrives.
+  if (channeld->dictionary_id() != 0 &&
+      grpc_core::CompressionAlgorithmSupportsDictionary(
+          compression_algorithm_)) {
+    dictionary_id_ = channeld->dictionary_id();
+    initial_metadata->Set(grpc_core::GrpcCompressionDictionaryMetadata(),
+                          dictionary_id_);
+  }
   // Convey supported compression algorithms.
   initial_metadata->Set(grpc_core::GrpcAcceptEncodingMetadata(),
                         channeld->enabled_compression_algorithms());
 }
 
+void CallData::CompressPayload(grpc_call_element* elem) {
+  ChannelData* channeld = static_cast<ChannelData*>(elem->channel_data);
+  grpc_core::SliceBuffer tmp;
+  uint32_t& send_flags = send_message_batch_->payload->send_message.flags;
+  grpc_core::SliceBuffer* payload =
+      send_message_batch_->payload->send_message.send_message;
+  const size_t before_size = payload->Length();
+  if (compression_ctx_ == nullptr) {
+    compression_ctx_ = grpc_msg_compress_context_create(compression_algorithm_);
+    if (dictionary_id_ != 0) {
+      absl::optional<absl::string_view> dict =
+          grpc_core::LookupCompressionDictionary(dictionary_id_);
+      GPR_ASSERT(dict.has_value());
+      GPR_ASSERT(grpc_msg_compress_context_set_dictionary(
+          compression_ctx_,
+          grpc_slice_from_static_buffer(dict->data(), dict->size())));
+    }
+  }
+  bool did_compress = grpc_msg_compress_with_context(
+      compression_ctx_, payload->c_slice_buffer(), tmp.c_slice_buffer());
+  channeld->compression_stats()->RecordAttempt(path_, before_size,
+                                               did_compress);
+  if (did_compress) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_compression_trace)) {
+      const char* algo_name;
+      const size_t after_size = tmp.Length();
+      const float savings_ratio = 1.0f - static_cast<float>(after_size) /
+                                             static_cast<float>(before_size);
+      GPR_ASSERT(
+          grpc_compression_algorithm_name(compression_algorithm_, &algo_name));
+      gpr_log(GPR_INFO,
+              "Compressed[%s] %" PRIuPTR " bytes vs. %" PRIuPTR
+              " bytes (%.2f%% savings)",
+              algo_name, before_size, after_size, 100 * savings_ratio);
+    }
+    tmp.Swap(payload);
+    send_flags |= GRPC_WRITE_INTERNAL_COMPRESS;
+  } else {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_compression_trace)) {
+      const char* algo_name;
+      GPR_ASSERT(
+          grpc_compression_algorithm_name(compression_algorithm_, &algo_name));
+      gpr_log(GPR_INFO,
+              "Algorithm '%s' enabled but decided not to compress. Input size: "
+              "%" PRIuPTR,
+              algo_name, payload->Length());
+    }
+  }
+}
+
 void CallData::FinishSendMessage(grpc_call_element* elem) {
   // Compress the data if appropriate.
   if (!SkipMessageCompression()) {
-    grpc_core::SliceBuffer tmp;
-    uint32_t& send_flags = send_message_batch_->payload->send_message.flags;
-    grpc_core::SliceBuffer* payload =
-        send_message_batch_->payload->send_message.send_message;
-    bool did_compress =
-        grpc_msg_compress(compression_algorithm_, payload->c_slice_buffer(),
-                          tmp.c_slice_buffer());
-    if (did_compress) {
-      if (GRPC_TRACE_FLAG_ENABLED(grpc_compression_trace)) {
-        const char* algo_name;
-        const size_t before_size = payload->Length();
-        const size_t after_size = tmp.Length();
-        const float savings_ratio = 1.0f - static_cast<float>(after_size) /
-                                               static_cast<float>(before_size);
-        GPR_ASSERT(grpc_compression_algorithm_name(compression_algorithm_,
-                                                   &algo_name));
-        gpr_log(GPR_INFO,
-                "Compressed[%s] %" PRIuPTR " bytes vs. %" PRIuPTR
-                " bytes (%.2f%% savings)",
-                algo_name, before_size, after_size, 100 * savings_ratio);
-      }
-      tmp.Swap(payload);
-      send_flags |= GRPC_WRITE_INTERNAL_COMPRESS;
-    } else {
-      if (GRPC_TRACE_FLAG_ENABLED(grpc_compression_trace)) {
-        const char* algo_name;
-        GPR_ASSERT(grpc_compression_algorithm_name(compression_algorithm_,
-                                                   &algo_name));
-        gpr_log(
-            GPR_INFO,
-            "Algorithm '%s' enabled but decided not to compress. Input size: "
-            "%" PRIuPTR,
-            algo_name, payload->Length());
+    ChannelData* channeld = static_cast<ChannelData*>(elem->channel_data);
+    const size_t length =
+        send_message_batch_->payload->send_message.send_message->Length();
+    // Skip payloads that historically have not shrunk for this method and
+    // size bucket, probing occasionally in case the data changes.
+    if (!channeld->compression_stats()->ShouldBypass(path_, length)) {
+      if (channeld->offload_threshold() >= 0 &&
+          length >= static_cast<size_t>(channeld->offload_threshold())) {
+        // Large payload: compress on an EventEngine thread instead of
+        // stalling the transport write path, then re-enter the call
+        // combiner to forward the batch.  The batch's on_complete has not
+        // yet run, so the call (and this filter's call data) stay alive
+        // until the closure below forwards it.
+        auto engine = grpc_event_engine::experimental::GetDefaultEventEngine();
+        engine->Run([this, elem, engine]() {
+          grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
+          grpc_core::ExecCtx exec_ctx;
+          CompressPayload(elem);
+          GRPC_CALL_COMBINER_START(call_combiner_,
+                                   &forward_compressed_batch_in_call_combiner_,
+                                   absl::OkStatus(),
+                                   "continuing after offloaded compression");
+        });
+        GRPC_CALL_COMBINER_STOP(call_combiner_,
+                                "offloading message compression");
+        return;
       }
+      CompressPayload(elem);
     }
   }
   grpc_call_next_op(elem, std::exchange(send_message_batch_, nullptr));
@@ -224,6 +395,13 @@ void CallData::ForwardSendMessageBatch(void* elem_arg,
   calld->FinishSendMessage(elem);
 }
 
+void CallData::ForwardCompressedSendMessageBatch(void* elem_arg,
+                                                 grpc_error_handle /*unused*/) {
+  grpc_call_element* elem = static_cast<grpc_call_element*>(elem_arg);
+  CallData* calld = static_cast<CallData*>(elem->call_data);
+  grpc_call_next_op(elem, std::exchange(calld->send_message_batch_, nullptr));
+}
+
 void CallData::CompressStartTransportStreamOpBatch(
     grpc_call_element* elem, grpc_transport_stream_op_batch* batch) {
   // Handle cancel_stream.
@@ -36,6 +36,7 @@
 
 #include "src/core/ext/filters/message_size/message_size_filter.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/compression/compression_internal.h"
 #include "src/core/lib/compression/message_compress.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/iomgr/call_combiner.h"
@@ -118,6 +119,9 @@ class CallData {
   bool seen_recv_message_ready_ = false;
   int max_recv_message_length_;
   grpc_compression_algorithm algorithm_ = GRPC_COMPRESS_NONE;
+  // Pre-shared dictionary the peer compressed against, if it advertised one
+  // we also have registered.
+  absl::optional<absl::string_view> dictionary_;
   absl::optional<SliceBuffer>* recv_message_ = nullptr;
   uint32_t* recv_message_flags_ = nullptr;
   grpc_closure on_recv_message_ready_;
@@ -135,6 +139,20 @@ void CallData::OnRecvInitialMetadataReady(void* arg, grpc_error_handle error) {
     calld->algorithm_ =
         calld->recv_initial_metadata_->get(GrpcEncodingMetadata())
             .value_or(GRPC_COMPRESS_NONE);
+    const uint32_t dictionary_id =
+        calld->recv_initial_metadata_
+            ->get(GrpcCompressionDictionaryMetadata())
+            .value_or(0);
+    if (dictionary_id != 0) {
+      calld->dictionary_ = LookupCompressionDictionary(dictionary_id);
+      if (!calld->dictionary_.has_value()) {
+        // Decompression of dictionary-primed messages will fail below; log
+        // the reason here where the id is still known.
+        gpr_log(GPR_ERROR,
+                "peer compressed against unregistered dictionary %u",
+                dictionary_id);
+      }
+    }
   }
   calld->MaybeResumeOnRecvMessageReady();
   calld->MaybeResumeOnRecvTrailingMetadataReady();
@@ -183,9 +201,20 @@ void CallData::OnRecvMessageReady(void* arg, grpc_error_handle error) {
         return calld->ContinueRecvMessageReadyCallback(calld->error_);
       }
       SliceBuffer decompressed_slices;
-      if (grpc_msg_decompress(calld->algorithm_,
-                              (*calld->recv_message_)->c_slice_buffer(),
-                              decompressed_slices.c_slice_buffer()) == 0) {
+      int decompressed;
+      if (calld->dictionary_.has_value()) {
+        decompressed = grpc_msg_decompress_with_dictionary(
+            calld->algorithm_,
+            grpc_slice_from_static_buffer(calld->dictionary_->data(),
+                                          calld->dictionary_->size()),
+            (*calld->recv_message_)->c_slice_buffer(),
+            decompressed_slices.c_slice_buffer());
+      } else {
+        decompressed = grpc_msg_decompress(
+            calld->algorithm_, (*calld->recv_message_)->c_slice_buffer(),
+            decompressed_slices.c_slice_buffer());
+      }
+      if (decompressed == 0) {
         GPR_DEBUG_ASSERT(calld->error_.ok());
         calld->error_ = GRPC_ERROR_CREATE_FROM_CPP_STRING(absl::StrCat(
             "Unexpected error decompressing data for algorithm with "
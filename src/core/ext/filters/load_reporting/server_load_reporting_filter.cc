@@ -25,9 +25,13 @@
 #include <stdlib.h>
 
 #include <functional>
+#include <map>
 #include <string>
+#include <tuple>
 #include <utility>
+#include <vector>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/container/inlined_vector.h"
 #include "absl/meta/type_traits.h"
 #include "absl/status/status.h"
@@ -53,6 +57,8 @@
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/channel_stack_builder.h"
 #include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/gprpp/per_cpu.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/resolved_address.h"
 #include "src/core/lib/iomgr/sockaddr.h"
 #include "src/core/lib/iomgr/socket_utils.h"
@@ -177,8 +183,156 @@ const char* GetStatusTagForStatus(grpc_status_code status) {
       return grpc::load_reporter::kCallStatusClientError;
   }
 }
+
+// Per-CPU accumulation of the filter's measurements. Each shard interns one
+// entry per (token, host, user_id) locality, so the hot path takes an
+// effectively uncontended CPU-local mutex and bumps a handful of integers
+// instead of walking the globally locked opencensus stats maps on every
+// call. FlushServerLoadReportingCounters() merges the shards back into the
+// registered measures when the load reporter snapshots a report. All of the
+// load reporter's views over these measures aggregate with Sum() — and the
+// other-call-metric views additionally with Count(), for which the raw
+// samples are kept unmerged — so deferring and merging the deltas does not
+// change any reported value.
+class PerCpuCallCounters {
+ public:
+  static PerCpuCallCounters* Get() {
+    static PerCpuCallCounters* counters = new PerCpuCallCounters;
+    return counters;
+  }
+
+  void AddStart(absl::string_view token, absl::string_view host,
+                absl::string_view user_id) {
+    Shard& shard = shards_.this_cpu();
+    MutexLock lock(&shard.mu);
+    ++shard.localities[LocalityKey{std::string(token), std::string(host),
+                                   std::string(user_id)}]
+          .start_count;
+  }
+
+  void AddEnd(absl::string_view token, absl::string_view host,
+              absl::string_view user_id, const char* status,
+              int64_t bytes_sent, int64_t bytes_received, int64_t latency_ms) {
+    Shard& shard = shards_.this_cpu();
+    MutexLock lock(&shard.mu);
+    LocalityDeltas& deltas =
+        shard.localities[LocalityKey{std::string(token), std::string(host),
+                                     std::string(user_id)}];
+    EndDeltas* end = nullptr;
+    for (EndDeltas& e : deltas.end) {
+      if (e.status == status) {
+        end = &e;
+        break;
+      }
+    }
+    if (end == nullptr) {
+      deltas.end.emplace_back();
+      deltas.end.back().status = status;
+      end = &deltas.end.back();
+    }
+    ++end->count;
+    end->bytes_sent += bytes_sent;
+    end->bytes_received += bytes_received;
+    end->latency_ms += latency_ms;
+  }
+
+  void AddOtherMetric(absl::string_view token, absl::string_view host,
+                      absl::string_view user_id, absl::string_view name,
+                      double value) {
+    Shard& shard = shards_.this_cpu();
+    MutexLock lock(&shard.mu);
+    shard
+        .localities[LocalityKey{std::string(token), std::string(host),
+                                std::string(user_id)}]
+        .other_metrics.push_back(OtherMetric{std::string(name), value});
+  }
+
+  void Flush() {
+    for (Shard& shard : shards_) {
+      std::map<LocalityKey, LocalityDeltas> drained;
+      {
+        MutexLock lock(&shard.mu);
+        drained.swap(shard.localities);
+      }
+      for (const auto& entry : drained) {
+        const LocalityKey& key = entry.first;
+        const LocalityDeltas& deltas = entry.second;
+        if (deltas.start_count > 0) {
+          opencensus::stats::Record(
+              {{::grpc::load_reporter::MeasureStartCount(),
+                deltas.start_count}},
+              {{::grpc::load_reporter::TagKeyToken(), key.token},
+               {::grpc::load_reporter::TagKeyHost(), key.host},
+               {::grpc::load_reporter::TagKeyUserId(), key.user_id}});
+        }
+        for (const EndDeltas& end : deltas.end) {
+          opencensus::stats::Record(
+              {{::grpc::load_reporter::MeasureEndCount(), end.count},
+               {::grpc::load_reporter::MeasureEndBytesSent(), end.bytes_sent},
+               {::grpc::load_reporter::MeasureEndBytesReceived(),
+                end.bytes_received},
+               {::grpc::load_reporter::MeasureEndLatencyMs(), end.latency_ms}},
+              {{::grpc::load_reporter::TagKeyToken(), key.token},
+               {::grpc::load_reporter::TagKeyHost(), key.host},
+               {::grpc::load_reporter::TagKeyUserId(), key.user_id},
+               {::grpc::load_reporter::TagKeyStatus(), end.status}});
+        }
+        for (const OtherMetric& metric : deltas.other_metrics) {
+          opencensus::stats::Record(
+              {{::grpc::load_reporter::MeasureOtherCallMetric(), metric.value}},
+              {{::grpc::load_reporter::TagKeyToken(), key.token},
+               {::grpc::load_reporter::TagKeyHost(), key.host},
+               {::grpc::load_reporter::TagKeyUserId(), key.user_id},
+               {::grpc::load_reporter::TagKeyMetricName(), metric.name}});
+        }
+      }
+    }
+  }
+
+ private:
+  struct LocalityKey {
+    std::string token;
+    std::string host;
+    std::string user_id;
+    bool operator<(const LocalityKey& other) const {
+      return std::tie(token, host, user_id) <
+             std::tie(other.token, other.host, other.user_id);
+    }
+  };
+
+  struct EndDeltas {
+    // One of the kCallStatus* constants; compared by pointer.
+    const char* status = nullptr;
+    int64_t count = 0;
+    int64_t bytes_sent = 0;
+    int64_t bytes_received = 0;
+    int64_t latency_ms = 0;
+  };
+
+  struct OtherMetric {
+    std::string name;
+    double value;
+  };
+
+  struct LocalityDeltas {
+    int64_t start_count = 0;
+    // There are only three status tags, so a linear scan suffices.
+    absl::InlinedVector<EndDeltas, 3> end;
+    std::vector<OtherMetric> other_metrics;
+  };
+
+  struct Shard {
+    Mutex mu;
+    std::map<LocalityKey, LocalityDeltas> localities ABSL_GUARDED_BY(mu);
+  };
+
+  PerCpu<Shard> shards_;
+};
+
 }  // namespace
 
+void FlushServerLoadReportingCounters() { PerCpuCallCounters::Get()->Flush(); }
+
 ArenaPromise<ServerMetadataHandle> ServerLoadReportingFilter::MakeCallPromise(
     CallArgs call_args, NextPromiseFactory next_promise_factory) {
   // Gather up basic facts about the request
@@ -198,14 +352,8 @@ ArenaPromise<ServerMetadataHandle> ServerLoadReportingFilter::MakeCallPromise(
   client_ip_and_lr_token = MakeClientIpAndLrToken(
       lb_token.as_string_view(), call_args.client_initial_metadata);
   // Record the beginning of the request
-  opencensus::stats::Record(
-      {{::grpc::load_reporter::MeasureStartCount(), 1}},
-      {{::grpc::load_reporter::TagKeyToken(),
-        {client_ip_and_lr_token.data(), client_ip_and_lr_token.length()}},
-       {::grpc::load_reporter::TagKeyHost(),
-        {target_host.data(), target_host.length()}},
-       {::grpc::load_reporter::TagKeyUserId(),
-        {peer_identity_.data(), peer_identity_.length()}}});
+  PerCpuCallCounters::Get()->AddStart(client_ip_and_lr_token, target_host,
+                                      peer_identity_);
   // Returned promise runs the rest of the request, then reports costs and
   // records measurements
   return ArenaPromise<ServerMetadataHandle>(Seq(
@@ -216,17 +364,9 @@ ArenaPromise<ServerMetadataHandle> ServerLoadReportingFilter::MakeCallPromise(
        target_host](ServerMetadataHandle trailing_metadata) {
         const auto& costs = trailing_metadata->Take(LbCostBinMetadata());
         for (const auto& cost : costs) {
-          opencensus::stats::Record(
-              {{::grpc::load_reporter::MeasureOtherCallMetric(), cost.cost}},
-              {{::grpc::load_reporter::TagKeyToken(),
-                {client_ip_and_lr_token.data(),
-                 client_ip_and_lr_token.length()}},
-               {::grpc::load_reporter::TagKeyHost(),
-                {target_host.data(), target_host.length()}},
-               {::grpc::load_reporter::TagKeyUserId(),
-                {peer_identity_.data(), peer_identity_.length()}},
-               {::grpc::load_reporter::TagKeyMetricName(),
-                {cost.name.data(), cost.name.length()}}});
+          PerCpuCallCounters::Get()->AddOtherMetric(
+              client_ip_and_lr_token, target_host, peer_identity_, cost.name,
+              cost.cost);
         }
         GetContext<CallFinalization>()->Add([this, client_ip_and_lr_token,
                                              target_host](
@@ -235,23 +375,14 @@ ArenaPromise<ServerMetadataHandle> ServerLoadReportingFilter::MakeCallPromise(
           if (final_info == nullptr) return;
           // After the last bytes have been placed on the wire we record
           // final measurements
-          opencensus::stats::Record(
-              {{::grpc::load_reporter::MeasureEndCount(), 1},
-               {::grpc::load_reporter::MeasureEndBytesSent(),
-                final_info->stats.transport_stream_stats.outgoing.data_bytes},
-               {::grpc::load_reporter::MeasureEndBytesReceived(),
-                final_info->stats.transport_stream_stats.incoming.data_bytes},
-               {::grpc::load_reporter::MeasureEndLatencyMs(),
-                gpr_time_to_millis(final_info->stats.latency)}},
-              {{::grpc::load_reporter::TagKeyToken(),
-                {client_ip_and_lr_token.data(),
-                 client_ip_and_lr_token.length()}},
-               {::grpc::load_reporter::TagKeyHost(),
-                {target_host.data(), target_host.length()}},
-               {::grpc::load_reporter::TagKeyUserId(),
-                {peer_identity_.data(), peer_identity_.length()}},
-               {::grpc::load_reporter::TagKeyStatus(),
-                GetStatusTagForStatus(final_info->final_status)}});
+          PerCpuCallCounters::Get()->AddEnd(
+              client_ip_and_lr_token, target_host, peer_identity_,
+              GetStatusTagForStatus(final_info->final_status),
+              static_cast<int64_t>(
+                  final_info->stats.transport_stream_stats.outgoing.data_bytes),
+              static_cast<int64_t>(
+                  final_info->stats.transport_stream_stats.incoming.data_bytes),
+              gpr_time_to_millis(final_info->stats.latency));
         });
         return Immediate(std::move(trailing_metadata));
       }));
@@ -53,6 +53,12 @@ class ServerLoadReportingFilter : public ChannelFilter {
   std::string peer_identity_;
 };
 
+// Merges the per-CPU call counters accumulated by the server load reporting
+// filter into the registered opencensus measures. The load reporter calls
+// this when it takes a report snapshot; the filter's per-call recording only
+// touches CPU-local state in between.
+void FlushServerLoadReportingCounters();
+
 }  // namespace grpc_core
 
 #endif  // GRPC_CORE_EXT_FILTERS_LOAD_REPORTING_SERVER_LOAD_REPORTING_FILTER_H
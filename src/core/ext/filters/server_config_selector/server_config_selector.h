@@ -51,6 +51,11 @@ class ServerConfigSelector : public RefCounted<ServerConfigSelector> {
   ~ServerConfigSelector() override = default;
   // Returns the CallConfig to apply to a call based on the incoming \a metadata
   virtual CallConfig GetCallConfig(grpc_metadata_batch* metadata) = 0;
+  // Returns true if GetCallConfig() is a pure function of the :path and
+  // :authority metadata elements for this selector. When true, callers may
+  // memoize results keyed by those two values for as long as this selector
+  // remains the current one.
+  virtual bool RoutingDependsOnlyOnPathAndAuthority() const { return false; }
 };
 
 // ServerConfigSelectorProvider allows for subscribers to watch for updates on
@@ -17,12 +17,15 @@
 #include "src/core/ext/filters/server_config_selector/server_config_selector_filter.h"
 
 #include <functional>
+#include <map>
 #include <memory>
+#include <string>
 #include <utility>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
 #include "absl/types/optional.h"
 
 #include <grpc/support/log.h>
@@ -39,13 +42,19 @@
 #include "src/core/lib/promise/promise.h"
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/service_config/service_config_call_data.h"
+#include "src/core/lib/slice/slice.h"
 #include "src/core/lib/transport/call_fragments.h"
+#include "src/core/lib/transport/metadata_batch.h"
 #include "src/core/lib/transport/transport.h"
 
 namespace grpc_core {
 
 namespace {
 
+// Bounds the per-connection memoization of selector results so that a peer
+// sending many distinct methods cannot grow it without limit.
+constexpr size_t kMaxCallConfigCacheSize = 128;
+
 class ServerConfigSelectorFilter final : public ChannelFilter {
  public:
   ~ServerConfigSelectorFilter() override;
@@ -68,10 +77,22 @@ class ServerConfigSelectorFilter final : public ChannelFilter {
   }
 
  private:
+  // A successful selector result memoized for one authority/path pair.
+  struct CachedCallConfig {
+    const ServiceConfigParser::ParsedConfigVector* method_configs;
+    RefCountedPtr<ServiceConfig> service_config;
+  };
   struct State {
     Mutex mu;
     absl::optional<absl::StatusOr<RefCountedPtr<ServerConfigSelector>>>
         config_selector ABSL_GUARDED_BY(mu);
+    // Memoized results for selectors that declare their routing a pure
+    // function of :path and :authority; cleared whenever a new selector is
+    // installed. A server channel serves a single connection, so in steady
+    // state every call on the connection hits this map instead of re-running
+    // route matching.
+    std::map<std::string, CachedCallConfig> call_config_cache
+        ABSL_GUARDED_BY(mu);
   };
   class ServerConfigSelectorWatcher
       : public ServerConfigSelectorProvider::ServerConfigSelectorWatcher {
@@ -82,6 +103,7 @@ class ServerConfigSelectorFilter final : public ChannelFilter {
         absl::StatusOr<RefCountedPtr<ServerConfigSelector>> update) override {
       MutexLock lock(&state_->mu);
       state_->config_selector = std::move(update);
+      state_->call_config_cache.clear();
     }
 
    private:
@@ -131,23 +153,64 @@ ServerConfigSelectorFilter::~ServerConfigSelectorFilter() {
 
 ArenaPromise<ServerMetadataHandle> ServerConfigSelectorFilter::MakeCallPromise(
     CallArgs call_args, NextPromiseFactory next_promise_factory) {
-  auto sel = config_selector();
+  auto set_call_data = [](RefCountedPtr<ServiceConfig> service_config,
+                          const ServiceConfigParser::ParsedConfigVector*
+                              method_configs) {
+    auto& ctx = GetContext<
+        grpc_call_context_element>()[GRPC_CONTEXT_SERVICE_CONFIG_CALL_DATA];
+    ctx.value = GetContext<Arena>()->New<ServiceConfigCallData>(
+        std::move(service_config), method_configs,
+        ServiceConfigCallData::CallAttributes{});
+    ctx.destroy = [](void* p) {
+      static_cast<ServiceConfigCallData*>(p)->~ServiceConfigCallData();
+    };
+  };
+  auto* metadata = call_args.client_initial_metadata.get();
+  const Slice* path = metadata->get_pointer(HttpPathMetadata());
+  const Slice* authority = metadata->get_pointer(HttpAuthorityMetadata());
+  absl::optional<std::string> cache_key;
+  if (path != nullptr && authority != nullptr) {
+    // '\n' cannot appear in a legal header value, so the key is unambiguous.
+    cache_key = absl::StrCat(authority->as_string_view(), "\n",
+                             path->as_string_view());
+  }
+  absl::StatusOr<RefCountedPtr<ServerConfigSelector>> sel;
+  {
+    MutexLock lock(&state_->mu);
+    sel = state_->config_selector.value();
+    if (sel.ok() && cache_key.has_value()) {
+      auto it = state_->call_config_cache.find(*cache_key);
+      if (it != state_->call_config_cache.end()) {
+        set_call_data(it->second.service_config, it->second.method_configs);
+        return next_promise_factory(std::move(call_args));
+      }
+    }
+  }
   if (!sel.ok()) return Immediate(ServerMetadataHandle(sel.status()));
-  auto call_config =
-      sel.value()->GetCallConfig(call_args.client_initial_metadata.get());
+  auto call_config = sel.value()->GetCallConfig(metadata);
   if (!call_config.error.ok()) {
     auto r = Immediate(ServerMetadataHandle(
         absl::UnavailableError(grpc_error_std_string(call_config.error))));
     return std::move(r);
   }
-  auto& ctx = GetContext<
-      grpc_call_context_element>()[GRPC_CONTEXT_SERVICE_CONFIG_CALL_DATA];
-  ctx.value = GetContext<Arena>()->New<ServiceConfigCallData>(
-      std::move(call_config.service_config), call_config.method_configs,
-      ServiceConfigCallData::CallAttributes{});
-  ctx.destroy = [](void* p) {
-    static_cast<ServiceConfigCallData*>(p)->~ServiceConfigCallData();
-  };
+  if (cache_key.has_value() &&
+      sel.value()->RoutingDependsOnlyOnPathAndAuthority()) {
+    MutexLock lock(&state_->mu);
+    // Only populate the cache if the selector we routed with is still the
+    // current one; otherwise the watcher already cleared the map and this
+    // result belongs to a previous configuration generation.
+    if (state_->config_selector.has_value() &&
+        state_->config_selector->ok() &&
+        state_->config_selector->value() == sel.value() &&
+        state_->call_config_cache.size() < kMaxCallConfigCacheSize) {
+      state_->call_config_cache.emplace(
+          std::move(*cache_key),
+          CachedCallConfig{call_config.method_configs,
+                           call_config.service_config});
+    }
+  }
+  set_call_data(std::move(call_config.service_config),
+                call_config.method_configs);
   return next_promise_factory(std::move(call_args));
 }
 
@@ -359,6 +359,13 @@ grpc_channel* grpc_channel_create(const char* target,
     auto r = grpc_core::CreateChannel(target, args);
     if (r.ok()) {
       channel = r->release()->c_ptr();
+      // If requested, pre-pay the connection cost now: this kicks off name
+      // resolution, subchannel connection, and the security handshake
+      // exactly as the first RPC otherwise would. Callers can await the
+      // warmed state by watching for GRPC_CHANNEL_READY.
+      if (args.GetBool(GRPC_ARG_EAGER_CONNECT).value_or(false)) {
+        grpc_channel_check_connectivity_state(channel, /*try_to_connect=*/1);
+      }
     } else {
       error = absl_status_to_grpc_error(r.status());
     }
@@ -27,6 +27,11 @@
 
 #include "src/core/lib/slice/slice.h"
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define GRPC_BIN_DECODER_X86_DISPATCH 1
+#include <immintrin.h>
+#endif
+
 static uint8_t decode_table[] = {
     0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
     0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
@@ -79,6 +84,74 @@ static bool input_is_valid(const uint8_t* input_ptr, size_t length) {
 #define COMPOSE_OUTPUT_BYTE_2(input_ptr) \
   (uint8_t)((decode_table[(input_ptr)[2]] << 6) | decode_table[(input_ptr)[3]])
 
+#ifdef GRPC_BIN_DECODER_X86_DISPATCH
+
+/* Vectorized base64 decode: each iteration validates 32 input characters at
+   once and decodes them to 24 output bytes (the store writes 32 bytes, so 32
+   bytes of output headroom are required). Stops at the first block containing
+   any character outside the base64 alphabet — including '=' padding — and
+   leaves it to the scalar code, which reports errors and handles tails. */
+__attribute__((target("avx2"))) static void b64_decode_avx2(
+    struct grpc_base64_decode_context* ctx) {
+  const uint8_t* in = ctx->input_cur;
+  uint8_t* out = ctx->output_cur;
+  /* Validation nibble luts: a character is in the alphabet iff
+     lut_lo[c & 0xf] & lut_hi[c >> 4] == 0. */
+  const __m256i lut_lo = _mm256_setr_epi8(
+      0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A,
+      0x1B, 0x1B, 0x1B, 0x1A,  //
+      0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A,
+      0x1B, 0x1B, 0x1B, 0x1A);
+  const __m256i lut_hi = _mm256_setr_epi8(
+      0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10,
+      0x10, 0x10, 0x10, 0x10,  //
+      0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10,
+      0x10, 0x10, 0x10, 0x10);
+  /* Offset from an alphabet character to its 6-bit value, indexed by the
+     character's high nibble (with '/' singled out via the compare below). */
+  const __m256i lut_roll = _mm256_setr_epi8(
+      0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,  //
+      0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+  while (ctx->input_end - in >= 32 && ctx->output_end - out >= 32) {
+    const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in));
+    const __m256i hi_nib =
+        _mm256_and_si256(_mm256_srli_epi32(x, 4), _mm256_set1_epi8(0x0f));
+    const __m256i lo_nib = _mm256_and_si256(x, _mm256_set1_epi8(0x0f));
+    const __m256i lo = _mm256_shuffle_epi8(lut_lo, lo_nib);
+    const __m256i hi = _mm256_shuffle_epi8(lut_hi, hi_nib);
+    if (!_mm256_testz_si256(lo, hi)) break;
+    const __m256i eq_2f = _mm256_cmpeq_epi8(x, _mm256_set1_epi8(0x2f));
+    const __m256i roll =
+        _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(eq_2f, hi_nib));
+    const __m256i values = _mm256_add_epi8(x, roll);
+    /* Pack each quad of 6-bit values into three bytes. */
+    const __m256i merge_ab_and_bc =
+        _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+    const __m256i merged =
+        _mm256_madd_epi16(merge_ab_and_bc, _mm256_set1_epi32(0x00011000));
+    const __m256i shuffled = _mm256_shuffle_epi8(
+        merged,
+        _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1,
+                         -1,  //
+                         2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1,
+                         -1));
+    const __m256i packed = _mm256_permutevar8x32_epi32(
+        shuffled, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), packed);
+    in += 32;
+    out += 24;
+  }
+  ctx->input_cur = in;
+  ctx->output_cur = out;
+}
+
+static bool b64_have_avx2(void) {
+  static const bool result = __builtin_cpu_supports("avx2");
+  return result;
+}
+
+#endif /* GRPC_BIN_DECODER_X86_DISPATCH */
+
 // By RFC 4648, if the length of the encoded string without padding is 4n+r,
 // the length of decoded string is: 1) 3n if r = 0, 2) 3n + 1 if r = 2, 3, or
 // 3) invalid if r = 1.
@@ -112,6 +185,12 @@ bool grpc_base64_decode_partial(struct grpc_base64_decode_context* ctx) {
     return false;
   }
 
+#ifdef GRPC_BIN_DECODER_X86_DISPATCH
+  // Bulk-decode fully valid blocks; anything it does not consume (tails,
+  // padding, invalid characters) is handled by the scalar code below.
+  if (b64_have_avx2()) b64_decode_avx2(ctx);
+#endif
+
   // Process a block of 4 input characters and 3 output bytes
   while (ctx->input_end >= ctx->input_cur + 4 &&
          ctx->output_end >= ctx->output_cur + 3) {
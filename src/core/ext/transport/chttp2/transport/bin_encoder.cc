@@ -27,6 +27,14 @@
 
 #include "src/core/ext/transport/chttp2/transport/huffsyms.h"
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define GRPC_BIN_ENCODER_X86_DISPATCH 1
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define GRPC_BIN_ENCODER_NEON 1
+#include <arm_neon.h>
+#endif
+
 static const char alphabet[] =
     "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
 
@@ -49,6 +57,98 @@ static const b64_huff_sym huff_alphabet[64] = {
 
 static const uint8_t tail_xtra[3] = {0, 2, 3};
 
+#ifdef GRPC_BIN_ENCODER_X86_DISPATCH
+
+/* Vectorized base64: each iteration turns 24 input bytes into 32 output
+   characters with the classic lookup-shuffle scheme. Consumes a multiple of
+   three bytes so the scalar code below can finish the job. */
+__attribute__((target("avx2"))) static const uint8_t* b64_encode_avx2(
+    const uint8_t* in, const uint8_t* end, char** out_ptr) {
+  char* out = *out_ptr;
+  /* For each output dword we want the input triplet bytes (a, b, c)
+     arranged as b | a<<8 | c<<16 | b<<24, per 128-bit lane. */
+  const __m256i shuf = _mm256_setr_epi8(
+      1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,  //
+      1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+  /* Offset from a 6-bit group value to its base64 character, indexed by the
+     value's range: 0 -> 'A'..'Z', 1 -> 'a'..'z', 2..11 -> '0'..'9',
+     12 -> '+', 13 -> '/'. */
+  const __m256i lut = _mm256_setr_epi8(
+      65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0,  //
+      65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0);
+  /* Each iteration consumes 24 bytes but loads 16 bytes from in + 12, so
+     require 28 readable bytes. */
+  while (end - in >= 28) {
+    const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+    const __m128i hi =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 12));
+    __m256i x = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+    x = _mm256_shuffle_epi8(x, shuf);
+    /* Isolate the four 6-bit groups of each triplet into one byte each. */
+    const __m256i t0 = _mm256_and_si256(x, _mm256_set1_epi32(0x0fc0fc00));
+    const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    const __m256i t2 = _mm256_and_si256(x, _mm256_set1_epi32(0x003f03f0));
+    const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+    const __m256i group = _mm256_or_si256(t1, t3);
+    /* Translate group values to alphabet characters. */
+    __m256i range = _mm256_subs_epu8(group, _mm256_set1_epi8(51));
+    range = _mm256_sub_epi8(range,
+                            _mm256_cmpgt_epi8(group, _mm256_set1_epi8(25)));
+    const __m256i chars =
+        _mm256_add_epi8(group, _mm256_shuffle_epi8(lut, range));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), chars);
+    in += 24;
+    out += 32;
+  }
+  *out_ptr = out;
+  return in;
+}
+
+static bool b64_have_avx2(void) {
+  static const bool result = __builtin_cpu_supports("avx2");
+  return result;
+}
+
+#endif /* GRPC_BIN_ENCODER_X86_DISPATCH */
+
+#ifdef GRPC_BIN_ENCODER_NEON
+
+/* Vectorized base64: each iteration de-interleaves 48 input bytes into 16
+   triplets and emits 64 output characters, using the 64-entry table lookup
+   to translate 6-bit groups. Consumes a multiple of three bytes so the
+   scalar code below can finish the job. */
+static const uint8_t* b64_encode_neon(const uint8_t* in, const uint8_t* end,
+                                      char** out_ptr) {
+  uint8_t* out = reinterpret_cast<uint8_t*>(*out_ptr);
+  uint8x16x4_t tbl;
+  tbl.val[0] = vld1q_u8(reinterpret_cast<const uint8_t*>(alphabet));
+  tbl.val[1] = vld1q_u8(reinterpret_cast<const uint8_t*>(alphabet + 16));
+  tbl.val[2] = vld1q_u8(reinterpret_cast<const uint8_t*>(alphabet + 32));
+  tbl.val[3] = vld1q_u8(reinterpret_cast<const uint8_t*>(alphabet + 48));
+  while (end - in >= 48) {
+    const uint8x16x3_t d = vld3q_u8(in);
+    uint8x16x4_t groups;
+    groups.val[0] = vshrq_n_u8(d.val[0], 2);
+    groups.val[1] = vorrq_u8(vshlq_n_u8(vandq_u8(d.val[0], vdupq_n_u8(0x3)), 4),
+                             vshrq_n_u8(d.val[1], 4));
+    groups.val[2] = vorrq_u8(vshlq_n_u8(vandq_u8(d.val[1], vdupq_n_u8(0xf)), 2),
+                             vshrq_n_u8(d.val[2], 6));
+    groups.val[3] = vandq_u8(d.val[2], vdupq_n_u8(0x3f));
+    uint8x16x4_t chars;
+    chars.val[0] = vqtbl4q_u8(tbl, groups.val[0]);
+    chars.val[1] = vqtbl4q_u8(tbl, groups.val[1]);
+    chars.val[2] = vqtbl4q_u8(tbl, groups.val[2]);
+    chars.val[3] = vqtbl4q_u8(tbl, groups.val[3]);
+    vst4q_u8(out, chars);
+    in += 48;
+    out += 64;
+  }
+  *out_ptr = reinterpret_cast<char*>(out);
+  return in;
+}
+
+#endif /* GRPC_BIN_ENCODER_NEON */
+
 grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input) {
   size_t input_length = GRPC_SLICE_LENGTH(input);
   size_t input_triplets = input_length / 3;
@@ -57,10 +157,19 @@ grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input) {
   grpc_slice output = GRPC_SLICE_MALLOC(output_length);
   const uint8_t* in = GRPC_SLICE_START_PTR(input);
   char* out = reinterpret_cast<char*> GRPC_SLICE_START_PTR(output);
-  size_t i;
+  const uint8_t* tail_start = GRPC_SLICE_END_PTR(input) - tail_case;
 
-  /* encode full triplets */
-  for (i = 0; i < input_triplets; i++) {
+#ifdef GRPC_BIN_ENCODER_X86_DISPATCH
+  if (b64_have_avx2()) {
+    in = b64_encode_avx2(in, GRPC_SLICE_END_PTR(input), &out);
+  }
+#endif
+#ifdef GRPC_BIN_ENCODER_NEON
+  in = b64_encode_neon(in, GRPC_SLICE_END_PTR(input), &out);
+#endif
+
+  /* encode remaining full triplets */
+  while (in < tail_start) {
     out[0] = alphabet[in[0] >> 2];
     out[1] = alphabet[((in[0] & 0x3) << 4) | (in[1] >> 4)];
     out[2] = alphabet[((in[1] & 0xf) << 2) | (in[2] >> 6)];
@@ -116,12 +225,25 @@ grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
     temp |= grpc_chttp2_huffsyms[sym].bits;
     temp_length += grpc_chttp2_huffsyms[sym].length;
 
-    while (temp_length > 8) {
-      temp_length -= 8;
-      *out++ = static_cast<uint8_t>(temp >> temp_length);
+    /* Multi-byte emission: a symbol is at most 30 bits and the accumulator
+       holds fewer than 32, so a single 32-bit drain keeps it from
+       overflowing while emitting four bytes per store. */
+    if (temp_length >= 32) {
+      temp_length -= 32;
+      const uint32_t w = static_cast<uint32_t>(temp >> temp_length);
+      out[0] = static_cast<uint8_t>(w >> 24);
+      out[1] = static_cast<uint8_t>(w >> 16);
+      out[2] = static_cast<uint8_t>(w >> 8);
+      out[3] = static_cast<uint8_t>(w);
+      out += 4;
     }
   }
 
+  while (temp_length >= 8) {
+    temp_length -= 8;
+    *out++ = static_cast<uint8_t>(temp >> temp_length);
+  }
+
   if (temp_length) {
     /* NB: the following integer arithmetic operation needs to be in its
      * expanded form due to the "integral promotion" performed (see section
@@ -137,25 +259,57 @@ grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
   return output;
 }
 
+struct b64_huff_pair {
+  uint32_t bits;
+  uint8_t length;
+};
+
+/* Huffman codes for every pair of base64 symbols, at most 22 bits each, so
+   one table lookup replaces two symbol lookups and their shifts. Built on
+   first use; 64 * 64 entries. */
+static const b64_huff_pair* get_b64_huff_pairs(void) {
+  static const b64_huff_pair* const pairs = [] {
+    b64_huff_pair* t = new b64_huff_pair[64 * 64];
+    for (int a = 0; a < 64; a++) {
+      for (int b = 0; b < 64; b++) {
+        const b64_huff_sym sa = huff_alphabet[a];
+        const b64_huff_sym sb = huff_alphabet[b];
+        t[(a << 6) | b].bits =
+            (static_cast<uint32_t>(sa.bits) << sb.length) | sb.bits;
+        t[(a << 6) | b].length =
+            static_cast<uint8_t>(sa.length + sb.length);
+      }
+    }
+    return t;
+  }();
+  return pairs;
+}
+
 struct huff_out {
-  uint32_t temp;
+  uint64_t temp;
   uint32_t temp_length;
   uint8_t* out;
 };
+
+/* Drain four bytes at a time; leaves fewer than 32 bits buffered, so the
+   next pair (at most 22 bits) cannot overflow the accumulator. */
 static void enc_flush_some(huff_out* out) {
-  while (out->temp_length > 8) {
-    out->temp_length -= 8;
-    *out->out++ = static_cast<uint8_t>(out->temp >> out->temp_length);
+  if (out->temp_length >= 32) {
+    out->temp_length -= 32;
+    const uint32_t w = static_cast<uint32_t>(out->temp >> out->temp_length);
+    out->out[0] = static_cast<uint8_t>(w >> 24);
+    out->out[1] = static_cast<uint8_t>(w >> 16);
+    out->out[2] = static_cast<uint8_t>(w >> 8);
+    out->out[3] = static_cast<uint8_t>(w);
+    out->out += 4;
   }
 }
 
-static void enc_add2(huff_out* out, uint8_t a, uint8_t b) {
-  b64_huff_sym sa = huff_alphabet[a];
-  b64_huff_sym sb = huff_alphabet[b];
-  out->temp = (out->temp << (sa.length + sb.length)) |
-              (static_cast<uint32_t>(sa.bits) << sb.length) | sb.bits;
-  out->temp_length +=
-      static_cast<uint32_t>(sa.length) + static_cast<uint32_t>(sb.length);
+static void enc_add2(huff_out* out, const b64_huff_pair* pairs, uint8_t a,
+                     uint8_t b) {
+  const b64_huff_pair p = pairs[(a << 6) | b];
+  out->temp = (out->temp << p.length) | p.bits;
+  out->temp_length += p.length;
   enc_flush_some(out);
 }
 
@@ -177,6 +331,7 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
   grpc_slice output = GRPC_SLICE_MALLOC(max_output_length);
   const uint8_t* in = GRPC_SLICE_START_PTR(input);
   uint8_t* start_out = GRPC_SLICE_START_PTR(output);
+  const b64_huff_pair* pairs = get_b64_huff_pairs();
   huff_out out;
   size_t i;
 
@@ -188,11 +343,11 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
   for (i = 0; i < input_triplets; i++) {
     const uint8_t low_to_high = static_cast<uint8_t>((in[0] & 0x3) << 4);
     const uint8_t high_to_low = in[1] >> 4;
-    enc_add2(&out, in[0] >> 2, low_to_high | high_to_low);
+    enc_add2(&out, pairs, in[0] >> 2, low_to_high | high_to_low);
 
     const uint8_t a = static_cast<uint8_t>((in[1] & 0xf) << 2);
     const uint8_t b = (in[2] >> 6);
-    enc_add2(&out, a | b, in[2] & 0x3f);
+    enc_add2(&out, pairs, a | b, in[2] & 0x3f);
     in += 3;
   }
 
@@ -201,19 +356,25 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
     case 0:
       break;
     case 1:
-      enc_add2(&out, in[0] >> 2, static_cast<uint8_t>((in[0] & 0x3) << 4));
+      enc_add2(&out, pairs, in[0] >> 2,
+               static_cast<uint8_t>((in[0] & 0x3) << 4));
       in += 1;
       break;
     case 2: {
       const uint8_t low_to_high = static_cast<uint8_t>((in[0] & 0x3) << 4);
       const uint8_t high_to_low = in[1] >> 4;
-      enc_add2(&out, in[0] >> 2, low_to_high | high_to_low);
+      enc_add2(&out, pairs, in[0] >> 2, low_to_high | high_to_low);
       enc_add1(&out, static_cast<uint8_t>((in[1] & 0xf) << 2));
       in += 2;
       break;
     }
   }
 
+  while (out.temp_length >= 8) {
+    out.temp_length -= 8;
+    *out.out++ = static_cast<uint8_t>(out.temp >> out.temp_length);
+  }
+
   if (out.temp_length) {
     /* NB: the following integer arithmetic operation needs to be in its
      * expanded form due to the "integral promotion" performed (see section
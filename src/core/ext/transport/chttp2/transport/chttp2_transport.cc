@@ -46,6 +46,7 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/atm.h>
 #include <grpc/support/log.h>
+#include <grpc/support/sync.h>
 
 #include "src/core/ext/transport/chttp2/transport/context_list.h"
 #include "src/core/ext/transport/chttp2/transport/flow_control.h"
@@ -66,6 +67,7 @@
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/status_helper.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/http/parser.h"
 #include "src/core/lib/iomgr/combiner.h"
@@ -234,6 +236,13 @@ grpc_chttp2_transport::~grpc_chttp2_transport() {
 
   grpc_slice_buffer_destroy(&outbuf);
 
+  {
+    grpc_core::MutexLock lock(&cached_slice_array_mu);
+    for (i = 0; i < cached_slice_array_count; i++) {
+      gpr_free(cached_slice_arrays[i].slices);
+    }
+  }
+
   grpc_error_handle error =
       GRPC_ERROR_CREATE_FROM_STATIC_STRING("Transport destroyed");
   // ContextList::Execute follows semantics of a callback function and does not
@@ -327,12 +336,32 @@ static void read_channel_args(grpc_chttp2_transport* t,
 
   if (channel_args.GetBool(GRPC_ARG_ENABLE_CHANNELZ)
           .value_or(GRPC_ENABLE_CHANNELZ_DEFAULT)) {
+    const bool record_counters =
+        grpc_core::channelz::SocketNode::SampleNewSocket(std::max(
+            0, channel_args.GetInt(GRPC_ARG_CHANNELZ_SOCKET_SAMPLING_PERIOD)
+                   .value_or(1)));
     t->channelz_socket =
         grpc_core::MakeRefCounted<grpc_core::channelz::SocketNode>(
             std::string(grpc_endpoint_get_local_address(t->ep)), t->peer_string,
             absl::StrFormat("%s %s", get_vtable()->name, t->peer_string),
             channel_args
-                .GetObjectRef<grpc_core::channelz::SocketNode::Security>());
+                .GetObjectRef<grpc_core::channelz::SocketNode::Security>(),
+            record_counters);
+  }
+
+  t->tx_byte_latency_tracing =
+      channel_args.GetBool(GRPC_ARG_HTTP2_TX_BYTE_LATENCY_TRACING)
+          .value_or(false);
+  if (t->tx_byte_latency_tracing) {
+    // ContextList::Execute must be installed as the TCP TX-timestamps
+    // callback for the traced writes to be reported back. It is the same
+    // callback external tracing integrations install, so installing it more
+    // than once is harmless.
+    static gpr_once tx_latency_once = GPR_ONCE_INIT;
+    gpr_once_init(&tx_latency_once, [] {
+      grpc_core::grpc_tcp_set_write_timestamps_callback(
+          grpc_core::ContextList::Execute);
+    });
   }
 
   static const struct {
@@ -430,6 +459,32 @@ static void configure_transport_ping_policy(grpc_chttp2_transport* t) {
           g_default_min_recv_ping_interval_without_data_ms);
 }
 
+// Deadline for the next keepalive ping. When the keepalive interval is long
+// compared to one second, round the deadline up to a one second grid. Timers
+// share a wheel per timer shard, so transports whose deadlines land on the
+// same grid point are all popped by a single timer-check pass: one thread
+// wakeup writes the keepalive pings for every transport in that bucket
+// instead of each of 100k idle connections scheduling its own scattered
+// wakeup. Rounding up (never down) means the effective interval can only
+// lengthen slightly, so quantization cannot trip the peer's
+// too_many_pings limits.
+static grpc_core::Timestamp next_keepalive_ping_deadline(
+    grpc_chttp2_transport* t) {
+  grpc_core::Timestamp deadline =
+      grpc_core::Timestamp::Now() + t->keepalive_time;
+  constexpr int64_t kQuantumMillis = 1000;
+  // Only quantize when the rounding error is small relative to the interval.
+  if (t->keepalive_time >= grpc_core::Duration::Milliseconds(
+                               5 * kQuantumMillis) &&
+      t->keepalive_time != grpc_core::Duration::Infinity()) {
+    int64_t millis =
+        static_cast<int64_t>(deadline.milliseconds_after_process_epoch());
+    millis += (kQuantumMillis - millis % kQuantumMillis) % kQuantumMillis;
+    deadline = grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(millis);
+  }
+  return deadline;
+}
+
 static void init_keepalive_pings_if_enabled(grpc_chttp2_transport* t) {
   if (t->keepalive_time != grpc_core::Duration::Infinity()) {
     t->keepalive_state = GRPC_CHTTP2_KEEPALIVE_STATE_WAITING;
@@ -437,7 +492,7 @@ static void init_keepalive_pings_if_enabled(grpc_chttp2_transport* t) {
     GRPC_CLOSURE_INIT(&t->init_keepalive_ping_locked, init_keepalive_ping, t,
                       grpc_schedule_on_exec_ctx);
     grpc_timer_init(&t->keepalive_ping_timer,
-                    grpc_core::Timestamp::Now() + t->keepalive_time,
+                    next_keepalive_ping_deadline(t),
                     &t->init_keepalive_ping_locked);
   } else {
     // Use GRPC_CHTTP2_KEEPALIVE_STATE_DISABLED to indicate there are no
@@ -528,7 +583,11 @@ grpc_chttp2_transport::grpc_chttp2_transport(
                                       nullptr);
   }
 
-  grpc_chttp2_initiate_write(this, GRPC_CHTTP2_INITIATE_WRITE_INITIAL_WRITE);
+  // Defer the connection-preface write until reading starts: by then the
+  // caller has had a chance to queue the first stream's HEADERS, letting the
+  // client connect string, settings, the initial window update and those
+  // HEADERS ship in a single endpoint write.
+  initial_write_pending = true;
   post_benign_reclaimer(this);
   if (grpc_core::test_only_init_callback != nullptr) {
     grpc_core::test_only_init_callback();
@@ -574,6 +633,23 @@ static void close_transport_locked(grpc_chttp2_transport* t,
     }
     GPR_ASSERT(!error.ok());
     t->closed_with_error = error;
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_http_trace) ||
+        GRPC_TRACE_FLAG_ENABLED(grpc_keepalive_trace)) {
+      gpr_log(GPR_INFO,
+              "%s: transport latency [%s]: ping rtt n=%" PRIu64
+              " p50=%" PRId64 "ms p99=%" PRId64 "ms max=%" PRId64
+              "ms; write stall n=%" PRIu64 " p50=%" PRId64 "ms p99=%" PRId64
+              "ms max=%" PRId64 "ms",
+              t->is_client ? "CLIENT" : "SERVER", t->peer_string.c_str(),
+              t->ping_rtt_histogram.count,
+              t->ping_rtt_histogram.Percentile(50).millis(),
+              t->ping_rtt_histogram.Percentile(99).millis(),
+              t->ping_rtt_histogram.max.millis(),
+              t->write_stall_histogram.count,
+              t->write_stall_histogram.Percentile(50).millis(),
+              t->write_stall_histogram.Percentile(99).millis(),
+              t->write_stall_histogram.max.millis());
+    }
     connectivity_state_set(t, GRPC_CHANNEL_SHUTDOWN, absl::Status(),
                            "close_transport");
     if (t->ping_state.is_delayed_ping_timer_set) {
@@ -631,6 +707,41 @@ void grpc_chttp2_stream_unref(grpc_chttp2_stream* s) {
 }
 #endif
 
+// Initialize a per-stream slice buffer, adopting a recycled heap slice array
+// from the transport's cache when one is available so the buffer starts with
+// the capacity a previous stream already paid to grow.
+static void stream_slice_buffer_init(grpc_chttp2_transport* t,
+                                     grpc_slice_buffer* sb) {
+  grpc_slice_buffer_init(sb);
+  // Locked: adoption runs on the call-creation thread while donation runs
+  // under the transport combiner.
+  grpc_core::MutexLock lock(&t->cached_slice_array_mu);
+  if (t->cached_slice_array_count > 0) {
+    grpc_chttp2_transport::CachedSliceArray entry =
+        t->cached_slice_arrays[--t->cached_slice_array_count];
+    sb->base_slices = sb->slices = entry.slices;
+    sb->capacity = entry.capacity;
+  }
+}
+
+// Destroy a per-stream slice buffer, donating a heap-grown slice array to the
+// transport's cache instead of freeing it when there's room.
+static void stream_slice_buffer_destroy(grpc_chttp2_transport* t,
+                                        grpc_slice_buffer* sb) {
+  grpc_slice_buffer_reset_and_unref(sb);
+  if (sb->base_slices != sb->inlined) {
+    grpc_core::MutexLock lock(&t->cached_slice_array_mu);
+    if (t->cached_slice_array_count <
+        grpc_chttp2_transport::kMaxCachedSliceArrays) {
+      t->cached_slice_arrays[t->cached_slice_array_count++] = {sb->base_slices,
+                                                               sb->capacity};
+      sb->base_slices = sb->slices = sb->inlined;
+      sb->capacity = GRPC_SLICE_BUFFER_INLINE_ELEMENTS;
+    }
+  }
+  grpc_slice_buffer_destroy(sb);
+}
+
 grpc_chttp2_stream::Reffer::Reffer(grpc_chttp2_stream* s) {
   // We reserve one 'active stream' that's dropped when the stream is
   //   read-closed. The others are for Chttp2IncomingByteStreams that are
@@ -656,8 +767,8 @@ grpc_chttp2_stream::grpc_chttp2_stream(grpc_chttp2_transport* t,
     post_destructive_reclaimer(t);
   }
 
-  grpc_slice_buffer_init(&frame_storage);
-  grpc_slice_buffer_init(&flow_controlled_buffer);
+  stream_slice_buffer_init(t, &frame_storage);
+  stream_slice_buffer_init(t, &flow_controlled_buffer);
 }
 
 grpc_chttp2_stream::~grpc_chttp2_stream() {
@@ -677,7 +788,7 @@ grpc_chttp2_stream::~grpc_chttp2_stream() {
     GPR_ASSERT(grpc_chttp2_stream_map_find(&t->stream_map, id) == nullptr);
   }
 
-  grpc_slice_buffer_destroy(&frame_storage);
+  stream_slice_buffer_destroy(t, &frame_storage);
 
   for (int i = 0; i < STREAM_LIST_COUNT; i++) {
     if (GPR_UNLIKELY(included.is_set(i))) {
@@ -692,7 +803,7 @@ grpc_chttp2_stream::~grpc_chttp2_stream() {
   GPR_ASSERT(recv_initial_metadata_ready == nullptr);
   GPR_ASSERT(recv_message_ready == nullptr);
   GPR_ASSERT(recv_trailing_metadata_finished == nullptr);
-  grpc_slice_buffer_destroy(&flow_controlled_buffer);
+  stream_slice_buffer_destroy(t, &flow_controlled_buffer);
   GRPC_CHTTP2_UNREF_TRANSPORT(t, "stream");
   grpc_core::ExecCtx::Run(DEBUG_LOCATION, destroy_stream_arg, absl::OkStatus());
 }
@@ -856,11 +967,76 @@ static void write_action_begin_locked(void* gt,
       continue_read_action_locked(t);
     }
   } else {
+    if (t->closed_with_error.ok()) {
+      t->write_stall_stats.no_data_write_cycles++;
+    }
     set_write_state(t, GRPC_CHTTP2_WRITE_STATE_IDLE, "begin writing nothing");
     GRPC_CHTTP2_UNREF_TRANSPORT(t, "writing");
   }
 }
 
+// Coalesce runs of small adjacent slices in the outgoing buffer into single
+// contiguous slices. A write cycle carrying many small frames (settings,
+// pings, window updates, short headers) otherwise hands the endpoint a long
+// iovec of tiny entries, and the per-entry scatter/gather cost exceeds the
+// memcpy needed to merge them.
+static void coalesce_small_slices(grpc_slice_buffer* sb) {
+  static constexpr size_t kSmallSliceThreshold = 128;
+  static constexpr size_t kMaxCoalescedLength = 4096;
+  if (sb->count < 2) return;
+  bool any_adjacent_small = false;
+  for (size_t i = 0; i + 1 < sb->count; i++) {
+    if (GRPC_SLICE_LENGTH(sb->slices[i]) < kSmallSliceThreshold &&
+        GRPC_SLICE_LENGTH(sb->slices[i + 1]) < kSmallSliceThreshold) {
+      any_adjacent_small = true;
+      break;
+    }
+  }
+  if (!any_adjacent_small) return;
+  grpc_slice_buffer out;
+  grpc_slice_buffer_init(&out);
+  size_t i = 0;
+  while (i < sb->count) {
+    if (GRPC_SLICE_LENGTH(sb->slices[i]) >= kSmallSliceThreshold) {
+      grpc_slice_buffer_add(&out, sb->slices[i]);
+      i++;
+      continue;
+    }
+    // Find the extent of this run of small slices, bounded so we never
+    // memcpy more than kMaxCoalescedLength per merged slice.
+    size_t run_end = i;
+    size_t run_length = 0;
+    while (run_end < sb->count &&
+           GRPC_SLICE_LENGTH(sb->slices[run_end]) < kSmallSliceThreshold &&
+           run_length + GRPC_SLICE_LENGTH(sb->slices[run_end]) <=
+               kMaxCoalescedLength) {
+      run_length += GRPC_SLICE_LENGTH(sb->slices[run_end]);
+      run_end++;
+    }
+    if (run_end - i < 2) {
+      grpc_slice_buffer_add(&out, sb->slices[i]);
+      i++;
+      continue;
+    }
+    grpc_slice merged = GRPC_SLICE_MALLOC(run_length);
+    uint8_t* dst = GRPC_SLICE_START_PTR(merged);
+    for (size_t j = i; j < run_end; j++) {
+      memcpy(dst, GRPC_SLICE_START_PTR(sb->slices[j]),
+             GRPC_SLICE_LENGTH(sb->slices[j]));
+      dst += GRPC_SLICE_LENGTH(sb->slices[j]);
+      grpc_slice_unref(sb->slices[j]);
+    }
+    grpc_slice_buffer_add(&out, merged);
+    i = run_end;
+  }
+  // Every slice was either transferred or unreffed above; empty sb without
+  // touching refcounts, then take the coalesced contents.
+  sb->count = 0;
+  sb->length = 0;
+  grpc_slice_buffer_swap(sb, &out);
+  grpc_slice_buffer_destroy(&out);
+}
+
 static void write_action(void* gt, grpc_error_handle /*error*/) {
   grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(gt);
   void* cl = t->cl;
@@ -875,15 +1051,56 @@ static void write_action(void* gt, grpc_error_handle /*error*/) {
           ? 2 * t->settings[GRPC_PEER_SETTINGS]
                            [GRPC_CHTTP2_SETTINGS_MAX_FRAME_SIZE]
           : INT_MAX;
+  coalesce_small_slices(&t->outbuf);
+  t->write_stall_stats.endpoint_write_bytes +=
+      static_cast<int64_t>(t->outbuf.length);
+  t->write_in_flight_bytes = t->outbuf.length;
+  t->write_action_start_time = grpc_core::Timestamp::Now();
+  // write_action runs under the combiner immediately after set_write_state,
+  // so WRITING_WITH_MORE here reliably means another endpoint write follows
+  // as soon as this one completes (a partial write bounded by the target
+  // write size): tell the endpoint to hold its trailing partial packet.
+  const bool more_coming =
+      t->write_state == GRPC_CHTTP2_WRITE_STATE_WRITING_WITH_MORE;
   grpc_endpoint_write(
       t->ep, &t->outbuf,
       GRPC_CLOSURE_INIT(&t->write_action_end_locked, write_action_end, t,
                         grpc_schedule_on_exec_ctx),
-      cl, max_frame_size);
+      cl, max_frame_size, more_coming);
 }
 
 static void write_action_end(void* tp, grpc_error_handle error) {
   grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(tp);
+  // Sample the write duration here, before the combiner hop, so combiner
+  // contention doesn't pollute the stall measurement.
+  if (t->write_action_start_time != grpc_core::Timestamp::InfPast()) {
+    const grpc_core::Duration write_duration =
+        grpc_core::Timestamp::Now() - t->write_action_start_time;
+    t->write_stall_histogram.Increment(write_duration);
+    t->write_stall_stats.endpoint_write_time += write_duration;
+    t->write_action_start_time = grpc_core::Timestamp::InfPast();
+    // Feedback loop for the adaptive target write size. A write that filled
+    // the target and still completed quickly means we are splitting bulk
+    // traffic into more write cycles than the socket needs: double the
+    // target. A slow completion means we queued more than the socket could
+    // take without blocking (the endpoint sat on EAGAIN / partial writes):
+    // halve it so latency-sensitive traffic is not stuck behind one burst.
+    // Only one endpoint write is in flight at a time, so this is ordered
+    // with the write loop by the combiner.
+    constexpr uint32_t kMinTargetWriteSize = 64 * 1024;
+    constexpr uint32_t kMaxTargetWriteSize = 16 * 1024 * 1024;
+    if (write_duration > grpc_core::Duration::Milliseconds(10)) {
+      t->target_write_size =
+          std::max(kMinTargetWriteSize, t->target_write_size / 2);
+    } else if (write_duration < grpc_core::Duration::Milliseconds(1) &&
+               t->write_in_flight_bytes >= t->target_write_size) {
+      t->target_write_size =
+          std::min(kMaxTargetWriteSize, t->target_write_size * 2);
+    }
+    if (t->channelz_socket != nullptr) {
+      t->channelz_socket->RecordTargetWriteSize(t->target_write_size);
+    }
+  }
   t->combiner->Run(GRPC_CLOSURE_INIT(&t->write_action_end_locked,
                                      write_action_end_locked, t, nullptr),
                    error);
@@ -1061,6 +1278,7 @@ static void maybe_start_some_streams(grpc_chttp2_transport* t) {
     GPR_ASSERT(s->id == 0);
     s->id = t->next_stream_id;
     t->next_stream_id += 2;
+    t->reported_stream_saturation = false;
 
     if (t->next_stream_id >= MAX_CLIENT_STREAM_ID) {
       connectivity_state_set(t, GRPC_CHANNEL_TRANSIENT_FAILURE,
@@ -1247,6 +1465,18 @@ static void perform_stream_op_locked(void* stream_op,
           GPR_ASSERT(s->id == 0);
           grpc_chttp2_list_add_waiting_for_concurrency(t, s);
           maybe_start_some_streams(t);
+          // If the stream is still waiting because the peer's
+          // MAX_CONCURRENT_STREAMS limit is reached, notify whoever asked
+          // for saturation signals (at most once per episode).
+          if (s->id == 0 && t->goaway_error.ok() &&
+              t->streams_saturated_cb != nullptr &&
+              !t->reported_stream_saturation &&
+              grpc_chttp2_stream_map_size(&t->stream_map) >=
+                  t->settings[GRPC_PEER_SETTINGS]
+                             [GRPC_CHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS]) {
+            t->reported_stream_saturation = true;
+            t->streams_saturated_cb(t->streams_saturated_cb_user_data);
+          }
         } else {
           s->trailing_metadata_buffer.Set(
               grpc_core::GrpcStreamNetworkState(),
@@ -1545,6 +1775,33 @@ static void retry_initiate_ping_locked(void* tp, grpc_error_handle error) {
   GRPC_CHTTP2_UNREF_TRANSPORT(t, "retry_initiate_ping_locked");
 }
 
+void grpc_chttp2_latency_histogram::Increment(grpc_core::Duration sample) {
+  int64_t millis = sample.millis();
+  size_t bucket = 0;
+  while (millis > 1 && bucket + 1 < kNumBuckets) {
+    millis >>= 1;
+    bucket++;
+  }
+  buckets[bucket]++;
+  count++;
+  max = std::max(max, sample);
+}
+
+grpc_core::Duration grpc_chttp2_latency_histogram::Percentile(
+    double percentile) const {
+  if (count == 0) return grpc_core::Duration::Zero();
+  uint64_t target =
+      static_cast<uint64_t>(static_cast<double>(count) * percentile / 100.0);
+  uint64_t seen = 0;
+  for (size_t i = 0; i < kNumBuckets; i++) {
+    seen += buckets[i];
+    if (seen > target) {
+      return std::min(max, grpc_core::Duration::Milliseconds(int64_t{1} << i));
+    }
+  }
+  return max;
+}
+
 void grpc_chttp2_ack_ping(grpc_chttp2_transport* t, uint64_t id) {
   grpc_chttp2_ping_queue* pq = &t->ping_queue;
   if (pq->inflight_id != id) {
@@ -1552,6 +1809,11 @@ void grpc_chttp2_ack_ping(grpc_chttp2_transport* t, uint64_t id) {
             t->peer_string.c_str(), id);
     return;
   }
+  if (pq->inflight_sent_time != grpc_core::Timestamp::InfPast()) {
+    t->ping_rtt_histogram.Increment(grpc_core::Timestamp::Now() -
+                                    pq->inflight_sent_time);
+    pq->inflight_sent_time = grpc_core::Timestamp::InfPast();
+  }
   grpc_core::ExecCtx::RunList(DEBUG_LOCATION,
                               &pq->lists[GRPC_CHTTP2_PCL_INFLIGHT]);
   if (!grpc_closure_list_empty(pq->lists[GRPC_CHTTP2_PCL_NEXT])) {
@@ -1724,6 +1986,11 @@ static void perform_transport_op_locked(void* stream_op,
     t->accept_stream_cb_user_data = op->set_accept_stream_user_data;
   }
 
+  if (op->set_streams_saturated) {
+    t->streams_saturated_cb = op->set_streams_saturated_fn;
+    t->streams_saturated_cb_user_data = op->set_streams_saturated_user_data;
+  }
+
   if (op->bind_pollset) {
     grpc_endpoint_add_to_pollset(t->ep, op->bind_pollset);
   }
@@ -1911,6 +2178,15 @@ static void remove_stream(grpc_chttp2_transport* t, uint32_t id,
 
 void grpc_chttp2_cancel_stream(grpc_chttp2_transport* t, grpc_chttp2_stream* s,
                                grpc_error_handle due_to_error) {
+  // Fast path: a client stream that was never assigned an HTTP/2 stream id
+  // has sent nothing on the wire, so there is no RST_STREAM to emit and no
+  // status to parse out of the error -- just close the stream locally.
+  if (t->is_client && s->id == 0 && !due_to_error.ok()) {
+    s->seen_error = true;
+    grpc_chttp2_mark_stream_closed(t, s, 1, 1, due_to_error);
+    return;
+  }
+
   if (!t->is_client && !s->sent_trailing_metadata &&
       grpc_error_has_clear_grpc_status(due_to_error)) {
     close_from_api(t, s, due_to_error);
@@ -2340,6 +2616,14 @@ static void read_action(void* tp, grpc_error_handle error) {
 static void read_action_locked(void* tp, grpc_error_handle error) {
   grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(tp);
 
+  if (t->initial_write_pending) {
+    t->initial_write_pending = false;
+    // Scheduled via the combiner's finally list, so the write runs after
+    // any stream ops already queued in this combiner drain and batches
+    // with them.
+    grpc_chttp2_initiate_write(t, GRPC_CHTTP2_INITIATE_WRITE_INITIAL_WRITE);
+  }
+
   grpc_error_handle err = error;
   if (!err.ok()) {
     err = grpc_error_set_int(GRPC_ERROR_CREATE_REFERENCING_FROM_STATIC_STRING(
@@ -2424,6 +2708,18 @@ static void continue_read_action_locked(grpc_chttp2_transport* t) {
 
 // t is reffed prior to calling the first time, and once the callback chain
 // that kicks off finishes, it's unreffed
+// Publishes the BDP estimator's state to the channelz socket node.
+// probing is false while probes are quiesced on an idle transport.
+static void report_bdp_state_to_channelz(grpc_chttp2_transport* t,
+                                         bool probing) {
+  if (t->channelz_socket == nullptr) return;
+  grpc_core::BdpEstimator* est = t->flow_control.bdp_estimator();
+  if (est == nullptr) return;
+  t->channelz_socket->RecordBdpEstimatorState(
+      est->EstimateBdp(), static_cast<int64_t>(est->EstimateBandwidth()),
+      est->inter_ping_delay().millis(), probing);
+}
+
 void schedule_bdp_ping_locked(grpc_chttp2_transport* t) {
   t->flow_control.bdp_estimator()->SchedulePing();
   send_ping_locked(
@@ -2487,6 +2783,7 @@ static void finish_bdp_ping_locked(void* tp, grpc_error_handle error) {
   t->bdp_ping_started = false;
   grpc_core::Timestamp next_ping =
       t->flow_control.bdp_estimator()->CompletePing();
+  report_bdp_state_to_channelz(t, /*probing=*/true);
   grpc_chttp2_act_on_flowctl_action(t->flow_control.PeriodicUpdate(), t,
                                     nullptr);
   GPR_ASSERT(!t->have_next_bdp_ping_timer);
@@ -2517,6 +2814,7 @@ static void next_bdp_ping_timer_expired_locked(void* tp,
   if (t->flow_control.bdp_estimator()->accumulator() == 0) {
     // Block the bdp ping till we receive more data.
     t->bdp_ping_blocked = true;
+    report_bdp_state_to_channelz(t, /*probing=*/false);
     GRPC_CHTTP2_UNREF_TRANSPORT(t, "bdp_ping");
   } else {
     schedule_bdp_ping_locked(t);
@@ -2607,7 +2905,7 @@ static void init_keepalive_ping_locked(void* arg, grpc_error_handle error) {
       GRPC_CLOSURE_INIT(&t->init_keepalive_ping_locked, init_keepalive_ping, t,
                         grpc_schedule_on_exec_ctx);
       grpc_timer_init(&t->keepalive_ping_timer,
-                      grpc_core::Timestamp::Now() + t->keepalive_time,
+                      next_keepalive_ping_deadline(t),
                       &t->init_keepalive_ping_locked);
     }
   } else if (error == absl::CancelledError()) {
@@ -2621,7 +2919,7 @@ static void init_keepalive_ping_locked(void* arg, grpc_error_handle error) {
     GRPC_CLOSURE_INIT(&t->init_keepalive_ping_locked, init_keepalive_ping, t,
                       grpc_schedule_on_exec_ctx);
     grpc_timer_init(&t->keepalive_ping_timer,
-                    grpc_core::Timestamp::Now() + t->keepalive_time,
+                    next_keepalive_ping_deadline(t),
                     &t->init_keepalive_ping_locked);
   }
   GRPC_CHTTP2_UNREF_TRANSPORT(t, "init keepalive ping");
@@ -2641,6 +2939,29 @@ static void start_keepalive_ping_locked(void* arg, grpc_error_handle error) {
   }
   if (t->channelz_socket != nullptr) {
     t->channelz_socket->RecordKeepaliveSent();
+    // Piggyback on the keepalive cadence to refresh the kernel-level stats
+    // exported through channelz, so tail-latency incidents can be correlated
+    // with congestion state without a dedicated timer.
+    grpc_endpoint_tcp_stats tcp_stats;
+    if (t->ep != nullptr && grpc_endpoint_get_tcp_stats(t->ep, &tcp_stats)) {
+      t->channelz_socket->RecordTcpStats(
+          tcp_stats.rtt_usec, tcp_stats.total_retransmits,
+          tcp_stats.delivery_rate_bytes_per_sec,
+          tcp_stats.congestion_window_packets);
+    }
+    // Same cadence for the write-path stall attribution, so a throughput
+    // drop can be blamed on flow control, the endpoint, or data starvation
+    // straight from a channelz dump.
+    t->channelz_socket->RecordWriteStallStats(
+        t->write_stall_stats.transport_window_stalls,
+        t->write_stall_stats.transport_window_stalled_bytes,
+        t->write_stall_stats.transport_window_stalled_time.millis(),
+        t->write_stall_stats.stream_window_stalls,
+        t->write_stall_stats.stream_window_stalled_bytes,
+        t->write_stall_stats.stream_window_stalled_time.millis(),
+        t->write_stall_stats.endpoint_write_time.millis(),
+        t->write_stall_stats.endpoint_write_bytes,
+        t->write_stall_stats.no_data_write_cycles);
   }
   if (GRPC_TRACE_FLAG_ENABLED(grpc_http_trace) ||
       GRPC_TRACE_FLAG_ENABLED(grpc_keepalive_trace)) {
@@ -2686,7 +3007,7 @@ static void finish_keepalive_ping_locked(void* arg, grpc_error_handle error) {
       GRPC_CLOSURE_INIT(&t->init_keepalive_ping_locked, init_keepalive_ping, t,
                         grpc_schedule_on_exec_ctx);
       grpc_timer_init(&t->keepalive_ping_timer,
-                      grpc_core::Timestamp::Now() + t->keepalive_time,
+                      next_keepalive_ping_deadline(t),
                       &t->init_keepalive_ping_locked);
     }
   }
@@ -28,18 +28,33 @@ namespace {
 void (*write_timestamps_callback_g)(void*, grpc_core::Timestamps*,
                                     grpc_error_handle error) = nullptr;
 void* (*get_copied_context_fn_g)(void*) = nullptr;
+
+int64_t timespec_sub_usec(gpr_timespec a, gpr_timespec b) {
+  gpr_timespec delta = gpr_time_sub(a, b);
+  return delta.tv_sec * GPR_US_PER_SEC + delta.tv_nsec / GPR_NS_PER_US;
+}
 }  // namespace
 
 namespace grpc_core {
 void ContextList::Append(ContextList** head, grpc_chttp2_stream* s) {
-  if (get_copied_context_fn_g == nullptr ||
-      write_timestamps_callback_g == nullptr) {
+  const bool tracing_externally = get_copied_context_fn_g != nullptr &&
+                                  write_timestamps_callback_g != nullptr;
+  const bool tracing_latency =
+      s->t->tx_byte_latency_tracing && s->t->channelz_socket != nullptr;
+  if (!tracing_externally && !tracing_latency) {
     return;
   }
   /* Create a new element in the list and add it at the front */
   ContextList* elem = new ContextList();
-  elem->trace_context_ = get_copied_context_fn_g(s->context);
+  if (tracing_externally) {
+    elem->trace_context_ = get_copied_context_fn_g(s->context);
+  }
   elem->byte_offset_ = s->byte_counter;
+  if (tracing_latency) {
+    elem->channelz_socket_ = s->t->channelz_socket;
+    elem->stream_id_ = s->id;
+    elem->queued_time_ = gpr_now(GPR_CLOCK_REALTIME);
+  }
   elem->next_ = *head;
   *head = elem;
 }
@@ -48,12 +63,22 @@ void ContextList::Execute(void* arg, Timestamps* ts, grpc_error_handle error) {
   ContextList* head = static_cast<ContextList*>(arg);
   ContextList* to_be_freed;
   while (head != nullptr) {
-    if (write_timestamps_callback_g) {
+    if (write_timestamps_callback_g && head->trace_context_ != nullptr) {
       if (ts) {
         ts->byte_offset = static_cast<uint32_t>(head->byte_offset_);
       }
       write_timestamps_callback_g(head->trace_context_, ts, error);
     }
+    if (head->channelz_socket_ != nullptr && ts != nullptr &&
+        gpr_time_cmp(ts->acked_time.time,
+                     gpr_inf_past(GPR_CLOCK_REALTIME)) != 0) {
+      /* The kernel reported the bytes ACKed: split the write-queued-to-ACK
+       * latency into its transport and network components. */
+      head->channelz_socket_->RecordTxByteAckLatency(
+          head->stream_id_,
+          timespec_sub_usec(ts->acked_time.time, head->queued_time_),
+          timespec_sub_usec(ts->acked_time.time, ts->sendmsg_time.time));
+    }
     to_be_freed = head;
     head = head->next_;
     delete to_be_freed;
@@ -22,8 +22,13 @@
 #include <grpc/support/port_platform.h>
 
 #include <stddef.h>
+#include <stdint.h>
+
+#include <grpc/support/time.h>
 
 #include "src/core/ext/transport/chttp2/transport/frame.h"
+#include "src/core/lib/channel/channelz.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/iomgr/buffer_list.h"
 #include "src/core/lib/iomgr/error.h"
 
@@ -32,7 +37,9 @@ namespace grpc_core {
 class ContextList {
  public:
   /* Creates a new element with \a context as the value and appends it to the
-   * list. */
+   * list. An element is created if either the external (Fathom) tracing
+   * callbacks are registered and the stream is traced, or the transport has
+   * TX byte-latency tracing enabled and a channelz socket to report to. */
   static void Append(ContextList** head, grpc_chttp2_stream* s);
 
   /* Executes a function \a fn with each context in the list and \a ts. It also
@@ -44,6 +51,14 @@ class ContextList {
   void* trace_context_ = nullptr;
   ContextList* next_ = nullptr;
   size_t byte_offset_ = 0;
+  /* For transports with TX byte-latency tracing enabled: where to report the
+   * ACK latency, which stream it belongs to, and when the write was queued
+   * in the transport. The socket ref keeps the channelz node alive until the
+   * kernel has reported (or the endpoint shut down), which may be after the
+   * transport is destroyed. */
+  RefCountedPtr<channelz::SocketNode> channelz_socket_;
+  uint32_t stream_id_ = 0;
+  gpr_timespec queued_time_ = gpr_inf_past(GPR_CLOCK_REALTIME);
 };
 
 void grpc_http2_set_write_timestamps_callback(
@@ -0,0 +1,150 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/transport/chttp2/transport/decode_huff_fast.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "src/core/ext/transport/chttp2/transport/huffsyms.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define GRPC_DECODE_HUFF_FAST_VECTOR_COPY 1
+#elif defined(__SSE2__) || (defined(_M_AMD64) || defined(_M_X64))
+#include <emmintrin.h>
+#define GRPC_DECODE_HUFF_FAST_VECTOR_COPY 1
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define GRPC_DECODE_HUFF_FAST_VECTOR_COPY 1
+#endif
+
+namespace grpc_core {
+
+namespace {
+
+struct HuffFastTables {
+  // Codes of at most 8 bits, indexed by the top 8 bits of the buffer.
+  HuffFastSym level1[256];
+  // Codes of more than 8 bits (EOS included), ordered by ascending code
+  // length.
+  struct LongCode {
+    uint32_t bits;
+    uint16_t sym;
+    uint8_t length;
+  } long_codes[GRPC_CHTTP2_NUM_HUFFSYMS];
+  size_t num_long;
+};
+
+HuffFastTables BuildHuffFastTables() {
+  HuffFastTables tables = {};
+  for (size_t sym = 0; sym < 256; sym++) {
+    const auto& code = grpc_chttp2_huffsyms[sym];
+    if (code.length > 8) continue;
+    // Fill every level1 slot whose top bits match this code.
+    const size_t first = code.bits << (8 - code.length);
+    const size_t count = size_t{1} << (8 - code.length);
+    for (size_t i = 0; i < count; i++) {
+      tables.level1[first + i] = {static_cast<uint8_t>(sym),
+                                  static_cast<uint8_t>(code.length)};
+    }
+  }
+  for (unsigned length = 9; length <= 30; length++) {
+    for (size_t sym = 0; sym < GRPC_CHTTP2_NUM_HUFFSYMS; sym++) {
+      const auto& code = grpc_chttp2_huffsyms[sym];
+      if (code.length != length) continue;
+      tables.long_codes[tables.num_long++] = {code.bits,
+                                              static_cast<uint16_t>(sym),
+                                              static_cast<uint8_t>(length)};
+    }
+  }
+  return tables;
+}
+
+const HuffFastTables& GetHuffFastTables() {
+  static const HuffFastTables tables = BuildHuffFastTables();
+  return tables;
+}
+
+}  // namespace
+
+const HuffFastSym* HuffFastSymTable() { return GetHuffFastTables().level1; }
+
+bool HuffDecodeLongSym(uint64_t buffer, size_t buffer_len, size_t* consumed,
+                       uint16_t* emit) {
+  const HuffFastTables& tables = GetHuffFastTables();
+  for (size_t i = 0; i < tables.num_long; i++) {
+    const auto& code = tables.long_codes[i];
+    // long_codes is length-ascending, so once a code no longer fits in the
+    // remaining bits nothing later can match.
+    if (code.length > buffer_len) return false;
+    if (static_cast<uint32_t>((buffer >> (buffer_len - code.length)) &
+                              ((uint64_t{1} << code.length) - 1)) ==
+        code.bits) {
+      *consumed = code.length;
+      *emit = code.sym;
+      return true;
+    }
+  }
+  return false;
+}
+
+void HuffDecodeFastInput::Refill() {
+  while (buffer_len_ <= 56) {
+    size_t avail = staged_size_ - staged_pos_;
+    if (avail == 0) {
+      const size_t n = static_cast<size_t>(end_ - p_);
+      if (n == 0) return;
+      const size_t stage = std::min(n, sizeof(staged_));
+#if defined(GRPC_DECODE_HUFF_FAST_VECTOR_COPY)
+      if (stage == sizeof(staged_)) {
+#if defined(__AVX2__)
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(staged_),
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_)));
+#elif defined(__SSE2__) || (defined(_M_AMD64) || defined(_M_X64))
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i*>(staged_),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_)));
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i*>(staged_ + 16),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_ + 16)));
+#else
+        vst1q_u8(staged_, vld1q_u8(p_));
+        vst1q_u8(staged_ + 16, vld1q_u8(p_ + 16));
+#endif
+      } else {
+        memcpy(staged_, p_, stage);
+      }
+#else
+      memcpy(staged_, p_, stage);
+#endif
+      p_ += stage;
+      staged_pos_ = 0;
+      staged_size_ = stage;
+      avail = stage;
+    }
+    const size_t take = std::min((64 - buffer_len_) / 8, avail);
+    for (size_t i = 0; i < take; i++) {
+      buffer_ = (buffer_ << 8) | staged_[staged_pos_ + i];
+    }
+    staged_pos_ += take;
+    buffer_len_ += 8 * take;
+  }
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,122 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_DECODE_HUFF_FAST_H
+#define GRPC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_DECODE_HUFF_FAST_H
+
+#include <grpc/support/port_platform.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace grpc_core {
+
+// Minimum input length (in bytes) below which the chunked decoder is not
+// worth its setup cost: callers should use HuffDecoder directly under this.
+constexpr size_t kHuffDecodeFastMinBytes = 16;
+
+// Level-one decode table entry for HPACK huffman codes of at most 8 bits.
+// len == 0 marks an index that is the prefix of some longer code.
+struct HuffFastSym {
+  uint8_t emit;
+  uint8_t len;
+};
+
+// 256 entry table indexed by the top 8 bits of the bit buffer.
+const HuffFastSym* HuffFastSymTable();
+
+// Decode one code of more than 8 bits from the top of buffer (right aligned,
+// buffer_len valid bits). Returns false if no code fits the available bits.
+// On success *consumed holds the code length and *emit the decoded symbol
+// (256 for EOS, which terminates decoding).
+bool HuffDecodeLongSym(uint64_t buffer, size_t buffer_len, size_t* consumed,
+                       uint16_t* emit);
+
+// Bit buffer over the input, refilled from 16/32 byte staged chunks (copied
+// with vector loads where the ISA provides them) instead of byte-by-byte.
+class HuffDecodeFastInput {
+ public:
+  HuffDecodeFastInput(const uint8_t* begin, const uint8_t* end)
+      : p_(begin), end_(end) {}
+
+  // Top the buffer up to more than 56 valid bits, input permitting.
+  void Refill();
+
+  uint64_t buffer() const { return buffer_; }
+  size_t buffer_len() const { return buffer_len_; }
+  void Consume(size_t bits) { buffer_len_ -= bits; }
+
+ private:
+  const uint8_t* p_;
+  const uint8_t* end_;
+  uint64_t buffer_ = 0;
+  size_t buffer_len_ = 0;
+  size_t staged_pos_ = 0;
+  size_t staged_size_ = 0;
+  uint8_t staged_[32];
+};
+
+// Decode huffman coded bytes in [begin, end), calling output(uint8_t) per
+// decoded byte. Returns false if the input is not a valid huffman coding of
+// some byte sequence. Functionally identical to HuffDecoder::Run(), but
+// decodes via an 8-bit-at-a-time level-one table over a chunk-refilled 64 bit
+// buffer: codes longer than 8 bits (all rare in header text) divert through
+// HuffDecodeLongSym.
+template <typename Out>
+bool HuffDecodeFast(Out output, const uint8_t* begin, const uint8_t* end) {
+  const HuffFastSym* const table = HuffFastSymTable();
+  HuffDecodeFastInput input(begin, end);
+  for (;;) {
+    input.Refill();
+    if (input.buffer_len() < 8) break;
+    while (input.buffer_len() >= 8) {
+      const HuffFastSym sym =
+          table[(input.buffer() >> (input.buffer_len() - 8)) & 0xff];
+      if (GPR_UNLIKELY(sym.len == 0)) {
+        input.Refill();
+        size_t consumed;
+        uint16_t emit;
+        if (!HuffDecodeLongSym(input.buffer(), input.buffer_len(), &consumed,
+                               &emit)) {
+          // No code fits: valid only if what remains is all-ones padding.
+          return (input.buffer() &
+                  ((uint64_t{1} << input.buffer_len()) - 1)) ==
+                 (uint64_t{1} << input.buffer_len()) - 1;
+        }
+        if (emit == 256) return true;  // EOS terminates the stream
+        output(static_cast<uint8_t>(emit));
+        input.Consume(consumed);
+        continue;
+      }
+      output(sym.emit);
+      input.Consume(sym.len);
+    }
+  }
+  // Fewer than 8 bits remain; short codes may still complete, after which the
+  // remainder must be a strict EOS prefix (RFC7541 section 5.2).
+  uint64_t buffer = input.buffer();
+  size_t buffer_len = input.buffer_len();
+  while (buffer_len >= 5) {
+    const size_t pad = 8 - buffer_len;
+    const HuffFastSym sym = table[((buffer << pad) | ((1u << pad) - 1)) & 0xff];
+    if (sym.len == 0 || sym.len > buffer_len) break;
+    output(sym.emit);
+    buffer_len -= sym.len;
+  }
+  return (buffer & ((1u << buffer_len) - 1)) == (1u << buffer_len) - 1;
+}
+
+}  // namespace grpc_core
+
+#endif  // GRPC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_DECODE_HUFF_FAST_H
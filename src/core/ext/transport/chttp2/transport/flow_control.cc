@@ -118,11 +118,18 @@ TransportFlowControl::TransportFlowControl(const char* name,
 uint32_t TransportFlowControl::MaybeSendUpdate(bool writing_anyway) {
   const uint32_t target_announced_window =
       static_cast<uint32_t>(target_window());
-  if ((writing_anyway || announced_window_ <= target_announced_window / 2) &&
-      announced_window_ != target_announced_window) {
-    const uint32_t announce =
-        static_cast<uint32_t>(Clamp(target_announced_window - announced_window_,
-                                    int64_t(0), kMaxWindowUpdateSize));
+  const int64_t pending =
+      static_cast<int64_t>(target_announced_window) - announced_window_;
+  // A WINDOW_UPDATE on every write cycle costs 13 bytes on the wire (and a
+  // frame parse at the peer) while restoring essentially no sender credit,
+  // so piggy-backed updates are deferred until at least an eighth of the
+  // window is pending. Urgent updates (window half drained) always go out.
+  if (pending > 0 &&
+      (announced_window_ <= target_announced_window / 2 ||
+       (writing_anyway &&
+        pending >= static_cast<int64_t>(target_announced_window / 8)))) {
+    const uint32_t announce = static_cast<uint32_t>(
+        Clamp(pending, int64_t(0), kMaxWindowUpdateSize));
     announced_window_ += announce;
     return announce;
   }
@@ -364,6 +371,14 @@ FlowControlAction TransportFlowControl::PeriodicUpdate() {
 uint32_t StreamFlowControl::MaybeSendUpdate() {
   TransportFlowControl::IncomingUpdateContext tfc_upd(tfc_);
   const int64_t announce = DesiredAnnounceSize();
+  // Defer sub-threshold updates entirely: they will be merged into a later,
+  // larger update once enough of the window has been consumed. An
+  // outstanding read always forces the pending update out, since the sender
+  // may be blocked on it.
+  if (min_progress_size_ == 0 && announce < DeferredUpdateThreshold()) {
+    tfc_upd.MakeAction();
+    return 0;
+  }
   pending_size_ = absl::nullopt;
   tfc_upd.UpdateAnnouncedWindowDelta(&announced_window_delta_, announce);
   GPR_ASSERT(DesiredAnnounceSize() == 0);
@@ -371,6 +386,15 @@ uint32_t StreamFlowControl::MaybeSendUpdate() {
   return static_cast<uint32_t>(announce);
 }
 
+int64_t StreamFlowControl::DeferredUpdateThreshold() const {
+  // An eighth of the stream's effective window. The window tracks the BDP
+  // estimate, so the threshold adapts with link capacity; the floor keeps
+  // small-window streams prompt.
+  const int64_t window = static_cast<int64_t>(tfc_->acked_init_window()) +
+                         std::max(int64_t(0), announced_window_delta_);
+  return std::max(window / 8, int64_t(1024));
+}
+
 int64_t StreamFlowControl::DesiredAnnounceSize() const {
   int64_t desired_window_delta = [this]() {
     if (min_progress_size_ == 0) {
@@ -381,7 +405,19 @@ int64_t StreamFlowControl::DesiredAnnounceSize() const {
         return announced_window_delta_;
       }
     } else {
-      return std::min(min_progress_size_, kMaxWindowDelta);
+      int64_t desired = min_progress_size_;
+      if (tfc_->bdp_probe()) {
+        // Per-stream autotuning: on high-BDP links the bdp-driven initial
+        // window target runs ahead of what the settings exchange has
+        // delivered. Grant an actively-reading stream the difference so a
+        // single stream can fill the link without waiting for the settings
+        // round trip. The target already accounts for memory pressure.
+        const int64_t bdp_lag =
+            tfc_->target_initial_window_size() -
+            static_cast<int64_t>(tfc_->acked_init_window());
+        if (bdp_lag > 0) desired = std::max(desired, bdp_lag);
+      }
+      return std::min(desired, kMaxWindowDelta);
     }
   }();
   return Clamp(desired_window_delta - announced_window_delta_, int64_t(0),
@@ -395,9 +431,13 @@ FlowControlAction StreamFlowControl::UpdateAction(FlowControlAction action) {
         desired_announce_size >= 8192) {
       action.set_send_stream_update(
           FlowControlAction::Urgency::UPDATE_IMMEDIATELY);
-    } else {
+    } else if (min_progress_size_ > 0 ||
+               desired_announce_size >= DeferredUpdateThreshold()) {
       action.set_send_stream_update(FlowControlAction::Urgency::QUEUE_UPDATE);
     }
+    // Otherwise stay silent: the pending update is below the deferral
+    // threshold and nothing is blocked on it, so emitting it now would just
+    // add frames to the wire.
   }
   return action;
 }
@@ -158,6 +158,9 @@ class TransportFlowControl final {
   // else returns zero; writing_anyway indicates if a write would happen
   // regardless of the send - if it is false and this function returns non-zero,
   // this announce will cause a write to occur
+  // Piggy-backed updates (writing_anyway == true) are suppressed until a
+  // meaningful fraction of the window is pending, so busy transports don't
+  // emit a near-empty WINDOW_UPDATE on every write cycle.
   uint32_t MaybeSendUpdate(bool writing_anyway);
 
   // Track an update to the incoming flow control counters - that is how many
@@ -232,6 +235,13 @@ class TransportFlowControl final {
 
   int64_t target_window() const;
   int64_t target_frame_size() const { return target_frame_size_; }
+  // The bdp-driven desired initial window size. This may run ahead of
+  // acked_init_window() while a settings update is in flight (or capped):
+  // stream flow control uses the difference to grant per-stream window
+  // beyond the acked initial window on high-BDP links.
+  int64_t target_initial_window_size() const {
+    return target_initial_window_size_;
+  }
 
   BdpEstimator* bdp_estimator() { return &bdp_estimator_; }
 
@@ -352,6 +362,9 @@ class StreamFlowControl final {
 
   // returns an announce if we should send a stream update to our peer, else
   // returns zero
+  // Updates below an adaptive fraction of the stream window are deferred
+  // (merged into a later, larger update) unless the application has an
+  // outstanding read that is waiting on the window.
   uint32_t MaybeSendUpdate();
 
   int64_t remote_window_delta() const { return remote_window_delta_; }
@@ -367,6 +380,7 @@ class StreamFlowControl final {
 
   FlowControlAction UpdateAction(FlowControlAction action);
   int64_t DesiredAnnounceSize() const;
+  int64_t DeferredUpdateThreshold() const;
 };
 
 class TestOnlyTransportTargetWindowEstimatesMocker {
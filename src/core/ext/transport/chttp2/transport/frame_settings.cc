@@ -86,9 +86,13 @@ grpc_slice grpc_chttp2_settings_create(uint32_t* old_settings,
   return output;
 }
 
-grpc_slice grpc_chttp2_settings_ack_create(void) {
-  grpc_slice output = GRPC_SLICE_MALLOC(9);
-  fill_header(GRPC_SLICE_START_PTR(output), 0, GRPC_CHTTP2_FLAG_ACK);
+grpc_slice grpc_chttp2_settings_ack_create(size_t count) {
+  grpc_slice output = GRPC_SLICE_MALLOC(9 * count);
+  uint8_t* p = GRPC_SLICE_START_PTR(output);
+  for (size_t i = 0; i < count; i++) {
+    p = fill_header(p, 0, GRPC_CHTTP2_FLAG_ACK);
+  }
+  GPR_ASSERT(p == GRPC_SLICE_END_PTR(output));
   return output;
 }
 
@@ -142,9 +146,15 @@ grpc_error_handle grpc_chttp2_settings_parser_parse(void* p,
             memcpy(parser->target_settings, parser->incoming_settings,
                    GRPC_CHTTP2_NUM_SETTINGS * sizeof(uint32_t));
             t->num_pending_induced_frames++;
-            grpc_slice_buffer_add(&t->qbuf, grpc_chttp2_settings_ack_create());
-            grpc_chttp2_initiate_write(t,
-                                       GRPC_CHTTP2_INITIATE_WRITE_SETTINGS_ACK);
+            // Acks are coalesced: the next write cycle emits one slice
+            // containing an ack per pending frame, so several SETTINGS
+            // frames arriving in one read batch cost a single write
+            // wakeup and a single allocation.
+            t->pending_settings_acks++;
+            if (t->pending_settings_acks == 1) {
+              grpc_chttp2_initiate_write(
+                  t, GRPC_CHTTP2_INITIATE_WRITE_SETTINGS_ACK);
+            }
             if (t->notify_on_receive_settings != nullptr) {
               grpc_core::ExecCtx::Run(DEBUG_LOCATION,
                                       t->notify_on_receive_settings,
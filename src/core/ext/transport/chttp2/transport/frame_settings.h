@@ -51,8 +51,9 @@ struct grpc_chttp2_settings_parser {
 grpc_slice grpc_chttp2_settings_create(uint32_t* old_settings,
                                        const uint32_t* new_settings,
                                        uint32_t force_mask, size_t count);
-/* Create an ack settings frame */
-grpc_slice grpc_chttp2_settings_ack_create(void);
+/* Create a slice containing \a count consecutive settings ack frames, one
+   per pending SETTINGS frame being acknowledged */
+grpc_slice grpc_chttp2_settings_ack_create(size_t count);
 
 grpc_error_handle grpc_chttp2_settings_parser_begin_frame(
     grpc_chttp2_settings_parser* parser, uint32_t length, uint8_t flags,
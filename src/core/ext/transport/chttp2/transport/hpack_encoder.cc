@@ -20,6 +20,8 @@
 
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
 
+#include <string.h>
+
 #include <algorithm>
 #include <cstdint>
 #include <memory>
@@ -154,6 +156,7 @@ uint8_t* HPackCompressor::Framer::AddTiny(size_t len) {
 }
 
 void HPackCompressor::Framer::EmitIndexed(uint32_t elem_index) {
+  ++compressor_->table_hits_since_adjust_;
   VarintWriter<1> w(elem_index);
   w.Write(0x80, AddTiny(w.length()));
 }
@@ -261,6 +264,7 @@ class StringKey {
 
 void HPackCompressor::Framer::EmitLitHdrWithNonBinaryStringKeyIncIdx(
     Slice key_slice, Slice value_slice) {
+  ++compressor_->table_misses_since_adjust_;
   StringKey key(std::move(key_slice));
   key.WritePrefix(0x40, AddTiny(key.prefix_length()));
   Add(key.key());
@@ -281,6 +285,7 @@ void HPackCompressor::Framer::EmitLitHdrWithBinaryStringKeyNotIdx(
 
 void HPackCompressor::Framer::EmitLitHdrWithBinaryStringKeyIncIdx(
     Slice key_slice, Slice value_slice) {
+  ++compressor_->table_misses_since_adjust_;
   StringKey key(std::move(key_slice));
   key.WritePrefix(0x40, AddTiny(key.prefix_length()));
   Add(key.key());
@@ -326,9 +331,12 @@ void HPackCompressor::SliceIndex::EmitTo(absl::string_view key,
                                                    value.Ref());
     return;
   }
-  // Linear scan through previous values to see if we find the value.
+  // Linear scan through previous values to see if we find the value. Calls
+  // created from one registered-call handle all ref a single slice, so check
+  // for shared backing storage first to recognize those repeats without
+  // walking the path/authority bytes.
   for (It it = values_.begin(); it != values_.end(); ++it) {
-    if (value == it->value) {
+    if (value.is_equivalent(it->value) || value == it->value) {
       // Got a hit... is it still in the decode table?
       if (table.ConvertableToDynamicIndex(it->index)) {
         // Yes, emit the index and proceed to cleanup.
@@ -382,7 +390,8 @@ void HPackCompressor::Framer::Encode(TeMetadata, TeMetadata::ValueType value) {
   GPR_ASSERT(value == TeMetadata::ValueType::kTrailers);
   EncodeAlwaysIndexed(
       &compressor_->te_index_, "te", Slice::FromStaticString("trailers"),
-      2 /* te */ + 8 /* trailers */ + hpack_constants::kEntryOverhead);
+      2 /* te */ + 8 /* trailers */ + hpack_constants::kEntryOverhead,
+      &compressor_->te_pre_encoded_);
 }
 
 void HPackCompressor::Framer::Encode(ContentTypeMetadata,
@@ -394,7 +403,8 @@ void HPackCompressor::Framer::Encode(ContentTypeMetadata,
   EncodeAlwaysIndexed(&compressor_->content_type_index_, "content-type",
                       Slice::FromStaticString("application/grpc"),
                       12 /* content-type */ + 16 /* application/grpc */ +
-                          hpack_constants::kEntryOverhead);
+                          hpack_constants::kEntryOverhead,
+                      &compressor_->content_type_pre_encoded_);
 }
 
 void HPackCompressor::Framer::Encode(HttpSchemeMetadata,
@@ -479,16 +489,40 @@ void HPackCompressor::Framer::Encode(HttpMethodMetadata,
   }
 }
 
+// Build the full wire bytes of a non-binary incremental-indexing literal, so
+// re-insertions of a channel-constant element reduce to one memcpy.
+static Slice PreEncodeLitHdrWithNonBinaryStringKeyIncIdx(absl::string_view key,
+                                                         const Slice& value) {
+  VarintWriter<1> len_key(key.length());
+  VarintWriter<1> len_val(value.length());
+  auto pre_encoded = MutableSlice::CreateUninitialized(
+      1 + len_key.length() + key.length() + len_val.length() + value.length());
+  uint8_t* p = pre_encoded.begin();
+  *p++ = 0x40;
+  len_key.Write(0x00, p);
+  p += len_key.length();
+  memcpy(p, key.data(), key.length());
+  p += key.length();
+  len_val.Write(0x00, p);
+  p += len_val.length();
+  memcpy(p, value.data(), value.length());
+  return Slice(std::move(pre_encoded));
+}
+
 void HPackCompressor::Framer::EncodeAlwaysIndexed(uint32_t* index,
                                                   absl::string_view key,
                                                   Slice value,
-                                                  size_t transport_length) {
+                                                  size_t transport_length,
+                                                  Slice* pre_encoded) {
   if (compressor_->table_.ConvertableToDynamicIndex(*index)) {
     EmitIndexed(compressor_->table_.DynamicIndex(*index));
   } else {
     *index = compressor_->table_.AllocateIndex(transport_length);
-    EmitLitHdrWithNonBinaryStringKeyIncIdx(Slice::FromStaticString(key),
-                                           std::move(value));
+    ++compressor_->table_misses_since_adjust_;
+    if (pre_encoded->empty()) {
+      *pre_encoded = PreEncodeLitHdrWithNonBinaryStringKeyIncIdx(key, value);
+    }
+    Add(pre_encoded->Ref());
   }
 }
 
@@ -559,11 +593,13 @@ void HPackCompressor::Framer::Encode(UserAgentMetadata, const Slice& slice) {
   if (!slice.is_equivalent(compressor_->user_agent_)) {
     compressor_->user_agent_ = slice.Ref();
     compressor_->user_agent_index_ = 0;
+    compressor_->user_agent_pre_encoded_ = Slice();
   }
   EncodeAlwaysIndexed(&compressor_->user_agent_index_, UserAgentMetadata::key(),
                       slice.Ref(),
                       hpack_constants::SizeForEntry(
-                          UserAgentMetadata::key().size(), slice.size()));
+                          UserAgentMetadata::key().size(), slice.size()),
+                      &compressor_->user_agent_pre_encoded_);
 }
 
 void HPackCompressor::Framer::Encode(GrpcStatusMetadata,
@@ -636,19 +672,95 @@ void HPackCompressor::Framer::Encode(GrpcAcceptEncodingMetadata,
 
 void HPackCompressor::SetMaxUsableSize(uint32_t max_table_size) {
   max_usable_size_ = max_table_size;
-  SetMaxTableSize(std::min(table_.max_size(), max_table_size));
+  UpdateMaxTableSize(std::min(table_.max_size(), max_table_size));
 }
 
 void HPackCompressor::SetMaxTableSize(uint32_t max_table_size) {
-  if (table_.SetMaxSize(std::min(max_usable_size_, max_table_size))) {
+  peer_max_table_size_ = max_table_size;
+  // Mandated shrinks apply immediately; growth beyond the current size waits
+  // for hit-rate evidence (see MaybeAdjustTableSize) so channels with small
+  // header working sets keep the spec-default footprint.
+  UpdateMaxTableSize(std::min(
+      max_table_size,
+      std::max(table_.max_size(), hpack_constants::kInitialTableSize)));
+}
+
+void HPackCompressor::UpdateMaxTableSize(uint32_t target) {
+  if (table_.SetMaxSize(std::min(max_usable_size_, target))) {
     advertise_table_size_change_ = true;
     if (GRPC_TRACE_FLAG_ENABLED(grpc_http_trace)) {
-      gpr_log(GPR_INFO, "set max table size from encoder to %d",
-              max_table_size);
+      gpr_log(GPR_INFO, "set max table size from encoder to %d", target);
     }
   }
 }
 
+void HPackCompressor::MaybeAdjustTableSize() {
+  // Revisit the table size every this-many emissions.
+  static constexpr uint32_t kAdjustmentInterval = 1024;
+  // Grow when more than 1 in this-many emissions was an insertion.
+  static constexpr uint32_t kGrowthMissRate = 8;
+  const uint32_t samples =
+      table_hits_since_adjust_ + table_misses_since_adjust_;
+  if (samples < kAdjustmentInterval) return;
+  const uint32_t ceiling = std::min(peer_max_table_size_, max_usable_size_);
+  if (table_misses_since_adjust_ > samples / kGrowthMissRate &&
+      table_.max_size() < ceiling) {
+    // The channel's header working set is being evicted before it can be
+    // reused: grow toward the peer's limit.
+    UpdateMaxTableSize(std::min(ceiling, 2 * table_.max_size()));
+  }
+  table_hits_since_adjust_ = 0;
+  table_misses_since_adjust_ = 0;
+}
+
+void HPackCompressor::ServerInitialMetadataCache::Splice(
+    const EncodeHeaderOptions& options, grpc_slice_buffer* output) const {
+  grpc_slice slice = grpc_slice_from_copied_buffer(frames_.data(),
+                                                   frames_.size());
+  // Patch the cached frame headers with this stream's id; everything else
+  // (lengths, types, flags, header block fragments) is stream-independent.
+  uint8_t* p = GRPC_SLICE_START_PTR(slice);
+  size_t offset = 0;
+  while (offset < frames_.size()) {
+    const size_t len = (static_cast<size_t>(p[offset]) << 16) |
+                       (static_cast<size_t>(p[offset + 1]) << 8) |
+                       static_cast<size_t>(p[offset + 2]);
+    p[offset + 5] = static_cast<uint8_t>(options.stream_id >> 24);
+    p[offset + 6] = static_cast<uint8_t>(options.stream_id >> 16);
+    p[offset + 7] = static_cast<uint8_t>(options.stream_id >> 8);
+    p[offset + 8] = static_cast<uint8_t>(options.stream_id);
+    offset += kDataFrameHeaderSize + len;
+  }
+  grpc_slice_buffer_add(output, slice);
+  options.stats->framing_bytes += frame_count_ * kDataFrameHeaderSize;
+  options.stats->header_bytes +=
+      frames_.size() - frame_count_ * kDataFrameHeaderSize;
+}
+
+void HPackCompressor::ServerInitialMetadataCache::Store(
+    std::string repr, const grpc_slice_buffer& frames, uint64_t generation,
+    size_t max_frame_size, bool use_true_binary_metadata) {
+  repr_ = std::move(repr);
+  frames_.clear();
+  for (size_t i = 0; i < frames.count; i++) {
+    auto view = StringViewFromSlice(frames.slices[i]);
+    frames_.append(view.data(), view.size());
+  }
+  frame_count_ = 0;
+  for (size_t offset = 0; offset < frames_.size();) {
+    const size_t len =
+        (static_cast<size_t>(static_cast<uint8_t>(frames_[offset])) << 16) |
+        (static_cast<size_t>(static_cast<uint8_t>(frames_[offset + 1])) << 8) |
+        static_cast<size_t>(static_cast<uint8_t>(frames_[offset + 2]));
+    frame_count_++;
+    offset += kDataFrameHeaderSize + len;
+  }
+  generation_ = generation;
+  max_frame_size_ = max_frame_size;
+  use_true_binary_metadata_ = use_true_binary_metadata;
+  valid_ = true;
+}
+
 HPackCompressor::Framer::Framer(const EncodeHeaderOptions& options,
                                 HPackCompressor* compressor,
                                 grpc_slice_buffer* output)
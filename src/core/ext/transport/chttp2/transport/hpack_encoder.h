@@ -24,6 +24,7 @@
 #include <stddef.h>
 
 #include <cstdint>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -32,14 +33,17 @@
 
 #include <grpc/impl/codegen/compression_types.h>
 #include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
 #include <grpc/status.h>
 
 #include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder_table.h"
 #include "src/core/lib/compression/compression_internal.h"
+#include "src/core/lib/debug/call_stage_profiler.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/transport/metadata_batch.h"
 #include "src/core/lib/transport/timeout_encoding.h"
 #include "src/core/lib/transport/transport.h"
@@ -76,8 +80,63 @@ class HPackCompressor {
   template <typename HeaderSet>
   void EncodeHeaders(const EncodeHeaderOptions& options,
                      const HeaderSet& headers, grpc_slice_buffer* output) {
+    ScopedCallStageTimer timer(CallStage::kMetadataEncode);
+    MaybeAdjustTableSize();
+    const size_t traversals_before = headers.TraversalCount();
     Framer framer(options, this, output);
     headers.Encode(&framer);
+    // Size estimation, encoding and framing all happen in the one walk above;
+    // anything that reintroduces a second traversal per send trips this.
+    GPR_DEBUG_ASSERT(headers.TraversalCount() == traversals_before + 1);
+  }
+
+  // Variant of EncodeHeaders for server initial metadata, which for most
+  // servers is identical on every call of a connection's lifetime
+  // (content-type plus the encoding advertisement). The framed encoding is
+  // cached alongside a byte-exact representation of the batch and the
+  // encoder table generation; while neither changes, subsequent sends
+  // splice the prebuilt frames (patching in the stream id) instead of
+  // re-walking the metadata through the emitters.
+  template <typename HeaderSet>
+  void EncodeServerInitialHeaders(const EncodeHeaderOptions& options,
+                                  const HeaderSet& headers,
+                                  grpc_slice_buffer* output) {
+    ScopedCallStageTimer timer(CallStage::kMetadataEncode);
+    MaybeAdjustTableSize();
+    MetadataReprBuilder repr;
+    // A pending table size advertisement must be emitted inside the next
+    // header block, so cached frames (which contain none) cannot be used.
+    if (!advertise_table_size_change_) headers.Encode(&repr);
+    if (advertise_table_size_change_ || !repr.cacheable()) {
+      Framer framer(options, this, output);
+      headers.Encode(&framer);
+      return;
+    }
+    if (server_initial_metadata_cache_.Matches(
+            repr.repr(), table_.generation(), options.max_frame_size,
+            options.use_true_binary_metadata)) {
+      server_initial_metadata_cache_.Splice(options, output);
+      // Spliced emissions are indexed emissions for table sizing purposes.
+      table_hits_since_adjust_ +=
+          static_cast<uint32_t>(repr.element_count());
+      return;
+    }
+    // Miss: encode into a scratch buffer so the framed bytes can be
+    // captured for the next call, then hand them to the output.
+    SliceBuffer scratch;
+    const uint64_t generation_before = table_.generation();
+    {
+      Framer framer(options, this, scratch.c_slice_buffer());
+      headers.Encode(&framer);
+    }
+    // Only cacheable if encoding did not itself mutate the table (once the
+    // working set is resident, it does not).
+    if (table_.generation() == generation_before) {
+      server_initial_metadata_cache_.Store(
+          repr.TakeRepr(), *scratch.c_slice_buffer(), table_.generation(),
+          options.max_frame_size, options.use_true_binary_metadata);
+    }
+    grpc_slice_buffer_move_into(scratch.c_slice_buffer(), output);
   }
 
   class Framer {
@@ -150,7 +209,8 @@ class HPackCompressor {
                                                 Slice value_slice);
 
     void EncodeAlwaysIndexed(uint32_t* index, absl::string_view key,
-                             Slice value, size_t transport_length);
+                             Slice value, size_t transport_length,
+                             Slice* pre_encoded);
     void EncodeIndexedKeyWithBinaryValue(uint32_t* index, absl::string_view key,
                                          Slice value);
 
@@ -179,12 +239,118 @@ class HPackCompressor {
   static constexpr size_t kNumFilterValues = 64;
   static constexpr uint32_t kNumCachedGrpcStatusValues = 16;
 
+  // Builds a byte-exact representation of a metadata batch for comparison
+  // against the cached server initial metadata. Element types that vary
+  // per call (timeouts) or that we do not enumerate here simply mark the
+  // batch uncacheable, which falls back to a normal encode.
+  class MetadataReprBuilder {
+   public:
+    void Encode(const Slice& key, const Slice& value) {
+      MixBytes(key.as_string_view());
+      MixBytes(value.as_string_view());
+      element_count_++;
+    }
+    void Encode(HttpStatusMetadata, uint32_t status) {
+      MixBytes(HttpStatusMetadata::key());
+      MixInt(status);
+      element_count_++;
+    }
+    void Encode(ContentTypeMetadata, ContentTypeMetadata::ValueType value) {
+      MixBytes(ContentTypeMetadata::key());
+      MixInt(static_cast<uint64_t>(value));
+      element_count_++;
+    }
+    void Encode(GrpcEncodingMetadata, grpc_compression_algorithm value) {
+      MixBytes(GrpcEncodingMetadata::key());
+      MixInt(static_cast<uint64_t>(value));
+      element_count_++;
+    }
+    void Encode(GrpcAcceptEncodingMetadata, CompressionAlgorithmSet value) {
+      MixBytes(GrpcAcceptEncodingMetadata::key());
+      MixInt(value.ToLegacyBitmask());
+      element_count_++;
+    }
+    template <typename Which, typename Value>
+    void Encode(Which, const Value&) {
+      cacheable_ = false;
+    }
+
+    bool cacheable() const { return cacheable_; }
+    absl::string_view repr() const { return repr_; }
+    std::string TakeRepr() { return std::move(repr_); }
+    size_t element_count() const { return element_count_; }
+
+   private:
+    void MixBytes(absl::string_view bytes) {
+      const uint64_t length = bytes.size();
+      repr_.append(reinterpret_cast<const char*>(&length), sizeof(length));
+      repr_.append(bytes.data(), bytes.size());
+    }
+    void MixInt(uint64_t value) {
+      repr_.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    std::string repr_;
+    size_t element_count_ = 0;
+    bool cacheable_ = true;
+  };
+
+  // The last cacheable server initial metadata batch this compressor
+  // encoded, as framed wire bytes. Valid while the encoder table
+  // generation is unchanged; the stream id in the cached frame headers is
+  // patched on each splice.
+  class ServerInitialMetadataCache {
+   public:
+    // The framing also depends on the peer's SETTINGS_MAX_FRAME_SIZE and
+    // the true-binary negotiation, so both are part of the key: a cached
+    // frame spliced after the peer lowered its frame size limit would be a
+    // protocol violation.
+    bool Matches(absl::string_view repr, uint64_t generation,
+                 size_t max_frame_size, bool use_true_binary_metadata) const {
+      return valid_ && generation == generation_ &&
+             max_frame_size == max_frame_size_ &&
+             use_true_binary_metadata == use_true_binary_metadata_ &&
+             repr == repr_;
+    }
+    // Appends the cached frames to output with options.stream_id patched
+    // in, updating options.stats as a normal encode would.
+    void Splice(const EncodeHeaderOptions& options,
+                grpc_slice_buffer* output) const;
+    void Store(std::string repr, const grpc_slice_buffer& frames,
+               uint64_t generation, size_t max_frame_size,
+               bool use_true_binary_metadata);
+
+   private:
+    std::string repr_;
+    std::string frames_;
+    size_t frame_count_ = 0;
+    uint64_t generation_ = 0;
+    size_t max_frame_size_ = 0;
+    bool use_true_binary_metadata_ = false;
+    bool valid_ = false;
+  };
+
+  // Apply target (clamped to max_usable_size_) to the encoder table,
+  // scheduling a table size update advertisement if it changed.
+  void UpdateMaxTableSize(uint32_t target);
+  // Grow the table toward the peer's limit if recent emissions show the
+  // channel's header working set being evicted before reuse. Called between
+  // header blocks so any size change is advertised before it is used.
+  void MaybeAdjustTableSize();
+
   // maximum number of bytes we'll use for the decode table (to guard against
   // peers ooming us by setting decode table size high)
   uint32_t max_usable_size_ = hpack_constants::kInitialTableSize;
   // if non-zero, advertise to the decoder that we'll start using a table
   // of this size
   bool advertise_table_size_change_ = false;
+  // the peer's advertised SETTINGS_HEADER_TABLE_SIZE: the hard ceiling for
+  // adaptive table growth
+  uint32_t peer_max_table_size_ = hpack_constants::kInitialTableSize;
+  // emission outcomes since the last sizing adjustment: indexed emissions
+  // are hits, insertions are misses (evidence the working set didn't fit)
+  uint32_t table_hits_since_adjust_ = 0;
+  uint32_t table_misses_since_adjust_ = 0;
   HPackEncoderTable table_;
 
   class SliceIndex {
@@ -226,9 +392,17 @@ class HPackCompressor {
   uint32_t grpc_trace_bin_index_ = 0;
   // The user-agent string referred to by user_agent_index_
   Slice user_agent_;
+  // Pre-encoded incremental-indexing literal representations for elements
+  // whose key and value are constant for the channel lifetime: built on
+  // first emission and memcpy'd on every subsequent (re)insertion into the
+  // dynamic table, skipping the varint and string walking in the emitters.
+  Slice te_pre_encoded_;
+  Slice content_type_pre_encoded_;
+  Slice user_agent_pre_encoded_;
   SliceIndex path_index_;
   SliceIndex authority_index_;
   std::vector<PreviousTimeout> previous_timeouts_;
+  ServerInitialMetadataCache server_initial_metadata_cache_;
 };
 
 }  // namespace grpc_core
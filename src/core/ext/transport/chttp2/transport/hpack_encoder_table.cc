@@ -23,6 +23,7 @@
 namespace grpc_core {
 
 uint32_t HPackEncoderTable::AllocateIndex(size_t element_size) {
+  generation_++;
   uint32_t new_index = tail_remote_index_ + table_elems_ + 1;
   GPR_DEBUG_ASSERT(element_size <= MaxEntrySize());
 
@@ -52,6 +53,7 @@ bool HPackEncoderTable::SetMaxSize(uint32_t max_table_size) {
   if (max_table_size == max_table_size_) {
     return false;
   }
+  generation_++;
   while (table_size_ > 0 && table_size_ > max_table_size) {
     EvictOne();
   }
@@ -51,6 +51,12 @@ class HPackEncoderTable {
   // Get the current table size
   uint32_t test_only_table_size() const { return table_size_; }
 
+  // Monotonic count of table mutations (insertions, evictions, size
+  // changes). A previously encoded header block that references the
+  // dynamic table remains byte-for-byte valid only while the generation
+  // is unchanged.
+  uint64_t generation() const { return generation_; }
+
   // Convert an element index into a dynamic index
   uint32_t DynamicIndex(uint32_t index) const {
     return 1 + hpack_constants::kLastStaticEntry + tail_remote_index_ +
@@ -70,6 +76,7 @@ class HPackEncoderTable {
   uint32_t max_table_size_ = hpack_constants::kInitialTableSize;
   uint32_t table_elems_ = 0;
   uint32_t table_size_ = 0;
+  uint64_t generation_ = 0;
   // The size of each element in the HPACK table.
   absl::InlinedVector<EntrySize, hpack_constants::kInitialTableEntries>
       elem_size_;
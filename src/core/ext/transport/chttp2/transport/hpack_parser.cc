@@ -44,6 +44,7 @@
 #include <grpc/support/log.h>
 
 #include "src/core/ext/transport/chttp2/transport/decode_huff.h"
+#include "src/core/ext/transport/chttp2/transport/decode_huff_fast.h"
 #include "src/core/ext/transport/chttp2/transport/frame_rst_stream.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
 #include "src/core/ext/transport/chttp2/transport/internal.h"
@@ -773,6 +774,9 @@ class HPackParser::String {
     const uint8_t* p = input->cur_ptr();
     input->Advance(length);
     if (IsNewHpackHuffmanDecoderEnabled()) {
+      if (length >= kHuffDecodeFastMinBytes) {
+        return HuffDecodeFast<Out>(output, p, p + length);
+      }
       return HuffDecoder<Out>(output, p, p + length).Run();
     } else {
       int16_t state = 0;
@@ -1297,6 +1301,43 @@ grpc_error_handle HPackParser::ParseInput(Input input, bool is_last) {
   return input.TakeError();
 }
 
+bool HPackParser::ScanFieldIndex(const Input& input, FieldIndex* index) {
+  // Scan over a copy: the scan must not disturb the real input's position or
+  // error state.
+  Input scan = input;
+  auto skip_string = [&scan]() {
+    auto prefix = scan.ParseStringPrefix();
+    if (!prefix.has_value()) return false;
+    if (scan.remaining() < prefix->length) return false;
+    scan.Advance(prefix->length);
+    return true;
+  };
+  while (!scan.end_of_stream()) {
+    const uint32_t offset =
+        static_cast<uint32_t>(scan.cur_ptr() - input.cur_ptr());
+    const uint8_t cur = *scan.Next();
+    if (cur >= 0x80) {
+      // Indexed field: varint encoded index iff all prefix bits are set
+      if (cur == 0xff && !scan.ParseVarint(0x7f).has_value()) return false;
+    } else if ((cur & 0xe0) == 0x20) {
+      // Max table size update
+      if (cur == 0x3f && !scan.ParseVarint(0x1f).has_value()) return false;
+    } else {
+      // Literal field: (indexed or literal) key, then value
+      const uint8_t mask = (cur & 0x40) != 0 ? 0x3f : 0x0f;
+      const uint8_t key_index = cur & mask;
+      if (key_index == 0) {
+        if (!skip_string()) return false;
+      } else if (key_index == mask) {
+        if (!scan.ParseVarint(mask).has_value()) return false;
+      }
+      if (!skip_string()) return false;
+    }
+    index->entries.push_back(FieldIndex::Entry{offset, cur});
+  }
+  return true;
+}
+
 bool HPackParser::ParseInputInner(Input* input) {
   switch (priority_) {
     case Priority::None:
@@ -1308,6 +1349,19 @@ bool HPackParser::ParseInputInner(Input* input) {
       priority_ = Priority::None;
     }
   }
+  // Batched mode: if a structural scan shows the input holds a whole number
+  // of fields, materialize them in one pass with a single parser instance
+  // and no per-field frontier bookkeeping - an EOF mid-field is impossible.
+  FieldIndex index;
+  if (ScanFieldIndex(*input, &index)) {
+    Parser parser(input, metadata_buffer_, metadata_size_limit_, &table_,
+                  &dynamic_table_updates_allowed_, &frame_length_, log_info_);
+    for (size_t i = 0; i < index.entries.size(); i++) {
+      if (GPR_UNLIKELY(!parser.Parse())) return false;
+    }
+    input->UpdateFrontier();
+    return true;
+  }
   while (!input->end_of_stream()) {
     if (GPR_UNLIKELY(!Parser(input, metadata_buffer_, metadata_size_limit_,
                              &table_, &dynamic_table_updates_allowed_,
@@ -102,8 +102,26 @@ class HPackParser {
   class Input;
   class String;
 
+  // A compact per-field index over a fully buffered HEADERS payload: one
+  // entry per field recording its opcode byte and offset. Built by a cheap
+  // structural scan (no table, huffman, or arena work) so that
+  // materialization can run over the whole frame in one uninterrupted pass.
+  struct FieldIndex {
+    struct Entry {
+      // Offset of the field's first byte within the scanned input
+      uint32_t offset;
+      // The field's leading byte: classifies the representation
+      uint8_t opcode;
+    };
+    std::vector<Entry> entries;
+  };
+
   grpc_error_handle ParseInput(Input input, bool is_last);
   bool ParseInputInner(Input* input);
+  // Structurally scan input, filling index with one entry per field.
+  // Returns false (leaving input untouched) if the input does not contain a
+  // whole number of fields - the incremental parse path handles that case.
+  bool ScanFieldIndex(const Input& input, FieldIndex* index);
 
   // Target metadata buffer
   grpc_metadata_batch* metadata_buffer_ = nullptr;
@@ -51,6 +51,7 @@
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/combiner.h"
@@ -136,6 +137,53 @@ const char* grpc_chttp2_initiate_write_reason_string(
 struct grpc_chttp2_ping_queue {
   grpc_closure_list lists[GRPC_CHTTP2_PCL_COUNT] = {};
   uint64_t inflight_id = 0;
+  /** when the inflight ping was queued for the wire: the base for RTT
+      measurement when its ack arrives */
+  grpc_core::Timestamp inflight_sent_time = grpc_core::Timestamp::InfPast();
+};
+/** HDR-style latency histogram: power-of-two millisecond buckets covering
+    1ms..~2 minutes. Updated on the combiner, so no synchronization; reported
+    percentiles are bucket upper bounds. Used to track PING round trips and
+    endpoint write (stall) durations per transport. */
+struct grpc_chttp2_latency_histogram {
+  static constexpr size_t kNumBuckets = 18;
+  uint64_t buckets[kNumBuckets] = {};
+  uint64_t count = 0;
+  grpc_core::Duration max = grpc_core::Duration::Zero();
+  void Increment(grpc_core::Duration sample);
+  /** percentile (0..100) as an upper bound; Zero if no samples */
+  grpc_core::Duration Percentile(double percentile) const;
+};
+
+/** Cumulative attribution of why the write path could not make progress.
+    Mirrors what flow control already tracks internally but, unlike it, is
+    exported through the channelz socket node. All fields are only touched
+    from the write path, so no synchronization is needed. */
+struct grpc_chttp2_write_stall_stats {
+  /** streams that could not flush data because the transport-level flow
+      control window was exhausted, and the bytes left pending when the
+      stall was recorded */
+  int64_t transport_window_stalls = 0;
+  int64_t transport_window_stalled_bytes = 0;
+  /** cumulative time with at least one stream parked on the
+      stalled-by-transport list */
+  grpc_core::Duration transport_window_stalled_time =
+      grpc_core::Duration::Zero();
+  grpc_core::Timestamp transport_window_stall_start =
+      grpc_core::Timestamp::InfPast();
+  /** same, for the per-stream flow control window */
+  int64_t stream_window_stalls = 0;
+  int64_t stream_window_stalled_bytes = 0;
+  grpc_core::Duration stream_window_stalled_time = grpc_core::Duration::Zero();
+  grpc_core::Timestamp stream_window_stall_start =
+      grpc_core::Timestamp::InfPast();
+  /** time and bytes spent in endpoint writes: dominated by waiting for TCP
+      buffer space when the endpoint is the bottleneck */
+  grpc_core::Duration endpoint_write_time = grpc_core::Duration::Zero();
+  int64_t endpoint_write_bytes = 0;
+  /** write cycles that found nothing to send: the transport was starved of
+      data rather than stalled */
+  int64_t no_data_write_cycles = 0;
 };
 struct grpc_chttp2_repeated_ping_policy {
   int max_pings_without_data;
@@ -291,6 +339,14 @@ struct grpc_chttp2_transport {
                            const void* server_data);
   void* accept_stream_cb_user_data;
 
+  /** callback invoked (under the combiner) when a new stream cannot be
+      started because the peer's MAX_CONCURRENT_STREAMS limit has been
+      reached; reported at most once per saturation episode */
+  void (*streams_saturated_cb)(void* user_data) = nullptr;
+  void* streams_saturated_cb_user_data = nullptr;
+  /** whether saturation has been reported since a stream last started */
+  bool reported_stream_saturation = false;
+
   /** connectivity tracking */
   grpc_core::ConnectivityStateTracker state_tracker;
 
@@ -332,6 +388,10 @@ struct grpc_chttp2_transport {
   /** last new stream id */
   uint32_t last_new_stream_id = 0;
 
+  /** weighted fair queuing virtual clock for the writable stream list:
+      advanced to the finish time of each dequeued stream */
+  uint64_t wfq_virtual_time = 0;
+
   /** ping queues for various ping insertion points */
   grpc_chttp2_ping_queue ping_queue = grpc_chttp2_ping_queue();
   grpc_chttp2_repeated_ping_policy ping_policy;
@@ -345,6 +405,25 @@ struct grpc_chttp2_transport {
   uint64_t* ping_acks = nullptr;
   grpc_chttp2_server_ping_recv_state ping_recv_state;
 
+  /** PING round trip times observed on this transport, for detecting
+      degraded network paths without packet captures */
+  grpc_chttp2_latency_histogram ping_rtt_histogram;
+  /** durations of endpoint writes: long samples indicate the endpoint
+      stalling on TCP buffer space */
+  grpc_chttp2_latency_histogram write_stall_histogram;
+  /** start time of the endpoint write currently in flight */
+  grpc_core::Timestamp write_action_start_time =
+      grpc_core::Timestamp::InfPast();
+  /** bytes handed to the endpoint by the write currently in flight */
+  size_t write_in_flight_bytes = 0;
+  /** adaptive cap on how many bytes a single write cycle queues to the
+      endpoint (see target_write_size in writing.cc): doubled while
+      full-sized writes complete quickly, halved when endpoint writes take
+      long enough to indicate blocking on socket buffer space */
+  uint32_t target_write_size = 1024 * 1024;
+  /** why the write path could not make progress, for channelz export */
+  grpc_chttp2_write_stall_stats write_stall_stats;
+
   /** parser for headers */
   grpc_core::HPackParser hpack_parser;
   /** simple one shot parsers */
@@ -382,6 +461,24 @@ struct grpc_chttp2_transport {
 
   grpc_chttp2_write_cb* write_cb_pool = nullptr;
 
+  /** heap slice arrays recycled between per-stream slice buffers on this
+      transport: a stream that grew frame_storage or flow_controlled_buffer
+      past the inline capacity donates the array here on destruction, and
+      later streams adopt it instead of re-growing from the inline array.
+      (The stream objects themselves live in call arenas and cannot be
+      pooled by the transport.) */
+  struct CachedSliceArray {
+    grpc_slice* slices;
+    size_t capacity;
+  };
+  static constexpr size_t kMaxCachedSliceArrays = 8;
+  // Guards the cache: adoption happens in init_stream on the call-creation
+  // thread while donation runs under the transport combiner.
+  grpc_core::Mutex cached_slice_array_mu;
+  CachedSliceArray cached_slice_arrays[kMaxCachedSliceArrays] ABSL_GUARDED_BY(
+      cached_slice_array_mu) = {};
+  size_t cached_slice_array_count ABSL_GUARDED_BY(cached_slice_array_mu) = 0;
+
   /* bdp estimator */
   bool bdp_ping_blocked =
       false; /* Is the BDP blocked due to not receiving any data? */
@@ -436,6 +533,10 @@ struct grpc_chttp2_transport {
   /** keep-alive state machine state */
   grpc_chttp2_keepalive_state keepalive_state;
   grpc_core::ContextList* cl = nullptr;
+  /** whether every stream write is traced through kernel TX timestamps and
+      reported as byte-ACK latency on the channelz socket
+      (GRPC_ARG_HTTP2_TX_BYTE_LATENCY_TRACING) */
+  bool tx_byte_latency_tracing = false;
   grpc_core::RefCountedPtr<grpc_core::channelz::SocketNode> channelz_socket;
   uint32_t num_messages_in_next_write = 0;
   /** The number of pending induced frames (SETTINGS_ACK, PINGS_ACK and
@@ -445,6 +546,14 @@ struct grpc_chttp2_transport {
    * thereby reducing the number of induced frames. */
   uint32_t num_pending_induced_frames = 0;
   bool reading_paused_on_pending_induced_frames = false;
+  /** Number of received SETTINGS frames that have not been acknowledged
+   * yet. The next write cycle acknowledges them all with a single slice of
+   * consecutive ack frames. */
+  uint32_t pending_settings_acks = 0;
+  /** The constructor defers the connection-preface write until reading
+   * starts, so our settings, the initial window update and any HEADERS
+   * already queued by that point share one endpoint write. */
+  bool initial_write_pending = false;
 };
 
 typedef enum {
@@ -565,6 +674,16 @@ struct grpc_chttp2_stream {
   bool traced = false;
   /** Byte counter for number of bytes written */
   size_t byte_counter = 0;
+
+  /** Weighted fair queuing: virtual time at which this stream's most recent
+      data write finished. Streams with earlier finish times are dequeued from
+      the writable list first, so a stream with a large flow controlled buffer
+      cannot monopolize write cycles. */
+  uint64_t wfq_finish_time = 0;
+  /** Relative write scheduling weight (defaults to the HTTP/2 default
+      priority weight). Heavier streams are charged proportionally less
+      virtual time per byte written. */
+  uint16_t write_weight = 16;
 };
 
 /** Transport writing call flow:
@@ -605,6 +724,12 @@ bool grpc_chttp2_list_add_writable_stream(grpc_chttp2_transport* t,
     returns non-zero if there was a stream available */
 bool grpc_chttp2_list_pop_writable_stream(grpc_chttp2_transport* t,
                                           grpc_chttp2_stream** s);
+/** Get the writable stream with the earliest weighted-fair-queuing virtual
+    finish time. Scans a bounded window at the head of the writable list so
+    dequeue cost stays constant in the number of writable streams.
+    returns non-zero if there was a stream available */
+bool grpc_chttp2_list_pop_writable_stream_wfq(grpc_chttp2_transport* t,
+                                              grpc_chttp2_stream** s);
 bool grpc_chttp2_list_remove_writable_stream(grpc_chttp2_transport* t,
                                              grpc_chttp2_stream* s);
 
@@ -181,6 +181,22 @@ grpc_error_handle grpc_chttp2_perform_read(grpc_chttp2_transport* t,
       ABSL_FALLTHROUGH_INTENDED;
     case GRPC_DTS_FH_0:
       GPR_DEBUG_ASSERT(cur < end);
+      /* Fast path: all nine frame header bytes are contiguous in this slice
+         (the overwhelmingly common case), so decode them directly instead of
+         stepping the per-byte resumption states. */
+      if (GPR_LIKELY(end - cur >= 9)) {
+        t->incoming_frame_size = ((static_cast<uint32_t>(cur[0])) << 16) |
+                                 ((static_cast<uint32_t>(cur[1])) << 8) |
+                                 (static_cast<uint32_t>(cur[2]));
+        t->incoming_frame_type = cur[3];
+        t->incoming_frame_flags = cur[4];
+        t->incoming_stream_id = (((static_cast<uint32_t>(cur[5])) & 0x7f)
+                                 << 24) |
+                                ((static_cast<uint32_t>(cur[6])) << 16) |
+                                ((static_cast<uint32_t>(cur[7])) << 8);
+        cur += 8; /* the GRPC_DTS_FH_8 state consumes the final byte */
+        goto dts_fh_8;
+      }
       t->incoming_frame_size = (static_cast<uint32_t>(*cur)) << 16;
       if (++cur == end) {
         t->deframe_state = GRPC_DTS_FH_1;
@@ -244,6 +260,7 @@ grpc_error_handle grpc_chttp2_perform_read(grpc_chttp2_transport* t,
       }
       ABSL_FALLTHROUGH_INTENDED;
     case GRPC_DTS_FH_8:
+    dts_fh_8:
       GPR_DEBUG_ASSERT(cur < end);
       t->incoming_stream_id |= (static_cast<uint32_t>(*cur));
       t->deframe_state = GRPC_DTS_FRAME;
@@ -432,6 +449,9 @@ static grpc_error_handle init_data_frame_parser(grpc_chttp2_transport* t) {
   if (bdp_est) {
     if (t->bdp_ping_blocked) {
       t->bdp_ping_blocked = false;
+      // Traffic resumed after an idle period: re-probe aggressively, since
+      // the path may have changed while we were quiesced.
+      bdp_est->ResumeProbing();
       GRPC_CHTTP2_REF_TRANSPORT(t, "bdp_ping");
       schedule_bdp_ping_locked(t);
     }
@@ -151,6 +151,31 @@ bool grpc_chttp2_list_pop_writable_stream(grpc_chttp2_transport* t,
   return stream_list_pop(t, s, GRPC_CHTTP2_LIST_WRITABLE);
 }
 
+bool grpc_chttp2_list_pop_writable_stream_wfq(grpc_chttp2_transport* t,
+                                              grpc_chttp2_stream** s) {
+  /* Scan a bounded window from the head of the writable list and pick the
+     stream with the smallest virtual finish time. Bounding the window keeps
+     dequeue cost constant while still interleaving streams that a pure FIFO
+     would starve behind a stream with a large flow controlled buffer. */
+  static const size_t kWfqScanWindow = 8;
+  grpc_chttp2_stream* best = t->lists[GRPC_CHTTP2_LIST_WRITABLE].head;
+  if (best == nullptr) {
+    *s = nullptr;
+    return false;
+  }
+  grpc_chttp2_stream* cur = best->links[GRPC_CHTTP2_LIST_WRITABLE].next;
+  for (size_t i = 1; i < kWfqScanWindow && cur != nullptr;
+       i++, cur = cur->links[GRPC_CHTTP2_LIST_WRITABLE].next) {
+    if (cur->wfq_finish_time < best->wfq_finish_time) best = cur;
+  }
+  stream_list_remove(t, best, GRPC_CHTTP2_LIST_WRITABLE);
+  if (best->wfq_finish_time > t->wfq_virtual_time) {
+    t->wfq_virtual_time = best->wfq_finish_time;
+  }
+  *s = best;
+  return true;
+}
+
 bool grpc_chttp2_list_remove_writable_stream(grpc_chttp2_transport* t,
                                              grpc_chttp2_stream* s) {
   return stream_list_maybe_remove(t, s, GRPC_CHTTP2_LIST_WRITABLE);
@@ -185,32 +210,68 @@ void grpc_chttp2_list_remove_waiting_for_concurrency(grpc_chttp2_transport* t,
   stream_list_maybe_remove(t, s, GRPC_CHTTP2_LIST_WAITING_FOR_CONCURRENCY);
 }
 
+/* Starts and stops the wall clock attributing time spent with at least one
+   stream parked on a stalled list. The stalled lists are only manipulated
+   from under the transport combiner, so plain fields suffice. */
+static void stall_clock_maybe_start(grpc_core::Timestamp* start) {
+  if (*start == grpc_core::Timestamp::InfPast()) {
+    *start = grpc_core::Timestamp::Now();
+  }
+}
+
+static void stall_clock_maybe_stop(grpc_chttp2_transport* t,
+                                   grpc_chttp2_stream_list_id id,
+                                   grpc_core::Timestamp* start,
+                                   grpc_core::Duration* total) {
+  if (*start != grpc_core::Timestamp::InfPast() && stream_list_empty(t, id)) {
+    *total += grpc_core::Timestamp::Now() - *start;
+    *start = grpc_core::Timestamp::InfPast();
+  }
+}
+
 void grpc_chttp2_list_add_stalled_by_transport(grpc_chttp2_transport* t,
                                                grpc_chttp2_stream* s) {
+  stall_clock_maybe_start(&t->write_stall_stats.transport_window_stall_start);
   stream_list_add(t, s, GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT);
 }
 
 bool grpc_chttp2_list_pop_stalled_by_transport(grpc_chttp2_transport* t,
                                                grpc_chttp2_stream** s) {
-  return stream_list_pop(t, s, GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT);
+  bool ret = stream_list_pop(t, s, GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT);
+  stall_clock_maybe_stop(t, GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT,
+                         &t->write_stall_stats.transport_window_stall_start,
+                         &t->write_stall_stats.transport_window_stalled_time);
+  return ret;
 }
 
 void grpc_chttp2_list_remove_stalled_by_transport(grpc_chttp2_transport* t,
                                                   grpc_chttp2_stream* s) {
   stream_list_maybe_remove(t, s, GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT);
+  stall_clock_maybe_stop(t, GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT,
+                         &t->write_stall_stats.transport_window_stall_start,
+                         &t->write_stall_stats.transport_window_stalled_time);
 }
 
 void grpc_chttp2_list_add_stalled_by_stream(grpc_chttp2_transport* t,
                                             grpc_chttp2_stream* s) {
+  stall_clock_maybe_start(&t->write_stall_stats.stream_window_stall_start);
   stream_list_add(t, s, GRPC_CHTTP2_LIST_STALLED_BY_STREAM);
 }
 
 bool grpc_chttp2_list_pop_stalled_by_stream(grpc_chttp2_transport* t,
                                             grpc_chttp2_stream** s) {
-  return stream_list_pop(t, s, GRPC_CHTTP2_LIST_STALLED_BY_STREAM);
+  bool ret = stream_list_pop(t, s, GRPC_CHTTP2_LIST_STALLED_BY_STREAM);
+  stall_clock_maybe_stop(t, GRPC_CHTTP2_LIST_STALLED_BY_STREAM,
+                         &t->write_stall_stats.stream_window_stall_start,
+                         &t->write_stall_stats.stream_window_stalled_time);
+  return ret;
 }
 
 bool grpc_chttp2_list_remove_stalled_by_stream(grpc_chttp2_transport* t,
                                                grpc_chttp2_stream* s) {
-  return stream_list_maybe_remove(t, s, GRPC_CHTTP2_LIST_STALLED_BY_STREAM);
+  bool ret = stream_list_maybe_remove(t, s, GRPC_CHTTP2_LIST_STALLED_BY_STREAM);
+  stall_clock_maybe_stop(t, GRPC_CHTTP2_LIST_STALLED_BY_STREAM,
+                         &t->write_stall_stats.stream_window_stall_start,
+                         &t->write_stall_stats.stream_window_stalled_time);
+  return ret;
 }
@@ -162,6 +162,7 @@ static void maybe_initiate_ping(grpc_chttp2_transport* t) {
   t->ping_state.last_ping_sent_time = now;
 
   pq->inflight_id = t->ping_ctr;
+  pq->inflight_sent_time = now;
   t->ping_ctr++;
   grpc_core::ExecCtx::RunList(DEBUG_LOCATION,
                               &pq->lists[GRPC_CHTTP2_PCL_INITIATE]);
@@ -227,9 +228,11 @@ static void report_stall(grpc_chttp2_transport* t, grpc_chttp2_stream* s,
   }
 }
 
-/* How many bytes would we like to put on the wire during a single syscall */
-static uint32_t target_write_size(grpc_chttp2_transport* /*t*/) {
-  return 1024 * 1024;
+/* How many bytes would we like to put on the wire during a single syscall.
+   Adapted per transport from endpoint write completion latency; see
+   write_action_end in chttp2_transport.cc for the feedback loop. */
+static uint32_t target_write_size(grpc_chttp2_transport* t) {
+  return t->target_write_size;
 }
 
 namespace {
@@ -278,6 +281,14 @@ class WriteContext {
       t_->sent_local_settings = true;
       GRPC_STATS_INC_HTTP2_SETTINGS_WRITES();
     }
+    if (t_->pending_settings_acks > 0) {
+      // One slice acknowledging every SETTINGS frame received since the
+      // last write.
+      grpc_slice_buffer_add(
+          &t_->outbuf,
+          grpc_chttp2_settings_ack_create(t_->pending_settings_acks));
+      t_->pending_settings_acks = 0;
+    }
   }
 
   void FlushQueuedBuffers() {
@@ -332,7 +343,7 @@ class WriteContext {
     }
 
     grpc_chttp2_stream* s;
-    if (!grpc_chttp2_list_pop_writable_stream(t_, &s)) {
+    if (!grpc_chttp2_list_pop_writable_stream_wfq(t_, &s)) {
       return nullptr;
     }
 
@@ -402,6 +413,12 @@ class DataSendContext {
                             is_last_frame_, &s_->stats.outgoing, &t_->outbuf);
     sfc_upd_.SentData(send_bytes);
     s_->sending_bytes += send_bytes;
+    // Weighted fair queuing: charge virtual time proportional to the bytes
+    // sent and inversely proportional to the stream's weight, so the next
+    // write cycle dequeues lighter writers first.
+    s_->wfq_finish_time =
+        std::max(t_->wfq_virtual_time, s_->wfq_finish_time) +
+        (static_cast<uint64_t>(send_bytes) << 8) / s_->write_weight;
   }
 
   bool is_last_frame() const { return is_last_frame_; }
@@ -451,20 +468,26 @@ class StreamWriteContext {
         is_default_initial_metadata(s_->send_initial_metadata)) {
       ConvertInitialMetadataToTrailingMetadata();
     } else {
-      t_->hpack_compressor.EncodeHeaders(
-          grpc_core::HPackCompressor::EncodeHeaderOptions{
-              s_->id,  // stream_id
-              false,   // is_eof
-              t_->settings
-                      [GRPC_PEER_SETTINGS]
-                      [GRPC_CHTTP2_SETTINGS_GRPC_ALLOW_TRUE_BINARY_METADATA] !=
-                  0,  // use_true_binary_metadata
-              t_->settings
+      const grpc_core::HPackCompressor::EncodeHeaderOptions options{
+          s_->id,  // stream_id
+          false,   // is_eof
+          t_->settings
                   [GRPC_PEER_SETTINGS]
-                  [GRPC_CHTTP2_SETTINGS_MAX_FRAME_SIZE],  // max_frame_size
-              &s_->stats.outgoing                         // stats
-          },
-          *s_->send_initial_metadata, &t_->outbuf);
+                  [GRPC_CHTTP2_SETTINGS_GRPC_ALLOW_TRUE_BINARY_METADATA] !=
+              0,  // use_true_binary_metadata
+          t_->settings[GRPC_PEER_SETTINGS]
+                      [GRPC_CHTTP2_SETTINGS_MAX_FRAME_SIZE],  // max_frame_size
+          &s_->stats.outgoing                                 // stats
+      };
+      if (t_->is_client) {
+        t_->hpack_compressor.EncodeHeaders(options, *s_->send_initial_metadata,
+                                           &t_->outbuf);
+      } else {
+        // Server initial metadata is usually identical call-to-call, so the
+        // compressor can splice a cached encoding when it is.
+        t_->hpack_compressor.EncodeServerInitialHeaders(
+            options, *s_->send_initial_metadata, &t_->outbuf);
+      }
       grpc_chttp2_reset_ping_clock(t_);
       write_context_->IncInitialMetadataWrites();
     }
@@ -503,10 +526,16 @@ class StreamWriteContext {
     if (!data_send_context.AnyOutgoing()) {
       if (t_->flow_control.remote_window() <= 0) {
         GRPC_STATS_INC_HTTP2_TRANSPORT_STALLS();
+        t_->write_stall_stats.transport_window_stalls++;
+        t_->write_stall_stats.transport_window_stalled_bytes +=
+            s_->flow_controlled_buffer.length;
         report_stall(t_, s_, "transport");
         grpc_chttp2_list_add_stalled_by_transport(t_, s_);
       } else if (data_send_context.stream_remote_window() <= 0) {
         GRPC_STATS_INC_HTTP2_STREAM_STALLS();
+        t_->write_stall_stats.stream_window_stalls++;
+        t_->write_stall_stats.stream_window_stalled_bytes +=
+            s_->flow_controlled_buffer.length;
         report_stall(t_, s_, "stream");
         grpc_chttp2_list_add_stalled_by_stream(t_, s_);
       }
@@ -637,7 +666,8 @@ grpc_chttp2_begin_write_result grpc_chttp2_begin_write(
     if (t->outbuf.length > orig_len) {
       /* Add this stream to the list of the contexts to be traced at TCP */
       s->byte_counter += t->outbuf.length - orig_len;
-      if (s->traced && grpc_endpoint_can_track_err(t->ep)) {
+      if ((s->traced || t->tx_byte_latency_tracing) &&
+          grpc_endpoint_can_track_err(t->ep)) {
         grpc_core::ContextList::Append(&t->cl, s);
       }
     }
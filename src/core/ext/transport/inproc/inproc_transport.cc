@@ -80,8 +80,8 @@ void maybe_process_ops_locked(inproc_stream* s, grpc_error_handle error);
 void op_state_machine_locked(inproc_stream* s, grpc_error_handle error);
 void log_metadata(const grpc_metadata_batch* md_batch, bool is_client,
                   bool is_initial);
-void fill_in_metadata(inproc_stream* s, const grpc_metadata_batch* metadata,
-                      grpc_metadata_batch* out_md, bool* markfilled);
+void transfer_metadata(inproc_stream* s, grpc_metadata_batch* metadata,
+                       grpc_metadata_batch* out_md, bool* markfilled);
 
 void ResetSendMessage(grpc_transport_stream_op_batch* batch) {
   std::exchange(batch->payload->send_message.send_message, nullptr)->Clear();
@@ -191,15 +191,15 @@ struct inproc_stream {
       // Now transfer from the other side's write_buffer if any to the to_read
       // buffer
       if (cs->write_buffer_initial_md_filled) {
-        fill_in_metadata(this, &cs->write_buffer_initial_md,
-                         &to_read_initial_md, &to_read_initial_md_filled);
+        transfer_metadata(this, &cs->write_buffer_initial_md,
+                          &to_read_initial_md, &to_read_initial_md_filled);
         deadline = std::min(deadline, cs->write_buffer_deadline);
         cs->write_buffer_initial_md.Clear();
         cs->write_buffer_initial_md_filled = false;
       }
       if (cs->write_buffer_trailing_md_filled) {
-        fill_in_metadata(this, &cs->write_buffer_trailing_md,
-                         &to_read_trailing_md, &to_read_trailing_md_filled);
+        transfer_metadata(this, &cs->write_buffer_trailing_md,
+                          &to_read_trailing_md, &to_read_trailing_md_filled);
         cs->write_buffer_trailing_md.Clear();
         cs->write_buffer_trailing_md_filled = false;
       }
@@ -294,35 +294,13 @@ void log_metadata(const grpc_metadata_batch* md_batch, bool is_client,
   });
 }
 
-namespace {
-
-class CopySink {
- public:
-  explicit CopySink(grpc_metadata_batch* dst) : dst_(dst) {}
-
-  void Encode(const grpc_core::Slice& key, const grpc_core::Slice& value) {
-    dst_->Append(key.as_string_view(), value.AsOwned(),
-                 [](absl::string_view, const grpc_core::Slice&) {});
-  }
-
-  template <class T, class V>
-  void Encode(T trait, V value) {
-    dst_->Set(trait, value);
-  }
-
-  template <class T>
-  void Encode(T trait, const grpc_core::Slice& value) {
-    dst_->Set(trait, value.AsOwned());
-  }
-
- private:
-  grpc_metadata_batch* dst_;
-};
-
-}  // namespace
-
-void fill_in_metadata(inproc_stream* s, const grpc_metadata_batch* metadata,
-                      grpc_metadata_batch* out_md, bool* markfilled) {
+// Hands the contents of metadata over to out_md without copying payload
+// bytes: both calls share the process, so slices change hands by reference
+// transfer and only the unknown-entry bookkeeping is re-created in the
+// destination arena (see grpc_metadata_batch::TakeFrom).  The source batch
+// is left empty, so callers must be done reading it.
+void transfer_metadata(inproc_stream* s, grpc_metadata_batch* metadata,
+                       grpc_metadata_batch* out_md, bool* markfilled) {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_inproc_trace)) {
     log_metadata(metadata, s->t->is_client,
                  metadata->get_pointer(grpc_core::WaitForReady()) != nullptr);
@@ -332,12 +310,7 @@ void fill_in_metadata(inproc_stream* s, const grpc_metadata_batch* metadata,
     *markfilled = true;
   }
 
-  // TODO(ctiller): copy the metadata batch, don't rely on a bespoke copy
-  // function. Can only do this once mdelems are out of the way though, too
-  // many edge cases otherwise.
-  out_md->Clear();
-  CopySink sink(out_md);
-  metadata->Encode(&sink);
+  out_md->TakeFrom(metadata);
 }
 
 int init_stream(grpc_transport* gt, grpc_stream* gs,
@@ -435,7 +408,7 @@ void fail_helper_locked(inproc_stream* s, grpc_error_handle error) {
                                     : &other->to_read_trailing_md;
     bool* destfilled = (other == nullptr) ? &s->write_buffer_trailing_md_filled
                                           : &other->to_read_trailing_md_filled;
-    fill_in_metadata(s, &fake_md, dest, destfilled);
+    transfer_metadata(s, &fake_md, dest, destfilled);
 
     if (other != nullptr) {
       if (other->cancel_other_error.ok()) {
@@ -457,10 +430,10 @@ void fail_helper_locked(inproc_stream* s, grpc_error_handle error) {
       fake_md.Set(grpc_core::HttpAuthorityMetadata(),
                   grpc_core::Slice::FromStaticString("inproc-fail"));
 
-      fill_in_metadata(s, &fake_md,
-                       s->recv_initial_md_op->payload->recv_initial_metadata
-                           .recv_initial_metadata,
-                       nullptr);
+      transfer_metadata(s, &fake_md,
+                        s->recv_initial_md_op->payload->recv_initial_metadata
+                            .recv_initial_metadata,
+                        nullptr);
       err = absl::OkStatus();
     } else {
       err = error;
@@ -631,10 +604,11 @@ void op_state_machine_locked(inproc_stream* s, grpc_error_handle error) {
       goto done;
     } else {
       if (!other || !other->closed) {
-        fill_in_metadata(s,
-                         s->send_trailing_md_op->payload->send_trailing_metadata
-                             .send_trailing_metadata,
-                         dest, destfilled);
+        transfer_metadata(
+            s,
+            s->send_trailing_md_op->payload->send_trailing_metadata
+                .send_trailing_metadata,
+            dest, destfilled);
       }
       s->trailing_md_sent = true;
       if (s->send_trailing_md_op->payload->send_trailing_metadata.sent) {
@@ -678,10 +652,10 @@ void op_state_machine_locked(inproc_stream* s, grpc_error_handle error) {
 
     if (s->to_read_initial_md_filled) {
       s->initial_md_recvd = true;
-      fill_in_metadata(s, &s->to_read_initial_md,
-                       s->recv_initial_md_op->payload->recv_initial_metadata
-                           .recv_initial_metadata,
-                       nullptr);
+      transfer_metadata(s, &s->to_read_initial_md,
+                        s->recv_initial_md_op->payload->recv_initial_metadata
+                            .recv_initial_metadata,
+                        nullptr);
       if (s->deadline != grpc_core::Timestamp::InfFuture()) {
         s->recv_initial_md_op->payload->recv_initial_metadata
             .recv_initial_metadata->Set(grpc_core::GrpcTimeoutMetadata(),
@@ -761,10 +735,10 @@ void op_state_machine_locked(inproc_stream* s, grpc_error_handle error) {
     if (s->recv_trailing_md_op != nullptr) {
       // We wanted trailing metadata and we got it
       s->trailing_md_recvd = true;
-      fill_in_metadata(s, &s->to_read_trailing_md,
-                       s->recv_trailing_md_op->payload->recv_trailing_metadata
-                           .recv_trailing_metadata,
-                       nullptr);
+      transfer_metadata(s, &s->to_read_trailing_md,
+                        s->recv_trailing_md_op->payload->recv_trailing_metadata
+                            .recv_trailing_metadata,
+                        nullptr);
       s->to_read_trailing_md.Clear();
       s->to_read_trailing_md_filled = false;
 
@@ -874,7 +848,7 @@ bool cancel_stream_locked(inproc_stream* s, grpc_error_handle error) {
                                     : &other->to_read_trailing_md;
     bool* destfilled = (other == nullptr) ? &s->write_buffer_trailing_md_filled
                                           : &other->to_read_trailing_md_filled;
-    fill_in_metadata(s, &cancel_md, dest, destfilled);
+    transfer_metadata(s, &cancel_md, dest, destfilled);
 
     if (other != nullptr) {
       if (other->cancel_other_error.ok()) {
@@ -973,20 +947,21 @@ void perform_stream_op(grpc_transport* gt, grpc_stream* gs,
         INPROC_LOG(GPR_INFO, "Extra initial metadata %p", s);
         error = GRPC_ERROR_CREATE_FROM_STATIC_STRING("Extra initial metadata");
       } else {
-        if (!s->other_side_closed) {
-          fill_in_metadata(
-              s, op->payload->send_initial_metadata.send_initial_metadata, dest,
-              destfilled);
-        }
         if (s->t->is_client) {
           grpc_core::Timestamp* dl =
               (other == nullptr) ? &s->write_buffer_deadline : &other->deadline;
+          // Read the timeout now: the handoff below empties the batch.
           *dl = std::min(
               *dl, op->payload->send_initial_metadata.send_initial_metadata
                        ->get(grpc_core::GrpcTimeoutMetadata())
                        .value_or(grpc_core::Timestamp::InfFuture()));
           s->initial_md_sent = true;
         }
+        if (!s->other_side_closed) {
+          transfer_metadata(
+              s, op->payload->send_initial_metadata.send_initial_metadata, dest,
+              destfilled);
+        }
       }
       maybe_process_ops_locked(other, error);
     }
@@ -0,0 +1,480 @@
+/*
+ *
+ * Copyright 2022 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/transport/shm/shm_endpoint.h"
+
+#include "src/core/lib/iomgr/port.h"
+
+grpc_core::TraceFlag grpc_shm_trace(false, "shm");
+
+#ifdef GRPC_LINUX_EVENTFD
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <utility>
+
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
+#include <grpc/support/log.h>
+#include <grpc/support/sync.h>
+
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/ev_posix.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+
+namespace {
+
+constexpr uint32_t kShmMagic = 0x53684d31;  // 'ShM1'
+constexpr size_t kCacheLineSize = 64;
+// Keep rings mappable with 32-bit free-running indices.
+constexpr uint32_t kMaxRingBytes = 1u << 30;
+
+// One direction of the byte pipe.  head and tail are free-running 32-bit
+// indices (the data offset is index & (ring_bytes - 1)); head is advanced
+// only by the producer, tail only by the consumer, each on its own cache
+// line to avoid cross-process false sharing.
+struct ShmRing {
+  std::atomic<uint32_t> head;
+  char pad_head[kCacheLineSize - sizeof(std::atomic<uint32_t>)];
+  std::atomic<uint32_t> tail;
+  char pad_tail[kCacheLineSize - sizeof(std::atomic<uint32_t>)];
+  std::atomic<uint32_t> closed;  // set by the producer on shutdown
+  char pad_closed[kCacheLineSize - sizeof(std::atomic<uint32_t>)];
+};
+
+struct ShmSegmentHeader {
+  uint32_t magic;
+  uint32_t ring_bytes;  // data capacity per ring; a power of two
+  char pad[kCacheLineSize - 2 * sizeof(uint32_t)];
+  ShmRing rings[2];  // [0]: client->server, [1]: server->client
+  // Ring data follows: ring_bytes bytes for ring 0, then for ring 1.
+};
+
+static_assert(sizeof(ShmSegmentHeader) % kCacheLineSize == 0,
+              "ring data must start cache-line aligned");
+
+struct ShmEndpoint {
+  grpc_endpoint base;
+  gpr_refcount refs;
+
+  void* map = nullptr;
+  size_t map_len = 0;
+  ShmSegmentHeader* hdr = nullptr;
+  ShmRing* send_ring = nullptr;
+  uint8_t* send_data = nullptr;
+  ShmRing* recv_ring = nullptr;
+  uint8_t* recv_data = nullptr;
+
+  grpc_fd* doorbell = nullptr;  // polled; signaled by the peer
+  int peer_doorbell_fd = -1;    // signaled by us
+  grpc_closure on_doorbell;
+
+  grpc_core::Mutex mu;
+  bool is_shutdown ABSL_GUARDED_BY(mu) = false;
+  bool doorbell_armed ABSL_GUARDED_BY(mu) = false;
+  // At most one read and one write may be pending at a time.
+  grpc_slice_buffer* incoming ABSL_GUARDED_BY(mu) = nullptr;
+  grpc_closure* read_cb ABSL_GUARDED_BY(mu) = nullptr;
+  grpc_slice_buffer* outgoing ABSL_GUARDED_BY(mu) = nullptr;
+  size_t outgoing_slice ABSL_GUARDED_BY(mu) = 0;
+  size_t outgoing_byte ABSL_GUARDED_BY(mu) = 0;
+  grpc_closure* write_cb ABSL_GUARDED_BY(mu) = nullptr;
+
+  std::string peer_string;
+  std::string local_address;
+};
+
+void ShmEndpointRef(ShmEndpoint* ep) { gpr_ref(&ep->refs); }
+
+void ShmEndpointUnref(ShmEndpoint* ep) {
+  if (gpr_unref(&ep->refs)) {
+    grpc_fd_orphan(ep->doorbell, nullptr, nullptr, "shm_endpoint_destroyed");
+    close(ep->peer_doorbell_fd);
+    munmap(ep->map, ep->map_len);
+    delete ep;
+  }
+}
+
+void SignalPeer(ShmEndpoint* ep) {
+  uint64_t one = 1;
+  ssize_t r;
+  do {
+    r = write(ep->peer_doorbell_fd, &one, sizeof(one));
+  } while (r < 0 && errno == EINTR);
+  // EAGAIN means the counter is already saturated; the peer will wake.
+}
+
+void DrainDoorbell(ShmEndpoint* ep) {
+  uint64_t value;
+  ssize_t r;
+  do {
+    r = read(grpc_fd_wrapped_fd(ep->doorbell), &value, sizeof(value));
+  } while (r < 0 && errno == EINTR);
+}
+
+// Copies everything currently readable out of the receive ring into a
+// single slice appended to dest.  Returns the number of bytes consumed.
+size_t RingRead(ShmEndpoint* ep, grpc_slice_buffer* dest) {
+  ShmRing* ring = ep->recv_ring;
+  const uint32_t ring_bytes = ep->hdr->ring_bytes;
+  const uint32_t mask = ring_bytes - 1;
+  const uint32_t tail = ring->tail.load(std::memory_order_relaxed);
+  const uint32_t head = ring->head.load(std::memory_order_acquire);
+  const uint32_t available = head - tail;
+  if (available == 0) return 0;
+  grpc_slice slice = GRPC_SLICE_MALLOC(available);
+  uint8_t* dst = GRPC_SLICE_START_PTR(slice);
+  const uint32_t offset = tail & mask;
+  const uint32_t contiguous = std::min(available, ring_bytes - offset);
+  memcpy(dst, ep->recv_data + offset, contiguous);
+  memcpy(dst + contiguous, ep->recv_data, available - contiguous);
+  ring->tail.store(tail + available, std::memory_order_release);
+  grpc_slice_buffer_add(dest, slice);
+  return available;
+}
+
+// Copies as much of the pending outgoing data into the send ring as fits.
+// Returns true once all outgoing slices have been consumed; sets
+// *made_progress if any bytes were written (the peer then needs a signal).
+bool RingWriteSome(ShmEndpoint* ep, bool* made_progress)
+    ABSL_EXCLUSIVE_LOCKS_REQUIRED(ep->mu) {
+  ShmRing* ring = ep->send_ring;
+  const uint32_t ring_bytes = ep->hdr->ring_bytes;
+  const uint32_t mask = ring_bytes - 1;
+  uint32_t head = ring->head.load(std::memory_order_relaxed);
+  uint32_t space =
+      ring_bytes - (head - ring->tail.load(std::memory_order_acquire));
+  *made_progress = false;
+  while (ep->outgoing_slice < ep->outgoing->count) {
+    const grpc_slice& slice = ep->outgoing->slices[ep->outgoing_slice];
+    const size_t slice_len = GRPC_SLICE_LENGTH(slice);
+    if (ep->outgoing_byte == slice_len) {
+      ep->outgoing_byte = 0;
+      ++ep->outgoing_slice;
+      continue;
+    }
+    if (space == 0) break;
+    const uint32_t n = static_cast<uint32_t>(std::min<size_t>(
+        space, slice_len - ep->outgoing_byte));
+    const uint8_t* src = GRPC_SLICE_START_PTR(slice) + ep->outgoing_byte;
+    const uint32_t offset = head & mask;
+    const uint32_t contiguous = std::min(n, ring_bytes - offset);
+    memcpy(ep->send_data + offset, src, contiguous);
+    memcpy(ep->send_data, src + contiguous, n - contiguous);
+    head += n;
+    space -= n;
+    ep->outgoing_byte += n;
+    *made_progress = true;
+  }
+  if (*made_progress) ring->head.store(head, std::memory_order_release);
+  return ep->outgoing_slice == ep->outgoing->count;
+}
+
+void ArmDoorbellLocked(ShmEndpoint* ep) ABSL_EXCLUSIVE_LOCKS_REQUIRED(ep->mu) {
+  if (ep->doorbell_armed) return;
+  ep->doorbell_armed = true;
+  ShmEndpointRef(ep);
+  grpc_fd_notify_on_read(ep->doorbell, &ep->on_doorbell);
+}
+
+void OnDoorbell(void* arg, grpc_error_handle error) {
+  ShmEndpoint* ep = static_cast<ShmEndpoint*>(arg);
+  grpc_closure* read_cb = nullptr;
+  grpc_error_handle read_error;
+  grpc_closure* write_cb = nullptr;
+  grpc_error_handle write_error;
+  if (error.ok()) DrainDoorbell(ep);
+  {
+    grpc_core::MutexLock lock(&ep->mu);
+    ep->doorbell_armed = false;
+    if (!error.ok() || ep->is_shutdown) {
+      grpc_error_handle err = !error.ok()
+                                  ? error
+                                  : GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+                                        "Endpoint shutdown");
+      read_cb = std::exchange(ep->read_cb, nullptr);
+      read_error = err;
+      write_cb = std::exchange(ep->write_cb, nullptr);
+      write_error = err;
+      ep->incoming = nullptr;
+      ep->outgoing = nullptr;
+    } else {
+      if (ep->read_cb != nullptr) {
+        if (RingRead(ep, ep->incoming) > 0) {
+          read_cb = std::exchange(ep->read_cb, nullptr);
+          ep->incoming = nullptr;
+          SignalPeer(ep);  // space was freed
+        } else if (ep->recv_ring->closed.load(std::memory_order_acquire) != 0) {
+          read_cb = std::exchange(ep->read_cb, nullptr);
+          read_error = GRPC_ERROR_CREATE_FROM_STATIC_STRING("Socket closed");
+          ep->incoming = nullptr;
+        }
+      }
+      if (ep->write_cb != nullptr) {
+        bool progress;
+        if (RingWriteSome(ep, &progress)) {
+          write_cb = std::exchange(ep->write_cb, nullptr);
+          ep->outgoing = nullptr;
+        }
+        if (progress) SignalPeer(ep);
+      }
+      if (ep->read_cb != nullptr || ep->write_cb != nullptr) {
+        ArmDoorbellLocked(ep);
+      }
+    }
+  }
+  if (read_cb != nullptr) {
+    grpc_core::ExecCtx::Run(DEBUG_LOCATION, read_cb, read_error);
+  }
+  if (write_cb != nullptr) {
+    grpc_core::ExecCtx::Run(DEBUG_LOCATION, write_cb, write_error);
+  }
+  ShmEndpointUnref(ep);  // balances the ref taken when armed
+}
+
+void EndpointRead(grpc_endpoint* ep_arg, grpc_slice_buffer* slices,
+                  grpc_closure* cb, bool /*urgent*/,
+                  int /*min_progress_size*/) {
+  ShmEndpoint* ep = reinterpret_cast<ShmEndpoint*>(ep_arg);
+  grpc_error_handle error;
+  {
+    grpc_core::MutexLock lock(&ep->mu);
+    GPR_ASSERT(ep->read_cb == nullptr);
+    if (ep->is_shutdown) {
+      error = GRPC_ERROR_CREATE_FROM_STATIC_STRING("Endpoint shutdown");
+    } else if (RingRead(ep, slices) > 0) {
+      SignalPeer(ep);  // space was freed
+    } else if (ep->recv_ring->closed.load(std::memory_order_acquire) != 0) {
+      error = GRPC_ERROR_CREATE_FROM_STATIC_STRING("Socket closed");
+    } else {
+      ep->incoming = slices;
+      ep->read_cb = cb;
+      ArmDoorbellLocked(ep);
+      return;
+    }
+  }
+  grpc_core::ExecCtx::Run(DEBUG_LOCATION, cb, error);
+}
+
+void EndpointWrite(grpc_endpoint* ep_arg, grpc_slice_buffer* slices,
+                   grpc_closure* cb, void* /*arg*/, int /*max_frame_size*/,
+                   bool /*more_coming*/) {
+  ShmEndpoint* ep = reinterpret_cast<ShmEndpoint*>(ep_arg);
+  grpc_error_handle error;
+  {
+    grpc_core::MutexLock lock(&ep->mu);
+    GPR_ASSERT(ep->write_cb == nullptr);
+    if (ep->is_shutdown) {
+      error = GRPC_ERROR_CREATE_FROM_STATIC_STRING("Endpoint shutdown");
+    } else {
+      ep->outgoing = slices;
+      ep->outgoing_slice = 0;
+      ep->outgoing_byte = 0;
+      bool progress;
+      const bool done = RingWriteSome(ep, &progress);
+      if (progress) SignalPeer(ep);
+      if (done) {
+        ep->outgoing = nullptr;
+      } else {
+        // Ring full: finish from OnDoorbell() once the peer frees space.
+        ep->write_cb = cb;
+        ArmDoorbellLocked(ep);
+        return;
+      }
+    }
+  }
+  grpc_core::ExecCtx::Run(DEBUG_LOCATION, cb, error);
+}
+
+void EndpointAddToPollset(grpc_endpoint* ep_arg, grpc_pollset* pollset) {
+  ShmEndpoint* ep = reinterpret_cast<ShmEndpoint*>(ep_arg);
+  grpc_pollset_add_fd(pollset, ep->doorbell);
+}
+
+void EndpointAddToPollsetSet(grpc_endpoint* ep_arg,
+                             grpc_pollset_set* pollset_set) {
+  ShmEndpoint* ep = reinterpret_cast<ShmEndpoint*>(ep_arg);
+  grpc_pollset_set_add_fd(pollset_set, ep->doorbell);
+}
+
+void EndpointDeleteFromPollsetSet(grpc_endpoint* ep_arg,
+                                  grpc_pollset_set* pollset_set) {
+  ShmEndpoint* ep = reinterpret_cast<ShmEndpoint*>(ep_arg);
+  grpc_pollset_set_del_fd(pollset_set, ep->doorbell);
+}
+
+void EndpointShutdown(grpc_endpoint* ep_arg, grpc_error_handle why) {
+  ShmEndpoint* ep = reinterpret_cast<ShmEndpoint*>(ep_arg);
+  grpc_closure* read_cb = nullptr;
+  grpc_closure* write_cb = nullptr;
+  {
+    grpc_core::MutexLock lock(&ep->mu);
+    if (ep->is_shutdown) return;
+    ep->is_shutdown = true;
+    // Tell the peer no more bytes are coming, then wake it.
+    ep->send_ring->closed.store(1, std::memory_order_release);
+    SignalPeer(ep);
+    read_cb = std::exchange(ep->read_cb, nullptr);
+    write_cb = std::exchange(ep->write_cb, nullptr);
+    ep->incoming = nullptr;
+    ep->outgoing = nullptr;
+    grpc_fd_shutdown(ep->doorbell, why);
+  }
+  if (read_cb != nullptr) {
+    grpc_core::ExecCtx::Run(DEBUG_LOCATION, read_cb, why);
+  }
+  if (write_cb != nullptr) {
+    grpc_core::ExecCtx::Run(DEBUG_LOCATION, write_cb, why);
+  }
+}
+
+void EndpointDestroy(grpc_endpoint* ep_arg) {
+  ShmEndpoint* ep = reinterpret_cast<ShmEndpoint*>(ep_arg);
+  ShmEndpointUnref(ep);
+}
+
+absl::string_view EndpointGetPeer(grpc_endpoint* ep_arg) {
+  ShmEndpoint* ep = reinterpret_cast<ShmEndpoint*>(ep_arg);
+  return ep->peer_string;
+}
+
+absl::string_view EndpointGetLocalAddress(grpc_endpoint* ep_arg) {
+  ShmEndpoint* ep = reinterpret_cast<ShmEndpoint*>(ep_arg);
+  return ep->local_address;
+}
+
+int EndpointGetFd(grpc_endpoint* ep_arg) {
+  ShmEndpoint* ep = reinterpret_cast<ShmEndpoint*>(ep_arg);
+  return grpc_fd_wrapped_fd(ep->doorbell);
+}
+
+bool EndpointCanTrackErr(grpc_endpoint* /*ep*/) { return false; }
+
+const grpc_endpoint_vtable kShmEndpointVtable = {
+    EndpointRead,
+    EndpointWrite,
+    EndpointAddToPollset,
+    EndpointAddToPollsetSet,
+    EndpointDeleteFromPollsetSet,
+    EndpointShutdown,
+    EndpointDestroy,
+    EndpointGetPeer,
+    EndpointGetLocalAddress,
+    EndpointGetFd,
+    EndpointCanTrackErr,
+};
+
+bool SetNonBlocking(int fd) {
+  const int flags = fcntl(fd, F_GETFL, 0);
+  return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+}  // namespace
+
+bool grpc_shm_segment_init(int shm_fd, size_t size) {
+  if (size < GRPC_SHM_SEGMENT_MIN_SIZE) return false;
+  void* map =
+      mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, shm_fd, 0);
+  if (map == MAP_FAILED) return false;
+  ShmSegmentHeader* hdr = static_cast<ShmSegmentHeader*>(map);
+  memset(hdr, 0, sizeof(*hdr));
+  // Largest power of two such that both rings fit after the header.
+  const size_t budget = (size - sizeof(ShmSegmentHeader)) / 2;
+  uint32_t ring_bytes = 1;
+  while (ring_bytes <= budget / 2 && ring_bytes < kMaxRingBytes) {
+    ring_bytes *= 2;
+  }
+  hdr->ring_bytes = ring_bytes;
+  hdr->magic = kShmMagic;
+  munmap(map, size);
+  return true;
+}
+
+grpc_endpoint* grpc_shm_endpoint_create(int shm_fd, int doorbell_fd,
+                                        int peer_doorbell_fd, bool is_client,
+                                        const char* peer_string) {
+  struct stat st;
+  if (fstat(shm_fd, &st) != 0) return nullptr;
+  const size_t map_len = static_cast<size_t>(st.st_size);
+  if (map_len < GRPC_SHM_SEGMENT_MIN_SIZE) return nullptr;
+  void* map =
+      mmap(nullptr, map_len, PROT_READ | PROT_WRITE, MAP_SHARED, shm_fd, 0);
+  if (map == MAP_FAILED) return nullptr;
+  ShmSegmentHeader* hdr = static_cast<ShmSegmentHeader*>(map);
+  if (hdr->magic != kShmMagic || hdr->ring_bytes == 0 ||
+      (hdr->ring_bytes & (hdr->ring_bytes - 1)) != 0 ||
+      map_len < sizeof(ShmSegmentHeader) + 2 * size_t{hdr->ring_bytes}) {
+    gpr_log(GPR_ERROR, "shm endpoint: segment not initialized or truncated");
+    munmap(map, map_len);
+    return nullptr;
+  }
+  if (!SetNonBlocking(doorbell_fd) || !SetNonBlocking(peer_doorbell_fd)) {
+    munmap(map, map_len);
+    return nullptr;
+  }
+  ShmEndpoint* ep = new ShmEndpoint();
+  ep->base.vtable = &kShmEndpointVtable;
+  gpr_ref_init(&ep->refs, 1);
+  ep->map = map;
+  ep->map_len = map_len;
+  ep->hdr = hdr;
+  uint8_t* data = reinterpret_cast<uint8_t*>(map) + sizeof(ShmSegmentHeader);
+  // Ring 0 carries client->server bytes, ring 1 the reverse.
+  ep->send_ring = &hdr->rings[is_client ? 0 : 1];
+  ep->send_data = data + (is_client ? 0 : hdr->ring_bytes);
+  ep->recv_ring = &hdr->rings[is_client ? 1 : 0];
+  ep->recv_data = data + (is_client ? hdr->ring_bytes : 0);
+  ep->doorbell = grpc_fd_create(doorbell_fd, "shm_doorbell",
+                                /*track_err=*/false);
+  ep->peer_doorbell_fd = peer_doorbell_fd;
+  GRPC_CLOSURE_INIT(&ep->on_doorbell, OnDoorbell, ep,
+                    grpc_schedule_on_exec_ctx);
+  ep->peer_string = peer_string;
+  ep->local_address = is_client ? "shm:client" : "shm:server";
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_shm_trace)) {
+    gpr_log(GPR_INFO, "shm endpoint %p created: %u byte rings, %s", ep,
+            hdr->ring_bytes, ep->local_address.c_str());
+  }
+  return &ep->base;
+}
+
+#else  // !GRPC_LINUX_EVENTFD
+
+bool grpc_shm_segment_init(int /*shm_fd*/, size_t /*size*/) { return false; }
+
+grpc_endpoint* grpc_shm_endpoint_create(int /*shm_fd*/, int /*doorbell_fd*/,
+                                        int /*peer_doorbell_fd*/,
+                                        bool /*is_client*/,
+                                        const char* /*peer_string*/) {
+  return nullptr;
+}
+
+#endif  // GRPC_LINUX_EVENTFD
@@ -0,0 +1,61 @@
+/*
+ *
+ * Copyright 2022 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_CORE_EXT_TRANSPORT_SHM_SHM_ENDPOINT_H
+#define GRPC_CORE_EXT_TRANSPORT_SHM_SHM_ENDPOINT_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/iomgr/endpoint.h"
+
+// A grpc_endpoint that moves bytes between two processes on the same host
+// through a shared-memory segment instead of a socket.  The segment holds a
+// pair of single-producer/single-consumer ring buffers (one per direction);
+// each side additionally holds two eventfds used as doorbells: one it polls
+// (signaled by the peer after producing data or freeing space) and one it
+// signals.  The eventfds must be exchanged between the processes out of
+// band, e.g. over a unix socket with SCM_RIGHTS.
+//
+// The endpoint is a byte pipe, not a transport: chttp2 runs on top of it
+// unchanged (see shm_transport.h), so only the TCP/loopback hop is removed.
+
+// Minimum usable segment size; smaller segments are rejected.
+#define GRPC_SHM_SEGMENT_MIN_SIZE (64 * 1024)
+
+// Initializes the ring-buffer layout in the segment referred to by shm_fd
+// (created with memfd_create() or shm_open() and sized by the caller).
+// Must be called exactly once, by whichever process creates the segment,
+// before either side creates an endpoint over it.  Returns false if the
+// segment is too small or cannot be mapped.
+bool grpc_shm_segment_init(int shm_fd, size_t size);
+
+// Creates an endpoint over an initialized segment.  Takes ownership of
+// doorbell_fd (the eventfd this side polls) and peer_doorbell_fd (the
+// eventfd it signals); shm_fd is only mapped and may be closed by the
+// caller afterwards.  Exactly one side must pass is_client=true: the flag
+// selects which of the two rings the endpoint sends on.
+grpc_endpoint* grpc_shm_endpoint_create(int shm_fd, int doorbell_fd,
+                                        int peer_doorbell_fd, bool is_client,
+                                        const char* peer_string);
+
+extern grpc_core::TraceFlag grpc_shm_trace;
+
+#endif /* GRPC_CORE_EXT_TRANSPORT_SHM_SHM_ENDPOINT_H */
@@ -0,0 +1,130 @@
+/*
+ *
+ * Copyright 2022 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/transport/shm/shm_transport.h"
+
+#include "src/core/lib/iomgr/port.h"
+
+#ifdef GRPC_LINUX_EVENTFD
+
+#include <grpc/grpc.h>
+#include <grpc/support/log.h>
+
+#include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
+#include "src/core/ext/transport/shm/shm_endpoint.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/channel/channel_args_preconditioning.h"
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/iomgr/endpoint.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/surface/api_trace.h"
+#include "src/core/lib/surface/channel.h"
+#include "src/core/lib/surface/channel_stack_type.h"
+#include "src/core/lib/surface/lame_client.h"
+#include "src/core/lib/surface/server.h"
+#include "src/core/lib/transport/transport.h"
+
+grpc_channel* grpc_shm_channel_create(const char* target, int shm_fd,
+                                      int doorbell_fd, int peer_doorbell_fd,
+                                      const grpc_channel_args* args) {
+  grpc_core::ExecCtx exec_ctx;
+  GRPC_API_TRACE(
+      "grpc_shm_channel_create(target=%p, shm_fd=%d, doorbell_fd=%d, "
+      "peer_doorbell_fd=%d, args=%p)",
+      5, (target, shm_fd, doorbell_fd, peer_doorbell_fd, args));
+  grpc_core::ChannelArgs final_args =
+      grpc_core::CoreConfiguration::Get()
+          .channel_args_preconditioning()
+          .PreconditionChannelArgs(args)
+          .SetIfUnset(GRPC_ARG_DEFAULT_AUTHORITY, "shm.authority");
+  grpc_endpoint* client = grpc_shm_endpoint_create(
+      shm_fd, doorbell_fd, peer_doorbell_fd, /*is_client=*/true, "shm:server");
+  if (client == nullptr) {
+    return grpc_lame_client_channel_create(
+        target, GRPC_STATUS_INTERNAL,
+        "Failed to map shared-memory segment");
+  }
+  grpc_transport* transport =
+      grpc_create_chttp2_transport(final_args, client, true);
+  GPR_ASSERT(transport);
+  auto channel = grpc_core::Channel::Create(
+      target, final_args, GRPC_CLIENT_DIRECT_CHANNEL, transport);
+  if (channel.ok()) {
+    grpc_chttp2_transport_start_reading(transport, nullptr, nullptr, nullptr);
+    grpc_core::ExecCtx::Get()->Flush();
+    return channel->release()->c_ptr();
+  }
+  grpc_transport_destroy(transport);
+  return grpc_lame_client_channel_create(
+      target, static_cast<grpc_status_code>(channel.status().code()),
+      "Failed to create client channel");
+}
+
+void grpc_server_add_shm_channel(grpc_server* server, int shm_fd,
+                                 int doorbell_fd, int peer_doorbell_fd) {
+  grpc_core::ExecCtx exec_ctx;
+  GRPC_API_TRACE(
+      "grpc_server_add_shm_channel(server=%p, shm_fd=%d, doorbell_fd=%d, "
+      "peer_doorbell_fd=%d)",
+      4, (server, shm_fd, doorbell_fd, peer_doorbell_fd));
+  grpc_core::Server* core_server = grpc_core::Server::FromC(server);
+  grpc_core::ChannelArgs server_args = core_server->channel_args();
+  grpc_endpoint* server_endpoint = grpc_shm_endpoint_create(
+      shm_fd, doorbell_fd, peer_doorbell_fd, /*is_client=*/false,
+      "shm:client");
+  if (server_endpoint == nullptr) {
+    gpr_log(GPR_ERROR, "Failed to map shared-memory segment");
+    return;
+  }
+  grpc_transport* transport = grpc_create_chttp2_transport(
+      server_args, server_endpoint, false /* is_client */);
+  grpc_error_handle error =
+      core_server->SetupTransport(transport, nullptr, server_args, nullptr);
+  if (error.ok()) {
+    for (grpc_pollset* pollset : core_server->pollsets()) {
+      grpc_endpoint_add_to_pollset(server_endpoint, pollset);
+    }
+    grpc_chttp2_transport_start_reading(transport, nullptr, nullptr, nullptr);
+  } else {
+    gpr_log(GPR_ERROR, "Failed to create channel: %s",
+            grpc_error_std_string(error).c_str());
+    grpc_transport_destroy(transport);
+  }
+}
+
+#else  // !GRPC_LINUX_EVENTFD
+
+#include <grpc/support/log.h>
+
+grpc_channel* grpc_shm_channel_create(const char* /*target*/, int /*shm_fd*/,
+                                      int /*doorbell_fd*/,
+                                      int /*peer_doorbell_fd*/,
+                                      const grpc_channel_args* /*args*/) {
+  GPR_ASSERT(0);
+  return nullptr;
+}
+
+void grpc_server_add_shm_channel(grpc_server* /*server*/, int /*shm_fd*/,
+                                 int /*doorbell_fd*/,
+                                 int /*peer_doorbell_fd*/) {
+  GPR_ASSERT(0);
+}
+
+#endif  // GRPC_LINUX_EVENTFD
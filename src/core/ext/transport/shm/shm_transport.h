@@ -0,0 +1,50 @@
+/*
+ *
+ * Copyright 2022 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_CORE_EXT_TRANSPORT_SHM_SHM_TRANSPORT_H
+#define GRPC_CORE_EXT_TRANSPORT_SHM_SHM_TRANSPORT_H
+
+#include <grpc/support/port_platform.h>
+
+#include <grpc/impl/codegen/grpc_types.h>
+
+// EXPERIMENTAL.  Same-host inter-process channels over shared memory:
+// chttp2 running on the shared-memory endpoint from shm_endpoint.h instead
+// of a TCP connection, removing the socket and loopback hop between
+// co-located processes (e.g. sidecar meshes).
+//
+// The processes must rendezvous out of band: one side creates and
+// initializes the segment (grpc_shm_segment_init) and two eventfds, then
+// passes the file descriptors to the other, e.g. over a unix socket with
+// SCM_RIGHTS.  Each side's doorbell_fd must be the other side's
+// peer_doorbell_fd.  Connections are insecure and intended only for
+// mutually trusted processes on one host; both calls take ownership of the
+// two eventfds but not of shm_fd.
+
+// Creates a client channel whose single connection runs over the segment.
+// Returns a lame channel if the segment cannot be mapped.
+grpc_channel* grpc_shm_channel_create(const char* target, int shm_fd,
+                                      int doorbell_fd, int peer_doorbell_fd,
+                                      const grpc_channel_args* args);
+
+// Attaches the server end of the segment to an already-started server,
+// mirroring grpc_server_add_channel_from_fd.
+void grpc_server_add_shm_channel(grpc_server* server, int shm_fd,
+                                 int doorbell_fd, int peer_doorbell_fd);
+
+#endif /* GRPC_CORE_EXT_TRANSPORT_SHM_SHM_TRANSPORT_H */
@@ -48,10 +48,13 @@
 #include <grpc/grpc.h>
 #include <grpc/impl/codegen/gpr_types.h>
 #include <grpc/status.h>
+#include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
 #include "src/core/ext/xds/upb_utils.h"
 #include "src/core/ext/xds/xds_client.h"
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/json/json.h"
 
 // IWYU pragma: no_include "upb/msg_internal.h"
@@ -103,6 +106,90 @@ struct XdsApiContext {
   bool use_v3;
 };
 
+// Recycles initial arena blocks across ADS response decodes. Decoding
+// allocates roughly in proportion to the encoded response size, so blocks
+// are sized from a moving estimate of recent response sizes and handed
+// back to the pool after the decode; a warm, right-sized first block means
+// steady-state decodes do not touch the system allocator at all.
+class AdsResponseArenaPool {
+ private:
+  struct Block {
+    char* mem = nullptr;
+    size_t size = 0;
+  };
+
+ public:
+  // An arena seeded with a pooled block sized for \a encoded_size. The
+  // block is returned to the pool when the arena is destroyed.
+  class DecodeArena {
+   public:
+    explicit DecodeArena(size_t encoded_size)
+        : block_(Get()->AcquireBlock(encoded_size)),
+          arena_(upb_Arena_Init(block_.mem, block_.size, &upb_alloc_global)) {}
+    ~DecodeArena() {
+      upb_Arena_Free(arena_);
+      Get()->ReleaseBlock(block_);
+    }
+
+    DecodeArena(const DecodeArena&) = delete;
+    DecodeArena& operator=(const DecodeArena&) = delete;
+
+    upb_Arena* ptr() const { return arena_; }
+
+   private:
+    Block block_;
+    upb_Arena* arena_;
+  };
+
+  static AdsResponseArenaPool* Get() {
+    static AdsResponseArenaPool* pool = new AdsResponseArenaPool;
+    return pool;
+  }
+
+ private:
+  // Decoded representations expand over the wire format; 4x covers
+  // typical upb message and array overhead.
+  static constexpr size_t kExpansionFactor = 4;
+  static constexpr size_t kMinBlockSize = 8 * 1024;
+  static constexpr size_t kMaxBlockSize = 4 * 1024 * 1024;
+  // One warm block per concurrently decoding ADS stream is plenty.
+  static constexpr size_t kMaxPooledBlocks = 4;
+
+  Block AcquireBlock(size_t encoded_size) {
+    const size_t desired = Clamp(encoded_size * kExpansionFactor,
+                                 kMinBlockSize, kMaxBlockSize);
+    MutexLock lock(&mu_);
+    // Exponential moving estimate of block demand; the target is biased
+    // high so that a typical response fits in the first block.
+    estimate_ = estimate_ - estimate_ / 8 + desired / 8;
+    const size_t target = std::max(desired, estimate_);
+    while (!blocks_.empty()) {
+      Block block = blocks_.back();
+      blocks_.pop_back();
+      // Reuse a block that is big enough but not wildly oversized.
+      if (block.size >= target && block.size / 4 <= target) return block;
+      gpr_free(block.mem);
+    }
+    Block block;
+    block.size = target;
+    block.mem = static_cast<char*>(gpr_malloc(block.size));
+    return block;
+  }
+
+  void ReleaseBlock(Block block) {
+    MutexLock lock(&mu_);
+    if (blocks_.size() < kMaxPooledBlocks) {
+      blocks_.push_back(block);
+      return;
+    }
+    gpr_free(block.mem);
+  }
+
+  Mutex mu_;
+  std::vector<Block> blocks_ ABSL_GUARDED_BY(mu_);
+  size_t estimate_ ABSL_GUARDED_BY(mu_) = kMinBlockSize;
+};
+
 void PopulateMetadataValue(const XdsApiContext& context,
                            google_protobuf_Value* value_pb, const Json& value);
 
@@ -353,7 +440,7 @@ void MaybeLogDiscoveryResponse(
 absl::Status XdsApi::ParseAdsResponse(const XdsBootstrap::XdsServer& server,
                                       absl::string_view encoded_response,
                                       AdsResponseParserInterface* parser) {
-  upb::Arena arena;
+  AdsResponseArenaPool::DecodeArena arena(encoded_response.size());
   const XdsApiContext context = {client_, tracer_, symtab_->ptr(), arena.ptr(),
                                  server.ShouldUseV3()};
   // Decode the response.
@@ -61,6 +61,20 @@ using ::grpc_event_engine::experimental::EventEngine;
 TraceFlag grpc_xds_client_trace(false, "xds_client");
 TraceFlag grpc_xds_client_refcount_trace(false, "xds_client_refcount");
 
+namespace {
+
+// Invokes a resource-changed callback on a watcher that opted into
+// parallel delivery.  Such watchers do their own synchronization, so the
+// WorkSerializer lock annotation on the watcher method does not apply.
+void DeliverResourceChangedParallel(
+    XdsClient::ResourceWatcherInterface* watcher,
+    const XdsResourceType::ResourceData* resource)
+    ABSL_NO_THREAD_SAFETY_ANALYSIS {
+  watcher->OnGenericResourceChanged(resource);
+}
+
+}  // namespace
+
 //
 // Internal class declarations
 //
@@ -132,6 +146,18 @@ class XdsClient::ChannelState::AdsCallState
   class AdsResponseParser : public XdsApi::AdsResponseParserInterface {
    public:
     struct Result {
+      // A watcher notification for one changed resource.  Notifications
+      // are accumulated while the response is parsed and dispatched
+      // together in OnRecvMessage(), so that one ADS response produces
+      // one batched delivery instead of one serialized callback per
+      // resource.
+      struct PendingNotification {
+        std::map<ResourceWatcherInterface*,
+                 RefCountedPtr<ResourceWatcherInterface>>
+            watchers;
+        std::shared_ptr<const XdsResourceType::ResourceData> resource;
+      };
+
       const XdsResourceType* type;
       std::string type_url;
       std::string version;
@@ -140,6 +166,7 @@ class XdsClient::ChannelState::AdsCallState
       std::map<std::string /*authority*/, std::set<XdsResourceKey>>
           resources_seen;
       bool have_valid_resources = false;
+      std::vector<PendingNotification> pending_notifications;
     };
 
     explicit AdsResponseParser(AdsCallState* ads_call_state)
@@ -727,6 +754,30 @@ void XdsClient::ChannelState::AdsCallState::AdsResponseParser::ParseResource(
                      " (should be ", result_.type_url, ")"));
     return;
   }
+  // If the Resource wrapper told us the resource name, check our
+  // subscription state before decoding, so that resources nobody is
+  // watching in a large SotW response are never materialized.  (Without
+  // the wrapper, the name is only available by decoding.)  Note that
+  // this means invalid contents of unwatched wrapped resources do not
+  // contribute to a NACK, which is fine: we would not act on them anyway.
+  if (!resource_name.empty()) {
+    auto early_name =
+        xds_client()->ParseXdsResourceName(resource_name, result_.type);
+    if (early_name.ok()) {
+      auto authority_it =
+          xds_client()->authority_state_map_.find(early_name->authority);
+      if (authority_it == xds_client()->authority_state_map_.end()) {
+        return;  // Skip resource -- we don't have a subscription for it.
+      }
+      auto type_it = authority_it->second.resource_map.find(result_.type);
+      if (type_it == authority_it->second.resource_map.end()) {
+        return;  // Skip resource -- we don't have a subscription for it.
+      }
+      if (type_it->second.find(early_name->key) == type_it->second.end()) {
+        return;  // Skip resource -- we don't have a subscription for it.
+      }
+    }
+  }
   // Parse the resource.
   XdsResourceType::DecodeContext context = {
       xds_client(), ads_call_state_->chand()->server_, &grpc_xds_client_trace,
@@ -838,19 +889,20 @@ void XdsClient::ChannelState::AdsCallState::AdsResponseParser::ParseResource(
   resource_state.resource = std::move(*decode_result.resource);
   resource_state.meta = CreateResourceMetadataAcked(
       std::string(serialized_resource), result_.version, update_time_);
-  // Notify watchers.
-  auto& watchers_list = resource_state.watchers;
-  auto* value =
-      result_.type->CopyResource(resource_state.resource.get()).release();
-  xds_client()->work_serializer_.Schedule(
-      [watchers_list, value]()
-          ABSL_EXCLUSIVE_LOCKS_REQUIRED(&xds_client()->work_serializer_) {
-            for (const auto& p : watchers_list) {
-              p.first->OnGenericResourceChanged(value);
-            }
-            delete value;
-          },
-      DEBUG_LOCATION);
+  ++resource_state.generation;
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
+    gpr_log(GPR_INFO,
+            "[xds_client %p] %s resource %s changed (generation %" PRIu64 ")",
+            xds_client(), result_.type_url.c_str(),
+            std::string(resource_name).c_str(), resource_state.generation);
+  }
+  // Batch the watcher notification with the others from this response;
+  // they are all dispatched together once the whole response has been
+  // processed.
+  result_.pending_notifications.emplace_back();
+  result_.pending_notifications.back().watchers = resource_state.watchers;
+  result_.pending_notifications.back().resource =
+      result_.type->CopyResource(resource_state.resource.get());
 }
 
 void XdsClient::ChannelState::AdsCallState::AdsResponseParser::
@@ -1092,6 +1144,47 @@ void XdsClient::ChannelState::AdsCallState::OnRecvMessage(
           if (lrs_calld != nullptr) lrs_calld->MaybeStartReportingLocked();
         }
       }
+      // Dispatch the batched watcher notifications for this response.
+      // All serialized watchers share a single WorkSerializer item, and
+      // watchers that opt into parallel delivery get one EventEngine
+      // task per resource so that independent subtrees fan out across
+      // the pool.
+      std::vector<std::pair<RefCountedPtr<ResourceWatcherInterface>,
+                            std::shared_ptr<const XdsResourceType::ResourceData>>>
+          serialized_batch;
+      for (auto& notification : result.pending_notifications) {
+        std::vector<RefCountedPtr<ResourceWatcherInterface>> parallel_watchers;
+        for (const auto& p : notification.watchers) {
+          if (p.first->SupportsParallelDelivery()) {
+            parallel_watchers.push_back(p.second);
+          } else {
+            serialized_batch.emplace_back(p.second, notification.resource);
+          }
+        }
+        if (!parallel_watchers.empty()) {
+          xds_client()->engine()->Run(
+              [watchers = std::move(parallel_watchers),
+               resource = notification.resource]() {
+                ApplicationCallbackExecCtx app_exec_ctx;
+                ExecCtx exec_ctx;
+                for (const auto& watcher : watchers) {
+                  DeliverResourceChangedParallel(watcher.get(),
+                                                 resource.get());
+                }
+              });
+        }
+      }
+      if (!serialized_batch.empty()) {
+        xds_client()->work_serializer_.Schedule(
+            [batch = std::move(serialized_batch)]()
+                ABSL_EXCLUSIVE_LOCKS_REQUIRED(
+                    &xds_client()->work_serializer_) {
+                  for (const auto& p : batch) {
+                    p.first->OnGenericResourceChanged(p.second.get());
+                  }
+                },
+            DEBUG_LOCATION);
+      }
       // Send ACK or NACK.
       SendMessageLocked(result.type);
     }
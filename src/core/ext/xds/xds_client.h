@@ -69,6 +69,16 @@ class XdsClient : public DualRefCounted<XdsClient> {
         ABSL_EXCLUSIVE_LOCKS_REQUIRED(&work_serializer_) = 0;
     virtual void OnResourceDoesNotExist()
         ABSL_EXCLUSIVE_LOCKS_REQUIRED(&work_serializer_) = 0;
+
+    // Returns true if this watcher's OnGenericResourceChanged() callback
+    // may be invoked directly on an EventEngine thread instead of under
+    // the XdsClient's WorkSerializer, allowing notifications for
+    // different resources in one ADS response to be delivered in
+    // parallel.  Watchers that return true must do their own
+    // synchronization and must treat the delivered resource as a
+    // read-only snapshot.  The default of false preserves the serialized
+    // delivery contract.
+    virtual bool SupportsParallelDelivery() const { return false; }
   };
 
   XdsClient(std::unique_ptr<XdsBootstrap> bootstrap,
@@ -237,6 +247,11 @@ class XdsClient : public DualRefCounted<XdsClient> {
     // The latest data seen for the resource.
     std::unique_ptr<XdsResourceType::ResourceData> resource;
     XdsApi::ResourceMetadata meta;
+    // Incremented each time an accepted update actually changes the
+    // resource.  Identical re-deliveries are filtered out before watchers
+    // are notified, so each notification corresponds to exactly one
+    // generation.
+    uint64_t generation = 0;
     bool ignored_deletion = false;
   };
 
@@ -191,6 +191,64 @@ class XdsServerConfigFetcher::ListenerWatcher
       ABSL_GUARDED_BY(mu_);
 };
 
+// A precompiled form of XdsListenerResource::FilterChainMap. The parsed map
+// is organized for validation rather than lookup, so matching a connection
+// against it directly requires best-match bookkeeping at the destination and
+// source prefix levels on every accept. This table is compiled once when a
+// FilterChainMatchManager is created (i.e., at LDS update time) and is
+// immutable afterwards:
+// - Prefix entries at each level are sorted by descending prefix length with
+//   catch-all entries last, so the longest matching prefix is simply the
+//   first hit in a linear scan.
+// - Each destination entry precomputes whether the kAny source-type list
+//   applies, avoiding per-connection empty checks.
+// - If the whole map collapses to a single filter chain that matches every
+//   connection (the common case of a listener with one catch-all filter
+//   chain), that filter chain is recorded so that Match() can return it
+//   without parsing the connection addresses at all.
+// FilterChainMatchManager objects are swapped atomically on LDS updates, so
+// the table needs no locking. The table holds pointers into the
+// FilterChainMap owned by the same manager, which outlives it.
+class FilterChainMatchTable {
+ public:
+  void Compile(const XdsListenerResource::FilterChainMap& filter_chain_map);
+
+  // Returns the filter chain to use for the connection, or null if no filter
+  // chain matches.
+  const XdsListenerResource::FilterChainData* Match(grpc_endpoint* tcp) const;
+
+ private:
+  using SourceIpList =
+      std::vector<const XdsListenerResource::FilterChainMap::SourceIp*>;
+
+  struct DestinationEntry {
+    const XdsListenerResource::FilterChainMap::DestinationIp* destination_ip;
+    // Source-ip entries per connection source type, sorted by descending
+    // prefix length with catch-all entries last.
+    std::array<SourceIpList, 3> source_types;
+    // True if the kSameIpOrLoopback and kExternal lists are both empty, in
+    // which case the kAny list is used without classifying the peer.
+    bool use_any_source_type;
+  };
+
+  static const XdsListenerResource::FilterChainData* MatchSourcePort(
+      const XdsListenerResource::FilterChainMap::SourcePortsMap&
+          source_ports_map,
+      absl::string_view port_str);
+  static const XdsListenerResource::FilterChainData* MatchSourceIp(
+      const SourceIpList& source_ips, const grpc_resolved_address* source_ip,
+      absl::string_view port);
+  const XdsListenerResource::FilterChainData* MatchSourceType(
+      const DestinationEntry& entry, grpc_endpoint* tcp,
+      absl::string_view destination_ip) const;
+
+  // Destination entries sorted by descending prefix length, catch-alls last.
+  std::vector<DestinationEntry> destination_ips_;
+  // Set if every connection matches this filter chain, in which case Match()
+  // skips address parsing entirely.
+  const XdsListenerResource::FilterChainData* unconditional_match_ = nullptr;
+};
+
 // A connection manager used by the server listener code to inject channel args
 // to be used for each incoming connection. This implementation chooses the
 // appropriate filter chain from the xDS Listener resource and injects channel
@@ -263,6 +321,8 @@ class XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager
   RefCountedPtr<ListenerWatcher> listener_watcher_;
   XdsListenerResource::FilterChainMap filter_chain_map_;
   absl::optional<XdsListenerResource::FilterChainData> default_filter_chain_;
+  // Compiled from filter_chain_map_ at construction; immutable afterwards.
+  FilterChainMatchTable filter_chain_match_table_;
   Mutex mu_;
   size_t rds_resources_yet_to_fetch_ ABSL_GUARDED_BY(mu_) = 0;
   std::map<std::string /* resource_name */, RdsUpdateState> rds_map_
@@ -320,6 +380,10 @@ class XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
 
   CallConfig GetCallConfig(grpc_metadata_batch* metadata) override;
 
+  bool RoutingDependsOnlyOnPathAndAuthority() const override {
+    return routing_depends_only_on_path_and_authority_;
+  }
+
  private:
   struct VirtualHost {
     struct Route {
@@ -367,6 +431,9 @@ class XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
   };
 
   std::vector<VirtualHost> virtual_hosts_;
+  // True unless some route matches on headers or a runtime fraction, in
+  // which case per-method memoization of GetCallConfig() would be unsound.
+  bool routing_depends_only_on_path_and_authority_ = true;
 };
 
 // An XdsServerConfigSelectorProvider implementation for when the
@@ -666,7 +733,9 @@ XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
             default_filter_chain)
     : xds_client_(std::move(xds_client)),
       filter_chain_map_(std::move(filter_chain_map)),
-      default_filter_chain_(std::move(default_filter_chain)) {}
+      default_filter_chain_(std::move(default_filter_chain)) {
+  filter_chain_match_table_.Compile(filter_chain_map_);
+}
 
 void XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
     StartRdsWatch(RefCountedPtr<ListenerWatcher> listener_watcher) {
@@ -886,7 +955,81 @@ void XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
   }
 }
 
-const XdsListenerResource::FilterChainData* FindFilterChainDataForSourcePort(
+//
+// FilterChainMatchTable
+//
+
+void FilterChainMatchTable::Compile(
+    const XdsListenerResource::FilterChainMap& filter_chain_map) {
+  // Orders prefix entries so that a first-hit scan finds the longest
+  // matching prefix: longer prefixes first, catch-all entries last. The
+  // sort is stable so that entries of equal prefix length keep their
+  // relative order, preserving the semantics of the best-match scan that
+  // the compiled table replaces.
+  auto longer_prefix_first =
+      [](const absl::optional<XdsListenerResource::FilterChainMap::CidrRange>&
+             a,
+         const absl::optional<XdsListenerResource::FilterChainMap::CidrRange>&
+             b) {
+        if (!b.has_value()) return a.has_value();
+        if (!a.has_value()) return false;
+        return a->prefix_len > b->prefix_len;
+      };
+  destination_ips_.reserve(filter_chain_map.destination_ip_vector.size());
+  for (const auto& destination_ip : filter_chain_map.destination_ip_vector) {
+    DestinationEntry entry;
+    entry.destination_ip = &destination_ip;
+    for (size_t i = 0; i < destination_ip.source_types_array.size(); ++i) {
+      const auto& source_ip_vector = destination_ip.source_types_array[i];
+      entry.source_types[i].reserve(source_ip_vector.size());
+      for (const auto& source_ip : source_ip_vector) {
+        entry.source_types[i].push_back(&source_ip);
+      }
+      std::stable_sort(
+          entry.source_types[i].begin(), entry.source_types[i].end(),
+          [&](const XdsListenerResource::FilterChainMap::SourceIp* a,
+              const XdsListenerResource::FilterChainMap::SourceIp* b) {
+            return longer_prefix_first(a->prefix_range, b->prefix_range);
+          });
+    }
+    entry.use_any_source_type =
+        destination_ip
+            .source_types_array[static_cast<int>(
+                XdsListenerResource::FilterChainMap::ConnectionSourceType::
+                    kSameIpOrLoopback)]
+            .empty() &&
+        destination_ip
+            .source_types_array[static_cast<int>(
+                XdsListenerResource::FilterChainMap::ConnectionSourceType::
+                    kExternal)]
+            .empty();
+    destination_ips_.push_back(std::move(entry));
+  }
+  std::stable_sort(destination_ips_.begin(), destination_ips_.end(),
+                   [&](const DestinationEntry& a, const DestinationEntry& b) {
+                     return longer_prefix_first(a.destination_ip->prefix_range,
+                                                b.destination_ip->prefix_range);
+                   });
+  // Detect a map that sends every connection to the same filter chain, so
+  // that Match() can skip parsing the connection addresses.
+  if (destination_ips_.size() != 1) return;
+  const DestinationEntry& entry = destination_ips_[0];
+  if (entry.destination_ip->prefix_range.has_value() ||
+      !entry.use_any_source_type) {
+    return;
+  }
+  const SourceIpList& source_ips = entry.source_types[static_cast<int>(
+      XdsListenerResource::FilterChainMap::ConnectionSourceType::kAny)];
+  if (source_ips.size() != 1 || source_ips[0]->prefix_range.has_value()) {
+    return;
+  }
+  const auto& ports_map = source_ips[0]->ports_map;
+  if (ports_map.size() != 1 || ports_map.begin()->first != 0) return;
+  unconditional_match_ = ports_map.begin()->second.data.get();
+}
+
+const XdsListenerResource::FilterChainData*
+FilterChainMatchTable::MatchSourcePort(
     const XdsListenerResource::FilterChainMap::SourcePortsMap& source_ports_map,
     absl::string_view port_str) {
   int port = 0;
@@ -903,30 +1046,21 @@ const XdsListenerResource::FilterChainData* FindFilterChainDataForSourcePort(
   return nullptr;
 }
 
-const XdsListenerResource::FilterChainData* FindFilterChainDataForSourceIp(
-    const XdsListenerResource::FilterChainMap::SourceIpVector& source_ip_vector,
-    const grpc_resolved_address* source_ip, absl::string_view port) {
-  const XdsListenerResource::FilterChainMap::SourceIp* best_match = nullptr;
-  for (const auto& entry : source_ip_vector) {
-    // Special case for catch-all
-    if (!entry.prefix_range.has_value()) {
-      if (best_match == nullptr) {
-        best_match = &entry;
-      }
-      continue;
-    }
-    if (best_match != nullptr && best_match->prefix_range.has_value() &&
-        best_match->prefix_range->prefix_len >=
-            entry.prefix_range->prefix_len) {
+const XdsListenerResource::FilterChainData*
+FilterChainMatchTable::MatchSourceIp(const SourceIpList& source_ips,
+                                     const grpc_resolved_address* source_ip,
+                                     absl::string_view port) {
+  // Entries are sorted by descending prefix length, so the first hit is the
+  // longest matching prefix.
+  for (const auto* entry : source_ips) {
+    if (entry->prefix_range.has_value() &&
+        !grpc_sockaddr_match_subnet(source_ip, &entry->prefix_range->address,
+                                    entry->prefix_range->prefix_len)) {
       continue;
     }
-    if (grpc_sockaddr_match_subnet(source_ip, &entry.prefix_range->address,
-                                   entry.prefix_range->prefix_len)) {
-      best_match = &entry;
-    }
+    return MatchSourcePort(entry->ports_map, port);
   }
-  if (best_match == nullptr) return nullptr;
-  return FindFilterChainDataForSourcePort(best_match->ports_map, port);
+  return nullptr;
 }
 
 bool IsLoopbackIp(const grpc_resolved_address* address) {
@@ -949,10 +1083,10 @@ bool IsLoopbackIp(const grpc_resolved_address* address) {
   return false;
 }
 
-const XdsListenerResource::FilterChainData* FindFilterChainDataForSourceType(
-    const XdsListenerResource::FilterChainMap::ConnectionSourceTypesArray&
-        source_types_array,
-    grpc_endpoint* tcp, absl::string_view destination_ip) {
+const XdsListenerResource::FilterChainData*
+FilterChainMatchTable::MatchSourceType(
+    const DestinationEntry& entry, grpc_endpoint* tcp,
+    absl::string_view destination_ip) const {
   auto source_uri = URI::Parse(grpc_endpoint_get_peer(tcp));
   if (!source_uri.ok() ||
       (source_uri->scheme() != "ipv4" && source_uri->scheme() != "ipv6")) {
@@ -970,37 +1104,30 @@ const XdsListenerResource::FilterChainData* FindFilterChainDataForSourceType(
     return nullptr;
   }
   // Use kAny only if kSameIporLoopback and kExternal are empty
-  if (source_types_array[static_cast<int>(
-                             XdsListenerResource::FilterChainMap::
-                                 ConnectionSourceType::kSameIpOrLoopback)]
-          .empty() &&
-      source_types_array[static_cast<int>(XdsListenerResource::FilterChainMap::
-                                              ConnectionSourceType::kExternal)]
-          .empty()) {
-    return FindFilterChainDataForSourceIp(
-        source_types_array[static_cast<int>(
+  if (entry.use_any_source_type) {
+    return MatchSourceIp(
+        entry.source_types[static_cast<int>(
             XdsListenerResource::FilterChainMap::ConnectionSourceType::kAny)],
         &*source_addr, port);
   }
   if (IsLoopbackIp(&*source_addr) || host == destination_ip) {
-    return FindFilterChainDataForSourceIp(
-        source_types_array[static_cast<int>(
+    return MatchSourceIp(
+        entry.source_types[static_cast<int>(
             XdsListenerResource::FilterChainMap::ConnectionSourceType::
                 kSameIpOrLoopback)],
         &*source_addr, port);
   } else {
-    return FindFilterChainDataForSourceIp(
-        source_types_array[static_cast<int>(
+    return MatchSourceIp(
+        entry.source_types[static_cast<int>(
             XdsListenerResource::FilterChainMap::ConnectionSourceType::
                 kExternal)],
         &*source_addr, port);
   }
 }
 
-const XdsListenerResource::FilterChainData* FindFilterChainDataForDestinationIp(
-    const XdsListenerResource::FilterChainMap::DestinationIpVector
-        destination_ip_vector,
-    grpc_endpoint* tcp) {
+const XdsListenerResource::FilterChainData* FilterChainMatchTable::Match(
+    grpc_endpoint* tcp) const {
+  if (unconditional_match_ != nullptr) return unconditional_match_;
   auto destination_uri = URI::Parse(grpc_endpoint_get_local_address(tcp));
   if (!destination_uri.ok() || (destination_uri->scheme() != "ipv4" &&
                                 destination_uri->scheme() != "ipv6")) {
@@ -1018,38 +1145,25 @@ const XdsListenerResource::FilterChainData* FindFilterChainDataForDestinationIp(
             host.c_str(), destination_addr.status().ToString().c_str());
     return nullptr;
   }
-  const XdsListenerResource::FilterChainMap::DestinationIp* best_match =
-      nullptr;
-  for (const auto& entry : destination_ip_vector) {
-    // Special case for catch-all
-    if (!entry.prefix_range.has_value()) {
-      if (best_match == nullptr) {
-        best_match = &entry;
-      }
-      continue;
-    }
-    if (best_match != nullptr && best_match->prefix_range.has_value() &&
-        best_match->prefix_range->prefix_len >=
-            entry.prefix_range->prefix_len) {
+  // Entries are sorted by descending prefix length, so the first hit is the
+  // longest matching prefix.
+  for (const auto& entry : destination_ips_) {
+    if (entry.destination_ip->prefix_range.has_value() &&
+        !grpc_sockaddr_match_subnet(
+            &*destination_addr, &entry.destination_ip->prefix_range->address,
+            entry.destination_ip->prefix_range->prefix_len)) {
       continue;
     }
-    if (grpc_sockaddr_match_subnet(&*destination_addr,
-                                   &entry.prefix_range->address,
-                                   entry.prefix_range->prefix_len)) {
-      best_match = &entry;
-    }
+    return MatchSourceType(entry, tcp, host);
   }
-  if (best_match == nullptr) return nullptr;
-  return FindFilterChainDataForSourceType(best_match->source_types_array, tcp,
-                                          host);
+  return nullptr;
 }
 
 absl::StatusOr<ChannelArgs> XdsServerConfigFetcher::ListenerWatcher::
     FilterChainMatchManager::UpdateChannelArgsForConnection(
         const ChannelArgs& input_args, grpc_endpoint* tcp) {
   ChannelArgs args = input_args;
-  const auto* filter_chain = FindFilterChainDataForDestinationIp(
-      filter_chain_map_.destination_ip_vector, tcp);
+  const auto* filter_chain = filter_chain_match_table_.Match(tcp);
   if (filter_chain == nullptr && default_filter_chain_.has_value()) {
     filter_chain = &default_filter_chain_.value();
   }
@@ -1143,6 +1257,10 @@ XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
       virtual_host.routes.emplace_back();
       auto& config_selector_route = virtual_host.routes.back();
       config_selector_route.matchers = std::move(route.matchers);
+      if (!config_selector_route.matchers.header_matchers.empty() ||
+          config_selector_route.matchers.fraction_per_million.has_value()) {
+        config_selector->routing_depends_only_on_path_and_authority_ = false;
+      }
       config_selector_route.unsupported_action =
           absl::get_if<XdsRouteConfigResource::Route::NonForwardingAction>(
               &route.action) == nullptr;
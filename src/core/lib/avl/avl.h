@@ -22,6 +22,7 @@
 #include <algorithm>  // IWYU pragma: keep
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "src/core/lib/gpr/useful.h"
 
@@ -32,6 +33,14 @@ class AVL {
  public:
   AVL() {}
 
+  // Builds a balanced tree in one pass from entries that are already
+  // sorted by key and contain no duplicates, performing exactly one node
+  // allocation per entry -- much cheaper than repeated Add() calls, which
+  // rebuild and rebalance the path to the root for every insertion.
+  static AVL FromSortedEntries(std::vector<std::pair<K, V>> entries) {
+    return AVL(BuildFromSorted(entries.data(), entries.size()));
+  }
+
   AVL Add(K key, V value) const {
     return AVL(AddKey(root_, std::move(key), std::move(value)));
   }
@@ -253,6 +262,17 @@ class AVL {
     }
   }
 
+  static NodePtr BuildFromSorted(std::pair<K, V>* entries, size_t count) {
+    if (count == 0) return nullptr;
+    // Splitting at the midpoint keeps subtree sizes within one of each
+    // other, so the result satisfies the AVL height invariant.
+    const size_t mid = count / 2;
+    NodePtr left = BuildFromSorted(entries, mid);
+    NodePtr right = BuildFromSorted(entries + mid + 1, count - mid - 1);
+    return MakeNode(std::move(entries[mid].first),
+                    std::move(entries[mid].second), left, right);
+  }
+
   static NodePtr AddKey(const NodePtr& node, K key, V value) {
     if (!node) {
       return MakeNode(std::move(key), std::move(value), nullptr, nullptr);
@@ -0,0 +1,248 @@
+//
+//
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/channel/call_tracer_sampler.h"
+
+#include <utility>
+
+#include "absl/random/random.h"
+
+#include <grpc/support/time.h>
+
+#include "src/core/lib/json/json.h"
+
+namespace grpc_core {
+
+namespace {
+
+//
+// RateLimitedSampler
+//
+
+class RateLimitedSampler final : public CallTracerSampler {
+ public:
+  explicit RateLimitedSampler(uint64_t limit_per_second)
+      : limit_per_second_(limit_per_second),
+        tokens_(static_cast<int64_t>(limit_per_second)),
+        last_refill_(Timestamp::Now().milliseconds_after_process_epoch()) {}
+
+  bool ShouldSample() override {
+    RefillBucket();
+    int64_t tokens = tokens_.load(std::memory_order_relaxed);
+    while (tokens > 0) {
+      if (tokens_.compare_exchange_weak(tokens, tokens - 1,
+                                        std::memory_order_acq_rel,
+                                        std::memory_order_relaxed)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+ private:
+  void RefillBucket() {
+    const int64_t now = Timestamp::Now().milliseconds_after_process_epoch();
+    int64_t last = last_refill_.load(std::memory_order_relaxed);
+    if (now - last < 1000) return;
+    // Whoever wins the CAS performs the refill; losers just proceed with
+    // whatever tokens remain.
+    if (!last_refill_.compare_exchange_strong(last, now,
+                                              std::memory_order_acq_rel,
+                                              std::memory_order_relaxed)) {
+      return;
+    }
+    // The bucket never holds more than one second of allowance, so idle
+    // periods do not build up a burst larger than limit_per_second_.
+    tokens_.store(static_cast<int64_t>(limit_per_second_),
+                  std::memory_order_relaxed);
+  }
+
+  const uint64_t limit_per_second_;
+  std::atomic<int64_t> tokens_;
+  std::atomic<int64_t> last_refill_;
+};
+
+//
+// ReservoirSampler
+//
+
+class ReservoirSampler final : public CallTracerSampler {
+ public:
+  ReservoirSampler(uint64_t target_per_window, Duration window)
+      : target_per_window_(target_per_window),
+        window_(window),
+        window_start_(Timestamp::Now()) {}
+
+  bool ShouldSample() override {
+    MaybeRollWindow();
+    const uint64_t seen = seen_.fetch_add(1, std::memory_order_relaxed) + 1;
+    // Accept the i-th call of the window with probability target/i: over the
+    // whole window this keeps roughly target_per_window_ samples spread
+    // uniformly over the call stream, as reservoir sampling would, except
+    // that already-traced calls cannot be evicted.
+    if (seen <= target_per_window_) return true;
+    MutexLock lock(&mu_);
+    return absl::Uniform<uint64_t>(bit_gen_, 0, seen) < target_per_window_;
+  }
+
+ private:
+  void MaybeRollWindow() {
+    const Timestamp now = Timestamp::Now();
+    MutexLock lock(&mu_);
+    if (now - window_start_ < window_) return;
+    window_start_ = now;
+    seen_.store(0, std::memory_order_relaxed);
+  }
+
+  const uint64_t target_per_window_;
+  const Duration window_;
+  std::atomic<uint64_t> seen_{0};
+  Mutex mu_;
+  Timestamp window_start_ ABSL_GUARDED_BY(mu_);
+  absl::BitGen bit_gen_ ABSL_GUARDED_BY(mu_);
+};
+
+//
+// MethodStatsTracer
+//
+
+size_t BucketFor(uint64_t value) {
+  size_t bucket = 0;
+  while (value > 1 && bucket + 1 < MethodStatsCollector::Digest::kNumBuckets) {
+    value >>= 1;
+    ++bucket;
+  }
+  return bucket;
+}
+
+// Minimal tracer feeding a per-method digest: every hook other than the
+// message-size and end-of-attempt ones is a no-op. One object serves as both
+// the call tracer and the attempt tracer since the digest has no per-attempt
+// state.
+class MethodStatsTracer final : public CallTracer,
+                                public CallTracer::CallAttemptTracer {
+ public:
+  explicit MethodStatsTracer(MethodStatsCollector::Digest* digest)
+      : digest_(digest) {}
+
+  CallTracer::CallAttemptTracer* StartNewAttempt(
+      bool /*is_transparent_retry*/) override {
+    return this;
+  }
+
+  void RecordSendInitialMetadata(
+      grpc_metadata_batch* /*send_initial_metadata*/) override {}
+  void RecordOnDoneSendInitialMetadata(gpr_atm* /*peer_string*/) override {}
+  void RecordSendTrailingMetadata(
+      grpc_metadata_batch* /*send_trailing_metadata*/) override {}
+  void RecordSendMessage(const SliceBuffer& send_message) override {
+    digest_->send_bytes[BucketFor(send_message.Length())].fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void RecordReceivedInitialMetadata(
+      grpc_metadata_batch* /*recv_initial_metadata*/,
+      uint32_t /*flags*/) override {}
+  void RecordReceivedMessage(const SliceBuffer& recv_message) override {
+    digest_->recv_bytes[BucketFor(recv_message.Length())].fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void RecordReceivedTrailingMetadata(
+      absl::Status /*status*/, grpc_metadata_batch* /*recv_trailing_metadata*/,
+      const grpc_transport_stream_stats* /*transport_stream_stats*/) override {}
+  void RecordCancel(grpc_error_handle /*cancel_error*/) override {}
+  void RecordEnd(const gpr_timespec& latency) override {
+    digest_->calls.fetch_add(1, std::memory_order_relaxed);
+    const double micros = gpr_timespec_to_micros(latency);
+    digest_->latency_us[BucketFor(
+                            micros > 0 ? static_cast<uint64_t>(micros) : 0)]
+        .fetch_add(1, std::memory_order_relaxed);
+  }
+
+ private:
+  MethodStatsCollector::Digest* digest_;
+};
+
+Json BucketsToJson(const std::atomic<uint64_t>* buckets) {
+  Json::Array out;
+  for (size_t i = 0; i < MethodStatsCollector::Digest::kNumBuckets; ++i) {
+    out.emplace_back(std::to_string(buckets[i].load(std::memory_order_relaxed)),
+                     /*is_number=*/true);
+  }
+  return Json(std::move(out));
+}
+
+}  // namespace
+
+//
+// CallTracerSampler factories
+//
+
+std::shared_ptr<CallTracerSampler> MakeRateLimitedCallTracerSampler(
+    uint64_t limit_per_second) {
+  return std::make_shared<RateLimitedSampler>(limit_per_second);
+}
+
+std::shared_ptr<CallTracerSampler> MakeReservoirCallTracerSampler(
+    uint64_t target_per_window, Duration window) {
+  return std::make_shared<ReservoirSampler>(target_per_window, window);
+}
+
+//
+// MethodStatsCollector
+//
+
+MethodStatsCollector* MethodStatsCollector::Get() {
+  static MethodStatsCollector* collector = new MethodStatsCollector;
+  return collector;
+}
+
+MethodStatsCollector::Digest* MethodStatsCollector::DigestForMethod(
+    absl::string_view method) {
+  MutexLock lock(&mu_);
+  auto it = methods_.find(method);
+  if (it == methods_.end()) {
+    it = methods_.emplace(std::string(method), std::make_unique<Digest>())
+             .first;
+  }
+  return it->second.get();
+}
+
+CallTracer* MethodStatsCollector::MakeCallTracer(absl::string_view method) {
+  return new MethodStatsTracer(DigestForMethod(method));
+}
+
+std::string MethodStatsCollector::ReportAsJson() {
+  Json::Object methods;
+  MutexLock lock(&mu_);
+  for (const auto& p : methods_) {
+    const Digest& digest = *p.second;
+    Json::Object entry;
+    entry["calls"] = Json(
+        std::to_string(digest.calls.load(std::memory_order_relaxed)),
+        /*is_number=*/true);
+    entry["latency_us_log2_buckets"] = BucketsToJson(digest.latency_us);
+    entry["send_bytes_log2_buckets"] = BucketsToJson(digest.send_bytes);
+    entry["recv_bytes_log2_buckets"] = BucketsToJson(digest.recv_bytes);
+    methods[p.first] = Json(std::move(entry));
+  }
+  return Json(std::move(methods)).Dump();
+}
+
+}  // namespace grpc_core
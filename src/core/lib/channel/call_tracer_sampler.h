@@ -0,0 +1,114 @@
+//
+//
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_CORE_LIB_CHANNEL_CALL_TRACER_SAMPLER_H
+#define GRPC_CORE_LIB_CHANNEL_CALL_TRACER_SAMPLER_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/strings/string_view.h"
+
+#include "src/core/lib/channel/call_tracer.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
+
+// Channel arg containing a shared_ptr<CallTracerSampler> that tracer filters
+// consult at call start.
+#define GRPC_ARG_CALL_TRACER_SAMPLER "grpc.internal.call_tracer_sampler"
+
+namespace grpc_core {
+
+// Per-channel sampling decision for call tracers. Tracer filters consult the
+// sampler once at call start and skip CallTracer construction entirely for
+// unsampled calls, so the cost of an unsampled call is a single predicate
+// call.
+class CallTracerSampler
+    : public std::enable_shared_from_this<CallTracerSampler> {
+ public:
+  virtual ~CallTracerSampler() = default;
+
+  // Called once per call at call start. Must be thread-safe and cheap:
+  // every call on the channel pays for it, sampled or not.
+  virtual bool ShouldSample() = 0;
+
+  static absl::string_view ChannelArgName() {
+    return GRPC_ARG_CALL_TRACER_SAMPLER;
+  }
+};
+
+// Samples at most limit_per_second calls per second, via a token bucket
+// holding at most one second of allowance. Lock-free; this is the cheap
+// strategy suitable for very high call rates.
+std::shared_ptr<CallTracerSampler> MakeRateLimitedCallTracerSampler(
+    uint64_t limit_per_second);
+
+// Reservoir-style sampling: aims for target_per_window sampled calls per
+// window, decaying the acceptance probability as the call volume within the
+// window grows so samples spread over the call stream instead of clustering
+// at the window start. (Calls cannot be evicted from the sample once traced,
+// so the realized count is approximate.)
+std::shared_ptr<CallTracerSampler> MakeReservoirCallTracerSampler(
+    uint64_t target_per_window, Duration window);
+
+// A built-in low-overhead sink: aggregates per-method latency and message
+// size digests (log2-bucketed histograms) fed by a minimal CallTracer.
+// Pair it with a sampler so that only sampled calls carry the tracer.
+class MethodStatsCollector {
+ public:
+  struct Digest {
+    // Bucket i counts values in [2^i, 2^(i+1)); the last bucket absorbs the
+    // overflow. Latency is in microseconds, sizes in bytes.
+    static constexpr size_t kNumBuckets = 32;
+    std::atomic<uint64_t> calls{0};
+    std::atomic<uint64_t> latency_us[kNumBuckets] = {};
+    std::atomic<uint64_t> send_bytes[kNumBuckets] = {};
+    std::atomic<uint64_t> recv_bytes[kNumBuckets] = {};
+  };
+
+  // Returns the process-wide collector.
+  static MethodStatsCollector* Get();
+
+  // Returns a heap-allocated tracer feeding the digest for \a method. The
+  // caller owns it; typically it is stored in GRPC_CONTEXT_CALL_TRACER with
+  // a destroy function that deletes it.
+  CallTracer* MakeCallTracer(absl::string_view method);
+
+  // Snapshot of all per-method digests rendered as JSON, for diagnostics
+  // and tests.
+  std::string ReportAsJson();
+
+ private:
+  Digest* DigestForMethod(absl::string_view method);
+
+  Mutex mu_;
+  std::map<std::string, std::unique_ptr<Digest>, std::less<>> methods_
+      ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_CORE_LIB_CHANNEL_CALL_TRACER_SAMPLER_H
@@ -175,6 +175,69 @@ ChannelArgs ChannelArgs::Remove(absl::string_view key) const {
   return ChannelArgs(args_.Remove(key));
 }
 
+ChannelArgs::Builder& ChannelArgs::Builder::Set(absl::string_view name,
+                                                Pointer value) {
+  return Set(name, Value(std::move(value)));
+}
+
+ChannelArgs::Builder& ChannelArgs::Builder::Set(absl::string_view name,
+                                                int value) {
+  return Set(name, Value(value));
+}
+
+ChannelArgs::Builder& ChannelArgs::Builder::Set(absl::string_view name,
+                                                absl::string_view value) {
+  return Set(name, Value(std::string(value)));
+}
+
+ChannelArgs::Builder& ChannelArgs::Builder::Set(absl::string_view name,
+                                                std::string value) {
+  return Set(name, Value(std::move(value)));
+}
+
+ChannelArgs::Builder& ChannelArgs::Builder::Set(absl::string_view name,
+                                                const char* value) {
+  return Set(name, Value(std::string(value)));
+}
+
+ChannelArgs::Builder& ChannelArgs::Builder::Set(absl::string_view name,
+                                                Value value) {
+  entries_.emplace_back(std::string(name), std::move(value));
+  return *this;
+}
+
+ChannelArgs ChannelArgs::Builder::Build() {
+  if (entries_.empty()) return std::move(base_);
+  if (!base_.args_.Empty()) {
+    // Layer the accumulated settings over the (shared) base tree.
+    AVL<std::string, Value> args = base_.args_;
+    for (auto& entry : entries_) {
+      args = args.Add(std::move(entry.first), std::move(entry.second));
+    }
+    entries_.clear();
+    base_ = ChannelArgs();
+    return ChannelArgs(std::move(args));
+  }
+  // No base: batch-construct a balanced tree in a single pass.
+  std::stable_sort(entries_.begin(), entries_.end(),
+                   [](const std::pair<std::string, Value>& a,
+                      const std::pair<std::string, Value>& b) {
+                     return a.first < b.first;
+                   });
+  // Collapse duplicate keys, keeping the last Set() for each.
+  size_t out = 0;
+  for (size_t i = 0; i < entries_.size(); ++i) {
+    if (i + 1 < entries_.size() && entries_[i + 1].first == entries_[i].first) {
+      continue;
+    }
+    if (out != i) entries_[out] = std::move(entries_[i]);
+    ++out;
+  }
+  entries_.resize(out);
+  return ChannelArgs(
+      AVL<std::string, Value>::FromSortedEntries(std::move(entries_)));
+}
+
 absl::optional<int> ChannelArgs::GetInt(absl::string_view name) const {
   auto* v = Get(name);
   if (v == nullptr) return absl::nullopt;
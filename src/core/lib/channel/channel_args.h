@@ -28,6 +28,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/meta/type_traits.h"
 #include "absl/strings/string_view.h"
@@ -267,6 +268,8 @@ class ChannelArgs {
   using CPtr =
       std::unique_ptr<const grpc_channel_args, ChannelArgs::ChannelArgsDeleter>;
 
+  class Builder;
+
   ChannelArgs();
   ~ChannelArgs();
   ChannelArgs(const ChannelArgs&);
@@ -412,6 +415,64 @@ class ChannelArgs {
   AVL<std::string, Value> args_;
 };
 
+// Accumulates Set() calls and applies them all at once in Build(),
+// avoiding the per-call tree rebuild that ChannelArgs::Set() performs:
+// with no base the tree is batch-constructed in one balanced pass, one
+// node allocation per arg.  A Builder may instead be seeded with a base
+// ChannelArgs, in which case Build() layers the accumulated settings over
+// it while sharing the base's tree nodes -- this makes a frozen
+// "template" args object cheap to specialize per channel, for the common
+// case where most channels share identical args and differ only in a
+// handful of values.
+class ChannelArgs::Builder {
+ public:
+  Builder() = default;
+  explicit Builder(ChannelArgs base) : base_(std::move(base)) {}
+
+  Builder(const Builder&) = delete;
+  Builder& operator=(const Builder&) = delete;
+  Builder(Builder&&) = default;
+  Builder& operator=(Builder&&) = default;
+
+  Builder& Set(absl::string_view name, Pointer value);
+  Builder& Set(absl::string_view name, int value);
+  Builder& Set(absl::string_view name, absl::string_view value);
+  Builder& Set(absl::string_view name, std::string value);
+  Builder& Set(absl::string_view name, const char* value);
+  template <typename T>
+  absl::enable_if_t<
+      std::is_same<const grpc_arg_pointer_vtable*,
+                   decltype(ChannelArgTypeTraits<T>::VTable())>::value,
+      Builder&>
+  Set(absl::string_view name, T* value) {
+    return Set(name,
+               Pointer(ChannelArgTypeTraits<T>::TakeUnownedPointer(value),
+                       ChannelArgTypeTraits<T>::VTable()));
+  }
+  template <typename T>
+  auto Set(absl::string_view name, RefCountedPtr<T> value)
+      -> absl::enable_if_t<
+          std::is_same<const grpc_arg_pointer_vtable*,
+                       decltype(ChannelArgTypeTraits<
+                                absl::remove_cvref_t<T>>::VTable())>::value,
+          Builder&> {
+    return Set(
+        name, Pointer(value.release(),
+                      ChannelArgTypeTraits<absl::remove_cvref_t<T>>::VTable()));
+  }
+
+  // Applies the accumulated settings.  Later Set() calls with the same
+  // name win, matching the behavior of repeated ChannelArgs::Set().
+  // Leaves the builder empty.
+  GRPC_MUST_USE_RESULT ChannelArgs Build();
+
+ private:
+  Builder& Set(absl::string_view name, Value value);
+
+  ChannelArgs base_;
+  std::vector<std::pair<std::string, Value>> entries_;
+};
+
 std::ostream& operator<<(std::ostream& out, const ChannelArgs& args);
 
 }  // namespace grpc_core
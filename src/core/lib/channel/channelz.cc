@@ -418,10 +418,14 @@ namespace {
 void PopulateSocketAddressJson(Json::Object* json, const char* name,
                                const char* addr_str) {
   if (addr_str == nullptr) return;
-  absl::StatusOr<URI> uri = URI::Parse(addr_str);
+  // A non-owning view suffices here: we only dispatch on the scheme and
+  // decode the path for the schemes we understand, and this runs for every
+  // socket on every channelz scrape.
+  absl::StatusOr<URIView> uri = URIView::Parse(addr_str);
   if (uri.ok()) {
     if (uri->scheme() == "ipv4" || uri->scheme() == "ipv6") {
-      auto address = StringToSockaddr(absl::StripPrefix(uri->path(), "/"));
+      auto address = StringToSockaddr(
+          absl::StripPrefix(URI::PercentDecode(uri->path()), "/"));
       if (address.ok()) {
         std::string packed_host = grpc_sockaddr_get_packed_host(&*address);
         (*json)[name] = Json::Object{
@@ -437,7 +441,7 @@ void PopulateSocketAddressJson(Json::Object* json, const char* name,
       (*json)[name] = Json::Object{
           {"uds_address",
            Json::Object{
-               {"filename", uri->path()},
+               {"filename", URI::PercentDecode(uri->path())},
            }},
       };
       return;
@@ -455,91 +459,295 @@ void PopulateSocketAddressJson(Json::Object* json, const char* name,
 }  // namespace
 
 SocketNode::SocketNode(std::string local, std::string remote, std::string name,
-                       RefCountedPtr<Security> security)
+                       RefCountedPtr<Security> security, bool record_counters)
     : BaseNode(EntityType::kSocket, std::move(name)),
       local_(std::move(local)),
       remote_(std::move(remote)),
-      security_(std::move(security)) {}
+      security_(std::move(security)) {
+  if (record_counters) {
+    num_cores_ = std::max(1u, gpr_cpu_num_cores());
+    per_cpu_counter_data_storage_.reserve(num_cores_);
+    for (size_t i = 0; i < num_cores_; ++i) {
+      per_cpu_counter_data_storage_.emplace_back();
+    }
+  }
+}
+
+bool SocketNode::SampleNewSocket(size_t sampling_period) {
+  if (sampling_period <= 1) return true;
+  static std::atomic<uint64_t> socket_sequence{0};
+  return socket_sequence.fetch_add(1, std::memory_order_relaxed) %
+             sampling_period ==
+         0;
+}
 
 void SocketNode::RecordStreamStartedFromLocal() {
-  streams_started_.fetch_add(1, std::memory_order_relaxed);
-  last_local_stream_created_cycle_.store(gpr_get_cycle_counter(),
-                                         std::memory_order_relaxed);
+  if (num_cores_ == 0) return;
+  AtomicCounterData& data =
+      per_cpu_counter_data_storage_[ExecCtx::Get()->starting_cpu()];
+  data.streams_started.fetch_add(1, std::memory_order_relaxed);
+  data.last_local_stream_created_cycle.store(gpr_get_cycle_counter(),
+                                             std::memory_order_relaxed);
 }
 
 void SocketNode::RecordStreamStartedFromRemote() {
-  streams_started_.fetch_add(1, std::memory_order_relaxed);
-  last_remote_stream_created_cycle_.store(gpr_get_cycle_counter(),
-                                          std::memory_order_relaxed);
+  if (num_cores_ == 0) return;
+  AtomicCounterData& data =
+      per_cpu_counter_data_storage_[ExecCtx::Get()->starting_cpu()];
+  data.streams_started.fetch_add(1, std::memory_order_relaxed);
+  data.last_remote_stream_created_cycle.store(gpr_get_cycle_counter(),
+                                              std::memory_order_relaxed);
+}
+
+void SocketNode::RecordStreamSucceeded() {
+  if (num_cores_ == 0) return;
+  per_cpu_counter_data_storage_[ExecCtx::Get()->starting_cpu()]
+      .streams_succeeded.fetch_add(1, std::memory_order_relaxed);
+}
+
+void SocketNode::RecordStreamFailed() {
+  if (num_cores_ == 0) return;
+  per_cpu_counter_data_storage_[ExecCtx::Get()->starting_cpu()]
+      .streams_failed.fetch_add(1, std::memory_order_relaxed);
 }
 
 void SocketNode::RecordMessagesSent(uint32_t num_sent) {
-  messages_sent_.fetch_add(num_sent, std::memory_order_relaxed);
-  last_message_sent_cycle_.store(gpr_get_cycle_counter(),
-                                 std::memory_order_relaxed);
+  if (num_cores_ == 0) return;
+  AtomicCounterData& data =
+      per_cpu_counter_data_storage_[ExecCtx::Get()->starting_cpu()];
+  data.messages_sent.fetch_add(num_sent, std::memory_order_relaxed);
+  data.last_message_sent_cycle.store(gpr_get_cycle_counter(),
+                                     std::memory_order_relaxed);
 }
 
 void SocketNode::RecordMessageReceived() {
-  messages_received_.fetch_add(1, std::memory_order_relaxed);
-  last_message_received_cycle_.store(gpr_get_cycle_counter(),
-                                     std::memory_order_relaxed);
+  if (num_cores_ == 0) return;
+  AtomicCounterData& data =
+      per_cpu_counter_data_storage_[ExecCtx::Get()->starting_cpu()];
+  data.messages_received.fetch_add(1, std::memory_order_relaxed);
+  data.last_message_received_cycle.store(gpr_get_cycle_counter(),
+                                         std::memory_order_relaxed);
+}
+
+void SocketNode::RecordKeepaliveSent() {
+  if (num_cores_ == 0) return;
+  per_cpu_counter_data_storage_[ExecCtx::Get()->starting_cpu()]
+      .keepalives_sent.fetch_add(1, std::memory_order_relaxed);
+}
+
+void SocketNode::TxByteAckLatency::Increment(int64_t queued_to_acked_usec,
+                                             int64_t sendmsg_to_acked_usec) {
+  int64_t usec = queued_to_acked_usec;
+  size_t bucket = 0;
+  while (usec > 1 && bucket + 1 < kNumBuckets) {
+    usec >>= 1;
+    bucket++;
+  }
+  buckets[bucket]++;
+  count++;
+  max_usec = std::max(max_usec, queued_to_acked_usec);
+  network_usec_total += sendmsg_to_acked_usec;
+  transport_usec_total +=
+      std::max(int64_t{0}, queued_to_acked_usec - sendmsg_to_acked_usec);
+}
+
+int64_t SocketNode::TxByteAckLatency::PercentileUsec(double percentile) const {
+  if (count == 0) return 0;
+  uint64_t target =
+      static_cast<uint64_t>(static_cast<double>(count) * percentile / 100.0);
+  uint64_t seen = 0;
+  for (size_t i = 0; i < kNumBuckets; i++) {
+    seen += buckets[i];
+    if (seen > target) {
+      return std::min(max_usec, int64_t{1} << i);
+    }
+  }
+  return max_usec;
+}
+
+void SocketNode::RecordTxByteAckLatency(uint32_t stream_id,
+                                        int64_t queued_to_acked_usec,
+                                        int64_t sendmsg_to_acked_usec) {
+  if (queued_to_acked_usec < 0) return;
+  MutexLock lock(&tx_byte_ack_latency_mu_);
+  total_tx_byte_ack_latency_.Increment(queued_to_acked_usec,
+                                       sendmsg_to_acked_usec);
+  auto it = per_stream_tx_byte_ack_latency_.find(stream_id);
+  if (it == per_stream_tx_byte_ack_latency_.end()) {
+    if (per_stream_tx_byte_ack_latency_.size() >=
+        kMaxTxByteAckLatencyStreams) {
+      return;
+    }
+    it = per_stream_tx_byte_ack_latency_
+             .emplace(stream_id, TxByteAckLatency())
+             .first;
+  }
+  it->second.Increment(queued_to_acked_usec, sendmsg_to_acked_usec);
+}
+
+void SocketNode::CollectData(CounterData* out) {
+  for (size_t core = 0; core < num_cores_; ++core) {
+    AtomicCounterData& data = per_cpu_counter_data_storage_[core];
+
+    out->streams_started += data.streams_started.load(std::memory_order_relaxed);
+    out->streams_succeeded +=
+        data.streams_succeeded.load(std::memory_order_relaxed);
+    out->streams_failed += data.streams_failed.load(std::memory_order_relaxed);
+    out->messages_sent += data.messages_sent.load(std::memory_order_relaxed);
+    out->messages_received +=
+        data.messages_received.load(std::memory_order_relaxed);
+    out->keepalives_sent +=
+        data.keepalives_sent.load(std::memory_order_relaxed);
+    out->last_local_stream_created_cycle =
+        std::max(out->last_local_stream_created_cycle,
+                 data.last_local_stream_created_cycle.load(
+                     std::memory_order_relaxed));
+    out->last_remote_stream_created_cycle =
+        std::max(out->last_remote_stream_created_cycle,
+                 data.last_remote_stream_created_cycle.load(
+                     std::memory_order_relaxed));
+    out->last_message_sent_cycle =
+        std::max(out->last_message_sent_cycle,
+                 data.last_message_sent_cycle.load(std::memory_order_relaxed));
+    out->last_message_received_cycle =
+        std::max(out->last_message_received_cycle,
+                 data.last_message_received_cycle.load(
+                     std::memory_order_relaxed));
+  }
 }
 
 Json SocketNode::RenderJson() {
   // Create and fill the data child.
   Json::Object data;
   gpr_timespec ts;
-  int64_t streams_started = streams_started_.load(std::memory_order_relaxed);
-  if (streams_started != 0) {
-    data["streamsStarted"] = std::to_string(streams_started);
-    gpr_cycle_counter last_local_stream_created_cycle =
-        last_local_stream_created_cycle_.load(std::memory_order_relaxed);
-    if (last_local_stream_created_cycle != 0) {
+  CounterData counters;
+  CollectData(&counters);
+  if (counters.streams_started != 0) {
+    data["streamsStarted"] = std::to_string(counters.streams_started);
+    if (counters.last_local_stream_created_cycle != 0) {
       ts = gpr_convert_clock_type(
-          gpr_cycle_counter_to_time(last_local_stream_created_cycle),
+          gpr_cycle_counter_to_time(counters.last_local_stream_created_cycle),
           GPR_CLOCK_REALTIME);
       data["lastLocalStreamCreatedTimestamp"] = gpr_format_timespec(ts);
     }
-    gpr_cycle_counter last_remote_stream_created_cycle =
-        last_remote_stream_created_cycle_.load(std::memory_order_relaxed);
-    if (last_remote_stream_created_cycle != 0) {
+    if (counters.last_remote_stream_created_cycle != 0) {
       ts = gpr_convert_clock_type(
-          gpr_cycle_counter_to_time(last_remote_stream_created_cycle),
+          gpr_cycle_counter_to_time(counters.last_remote_stream_created_cycle),
           GPR_CLOCK_REALTIME);
       data["lastRemoteStreamCreatedTimestamp"] = gpr_format_timespec(ts);
     }
   }
-  int64_t streams_succeeded =
-      streams_succeeded_.load(std::memory_order_relaxed);
-  if (streams_succeeded != 0) {
-    data["streamsSucceeded"] = std::to_string(streams_succeeded);
+  if (counters.streams_succeeded != 0) {
+    data["streamsSucceeded"] = std::to_string(counters.streams_succeeded);
   }
-  int64_t streams_failed = streams_failed_.load(std::memory_order_relaxed);
-  if (streams_failed != 0) {
-    data["streamsFailed"] = std::to_string(streams_failed);
+  if (counters.streams_failed != 0) {
+    data["streamsFailed"] = std::to_string(counters.streams_failed);
   }
-  int64_t messages_sent = messages_sent_.load(std::memory_order_relaxed);
-  if (messages_sent != 0) {
-    data["messagesSent"] = std::to_string(messages_sent);
+  if (counters.messages_sent != 0) {
+    data["messagesSent"] = std::to_string(counters.messages_sent);
     ts = gpr_convert_clock_type(
-        gpr_cycle_counter_to_time(
-            last_message_sent_cycle_.load(std::memory_order_relaxed)),
+        gpr_cycle_counter_to_time(counters.last_message_sent_cycle),
         GPR_CLOCK_REALTIME);
     data["lastMessageSentTimestamp"] = gpr_format_timespec(ts);
   }
-  int64_t messages_received =
-      messages_received_.load(std::memory_order_relaxed);
-  if (messages_received != 0) {
-    data["messagesReceived"] = std::to_string(messages_received);
+  if (counters.messages_received != 0) {
+    data["messagesReceived"] = std::to_string(counters.messages_received);
     ts = gpr_convert_clock_type(
-        gpr_cycle_counter_to_time(
-            last_message_received_cycle_.load(std::memory_order_relaxed)),
+        gpr_cycle_counter_to_time(counters.last_message_received_cycle),
         GPR_CLOCK_REALTIME);
     data["lastMessageReceivedTimestamp"] = gpr_format_timespec(ts);
   }
-  int64_t keepalives_sent = keepalives_sent_.load(std::memory_order_relaxed);
-  if (keepalives_sent != 0) {
-    data["keepAlivesSent"] = std::to_string(keepalives_sent);
+  if (counters.keepalives_sent != 0) {
+    data["keepAlivesSent"] = std::to_string(counters.keepalives_sent);
+  }
+  int64_t tcp_rtt_usec = tcp_rtt_usec_.load(std::memory_order_relaxed);
+  if (tcp_rtt_usec >= 0) {
+    data["tcpRttUsec"] = std::to_string(tcp_rtt_usec);
+    data["tcpRetransmits"] = std::to_string(
+        tcp_total_retransmits_.load(std::memory_order_relaxed));
+    data["tcpDeliveryRateBytesPerSecond"] = std::to_string(
+        tcp_delivery_rate_bytes_per_sec_.load(std::memory_order_relaxed));
+    data["tcpCongestionWindowPackets"] = std::to_string(
+        tcp_congestion_window_packets_.load(std::memory_order_relaxed));
+  }
+  // Write-path stall attribution, if the transport has reported any.
+  int64_t transport_window_stalls =
+      transport_window_stalls_.load(std::memory_order_relaxed);
+  if (transport_window_stalls != 0) {
+    data["transportWindowStalls"] = std::to_string(transport_window_stalls);
+    data["transportWindowStalledBytes"] = std::to_string(
+        transport_window_stalled_bytes_.load(std::memory_order_relaxed));
+    data["transportWindowStalledMillis"] = std::to_string(
+        transport_window_stalled_millis_.load(std::memory_order_relaxed));
+  }
+  int64_t stream_window_stalls =
+      stream_window_stalls_.load(std::memory_order_relaxed);
+  if (stream_window_stalls != 0) {
+    data["streamWindowStalls"] = std::to_string(stream_window_stalls);
+    data["streamWindowStalledBytes"] = std::to_string(
+        stream_window_stalled_bytes_.load(std::memory_order_relaxed));
+    data["streamWindowStalledMillis"] = std::to_string(
+        stream_window_stalled_millis_.load(std::memory_order_relaxed));
+  }
+  int64_t endpoint_write_bytes =
+      endpoint_write_bytes_.load(std::memory_order_relaxed);
+  if (endpoint_write_bytes != 0) {
+    data["endpointWriteBytes"] = std::to_string(endpoint_write_bytes);
+    data["endpointWriteMillis"] =
+        std::to_string(endpoint_write_millis_.load(std::memory_order_relaxed));
+  }
+  int64_t no_data_write_cycles =
+      no_data_write_cycles_.load(std::memory_order_relaxed);
+  if (no_data_write_cycles != 0) {
+    data["noDataWriteCycles"] = std::to_string(no_data_write_cycles);
+  }
+  // BDP estimator state, if the transport has reported any.
+  int64_t bdp_estimate_bytes =
+      bdp_estimate_bytes_.load(std::memory_order_relaxed);
+  if (bdp_estimate_bytes != 0) {
+    data["bdpEstimateBytes"] = std::to_string(bdp_estimate_bytes);
+    data["bdpBandwidthEstimateBytesPerSecond"] = std::to_string(
+        bdp_bandwidth_estimate_bytes_per_sec_.load(std::memory_order_relaxed));
+    data["bdpInterProbeDelayMillis"] = std::to_string(
+        bdp_inter_probe_delay_millis_.load(std::memory_order_relaxed));
+    data["bdpProbing"] =
+        bdp_probing_.load(std::memory_order_relaxed) ? "true" : "false";
+  }
+  int64_t target_write_size_bytes =
+      target_write_size_bytes_.load(std::memory_order_relaxed);
+  if (target_write_size_bytes != 0) {
+    data["targetWriteSizeBytes"] = std::to_string(target_write_size_bytes);
+  }
+  // TX byte-ACK latency, if the transport opted into TX timestamp tracing.
+  {
+    MutexLock lock(&tx_byte_ack_latency_mu_);
+    if (total_tx_byte_ack_latency_.count != 0) {
+      data["txByteAckLatencyCount"] =
+          std::to_string(total_tx_byte_ack_latency_.count);
+      data["txByteAckLatencyP50Usec"] =
+          std::to_string(total_tx_byte_ack_latency_.PercentileUsec(50));
+      data["txByteAckLatencyP99Usec"] =
+          std::to_string(total_tx_byte_ack_latency_.PercentileUsec(99));
+      data["txByteAckLatencyMaxUsec"] =
+          std::to_string(total_tx_byte_ack_latency_.max_usec);
+      data["txByteAckLatencyTransportUsec"] =
+          std::to_string(total_tx_byte_ack_latency_.transport_usec_total);
+      data["txByteAckLatencyNetworkUsec"] =
+          std::to_string(total_tx_byte_ack_latency_.network_usec_total);
+      Json::Array streams;
+      for (const auto& p : per_stream_tx_byte_ack_latency_) {
+        streams.emplace_back(Json::Object{
+            {"streamId", std::to_string(p.first)},
+            {"count", std::to_string(p.second.count)},
+            {"p50Usec", std::to_string(p.second.PercentileUsec(50))},
+            {"p99Usec", std::to_string(p.second.PercentileUsec(99))},
+            {"maxUsec", std::to_string(p.second.max_usec)},
+            {"transportUsec", std::to_string(p.second.transport_usec_total)},
+            {"networkUsec", std::to_string(p.second.network_usec_total)},
+        });
+      }
+      data["txByteAckLatencyStreams"] = std::move(streams);
+    }
   }
   // Create and fill the parent object.
   Json::Object object = {
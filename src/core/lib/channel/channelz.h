@@ -318,39 +318,204 @@ class SocketNode : public BaseNode {
         const grpc_channel_args* args);
   };
 
+  // If record_counters is false, the socket is still listed by channelz but
+  // never allocates counter storage, and all Record* calls become no-ops.
   SocketNode(std::string local, std::string remote, std::string name,
-             RefCountedPtr<Security> security);
+             RefCountedPtr<Security> security, bool record_counters = true);
   ~SocketNode() override {}
 
+  // Decides whether the next socket created should record per-socket
+  // counters, given the configured sampling period: one socket out of every
+  // sampling_period records detail. Periods of 0 and 1 sample every socket.
+  static bool SampleNewSocket(size_t sampling_period);
+
   Json RenderJson() override;
 
   void RecordStreamStartedFromLocal();
   void RecordStreamStartedFromRemote();
-  void RecordStreamSucceeded() {
-    streams_succeeded_.fetch_add(1, std::memory_order_relaxed);
-  }
-  void RecordStreamFailed() {
-    streams_failed_.fetch_add(1, std::memory_order_relaxed);
-  }
+  void RecordStreamSucceeded();
+  void RecordStreamFailed();
   void RecordMessagesSent(uint32_t num_sent);
   void RecordMessageReceived();
-  void RecordKeepaliveSent() {
-    keepalives_sent_.fetch_add(1, std::memory_order_relaxed);
+  void RecordKeepaliveSent();
+  // Stores the most recent TCP_INFO sample taken for the underlying socket.
+  // A negative rtt marks the socket as never sampled and suppresses the
+  // kernel stats in the rendered json.
+  void RecordTcpStats(int64_t rtt_usec, int64_t total_retransmits,
+                      int64_t delivery_rate_bytes_per_sec,
+                      int64_t congestion_window_packets) {
+    tcp_rtt_usec_.store(rtt_usec, std::memory_order_relaxed);
+    tcp_total_retransmits_.store(total_retransmits, std::memory_order_relaxed);
+    tcp_delivery_rate_bytes_per_sec_.store(delivery_rate_bytes_per_sec,
+                                           std::memory_order_relaxed);
+    tcp_congestion_window_packets_.store(congestion_window_packets,
+                                         std::memory_order_relaxed);
+  }
+  // Stores a snapshot of the transport's cumulative write-path stall
+  // attribution. Like RecordTcpStats, the values are whole-value samples
+  // refreshed periodically by the transport, not hot-path increments.
+  void RecordWriteStallStats(int64_t transport_window_stalls,
+                             int64_t transport_window_stalled_bytes,
+                             int64_t transport_window_stalled_millis,
+                             int64_t stream_window_stalls,
+                             int64_t stream_window_stalled_bytes,
+                             int64_t stream_window_stalled_millis,
+                             int64_t endpoint_write_millis,
+                             int64_t endpoint_write_bytes,
+                             int64_t no_data_write_cycles) {
+    transport_window_stalls_.store(transport_window_stalls,
+                                   std::memory_order_relaxed);
+    transport_window_stalled_bytes_.store(transport_window_stalled_bytes,
+                                          std::memory_order_relaxed);
+    transport_window_stalled_millis_.store(transport_window_stalled_millis,
+                                           std::memory_order_relaxed);
+    stream_window_stalls_.store(stream_window_stalls,
+                                std::memory_order_relaxed);
+    stream_window_stalled_bytes_.store(stream_window_stalled_bytes,
+                                       std::memory_order_relaxed);
+    stream_window_stalled_millis_.store(stream_window_stalled_millis,
+                                        std::memory_order_relaxed);
+    endpoint_write_millis_.store(endpoint_write_millis,
+                                 std::memory_order_relaxed);
+    endpoint_write_bytes_.store(endpoint_write_bytes,
+                                std::memory_order_relaxed);
+    no_data_write_cycles_.store(no_data_write_cycles,
+                                std::memory_order_relaxed);
+  }
+  // Stores a snapshot of the transport's BDP estimator state, refreshed
+  // after each completed probe. probing is false while the estimator is
+  // quiesced on an idle transport.
+  void RecordBdpEstimatorState(int64_t bdp_estimate_bytes,
+                               int64_t bandwidth_estimate_bytes_per_sec,
+                               int64_t inter_probe_delay_millis,
+                               bool probing) {
+    bdp_estimate_bytes_.store(bdp_estimate_bytes, std::memory_order_relaxed);
+    bdp_bandwidth_estimate_bytes_per_sec_.store(
+        bandwidth_estimate_bytes_per_sec, std::memory_order_relaxed);
+    bdp_inter_probe_delay_millis_.store(inter_probe_delay_millis,
+                                        std::memory_order_relaxed);
+    bdp_probing_.store(probing, std::memory_order_relaxed);
+  }
+  // Stores the transport's current adaptive target write size, refreshed
+  // after each endpoint write.
+  void RecordTargetWriteSize(int64_t target_write_size_bytes) {
+    target_write_size_bytes_.store(target_write_size_bytes,
+                                   std::memory_order_relaxed);
   }
+  // Records one kernel TX-timestamp sample for a stream: the latency from
+  // the write being queued in the transport until the kernel reported the
+  // bytes ACKed (SCM_TSTAMP_ACK), and the portion of that spent on the
+  // network (sendmsg to ACK). Unlike the snapshot recorders above this is
+  // called from the TCP error-queue processing path, which races with
+  // channelz queries, so the latency state is mutex-guarded.
+  void RecordTxByteAckLatency(uint32_t stream_id, int64_t queued_to_acked_usec,
+                              int64_t sendmsg_to_acked_usec);
 
   const std::string& remote() { return remote_; }
 
  private:
-  std::atomic<int64_t> streams_started_{0};
-  std::atomic<int64_t> streams_succeeded_{0};
-  std::atomic<int64_t> streams_failed_{0};
-  std::atomic<int64_t> messages_sent_{0};
-  std::atomic<int64_t> messages_received_{0};
-  std::atomic<int64_t> keepalives_sent_{0};
-  std::atomic<gpr_cycle_counter> last_local_stream_created_cycle_{0};
-  std::atomic<gpr_cycle_counter> last_remote_stream_created_cycle_{0};
-  std::atomic<gpr_cycle_counter> last_message_sent_cycle_{0};
-  std::atomic<gpr_cycle_counter> last_message_received_cycle_{0};
+  // Sharded like CallCountingHelper::AtomicCounterData so that stream and
+  // message accounting on a busy transport never bounces a shared cache line
+  // between cores.
+  struct AtomicCounterData {
+    // Define the ctors so that we can use this structure in InlinedVector.
+    AtomicCounterData() = default;
+    AtomicCounterData(const AtomicCounterData& that)
+        : streams_started(that.streams_started.load(std::memory_order_relaxed)),
+          streams_succeeded(
+              that.streams_succeeded.load(std::memory_order_relaxed)),
+          streams_failed(that.streams_failed.load(std::memory_order_relaxed)),
+          messages_sent(that.messages_sent.load(std::memory_order_relaxed)),
+          messages_received(
+              that.messages_received.load(std::memory_order_relaxed)),
+          keepalives_sent(that.keepalives_sent.load(std::memory_order_relaxed)),
+          last_local_stream_created_cycle(
+              that.last_local_stream_created_cycle.load(
+                  std::memory_order_relaxed)),
+          last_remote_stream_created_cycle(
+              that.last_remote_stream_created_cycle.load(
+                  std::memory_order_relaxed)),
+          last_message_sent_cycle(
+              that.last_message_sent_cycle.load(std::memory_order_relaxed)),
+          last_message_received_cycle(that.last_message_received_cycle.load(
+              std::memory_order_relaxed)) {}
+
+    std::atomic<int64_t> streams_started{0};
+    std::atomic<int64_t> streams_succeeded{0};
+    std::atomic<int64_t> streams_failed{0};
+    std::atomic<int64_t> messages_sent{0};
+    std::atomic<int64_t> messages_received{0};
+    std::atomic<int64_t> keepalives_sent{0};
+    std::atomic<gpr_cycle_counter> last_local_stream_created_cycle{0};
+    std::atomic<gpr_cycle_counter> last_remote_stream_created_cycle{0};
+    std::atomic<gpr_cycle_counter> last_message_sent_cycle{0};
+    std::atomic<gpr_cycle_counter> last_message_received_cycle{0};
+    // Make sure the size is exactly two cache lines.
+    uint8_t padding[2 * GPR_CACHELINE_SIZE - 6 * sizeof(std::atomic<int64_t>) -
+                    4 * sizeof(std::atomic<gpr_cycle_counter>)];
+  };
+
+  struct CounterData {
+    int64_t streams_started = 0;
+    int64_t streams_succeeded = 0;
+    int64_t streams_failed = 0;
+    int64_t messages_sent = 0;
+    int64_t messages_received = 0;
+    int64_t keepalives_sent = 0;
+    gpr_cycle_counter last_local_stream_created_cycle = 0;
+    gpr_cycle_counter last_remote_stream_created_cycle = 0;
+    gpr_cycle_counter last_message_sent_cycle = 0;
+    gpr_cycle_counter last_message_received_cycle = 0;
+  };
+
+  // collects the sharded data into one CounterData struct.
+  void CollectData(CounterData* out);
+
+  // Left empty (with num_cores_ == 0) when this socket was not sampled for
+  // detail collection.
+  std::vector<AtomicCounterData> per_cpu_counter_data_storage_;
+  size_t num_cores_ = 0;
+  std::atomic<int64_t> tcp_rtt_usec_{-1};
+  std::atomic<int64_t> tcp_total_retransmits_{-1};
+  std::atomic<int64_t> tcp_delivery_rate_bytes_per_sec_{-1};
+  std::atomic<int64_t> tcp_congestion_window_packets_{-1};
+  std::atomic<int64_t> transport_window_stalls_{0};
+  std::atomic<int64_t> transport_window_stalled_bytes_{0};
+  std::atomic<int64_t> transport_window_stalled_millis_{0};
+  std::atomic<int64_t> stream_window_stalls_{0};
+  std::atomic<int64_t> stream_window_stalled_bytes_{0};
+  std::atomic<int64_t> stream_window_stalled_millis_{0};
+  std::atomic<int64_t> endpoint_write_millis_{0};
+  std::atomic<int64_t> endpoint_write_bytes_{0};
+  std::atomic<int64_t> no_data_write_cycles_{0};
+  std::atomic<int64_t> bdp_estimate_bytes_{0};
+  std::atomic<int64_t> bdp_bandwidth_estimate_bytes_per_sec_{0};
+  std::atomic<int64_t> bdp_inter_probe_delay_millis_{0};
+  std::atomic<bool> bdp_probing_{false};
+  std::atomic<int64_t> target_write_size_bytes_{0};
+  // Latency from write-queued to TX ACK, bucketed in power-of-two
+  // microseconds (1us..~8s). Kept per stream so an incident can be narrowed
+  // to one RPC, plus an aggregate over the socket's lifetime.
+  struct TxByteAckLatency {
+    static constexpr size_t kNumBuckets = 24;
+    uint64_t buckets[kNumBuckets] = {};
+    uint64_t count = 0;
+    int64_t max_usec = 0;
+    // cumulative split of the samples: time queued in the transport and
+    // endpoint vs time on the wire
+    int64_t transport_usec_total = 0;
+    int64_t network_usec_total = 0;
+    void Increment(int64_t queued_to_acked_usec,
+                   int64_t sendmsg_to_acked_usec);
+    int64_t PercentileUsec(double percentile) const;
+  };
+  // Bounds per-socket memory; streams past the cap still feed the aggregate.
+  static constexpr size_t kMaxTxByteAckLatencyStreams = 32;
+  Mutex tx_byte_ack_latency_mu_;
+  std::map<uint32_t, TxByteAckLatency> per_stream_tx_byte_ack_latency_
+      ABSL_GUARDED_BY(tx_byte_ack_latency_mu_);
+  TxByteAckLatency total_tx_byte_ack_latency_
+      ABSL_GUARDED_BY(tx_byte_ack_latency_mu_);
   std::string local_;
   std::string remote_;
   RefCountedPtr<Security> const security_;
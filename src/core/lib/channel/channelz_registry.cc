@@ -52,13 +52,18 @@ void ChannelzRegistry::InternalRegister(BaseNode* node) {
   MutexLock lock(&mu_);
   node->uuid_ = ++uuid_generator_;
   node_map_[node->uuid_] = node;
+  typed_node_map_[static_cast<size_t>(node->type())][node->uuid_] = node;
 }
 
 void ChannelzRegistry::InternalUnregister(intptr_t uuid) {
   GPR_ASSERT(uuid >= 1);
   MutexLock lock(&mu_);
   GPR_ASSERT(uuid <= uuid_generator_);
-  node_map_.erase(uuid);
+  auto it = node_map_.find(uuid);
+  if (it != node_map_.end()) {
+    typed_node_map_[static_cast<size_t>(it->second->type())].erase(uuid);
+    node_map_.erase(it);
+  }
 }
 
 RefCountedPtr<BaseNode> ChannelzRegistry::InternalGet(intptr_t uuid) {
@@ -76,79 +81,52 @@ RefCountedPtr<BaseNode> ChannelzRegistry::InternalGet(intptr_t uuid) {
 
 std::string ChannelzRegistry::InternalGetTopChannels(
     intptr_t start_channel_id) {
-  std::vector<RefCountedPtr<BaseNode>> top_level_channels;
-  RefCountedPtr<BaseNode> node_after_pagination_limit;
-  {
-    MutexLock lock(&mu_);
-    for (auto it = node_map_.lower_bound(start_channel_id);
-         it != node_map_.end(); ++it) {
-      BaseNode* node = it->second;
-      RefCountedPtr<BaseNode> node_ref;
-      if (node->type() == BaseNode::EntityType::kTopLevelChannel &&
-          (node_ref = node->RefIfNonZero()) != nullptr) {
-        // Check if we are over pagination limit to determine if we need to set
-        // the "end" element. If we don't go through this block, we know that
-        // when the loop terminates, we have <= to kPaginationLimit.
-        // Note that because we have already increased this node's
-        // refcount, we need to decrease it, but we can't unref while
-        // holding the lock, because this may lead to a deadlock.
-        if (top_level_channels.size() == kPaginationLimit) {
-          node_after_pagination_limit = std::move(node_ref);
-          break;
-        }
-        top_level_channels.emplace_back(std::move(node_ref));
-      }
-    }
-  }
-  Json::Object object;
-  if (!top_level_channels.empty()) {
-    // Create list of channels.
-    Json::Array array;
-    for (size_t i = 0; i < top_level_channels.size(); ++i) {
-      array.emplace_back(top_level_channels[i]->RenderJson());
-    }
-    object["channel"] = std::move(array);
-  }
-  if (node_after_pagination_limit == nullptr) object["end"] = true;
-  Json json(std::move(object));
-  return json.Dump();
+  intptr_t next_channel_id;
+  return InternalGetNodesBatch(BaseNode::EntityType::kTopLevelChannel,
+                               "channel", start_channel_id, kPaginationLimit,
+                               &next_channel_id);
 }
 
 std::string ChannelzRegistry::InternalGetServers(intptr_t start_server_id) {
-  std::vector<RefCountedPtr<BaseNode>> servers;
-  RefCountedPtr<BaseNode> node_after_pagination_limit;
+  intptr_t next_server_id;
+  return InternalGetNodesBatch(BaseNode::EntityType::kServer, "server",
+                               start_server_id, kPaginationLimit,
+                               &next_server_id);
+}
+
+std::string ChannelzRegistry::InternalGetNodesBatch(
+    BaseNode::EntityType type, const char* entity_name, intptr_t start_node_id,
+    size_t max_results, intptr_t* next_node_id) {
+  std::vector<RefCountedPtr<BaseNode>> nodes;
+  *next_node_id = 0;
   {
     MutexLock lock(&mu_);
-    for (auto it = node_map_.lower_bound(start_server_id);
-         it != node_map_.end(); ++it) {
-      BaseNode* node = it->second;
-      RefCountedPtr<BaseNode> node_ref;
-      if (node->type() == BaseNode::EntityType::kServer &&
-          (node_ref = node->RefIfNonZero()) != nullptr) {
-        // Check if we are over pagination limit to determine if we need to set
-        // the "end" element. If we don't go through this block, we know that
-        // when the loop terminates, we have <= to kPaginationLimit.
-        // Note that because we have already increased this node's
-        // refcount, we need to decrease it, but we can't unref while
+    auto& index = typed_node_map_[static_cast<size_t>(type)];
+    for (auto it = index.lower_bound(start_node_id); it != index.end(); ++it) {
+      if (nodes.size() == max_results) {
+        // More nodes remain: record where the next batch should resume.
+        // Note that because we have already increased the collected nodes'
+        // refcounts, we need to decrease them, but we can't unref while
         // holding the lock, because this may lead to a deadlock.
-        if (servers.size() == kPaginationLimit) {
-          node_after_pagination_limit = std::move(node_ref);
-          break;
-        }
-        servers.emplace_back(std::move(node_ref));
+        *next_node_id = it->first;
+        break;
+      }
+      RefCountedPtr<BaseNode> node_ref = it->second->RefIfNonZero();
+      if (node_ref != nullptr) {
+        nodes.emplace_back(std::move(node_ref));
       }
     }
   }
   Json::Object object;
-  if (!servers.empty()) {
-    // Create list of servers.
+  if (!nodes.empty()) {
+    // Create list of entities.
     Json::Array array;
-    for (size_t i = 0; i < servers.size(); ++i) {
-      array.emplace_back(servers[i]->RenderJson());
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      array.emplace_back(nodes[i]->RenderJson());
     }
-    object["server"] = std::move(array);
+    object[entity_name] = std::move(array);
   }
-  if (node_after_pagination_limit == nullptr) object["end"] = true;
+  if (*next_node_id == 0) object["end"] = true;
   Json json(std::move(object));
   return json.Dump();
 }
@@ -189,6 +167,30 @@ char* grpc_channelz_get_servers(intptr_t start_server_id) {
           .c_str());
 }
 
+char* grpc_channelz_get_top_channels_batch(intptr_t start_channel_id,
+                                           intptr_t max_results,
+                                           intptr_t* next_channel_id) {
+  grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
+  grpc_core::ExecCtx exec_ctx;
+  if (max_results <= 0 || next_channel_id == nullptr) return nullptr;
+  return gpr_strdup(grpc_core::channelz::ChannelzRegistry::GetTopChannelsBatch(
+                        start_channel_id, static_cast<size_t>(max_results),
+                        next_channel_id)
+                        .c_str());
+}
+
+char* grpc_channelz_get_servers_batch(intptr_t start_server_id,
+                                      intptr_t max_results,
+                                      intptr_t* next_server_id) {
+  grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
+  grpc_core::ExecCtx exec_ctx;
+  if (max_results <= 0 || next_server_id == nullptr) return nullptr;
+  return gpr_strdup(grpc_core::channelz::ChannelzRegistry::GetServersBatch(
+                        start_server_id, static_cast<size_t>(max_results),
+                        next_server_id)
+                        .c_str());
+}
+
 char* grpc_channelz_get_server(intptr_t server_id) {
   grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
   grpc_core::ExecCtx exec_ctx;
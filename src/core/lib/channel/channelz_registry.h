@@ -56,6 +56,29 @@ class ChannelzRegistry {
     return Default()->InternalGetServers(start_server_id);
   }
 
+  // Streaming variants of GetTopChannels()/GetServers(). Each call renders
+  // at most max_results entities starting at start_channel_id (resp.
+  // start_server_id) and sets *next_channel_id (resp. *next_server_id) to
+  // the cursor for the next call, or 0 once iteration is complete. The
+  // cursor is a uuid: since uuids are monotonically increasing and never
+  // reused, iteration is stable against concurrent registrations and
+  // unregistrations. Only the bounded batch of node refs is taken while
+  // holding the registry lock; JSON rendering happens outside it.
+  static std::string GetTopChannelsBatch(intptr_t start_channel_id,
+                                         size_t max_results,
+                                         intptr_t* next_channel_id) {
+    return Default()->InternalGetNodesBatch(
+        BaseNode::EntityType::kTopLevelChannel, "channel", start_channel_id,
+        max_results, next_channel_id);
+  }
+  static std::string GetServersBatch(intptr_t start_server_id,
+                                     size_t max_results,
+                                     intptr_t* next_server_id) {
+    return Default()->InternalGetNodesBatch(BaseNode::EntityType::kServer,
+                                            "server", start_server_id,
+                                            max_results, next_server_id);
+  }
+
   // Test only helper function to dump the JSON representation to std out.
   // This can aid in debugging channelz code.
   static void LogAllEntities() { Default()->InternalLogAllEntities(); }
@@ -65,6 +88,7 @@ class ChannelzRegistry {
     auto* p = Default();
     MutexLock lock(&p->mu_);
     p->node_map_.clear();
+    for (auto& map : p->typed_node_map_) map.clear();
     p->uuid_generator_ = 0;
   }
 
@@ -86,11 +110,26 @@ class ChannelzRegistry {
   std::string InternalGetTopChannels(intptr_t start_channel_id);
   std::string InternalGetServers(intptr_t start_server_id);
 
+  // Renders one bounded chunk of entities of the given type. See
+  // GetTopChannelsBatch() for the cursor contract; entity_name is the key
+  // under which the rendered entities appear in the returned JSON object.
+  std::string InternalGetNodesBatch(BaseNode::EntityType type,
+                                    const char* entity_name,
+                                    intptr_t start_node_id, size_t max_results,
+                                    intptr_t* next_node_id);
+
   void InternalLogAllEntities();
 
+  static constexpr size_t kNumEntityTypes =
+      static_cast<size_t>(BaseNode::EntityType::kSocket) + 1;
+
   // protects members
   Mutex mu_;
   std::map<intptr_t, BaseNode*> node_map_;
+  // Per-type secondary indexes, so that queries for one entity type (e.g.
+  // top level channels) do not have to scan past every socket in the
+  // process.
+  std::map<intptr_t, BaseNode*> typed_node_map_[kNumEntityTypes];
   intptr_t uuid_generator_ = 0;
 };
 
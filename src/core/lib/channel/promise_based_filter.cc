@@ -16,8 +16,10 @@
 
 #include "src/core/lib/channel/promise_based_filter.h"
 
+#include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "absl/base/attributes.h"
 #include "absl/types/variant.h"
@@ -26,7 +28,9 @@
 
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/gpr/alloc.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/slice/slice.h"
 
@@ -1245,4 +1249,294 @@ void ServerCallData::WakeInsideCombiner(Flusher* flusher) {
 void ServerCallData::OnWakeup() { abort(); }  // not implemented
 
 }  // namespace promise_filter_detail
+
+///////////////////////////////////////////////////////////////////////////////
+// MakeFusedFilter
+
+namespace {
+
+// Which children a composite runs, where their channel data lives within the
+// composite's channel data allocation, and the vtable exposed to the stack.
+// One descriptor exists per distinct child sequence; it is never freed.
+struct FusedFilterDescriptor {
+  struct Child {
+    const grpc_channel_filter* filter;
+    size_t channel_data_offset;
+  };
+  grpc_channel_filter vtable;
+  std::string name;
+  std::vector<Child> children;
+  size_t sizeof_channel_data;
+  uint8_t flags;
+};
+
+struct FusedFilterRegistry {
+  Mutex mu;
+  // Keyed by (is_client, child filter sequence).
+  std::map<std::pair<bool, std::vector<const grpc_channel_filter*>>,
+           std::unique_ptr<FusedFilterDescriptor>>
+      by_children ABSL_GUARDED_BY(mu);
+  std::map<const grpc_channel_filter*, const FusedFilterDescriptor*> by_vtable
+      ABSL_GUARDED_BY(mu);
+};
+
+FusedFilterRegistry* GetFusedFilterRegistry() {
+  static FusedFilterRegistry* registry = new FusedFilterRegistry;
+  return registry;
+}
+
+const FusedFilterDescriptor* DescriptorForFilter(
+    const grpc_channel_filter* filter) {
+  FusedFilterRegistry* registry = GetFusedFilterRegistry();
+  MutexLock lock(&registry->mu);
+  auto it = registry->by_vtable.find(filter);
+  GPR_ASSERT(it != registry->by_vtable.end());
+  return it->second;
+}
+
+// Channel data for a composite filter: owns one channel element per child
+// (pointing into the composite's channel data allocation) followed by a
+// sentinel element, so that children chaining transport ops via elem + 1
+// seamlessly re-enter the real stack after the composite.
+class FusedChannelFilter final : public ChannelFilter {
+ public:
+  struct Tail {
+    grpc_channel_element* composite_elem;
+  };
+
+  explicit FusedChannelFilter(const FusedFilterDescriptor* desc)
+      : desc_(desc) {}
+
+  grpc_error_handle InitChildren(grpc_channel_element* composite_elem,
+                                 grpc_channel_element_args* args) {
+    char* channel_data = static_cast<char*>(composite_elem->channel_data);
+    elems_.resize(desc_->children.size() + 1);
+    tail_.composite_elem = composite_elem;
+    elems_.back().filter = &kTailFilter;
+    elems_.back().channel_data = &tail_;
+    for (size_t i = 0; i < desc_->children.size(); i++) {
+      const FusedFilterDescriptor::Child& child = desc_->children[i];
+      grpc_channel_element* child_elem = &elems_[i];
+      child_elem->filter = child.filter;
+      child_elem->channel_data = channel_data + child.channel_data_offset;
+      grpc_channel_element_args child_args = *args;
+      child_args.is_first = args->is_first && i == 0;
+      child_args.is_last = false;
+      grpc_error_handle error =
+          child.filter->init_channel_elem(child_elem, &child_args);
+      if (!error.ok()) {
+        DestroyChildren();
+        return error;
+      }
+      initialized_children_ = i + 1;
+    }
+    return absl::OkStatus();
+  }
+
+  void PostInitChildren(grpc_channel_stack* channel_stack) {
+    for (size_t i = 0; i < initialized_children_; i++) {
+      elems_[i].filter->post_init_channel_elem(channel_stack, &elems_[i]);
+    }
+  }
+
+  void DestroyChildren() {
+    while (initialized_children_ > 0) {
+      --initialized_children_;
+      elems_[initialized_children_].filter->destroy_channel_elem(
+          &elems_[initialized_children_]);
+    }
+  }
+
+  uint8_t flags() const { return desc_->flags; }
+
+  ArenaPromise<ServerMetadataHandle> MakeCallPromise(
+      CallArgs call_args, NextPromiseFactory next_promise_factory) override {
+    return MakeChildCallPromise(0, std::move(call_args),
+                                std::move(next_promise_factory));
+  }
+
+  bool StartTransportOp(grpc_transport_op* op) override {
+    // Children forward through the sentinel back into the real stack, so the
+    // op never needs to be passed on by our caller.
+    elems_[0].filter->start_transport_op(&elems_[0], op);
+    return true;
+  }
+
+  bool GetChannelInfo(const grpc_channel_info* info) override {
+    elems_[0].filter->get_channel_info(&elems_[0], info);
+    return true;
+  }
+
+ private:
+  static const grpc_channel_filter kTailFilter;
+
+  // Composes child promises directly: child i's "next" runs child i + 1, and
+  // the last child's "next" is the factory handed to the composite.
+  ArenaPromise<ServerMetadataHandle> MakeChildCallPromise(
+      size_t i, CallArgs call_args, NextPromiseFactory next_promise_factory) {
+    grpc_channel_element* elem = &elems_[i];
+    if (i + 1 == desc_->children.size()) {
+      return elem->filter->make_call_promise(elem, std::move(call_args),
+                                             std::move(next_promise_factory));
+    }
+    return elem->filter->make_call_promise(
+        elem, std::move(call_args),
+        [this, i,
+         next = std::move(next_promise_factory)](CallArgs args) mutable {
+          return MakeChildCallPromise(i + 1, std::move(args), std::move(next));
+        });
+  }
+
+  const FusedFilterDescriptor* const desc_;
+  std::vector<grpc_channel_element> elems_;
+  Tail tail_;
+  size_t initialized_children_ = 0;
+};
+
+void FusedTailStartTransportOp(grpc_channel_element* elem,
+                               grpc_transport_op* op) {
+  grpc_channel_next_op(
+      static_cast<FusedChannelFilter::Tail*>(elem->channel_data)
+          ->composite_elem,
+      op);
+}
+
+void FusedTailGetChannelInfo(grpc_channel_element* elem,
+                             const grpc_channel_info* info) {
+  grpc_channel_next_get_info(
+      static_cast<FusedChannelFilter::Tail*>(elem->channel_data)
+          ->composite_elem,
+      info);
+}
+
+template <typename CallData>
+grpc_channel_filter MakeFusedVtable(const char* name,
+                                    size_t sizeof_channel_data) {
+  return grpc_channel_filter{
+      // start_transport_stream_op_batch
+      [](grpc_call_element* elem, grpc_transport_stream_op_batch* batch) {
+        static_cast<CallData*>(elem->call_data)->StartBatch(batch);
+      },
+      // make_call_promise
+      [](grpc_channel_element* elem, CallArgs call_args,
+         NextPromiseFactory next_promise_factory) {
+        return static_cast<ChannelFilter*>(elem->channel_data)
+            ->MakeCallPromise(std::move(call_args),
+                              std::move(next_promise_factory));
+      },
+      // start_transport_op
+      [](grpc_channel_element* elem, grpc_transport_op* op) {
+        if (!static_cast<ChannelFilter*>(elem->channel_data)
+                 ->StartTransportOp(op)) {
+          grpc_channel_next_op(elem, op);
+        }
+      },
+      // sizeof_call_data
+      sizeof(CallData),
+      // init_call_elem
+      [](grpc_call_element* elem, const grpc_call_element_args* args) {
+        new (elem->call_data) CallData(
+            elem, args,
+            static_cast<FusedChannelFilter*>(elem->channel_data)->flags());
+        return absl::OkStatus();
+      },
+      // set_pollset_or_pollset_set
+      [](grpc_call_element* elem, grpc_polling_entity* pollent) {
+        static_cast<CallData*>(elem->call_data)->set_pollent(pollent);
+      },
+      // destroy_call_elem
+      [](grpc_call_element* elem, const grpc_call_final_info* final_info,
+         grpc_closure* then_schedule_closure) {
+        auto* cd = static_cast<CallData*>(elem->call_data);
+        cd->Finalize(final_info);
+        cd->~CallData();
+        // A composite never contains the last filter in a stack.
+        GPR_ASSERT(then_schedule_closure == nullptr);
+      },
+      // sizeof_channel_data
+      sizeof_channel_data,
+      // init_channel_elem
+      [](grpc_channel_element* elem, grpc_channel_element_args* args) {
+        GPR_ASSERT(!args->is_last);
+        auto* chand = new (elem->channel_data)
+            FusedChannelFilter(DescriptorForFilter(elem->filter));
+        return chand->InitChildren(elem, args);
+      },
+      // post_init_channel_elem
+      [](grpc_channel_stack* channel_stack, grpc_channel_element* elem) {
+        static_cast<FusedChannelFilter*>(elem->channel_data)
+            ->PostInitChildren(channel_stack);
+      },
+      // destroy_channel_elem
+      [](grpc_channel_element* elem) {
+        auto* chand = static_cast<FusedChannelFilter*>(elem->channel_data);
+        chand->DestroyChildren();
+        chand->~FusedChannelFilter();
+      },
+      // get_channel_info
+      [](grpc_channel_element* elem, const grpc_channel_info* info) {
+        if (!static_cast<ChannelFilter*>(elem->channel_data)
+                 ->GetChannelInfo(info)) {
+          grpc_channel_next_get_info(elem, info);
+        }
+      },
+      // name
+      name,
+  };
+}
+
+const grpc_channel_filter FusedChannelFilter::kTailFilter = {
+    nullptr, nullptr, FusedTailStartTransportOp,
+    0,       nullptr, nullptr,
+    nullptr, 0,       nullptr,
+    nullptr, nullptr, FusedTailGetChannelInfo,
+    "fused-tail"};
+
+}  // namespace
+
+const grpc_channel_filter* MakeFusedFilter(
+    bool is_client, absl::Span<const ChannelInit::FusableFilter> filters) {
+  GPR_ASSERT(filters.size() >= 2);
+  std::vector<const grpc_channel_filter*> children;
+  children.reserve(filters.size());
+  for (const ChannelInit::FusableFilter& f : filters) {
+    if (f.filter->make_call_promise == nullptr) return nullptr;
+    // The last filter in a stack terminates promise chaining and cannot be
+    // hosted inside a composite.
+    GPR_ASSERT((f.flags & kFilterIsLast) == 0);
+    children.push_back(f.filter);
+  }
+  FusedFilterRegistry* registry = GetFusedFilterRegistry();
+  MutexLock lock(&registry->mu);
+  auto key = std::make_pair(is_client, std::move(children));
+  auto it = registry->by_children.find(key);
+  if (it != registry->by_children.end()) return &it->second->vtable;
+  auto desc = std::make_unique<FusedFilterDescriptor>();
+  desc->name = "fused[";
+  desc->flags = 0;
+  size_t offset = GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(FusedChannelFilter));
+  for (size_t i = 0; i < filters.size(); i++) {
+    if (i != 0) desc->name += "+";
+    desc->name += filters[i].filter->name;
+    desc->flags |= filters[i].flags;
+    desc->children.push_back({filters[i].filter, offset});
+    offset += GPR_ROUND_UP_TO_ALIGNMENT_SIZE(
+        filters[i].filter->sizeof_channel_data);
+  }
+  desc->name += "]";
+  desc->sizeof_channel_data = offset;
+  desc->vtable =
+      is_client
+          ? MakeFusedVtable<promise_filter_detail::CallData<
+                ChannelFilter, FilterEndpoint::kClient>>(
+                desc->name.c_str(), desc->sizeof_channel_data)
+          : MakeFusedVtable<promise_filter_detail::CallData<
+                ChannelFilter, FilterEndpoint::kServer>>(
+                desc->name.c_str(), desc->sizeof_channel_data);
+  const grpc_channel_filter* vtable = &desc->vtable;
+  registry->by_vtable[vtable] = desc.get();
+  registry->by_children[std::move(key)] = std::move(desc);
+  return vtable;
+}
+
 }  // namespace grpc_core
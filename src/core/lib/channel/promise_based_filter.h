@@ -36,6 +36,7 @@
 #include "absl/container/inlined_vector.h"
 #include "absl/meta/type_traits.h"
 #include "absl/status/status.h"
+#include "absl/status/statusor.h"
 
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/impl/codegen/grpc_types.h>
@@ -60,6 +61,7 @@
 #include "src/core/lib/promise/latch.h"
 #include "src/core/lib/promise/poll.h"
 #include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/surface/channel_init.h"
 #include "src/core/lib/transport/call_fragments.h"
 #include "src/core/lib/transport/error_utils.h"
 #include "src/core/lib/transport/metadata_batch.h"
@@ -581,6 +583,141 @@ MakePromiseBasedFilter(const char* name) {
   };
 }
 
+// Builds (or returns a previously built) composite filter equivalent to
+// running \a filters adjacently in order: one channel stack element hosting
+// every child's channel data, with the call promises composed directly
+// rather than through per-element indirection. Composites are deduplicated
+// process-wide by child sequence, so the returned vtable outlives any stack
+// using it. Returns nullptr if any filter lacks a call promise. Installed as
+// the ChannelInit fused filter factory (see GRPC_ARG_ENABLE_FILTER_FUSION).
+const grpc_channel_filter* MakeFusedFilter(
+    bool is_client, absl::Span<const ChannelInit::FusableFilter> filters);
+
+namespace promise_filter_detail {
+
+// Recursive holder for a compile-time declared filter list: children are
+// stored by value so the composite's channel data layout is fixed at compile
+// time, and every child call is made through a qualified (non-virtual)
+// lookup the compiler can inline.
+template <typename... Filters>
+struct StaticFilterTuple;
+
+template <typename F>
+struct StaticFilterTuple<F> {
+  explicit StaticFilterTuple(F f) : filter(std::move(f)) {}
+
+  static absl::StatusOr<StaticFilterTuple> Create(
+      const ChannelArgs& args, ChannelFilter::Args filter_args) {
+    auto filter = F::Create(args, filter_args);
+    if (!filter.ok()) return filter.status();
+    return StaticFilterTuple(std::move(*filter));
+  }
+
+  ArenaPromise<ServerMetadataHandle> MakeCallPromise(
+      CallArgs call_args, NextPromiseFactory next_promise_factory) {
+    return filter.F::MakeCallPromise(std::move(call_args),
+                                     std::move(next_promise_factory));
+  }
+
+  bool StartTransportOp(grpc_transport_op* op) {
+    return filter.F::StartTransportOp(op);
+  }
+
+  bool GetChannelInfo(const grpc_channel_info* info) {
+    return filter.F::GetChannelInfo(info);
+  }
+
+  void PostInit() { filter.F::PostInit(); }
+
+  F filter;
+};
+
+template <typename F, typename... Rest>
+struct StaticFilterTuple<F, Rest...> {
+  StaticFilterTuple(F f, StaticFilterTuple<Rest...> r)
+      : filter(std::move(f)), rest(std::move(r)) {}
+
+  static absl::StatusOr<StaticFilterTuple> Create(
+      const ChannelArgs& args, ChannelFilter::Args filter_args) {
+    auto filter = F::Create(args, filter_args);
+    if (!filter.ok()) return filter.status();
+    auto rest = StaticFilterTuple<Rest...>::Create(args, filter_args);
+    if (!rest.ok()) return rest.status();
+    return StaticFilterTuple(std::move(*filter), std::move(*rest));
+  }
+
+  ArenaPromise<ServerMetadataHandle> MakeCallPromise(
+      CallArgs call_args, NextPromiseFactory next_promise_factory) {
+    return filter.F::MakeCallPromise(
+        std::move(call_args),
+        [this, next = std::move(next_promise_factory)](CallArgs args) mutable {
+          return rest.MakeCallPromise(std::move(args), std::move(next));
+        });
+  }
+
+  bool StartTransportOp(grpc_transport_op* op) {
+    return filter.F::StartTransportOp(op) || rest.StartTransportOp(op);
+  }
+
+  bool GetChannelInfo(const grpc_channel_info* info) {
+    return filter.F::GetChannelInfo(info) || rest.GetChannelInfo(info);
+  }
+
+  void PostInit() {
+    filter.F::PostInit();
+    rest.PostInit();
+  }
+
+  F filter;
+  StaticFilterTuple<Rest...> rest;
+};
+
+}  // namespace promise_filter_detail
+
+// A composite ChannelFilter whose children are declared at compile time, for
+// stack segments whose filter list is known up front: the channel data
+// layout is computed statically and the child call promises are composed
+// with direct calls rather than per-element vtable dispatch. Instantiate a
+// vtable with MakePromiseBasedFilter (flags = the union of the children's
+// flags) and register it via
+// ChannelInit::Builder::RegisterFusedFilterSpecialization so that stacks
+// whose fusable runs match the declared list exactly use the static
+// composite; everything else keeps the dynamically composed path.
+template <typename... Filters>
+class StaticFusedFilter final : public ChannelFilter {
+ public:
+  static absl::StatusOr<StaticFusedFilter> Create(
+      const ChannelArgs& args, ChannelFilter::Args filter_args) {
+    auto filters = promise_filter_detail::StaticFilterTuple<Filters...>::Create(
+        args, filter_args);
+    if (!filters.ok()) return filters.status();
+    return StaticFusedFilter(std::move(*filters));
+  }
+
+  ArenaPromise<ServerMetadataHandle> MakeCallPromise(
+      CallArgs call_args, NextPromiseFactory next_promise_factory) override {
+    return filters_.MakeCallPromise(std::move(call_args),
+                                    std::move(next_promise_factory));
+  }
+
+  bool StartTransportOp(grpc_transport_op* op) override {
+    return filters_.StartTransportOp(op);
+  }
+
+  bool GetChannelInfo(const grpc_channel_info* info) override {
+    return filters_.GetChannelInfo(info);
+  }
+
+  void PostInit() override { filters_.PostInit(); }
+
+ private:
+  explicit StaticFusedFilter(
+      promise_filter_detail::StaticFilterTuple<Filters...> filters)
+      : filters_(std::move(filters)) {}
+
+  promise_filter_detail::StaticFilterTuple<Filters...> filters_;
+};
+
 }  // namespace grpc_core
 
 #endif  // GRPC_CORE_LIB_CHANNEL_PROMISE_BASED_FILTER_H
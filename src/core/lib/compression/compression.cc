@@ -75,6 +75,10 @@ void grpc_compression_options_init(grpc_compression_options* opts) {
   memset(opts, 0, sizeof(*opts));
   /* all enabled by default */
   opts->enabled_algorithms_bitset = (1u << GRPC_COMPRESS_ALGORITHMS_COUNT) - 1;
+#ifndef GRPC_HAVE_ZSTD
+  /* ... except zstd when this build cannot decode it */
+  grpc_core::ClearBit(&opts->enabled_algorithms_bitset, GRPC_COMPRESS_ZSTD);
+#endif
 }
 
 void grpc_compression_options_enable_algorithm(
@@ -88,6 +88,24 @@ class CompressionAlgorithmSet {
   BitSet<GRPC_COMPRESS_ALGORITHMS_COUNT> set_;
 };
 
+// Returns true if algorithm can be primed with a pre-shared dictionary.
+// gzip is excluded: the gzip format has no preset-dictionary support.
+bool CompressionAlgorithmSupportsDictionary(
+    grpc_compression_algorithm algorithm);
+
+// Register a pre-shared compression dictionary under a small integer id
+// (id 0 is reserved to mean "no dictionary"). Both peers must register the
+// same bytes under the same id: the sender advertises the id in initial
+// metadata and primes its compressor with the bytes, and the receiver primes
+// its decompressor from its own registration. Returns false if the id is
+// reserved or already registered. Registration should happen at startup;
+// dictionaries are never unregistered.
+bool RegisterCompressionDictionary(uint32_t id, Slice dictionary);
+
+// Look up a previously registered dictionary, or nullopt if unknown.
+// The returned view is valid for the life of the process.
+absl::optional<absl::string_view> LookupCompressionDictionary(uint32_t id);
+
 }  // namespace grpc_core
 
 #endif /* GRPC_CORE_LIB_COMPRESSION_COMPRESSION_INTERNAL_H */
@@ -25,6 +25,10 @@
 #include <zconf.h>
 #include <zlib.h>
 
+#ifdef GRPC_HAVE_ZSTD
+#include <zstd.h>
+#endif
+
 #include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
@@ -35,7 +39,8 @@
 
 static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
                      grpc_slice_buffer* output,
-                     int (*flate)(z_stream* zs, int flush)) {
+                     int (*flate)(z_stream* zs, int flush),
+                     const uint8_t* dict, size_t dict_len) {
   int r = Z_STREAM_END; /* Do not fail on an empty input. */
   int flush;
   size_t i;
@@ -60,6 +65,20 @@ static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
         zs->next_out = GRPC_SLICE_START_PTR(outbuf);
       }
       r = flate(zs, flush);
+      if (r == Z_NEED_DICT && dict != nullptr) {
+        /* the stream was compressed against a preset dictionary: prime the
+           inflater and retry */
+        if (inflateSetDictionary(zs, dict, static_cast<uInt>(dict_len)) !=
+            Z_OK) {
+          gpr_log(GPR_INFO, "zlib: failed to set dictionary");
+          goto error;
+        }
+        r = flate(zs, flush);
+      }
+      if (r == Z_NEED_DICT) {
+        gpr_log(GPR_INFO, "zlib: dictionary required but not provided");
+        goto error;
+      }
       if (r < 0 && r != Z_BUF_ERROR /* not fatal */) {
         gpr_log(GPR_INFO, "zlib error (%d)", r);
         goto error;
@@ -93,20 +112,14 @@ static void* zalloc_gpr(void* /*opaque*/, unsigned int items,
 
 static void zfree_gpr(void* /*opaque*/, void* address) { gpr_free(address); }
 
-static int zlib_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
-                         int gzip) {
-  z_stream zs;
+static int zlib_compress_body(z_stream* zs, grpc_slice_buffer* input,
+                              grpc_slice_buffer* output) {
   int r;
   size_t i;
   size_t count_before = output->count;
   size_t length_before = output->length;
-  memset(&zs, 0, sizeof(zs));
-  zs.zalloc = zalloc_gpr;
-  zs.zfree = zfree_gpr;
-  r = deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 | (gzip ? 16 : 0),
-                   8, Z_DEFAULT_STRATEGY);
-  GPR_ASSERT(r == Z_OK);
-  r = zlib_body(&zs, input, output, deflate) && output->length < input->length;
+  r = zlib_body(zs, input, output, deflate, nullptr, 0) &&
+      output->length < input->length;
   if (!r) {
     for (i = count_before; i < output->count; i++) {
       grpc_core::CSliceUnref(output->slices[i]);
@@ -114,12 +127,31 @@ static int zlib_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
     output->count = count_before;
     output->length = length_before;
   }
+  return r;
+}
+
+static void zlib_compress_init(z_stream* zs, int gzip) {
+  int r;
+  memset(zs, 0, sizeof(*zs));
+  zs->zalloc = zalloc_gpr;
+  zs->zfree = zfree_gpr;
+  r = deflateInit2(zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 | (gzip ? 16 : 0),
+                   8, Z_DEFAULT_STRATEGY);
+  GPR_ASSERT(r == Z_OK);
+}
+
+static int zlib_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
+                         int gzip) {
+  z_stream zs;
+  int r;
+  zlib_compress_init(&zs, gzip);
+  r = zlib_compress_body(&zs, input, output);
   deflateEnd(&zs);
   return r;
 }
 
 static int zlib_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
-                           int gzip) {
+                           int gzip, const uint8_t* dict, size_t dict_len) {
   z_stream zs;
   int r;
   size_t i;
@@ -130,7 +162,7 @@ static int zlib_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
   zs.zfree = zfree_gpr;
   r = inflateInit2(&zs, 15 | (gzip ? 16 : 0));
   GPR_ASSERT(r == Z_OK);
-  r = zlib_body(&zs, input, output, inflate);
+  r = zlib_body(&zs, input, output, inflate, dict, dict_len);
   if (!r) {
     for (i = count_before; i < output->count; i++) {
       grpc_core::CSliceUnref(output->slices[i]);
@@ -142,6 +174,130 @@ static int zlib_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
   return r;
 }
 
+#ifdef GRPC_HAVE_ZSTD
+
+static int zstd_compress_body(ZSTD_CCtx* cctx, grpc_slice_buffer* input,
+                              grpc_slice_buffer* output) {
+  size_t count_before = output->count;
+  size_t length_before = output->length;
+  size_t r = 0;
+  size_t i;
+  grpc_slice outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
+  ZSTD_outBuffer out = {GRPC_SLICE_START_PTR(outbuf), GRPC_SLICE_LENGTH(outbuf),
+                        0};
+  for (i = 0; i < input->count; i++) {
+    const ZSTD_EndDirective mode =
+        i == input->count - 1 ? ZSTD_e_end : ZSTD_e_continue;
+    ZSTD_inBuffer in = {GRPC_SLICE_START_PTR(input->slices[i]),
+                        GRPC_SLICE_LENGTH(input->slices[i]), 0};
+    do {
+      if (out.pos == out.size) {
+        grpc_slice_buffer_add_indexed(output, outbuf);
+        outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
+        out.dst = GRPC_SLICE_START_PTR(outbuf);
+        out.size = GRPC_SLICE_LENGTH(outbuf);
+        out.pos = 0;
+      }
+      r = ZSTD_compressStream2(cctx, &out, &in, mode);
+      if (ZSTD_isError(r)) {
+        gpr_log(GPR_INFO, "zstd error (%s)", ZSTD_getErrorName(r));
+        goto error;
+      }
+      /* r is the number of bytes still buffered inside the context: keep
+         flushing until the end of the frame has been fully emitted */
+    } while (in.pos < in.size || (mode == ZSTD_e_end && r != 0));
+  }
+  GPR_ASSERT(outbuf.refcount);
+  outbuf.data.refcounted.length -= out.size - out.pos;
+  grpc_slice_buffer_add_indexed(output, outbuf);
+  if (output->length < input->length) {
+    return 1;
+  }
+  /* did not get smaller: undo and let the caller send uncompressed */
+  goto rollback;
+
+error:
+  grpc_core::CSliceUnref(outbuf);
+rollback:
+  for (i = count_before; i < output->count; i++) {
+    grpc_core::CSliceUnref(output->slices[i]);
+  }
+  output->count = count_before;
+  output->length = length_before;
+  return 0;
+}
+
+static int zstd_compress(grpc_slice_buffer* input, grpc_slice_buffer* output) {
+  ZSTD_CCtx* cctx = ZSTD_createCCtx();
+  GPR_ASSERT(cctx != nullptr);
+  int r = zstd_compress_body(cctx, input, output);
+  ZSTD_freeCCtx(cctx);
+  return r;
+}
+
+static int zstd_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
+                           const uint8_t* dict, size_t dict_len) {
+  size_t count_before = output->count;
+  size_t length_before = output->length;
+  size_t r = 0; /* Do not fail on an empty input. */
+  size_t i;
+  ZSTD_DCtx* dctx = ZSTD_createDCtx();
+  GPR_ASSERT(dctx != nullptr);
+  if (dict != nullptr) {
+    if (ZSTD_isError(ZSTD_DCtx_loadDictionary(dctx, dict, dict_len))) {
+      gpr_log(GPR_INFO, "zstd: failed to load dictionary");
+      ZSTD_freeDCtx(dctx);
+      return 0;
+    }
+  }
+  grpc_slice outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
+  ZSTD_outBuffer out = {GRPC_SLICE_START_PTR(outbuf), GRPC_SLICE_LENGTH(outbuf),
+                        0};
+  for (i = 0; i < input->count; i++) {
+    ZSTD_inBuffer in = {GRPC_SLICE_START_PTR(input->slices[i]),
+                        GRPC_SLICE_LENGTH(input->slices[i]), 0};
+    do {
+      if (out.pos == out.size) {
+        grpc_slice_buffer_add_indexed(output, outbuf);
+        outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
+        out.dst = GRPC_SLICE_START_PTR(outbuf);
+        out.size = GRPC_SLICE_LENGTH(outbuf);
+        out.pos = 0;
+      }
+      r = ZSTD_decompressStream(dctx, &out, &in);
+      if (ZSTD_isError(r)) {
+        gpr_log(GPR_INFO, "zstd error (%s)", ZSTD_getErrorName(r));
+        goto error;
+      }
+      /* on the last slice keep draining any output still buffered inside the
+         context (r == 0 once the frame is complete) */
+    } while (in.pos < in.size ||
+             (i == input->count - 1 && r != 0 && out.pos == out.size));
+  }
+  if (r != 0) {
+    gpr_log(GPR_INFO, "zstd: Data error");
+    goto error;
+  }
+
+  GPR_ASSERT(outbuf.refcount);
+  outbuf.data.refcounted.length -= out.size - out.pos;
+  grpc_slice_buffer_add_indexed(output, outbuf);
+  ZSTD_freeDCtx(dctx);
+  return 1;
+
+error:
+  grpc_core::CSliceUnref(outbuf);
+  for (i = count_before; i < output->count; i++) {
+    grpc_core::CSliceUnref(output->slices[i]);
+  }
+  output->count = count_before;
+  output->length = length_before;
+  ZSTD_freeDCtx(dctx);
+  return 0;
+}
+
+#endif /* GRPC_HAVE_ZSTD */
+
 static int copy(grpc_slice_buffer* input, grpc_slice_buffer* output) {
   size_t i;
   for (i = 0; i < input->count; i++) {
@@ -161,6 +317,13 @@ static int compress_inner(grpc_compression_algorithm algorithm,
       return zlib_compress(input, output, 0);
     case GRPC_COMPRESS_GZIP:
       return zlib_compress(input, output, 1);
+    case GRPC_COMPRESS_ZSTD:
+#ifdef GRPC_HAVE_ZSTD
+      return zstd_compress(input, output);
+#else
+      /* not compiled in: take the uncompressed fallback path */
+      return 0;
+#endif
     case GRPC_COMPRESS_ALGORITHMS_COUNT:
       break;
   }
@@ -177,15 +340,155 @@ int grpc_msg_compress(grpc_compression_algorithm algorithm,
   return 1;
 }
 
+struct grpc_msg_compress_context {
+  grpc_compression_algorithm algorithm = GRPC_COMPRESS_NONE;
+  /* initialized iff algorithm is deflate or gzip */
+  z_stream zs;
+  bool zs_initialized = false;
+  /* pre-shared dictionary to prime each message with (owned ref) */
+  grpc_slice dictionary = grpc_empty_slice();
+  bool has_dictionary = false;
+#ifdef GRPC_HAVE_ZSTD
+  ZSTD_CCtx* cctx = nullptr;
+#endif
+};
+
+grpc_msg_compress_context* grpc_msg_compress_context_create(
+    grpc_compression_algorithm algorithm) {
+  grpc_msg_compress_context* ctx = new grpc_msg_compress_context();
+  ctx->algorithm = algorithm;
+  switch (algorithm) {
+    case GRPC_COMPRESS_DEFLATE:
+    case GRPC_COMPRESS_GZIP:
+      zlib_compress_init(&ctx->zs, algorithm == GRPC_COMPRESS_GZIP);
+      ctx->zs_initialized = true;
+      break;
+#ifdef GRPC_HAVE_ZSTD
+    case GRPC_COMPRESS_ZSTD:
+      ctx->cctx = ZSTD_createCCtx();
+      GPR_ASSERT(ctx->cctx != nullptr);
+      break;
+#endif
+    default:
+      break;
+  }
+  return ctx;
+}
+
+void grpc_msg_compress_context_destroy(grpc_msg_compress_context* ctx) {
+  if (ctx == nullptr) return;
+  if (ctx->zs_initialized) deflateEnd(&ctx->zs);
+  grpc_core::CSliceUnref(ctx->dictionary);
+#ifdef GRPC_HAVE_ZSTD
+  if (ctx->cctx != nullptr) ZSTD_freeCCtx(ctx->cctx);
+#endif
+  delete ctx;
+}
+
+int grpc_msg_compress_with_context(grpc_msg_compress_context* ctx,
+                                   grpc_slice_buffer* input,
+                                   grpc_slice_buffer* output) {
+  int r = 0;
+  switch (ctx->algorithm) {
+    case GRPC_COMPRESS_DEFLATE:
+    case GRPC_COMPRESS_GZIP:
+      /* deflateReset keeps the window and internal buffers allocated, so
+         subsequent messages on the stream skip the setup cost entirely */
+      GPR_ASSERT(deflateReset(&ctx->zs) == Z_OK);
+      if (ctx->has_dictionary) {
+        /* priming must be re-applied after every reset */
+        GPR_ASSERT(deflateSetDictionary(
+                       &ctx->zs, GRPC_SLICE_START_PTR(ctx->dictionary),
+                       static_cast<uInt>(GRPC_SLICE_LENGTH(ctx->dictionary))) ==
+                   Z_OK);
+      }
+      r = zlib_compress_body(&ctx->zs, input, output);
+      break;
+#ifdef GRPC_HAVE_ZSTD
+    case GRPC_COMPRESS_ZSTD:
+      GPR_ASSERT(
+          !ZSTD_isError(ZSTD_CCtx_reset(ctx->cctx, ZSTD_reset_session_only)));
+      r = zstd_compress_body(ctx->cctx, input, output);
+      break;
+#endif
+    default:
+      /* GRPC_COMPRESS_NONE (and compiled-out algorithms) take the
+         uncompressed fallback path */
+      break;
+  }
+  if (!r) {
+    copy(input, output);
+    return 0;
+  }
+  return 1;
+}
+
+int grpc_msg_compress_context_set_dictionary(grpc_msg_compress_context* ctx,
+                                             grpc_slice dictionary) {
+  switch (ctx->algorithm) {
+    case GRPC_COMPRESS_DEFLATE:
+      break;
+#ifdef GRPC_HAVE_ZSTD
+    case GRPC_COMPRESS_ZSTD:
+      break;
+#endif
+    default:
+      /* notably gzip: the gzip format has no preset-dictionary support */
+      return 0;
+  }
+  grpc_core::CSliceUnref(ctx->dictionary);
+  ctx->dictionary = grpc_core::CSliceRef(dictionary);
+  ctx->has_dictionary = true;
+#ifdef GRPC_HAVE_ZSTD
+  if (ctx->algorithm == GRPC_COMPRESS_ZSTD) {
+    /* a loaded dictionary is sticky across frames; session resets between
+       messages keep it in place */
+    GPR_ASSERT(!ZSTD_isError(ZSTD_CCtx_loadDictionary(
+        ctx->cctx, GRPC_SLICE_START_PTR(ctx->dictionary),
+        GRPC_SLICE_LENGTH(ctx->dictionary))));
+  }
+#endif
+  return 1;
+}
+
+int grpc_msg_decompress_with_dictionary(grpc_compression_algorithm algorithm,
+                                        grpc_slice dictionary,
+                                        grpc_slice_buffer* input,
+                                        grpc_slice_buffer* output) {
+  switch (algorithm) {
+    case GRPC_COMPRESS_DEFLATE:
+      return zlib_decompress(input, output, 0,
+                             GRPC_SLICE_START_PTR(dictionary),
+                             GRPC_SLICE_LENGTH(dictionary));
+#ifdef GRPC_HAVE_ZSTD
+    case GRPC_COMPRESS_ZSTD:
+      return zstd_decompress(input, output, GRPC_SLICE_START_PTR(dictionary),
+                             GRPC_SLICE_LENGTH(dictionary));
+#endif
+    default:
+      gpr_log(GPR_ERROR,
+              "compression algorithm %d does not support dictionaries",
+              algorithm);
+      return 0;
+  }
+}
+
 int grpc_msg_decompress(grpc_compression_algorithm algorithm,
                         grpc_slice_buffer* input, grpc_slice_buffer* output) {
   switch (algorithm) {
     case GRPC_COMPRESS_NONE:
       return copy(input, output);
     case GRPC_COMPRESS_DEFLATE:
-      return zlib_decompress(input, output, 0);
+      return zlib_decompress(input, output, 0, nullptr, 0);
     case GRPC_COMPRESS_GZIP:
-      return zlib_decompress(input, output, 1);
+      return zlib_decompress(input, output, 1, nullptr, 0);
+    case GRPC_COMPRESS_ZSTD:
+#ifdef GRPC_HAVE_ZSTD
+      return zstd_decompress(input, output, nullptr, 0);
+#else
+      gpr_log(GPR_ERROR, "zstd decompression requested but not compiled in");
+      return 0;
+#endif
     case GRPC_COMPRESS_ALGORITHMS_COUNT:
       break;
   }
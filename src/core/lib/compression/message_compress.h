@@ -36,4 +36,36 @@ int grpc_msg_compress(grpc_compression_algorithm algorithm,
 int grpc_msg_decompress(grpc_compression_algorithm algorithm,
                         grpc_slice_buffer* input, grpc_slice_buffer* output);
 
+/* A reusable compression context: keeps the underlying codec state allocated
+   across messages so that streams sending many messages pay codec setup and
+   teardown once per stream instead of once per message. Each message is still
+   compressed as an independent unit (the wire format requires every message
+   to be decompressible on its own), so this reduces CPU cost, not size. */
+typedef struct grpc_msg_compress_context grpc_msg_compress_context;
+
+grpc_msg_compress_context* grpc_msg_compress_context_create(
+    grpc_compression_algorithm algorithm);
+void grpc_msg_compress_context_destroy(grpc_msg_compress_context* ctx);
+
+/* like grpc_msg_compress, but reuses the codec state held in 'ctx' (which
+   determines the algorithm). */
+int grpc_msg_compress_with_context(grpc_msg_compress_context* ctx,
+                                   grpc_slice_buffer* input,
+                                   grpc_slice_buffer* output);
+
+/* Prime 'ctx' with a pre-shared dictionary: every subsequent message is
+   compressed against it, which substantially improves ratios for small
+   messages. The receiver must prime its decompressor with the same bytes.
+   Returns 1 if the context's algorithm supports preset dictionaries
+   (deflate, zstd), 0 otherwise (and the dictionary is ignored). */
+int grpc_msg_compress_context_set_dictionary(grpc_msg_compress_context* ctx,
+                                             grpc_slice dictionary);
+
+/* like grpc_msg_decompress, for messages the sender compressed against
+   'dictionary'. */
+int grpc_msg_decompress_with_dictionary(grpc_compression_algorithm algorithm,
+                                        grpc_slice dictionary,
+                                        grpc_slice_buffer* input,
+                                        grpc_slice_buffer* output);
+
 #endif /* GRPC_CORE_LIB_COMPRESSION_MESSAGE_COMPRESS_H */
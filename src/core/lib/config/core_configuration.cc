@@ -26,6 +26,7 @@
 namespace grpc_core {
 
 std::atomic<CoreConfiguration*> CoreConfiguration::config_{nullptr};
+std::atomic<uint64_t> CoreConfiguration::next_generation_{1};
 std::atomic<CoreConfiguration::RegisteredBuilder*> CoreConfiguration::builders_{
     nullptr};
 void (*CoreConfiguration::default_builder_)(CoreConfiguration::Builder*);
@@ -17,6 +17,8 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stdint.h>
+
 #include <atomic>
 #include <functional>
 
@@ -143,6 +145,11 @@ class CoreConfiguration {
   // Lifetime methods
 
   // Get the core configuration; if it does not exist, create it.
+  // Construction is deliberately lazy: grpc_init() does not build the
+  // configuration, so processes that never create a channel or server never
+  // run the plugin registrations. Once built the configuration is immutable
+  // and shared by all threads for the remainder of its lifetime (until
+  // Reset(), which only tests may call).
   static const CoreConfiguration& Get() {
     CoreConfiguration* p = config_.load(std::memory_order_acquire);
     if (p != nullptr) {
@@ -211,6 +218,12 @@ class CoreConfiguration {
     default_builder_ = builder;
   }
 
+  // Monotonically increasing id assigned to each built configuration
+  // instance. Caches of configuration-derived artifacts can compare this to
+  // detect that the configuration was rebuilt (e.g. with a different parser
+  // set in tests) without risking pointer reuse confusion.
+  uint64_t generation() const { return generation_; }
+
  private:
   explicit CoreConfiguration(Builder* builder);
 
@@ -224,7 +237,11 @@ class CoreConfiguration {
   static std::atomic<RegisteredBuilder*> builders_;
   // Default builder
   static void (*default_builder_)(CoreConfiguration::Builder*);
+  // Source of generation ids; the first built configuration gets 1.
+  static std::atomic<uint64_t> next_generation_;
 
+  const uint64_t generation_ =
+      next_generation_.fetch_add(1, std::memory_order_relaxed);
   ChannelArgsPreconditioning channel_args_preconditioning_;
   ChannelInit channel_init_;
   HandshakerRegistry handshaker_registry_;
@@ -0,0 +1,120 @@
+/*
+ *
+ * Copyright 2022 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/debug/call_stage_profiler.h"
+
+#include <inttypes.h>
+
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_format.h"
+#include "absl/strings/str_join.h"
+
+#include <grpc/grpc.h>
+#include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
+#include <grpc/support/string_util.h>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+
+namespace grpc_core {
+
+const char* const call_stage_name[kCallStageCount] = {
+    "lb_pick", "metadata_encode", "transport_queue",    "write",
+    "remote",  "read",            "surface_completion",
+};
+
+#ifndef GRPC_DISABLE_CALL_STAGE_PROFILER
+
+namespace {
+
+struct CallStageShards {
+  size_t num_cores;
+  CallStageTimings per_cpu[0];
+};
+
+CallStageShards* const g_call_stage_shards = [] {
+  size_t num_cores = gpr_cpu_num_cores();
+  CallStageShards* shards = static_cast<CallStageShards*>(gpr_zalloc(
+      sizeof(CallStageShards) + num_cores * sizeof(CallStageTimings)));
+  shards->num_cores = num_cores;
+  return shards;
+}();
+
+size_t BucketForCycles(int64_t cycles) {
+  if (cycles < 1) return 0;
+#if defined(__GNUC__) || defined(__clang__)
+  size_t bucket = 63 - static_cast<size_t>(
+                           __builtin_clzll(static_cast<uint64_t>(cycles)));
+#else
+  size_t bucket = 0;
+  while (cycles > 1) {
+    cycles >>= 1;
+    bucket++;
+  }
+#endif
+  return bucket < kCallStageBuckets ? bucket : kCallStageBuckets - 1;
+}
+
+}  // namespace
+
+void CallStageRecordCycles(CallStage stage, int64_t cycles) {
+  CallStageTimings* shard =
+      &g_call_stage_shards->per_cpu[ExecCtx::Get()->starting_cpu()];
+  gpr_atm_no_barrier_fetch_add(
+      &shard->buckets[static_cast<size_t>(stage)][BucketForCycles(cycles)], 1);
+}
+
+void CallStageTimingsCollect(CallStageTimings* output) {
+  *output = CallStageTimings();
+  for (size_t core = 0; core < g_call_stage_shards->num_cores; core++) {
+    for (size_t stage = 0; stage < kCallStageCount; stage++) {
+      for (size_t bucket = 0; bucket < kCallStageBuckets; bucket++) {
+        output->buckets[stage][bucket] += gpr_atm_no_barrier_load(
+            &g_call_stage_shards->per_cpu[core].buckets[stage][bucket]);
+      }
+    }
+  }
+}
+
+#endif  // GRPC_DISABLE_CALL_STAGE_PROFILER
+
+std::string CallStageTimingsAsJson(const CallStageTimings& timings) {
+  std::vector<std::string> parts;
+  for (size_t stage = 0; stage < kCallStageCount; stage++) {
+    std::vector<std::string> buckets;
+    for (size_t bucket = 0; bucket < kCallStageBuckets; bucket++) {
+      buckets.push_back(
+          absl::StrFormat("%" PRIdPTR, timings.buckets[stage][bucket]));
+    }
+    parts.push_back(absl::StrFormat("\"%s\": [%s]", call_stage_name[stage],
+                                    absl::StrJoin(buckets, ",")));
+  }
+  return absl::StrCat("{", absl::StrJoin(parts, ", "), "}");
+}
+
+}  // namespace grpc_core
+
+char* grpc_call_stage_timings_json() {
+  grpc_core::CallStageTimings timings;
+  grpc_core::CallStageTimingsCollect(&timings);
+  return gpr_strdup(grpc_core::CallStageTimingsAsJson(timings).c_str());
+}
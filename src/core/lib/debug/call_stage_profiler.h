@@ -0,0 +1,110 @@
+/*
+ *
+ * Copyright 2022 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_CORE_LIB_DEBUG_CALL_STAGE_PROFILER_H
+#define GRPC_CORE_LIB_DEBUG_CALL_STAGE_PROFILER_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+#include <grpc/support/atm.h>
+
+#include "src/core/lib/gpr/time_precise.h"
+
+// Always-on, low-overhead per-call latency breakdown: named call stages are
+// timed with the cycle counter and aggregated into per-CPU log2 histograms,
+// following the sharding scheme used by the stats machinery in stats.h.
+// Define GRPC_DISABLE_CALL_STAGE_PROFILER to compile the entire surface out.
+
+namespace grpc_core {
+
+enum class CallStage : size_t {
+  kLbPick = 0,
+  kMetadataEncode,
+  // Time from a batch being queued on the transport until the covering write
+  // begins. Needs both edges, so it is recorded via CallStageRecordCycles by
+  // callers that carry the enqueue timestamp rather than via a scoped timer.
+  kTransportQueue,
+  kWrite,
+  // Time between a request leaving and its response arriving; recorded by
+  // callers that carry the send timestamp, as for kTransportQueue.
+  kRemote,
+  kRead,
+  kSurfaceCompletion,
+  kCount  // must be last
+};
+
+constexpr size_t kCallStageCount = static_cast<size_t>(CallStage::kCount);
+// One histogram bucket per power of two of elapsed cycles.
+constexpr size_t kCallStageBuckets = 64;
+
+extern const char* const call_stage_name[kCallStageCount];
+
+// An aggregated snapshot: bucket b of stage s counts timings that took
+// [2^b, 2^(b+1)) cycles.
+struct CallStageTimings {
+  gpr_atm buckets[kCallStageCount][kCallStageBuckets];
+};
+
+#ifndef GRPC_DISABLE_CALL_STAGE_PROFILER
+// Record an elapsed cycle count against a stage. Must run under an ExecCtx
+// (per-CPU sharding uses its starting cpu, as stats.h does).
+void CallStageRecordCycles(CallStage stage, int64_t cycles);
+// Sum the per-CPU shards into *output.
+void CallStageTimingsCollect(CallStageTimings* output);
+#else
+inline void CallStageRecordCycles(CallStage /*stage*/, int64_t /*cycles*/) {}
+inline void CallStageTimingsCollect(CallStageTimings* output) {
+  *output = CallStageTimings();
+}
+#endif
+
+// Render a snapshot as a JSON object mapping stage names to bucket arrays.
+std::string CallStageTimingsAsJson(const CallStageTimings& timings);
+
+// Times one stage over a lexical scope.
+class ScopedCallStageTimer {
+ public:
+#ifndef GRPC_DISABLE_CALL_STAGE_PROFILER
+  explicit ScopedCallStageTimer(CallStage stage)
+      : stage_(stage), start_(gpr_get_cycle_counter()) {}
+  ~ScopedCallStageTimer() {
+    CallStageRecordCycles(
+        stage_, static_cast<int64_t>(gpr_get_cycle_counter() - start_));
+  }
+#else
+  explicit ScopedCallStageTimer(CallStage /*stage*/) {}
+#endif
+
+  ScopedCallStageTimer(const ScopedCallStageTimer&) = delete;
+  ScopedCallStageTimer& operator=(const ScopedCallStageTimer&) = delete;
+
+#ifndef GRPC_DISABLE_CALL_STAGE_PROFILER
+ private:
+  CallStage stage_;
+  gpr_cycle_counter start_;
+#endif
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_CORE_LIB_DEBUG_CALL_STAGE_PROFILER_H
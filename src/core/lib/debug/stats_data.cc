@@ -47,9 +47,19 @@ const char* grpc_stats_counter_name[GRPC_STATS_COUNTER_COUNT] = {
     "http2_writes_begun",
     "http2_transport_stalls",
     "http2_stream_stalls",
+    "exec_ctx_flushes",
     "cq_pluck_creates",
     "cq_next_creates",
     "cq_callback_creates",
+    "byte_buffer_view_hits",
+    "byte_buffer_view_copies",
+    "combiner_locks_created",
+    "combiner_locks_scheduled_items",
+    "combiner_locks_offloaded",
+    "combiner_locks_yielded",
+    "lb_pick_cache_hits",
+    "lb_pick_cache_misses",
+    "retry_replay_bytes_shared",
 };
 const char* grpc_stats_counter_doc[GRPC_STATS_COUNTER_COUNT] = {
     "Number of client side calls created by this process",
@@ -69,17 +79,30 @@ const char* grpc_stats_counter_doc[GRPC_STATS_COUNTER_COUNT] = {
     "control window",
     "Number of times sending was completely stalled by the stream flow control "
     "window",
+    "Number of ExecCtx flush dispatch loops executed",
     "Number of completion queues created for cq_pluck (indicates sync api "
     "usage)",
     "Number of completion queues created for cq_next (indicates cq async api "
     "usage)",
     "Number of completion queues created for cq_callback (indicates callback "
     "api usage)",
+    "Number of byte buffer reader view requests satisfied zero-copy from a "
+    "single slice",
+    "Number of byte buffer reader view requests that needed a flattening copy",
+    "Number of combiner lock instances created",
+    "Number of closures scheduled against combiner locks",
+    "Number of combiner lock batches handed to the executor for completion",
+    "Number of combiner lock run quanta that yielded to other combiners on "
+    "the same exec ctx",
+    "Number of LB picks satisfied from the channel's cached pick",
+    "Number of LB picks that ran the full picker with pick caching enabled",
+    "Number of send_message payload bytes passed to call attempts by slice "
+    "reference instead of being copied into per-attempt buffers",
 };
 const char* grpc_stats_histogram_name[GRPC_STATS_HISTOGRAM_COUNT] = {
-    "call_initial_size",       "tcp_write_size", "tcp_write_iov_size",
-    "tcp_read_size",           "tcp_read_offer", "tcp_read_offer_iov_size",
-    "http2_send_message_size",
+    "call_initial_size",       "tcp_write_size",     "tcp_write_iov_size",
+    "tcp_read_size",           "tcp_read_offer",     "tcp_read_offer_iov_size",
+    "http2_send_message_size", "closures_per_flush", "combiner_queue_depth",
 };
 const char* grpc_stats_histogram_doc[GRPC_STATS_HISTOGRAM_COUNT] = {
     "Initial size of the grpc_call arena created at call start",
@@ -89,6 +112,9 @@ const char* grpc_stats_histogram_doc[GRPC_STATS_HISTOGRAM_COUNT] = {
     "Number of bytes offered to each syscall_read",
     "Number of byte segments offered to each syscall_read",
     "Size of messages received by HTTP2 transport",
+    "Number of closures run by each ExecCtx flush dispatch loop",
+    "Number of closures already queued on a combiner lock when another was "
+    "scheduled",
 };
 const int grpc_stats_table_0[25] = {
     0,   1,   2,   4,    7,    11,   17,   26,   40,   61,    93,    142,  216,
@@ -105,6 +131,9 @@ const uint8_t grpc_stats_table_3[23] = {2,  3,  3,  4,  5,  6,  7,  8,
                                         15, 16, 16, 17, 18, 19, 20};
 const int grpc_stats_table_4[11] = {0, 1, 2, 4, 7, 11, 17, 26, 38, 56, 80};
 const uint8_t grpc_stats_table_5[9] = {3, 3, 4, 5, 6, 6, 7, 8, 9};
+const int grpc_stats_table_6[12] = {0,  1,  2,   4,   8,   16,
+                                    32, 64, 128, 256, 512, 1024};
+const uint8_t grpc_stats_table_7[8] = {3, 4, 5, 6, 7, 8, 9, 10};
 namespace grpc_core {
 int BucketForHistogramValue_32768_24(int value) {
   if (value < 3) {
@@ -173,18 +202,45 @@ int BucketForHistogramValue_80_10(int value) {
     }
   }
 }
+int BucketForHistogramValue_1024_11(int value) {
+  if (value < 3) {
+    if (value < 0) {
+      return 0;
+    } else {
+      return value;
+    }
+  } else {
+    if (value < 385) {
+      // first_nontrivial_code=4613937818241073152
+      // last_code=4645463015632666624 [384.000000]
+      DblUint val;
+      val.dbl = value;
+      const int bucket =
+          grpc_stats_table_7[((val.uint - 4613937818241073152ull) >> 52)];
+      return bucket - (value < grpc_stats_table_6[bucket]);
+    } else {
+      if (value < 512) {
+        return 9;
+      } else {
+        return 10;
+      }
+    }
+  }
+}
 }  // namespace grpc_core
-const int grpc_stats_histo_buckets[7] = {24, 20, 10, 20, 20, 10, 20};
-const int grpc_stats_histo_start[7] = {0, 24, 44, 54, 74, 94, 104};
-const int* const grpc_stats_histo_bucket_boundaries[7] = {
+const int grpc_stats_histo_buckets[9] = {24, 20, 10, 20, 20, 10, 20, 11, 11};
+const int grpc_stats_histo_start[9] = {0, 24, 44, 54, 74, 94, 104, 124, 135};
+const int* const grpc_stats_histo_bucket_boundaries[9] = {
     grpc_stats_table_0, grpc_stats_table_2, grpc_stats_table_4,
     grpc_stats_table_2, grpc_stats_table_2, grpc_stats_table_4,
-    grpc_stats_table_2};
-int (*const grpc_stats_get_bucket[7])(int value) = {
+    grpc_stats_table_2, grpc_stats_table_6, grpc_stats_table_6};
+int (*const grpc_stats_get_bucket[9])(int value) = {
     grpc_core::BucketForHistogramValue_32768_24,
     grpc_core::BucketForHistogramValue_16777216_20,
     grpc_core::BucketForHistogramValue_80_10,
     grpc_core::BucketForHistogramValue_16777216_20,
     grpc_core::BucketForHistogramValue_16777216_20,
     grpc_core::BucketForHistogramValue_80_10,
-    grpc_core::BucketForHistogramValue_16777216_20};
+    grpc_core::BucketForHistogramValue_16777216_20,
+    grpc_core::BucketForHistogramValue_1024_11,
+    grpc_core::BucketForHistogramValue_1024_11};
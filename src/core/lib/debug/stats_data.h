@@ -40,9 +40,19 @@ typedef enum {
   GRPC_STATS_COUNTER_HTTP2_WRITES_BEGUN,
   GRPC_STATS_COUNTER_HTTP2_TRANSPORT_STALLS,
   GRPC_STATS_COUNTER_HTTP2_STREAM_STALLS,
+  GRPC_STATS_COUNTER_EXEC_CTX_FLUSHES,
   GRPC_STATS_COUNTER_CQ_PLUCK_CREATES,
   GRPC_STATS_COUNTER_CQ_NEXT_CREATES,
   GRPC_STATS_COUNTER_CQ_CALLBACK_CREATES,
+  GRPC_STATS_COUNTER_BYTE_BUFFER_VIEW_HITS,
+  GRPC_STATS_COUNTER_BYTE_BUFFER_VIEW_COPIES,
+  GRPC_STATS_COUNTER_COMBINER_LOCKS_CREATED,
+  GRPC_STATS_COUNTER_COMBINER_LOCKS_SCHEDULED_ITEMS,
+  GRPC_STATS_COUNTER_COMBINER_LOCKS_OFFLOADED,
+  GRPC_STATS_COUNTER_COMBINER_LOCKS_YIELDED,
+  GRPC_STATS_COUNTER_LB_PICK_CACHE_HITS,
+  GRPC_STATS_COUNTER_LB_PICK_CACHE_MISSES,
+  GRPC_STATS_COUNTER_RETRY_REPLAY_BYTES_SHARED,
   GRPC_STATS_COUNTER_COUNT
 } grpc_stats_counters;
 extern const char* grpc_stats_counter_name[GRPC_STATS_COUNTER_COUNT];
@@ -55,6 +65,8 @@ typedef enum {
   GRPC_STATS_HISTOGRAM_TCP_READ_OFFER,
   GRPC_STATS_HISTOGRAM_TCP_READ_OFFER_IOV_SIZE,
   GRPC_STATS_HISTOGRAM_HTTP2_SEND_MESSAGE_SIZE,
+  GRPC_STATS_HISTOGRAM_CLOSURES_PER_FLUSH,
+  GRPC_STATS_HISTOGRAM_COMBINER_QUEUE_DEPTH,
   GRPC_STATS_HISTOGRAM_COUNT
 } grpc_stats_histograms;
 extern const char* grpc_stats_histogram_name[GRPC_STATS_HISTOGRAM_COUNT];
@@ -74,7 +86,11 @@ typedef enum {
   GRPC_STATS_HISTOGRAM_TCP_READ_OFFER_IOV_SIZE_BUCKETS = 10,
   GRPC_STATS_HISTOGRAM_HTTP2_SEND_MESSAGE_SIZE_FIRST_SLOT = 104,
   GRPC_STATS_HISTOGRAM_HTTP2_SEND_MESSAGE_SIZE_BUCKETS = 20,
-  GRPC_STATS_HISTOGRAM_BUCKETS = 124
+  GRPC_STATS_HISTOGRAM_CLOSURES_PER_FLUSH_FIRST_SLOT = 124,
+  GRPC_STATS_HISTOGRAM_CLOSURES_PER_FLUSH_BUCKETS = 11,
+  GRPC_STATS_HISTOGRAM_COMBINER_QUEUE_DEPTH_FIRST_SLOT = 135,
+  GRPC_STATS_HISTOGRAM_COMBINER_QUEUE_DEPTH_BUCKETS = 11,
+  GRPC_STATS_HISTOGRAM_BUCKETS = 146
 } grpc_stats_histogram_constants;
 #define GRPC_STATS_INC_CLIENT_CALLS_CREATED() \
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_CLIENT_CALLS_CREATED)
@@ -104,12 +120,32 @@ typedef enum {
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_HTTP2_TRANSPORT_STALLS)
 #define GRPC_STATS_INC_HTTP2_STREAM_STALLS() \
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_HTTP2_STREAM_STALLS)
+#define GRPC_STATS_INC_EXEC_CTX_FLUSHES() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_EXEC_CTX_FLUSHES)
 #define GRPC_STATS_INC_CQ_PLUCK_CREATES() \
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_CQ_PLUCK_CREATES)
 #define GRPC_STATS_INC_CQ_NEXT_CREATES() \
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_CQ_NEXT_CREATES)
 #define GRPC_STATS_INC_CQ_CALLBACK_CREATES() \
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_CQ_CALLBACK_CREATES)
+#define GRPC_STATS_INC_BYTE_BUFFER_VIEW_HITS() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_BYTE_BUFFER_VIEW_HITS)
+#define GRPC_STATS_INC_BYTE_BUFFER_VIEW_COPIES() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_BYTE_BUFFER_VIEW_COPIES)
+#define GRPC_STATS_INC_COMBINER_LOCKS_CREATED() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_COMBINER_LOCKS_CREATED)
+#define GRPC_STATS_INC_COMBINER_LOCKS_SCHEDULED_ITEMS() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_COMBINER_LOCKS_SCHEDULED_ITEMS)
+#define GRPC_STATS_INC_COMBINER_LOCKS_OFFLOADED() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_COMBINER_LOCKS_OFFLOADED)
+#define GRPC_STATS_INC_COMBINER_LOCKS_YIELDED() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_COMBINER_LOCKS_YIELDED)
+#define GRPC_STATS_INC_LB_PICK_CACHE_HITS() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_LB_PICK_CACHE_HITS)
+#define GRPC_STATS_INC_LB_PICK_CACHE_MISSES() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_LB_PICK_CACHE_MISSES)
+#define GRPC_STATS_ADD_RETRY_REPLAY_BYTES_SHARED(amount) \
+  GRPC_STATS_ADD_COUNTER(GRPC_STATS_COUNTER_RETRY_REPLAY_BYTES_SHARED, amount)
 #define GRPC_STATS_INC_CALL_INITIAL_SIZE(value) \
   GRPC_STATS_INC_HISTOGRAM(                     \
       GRPC_STATS_HISTOGRAM_CALL_INITIAL_SIZE,   \
@@ -138,14 +174,23 @@ typedef enum {
   GRPC_STATS_INC_HISTOGRAM(                           \
       GRPC_STATS_HISTOGRAM_HTTP2_SEND_MESSAGE_SIZE,   \
       grpc_core::BucketForHistogramValue_16777216_20(static_cast<int>(value)))
+#define GRPC_STATS_INC_CLOSURES_PER_FLUSH(value) \
+  GRPC_STATS_INC_HISTOGRAM(                      \
+      GRPC_STATS_HISTOGRAM_CLOSURES_PER_FLUSH,   \
+      grpc_core::BucketForHistogramValue_1024_11(static_cast<int>(value)))
+#define GRPC_STATS_INC_COMBINER_QUEUE_DEPTH(value) \
+  GRPC_STATS_INC_HISTOGRAM(                        \
+      GRPC_STATS_HISTOGRAM_COMBINER_QUEUE_DEPTH,   \
+      grpc_core::BucketForHistogramValue_1024_11(static_cast<int>(value)))
 namespace grpc_core {
 int BucketForHistogramValue_32768_24(int value);
 int BucketForHistogramValue_16777216_20(int value);
 int BucketForHistogramValue_80_10(int value);
+int BucketForHistogramValue_1024_11(int value);
 }  // namespace grpc_core
-extern const int grpc_stats_histo_buckets[7];
-extern const int grpc_stats_histo_start[7];
-extern const int* const grpc_stats_histo_bucket_boundaries[7];
-extern int (*const grpc_stats_get_bucket[7])(int value);
+extern const int grpc_stats_histo_buckets[9];
+extern const int grpc_stats_histo_start[9];
+extern const int* const grpc_stats_histo_bucket_boundaries[9];
+extern int (*const grpc_stats_get_bucket[9])(int value);
 
 #endif /* GRPC_CORE_LIB_DEBUG_STATS_DATA_H */
@@ -37,6 +37,16 @@ int grpc_tracer_set_enabled(const char* name, int enabled);
 
 namespace grpc_core {
 
+namespace trace_detail {
+
+#ifdef GRPC_THREADSAFE_TRACER
+std::atomic<int> g_num_enabled_tracers{0};
+#else
+int g_num_enabled_tracers = 0;
+#endif
+
+}  // namespace trace_detail
+
 TraceFlag* TraceFlagList::root_tracer_ = nullptr;
 
 bool TraceFlagList::Set(const char* name, bool enabled) {
@@ -45,6 +45,23 @@ void grpc_tracer_shutdown(void);
 
 namespace grpc_core {
 
+namespace trace_detail {
+
+// Count of currently enabled tracers, merged into one hot location so that
+// trace-off fast paths read a single shared cacheline instead of one
+// boolean per flag.
+#ifdef GRPC_THREADSAFE_TRACER
+extern std::atomic<int> g_num_enabled_tracers;
+inline bool AnyTracerEnabled() {
+  return g_num_enabled_tracers.load(std::memory_order_relaxed) != 0;
+}
+#else
+extern int g_num_enabled_tracers;
+inline bool AnyTracerEnabled() { return g_num_enabled_tracers != 0; }
+#endif
+
+}  // namespace trace_detail
+
 class TraceFlag;
 class TraceFlagList {
  public:
@@ -77,7 +94,9 @@ class TraceFlag {
 // default, since internal build systems make recompiling trivial.
 //
 // Prefer GRPC_TRACE_FLAG_ENABLED() macro instead of using enabled() directly.
+#ifndef GRPC_DISABLE_TRACERS
 #define GRPC_USE_TRACERS  // tracers on by default in OSS
+#endif
 #if defined(GRPC_USE_TRACERS) || !defined(NDEBUG)
   bool enabled() {
 #ifdef GRPC_THREADSAFE_TRACER
@@ -96,22 +115,38 @@ class TraceFlag {
 
   void set_enabled(bool enabled) {
 #ifdef GRPC_THREADSAFE_TRACER
-    value_.store(enabled, std::memory_order_relaxed);
+    if (value_.exchange(enabled, std::memory_order_relaxed) != enabled) {
+      trace_detail::g_num_enabled_tracers.fetch_add(enabled ? 1 : -1,
+                                                    std::memory_order_relaxed);
+    }
 #else
-    value_ = enabled;
+    if (value_ != enabled) {
+      trace_detail::g_num_enabled_tracers += enabled ? 1 : -1;
+      value_ = enabled;
+    }
 #endif
   }
 
   TraceFlag* next_tracer_;
   const char* const name_;
 #ifdef GRPC_THREADSAFE_TRACER
-  std::atomic<bool> value_;
+  std::atomic<bool> value_{false};
 #else
-  bool value_;
+  bool value_ = false;
 #endif
 };
 
-#define GRPC_TRACE_FLAG_ENABLED(f) GPR_UNLIKELY((f).enabled())
+// With all tracing off (the production common case) this costs one
+// unlikely-hinted load of the merged counter, regardless of how many flag
+// checks are scattered across the call path; per-flag state is consulted
+// only once some tracer is enabled.  In GRPC_DISABLE_TRACERS builds it
+// folds to a constant and costs nothing at all.
+#if defined(GRPC_USE_TRACERS) || !defined(NDEBUG)
+#define GRPC_TRACE_FLAG_ENABLED(f) \
+  GPR_UNLIKELY(grpc_core::trace_detail::AnyTracerEnabled() && (f).enabled())
+#else
+#define GRPC_TRACE_FLAG_ENABLED(f) (false)
+#endif
 
 #ifndef NDEBUG
 typedef TraceFlag DebugOnlyTraceFlag;
@@ -25,6 +25,8 @@
 #include <grpc/event_engine/memory_request.h>
 #include <grpc/slice.h>
 
+#include "src/core/lib/gprpp/no_destruct.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/slice/slice_refcount_base.h"
 
 namespace grpc_event_engine {
@@ -45,22 +47,84 @@ class SliceRefCount : public grpc_slice_refcount {
   }
   ~SliceRefCount() { allocator_->Release(size_); }
 
+  size_t size() const { return size_; }
+
  private:
-  static void Destroy(grpc_slice_refcount* p) {
-    auto* rc = static_cast<SliceRefCount*>(p);
-    rc->~SliceRefCount();
-    free(rc);
-  }
+  static void Destroy(grpc_slice_refcount* p);
 
   std::shared_ptr<internal::MemoryAllocatorImpl> allocator_;
   size_t size_;
 };
 
+// A bounded pool of backing blocks for the fixed sizes that dominate
+// MakeSlice traffic (the 8K/64K socket read buffers). Endpoints allocate a
+// fresh slice per read round; at high ingest rates the malloc/free of each
+// block is measurable while quota accounting is already cheap (Reserve and
+// Release run against the allocator's local free-bytes pool). Only the
+// storage is recycled here - every slice still reserves and releases quota
+// as before, so memory pressure semantics are unchanged.
+class SliceBlockPool {
+ public:
+  // Take a block of exactly `size` bytes, or nullptr if none is pooled.
+  void* TryTake(size_t size) {
+    Bucket* bucket = BucketForSize(size);
+    if (bucket == nullptr) return nullptr;
+    grpc_core::MutexLock lock(&bucket->mu);
+    if (bucket->count == 0) return nullptr;
+    return bucket->blocks[--bucket->count];
+  }
+
+  // Donate a block of `size` bytes to the pool. Returns false (leaving the
+  // caller to free it) if the size isn't pooled or the bucket is full.
+  bool TryPut(void* block, size_t size) {
+    Bucket* bucket = BucketForSize(size);
+    if (bucket == nullptr) return false;
+    grpc_core::MutexLock lock(&bucket->mu);
+    if (bucket->count == kMaxBlocksPerBucket) return false;
+    bucket->blocks[bucket->count++] = block;
+    return true;
+  }
+
+ private:
+  // Bounds the pool to ~2.3MB: 32 * (8K + 64K) plus refcount overhead.
+  static constexpr size_t kMaxBlocksPerBucket = 32;
+  static constexpr size_t kSmallBlockSize = 8192 + sizeof(SliceRefCount);
+  static constexpr size_t kBigBlockSize = 65536 + sizeof(SliceRefCount);
+
+  struct Bucket {
+    grpc_core::Mutex mu;
+    void* blocks[kMaxBlocksPerBucket] ABSL_GUARDED_BY(mu);
+    size_t count ABSL_GUARDED_BY(mu) = 0;
+  };
+
+  Bucket* BucketForSize(size_t size) {
+    if (size == kSmallBlockSize) return &small_bucket_;
+    if (size == kBigBlockSize) return &big_bucket_;
+    return nullptr;
+  }
+
+  Bucket small_bucket_;
+  Bucket big_bucket_;
+};
+
+SliceBlockPool* BlockPool() {
+  static grpc_core::NoDestruct<SliceBlockPool> pool;
+  return pool.get();
+}
+
+void SliceRefCount::Destroy(grpc_slice_refcount* p) {
+  auto* rc = static_cast<SliceRefCount*>(p);
+  const size_t size = rc->size();
+  rc->~SliceRefCount();
+  if (!BlockPool()->TryPut(rc, size)) free(rc);
+}
+
 }  // namespace
 
 grpc_slice MemoryAllocator::MakeSlice(MemoryRequest request) {
   auto size = Reserve(request.Increase(sizeof(SliceRefCount)));
-  void* p = malloc(size);
+  void* p = BlockPool()->TryTake(size);
+  if (p == nullptr) p = malloc(size);
   new (p) SliceRefCount(allocator_, size);
   grpc_slice slice;
   slice.refcount = static_cast<SliceRefCount*>(p);
@@ -43,12 +43,17 @@
 
 #include "absl/synchronization/mutex.h"
 
+#include <grpc/support/time.h>
+
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/lockfree_event.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
 #include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h"
 #include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix_default.h"
 #include "src/core/lib/gprpp/fork.h"
+#include "src/core/lib/gprpp/global_config.h"
+
+GPR_GLOBAL_CONFIG_DECLARE_INT32(grpc_epoll_busy_poll_usec);
 
 using ::grpc_event_engine::posix_engine::LockfreeEvent;
 using ::grpc_event_engine::posix_engine::WakeupFd;
@@ -460,12 +465,32 @@ bool Epoll1Poller::ProcessEpollEvents(int max_epoll_events_to_handle,
 //  See ProcessEpollEvents() function for more details. It returns the number
 // of events generated by epoll_wait.
 int Epoll1Poller::DoEpollWait(EventEngine::Duration timeout) {
-  int r;
-  do {
-    r = epoll_wait(g_epoll_set_.epfd, g_epoll_set_.events, MAX_EPOLL_EVENTS,
-                   static_cast<int>(
-                       grpc_event_engine::experimental::Milliseconds(timeout)));
-  } while (r < 0 && errno == EINTR);
+  int r = 0;
+  int timeout_ms = static_cast<int>(
+      grpc_event_engine::experimental::Milliseconds(timeout));
+  static const int busy_poll_usec =
+      GPR_GLOBAL_CONFIG_GET(grpc_epoll_busy_poll_usec);
+  if (timeout_ms != 0 && busy_poll_usec > 0) {
+    // Latency mode: burn a bounded CPU budget spinning with a zero timeout
+    // before blocking, avoiding the scheduler wakeup hop for events that
+    // arrive within the budget. Kicks are visible to the spin via the wakeup
+    // fd.
+    const gpr_timespec spin_deadline =
+        gpr_time_add(gpr_now(GPR_CLOCK_MONOTONIC),
+                     gpr_time_from_micros(busy_poll_usec, GPR_TIMESPAN));
+    do {
+      r = epoll_wait(g_epoll_set_.epfd, g_epoll_set_.events, MAX_EPOLL_EVENTS,
+                     0);
+    } while ((r == 0 || (r < 0 && errno == EINTR)) &&
+             gpr_time_cmp(gpr_now(GPR_CLOCK_MONOTONIC), spin_deadline) < 0);
+    if (r < 0 && errno == EINTR) r = 0;
+  }
+  if (r == 0) {
+    do {
+      r = epoll_wait(g_epoll_set_.epfd, g_epoll_set_.events, MAX_EPOLL_EVENTS,
+                     timeout_ms);
+    } while (r < 0 && errno == EINTR);
+  }
   if (r < 0) {
     gpr_log(GPR_ERROR,
             "(event_engine) Epoll1Poller:%p encountered epoll_wait error: %s",
@@ -520,7 +545,23 @@ Poller::WorkResult Epoll1Poller::Work(
     absl::FunctionRef<void()> schedule_poll_again) {
   Events pending_events;
   if (g_epoll_set_.cursor == g_epoll_set_.num_events) {
-    if (DoEpollWait(timeout) == 0) {
+    {
+      absl::MutexLock lock(&mu_);
+      // A kick received while we were processing events was recorded in
+      // was_kicked_ without touching the wakeup fd; deliver it here instead
+      // of blocking in epoll_wait.
+      if (was_kicked_) {
+        was_kicked_ = false;
+        return Poller::WorkResult::kKicked;
+      }
+      in_epoll_wait_ = true;
+    }
+    int r = DoEpollWait(timeout);
+    {
+      absl::MutexLock lock(&mu_);
+      in_epoll_wait_ = false;
+    }
+    if (r == 0) {
       return Poller::WorkResult::kDeadlineExceeded;
     }
   }
@@ -551,7 +592,12 @@ void Epoll1Poller::Kick() {
     return;
   }
   was_kicked_ = true;
-  GPR_ASSERT(wakeup_fd_->Wakeup().ok());
+  // The wakeup-fd write (and the matching ConsumeWakeup read) is only needed
+  // to interrupt a thread blocked in epoll_wait; otherwise was_kicked_ alone
+  // is observed before the poller next blocks.
+  if (in_epoll_wait_) {
+    GPR_ASSERT(wakeup_fd_->Wakeup().ok());
+  }
 }
 
 Epoll1Poller* GetEpoll1Poller(Scheduler* scheduler) {
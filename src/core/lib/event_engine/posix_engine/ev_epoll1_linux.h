@@ -107,6 +107,10 @@ class Epoll1Poller : public PosixEventPoller {
   // A singleton epoll set
   EpollSet g_epoll_set_;
   bool was_kicked_ ABSL_GUARDED_BY(mu_);
+  // True while a thread is blocked (or about to block) in epoll_wait. Kick()
+  // only needs the wakeup-fd syscall when this is set; kicks that arrive while
+  // the poller is processing events are delivered through was_kicked_ alone.
+  bool in_epoll_wait_ ABSL_GUARDED_BY(mu_) = false;
   std::list<EventHandle*> free_epoll1_handles_list_ ABSL_GUARDED_BY(mu_);
   std::unique_ptr<WakeupFd> wakeup_fd_;
 };
@@ -0,0 +1,139 @@
+// Copyright 2022 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/event_engine/posix_engine/ev_epoll1_sharded_linux.h"
+
+#include <grpc/support/log.h>
+
+#include "src/core/lib/iomgr/port.h"
+
+// This polling engine is only relevant on linux kernels supporting epoll
+// epoll_create() or epoll_create1()
+#ifdef GRPC_LINUX_EPOLL
+#include <algorithm>
+
+#include <grpc/support/cpu.h>
+
+namespace grpc_event_engine {
+namespace posix_engine {
+
+namespace {
+
+// The shard a thread polls is sticky for the poller's lifetime so that a
+// shard's fds are always serviced by the same threads. Tag the binding with
+// the owning poller so a thread driving several pollers does not reuse a
+// binding across them.
+thread_local ShardedEpoll1Poller* g_bound_poller = nullptr;
+thread_local Epoll1Poller* g_bound_shard = nullptr;
+
+}  // namespace
+
+ShardedEpoll1Poller::ShardedEpoll1Poller(Scheduler* scheduler,
+                                         size_t num_shards) {
+  num_shards = std::max<size_t>(num_shards, 1);
+  shards_.reserve(num_shards);
+  for (size_t i = 0; i < num_shards; ++i) {
+    shards_.push_back(GetEpoll1Poller(scheduler));
+    GPR_ASSERT(shards_.back() != nullptr);
+  }
+}
+
+ShardedEpoll1Poller::~ShardedEpoll1Poller() = default;
+
+void ShardedEpoll1Poller::Shutdown() {
+  // Epoll1Poller::Shutdown deletes the shard.
+  for (Epoll1Poller* shard : shards_) {
+    shard->Shutdown();
+  }
+  delete this;
+}
+
+EventHandle* ShardedEpoll1Poller::CreateHandle(int fd, absl::string_view name,
+                                               bool track_err) {
+  return ShardForFd(fd)->CreateHandle(fd, name, track_err);
+}
+
+Epoll1Poller* ShardedEpoll1Poller::ShardForThisThread() {
+  if (g_bound_poller != this) {
+    g_bound_poller = this;
+    g_bound_shard = shards_[next_worker_shard_.fetch_add(
+                                1, std::memory_order_relaxed) %
+                            shards_.size()];
+  }
+  return g_bound_shard;
+}
+
+Poller::WorkResult ShardedEpoll1Poller::Work(
+    grpc_event_engine::experimental::EventEngine::Duration timeout,
+    absl::FunctionRef<void()> schedule_poll_again) {
+  return ShardForThisThread()->Work(timeout, schedule_poll_again);
+}
+
+void ShardedEpoll1Poller::Kick() {
+  for (Epoll1Poller* shard : shards_) {
+    shard->Kick();
+  }
+}
+
+ShardedEpoll1Poller* GetShardedEpoll1Poller(Scheduler* scheduler) {
+  return new ShardedEpoll1Poller(scheduler, gpr_cpu_num_cores());
+}
+
+}  // namespace posix_engine
+}  // namespace grpc_event_engine
+
+#else  // defined(GRPC_LINUX_EPOLL)
+
+namespace grpc_event_engine {
+namespace posix_engine {
+
+ShardedEpoll1Poller::ShardedEpoll1Poller(Scheduler* /* scheduler */,
+                                         size_t /* num_shards */) {
+  GPR_ASSERT(false && "unimplemented");
+}
+
+ShardedEpoll1Poller::~ShardedEpoll1Poller() {
+  GPR_ASSERT(false && "unimplemented");
+}
+
+void ShardedEpoll1Poller::Shutdown() { GPR_ASSERT(false && "unimplemented"); }
+
+EventHandle* ShardedEpoll1Poller::CreateHandle(int /*fd*/,
+                                               absl::string_view /*name*/,
+                                               bool /*track_err*/) {
+  GPR_ASSERT(false && "unimplemented");
+}
+
+Epoll1Poller* ShardedEpoll1Poller::ShardForThisThread() {
+  GPR_ASSERT(false && "unimplemented");
+}
+
+Poller::WorkResult ShardedEpoll1Poller::Work(
+    grpc_event_engine::experimental::EventEngine::Duration /*timeout*/,
+    absl::FunctionRef<void()> /*schedule_poll_again*/) {
+  GPR_ASSERT(false && "unimplemented");
+}
+
+void ShardedEpoll1Poller::Kick() { GPR_ASSERT(false && "unimplemented"); }
+
+ShardedEpoll1Poller* GetShardedEpoll1Poller(Scheduler* /*scheduler*/) {
+  return nullptr;
+}
+
+}  // namespace posix_engine
+}  // namespace grpc_event_engine
+
+#endif  // defined(GRPC_LINUX_EPOLL)
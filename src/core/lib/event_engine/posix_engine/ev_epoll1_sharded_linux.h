@@ -0,0 +1,75 @@
+// Copyright 2022 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_EPOLL1_SHARDED_LINUX_H
+#define GRPC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_EPOLL1_SHARDED_LINUX_H
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "absl/functional/function_ref.h"
+#include "absl/strings/string_view.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.h"
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/iomgr/port.h"
+
+namespace grpc_event_engine {
+namespace posix_engine {
+
+// A poller composed of N epoll1 shards, each with its own epoll set and
+// wakeup fd. File descriptors are assigned to a shard when their handle is
+// created, and each thread that calls Work() is bound to a single shard for
+// the poller's lifetime, so a given fd's events are always handled by the
+// same small set of worker threads. With one shard shared by every poller
+// thread a hot fd's events migrate freely between threads and the
+// per-connection state bounces between cores; sharding keeps it resident.
+class ShardedEpoll1Poller : public PosixEventPoller {
+ public:
+  ShardedEpoll1Poller(Scheduler* scheduler, size_t num_shards);
+  EventHandle* CreateHandle(int fd, absl::string_view name,
+                            bool track_err) override;
+  // Polls the shard bound to the calling thread. Threads are spread over
+  // shards round-robin on their first call to Work().
+  Poller::WorkResult Work(
+      grpc_event_engine::experimental::EventEngine::Duration timeout,
+      absl::FunctionRef<void()> schedule_poll_again) override;
+  std::string Name() override { return "epoll1-sharded"; }
+  void Kick() override;
+  void Shutdown() override;
+  ~ShardedEpoll1Poller() override;
+
+ private:
+  Epoll1Poller* ShardForThisThread();
+  Epoll1Poller* ShardForFd(int fd) { return shards_[fd % shards_.size()]; }
+
+  std::vector<Epoll1Poller*> shards_;
+  std::atomic<size_t> next_worker_shard_{0};
+};
+
+// Return an instance of a sharded epoll1 poller with one shard per core,
+// tied to the specified scheduler.
+ShardedEpoll1Poller* GetShardedEpoll1Poller(Scheduler* scheduler);
+
+}  // namespace posix_engine
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_EPOLL1_SHARDED_LINUX_H
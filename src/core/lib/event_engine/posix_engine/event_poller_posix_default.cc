@@ -18,6 +18,7 @@
 #include "absl/strings/string_view.h"
 
 #include "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.h"
+#include "src/core/lib/event_engine/posix_engine/ev_epoll1_sharded_linux.h"
 #include "src/core/lib/event_engine/posix_engine/ev_poll_posix.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/gprpp/global_config.h"
@@ -45,6 +46,8 @@ PosixEventPoller* GetDefaultPoller(Scheduler* scheduler) {
        it++) {
     if (PollStrategyMatches(*it, "epoll1")) {
       poller = GetEpoll1Poller(scheduler);
+    } else if (*it == "epoll1-sharded") {
+      poller = GetShardedEpoll1Poller(scheduler);
     } else if (PollStrategyMatches(*it, "poll")) {
       poller = GetPollPoller(scheduler, /*use_phony_poll=*/false);
     } else if (PollStrategyMatches(*it, "none")) {
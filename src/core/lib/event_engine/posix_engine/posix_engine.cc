@@ -15,20 +15,30 @@
 
 #include "src/core/lib/event_engine/posix_engine/posix_engine.h"
 
+#include <netdb.h>
+#include <string.h>
+
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/container/flat_hash_set.h"
 #include "absl/functional/any_invocable.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
 
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/support/log.h>
+#include <grpc/support/time.h>
 
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/executor/threaded_executor.h"
 #include "src/core/lib/event_engine/posix_engine/timer.h"
 #include "src/core/lib/event_engine/trace.h"
 #include "src/core/lib/event_engine/utils.h"
+#include "src/core/lib/gprpp/host_port.h"
+#include "src/core/lib/gprpp/time.h"
 
 namespace grpc_event_engine {
 namespace experimental {
@@ -76,12 +86,18 @@ bool PosixEventEngine::Cancel(EventEngine::TaskHandle handle) {
 
 EventEngine::TaskHandle PosixEventEngine::RunAfter(
     Duration when, absl::AnyInvocable<void()> closure) {
-  return RunAfterInternal(when, std::move(closure));
+  return RunAfterInternal(when, Duration::zero(), std::move(closure));
 }
 
 EventEngine::TaskHandle PosixEventEngine::RunAfter(
     Duration when, EventEngine::Closure* closure) {
-  return RunAfterInternal(when, [closure]() { closure->Run(); });
+  return RunAfterInternal(when, Duration::zero(),
+                          [closure]() { closure->Run(); });
+}
+
+EventEngine::TaskHandle PosixEventEngine::RunAfterWithSlack(
+    Duration when, Duration slack, absl::AnyInvocable<void()> closure) {
+  return RunAfterInternal(when, slack, std::move(closure));
 }
 
 void PosixEventEngine::Run(absl::AnyInvocable<void()> closure) {
@@ -93,7 +109,7 @@ void PosixEventEngine::Run(EventEngine::Closure* closure) {
 }
 
 EventEngine::TaskHandle PosixEventEngine::RunAfterInternal(
-    Duration when, absl::AnyInvocable<void()> cb) {
+    Duration when, Duration slack, absl::AnyInvocable<void()> cb) {
   auto when_ts = ToTimestamp(timer_manager_.Now(), when);
   auto* cd = new ClosureData;
   cd->cb = std::move(cb);
@@ -105,13 +121,152 @@ EventEngine::TaskHandle PosixEventEngine::RunAfterInternal(
   cd->handle = handle;
   GRPC_EVENT_ENGINE_TRACE("PosixEventEngine:%p scheduling callback:%s", this,
                           HandleToString(handle).c_str());
-  timer_manager_.TimerInit(&cd->timer, when_ts, cd);
+  timer_manager_.TimerInit(
+      &cd->timer, when_ts, cd,
+      grpc_core::Duration::NanosecondsRoundUp(slack.count()));
   return handle;
 }
 
+namespace {
+
+// getaddrinfo does not expose per-record TTLs, so cached resolutions are
+// kept for a deliberately short fixed window instead.
+constexpr grpc_core::Duration kDnsCacheEntryLifetime =
+    grpc_core::Duration::Seconds(15);
+// Bound on cached resolutions per resolver; the cache is a best-effort
+// latency optimization, so when full it is simply reset rather than
+// maintaining LRU bookkeeping.
+constexpr size_t kDnsCacheMaxEntries = 256;
+
+constexpr EventEngine::DNSResolver::LookupTaskHandle kNullLookupHandle = {-1,
+                                                                          -1};
+
+grpc_core::Timestamp DnsCacheNow() {
+  return grpc_core::Timestamp::FromTimespecRoundDown(
+      gpr_now(GPR_CLOCK_MONOTONIC));
+}
+
+absl::StatusOr<std::vector<EventEngine::ResolvedAddress>>
+BlockingLookupHostname(const std::string& host, const std::string& port) {
+  struct addrinfo hints;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  hints.ai_flags = AI_PASSIVE;
+  struct addrinfo* result = nullptr;
+  int s = getaddrinfo(host.c_str(), port.c_str(), &hints, &result);
+  if (s != 0) {
+    return absl::UnknownError(absl::StrCat("getaddrinfo(\"", host, ":", port,
+                                           "\"): ", gai_strerror(s)));
+  }
+  std::vector<EventEngine::ResolvedAddress> addresses;
+  for (struct addrinfo* resp = result; resp != nullptr; resp = resp->ai_next) {
+    addresses.emplace_back(resp->ai_addr, resp->ai_addrlen);
+  }
+  freeaddrinfo(result);
+  return addresses;
+}
+
+}  // namespace
+
+PosixEventEngine::PosixDNSResolver::PosixDNSResolver(PosixEventEngine* engine)
+    : engine_(engine), cache_(std::make_shared<Cache>()) {}
+
+PosixEventEngine::PosixDNSResolver::~PosixDNSResolver() = default;
+
+EventEngine::DNSResolver::LookupTaskHandle
+PosixEventEngine::PosixDNSResolver::LookupHostname(
+    LookupHostnameCallback on_resolve, absl::string_view name,
+    absl::string_view default_port, Duration /*timeout*/) {
+  std::string host;
+  std::string port;
+  if (!grpc_core::SplitHostPort(name, &host, &port)) {
+    engine_->Run([on_resolve = std::move(on_resolve),
+                  name = std::string(name)]() mutable {
+      on_resolve(
+          absl::InvalidArgumentError(absl::StrCat("Unparseable name: ", name)));
+    });
+    return kNullLookupHandle;
+  }
+  if (port.empty()) port = std::string(default_port);
+  if (port.empty()) {
+    engine_->Run([on_resolve = std::move(on_resolve),
+                  name = std::string(name)]() mutable {
+      on_resolve(
+          absl::InvalidArgumentError(absl::StrCat("No port in name: ", name)));
+    });
+    return kNullLookupHandle;
+  }
+  std::string cache_key = absl::StrCat(host, ":", port);
+  {
+    grpc_core::MutexLock lock(&cache_->mu);
+    auto it = cache_->entries.find(cache_key);
+    if (it != cache_->entries.end()) {
+      if (DnsCacheNow() < it->second.good_until) {
+        engine_->Run([on_resolve = std::move(on_resolve),
+                      addresses = it->second.addresses]() mutable {
+          on_resolve(std::move(addresses));
+        });
+        return kNullLookupHandle;
+      }
+      cache_->entries.erase(it);
+    }
+  }
+  // The cache is captured by value so that the lookup may outlive this
+  // resolver; the engine (and thus the executor) must outlive both.
+  engine_->Run([on_resolve = std::move(on_resolve), host = std::move(host),
+                port = std::move(port), cache_key = std::move(cache_key),
+                cache = cache_]() mutable {
+    auto result = BlockingLookupHostname(host, port);
+    if (result.ok()) {
+      grpc_core::MutexLock lock(&cache->mu);
+      if (cache->entries.size() >= kDnsCacheMaxEntries) {
+        cache->entries.clear();
+      }
+      cache->entries[cache_key] = {*result,
+                                   DnsCacheNow() + kDnsCacheEntryLifetime};
+    }
+    on_resolve(std::move(result));
+  });
+  return kNullLookupHandle;
+}
+
+EventEngine::DNSResolver::LookupTaskHandle
+PosixEventEngine::PosixDNSResolver::LookupSRV(LookupSRVCallback on_resolve,
+                                              absl::string_view /*name*/,
+                                              Duration /*timeout*/) {
+  engine_->Run([on_resolve = std::move(on_resolve)]() mutable {
+    on_resolve(absl::UnimplementedError(
+        "The native resolver does not support SRV records"));
+  });
+  return kNullLookupHandle;
+}
+
+EventEngine::DNSResolver::LookupTaskHandle
+PosixEventEngine::PosixDNSResolver::LookupTXT(LookupTXTCallback on_resolve,
+                                              absl::string_view /*name*/,
+                                              Duration /*timeout*/) {
+  engine_->Run([on_resolve = std::move(on_resolve)]() mutable {
+    on_resolve(absl::UnimplementedError(
+        "The native resolver does not support TXT records"));
+  });
+  return kNullLookupHandle;
+}
+
+bool PosixEventEngine::PosixDNSResolver::CancelLookup(
+    LookupTaskHandle /*handle*/) {
+  return false;
+}
+
 std::unique_ptr<EventEngine::DNSResolver> PosixEventEngine::GetDNSResolver(
-    EventEngine::DNSResolver::ResolverOptions const& /*options*/) {
-  GPR_ASSERT(false && "unimplemented");
+    EventEngine::DNSResolver::ResolverOptions const& options) {
+  if (!options.dns_server.empty()) {
+    gpr_log(GPR_ERROR,
+            "The native posix DNS resolver does not support custom DNS "
+            "servers; ignoring \"%s\"",
+            options.dns_server.c_str());
+  }
+  return std::make_unique<PosixDNSResolver>(this);
 }
 
 bool PosixEventEngine::IsWorkerThread() {
@@ -18,7 +18,10 @@
 #include <stdint.h>
 
 #include <atomic>
+#include <map>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/functional/any_invocable.h"
@@ -59,8 +62,18 @@ class PosixEventEngine final : public EventEngine {
     absl::StatusOr<int> Bind(const ResolvedAddress& addr) override;
     absl::Status Start() override;
   };
+  // A DNSResolver implementation that runs the system resolver
+  // (getaddrinfo) on the engine's executor, so callers never block and
+  // results are delivered on engine threads like any other callback.
+  // Successful hostname resolutions are cached per resolver for a short,
+  // fixed period; getaddrinfo does not expose record TTLs, so the cache
+  // window is deliberately conservative. SRV and TXT lookups are not
+  // supported by the system resolver and fail with UNIMPLEMENTED; targets
+  // needing them (e.g. grpclb) should continue to use the c-ares resolver.
+  // The resolver must not outlive the engine that created it.
   class PosixDNSResolver : public EventEngine::DNSResolver {
    public:
+    explicit PosixDNSResolver(PosixEventEngine* engine);
     ~PosixDNSResolver() override;
     LookupTaskHandle LookupHostname(LookupHostnameCallback on_resolve,
                                     absl::string_view name,
@@ -72,7 +85,24 @@ class PosixEventEngine final : public EventEngine {
     LookupTaskHandle LookupTXT(LookupTXTCallback on_resolve,
                                absl::string_view name,
                                Duration timeout) override;
+    // Lookups cannot be cancelled once handed to the system resolver;
+    // always returns false.
     bool CancelLookup(LookupTaskHandle handle) override;
+
+   private:
+    struct CacheEntry {
+      std::vector<ResolvedAddress> addresses;
+      grpc_core::Timestamp good_until;
+    };
+    // Shared with in-flight lookups so that a resolver may be destroyed
+    // while a lookup it started is still running on the executor.
+    struct Cache {
+      grpc_core::Mutex mu;
+      std::map<std::string, CacheEntry> entries ABSL_GUARDED_BY(mu);
+    };
+
+    PosixEventEngine* const engine_;
+    std::shared_ptr<Cache> cache_;
   };
 
   PosixEventEngine() = default;
@@ -100,11 +130,18 @@ class PosixEventEngine final : public EventEngine {
   TaskHandle RunAfter(Duration when, Closure* closure) override;
   TaskHandle RunAfter(Duration when,
                       absl::AnyInvocable<void()> closure) override;
+  // Like RunAfter, but the caller declares how late the closure may run.
+  // Deadlines within the same slack class are coalesced onto shared
+  // boundaries so that a batch of jittery timers costs one timer-manager
+  // wakeup instead of one each. Suitable for keepalive-grade internal
+  // timers; user-visible deadlines should use RunAfter (zero slack).
+  TaskHandle RunAfterWithSlack(Duration when, Duration slack,
+                               absl::AnyInvocable<void()> closure);
   bool Cancel(TaskHandle handle) override;
 
  private:
   struct ClosureData;
-  EventEngine::TaskHandle RunAfterInternal(Duration when,
+  EventEngine::TaskHandle RunAfterInternal(Duration when, Duration slack,
                                            absl::AnyInvocable<void()> cb);
 
   grpc_core::Mutex mu_;
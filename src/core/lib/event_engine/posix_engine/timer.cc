@@ -60,7 +60,9 @@ TimerList::TimerList(TimerListHost* host)
         grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
             min_timer_.load(std::memory_order_relaxed));
     shard.shard_queue_index = i;
-    shard.list.next = shard.list.prev = &shard.list;
+    for (size_t b = 0; b < Shard::kNumWheelBuckets; b++) {
+      shard.wheel[b].next = shard.wheel[b].prev = &shard.wheel[b];
+    }
     shard.min_deadline = shard.ComputeMinDeadline();
     shard_queue_[i] = &shard;
   }
@@ -130,7 +132,7 @@ void TimerList::TimerInit(Timer* timer, grpc_core::Timestamp deadline,
       is_first_timer = shard->heap.Add(timer);
     } else {
       timer->heap_index = kInvalidHeapIndex;
-      ListJoin(&shard->list, timer);
+      ListJoin(shard->WheelBucket(timer->deadline), timer);
     }
   }
 
@@ -178,7 +180,7 @@ bool TimerList::TimerCancel(Timer* timer) {
 }
 
 /* Rebalances the timer shard by computing a new 'queue_deadline_cap' and moving
-   all relevant timers in shard->list (i.e timers with deadlines earlier than
+   all relevant timers in shard->wheel (i.e timers with deadlines earlier than
    'queue_deadline_cap') into into shard->heap.
    Returns 'true' if shard->heap has at least ONE element */
 bool TimerList::Shard::RefillHeap(grpc_core::Timestamp now) {
@@ -189,19 +191,36 @@ bool TimerList::Shard::RefillHeap(grpc_core::Timestamp now) {
                        kMaxQueueWindowDuration);
   Timer *timer, *next;
 
-  /* Compute the new cap and put all timers under it into the queue: */
+  /* Compute the new cap and put all timers under it into the queue. Only the
+     wheel buckets covering [old cap, new cap) can hold such timers: every
+     insert below the cap at the time of insertion went to the heap, and every
+     earlier refill emptied the buckets it scanned of timers below the then-new
+     cap. */
+  const uint64_t old_cap_bucket =
+      static_cast<uint64_t>(
+          queue_deadline_cap.milliseconds_after_process_epoch()) >>
+      kWheelBucketShift;
   queue_deadline_cap = std::max(now, queue_deadline_cap) +
                        grpc_core::Duration::FromSecondsAsDouble(deadline_delta);
-
-  for (timer = list.next; timer != &list; timer = next) {
-    next = timer->next;
-    auto timer_deadline =
-        grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
-            timer->deadline);
-
-    if (timer_deadline < queue_deadline_cap) {
-      ListRemove(timer);
-      heap.Add(timer);
+  const uint64_t new_cap_bucket =
+      static_cast<uint64_t>(
+          queue_deadline_cap.milliseconds_after_process_epoch()) >>
+      kWheelBucketShift;
+  const size_t num_buckets_to_scan =
+      std::min<uint64_t>(new_cap_bucket - old_cap_bucket + 1, kNumWheelBuckets);
+
+  for (size_t i = 0; i < num_buckets_to_scan; i++) {
+    Timer* bucket = &wheel[(old_cap_bucket + i) % kNumWheelBuckets];
+    for (timer = bucket->next; timer != bucket; timer = next) {
+      next = timer->next;
+      auto timer_deadline =
+          grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+              timer->deadline);
+
+      if (timer_deadline < queue_deadline_cap) {
+        ListRemove(timer);
+        heap.Add(timer);
+      }
     }
   }
   return !heap.is_empty();
@@ -131,16 +131,24 @@ class TimerList {
       grpc_core::Timestamp* next);
 
  private:
-  /* A "timer shard". Contains a 'heap' and a 'list' of timers. All timers with
-   * deadlines earlier than 'queue_deadline_cap' are maintained in the heap and
-   * others are maintained in the list (unordered). This helps to keep the
-   * number of elements in the heap low.
+  /* A "timer shard". Contains a 'heap' and a hashed 'wheel' of timers. All
+   * timers with deadlines earlier than 'queue_deadline_cap' are maintained in
+   * the heap and others are maintained in the wheel (unordered lists hashed by
+   * deadline). This helps to keep the number of elements in the heap low.
    *
    * The 'queue_deadline_cap' gets recomputed periodically based on the timer
    * stats maintained in 'stats' and the relevant timers are then moved from the
-   * 'list' to 'heap'.
-   */
+   * 'wheel' to 'heap'. Because the wheel buckets by deadline, only the buckets
+   * covering the advanced cap window need to be scanned, rather than every
+   * far-out timer in the shard; insert and cancel stay O(1). */
   struct Shard {
+    /* Wheel bucket granularity (as a shift of deadline milliseconds) and
+       bucket count: 256ms buckets, 64 buckets, so one rotation spans ~16s.
+       Timers beyond one rotation hash onto the same buckets and are simply
+       skipped until the cap reaches them. */
+    static constexpr size_t kWheelBucketShift = 8;
+    static constexpr size_t kNumWheelBuckets = 64;
+
     Shard();
 
     grpc_core::Timestamp ComputeMinDeadline() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
@@ -150,6 +158,13 @@ class TimerList {
                    grpc_core::Timestamp* new_min_deadline,
                    std::vector<experimental::EventEngine::Closure*>* out)
         ABSL_LOCKS_EXCLUDED(mu);
+    /* The wheel bucket that a timer with the given deadline belongs in. */
+    Timer* WheelBucket(int64_t deadline_millis)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu) {
+      return &wheel[(static_cast<uint64_t>(deadline_millis) >>
+                     kWheelBucketShift) %
+                    kNumWheelBuckets];
+    }
 
     grpc_core::Mutex mu;
     grpc_core::TimeAveragedStats stats ABSL_GUARDED_BY(mu);
@@ -162,8 +177,10 @@ class TimerList {
     /* This holds all timers with deadlines < queue_deadline_cap. Timers in this
        list have the top bit of their deadline set to 0. */
     TimerHeap heap ABSL_GUARDED_BY(mu);
-    /* This holds timers whose deadline is >= queue_deadline_cap. */
-    Timer list ABSL_GUARDED_BY(mu);
+    /* This holds timers whose deadline is >= queue_deadline_cap, bucketed by
+       deadline. Each entry is the sentinel of an intrusive doubly-linked
+       list. */
+    Timer wheel[kNumWheelBuckets] ABSL_GUARDED_BY(mu);
   };
 
   void SwapAdjacentShardsInQueue(uint32_t first_shard_queue_index)
@@ -211,7 +211,21 @@ grpc_core::Timestamp TimerManager::Host::Now() {
 }
 
 void TimerManager::TimerInit(Timer* timer, grpc_core::Timestamp deadline,
-                             experimental::EventEngine::Closure* closure) {
+                             experimental::EventEngine::Closure* closure,
+                             grpc_core::Duration slack) {
+  if (slack > grpc_core::Duration::Zero() &&
+      deadline != grpc_core::Timestamp::InfFuture()) {
+    // Round the deadline up to the next multiple of the slack interval.
+    // Because the boundaries are shared by every timer in the same slack
+    // class (rather than each timer keeping its own jittery arrival time),
+    // coalesced timers collapse into one earliest-deadline change and thus
+    // one kick of the timed waiter, instead of one per insertion.
+    uint64_t millis = deadline.milliseconds_after_process_epoch();
+    uint64_t slack_millis = static_cast<uint64_t>(slack.millis());
+    millis += (slack_millis - millis % slack_millis) % slack_millis;
+    deadline = grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+        static_cast<int64_t>(millis));
+  }
   timer_list_->TimerInit(timer, deadline, closure);
 }
 
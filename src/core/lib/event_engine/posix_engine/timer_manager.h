@@ -51,8 +51,15 @@ class TimerManager final : public grpc_event_engine::experimental::Forkable {
 
   grpc_core::Timestamp Now() { return host_.Now(); }
 
+  // Schedule closure to run at deadline. A non-zero slack declares how late
+  // the caller can tolerate firing: the deadline is rounded up (by at most
+  // slack) to the next multiple of the slack interval, so all timers in the
+  // same slack class land on shared boundaries and are serviced by a single
+  // wakeup of the timed waiter. Pass Duration::Zero() (the default) for
+  // deadlines that must fire exactly on time.
   void TimerInit(Timer* timer, grpc_core::Timestamp deadline,
-                 experimental::EventEngine::Closure* closure);
+                 experimental::EventEngine::Closure* closure,
+                 grpc_core::Duration slack = grpc_core::Duration::Zero());
   bool TimerCancel(Timer* timer);
 
   // Forkable
@@ -92,10 +92,19 @@ Slice Slice::Ref() const { return Slice(grpc_core::CSliceRef(c_slice())); }
 Slice Slice::FromRefcountAndBytes(grpc_slice_refcount* r, const uint8_t* begin,
                                   const uint8_t* end) {
   grpc_slice out;
+  const size_t length = static_cast<size_t>(end - begin);
+  if (length <= sizeof(out.data.inlined.bytes)) {
+    // Copying out the bytes is cheaper than the ref/unref round trip, and
+    // avoids pinning the (usually much larger) underlying buffer.
+    out.refcount = nullptr;
+    out.data.inlined.length = static_cast<uint8_t>(length);
+    memcpy(out.data.inlined.bytes, begin, length);
+    return Slice(out);
+  }
   out.refcount = r;
   if (r != grpc_slice_refcount::NoopRefcount()) r->Ref();
   out.data.refcounted.bytes = const_cast<uint8_t*>(begin);
-  out.data.refcounted.length = end - begin;
+  out.data.refcounted.length = length;
   return Slice(out);
 }
 
@@ -20,6 +20,7 @@
 
 #include "src/core/lib/event_engine/thread_pool.h"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -34,11 +35,15 @@ namespace grpc_event_engine {
 namespace experimental {
 
 namespace {
-// TODO(drfloob): Remove this, and replace it with the WorkQueue* for the
-// current thread (with nullptr indicating not a threadpool thread).
-thread_local bool g_threadpool_thread;
+// The local queue of the current thread, nullptr if this is not a threadpool
+// thread. Owning pool state alongside, so that work submitted to one pool from
+// a worker of another pool isn't misrouted to the worker's local queue.
+thread_local WorkQueue* g_local_queue;
+thread_local void* g_local_queue_owner;
 }  // namespace
 
+bool ThreadPool::IsThreadPoolThread() { return g_local_queue != nullptr; }
+
 void ThreadPool::StartThread(StatePtr state, bool throttled) {
   state->thread_count.Add();
   if (throttled && state->currently_starting_one_thread.exchange(
@@ -54,7 +59,6 @@ void ThreadPool::StartThread(StatePtr state, bool throttled) {
       "event_engine",
       [](void* arg) {
         std::unique_ptr<ThreadArg> a(static_cast<ThreadArg*>(arg));
-        g_threadpool_thread = true;
         if (a->throttled) {
           GPR_ASSERT(a->state->currently_starting_one_thread.exchange(
               false, std::memory_order_relaxed));
@@ -67,21 +71,77 @@ void ThreadPool::StartThread(StatePtr state, bool throttled) {
 }
 
 void ThreadPool::ThreadFunc(StatePtr state) {
-  while (state->queue.Step()) {
+  // This thread is the only producer; local push/pop is lock-free.
+  WorkQueue local_queue(/*single_producer=*/true);
+  g_local_queue = &local_queue;
+  g_local_queue_owner = state.get();
+  state->AddLocalQueue(&local_queue);
+  for (;;) {
+    // Drain our own queue first, newest-first: the most recent element is
+    // reserved from stealing and likely still cache-hot.
+    while (EventEngine::Closure* closure = local_queue.PopBack()) {
+      closure->Run();
+    }
+    // A sibling's local queue may have work: steal its oldest element.
+    if (EventEngine::Closure* closure = state->Steal()) {
+      closure->Run();
+      continue;
+    }
+    Queue::StepResult result = state->queue.Step();
+    if (result == Queue::StepResult::kFinished) break;
+    // On kWoken, loop around: a worker pushed to a local queue, which is
+    // only reachable from here by stealing.
+  }
+  state->RemoveLocalQueue(&local_queue);
+  g_local_queue = nullptr;
+  g_local_queue_owner = nullptr;
+  // Run anything still in our queue: nothing new can arrive now that the
+  // queue is deregistered and the thread-local is cleared.
+  while (EventEngine::Closure* closure = local_queue.PopBack()) {
+    closure->Run();
   }
   state->thread_count.Remove();
 }
 
-bool ThreadPool::Queue::Step() {
+void ThreadPool::State::AddLocalQueue(WorkQueue* queue) {
+  grpc_core::MutexLock lock(&local_queues_mu);
+  local_queues.push_back(queue);
+}
+
+void ThreadPool::State::RemoveLocalQueue(WorkQueue* queue) {
+  grpc_core::MutexLock lock(&local_queues_mu);
+  local_queues.erase(
+      std::find(local_queues.begin(), local_queues.end(), queue));
+}
+
+EventEngine::Closure* ThreadPool::State::Steal() {
+  grpc_core::MutexLock lock(&local_queues_mu);
+  if (local_queues.empty()) return nullptr;
+  // Rotate the starting victim so concurrent thieves spread out instead of
+  // all contending on the same queue.
+  size_t start = next_steal_target.fetch_add(1, std::memory_order_relaxed);
+  for (size_t i = 0; i < local_queues.size(); i++) {
+    WorkQueue* victim = local_queues[(start + i) % local_queues.size()];
+    if (EventEngine::Closure* closure = victim->PopFront()) return closure;
+  }
+  return nullptr;
+}
+
+ThreadPool::Queue::StepResult ThreadPool::Queue::Step() {
   grpc_core::ReleasableMutexLock lock(&mu_);
   // Wait until work is available or we are shutting down.
-  while (state_ == State::kRunning && callbacks_.empty()) {
+  if (state_ == State::kRunning && callbacks_.empty()) {
     // If there are too many threads waiting, then quit this thread.
     // TODO(ctiller): wait some time in this case to be sure.
-    if (threads_waiting_ >= reserve_threads_) return false;
+    if (threads_waiting_ >= reserve_threads_) return StepResult::kFinished;
     threads_waiting_++;
     cv_.Wait(&mu_);
     threads_waiting_--;
+    // Return to the caller on wakeup rather than re-waiting: a worker may
+    // have pushed to its local queue, which is only reachable by stealing.
+    if (callbacks_.empty() && state_ == State::kRunning) {
+      return StepResult::kWoken;
+    }
   }
   switch (state_) {
     case State::kRunning:
@@ -89,14 +149,14 @@ bool ThreadPool::Queue::Step() {
     case State::kShutdown:
     case State::kForking:
       if (!callbacks_.empty()) break;
-      return false;
+      return StepResult::kFinished;
   }
   GPR_ASSERT(!callbacks_.empty());
   auto callback = std::move(callbacks_.front());
   callbacks_.pop();
   lock.Release();
   callback();
-  return true;
+  return StepResult::kRanCallback;
 }
 
 ThreadPool::ThreadPool(int reserve_threads)
@@ -112,11 +172,21 @@ ThreadPool::~ThreadPool() {
   // Note that if this is a threadpool thread then we won't exit this thread
   // until the callstack unwinds a little, so we need to wait for just one
   // thread running instead of zero.
-  state_->thread_count.BlockUntilThreadCount(g_threadpool_thread ? 1 : 0,
+  state_->thread_count.BlockUntilThreadCount(g_local_queue != nullptr ? 1 : 0,
                                              "shutting down");
 }
 
 void ThreadPool::Add(absl::AnyInvocable<void()> callback) {
+  // Fast path for workers of this pool: push to the thread's own queue
+  // without touching the shared mutex, then wake a sleeper to steal if we
+  // stay busy.
+  if (g_local_queue != nullptr && g_local_queue_owner == state_.get()) {
+    g_local_queue->Add(std::move(callback));
+    if (state_->queue.Notify()) {
+      StartThread(state_, /*throttled=*/true);
+    }
+    return;
+  }
   if (state_->queue.Add(std::move(callback))) {
     StartThread(state_, /*throttled=*/true);
   }
@@ -137,6 +207,13 @@ bool ThreadPool::Queue::Add(absl::AnyInvocable<void()> callback) {
   GPR_UNREACHABLE_CODE(return false);
 }
 
+bool ThreadPool::Queue::Notify() {
+  grpc_core::MutexLock lock(&mu_);
+  if (state_ == State::kForking) return false;
+  cv_.Signal();
+  return threads_waiting_ == 0;
+}
+
 void ThreadPool::Queue::SetState(State state) {
   grpc_core::MutexLock lock(&mu_);
   if (state == State::kRunning) {
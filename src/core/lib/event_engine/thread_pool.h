@@ -24,11 +24,15 @@
 #include <atomic>
 #include <memory>
 #include <queue>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/functional/any_invocable.h"
 
+#include <grpc/event_engine/event_engine.h>
+
 #include "src/core/lib/event_engine/forkable.h"
+#include "src/core/lib/event_engine/work_queue.h"
 #include "src/core/lib/gprpp/sync.h"
 
 namespace grpc_event_engine {
@@ -42,6 +46,10 @@ class ThreadPool final : public grpc_event_engine::experimental::Forkable {
 
   void Add(absl::AnyInvocable<void()> callback);
 
+  // Returns true if the calling thread is a worker of any ThreadPool.
+  // Callers use this to run short work inline rather than re-queueing it.
+  static bool IsThreadPoolThread();
+
   // Forkable
   // Ensures that the thread pool is empty before forking.
   void PrepareFork() override;
@@ -51,13 +59,29 @@ class ThreadPool final : public grpc_event_engine::experimental::Forkable {
  private:
   class Queue {
    public:
+    // Outcome of one scheduling step of a worker thread against the global
+    // queue.
+    enum class StepResult {
+      // A callback from the global queue was run.
+      kRanCallback,
+      // The thread slept and was woken: local queues of other workers may
+      // have work to steal.
+      kWoken,
+      // The thread should exit (shutdown/fork drain complete, or thread
+      // surplus).
+      kFinished,
+    };
+
     explicit Queue(int reserve_threads) : reserve_threads_(reserve_threads) {}
-    bool Step();
+    StepResult Step();
     void SetShutdown() { SetState(State::kShutdown); }
     void SetForking() { SetState(State::kForking); }
     // Add a callback to the queue.
     // Return true if we should also spin up a new thread.
     bool Add(absl::AnyInvocable<void()> callback);
+    // Wake one sleeping worker (after work was pushed to a local queue).
+    // Return true if we should also spin up a new thread.
+    bool Notify();
     void Reset() { SetState(State::kRunning); }
 
    private:
@@ -92,6 +116,18 @@ class ThreadPool final : public grpc_event_engine::experimental::Forkable {
     // After pool creation we use this to rate limit creation of threads to one
     // at a time.
     std::atomic<bool> currently_starting_one_thread{false};
+
+    // Worker-local queues, for work-stealing. Workers push and pop their own
+    // queue LIFO (WorkQueue reserves the most recent element from stealing,
+    // keeping it cache-hot for its owner); idle workers steal the oldest
+    // element from a sibling, scanning from a rotating start position.
+    void AddLocalQueue(WorkQueue* queue);
+    void RemoveLocalQueue(WorkQueue* queue);
+    EventEngine::Closure* Steal();
+
+    grpc_core::Mutex local_queues_mu;
+    std::vector<WorkQueue*> local_queues ABSL_GUARDED_BY(local_queues_mu);
+    std::atomic<size_t> next_steal_target{0};
   };
 
   using StatePtr = std::shared_ptr<State>;
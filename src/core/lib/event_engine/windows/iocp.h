@@ -51,6 +51,9 @@ class IOCP final : public Poller {
   static DWORD GetDefaultSocketFlags();
 
  private:
+  // Number of completions dequeued per GetQueuedCompletionStatusEx call.
+  static constexpr ULONG kMaxCompletionsPerDequeue = 16;
+
   // Initialize default flags via checking platform support
   static DWORD WSASocketFlagsInit();
 
@@ -15,6 +15,7 @@
 
 #include "src/core/lib/event_engine/work_queue.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <utility>
@@ -51,8 +52,18 @@ EventEngine::Closure* WorkQueue::Storage::closure() { return closure_; }
 
 // ------ WorkQueue -----------------------------------------------------------
 
+WorkQueue::WorkQueue(bool single_producer) {
+  if (single_producer) {
+    ring_ = std::make_unique<RingSlot[]>(kRingCapacity);
+  }
+}
+
 // Returns whether the queue is empty
 bool WorkQueue::Empty() const {
+  if (ring_ != nullptr && ring_bottom_.load(std::memory_order_relaxed) !=
+                              ring_top_.load(std::memory_order_relaxed)) {
+    return false;
+  }
   return (most_recent_element_enqueue_timestamp_.load(
               std::memory_order_relaxed) == kInvalidTimestamp &&
           oldest_enqueued_timestamp_.load(std::memory_order_relaxed) ==
@@ -60,22 +71,39 @@ bool WorkQueue::Empty() const {
 }
 
 grpc_core::Timestamp WorkQueue::OldestEnqueuedTimestamp() const {
+  grpc_core::Timestamp oldest = grpc_core::Timestamp::InfFuture();
+  if (ring_ != nullptr) {
+    uint64_t top = ring_top_.load(std::memory_order_acquire);
+    if (top != ring_bottom_.load(std::memory_order_acquire)) {
+      // Benign race: the slot may be claimed or overwritten concurrently.
+      // This value is only a scheduling heuristic.
+      oldest = grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+          ring_[top & (kRingCapacity - 1)].enqueued);
+    }
+  }
   int64_t front_of_queue_timestamp =
       oldest_enqueued_timestamp_.load(std::memory_order_relaxed);
   if (front_of_queue_timestamp != kInvalidTimestamp) {
-    return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
-        front_of_queue_timestamp);
+    return std::min(oldest,
+                    grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+                        front_of_queue_timestamp));
   }
   int64_t most_recent_millis =
       most_recent_element_enqueue_timestamp_.load(std::memory_order_relaxed);
-  if (most_recent_millis == kInvalidTimestamp) {
-    return grpc_core::Timestamp::InfPast();
+  if (most_recent_millis != kInvalidTimestamp) {
+    return std::min(oldest,
+                    grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+                        most_recent_millis));
   }
-  return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
-      most_recent_millis);
+  if (oldest != grpc_core::Timestamp::InfFuture()) return oldest;
+  return grpc_core::Timestamp::InfPast();
 }
 
 EventEngine::Closure* WorkQueue::PopFront() ABSL_LOCKS_EXCLUDED(mu_) {
+  if (ring_ != nullptr) {
+    EventEngine::Closure* closure = RingSteal();
+    if (closure != nullptr) return closure;
+  }
   if (oldest_enqueued_timestamp_.load(std::memory_order_relaxed) !=
       kInvalidTimestamp) {
     EventEngine::Closure* t = TryLockAndPop(/*front=*/true);
@@ -89,6 +117,10 @@ EventEngine::Closure* WorkQueue::PopFront() ABSL_LOCKS_EXCLUDED(mu_) {
 }
 
 EventEngine::Closure* WorkQueue::PopBack() {
+  if (ring_ != nullptr) {
+    EventEngine::Closure* closure = RingPopBottom();
+    if (closure != nullptr) return closure;
+  }
   if (most_recent_element_enqueue_timestamp_.load(std::memory_order_relaxed) !=
       kInvalidTimestamp) {
     return TryPopMostRecentElement();
@@ -101,6 +133,63 @@ EventEngine::Closure* WorkQueue::PopBack() {
   return nullptr;
 }
 
+bool WorkQueue::RingPush(Storage& storage) {
+  uint64_t bottom = ring_bottom_.load(std::memory_order_relaxed);
+  uint64_t top = ring_top_.load(std::memory_order_acquire);
+  if (bottom - top >= kRingCapacity) return false;  // full: overflow
+  RingSlot& slot = ring_[bottom & (kRingCapacity - 1)];
+  slot.closure = storage.closure();
+  slot.enqueued = storage.enqueued();
+  ring_bottom_.store(bottom + 1, std::memory_order_release);
+  return true;
+}
+
+EventEngine::Closure* WorkQueue::RingPopBottom() {
+  uint64_t bottom = ring_bottom_.load(std::memory_order_relaxed);
+  uint64_t top = ring_top_.load(std::memory_order_relaxed);
+  if (bottom == top) return nullptr;  // empty
+  // Reserve the bottom element, then re-read top to detect thieves that
+  // claimed it while we were doing so.
+  bottom--;
+  ring_bottom_.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  top = ring_top_.load(std::memory_order_relaxed);
+  if (top > bottom) {
+    // A thief took the last element first.
+    ring_bottom_.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+  EventEngine::Closure* closure = ring_[bottom & (kRingCapacity - 1)].closure;
+  if (top == bottom) {
+    // This is the last element: race any thieves for it.
+    if (!ring_top_.compare_exchange_strong(top, top + 1,
+                                           std::memory_order_seq_cst,
+                                           std::memory_order_relaxed)) {
+      closure = nullptr;
+    }
+    ring_bottom_.store(bottom + 1, std::memory_order_relaxed);
+  }
+  return closure;
+}
+
+EventEngine::Closure* WorkQueue::RingSteal() {
+  uint64_t top = ring_top_.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  uint64_t bottom = ring_bottom_.load(std::memory_order_acquire);
+  if (top >= bottom) return nullptr;  // empty
+  // Read the slot before claiming it: a successful CAS on top proves the
+  // slot was not reused, since the owner never overwrites an index in
+  // [top, bottom).
+  EventEngine::Closure* closure = ring_[top & (kRingCapacity - 1)].closure;
+  if (!ring_top_.compare_exchange_strong(top, top + 1,
+                                         std::memory_order_seq_cst,
+                                         std::memory_order_relaxed)) {
+    // Lost a race with the owner or another thief.
+    return nullptr;
+  }
+  return closure;
+}
+
 void WorkQueue::Add(EventEngine::Closure* closure) {
   AddInternal(Storage(closure));
 }
@@ -110,6 +199,7 @@ void WorkQueue::Add(absl::AnyInvocable<void()> invocable) {
 }
 
 void WorkQueue::AddInternal(Storage&& storage) {
+  if (ring_ != nullptr && RingPush(storage)) return;
   Storage previous_most_recent;
   int64_t previous_ts;
   {
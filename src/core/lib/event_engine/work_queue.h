@@ -20,6 +20,7 @@
 
 #include <atomic>
 #include <deque>
+#include <memory>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/functional/any_invocable.h"
@@ -38,12 +39,22 @@ namespace experimental {
 // This uses atomics to access the most recent element in the queue, making it
 // fast for LIFO operations. Accessing the oldest (next) element requires taking
 // a mutex lock.
+//
+// In single-producer mode, a bounded Chase-Lev style lock-free ring sits in
+// front of the mutex-guarded deque: the owning thread pushes and pops at the
+// bottom of the ring with plain atomics, while thieves compete for the top
+// element with a CAS. The deque is retained as overflow for when the ring
+// fills up.
 class WorkQueue {
  public:
   // comparable to Timestamp::milliseconds_after_process_epoch()
   static const int64_t kInvalidTimestamp = -1;
 
   WorkQueue() = default;
+  // If single_producer is true, only one thread (the owner) may call Add and
+  // PopBack; any thread may call PopFront. Local pushes and pops on the
+  // owning thread then avoid the mutex entirely unless the ring overflows.
+  explicit WorkQueue(bool single_producer);
   // Returns whether the queue is empty
   bool Empty() const;
   // Returns the Timestamp of when the most recently-added element was
@@ -101,6 +112,29 @@ class WorkQueue {
   EventEngine::Closure* TryPopMostRecentElement();
   // Common code for the Add methods
   void AddInternal(Storage&& storage);
+  // Pushes onto the bottom of the ring. Owner thread only. Returns false if
+  // the ring is full, in which case the element must overflow to the deque.
+  bool RingPush(Storage& storage);
+  // Pops the most recently pushed ring element. Owner thread only.
+  EventEngine::Closure* RingPopBottom();
+  // Claims the oldest ring element. Safe from any thread.
+  EventEngine::Closure* RingSteal();
+
+  // A ring slot is written only by the owner and is never reused while its
+  // index lies in [ring_top_, ring_bottom_), so a thief may read it before
+  // the CAS that claims it.
+  struct RingSlot {
+    EventEngine::Closure* closure;
+    int64_t enqueued;
+  };
+  static constexpr size_t kRingCapacity = 256;  // must be a power of two
+
+  // Allocated only in single-producer mode.
+  std::unique_ptr<RingSlot[]> ring_;
+  // Thief side: advanced by CAS on every successful steal.
+  alignas(GPR_CACHELINE_SIZE) std::atomic<uint64_t> ring_top_{0};
+  // Owner side: moved with plain atomic loads/stores.
+  alignas(GPR_CACHELINE_SIZE) std::atomic<uint64_t> ring_bottom_{0};
 
   // The managed items in the queue
   std::deque<Storage> elements_ ABSL_GUARDED_BY(mu_);
@@ -40,6 +40,33 @@ GPR_GLOBAL_CONFIG_DEFINE_STRING(
 
 namespace grpc_core {
 
+#ifdef GRPC_EXPERIMENTS_ARE_FINAL
+
+// Experiments are frozen at compile time: the inline accessors in
+// experiments.h return constants, and the runtime configuration surface
+// degrades to the frozen defaults.
+
+bool IsExperimentEnabled(size_t experiment_id) {
+  return g_experiment_metadata[experiment_id].default_value;
+}
+
+void PrintExperimentsList() {
+  for (size_t i = 0; i < kNumExperiments; i++) {
+    gpr_log(GPR_DEBUG, "gRPC EXPERIMENT %s %s (frozen at compile time)",
+            g_experiment_metadata[i].name,
+            g_experiment_metadata[i].default_value ? "ON" : "OFF");
+  }
+}
+
+void ForceEnableExperiment(absl::string_view experiment, bool enable) {
+  gpr_log(GPR_ERROR,
+          "gRPC EXPERIMENT %s cannot be force-%sd: experiments are frozen at "
+          "compile time",
+          std::string(experiment).c_str(), enable ? "enable" : "disable");
+}
+
+#else  // !GRPC_EXPERIMENTS_ARE_FINAL
+
 namespace {
 struct Experiments {
   bool enabled[kNumExperiments];
@@ -143,4 +170,6 @@ void ForceEnableExperiment(absl::string_view experiment, bool enable) {
           std::string(experiment).c_str(), enable ? "enable" : "disable");
 }
 
+#endif  // GRPC_EXPERIMENTS_ARE_FINAL
+
 }  // namespace grpc_core
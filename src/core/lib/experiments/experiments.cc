@@ -51,6 +51,22 @@ const char* const description_monitoring_experiment =
 const char* const description_promise_based_client_call =
     "If set, use the new gRPC promise based call code when it's appropriate "
     "(ie when all filters in a stack are promise based)";
+const char* const description_event_engine_callback_cq =
+    "If set, callback completion queues dispatch user functors directly onto "
+    "EventEngine threads (running them inline when already on one) instead of "
+    "routing them through the iomgr executor.";
+const char* const description_event_engine_executor =
+    "If set, closures enqueued onto the iomgr default executor run on the "
+    "shared EventEngine thread pool instead of the executor's own threads, "
+    "making process-wide thread counts predictable and cutting context "
+    "switches. The resolver executor keeps its own pool because its jobs may "
+    "block in the system resolver.";
+const char* const description_elide_pollset_set =
+    "If set, install a no-op pollset_set implementation so that polling "
+    "entities skip pollset_set registration entirely. Only safe when "
+    "endpoints drive their own polling (e.g. EventEngine endpoints or the "
+    "background poller); call pollsets then never need to poll channel fds "
+    "and the per-call polling-entity bookkeeping is pure overhead.";
 #ifdef NDEBUG
 const bool kDefaultForDebugOnly = false;
 #else
@@ -77,6 +93,9 @@ const ExperimentMetadata g_experiment_metadata[] = {
     {"event_engine_client", description_event_engine_client, false},
     {"monitoring_experiment", description_monitoring_experiment, true},
     {"promise_based_client_call", description_promise_based_client_call, false},
+    {"event_engine_callback_cq", description_event_engine_callback_cq, false},
+    {"event_engine_executor", description_event_engine_executor, false},
+    {"elide_pollset_set", description_elide_pollset_set, false},
 };
 
 }  // namespace grpc_core
@@ -25,6 +25,34 @@
 
 namespace grpc_core {
 
+#ifdef GRPC_EXPERIMENTS_ARE_FINAL
+// Experiments are frozen to their default values at compile time: gated
+// code paths fold to constants and the losing side is dead-stripped.
+// GRPC_EXPERIMENTS has no effect in this build mode.
+inline constexpr bool IsTcpFrameSizeTuningEnabled() { return false; }
+inline constexpr bool IsTcpReadChunksEnabled() { return false; }
+inline constexpr bool IsTcpRcvLowatEnabled() { return false; }
+inline constexpr bool IsPeerStateBasedFramingEnabled() { return false; }
+inline constexpr bool IsFlowControlFixesEnabled() { return false; }
+inline constexpr bool IsMemoryPressureControllerEnabled() { return false; }
+inline constexpr bool IsPeriodicResourceQuotaReclamationEnabled() {
+  return false;
+}
+inline constexpr bool IsUnconstrainedMaxQuotaBufferSizeEnabled() {
+  return false;
+}
+#ifdef NDEBUG
+inline constexpr bool IsNewHpackHuffmanDecoderEnabled() { return false; }
+#else
+inline constexpr bool IsNewHpackHuffmanDecoderEnabled() { return true; }
+#endif
+inline constexpr bool IsEventEngineClientEnabled() { return false; }
+inline constexpr bool IsMonitoringExperimentEnabled() { return true; }
+inline constexpr bool IsPromiseBasedClientCallEnabled() { return false; }
+inline constexpr bool IsEventEngineCallbackCqEnabled() { return false; }
+inline constexpr bool IsEventEngineExecutorEnabled() { return false; }
+inline constexpr bool IsElidePollsetSetEnabled() { return false; }
+#else
 inline bool IsTcpFrameSizeTuningEnabled() { return IsExperimentEnabled(0); }
 inline bool IsTcpReadChunksEnabled() { return IsExperimentEnabled(1); }
 inline bool IsTcpRcvLowatEnabled() { return IsExperimentEnabled(2); }
@@ -45,6 +73,10 @@ inline bool IsMonitoringExperimentEnabled() { return IsExperimentEnabled(10); }
 inline bool IsPromiseBasedClientCallEnabled() {
   return IsExperimentEnabled(11);
 }
+inline bool IsEventEngineCallbackCqEnabled() { return IsExperimentEnabled(12); }
+inline bool IsEventEngineExecutorEnabled() { return IsExperimentEnabled(13); }
+inline bool IsElidePollsetSetEnabled() { return IsExperimentEnabled(14); }
+#endif  // GRPC_EXPERIMENTS_ARE_FINAL
 
 struct ExperimentMetadata {
   const char* name;
@@ -52,7 +84,7 @@ struct ExperimentMetadata {
   bool default_value;
 };
 
-constexpr const size_t kNumExperiments = 12;
+constexpr const size_t kNumExperiments = 15;
 extern const ExperimentMetadata g_experiment_metadata[kNumExperiments];
 
 }  // namespace grpc_core
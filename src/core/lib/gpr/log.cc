@@ -143,3 +143,7 @@ void gpr_log_verbosity_init() {
 void gpr_set_log_function(gpr_log_func f) {
   gpr_atm_no_barrier_store(&g_log_func, (gpr_atm)(f ? f : gpr_default_log));
 }
+
+gpr_log_func gpr_get_log_function(void) {
+  return reinterpret_cast<gpr_log_func>(gpr_atm_no_barrier_load(&g_log_func));
+}
@@ -0,0 +1,200 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gpr/log_async.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <atomic>
+
+#include <grpc/support/log.h>
+#include <grpc/support/sync.h>
+#include <grpc/support/time.h>
+
+#include "src/core/lib/gprpp/thd.h"
+
+namespace {
+
+// Must be a power of two.  The ring holds roughly half a megabyte; a full
+// ring means the writer cannot keep up with stderr, at which point
+// dropping records is preferable to stalling the threads that log.
+constexpr size_t kRecordCapacity = 2048;
+constexpr size_t kMessageCapacity = 256;
+
+// A cell in a bounded multi-producer ring (single consumer here).  The
+// sequence number tells producers and the consumer whose turn a cell is:
+// equal to the ring position when free to write, position+1 when written.
+struct LogRecord {
+  std::atomic<size_t> sequence;
+  const char* file;  // __FILE__ literal; assumed immortal.
+  int line;
+  gpr_log_severity severity;
+  char message[kMessageCapacity];
+};
+
+LogRecord* g_records = nullptr;
+std::atomic<size_t> g_enqueue_pos{0};
+size_t g_dequeue_pos = 0;  // Writer thread only.
+std::atomic<size_t> g_dropped_pending{0};
+std::atomic<size_t> g_dropped_total{0};
+gpr_log_func g_backing_log_func = nullptr;
+bool g_enabled = false;
+std::atomic<bool> g_shutdown{false};
+grpc_core::Thread g_writer;
+gpr_mu g_writer_mu;
+gpr_cv g_writer_cv;
+
+bool enqueue_record(gpr_log_func_args* args) {
+  size_t pos = g_enqueue_pos.load(std::memory_order_relaxed);
+  for (;;) {
+    LogRecord* cell = &g_records[pos & (kRecordCapacity - 1)];
+    size_t seq = cell->sequence.load(std::memory_order_acquire);
+    intptr_t dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+    if (dif == 0) {
+      if (g_enqueue_pos.compare_exchange_weak(pos, pos + 1,
+                                              std::memory_order_relaxed)) {
+        cell->file = args->file;
+        cell->line = args->line;
+        cell->severity = args->severity;
+        size_t len = strlen(args->message);
+        if (len > kMessageCapacity - 1) len = kMessageCapacity - 1;
+        memcpy(cell->message, args->message, len);
+        cell->message[len] = '\0';
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+      }
+    } else if (dif < 0) {
+      // The consumer has not yet freed this cell: the ring is full.
+      return false;
+    } else {
+      pos = g_enqueue_pos.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+bool dequeue_record(LogRecord* out) {
+  LogRecord* cell = &g_records[g_dequeue_pos & (kRecordCapacity - 1)];
+  size_t seq = cell->sequence.load(std::memory_order_acquire);
+  if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(g_dequeue_pos + 1) <
+      0) {
+    return false;
+  }
+  out->file = cell->file;
+  out->line = cell->line;
+  out->severity = cell->severity;
+  memcpy(out->message, cell->message, sizeof(out->message));
+  cell->sequence.store(g_dequeue_pos + kRecordCapacity,
+                       std::memory_order_release);
+  g_dequeue_pos++;
+  return true;
+}
+
+void write_record(const LogRecord* record) {
+  gpr_log_func_args args;
+  memset(&args, 0, sizeof(args));
+  args.file = record->file;
+  args.line = record->line;
+  args.severity = record->severity;
+  args.message = record->message;
+  g_backing_log_func(&args);
+}
+
+void drain_ring() {
+  LogRecord record;
+  while (dequeue_record(&record)) {
+    write_record(&record);
+  }
+  size_t dropped = g_dropped_pending.exchange(0, std::memory_order_relaxed);
+  if (dropped != 0) {
+    char buf[128];
+    snprintf(buf, sizeof(buf),
+             "async logging overflow: %" PRIuPTR " records dropped",
+             static_cast<uintptr_t>(dropped));
+    gpr_log_func_args args;
+    memset(&args, 0, sizeof(args));
+    args.file = __FILE__;
+    args.line = __LINE__;
+    args.severity = GPR_LOG_SEVERITY_ERROR;
+    args.message = buf;
+    g_backing_log_func(&args);
+  }
+}
+
+void async_log(gpr_log_func_args* args) {
+  if (!enqueue_record(args)) {
+    g_dropped_pending.fetch_add(1, std::memory_order_relaxed);
+    g_dropped_total.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void writer_thread(void* /*arg*/) {
+  for (;;) {
+    bool shutting_down = g_shutdown.load(std::memory_order_acquire);
+    drain_ring();
+    if (shutting_down) return;
+    gpr_mu_lock(&g_writer_mu);
+    gpr_cv_wait(&g_writer_cv, &g_writer_mu,
+                gpr_time_add(gpr_now(GPR_CLOCK_MONOTONIC),
+                             gpr_time_from_millis(10, GPR_TIMESPAN)));
+    gpr_mu_unlock(&g_writer_mu);
+  }
+}
+
+}  // namespace
+
+void gpr_async_log_enable(void) {
+  if (g_enabled) return;
+  g_records = new LogRecord[kRecordCapacity];
+  for (size_t i = 0; i < kRecordCapacity; i++) {
+    g_records[i].sequence.store(i, std::memory_order_relaxed);
+  }
+  g_enqueue_pos.store(0, std::memory_order_relaxed);
+  g_dequeue_pos = 0;
+  g_shutdown.store(false, std::memory_order_relaxed);
+  gpr_mu_init(&g_writer_mu);
+  gpr_cv_init(&g_writer_cv);
+  // Route records to whatever log function was installed before us.
+  g_backing_log_func = gpr_get_log_function();
+  g_writer = grpc_core::Thread("grpc_log_writer", writer_thread, nullptr);
+  g_writer.Start();
+  gpr_set_log_function(async_log);
+  g_enabled = true;
+}
+
+void gpr_async_log_disable(void) {
+  if (!g_enabled) return;
+  // Stop intercepting first so that no new records are enqueued after the
+  // final drain below.  A thread already inside async_log may still slip
+  // a record in; the synchronous drain after the join picks those up.
+  gpr_set_log_function(g_backing_log_func);
+  g_shutdown.store(true, std::memory_order_release);
+  gpr_mu_lock(&g_writer_mu);
+  gpr_cv_signal(&g_writer_cv);
+  gpr_mu_unlock(&g_writer_mu);
+  g_writer.Join();
+  drain_ring();
+  delete[] g_records;
+  g_records = nullptr;
+  gpr_mu_destroy(&g_writer_mu);
+  gpr_cv_destroy(&g_writer_cv);
+  g_enabled = false;
+}
+
+size_t gpr_async_log_dropped_records(void) {
+  return g_dropped_total.load(std::memory_order_relaxed);
+}
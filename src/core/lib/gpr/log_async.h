@@ -0,0 +1,54 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_CORE_LIB_GPR_LOG_ASYNC_H
+#define GRPC_CORE_LIB_GPR_LOG_ASYNC_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+#include <grpc/support/log.h>
+
+// Asynchronous logging backend for gpr_log.
+//
+// By default gpr_log formats and writes to stderr synchronously on the
+// calling thread, so a burst of log messages under contention can stall
+// data-plane threads.  When enabled, this backend intercepts the installed
+// log function: log records are copied into a fixed-size lock-free ring
+// buffer and handed to the previously installed log function by a
+// background writer thread.  If the ring fills up, records are dropped
+// and accounted for; the writer periodically reports how many were lost.
+//
+// Notes:
+//  - Records are formatted (including the timestamp) when drained, so
+//    printed times can lag the call by up to the drain interval.
+//  - Messages longer than the per-record capacity are truncated.
+
+// Starts the writer thread and routes subsequent gpr_log output through
+// the ring buffer.  No-op if already enabled.
+void gpr_async_log_enable(void);
+
+// Restores the previously installed log function, flushes any buffered
+// records, and joins the writer thread.  No-op if not enabled.
+void gpr_async_log_disable(void);
+
+// Total number of records dropped because the ring buffer was full since
+// the process started.
+size_t gpr_async_log_dropped_records(void);
+
+// Returns the currently installed log function (defined in log.cc).
+gpr_log_func gpr_get_log_function(void);
+
+#endif /* GRPC_CORE_LIB_GPR_LOG_ASYNC_H */
@@ -0,0 +1,151 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_CORE_LIB_GPRPP_ADAPTIVE_MUTEX_H
+#define GRPC_CORE_LIB_GPRPP_ADAPTIVE_MUTEX_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stdint.h>
+
+#include <atomic>
+
+#include "absl/base/thread_annotations.h"
+
+#include "src/core/lib/gpr/time_precise.h"
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/sync.h"
+
+namespace grpc_core {
+
+// A mutex for short, hot critical sections (hundreds of nanoseconds).
+//
+// A contended Lock() first spins with exponential backoff for a budget
+// calibrated per lock from the observed hold times, then parks on the
+// underlying Mutex.  For critical sections shorter than a context switch
+// this avoids most futex round trips; locks that turn out to be held for
+// long stretches calibrate their spin budget down to the clamp and behave
+// like a plain Mutex.  Do _not_ block while holding an AdaptiveMutex.
+//
+// Contention and park counters are maintained (off the uncontended fast
+// path) for observability; the uncontended path is a single TryLock.
+class ABSL_LOCKABLE AdaptiveMutex {
+ public:
+  struct Stats {
+    // Lock() calls that found the mutex held.
+    uint64_t contentions;
+    // Contended Lock() calls that exhausted their spin budget and parked.
+    uint64_t parks;
+  };
+
+  AdaptiveMutex() = default;
+
+  AdaptiveMutex(const AdaptiveMutex&) = delete;
+  AdaptiveMutex& operator=(const AdaptiveMutex&) = delete;
+
+  void Lock() ABSL_EXCLUSIVE_LOCK_FUNCTION() {
+    if (GPR_LIKELY(mu_.TryLock())) {
+      lock_acquired_cycles_ = gpr_get_cycle_counter();
+      return;
+    }
+    ContendedLock();
+    lock_acquired_cycles_ = gpr_get_cycle_counter();
+  }
+
+  void Unlock() ABSL_UNLOCK_FUNCTION() {
+    // Fold this hold time into the spin budget while still holding the
+    // lock; only the owner writes the budget, so a relaxed store suffices.
+    const int64_t held = static_cast<int64_t>(gpr_get_cycle_counter() -
+                                              lock_acquired_cycles_);
+    int64_t budget = spin_budget_cycles_.load(std::memory_order_relaxed);
+    // Track roughly twice the smoothed hold time: long enough that a
+    // waiter arriving mid-hold usually outlasts the owner, short enough
+    // that pathological holders stop burning cycles.
+    budget += (2 * held - budget) / 8;
+    spin_budget_cycles_.store(Clamp(budget, kMinSpinCycles, kMaxSpinCycles),
+                              std::memory_order_relaxed);
+    mu_.Unlock();
+  }
+
+  bool TryLock() ABSL_EXCLUSIVE_TRYLOCK_FUNCTION(true) {
+    if (mu_.TryLock()) {
+      lock_acquired_cycles_ = gpr_get_cycle_counter();
+      return true;
+    }
+    return false;
+  }
+
+  void AssertHeld() ABSL_ASSERT_EXCLUSIVE_LOCK() {}
+
+  Stats stats() const {
+    return Stats{contentions_.load(std::memory_order_relaxed),
+                 parks_.load(std::memory_order_relaxed)};
+  }
+
+ private:
+  // Spin budget clamps, in cycle-counter units.  The maximum bounds the
+  // cost of spinning on a lock whose holder was preempted to well under a
+  // typical context switch.
+  static constexpr int64_t kMinSpinCycles = 128;
+  static constexpr int64_t kMaxSpinCycles = 65536;
+
+  void ContendedLock() {
+    contentions_.fetch_add(1, std::memory_order_relaxed);
+    const int64_t budget =
+        spin_budget_cycles_.load(std::memory_order_relaxed);
+    const gpr_cycle_counter start = gpr_get_cycle_counter();
+    int backoff = 1;
+    do {
+      // Exponential backoff between attempts keeps the lock word from
+      // bouncing between spinning cores.
+      for (int i = 0; i < backoff; i++) {
+        gpr_get_cycle_counter();  // compiler barrier + mild delay
+      }
+      if (backoff < kMaxBackoffIterations) backoff <<= 1;
+      if (mu_.TryLock()) return;
+    } while (static_cast<int64_t>(gpr_get_cycle_counter() - start) < budget);
+    parks_.fetch_add(1, std::memory_order_relaxed);
+    mu_.Lock();
+  }
+
+  static constexpr int kMaxBackoffIterations = 64;
+
+  Mutex mu_;
+  // Written only by the lock owner while the lock is held.
+  gpr_cycle_counter lock_acquired_cycles_ = 0;
+  std::atomic<int64_t> spin_budget_cycles_{kMaxSpinCycles};
+  std::atomic<uint64_t> contentions_{0};
+  std::atomic<uint64_t> parks_{0};
+};
+
+// RAII lock for AdaptiveMutex, mirroring MutexLock.
+class ABSL_SCOPED_LOCKABLE AdaptiveMutexLock {
+ public:
+  explicit AdaptiveMutexLock(AdaptiveMutex* mu)
+      ABSL_EXCLUSIVE_LOCK_FUNCTION(mu)
+      : mu_(mu) {
+    mu_->Lock();
+  }
+  ~AdaptiveMutexLock() ABSL_UNLOCK_FUNCTION() { mu_->Unlock(); }
+
+  AdaptiveMutexLock(const AdaptiveMutexLock&) = delete;
+  AdaptiveMutexLock& operator=(const AdaptiveMutexLock&) = delete;
+
+ private:
+  AdaptiveMutex* const mu_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_CORE_LIB_GPRPP_ADAPTIVE_MUTEX_H
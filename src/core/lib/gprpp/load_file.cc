@@ -23,16 +23,61 @@
 #include "absl/cleanup/cleanup.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_cat.h"
+#include "absl/types/optional.h"
 
 #include <grpc/slice.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
+#if defined(GPR_LINUX) || defined(GPR_APPLE) || defined(GPR_FREEBSD)
+#define GRPC_HAVE_MMAP_FILE 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace grpc_core {
 
+namespace {
+
+#ifdef GRPC_HAVE_MMAP_FILE
+
+void MunmapSlice(void* ptr, size_t len) { munmap(ptr, len); }
+
+// Maps the file read-only into a slice backed by the page cache, avoiding
+// a heap allocation and copy of the contents.  Returns nullopt whenever a
+// mapping is not possible (empty or non-regular file, mmap failure); the
+// caller then falls back to the read path.
+absl::optional<Slice> TryMmapFile(const char* filename) {
+  int fd = open(filename, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) return absl::nullopt;
+  struct stat st;
+  if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0) {
+    close(fd);
+    return absl::nullopt;
+  }
+  const size_t size = static_cast<size_t>(st.st_size);
+  void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) return absl::nullopt;
+  return Slice(grpc_slice_new_with_len(mapping, size, MunmapSlice));
+}
+
+#endif  // GRPC_HAVE_MMAP_FILE
+
+}  // namespace
+
 // Loads the content of a file into a slice. add_null_terminator will add a NULL
 // terminator if true.
 absl::StatusOr<Slice> LoadFile(std::string filename, bool add_null_terminator) {
+#ifdef GRPC_HAVE_MMAP_FILE
+  // Mapping cannot append a terminator, so that case takes the read path.
+  if (!add_null_terminator) {
+    absl::optional<Slice> mapped = TryMmapFile(filename.c_str());
+    if (mapped.has_value()) return std::move(*mapped);
+  }
+#endif
   unsigned char* contents = nullptr;
   size_t contents_size = 0;
   FILE* file;
@@ -76,6 +76,66 @@ MultiProducerSingleConsumerQueue::PopAndCheckEnd(bool* empty) {
   return nullptr;
 }
 
+MultiProducerSingleConsumerQueue::Node*
+MultiProducerSingleConsumerQueue::PopAll() {
+  Node* list_head = nullptr;
+  Node* list_tail = nullptr;
+  // If a previous Pop() stopped partway through the chain, the stub may be
+  // linked into the middle of it and cannot be republished as the producer
+  // target until it has been passed; pop node by node until the stub is
+  // back at the front.  A consumer that drains exclusively via PopAll()
+  // never takes this path.
+  while (tail_ != &stub_) {
+    bool empty;
+    Node* node = PopAndCheckEnd(&empty);
+    if (node == nullptr) continue;  // a producer is mid-Push; retry
+    node->next.store(nullptr, std::memory_order_relaxed);
+    if (list_head == nullptr) {
+      list_head = node;
+    } else {
+      list_tail->next.store(node, std::memory_order_relaxed);
+    }
+    list_tail = node;
+  }
+  // The stub is now at the front of the chain.  Skip past it, waiting out
+  // any producer that has exchanged head_ but not yet linked the stub to
+  // its node.
+  Node* first = stub_.next.load(std::memory_order_acquire);
+  if (first == nullptr) {
+    if (head_.load(std::memory_order_acquire) == &stub_) {
+      // Nothing was pushed after the stub: the queue is (ephemerally)
+      // empty beyond what we have already collected.
+      return list_head;
+    }
+    do {
+      first = stub_.next.load(std::memory_order_acquire);
+    } while (first == nullptr);
+  }
+  // Detach the whole chain: everything pushed before this exchange is
+  // ours; later pushes go onto the reset stub.  The stub is unreachable to
+  // producers at this point, so clearing its next pointer before
+  // republishing it is safe.
+  stub_.next.store(nullptr, std::memory_order_relaxed);
+  Node* last = head_.exchange(&stub_, std::memory_order_acq_rel);
+  // Repair any transiently broken links left by producers that were
+  // preempted between exchanging head_ and linking their predecessor, so
+  // that the caller can simply follow next pointers until nullptr.
+  Node* node = first;
+  while (node != last) {
+    Node* next = node->next.load(std::memory_order_acquire);
+    while (next == nullptr) {
+      next = node->next.load(std::memory_order_acquire);
+    }
+    node = next;
+  }
+  if (list_head == nullptr) {
+    list_head = first;
+  } else {
+    list_tail->next.store(first, std::memory_order_relaxed);
+  }
+  return list_head;
+}
+
 //
 // LockedMultiProducerSingleConsumerQueue
 //
@@ -105,4 +165,10 @@ LockedMultiProducerSingleConsumerQueue::Pop() {
   return node;
 }
 
+LockedMultiProducerSingleConsumerQueue::Node*
+LockedMultiProducerSingleConsumerQueue::PopAll() {
+  MutexLock lock(&mu_);
+  return queue_.PopAll();
+}
+
 }  // namespace grpc_core
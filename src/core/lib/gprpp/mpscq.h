@@ -57,14 +57,23 @@ class MultiProducerSingleConsumerQueue {
   // Pop a node; sets *empty to true if the queue is empty, or false if it is
   // not.
   Node* PopAndCheckEnd(bool* empty);
+  // Atomically detach every node currently in the queue with a single
+  // exchange on the producer side and return the chain in FIFO order
+  // (oldest first), linked via Node::next and terminated by nullptr.
+  // Returns nullptr if the queue is empty.  Much cheaper than draining via
+  // repeated Pop() calls, which perform an atomic operation per node.  May
+  // briefly spin-wait for producers that are in the middle of a Push().
+  // Thread compatible - can only be called from one thread at a time
+  Node* PopAll();
 
  private:
-  // make sure head & tail don't share a cacheline
-  union {
-    char padding_[GPR_CACHELINE_SIZE];
-    std::atomic<Node*> head_{nullptr};
-  };
-  Node* tail_;
+  // Producer side: exchanged on every Push.  Aligned so that pushes do not
+  // contend with the consumer-side fields below.
+  alignas(GPR_CACHELINE_SIZE) std::atomic<Node*> head_;
+  // Consumer side: only touched by the (single) popping thread, except for
+  // stub_.next, which a producer writes when pushing onto an empty queue --
+  // exactly when the consumer needs to read it anyway.
+  alignas(GPR_CACHELINE_SIZE) Node* tail_;
   Node stub_;
 };
 
@@ -89,6 +98,11 @@ class LockedMultiProducerSingleConsumerQueue {
   // calling this function
   Node* Pop();
 
+  // Atomically detach every node currently in the queue; see
+  // MultiProducerSingleConsumerQueue::PopAll().
+  // Thread safe - can be called from multiple threads concurrently
+  Node* PopAll();
+
  private:
   MultiProducerSingleConsumerQueue queue_;
   Mutex mu_;
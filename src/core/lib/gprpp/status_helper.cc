@@ -23,6 +23,7 @@
 #include <string.h>
 
 #include <algorithm>
+#include <map>
 #include <utility>
 
 #include "absl/strings/cord.h"
@@ -40,11 +41,15 @@
 
 #include <grpc/support/log.h>
 
+#include "src/core/lib/gprpp/no_destruct.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/slice/percent_encoding.h"
 #include "src/core/lib/slice/slice.h"
 
 namespace grpc_core {
 
+TraceFlag grpc_status_details_trace(false, "status_details");
+
 namespace {
 
 #define TYPE_URL_PREFIX "type.googleapis.com/grpc.status."
@@ -145,6 +150,42 @@ uint32_t DecodeUInt32FromBytes(const char* buf) {
          (uint32_t(ubuf[3]) << 24);
 }
 
+// Interned statuses for common (code, message) pairs.  Entries are built on
+// first use and live for the lifetime of the process; the table is
+// insert-only and bounded so that unbounded message variety (e.g. messages
+// embedding peer addresses) cannot grow it without limit.
+class StatusInternTable {
+ public:
+  absl::Status Intern(absl::StatusCode code, absl::string_view msg) {
+    const std::pair<absl::StatusCode, absl::string_view> key(code, msg);
+    MutexLock lock(&mu_);
+    auto it = map_.find(key);
+    if (it != map_.end()) return it->second;
+    if (map_.size() >= kMaxEntries) return absl::Status(code, msg);
+    return map_
+        .emplace(std::make_pair(code, std::string(msg)),
+                 absl::Status(code, msg))
+        .first->second;
+  }
+
+ private:
+  static constexpr size_t kMaxEntries = 256;
+
+  // Allows lookups keyed by string_view without building a std::string.
+  struct KeyCompare {
+    using is_transparent = void;
+    template <typename A, typename B>
+    bool operator()(const A& a, const B& b) const {
+      if (a.first != b.first) return a.first < b.first;
+      return absl::string_view(a.second) < absl::string_view(b.second);
+    }
+  };
+
+  Mutex mu_;
+  std::map<std::pair<absl::StatusCode, std::string>, absl::Status, KeyCompare>
+      map_ ABSL_GUARDED_BY(mu_);
+};
+
 std::vector<absl::Status> ParseChildren(absl::Cord children) {
   std::vector<absl::Status> result;
   upb::Arena arena;
@@ -169,6 +210,14 @@ std::vector<absl::Status> ParseChildren(absl::Cord children) {
 absl::Status StatusCreate(absl::StatusCode code, absl::string_view msg,
                           const DebugLocation& location,
                           std::vector<absl::Status> children) {
+  const bool debug_annotations =
+      GRPC_TRACE_FLAG_ENABLED(grpc_status_details_trace);
+  if (!debug_annotations && location.file() == nullptr && children.empty()) {
+    // Nothing to attach: serve the common (code, message) pairs that
+    // dominate hot error paths from the intern table instead of
+    // allocating a fresh representation every time.
+    return StatusIntern(code, msg);
+  }
   absl::Status s(code, msg);
   if (location.file() != nullptr) {
     StatusSetStr(&s, StatusStrProperty::kFile, location.file());
@@ -176,7 +225,9 @@ absl::Status StatusCreate(absl::StatusCode code, absl::string_view msg,
   if (location.line() != -1) {
     StatusSetInt(&s, StatusIntProperty::kFileLine, location.line());
   }
-  StatusSetTime(&s, StatusTimeProperty::kCreated, absl::Now());
+  if (debug_annotations) {
+    StatusSetTime(&s, StatusTimeProperty::kCreated, absl::Now());
+  }
   for (const absl::Status& child : children) {
     if (!child.ok()) {
       StatusAddChild(&s, child);
@@ -185,6 +236,14 @@ absl::Status StatusCreate(absl::StatusCode code, absl::string_view msg,
   return s;
 }
 
+absl::Status StatusIntern(absl::StatusCode code, absl::string_view msg) {
+  // A very long message is unlikely to repeat exactly, and interning it
+  // would pin it for the lifetime of the process.
+  constexpr size_t kMaxInternedMessageLength = 256;
+  if (msg.size() > kMaxInternedMessageLength) return absl::Status(code, msg);
+  return NoDestructSingleton<StatusInternTable>::Get()->Intern(code, msg);
+}
+
 void StatusSetInt(absl::Status* status, StatusIntProperty key, intptr_t value) {
   status->SetPayload(GetStatusIntPropertyUrl(key),
                      absl::Cord(std::to_string(value)));
@@ -31,6 +31,7 @@
 #include "absl/time/time.h"
 #include "absl/types/optional.h"
 
+#include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gprpp/debug_location.h"
 
 extern "C" {
@@ -46,6 +47,11 @@ struct upb_Arena;
 
 namespace grpc_core {
 
+/// Controls whether StatusCreate attaches debug annotations (creation site
+/// and time) to the statuses it builds.  These allocate payload cords on
+/// every error, so they are materialized only when this tracer is enabled.
+extern TraceFlag grpc_status_details_trace;
+
 /// This enum should have the same value of grpc_error_ints
 // TODO(veblush): Use camel-case names once migration to absl::Status is done.
 enum class StatusIntProperty {
@@ -122,6 +128,16 @@ absl::Status StatusCreate(
     absl::StatusCode code, absl::string_view msg, const DebugLocation& location,
     std::vector<absl::Status> children) GRPC_MUST_USE_RESULT;
 
+/// Returns a status for a common (code, message) pair without allocating:
+/// the first use of a given pair builds a payload-free singleton that lives
+/// for the lifetime of the process, and subsequent uses return cheap copies
+/// of it.  Intended for ubiquitous statuses on hot error paths (e.g.
+/// UNAVAILABLE on connect failure).  Attaching payloads to the returned
+/// status is safe; it copies the representation and leaves the interned
+/// singleton untouched.
+absl::Status StatusIntern(absl::StatusCode code,
+                          absl::string_view msg) GRPC_MUST_USE_RESULT;
+
 /// Sets the int property to the status
 void StatusSetInt(absl::Status* status, StatusIntProperty key, intptr_t value);
 
@@ -37,6 +37,15 @@ namespace {
 std::atomic<int64_t> g_process_epoch_seconds;
 std::atomic<gpr_cycle_counter> g_process_epoch_cycles;
 
+// Cached coarse clock: a {millis, cycles} snapshot published by whichever
+// thread last refreshed it.  Readers validate the snapshot against the
+// cycle counter and refresh once it is about a millisecond old (Timestamp
+// resolution), so the cache line is read-mostly and a system clock read
+// happens at most around once per millisecond process-wide.
+std::atomic<int64_t> g_coarse_now_millis{0};
+std::atomic<gpr_cycle_counter> g_coarse_now_cycles{};
+std::atomic<double> g_coarse_cycles_per_ms{0};
+
 class GprNowTimeSource final : public Timestamp::Source {
  public:
   Timestamp Now() override {
@@ -145,6 +154,45 @@ int64_t TimespanToMillisRoundDown(gpr_timespec ts) {
 thread_local Timestamp::Source* Timestamp::thread_local_time_source_{
     NoDestructSingleton<GprNowTimeSource>::Get()};
 
+Timestamp Timestamp::NowCoarse() {
+  // Scoped/test time sources override the coarse clock so that cached wall
+  // time never leaks into their controlled timelines.
+  if (thread_local_time_source_ !=
+      NoDestructSingleton<GprNowTimeSource>::Get()) {
+    return Now();
+  }
+  const gpr_cycle_counter now_cycles = gpr_get_cycle_counter();
+  const int64_t cached_millis =
+      g_coarse_now_millis.load(std::memory_order_relaxed);
+  if (cached_millis != 0) {
+    const gpr_cycle_counter cached_cycles =
+        g_coarse_now_cycles.load(std::memory_order_relaxed);
+    const double cycles_per_ms =
+        g_coarse_cycles_per_ms.load(std::memory_order_relaxed);
+    if (cycles_per_ms > 0 &&
+        static_cast<double>(now_cycles - cached_cycles) < cycles_per_ms) {
+      return FromMillisecondsAfterProcessEpoch(cached_millis);
+    }
+  }
+  // Stale (or never initialized): take a precise reading and publish it.
+  const Timestamp now = Now();
+  const int64_t now_millis = now.milliseconds_after_process_epoch();
+  if (cached_millis != 0 && now_millis > cached_millis) {
+    const gpr_cycle_counter cached_cycles =
+        g_coarse_now_cycles.load(std::memory_order_relaxed);
+    // Refine the cycle rate estimate from the elapsed interval.  Races
+    // between refreshing threads are benign: the estimate only bounds
+    // staleness, it is not a correctness input.
+    g_coarse_cycles_per_ms.store(
+        static_cast<double>(now_cycles - cached_cycles) /
+            static_cast<double>(now_millis - cached_millis),
+        std::memory_order_relaxed);
+  }
+  g_coarse_now_cycles.store(now_cycles, std::memory_order_relaxed);
+  g_coarse_now_millis.store(now_millis, std::memory_order_relaxed);
+  return now;
+}
+
 Timestamp ScopedTimeCache::Now() {
   if (!cached_time_.has_value()) {
     previous()->InvalidateCache();
@@ -103,6 +103,16 @@ class Timestamp {
 
   static Timestamp Now() { return thread_local_time_source_->Now(); }
 
+  // Returns a timestamp that may lag Now() by up to roughly one millisecond
+  // (Timestamp resolution) but avoids a system clock read on most calls:
+  // a process-wide cached reading is validated against the cycle counter
+  // and refreshed only once it goes stale.  Suitable for deadline checks,
+  // idle tracking, and similar consumers that tolerate coarse precision;
+  // values are not guaranteed monotonic against Now() at millisecond
+  // granularity.  Defers to Now() when a scoped/test time source is
+  // installed on this thread.
+  static Timestamp NowCoarse();
+
   static constexpr Timestamp FromMillisecondsAfterProcessEpoch(int64_t millis) {
     return Timestamp(millis);
   }
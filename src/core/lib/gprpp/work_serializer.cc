@@ -18,6 +18,7 @@
 
 #include "src/core/lib/gprpp/work_serializer.h"
 
+#include <inttypes.h>
 #include <stdint.h>
 
 #include <atomic>
@@ -26,6 +27,7 @@
 #include <utility>
 
 #include <grpc/support/log.h>
+#include <grpc/support/time.h>
 
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gprpp/debug_location.h"
@@ -155,17 +157,26 @@ void WorkSerializer::WorkSerializerImpl::DrainQueue() {
   }
   // Attempt to take ownership of the WorkSerializer. Also increment the queue
   // size as required by `DrainQueueOwned()`.
-  const uint64_t prev_ref_pair =
-      refs_.fetch_add(MakeRefPair(1, 1), std::memory_order_acq_rel);
-  if (GetOwners(prev_ref_pair) == 0) {
-    // We took ownership of the WorkSerializer. Drain the queue.
-    DrainQueueOwned();
-  } else {
-    // Another thread is holding the WorkSerializer, so decrement the ownership
-    // count we just added and queue a no-op callback.
-    refs_.fetch_sub(MakeRefPair(1, 0), std::memory_order_acq_rel);
-    CallbackWrapper* cb_wrapper = new CallbackWrapper([]() {}, DEBUG_LOCATION);
-    queue_.Push(&cb_wrapper->mpscq_node);
+  while (true) {
+    uint64_t prev_ref_pair = refs_.load(std::memory_order_acquire);
+    if (GetOwners(prev_ref_pair) != 0) {
+      // Another thread is holding the WorkSerializer. Every callback scheduled
+      // before this call is already counted in the refs pair, and the owner
+      // keeps draining until the queue is empty, so this wakeup is redundant:
+      // coalesce it instead of queuing a no-op callback.
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_work_serializer_trace)) {
+        gpr_log(GPR_INFO, "  Coalescing wakeup with current owner's drain");
+      }
+      return;
+    }
+    if (refs_.compare_exchange_weak(prev_ref_pair,
+                                    prev_ref_pair + MakeRefPair(1, 1),
+                                    std::memory_order_acq_rel,
+                                    std::memory_order_acquire)) {
+      // We took ownership of the WorkSerializer. Drain the queue.
+      DrainQueueOwned();
+      return;
+    }
   }
 }
 
@@ -173,6 +184,22 @@ void WorkSerializer::WorkSerializerImpl::DrainQueueOwned() {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_work_serializer_trace)) {
     gpr_log(GPR_INFO, "WorkSerializer::DrainQueueOwned() %p", this);
   }
+  // Queue-length / drain-duration telemetry, only collected when tracing so
+  // the drain loop stays allocation- and syscall-free otherwise.
+  const bool tracing = GRPC_TRACE_FLAG_ENABLED(grpc_work_serializer_trace);
+  const gpr_timespec drain_start =
+      tracing ? gpr_now(GPR_CLOCK_MONOTONIC) : gpr_timespec();
+  size_t items_drained = 0;
+  auto log_drain_stats = [&]() {
+    if (tracing) {
+      gpr_timespec elapsed =
+          gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), drain_start);
+      gpr_log(GPR_INFO,
+              "WorkSerializer %p drained %" PRIuPTR " items in %" PRId64 " us",
+              static_cast<void*>(this), items_drained,
+              elapsed.tv_sec * GPR_US_PER_SEC + elapsed.tv_nsec / 1000);
+    }
+  };
   while (true) {
     auto prev_ref_pair = refs_.fetch_sub(MakeRefPair(0, 1));
     // It is possible that while draining the queue, the last callback ended
@@ -181,6 +208,7 @@ void WorkSerializer::WorkSerializerImpl::DrainQueueOwned() {
       if (GRPC_TRACE_FLAG_ENABLED(grpc_work_serializer_trace)) {
         gpr_log(GPR_INFO, "  Queue Drained. Destroying");
       }
+      log_drain_stats();
       delete this;
       return;
     }
@@ -190,6 +218,7 @@ void WorkSerializer::WorkSerializerImpl::DrainQueueOwned() {
       if (refs_.compare_exchange_strong(expected, MakeRefPair(0, 1),
                                         std::memory_order_acq_rel)) {
         // Queue is drained.
+        log_drain_stats();
         return;
       }
       if (GetSize(expected) == 0) {
@@ -197,6 +226,7 @@ void WorkSerializer::WorkSerializerImpl::DrainQueueOwned() {
         if (GRPC_TRACE_FLAG_ENABLED(grpc_work_serializer_trace)) {
           gpr_log(GPR_INFO, "  Queue Drained. Destroying");
         }
+        log_drain_stats();
         delete this;
         return;
       }
@@ -220,6 +250,7 @@ void WorkSerializer::WorkSerializerImpl::DrainQueueOwned() {
     }
     cb_wrapper->callback();
     delete cb_wrapper;
+    ++items_drained;
   }
 }
 
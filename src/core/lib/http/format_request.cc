@@ -36,16 +36,17 @@
 
 #include "src/core/lib/http/httpcli.h"
 
+/* Requests are HTTP/1.1 without "Connection: close", so that servers keep
+   the connection open and it can be parked for reuse by a later request to
+   the same host. */
 static void fill_common_header(const grpc_http_request* request,
                                const char* host, const char* path,
-                               bool connection_close,
                                std::vector<std::string>* buf) {
   buf->push_back(path);
   buf->push_back(" HTTP/1.1\r\n");
   buf->push_back("Host: ");
   buf->push_back(host);
   buf->push_back("\r\n");
-  if (connection_close) buf->push_back("Connection: close\r\n");
   buf->push_back("User-Agent: " GRPC_HTTPCLI_USER_AGENT "\r\n");
   /* user supplied headers */
   for (size_t i = 0; i < request->hdr_count; i++) {
@@ -60,7 +61,7 @@ grpc_slice grpc_httpcli_format_get_request(const grpc_http_request* request,
                                            const char* host, const char* path) {
   std::vector<std::string> out;
   out.push_back("GET ");
-  fill_common_header(request, host, path, true, &out);
+  fill_common_header(request, host, path, &out);
   out.push_back("\r\n");
   std::string req = absl::StrJoin(out, "");
   return grpc_slice_from_copied_buffer(req.data(), req.size());
@@ -71,7 +72,7 @@ grpc_slice grpc_httpcli_format_post_request(const grpc_http_request* request,
                                             const char* path) {
   std::vector<std::string> out;
   out.push_back("POST ");
-  fill_common_header(request, host, path, true, &out);
+  fill_common_header(request, host, path, &out);
   if (request->body != nullptr) {
     bool has_content_type = false;
     for (size_t i = 0; i < request->hdr_count; i++) {
@@ -100,7 +101,7 @@ grpc_slice grpc_httpcli_format_put_request(const grpc_http_request* request,
                                            const char* host, const char* path) {
   std::vector<std::string> out;
   out.push_back("PUT ");
-  fill_common_header(request, host, path, true, &out);
+  fill_common_header(request, host, path, &out);
   if (request->body != nullptr) {
     bool has_content_type = false;
     for (size_t i = 0; i < request->hdr_count; i++) {
@@ -130,7 +131,7 @@ grpc_slice grpc_httpcli_format_connect_request(const grpc_http_request* request,
                                                const char* path) {
   std::vector<std::string> out;
   out.push_back("CONNECT ");
-  fill_common_header(request, host, path, false, &out);
+  fill_common_header(request, host, path, &out);
   out.push_back("\r\n");
   std::string req = absl::StrJoin(out, "");
   return grpc_slice_from_copied_buffer(req.data(), req.size());
@@ -27,6 +27,7 @@
 
 #include "absl/functional/bind_front.h"
 #include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 
 #include <grpc/grpc.h>
@@ -39,6 +40,7 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_args_preconditioning.h"
 #include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
 #include "src/core/lib/http/format_request.h"
 #include "src/core/lib/http/parser.h"
 #include "src/core/lib/iomgr/endpoint.h"
@@ -62,8 +64,108 @@ grpc_httpcli_post_override g_post_override;
 grpc_httpcli_put_override g_put_override;
 void (*g_test_only_on_handshake_done_intercept)(HttpRequest* req);
 
+// How long a warm connection may sit unused before it is evicted.
+const Duration kConnectionCacheIdleTimeout = Duration::Seconds(30);
+// Upper bound on cached connections; the longest-idle one is evicted first.
+const size_t kConnectionCacheMaxSize = 32;
+
+std::string ConnectionCacheKey(
+    const URI& uri, const RefCountedPtr<grpc_channel_credentials>& creds) {
+  // Include the credential type so that, e.g., an insecure request never
+  // reuses a connection that was established with TLS credentials (or vice
+  // versa) for the same authority.
+  return absl::StrCat(
+      uri.scheme(), "://", uri.authority(), "#",
+      creds == nullptr ? "insecure" : creds->type().name());
+}
+
 }  // namespace
 
+//
+// HttpConnectionCache
+//
+
+HttpConnectionCache* HttpConnectionCache::Get() {
+  static HttpConnectionCache* cache =
+      new HttpConnectionCache(kConnectionCacheIdleTimeout);
+  return cache;
+}
+
+HttpConnectionCache::HttpConnectionCache(Duration idle_timeout)
+    : idle_timeout_(idle_timeout) {}
+
+void HttpConnectionCache::Put(std::string key, grpc_endpoint* ep) {
+  std::vector<grpc_endpoint*> evicted;
+  {
+    MutexLock lock(&mu_);
+    SweepLocked(Timestamp::Now(), &evicted);
+    if (connections_.size() >= kConnectionCacheMaxSize) {
+      auto oldest = connections_.begin();
+      for (auto it = connections_.begin(); it != connections_.end(); ++it) {
+        if (it->second.idle_since < oldest->second.idle_since) oldest = it;
+      }
+      evicted.push_back(oldest->second.ep);
+      connections_.erase(oldest);
+    }
+    connections_.emplace(std::move(key), Connection{ep, Timestamp::Now()});
+    MaybeScheduleSweepLocked();
+  }
+  for (grpc_endpoint* evicted_ep : evicted) {
+    grpc_endpoint_destroy(evicted_ep);
+  }
+}
+
+grpc_endpoint* HttpConnectionCache::Take(const std::string& key) {
+  std::vector<grpc_endpoint*> evicted;
+  grpc_endpoint* result = nullptr;
+  {
+    MutexLock lock(&mu_);
+    SweepLocked(Timestamp::Now(), &evicted);
+    auto it = connections_.find(key);
+    if (it != connections_.end()) {
+      result = it->second.ep;
+      connections_.erase(it);
+    }
+  }
+  for (grpc_endpoint* evicted_ep : evicted) {
+    grpc_endpoint_destroy(evicted_ep);
+  }
+  return result;
+}
+
+void HttpConnectionCache::SweepLocked(Timestamp now,
+                                      std::vector<grpc_endpoint*>* evicted) {
+  for (auto it = connections_.begin(); it != connections_.end();) {
+    if (now - it->second.idle_since >= idle_timeout_) {
+      evicted->push_back(it->second.ep);
+      it = connections_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void HttpConnectionCache::MaybeScheduleSweepLocked() {
+  if (sweep_scheduled_ || connections_.empty()) return;
+  sweep_scheduled_ = true;
+  // Capturing the engine keeps it alive until the sweep has run.
+  auto engine = grpc_event_engine::experimental::GetDefaultEventEngine();
+  engine->RunAfter(idle_timeout_, [this, engine]() {
+    ApplicationCallbackExecCtx callback_exec_ctx;
+    ExecCtx exec_ctx;
+    std::vector<grpc_endpoint*> evicted;
+    {
+      MutexLock lock(&mu_);
+      sweep_scheduled_ = false;
+      SweepLocked(Timestamp::Now(), &evicted);
+      MaybeScheduleSweepLocked();
+    }
+    for (grpc_endpoint* evicted_ep : evicted) {
+      grpc_endpoint_destroy(evicted_ep);
+    }
+  });
+}
+
 OrphanablePtr<HttpRequest> HttpRequest::Get(
     URI uri, const grpc_channel_args* channel_args,
     grpc_polling_entity* pollent, const grpc_http_request* request,
@@ -166,6 +268,7 @@ HttpRequest::HttpRequest(
                         .ToC()
                         .release()),
       channel_creds_(std::move(channel_creds)),
+      connection_cache_key_(ConnectionCacheKey(uri_, channel_creds_)),
       on_done_(on_done),
       resource_quota_(ResourceQuotaFromChannelArgs(channel_args_)),
       pollent_(pollent),
@@ -207,6 +310,21 @@ void HttpRequest::Start() {
     test_only_generate_response_.value()();
     return;
   }
+  // Try to reuse a warm connection from a previous keepalive request to
+  // this host before paying for DNS resolution and a fresh handshake.
+  grpc_endpoint* cached =
+      HttpConnectionCache::Get()->Take(connection_cache_key_);
+  if (cached != nullptr) {
+    ep_ = cached;
+    reused_endpoint_ = true;
+    grpc_endpoint_add_to_pollset_set(ep_, pollset_set_);
+    StartWrite();
+    return;
+  }
+  StartResolve();
+}
+
+void HttpRequest::StartResolve() {
   Ref().release();  // ref held by pending DNS resolution
   dns_request_handle_ = resolver_->LookupHostname(
       absl::bind_front(&HttpRequest::OnResolved, this), uri_.authority(),
@@ -268,6 +386,12 @@ void HttpRequest::OnReadInternal(grpc_error_handle error) {
   if (cancelled_) {
     Finish(GRPC_ERROR_CREATE_REFERENCING_FROM_STATIC_STRING(
         "HTTP1 request cancelled during read", &overall_error_, 1));
+  } else if (parser_.state == GRPC_HTTP_END) {
+    // The response was fully framed (Content-Length or chunked encoding),
+    // so the connection is still usable: park it for the next request to
+    // this host instead of waiting for the server to close it.
+    if (error.ok()) MaybeCacheEndpointLocked();
+    Finish(absl::OkStatus());
   } else if (error.ok()) {
     DoRead();
   } else if (!have_read_byte_) {
@@ -277,6 +401,13 @@ void HttpRequest::OnReadInternal(grpc_error_handle error) {
   }
 }
 
+void HttpRequest::MaybeCacheEndpointLocked() {
+  if (ep_ == nullptr || !own_endpoint_) return;
+  grpc_endpoint_delete_from_pollset_set(ep_, pollset_set_);
+  HttpConnectionCache::Get()->Put(connection_cache_key_, ep_);
+  ep_ = nullptr;
+}
+
 void HttpRequest::ContinueDoneWriteAfterScheduleOnExecCtx(
     void* arg, grpc_error_handle error) {
   RefCountedPtr<HttpRequest> req(static_cast<HttpRequest*>(arg));
@@ -357,6 +488,23 @@ void HttpRequest::DoHandshake(const grpc_resolved_address* addr) {
 }
 
 void HttpRequest::NextAddress(grpc_error_handle error) {
+  if (reused_endpoint_) {
+    // The cached connection was closed (or otherwise failed) before any
+    // response byte arrived -- most likely the server dropped it while it
+    // sat idle. Fall back to establishing a fresh connection.
+    reused_endpoint_ = false;
+    if (own_endpoint_ && ep_ != nullptr) {
+      grpc_endpoint_destroy(ep_);
+      ep_ = nullptr;
+    }
+    if (cancelled_) {
+      Finish(GRPC_ERROR_CREATE_REFERENCING_FROM_STATIC_STRING(
+          "HTTP request was cancelled", &overall_error_, 1));
+      return;
+    }
+    StartResolve();
+    return;
+  }
   if (!error.ok()) {
     AppendError(error);
   }
@@ -24,7 +24,9 @@
 #include <stddef.h>
 
 #include <functional>
+#include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "absl/base/thread_annotations.h"
@@ -75,6 +77,46 @@ typedef int (*grpc_httpcli_put_override)(
 
 namespace grpc_core {
 
+// A small cache of warm connections to HTTP servers, keyed by scheme,
+// authority and credential type. A request whose response was fully framed
+// (Content-Length or chunked encoding) parks its connection here, and a
+// later request to the same host reuses it, skipping DNS resolution and the
+// TCP+TLS handshake. Connections idle for longer than the idle timeout are
+// evicted.
+class HttpConnectionCache {
+ public:
+  // Returns the process-wide cache instance.
+  static HttpConnectionCache* Get();
+
+  explicit HttpConnectionCache(Duration idle_timeout);
+
+  // Hands a connected endpoint to the cache, transferring ownership. The
+  // endpoint must have no pending reads or writes and must already be
+  // detached from any pollset_set.
+  void Put(std::string key, grpc_endpoint* ep);
+
+  // Returns an endpoint previously Put() under key, transferring ownership
+  // to the caller, or nullptr if none is cached.
+  grpc_endpoint* Take(const std::string& key);
+
+ private:
+  struct Connection {
+    grpc_endpoint* ep;
+    Timestamp idle_since;
+  };
+
+  // Moves expired connections into *evicted; the caller destroys them after
+  // releasing mu_, since endpoint destruction may run arbitrary closures.
+  void SweepLocked(Timestamp now, std::vector<grpc_endpoint*>* evicted)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void MaybeScheduleSweepLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  const Duration idle_timeout_;
+  Mutex mu_;
+  std::multimap<std::string, Connection> connections_ ABSL_GUARDED_BY(mu_);
+  bool sweep_scheduled_ ABSL_GUARDED_BY(mu_) = false;
+};
+
 // Tracks an in-progress GET or POST request. Calling \a Start()
 // begins async work and calling \a Orphan() arranges for async work
 // to be completed as sooon as possible (possibly aborting the request
@@ -232,14 +274,20 @@ class HttpRequest : public InternallyRefCounted<HttpRequest> {
 
   void NextAddress(grpc_error_handle error) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
+  void StartResolve() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
   void OnResolved(
       absl::StatusOr<std::vector<grpc_resolved_address>> addresses_or);
 
+  // Parks the connection in the HttpConnectionCache if we still own it.
+  void MaybeCacheEndpointLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
   const URI uri_;
   const grpc_slice request_text_;
   const Timestamp deadline_;
   const grpc_channel_args* channel_args_;
   RefCountedPtr<grpc_channel_credentials> channel_creds_;
+  const std::string connection_cache_key_;
   grpc_closure on_read_;
   grpc_closure continue_on_read_after_schedule_on_exec_ctx_;
   grpc_closure done_write_;
@@ -254,6 +302,10 @@ class HttpRequest : public InternallyRefCounted<HttpRequest> {
   RefCountedPtr<HandshakeManager> handshake_mgr_ ABSL_GUARDED_BY(mu_);
   bool own_endpoint_ ABSL_GUARDED_BY(mu_) = true;
   bool cancelled_ ABSL_GUARDED_BY(mu_) = false;
+  // True while using a connection taken from the HttpConnectionCache; if it
+  // fails before any response byte arrives (e.g. the server closed it while
+  // idle), we fall back to establishing a fresh connection.
+  bool reused_endpoint_ ABSL_GUARDED_BY(mu_) = false;
   grpc_http_parser parser_ ABSL_GUARDED_BY(mu_);
   std::vector<grpc_resolved_address> addresses_ ABSL_GUARDED_BY(mu_);
   size_t next_address_ ABSL_GUARDED_BY(mu_) = 0;
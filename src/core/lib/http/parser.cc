@@ -220,6 +220,19 @@ static grpc_error_handle add_header(grpc_http_parser* parser) {
       if ((strcmp(hdr.key, "Transfer-Encoding") == 0) &&
           (strcmp(hdr.value, "chunked") == 0)) {
         parser->http.response->chunked_state = GRPC_HTTP_CHUNKED_LENGTH;
+      } else if (strcmp(hdr.key, "Content-Length") == 0) {
+        parser->http.response->has_content_length = true;
+        parser->http.response->content_length = 0;
+        for (const char* p = hdr.value; *p != 0; p++) {
+          if (*p < '0' || *p > '9') {
+            /* Malformed value: fall back to close-delimited framing. */
+            parser->http.response->has_content_length = false;
+            break;
+          }
+          parser->http.response->content_length =
+              parser->http.response->content_length * 10 +
+              static_cast<size_t>(*p - '0');
+        }
       }
       break;
     case GRPC_HTTP_REQUEST:
@@ -259,6 +272,12 @@ static grpc_error_handle finish_line(grpc_http_parser* parser,
         if (parser->state == GRPC_HTTP_HEADERS) {
           parser->state = GRPC_HTTP_BODY;
           *found_body_start = true;
+          if (parser->type == GRPC_HTTP_RESPONSE &&
+              parser->http.response->chunked_state == GRPC_HTTP_CHUNKED_PLAIN &&
+              parser->http.response->has_content_length &&
+              parser->http.response->content_length == 0) {
+            parser->state = GRPC_HTTP_END;
+          }
         } else {
           parser->state = GRPC_HTTP_END;
         }
@@ -355,6 +374,13 @@ static grpc_error_handle addbyte_body(grpc_http_parser* parser, uint8_t byte) {
   (*body)[*body_length] = static_cast<char>(byte);
   (*body_length)++;
 
+  if (parser->type == GRPC_HTTP_RESPONSE &&
+      parser->http.response->chunked_state == GRPC_HTTP_CHUNKED_PLAIN &&
+      parser->http.response->has_content_length &&
+      *body_length == parser->http.response->content_length) {
+    parser->state = GRPC_HTTP_END;
+  }
+
   return absl::OkStatus();
 }
 
@@ -90,6 +90,11 @@ typedef struct grpc_http_response {
   grpc_http_header* hdrs = nullptr;
   /* Body: length and contents; contents are NOT null-terminated */
   size_t body_length = 0;
+  /* Content-Length parsed from the headers, if present. When set (and the
+     response is not chunked) the parser reaches GRPC_HTTP_END once the body
+     is complete, without needing the connection to close. */
+  bool has_content_length = false;
+  size_t content_length = 0;
   /* State of the chunked parser. Only valid for the response. */
   grpc_http_parser_chunked_state chunked_state = GRPC_HTTP_CHUNKED_PLAIN;
   size_t chunk_length = 0;
@@ -46,7 +46,6 @@ grpc_error_handle DecodeCancelStateError(gpr_atm cancel_state) {
 
 CallCombiner::CallCombiner() {
   gpr_atm_no_barrier_store(&cancel_state_, 0);
-  gpr_atm_no_barrier_store(&size_, 0);
 #ifdef GRPC_TSAN_ENABLED
   GRPC_CLOSURE_INIT(&tsan_closure_, TsanClosure, this,
                     grpc_schedule_on_exec_ctx);
@@ -120,12 +119,12 @@ void CallCombiner::Start(grpc_closure* closure, grpc_error_handle error,
             grpc_error_std_string(error).c_str());
   }
   size_t prev_size =
-      static_cast<size_t>(gpr_atm_full_fetch_add(&size_, (gpr_atm)1));
+      static_cast<size_t>(size_.fetch_add(1, std::memory_order_acq_rel));
   if (GRPC_TRACE_FLAG_ENABLED(grpc_call_combiner_trace)) {
     gpr_log(GPR_INFO, "  size: %" PRIdPTR " -> %" PRIdPTR, prev_size,
             prev_size + 1);
   }
-  if (prev_size == 0) {
+  if (GPR_LIKELY(prev_size == 0)) {
     if (GRPC_TRACE_FLAG_ENABLED(grpc_call_combiner_trace)) {
       gpr_log(GPR_INFO, "  EXECUTING IMMEDIATELY");
     }
@@ -148,13 +147,13 @@ void CallCombiner::Stop(DEBUG_ARGS const char* reason) {
             this DEBUG_FMT_ARGS, reason);
   }
   size_t prev_size =
-      static_cast<size_t>(gpr_atm_full_fetch_add(&size_, (gpr_atm)-1));
+      static_cast<size_t>(size_.fetch_sub(1, std::memory_order_acq_rel));
   if (GRPC_TRACE_FLAG_ENABLED(grpc_call_combiner_trace)) {
     gpr_log(GPR_INFO, "  size: %" PRIdPTR " -> %" PRIdPTR, prev_size,
             prev_size - 1);
   }
   GPR_ASSERT(prev_size >= 1);
-  if (prev_size > 1) {
+  if (GPR_UNLIKELY(prev_size > 1)) {
     while (true) {
       if (GRPC_TRACE_FLAG_ENABLED(grpc_call_combiner_trace)) {
         gpr_log(GPR_INFO, "  checking queue");
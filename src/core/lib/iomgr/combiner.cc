@@ -27,6 +27,7 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
+#include "src/core/lib/debug/stats.h"
 #include "src/core/lib/gprpp/mpscq.h"
 #include "src/core/lib/iomgr/executor.h"
 #include "src/core/lib/iomgr/iomgr_internal.h"
@@ -43,6 +44,12 @@ grpc_core::DebugOnlyTraceFlag grpc_combiner_trace(false, "combiner");
 #define STATE_UNORPHANED 1
 #define STATE_ELEM_COUNT_LOW_BIT 2
 
+// Maximum number of closures a combiner will run while holding its exec ctx's
+// attention before yielding to other combiners queued on the same exec ctx.
+// Bounds the latency a busy combiner can impose on its neighbours without
+// paying for a thread hop through the executor.
+#define COMBINER_QUANTUM_ELEMS 32
+
 static void combiner_exec(grpc_core::Combiner* lock, grpc_closure* closure,
                           grpc_error_handle error);
 static void combiner_finally_exec(grpc_core::Combiner* lock,
@@ -57,6 +64,7 @@ grpc_core::Combiner* grpc_combiner_create(void) {
   gpr_atm_no_barrier_store(&lock->state, STATE_UNORPHANED);
   grpc_closure_list_init(&lock->final_list);
   GRPC_CLOSURE_INIT(&lock->offload, offload, lock, nullptr);
+  GRPC_STATS_INC_COMBINER_LOCKS_CREATED();
   GRPC_COMBINER_TRACE(gpr_log(GPR_INFO, "C:%p create", lock));
   return lock;
 }
@@ -127,6 +135,8 @@ static void push_first_on_exec_ctx(grpc_core::Combiner* lock) {
 static void combiner_exec(grpc_core::Combiner* lock, grpc_closure* cl,
                           grpc_error_handle error) {
   gpr_atm last = gpr_atm_full_fetch_add(&lock->state, STATE_ELEM_COUNT_LOW_BIT);
+  GRPC_STATS_INC_COMBINER_LOCKS_SCHEDULED_ITEMS();
+  GRPC_STATS_INC_COMBINER_QUEUE_DEPTH(last >> 1);
   GRPC_COMBINER_TRACE(gpr_log(GPR_INFO,
                               "C:%p grpc_combiner_execute c=%p last=%" PRIdPTR,
                               lock, cl, last));
@@ -170,6 +180,8 @@ static void offload(void* arg, grpc_error_handle /*error*/) {
 
 static void queue_offload(grpc_core::Combiner* lock) {
   move_next();
+  lock->elems_this_quantum = 0;
+  GRPC_STATS_INC_COMBINER_LOCKS_OFFLOADED();
   GRPC_COMBINER_TRACE(gpr_log(GPR_INFO, "C:%p queue_offload", lock));
   grpc_core::Executor::Run(&lock->offload, absl::OkStatus());
 }
@@ -228,6 +240,7 @@ bool grpc_combiner_continue_exec_ctx() {
         grpc_core::internal::StatusMoveFromHeapPtr(cl->error_data.error);
     cl->error_data.error = 0;
     cl->cb(cl->cb_arg, std::move(cl_err));
+    lock->elems_this_quantum++;
   } else {
     grpc_closure* c = lock->final_list.head;
     GPR_ASSERT(c != nullptr);
@@ -244,6 +257,7 @@ bool grpc_combiner_continue_exec_ctx() {
           grpc_core::internal::StatusMoveFromHeapPtr(c->error_data.error);
       c->error_data.error = 0;
       c->cb(c->cb_arg, std::move(error));
+      lock->elems_this_quantum++;
       c = next;
     }
   }
@@ -273,6 +287,7 @@ bool grpc_combiner_continue_exec_ctx() {
       break;
     case OLD_STATE_WAS(false, 1):
       // had one count, one unorphaned --> unlocked unorphaned
+      lock->elems_this_quantum = 0;
       return true;
     case OLD_STATE_WAS(true, 1):
       // and one count, one orphaned --> unlocked and orphaned
@@ -284,7 +299,19 @@ bool grpc_combiner_continue_exec_ctx() {
       // deleted lock
       GPR_UNREACHABLE_CODE(return true);
   }
-  push_first_on_exec_ctx(lock);
+  if (lock->elems_this_quantum >= COMBINER_QUANTUM_ELEMS &&
+      grpc_core::ExecCtx::Get()->combiner_data()->active_combiner != nullptr) {
+    // This combiner has used up its run quantum and other combiners are
+    // waiting on this exec ctx: rotate to the back of the line so they get a
+    // turn. This stays on the current thread - unlike the executor offload
+    // above it costs no thread hop - it just bounds how long one busy
+    // combiner can starve its neighbours.
+    lock->elems_this_quantum = 0;
+    GRPC_STATS_INC_COMBINER_LOCKS_YIELDED();
+    push_last_on_exec_ctx(lock);
+  } else {
+    push_first_on_exec_ctx(lock);
+  }
   return true;
 }
 
@@ -47,6 +47,9 @@ class Combiner {
   // lower bit - zero if orphaned (STATE_UNORPHANED)
   // other bits - number of items queued on the lock (STATE_ELEM_COUNT_LOW_BIT)
   gpr_atm state;
+  // number of closures executed in the current run quantum; only touched by
+  // the thread currently draining the combiner, so no synchronization needed
+  size_t elems_this_quantum = 0;
   bool time_to_execute_final_list = false;
   grpc_closure_list final_list;
   grpc_closure offload;
@@ -20,6 +20,17 @@
 
 #include "src/core/lib/iomgr/endpoint.h"
 
+#include "src/core/lib/iomgr/port.h"
+
+#ifdef GRPC_LINUX_ERRQUEUE
+#include <netinet/in.h>
+#include <stddef.h>
+#include <string.h>
+#include <sys/socket.h>
+
+#include "src/core/lib/iomgr/internal_errqueue.h"
+#endif /* GRPC_LINUX_ERRQUEUE */
+
 grpc_core::TraceFlag grpc_tcp_trace(false, "tcp");
 
 void grpc_endpoint_read(grpc_endpoint* ep, grpc_slice_buffer* slices,
@@ -28,8 +39,9 @@ void grpc_endpoint_read(grpc_endpoint* ep, grpc_slice_buffer* slices,
 }
 
 void grpc_endpoint_write(grpc_endpoint* ep, grpc_slice_buffer* slices,
-                         grpc_closure* cb, void* arg, int max_frame_size) {
-  ep->vtable->write(ep, slices, cb, arg, max_frame_size);
+                         grpc_closure* cb, void* arg, int max_frame_size,
+                         bool more_coming) {
+  ep->vtable->write(ep, slices, cb, arg, max_frame_size, more_coming);
 }
 
 void grpc_endpoint_add_to_pollset(grpc_endpoint* ep, grpc_pollset* pollset) {
@@ -65,3 +77,30 @@ int grpc_endpoint_get_fd(grpc_endpoint* ep) { return ep->vtable->get_fd(ep); }
 bool grpc_endpoint_can_track_err(grpc_endpoint* ep) {
   return ep->vtable->can_track_err(ep);
 }
+
+bool grpc_endpoint_get_tcp_stats(grpc_endpoint* ep,
+                                 grpc_endpoint_tcp_stats* stats) {
+#ifdef GRPC_LINUX_ERRQUEUE
+  int fd = grpc_endpoint_get_fd(ep);
+  if (fd < 0) return false;
+  grpc_core::tcp_info info;
+  memset(&info, 0, sizeof(info));
+  info.length = offsetof(grpc_core::tcp_info, length);
+  if (getsockopt(fd, IPPROTO_TCP, TCP_INFO, &info, &info.length) != 0) {
+    return false;
+  }
+  stats->rtt_usec = info.tcpi_rtt;
+  stats->total_retransmits = info.tcpi_total_retrans;
+  stats->congestion_window_packets = info.tcpi_snd_cwnd;
+  /* tcpi_delivery_rate was added in linux 4.9; only trust it if the kernel
+     filled that far into the struct. */
+  if (info.length > offsetof(grpc_core::tcp_info, tcpi_delivery_rate)) {
+    stats->delivery_rate_bytes_per_sec = info.tcpi_delivery_rate;
+  }
+  return true;
+#else
+  (void)ep;
+  (void)stats;
+  return false;
+#endif /* GRPC_LINUX_ERRQUEUE */
+}
@@ -21,6 +21,8 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stdint.h>
+
 #include "absl/strings/string_view.h"
 
 #include <grpc/slice.h>
@@ -40,7 +42,7 @@ struct grpc_endpoint_vtable {
   void (*read)(grpc_endpoint* ep, grpc_slice_buffer* slices, grpc_closure* cb,
                bool urgent, int min_progress_size);
   void (*write)(grpc_endpoint* ep, grpc_slice_buffer* slices, grpc_closure* cb,
-                void* arg, int max_frame_size);
+                void* arg, int max_frame_size, bool more_coming);
   void (*add_to_pollset)(grpc_endpoint* ep, grpc_pollset* pollset);
   void (*add_to_pollset_set)(grpc_endpoint* ep, grpc_pollset_set* pollset);
   void (*delete_from_pollset_set)(grpc_endpoint* ep, grpc_pollset_set* pollset);
@@ -81,9 +83,17 @@ int grpc_endpoint_get_fd(grpc_endpoint* ep);
    platforms as an argument that would be forwarded to the timestamps callback.
    \a max_frame_size. A hint to the endpoint implementation to construct
    frames which do not exceed the specified size.
+   \a more_coming. A hint that the caller will promptly issue another write
+   once this one completes. TCP endpoints use it to ask the kernel to hold
+   partial trailing packets (MSG_MORE) so that back-to-back writes do not
+   emit avoidable small packets. The kernel bounds how long held bytes wait,
+   so a caller that hints more data and never sends it costs latency but not
+   correctness; callers should only pass true when a follow-up write is
+   already queued.
    */
 void grpc_endpoint_write(grpc_endpoint* ep, grpc_slice_buffer* slices,
-                         grpc_closure* cb, void* arg, int max_frame_size);
+                         grpc_closure* cb, void* arg, int max_frame_size,
+                         bool more_coming = false);
 
 /* Causes any pending and future read/write callbacks to run immediately with
    success==0 */
@@ -102,6 +112,27 @@ void grpc_endpoint_delete_from_pollset_set(grpc_endpoint* ep,
 
 bool grpc_endpoint_can_track_err(grpc_endpoint* ep);
 
+/* Kernel-level connection stats sampled from TCP_INFO for an endpoint that is
+   backed by a TCP socket. All values are as reported by the kernel at the
+   time of the sample. */
+struct grpc_endpoint_tcp_stats {
+  /* Smoothed round trip time, in microseconds. */
+  uint64_t rtt_usec = 0;
+  /* Total number of segments retransmitted over the connection lifetime. */
+  uint64_t total_retransmits = 0;
+  /* Most recent delivery rate estimate, in bytes per second. Zero if the
+     kernel does not report one. */
+  uint64_t delivery_rate_bytes_per_sec = 0;
+  /* Congestion window, in packets. */
+  uint64_t congestion_window_packets = 0;
+};
+
+/* Sample TCP_INFO for \a ep into \a stats. Returns false if the endpoint is
+   not backed by a file descriptor or the platform does not support the
+   query; \a stats is unmodified in that case. */
+bool grpc_endpoint_get_tcp_stats(grpc_endpoint* ep,
+                                 grpc_endpoint_tcp_stats* stats);
+
 struct grpc_endpoint {
   const grpc_endpoint_vtable* vtable;
 };
@@ -125,6 +125,15 @@ grpc_error_handle grpc_error_set_int(grpc_error_handle src,
   return src;
 }
 
+grpc_error_handle grpc_error_cancelled() {
+  static const absl::Status* const kCancelled = [] {
+    return new absl::Status(grpc_error_set_int(absl::CancelledError(),
+                                               GRPC_ERROR_INT_GRPC_STATUS,
+                                               GRPC_STATUS_CANCELLED));
+  }();
+  return *kCancelled;
+}
+
 bool grpc_error_get_int(grpc_error_handle error, grpc_error_ints which,
                         intptr_t* p) {
   absl::optional<intptr_t> value = grpc_core::StatusGetInt(
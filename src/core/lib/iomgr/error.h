@@ -147,6 +147,12 @@ void grpc_enable_error_creation();
 #define GRPC_ERROR_OOM absl::Status(absl::ResourceExhaustedError(""))
 #define GRPC_ERROR_CANCELLED absl::CancelledError()
 
+/// Returns a process-lifetime interned CANCELLED status with the
+/// GRPC_ERROR_INT_GRPC_STATUS payload already attached. Copying the result
+/// only bumps a refcount, so hot cancellation paths avoid rebuilding the
+/// payload chain for every cancelled stream.
+grpc_error_handle grpc_error_cancelled();
+
 // Deprecated: Please do not use these macros.
 // These will be removed once migration is done.
 #define GRPC_ERROR_REF(err) (err)
@@ -49,6 +49,7 @@
 #include "src/core/lib/debug/stats.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/global_config.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
 #include "src/core/lib/iomgr/block_annotate.h"
 #include "src/core/lib/iomgr/ev_epoll1_linux.h"
@@ -57,8 +58,17 @@
 #include "src/core/lib/iomgr/lockfree_event.h"
 #include "src/core/lib/iomgr/wakeup_fd_posix.h"
 
+GPR_GLOBAL_CONFIG_DEFINE_INT32(
+    grpc_epoll_busy_poll_usec, 0,
+    "How many microseconds the designated poller spins on epoll_wait with a "
+    "zero timeout before blocking, trading CPU for wakeup latency. 0 (the "
+    "default) disables busy polling.");
+
 static grpc_wakeup_fd global_wakeup_fd;
 
+/* busy-poll burn budget, cached from the config at poller init */
+static int g_busy_poll_usec = 0;
+
 /*******************************************************************************
  * Singleton epoll set related fields
  */
@@ -119,6 +129,7 @@ static bool epoll_set_init() {
   gpr_log(GPR_INFO, "grpc epoll fd: %d", g_epoll_set.epfd);
   gpr_atm_no_barrier_store(&g_epoll_set.num_events, 0);
   gpr_atm_no_barrier_store(&g_epoll_set.cursor, 0);
+  g_busy_poll_usec = GPR_GLOBAL_CONFIG_GET(grpc_epoll_busy_poll_usec);
   return true;
 }
 
@@ -701,17 +712,33 @@ static grpc_error_handle process_epoll_events(grpc_pollset* /*pollset*/) {
    no need for any synchronization when accesing fields in g_epoll_set */
 static grpc_error_handle do_epoll_wait(grpc_pollset* ps,
                                        grpc_core::Timestamp deadline) {
-  int r;
+  int r = 0;
   int timeout = poll_deadline_to_millis_timeout(deadline);
-  if (timeout != 0) {
-    GRPC_SCHEDULING_START_BLOCKING_REGION;
+  if (timeout != 0 && g_busy_poll_usec > 0) {
+    /* Latency mode: burn a bounded CPU budget spinning with a zero timeout
+       before blocking, avoiding the scheduler wakeup hop for events that
+       arrive within the budget. Kicks are visible to the spin via the wakeup
+       fd. */
+    const gpr_timespec spin_deadline =
+        gpr_time_add(gpr_now(GPR_CLOCK_MONOTONIC),
+                     gpr_time_from_micros(g_busy_poll_usec, GPR_TIMESPAN));
+    do {
+      r = epoll_wait(g_epoll_set.epfd, g_epoll_set.events, MAX_EPOLL_EVENTS, 0);
+    } while ((r == 0 || (r < 0 && errno == EINTR)) &&
+             gpr_time_cmp(gpr_now(GPR_CLOCK_MONOTONIC), spin_deadline) < 0);
+    if (r < 0 && errno == EINTR) r = 0;
   }
-  do {
-    r = epoll_wait(g_epoll_set.epfd, g_epoll_set.events, MAX_EPOLL_EVENTS,
-                   timeout);
-  } while (r < 0 && errno == EINTR);
-  if (timeout != 0) {
-    GRPC_SCHEDULING_END_BLOCKING_REGION;
+  if (r == 0) {
+    if (timeout != 0) {
+      GRPC_SCHEDULING_START_BLOCKING_REGION;
+    }
+    do {
+      r = epoll_wait(g_epoll_set.epfd, g_epoll_set.events, MAX_EPOLL_EVENTS,
+                     timeout);
+    } while (r < 0 && errno == EINTR);
+    if (timeout != 0) {
+      GRPC_SCHEDULING_END_BLOCKING_REGION;
+    }
   }
 
   if (r < 0) return GRPC_OS_ERROR(errno, "epoll_wait");
@@ -31,6 +31,7 @@
 #include <grpc/support/string_util.h>
 
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/global_config.h"
 #include "src/core/lib/iomgr/ev_epoll1_linux.h"
@@ -350,12 +351,16 @@ grpc_pollset_set_vtable grpc_posix_pollset_set_vtable = {
 void grpc_pollset_set_add_fd(grpc_pollset_set* pollset_set, grpc_fd* fd) {
   GRPC_POLLING_API_TRACE("pollset_set_add_fd(%p, %d)", pollset_set,
                          grpc_fd_wrapped_fd(fd));
+  /* With elide_pollset_set the pollset_set is a sentinel from the no-op
+     vtable, not an event-engine object: never hand it to the poller. */
+  if (grpc_core::IsElidePollsetSetEnabled()) return;
   g_event_engine->pollset_set_add_fd(pollset_set, fd);
 }
 
 void grpc_pollset_set_del_fd(grpc_pollset_set* pollset_set, grpc_fd* fd) {
   GRPC_POLLING_API_TRACE("pollset_set_del_fd(%p, %d)", pollset_set,
                          grpc_fd_wrapped_fd(fd));
+  if (grpc_core::IsElidePollsetSetEnabled()) return;
   g_event_engine->pollset_set_del_fd(pollset_set, fd);
 }
 
@@ -23,9 +23,22 @@
 #include <grpc/support/log.h>
 #include <grpc/support/sync.h>
 
+#include "src/core/lib/debug/stats.h"
 #include "src/core/lib/iomgr/combiner.h"
 #include "src/core/lib/iomgr/error.h"
 
+// Pull the given closure's dispatch state (next pointer, cb, cb_arg) into
+// cache. The flush loop below is otherwise a chain of dependent loads
+// (closure -> cb/cb_arg -> callee), so warming the next closure while the
+// current callback runs hides most of the per-closure dispatch latency.
+static void exec_ctx_prefetch(grpc_closure* closure) {
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(closure, /*rw=*/0, /*locality=*/3);
+#else
+  (void)closure;
+#endif
+}
+
 static void exec_ctx_run(grpc_closure* closure) {
 #ifndef NDEBUG
   closure->scheduled = false;
@@ -59,13 +72,16 @@ thread_local ApplicationCallbackExecCtx*
 
 bool ExecCtx::Flush() {
   bool did_something = false;
+  size_t closures_run = 0;
   for (;;) {
     if (!grpc_closure_list_empty(closure_list_)) {
       grpc_closure* c = closure_list_.head;
       closure_list_.head = closure_list_.tail = nullptr;
       while (c != nullptr) {
         grpc_closure* next = c->next_data.next;
+        if (next != nullptr) exec_ctx_prefetch(next);
         did_something = true;
+        ++closures_run;
         exec_ctx_run(c);
         c = next;
       }
@@ -74,6 +90,10 @@ bool ExecCtx::Flush() {
     }
   }
   GPR_ASSERT(combiner_data_.active_combiner == nullptr);
+  if (did_something) {
+    GRPC_STATS_INC_EXEC_CTX_FLUSHES();
+    GRPC_STATS_INC_CLOSURES_PER_FLUSH(closures_run);
+  }
   return did_something;
 }
 
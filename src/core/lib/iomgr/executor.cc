@@ -27,6 +27,8 @@
 #include <grpc/support/log.h>
 #include <grpc/support/sync.h>
 
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/memory.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
@@ -388,6 +390,27 @@ void Executor::InitAll() {
 
 void Executor::Run(grpc_closure* closure, grpc_error_handle error,
                    ExecutorType executor_type, ExecutorJobType job_type) {
+  // With the event_engine_executor experiment, default-executor closures run
+  // on the shared EventEngine thread pool instead of this executor's own
+  // threads; since the legacy pool spawns lazily on first enqueue, it never
+  // starts at all. The resolver executor keeps its own pool because its jobs
+  // may block in the system resolver. Once threading has been turned off
+  // (shutdown) we fall through to the legacy path, which runs closures
+  // inline rather than handing them to a pool that may outlive iomgr.
+  if (executor_type == ExecutorType::DEFAULT &&
+      IsEventEngineExecutorEnabled() && IsThreadedDefault()) {
+    grpc_event_engine::experimental::GetDefaultEventEngine()->Run(
+        [closure, error]() {
+          ApplicationCallbackExecCtx callback_exec_ctx(
+              GRPC_APP_CALLBACK_EXEC_CTX_FLAG_IS_INTERNAL_THREAD);
+          ExecCtx exec_ctx;
+#ifndef NDEBUG
+          closure->scheduled = false;
+#endif
+          closure->cb(closure->cb_arg, error);
+        });
+    return;
+  }
   executor_enqueue_fns_[static_cast<size_t>(executor_type)]
                        [static_cast<size_t>(job_type)](closure, error);
 }
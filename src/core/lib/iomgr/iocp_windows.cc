@@ -55,52 +55,69 @@ static DWORD deadline_to_millis_timeout(grpc_core::Timestamp deadline) {
   return static_cast<DWORD>(timeout.millis());
 }
 
+/* Number of completions dequeued per GetQueuedCompletionStatusEx call.
+   Batching amortizes the dequeue syscall over all sockets that became ready
+   while we were busy; when the port is idle a batch degrades to the same
+   single blocking syscall as before. */
+#define GRPC_IOCP_MAX_COMPLETIONS 16
+
 grpc_iocp_work_status grpc_iocp_work(grpc_core::Timestamp deadline) {
   BOOL success;
-  DWORD bytes = 0;
-  DWORD flags = 0;
-  ULONG_PTR completion_key;
-  LPOVERLAPPED overlapped;
-  grpc_winsocket* socket;
-  grpc_winsocket_callback_info* info;
-  success =
-      GetQueuedCompletionStatus(g_iocp, &bytes, &completion_key, &overlapped,
-                                deadline_to_millis_timeout(deadline));
+  OVERLAPPED_ENTRY entries[GRPC_IOCP_MAX_COMPLETIONS];
+  ULONG num_entries = 0;
+  bool kicked = false;
+  bool worked = false;
+  success = GetQueuedCompletionStatusEx(
+      g_iocp, entries, GRPC_IOCP_MAX_COMPLETIONS, &num_entries,
+      deadline_to_millis_timeout(deadline), FALSE);
   grpc_core::ExecCtx::Get()->InvalidateNow();
-  if (success == 0 && overlapped == NULL) {
+  if (success == 0) {
     return GRPC_IOCP_WORK_TIMEOUT;
   }
-  GPR_ASSERT(completion_key && overlapped);
-  if (overlapped == &g_iocp_custom_overlap) {
-    gpr_atm_full_fetch_add(&g_custom_events, -1);
-    if (completion_key == (ULONG_PTR)&g_iocp_kick_token) {
-      /* We were awoken from a kick. */
-      return GRPC_IOCP_WORK_KICK;
+  for (ULONG i = 0; i < num_entries; i++) {
+    LPOVERLAPPED overlapped = entries[i].lpOverlapped;
+    ULONG_PTR completion_key = entries[i].lpCompletionKey;
+    DWORD bytes = 0;
+    DWORD flags = 0;
+    grpc_winsocket* socket;
+    grpc_winsocket_callback_info* info;
+    GPR_ASSERT(completion_key && overlapped);
+    if (overlapped == &g_iocp_custom_overlap) {
+      gpr_atm_full_fetch_add(&g_custom_events, -1);
+      if (completion_key == (ULONG_PTR)&g_iocp_kick_token) {
+        /* We were awoken from a kick. */
+        kicked = true;
+        continue;
+      }
+      gpr_log(GPR_ERROR, "Unknown custom completion key.");
+      abort();
     }
-    gpr_log(GPR_ERROR, "Unknown custom completion key.");
-    abort();
-  }
 
-  socket = (grpc_winsocket*)completion_key;
-  if (overlapped == &socket->write_info.overlapped) {
-    info = &socket->write_info;
-  } else if (overlapped == &socket->read_info.overlapped) {
-    info = &socket->read_info;
-  } else {
-    abort();
-  }
-  if (socket->shutdown_called) {
-    info->bytes_transferred = 0;
-    info->wsa_error = WSA_OPERATION_ABORTED;
-  } else {
-    success = WSAGetOverlappedResult(socket->socket, &info->overlapped, &bytes,
-                                     FALSE, &flags);
-    info->bytes_transferred = bytes;
-    info->wsa_error = success ? 0 : WSAGetLastError();
+    socket = (grpc_winsocket*)completion_key;
+    if (overlapped == &socket->write_info.overlapped) {
+      info = &socket->write_info;
+    } else if (overlapped == &socket->read_info.overlapped) {
+      info = &socket->read_info;
+    } else {
+      abort();
+    }
+    if (socket->shutdown_called) {
+      info->bytes_transferred = 0;
+      info->wsa_error = WSA_OPERATION_ABORTED;
+    } else {
+      success = WSAGetOverlappedResult(socket->socket, &info->overlapped,
+                                       &bytes, FALSE, &flags);
+      info->bytes_transferred = bytes;
+      info->wsa_error = success ? 0 : WSAGetLastError();
+    }
+    GPR_ASSERT(overlapped == &info->overlapped);
+    grpc_socket_become_ready(socket, info);
+    worked = true;
   }
-  GPR_ASSERT(overlapped == &info->overlapped);
-  grpc_socket_become_ready(socket, info);
-  return GRPC_IOCP_WORK_WORK;
+  /* Socket completions have already been handed off above, so a mixed batch
+     can safely report the kick. */
+  if (kicked) return GRPC_IOCP_WORK_KICK;
+  return worked ? GRPC_IOCP_WORK_WORK : GRPC_IOCP_WORK_TIMEOUT;
 }
 
 void grpc_iocp_init(void) {
@@ -22,8 +22,10 @@
 
 #ifdef GRPC_POSIX_SOCKET_IOMGR
 
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/ev_posix.h"
 #include "src/core/lib/iomgr/iomgr_internal.h"
+#include "src/core/lib/iomgr/pollset_set.h"
 #include "src/core/lib/iomgr/resolve_address.h"
 #include "src/core/lib/iomgr/resolve_address_posix.h"
 #include "src/core/lib/iomgr/tcp_client.h"
@@ -79,7 +81,11 @@ void grpc_set_default_iomgr_platform() {
   grpc_set_tcp_server_impl(&grpc_posix_tcp_server_vtable);
   grpc_set_timer_impl(&grpc_generic_timer_vtable);
   grpc_set_pollset_vtable(&grpc_posix_pollset_vtable);
-  grpc_set_pollset_set_vtable(&grpc_posix_pollset_set_vtable);
+  if (grpc_core::IsElidePollsetSetEnabled()) {
+    grpc_set_pollset_set_vtable(&grpc_noop_pollset_set_vtable);
+  } else {
+    grpc_set_pollset_set_vtable(&grpc_posix_pollset_set_vtable);
+  }
   grpc_tcp_client_global_init();
   grpc_set_iomgr_platform_vtable(&vtable);
 }
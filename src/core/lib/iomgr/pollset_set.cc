@@ -18,10 +18,41 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stdint.h>
+
 #include "src/core/lib/iomgr/pollset_set.h"
 
 grpc_pollset_set_vtable* grpc_pollset_set_impl;
 
+/* No-op implementation: endpoints that drive their own polling (e.g.
+   EventEngine-owned endpoints) never need call pollsets to poll their fds,
+   so membership tracking is pure overhead. create() hands back a non-null
+   sentinel so callers that store and null-check their pollset_set keep
+   working. */
+
+static grpc_pollset_set* noop_pollset_set_create(void) {
+  return reinterpret_cast<grpc_pollset_set*>(static_cast<intptr_t>(0xdeafbeef));
+}
+
+static void noop_pollset_set_destroy(grpc_pollset_set* /*pollset_set*/) {}
+
+static void noop_pollset_set_add_pollset(grpc_pollset_set* /*pollset_set*/,
+                                         grpc_pollset* /*pollset*/) {}
+
+static void noop_pollset_set_del_pollset(grpc_pollset_set* /*pollset_set*/,
+                                         grpc_pollset* /*pollset*/) {}
+
+static void noop_pollset_set_add_pollset_set(grpc_pollset_set* /*bag*/,
+                                             grpc_pollset_set* /*item*/) {}
+
+static void noop_pollset_set_del_pollset_set(grpc_pollset_set* /*bag*/,
+                                             grpc_pollset_set* /*item*/) {}
+
+grpc_pollset_set_vtable grpc_noop_pollset_set_vtable = {
+    noop_pollset_set_create,          noop_pollset_set_destroy,
+    noop_pollset_set_add_pollset,     noop_pollset_set_del_pollset,
+    noop_pollset_set_add_pollset_set, noop_pollset_set_del_pollset_set};
+
 void grpc_set_pollset_set_vtable(grpc_pollset_set_vtable* vtable) {
   grpc_pollset_set_impl = vtable;
 }
@@ -39,6 +39,12 @@ typedef struct grpc_pollset_set_vtable {
 
 void grpc_set_pollset_set_vtable(grpc_pollset_set_vtable* vtable);
 
+/* A pollset_set implementation where every operation is a no-op.
+   Installed (via the elide_pollset_set experiment) when endpoints drive
+   their own polling and pollset_set registration would be pure
+   bookkeeping. */
+extern grpc_pollset_set_vtable grpc_noop_pollset_set_vtable;
+
 grpc_pollset_set* grpc_pollset_set_create(void);
 void grpc_pollset_set_destroy(grpc_pollset_set* pollset_set);
 void grpc_pollset_set_add_pollset(grpc_pollset_set* pollset_set,
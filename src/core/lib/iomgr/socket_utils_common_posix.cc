@@ -248,6 +248,26 @@ grpc_error_handle grpc_set_socket_low_latency(int fd, int low_latency) {
   return absl::OkStatus();
 }
 
+/* request TCP Fast Open on the connect path */
+grpc_error_handle grpc_set_socket_tcp_fastopen_connect(int fd) {
+#ifdef TCP_FASTOPEN_CONNECT
+  extern grpc_core::TraceFlag grpc_tcp_trace;
+  int val = 1;
+  if (0 != setsockopt(fd, IPPROTO_TCP, TCP_FASTOPEN_CONNECT, &val,
+                      sizeof(val))) {
+    /* Best effort: kernels predating TCP_FASTOPEN_CONNECT (or with TFO
+       disabled via sysctl) do a regular handshake. */
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_tcp_trace)) {
+      gpr_log(GPR_INFO, "setsockopt(TCP_FASTOPEN_CONNECT) unsupported: %s",
+              strerror(errno));
+    }
+  }
+#else
+  (void)fd;
+#endif
+  return absl::OkStatus();
+}
+
 /* The default values for TCP_USER_TIMEOUT are currently configured to be in
  * line with the default values of KEEPALIVE_TIMEOUT as proposed in
  * https://github.com/grpc/proposal/blob/master/A18-tcp-user-timeout.md */
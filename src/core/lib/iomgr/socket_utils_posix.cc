@@ -88,6 +88,9 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
   options.allow_reuse_port =
       (AdjustValue(0, 1, INT_MAX, config.GetInt(GRPC_ARG_ALLOW_REUSEPORT)) !=
        0);
+  options.tcp_fastopen_connect =
+      (AdjustValue(0, 1, INT_MAX,
+                   config.GetInt(GRPC_ARG_TCP_FASTOPEN_CONNECT)) != 0);
 
   if (options.tcp_min_read_chunk_size > options.tcp_max_read_chunk_size) {
     options.tcp_min_read_chunk_size = options.tcp_max_read_chunk_size;
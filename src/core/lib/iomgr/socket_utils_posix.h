@@ -59,6 +59,7 @@ struct PosixTcpOptions {
   int keep_alive_timeout_ms = 0;
   bool expand_wildcard_addrs = false;
   bool allow_reuse_port = false;
+  bool tcp_fastopen_connect = false;
   RefCountedPtr<ResourceQuota> resource_quota;
   struct grpc_socket_mutator* socket_mutator = nullptr;
   PosixTcpOptions() = default;
@@ -123,6 +124,7 @@ struct PosixTcpOptions {
     keep_alive_timeout_ms = other.keep_alive_timeout_ms;
     expand_wildcard_addrs = other.expand_wildcard_addrs;
     allow_reuse_port = other.allow_reuse_port;
+    tcp_fastopen_connect = other.tcp_fastopen_connect;
   }
 };
 
@@ -156,6 +158,12 @@ grpc_error_handle grpc_set_socket_low_latency(int fd, int low_latency);
 /* set SO_REUSEPORT */
 grpc_error_handle grpc_set_socket_reuse_port(int fd, int reuse);
 
+/* Request TCP Fast Open on the connect path (TCP_FASTOPEN_CONNECT), so that
+   a reconnection to a peer that handed out a TFO cookie carries the first
+   flight of data in the SYN. Best effort: kernels without support proceed
+   with a regular handshake and no error is returned. */
+grpc_error_handle grpc_set_socket_tcp_fastopen_connect(int fd);
+
 /* Configure the default values for TCP_USER_TIMEOUT */
 void config_default_tcp_user_timeout(bool enable, int timeout, bool is_client);
 
@@ -109,6 +109,10 @@ static grpc_error_handle prepare_socket(
     if (!err.ok()) goto error;
     err = grpc_set_socket_tcp_user_timeout(fd, options, true /* is_client */);
     if (!err.ok()) goto error;
+    if (options.tcp_fastopen_connect) {
+      err = grpc_set_socket_tcp_fastopen_connect(fd);
+      if (!err.ok()) goto error;
+    }
   }
   err = grpc_set_socket_no_sigpipe_if_possible(fd);
   if (!err.ok()) goto error;
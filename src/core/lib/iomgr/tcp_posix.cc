@@ -26,6 +26,9 @@
 #ifdef GRPC_POSIX_SOCKET_TCP
 
 #include <errno.h>
+#ifdef GRPC_LINUX_SPLICE
+#include <fcntl.h>
+#endif
 #include <limits.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
@@ -49,6 +52,7 @@
 
 #include "src/core/lib/address_utils/sockaddr_utils.h"
 #include "src/core/lib/debug/event_log.h"
+#include "src/core/lib/debug/call_stage_profiler.h"
 #include "src/core/lib/debug/stats.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/experiments/experiments.h"
@@ -544,6 +548,10 @@ struct grpc_tcp {
   int min_progress_size; /* A hint from upper layers specifying the minimum
                             number of bytes that need to be read to make
                             meaningful progress */
+  /* A hint from the caller of the current write that another write will
+     promptly follow, so the trailing partial packet of this write should be
+     held in the kernel (MSG_MORE) rather than emitted immediately. */
+  bool more_coming = false;
 };
 
 struct backup_poller {
@@ -873,6 +881,7 @@ static void update_rcvlowat(grpc_tcp* tcp)
 #define MAX_READ_IOVEC 64
 static bool tcp_do_read(grpc_tcp* tcp, grpc_error_handle* error)
     ABSL_EXCLUSIVE_LOCKS_REQUIRED(tcp->read_mu) {
+  grpc_core::ScopedCallStageTimer stage_timer(grpc_core::CallStage::kRead);
   if (GRPC_TRACE_FLAG_ENABLED(grpc_tcp_trace)) {
     gpr_log(GPR_INFO, "TCP:%p do_read", tcp);
   }
@@ -1674,6 +1683,7 @@ static bool tcp_flush_zerocopy(grpc_tcp* tcp, TcpZerocopySendRecord* record,
 }
 
 static bool tcp_flush(grpc_tcp* tcp, grpc_error_handle* error) {
+  grpc_core::ScopedCallStageTimer stage_timer(grpc_core::CallStage::kWrite);
   struct msghdr msg;
   struct iovec iov[MAX_WRITE_IOVEC];
   msg_iovlen_type iov_size;
@@ -1715,10 +1725,21 @@ static bool tcp_flush(grpc_tcp* tcp, grpc_error_handle* error) {
     msg.msg_flags = 0;
     bool tried_sending_message = false;
     saved_errno = 0;
+    /* Hold the trailing partial packet in the kernel when bytes beyond this
+       sendmsg remain in the buffer (the next loop iteration sends them
+       immediately) or the caller promised a prompt follow-up write; either
+       way emitting a small packet now would be wasted wire. */
+    int additional_flags = 0;
+#ifdef MSG_MORE
+    if (outgoing_slice_idx != tcp->outgoing_buffer->count ||
+        tcp->more_coming) {
+      additional_flags |= MSG_MORE;
+    }
+#endif
     if (tcp->outgoing_buffer_arg != nullptr) {
       if (!tcp->ts_capable ||
           !tcp_write_with_timestamps(tcp, &msg, sending_length, &sent_length,
-                                     &saved_errno)) {
+                                     &saved_errno, additional_flags)) {
         /* We could not set socket options to collect Fathom timestamps.
          * Fallback on writing without timestamps. */
         tcp->ts_capable = false;
@@ -1734,7 +1755,7 @@ static bool tcp_flush(grpc_tcp* tcp, grpc_error_handle* error) {
       GRPC_STATS_INC_TCP_WRITE_SIZE(sending_length);
       GRPC_STATS_INC_TCP_WRITE_IOV_SIZE(iov_size);
 
-      sent_length = tcp_send(tcp->fd, &msg, &saved_errno);
+      sent_length = tcp_send(tcp->fd, &msg, &saved_errno, additional_flags);
     }
 
     if (sent_length < 0) {
@@ -1826,7 +1847,8 @@ static void tcp_handle_write(void* arg /* grpc_tcp */,
 }
 
 static void tcp_write(grpc_endpoint* ep, grpc_slice_buffer* buf,
-                      grpc_closure* cb, void* arg, int /*max_frame_size*/) {
+                      grpc_closure* cb, void* arg, int /*max_frame_size*/,
+                      bool more_coming) {
   grpc_tcp* tcp = reinterpret_cast<grpc_tcp*>(ep);
   grpc_error_handle error;
   TcpZerocopySendRecord* zerocopy_send_record = nullptr;
@@ -1868,6 +1890,7 @@ static void tcp_write(grpc_endpoint* ep, grpc_slice_buffer* buf,
     tcp->outgoing_byte_idx = 0;
   }
   tcp->outgoing_buffer_arg = arg;
+  tcp->more_coming = more_coming;
   if (arg) {
     GPR_ASSERT(grpc_event_engine_can_track_errors());
   }
@@ -2070,6 +2093,114 @@ void grpc_tcp_destroy_and_release_fd(grpc_endpoint* ep, int* fd,
   TCP_UNREF(tcp, "destroy");
 }
 
+#ifdef GRPC_LINUX_SPLICE
+
+struct grpc_tcp_splice_ctx {
+  int pipe_fds[2];
+  size_t pending;
+};
+
+grpc_tcp_splice_ctx* grpc_tcp_splice_ctx_create(void) {
+  int fds[2];
+  if (pipe2(fds, O_NONBLOCK | O_CLOEXEC) != 0) {
+    return nullptr;
+  }
+  grpc_tcp_splice_ctx* ctx = new grpc_tcp_splice_ctx();
+  ctx->pipe_fds[0] = fds[0];
+  ctx->pipe_fds[1] = fds[1];
+  ctx->pending = 0;
+  return ctx;
+}
+
+size_t grpc_tcp_splice_ctx_pending(const grpc_tcp_splice_ctx* ctx) {
+  return ctx->pending;
+}
+
+/* Pushes the context's buffered bytes into dst_fd. Returns 1 once the pipe is
+   empty, 0 when dst_fd's socket buffer filled up first, -1 on error. */
+static int splice_drain_pipe(grpc_tcp_splice_ctx* ctx, int dst_fd,
+                             size_t* bytes_written) {
+  while (ctx->pending > 0) {
+    ssize_t n = splice(ctx->pipe_fds[0], nullptr, dst_fd, nullptr,
+                       ctx->pending, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+    if (n > 0) {
+      ctx->pending -= static_cast<size_t>(n);
+      *bytes_written += static_cast<size_t>(n);
+    } else if (n < 0 && errno == EINTR) {
+      continue;
+    } else if (n < 0 && errno == EAGAIN) {
+      return 0;
+    } else {
+      return -1;
+    }
+  }
+  return 1;
+}
+
+bool grpc_tcp_splice(grpc_tcp_splice_ctx* ctx, grpc_endpoint* src,
+                     grpc_endpoint* dst, size_t count, size_t* bytes_read,
+                     size_t* bytes_written) {
+  *bytes_read = 0;
+  *bytes_written = 0;
+  int src_fd = grpc_endpoint_get_fd(src);
+  int dst_fd = grpc_endpoint_get_fd(dst);
+  if (src_fd < 0 || dst_fd < 0) {
+    return false;
+  }
+  /* Flush bytes a previous call left in the pipe first, so that in-flight
+     bytes cannot be reordered behind newly spliced ones. */
+  int drained = splice_drain_pipe(ctx, dst_fd, bytes_written);
+  if (drained < 0) return false;
+  if (drained == 0) return true;
+  while (*bytes_read < count) {
+    ssize_t n = splice(src_fd, nullptr, ctx->pipe_fds[1], nullptr,
+                       count - *bytes_read, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+    if (n > 0) {
+      *bytes_read += static_cast<size_t>(n);
+      ctx->pending += static_cast<size_t>(n);
+    } else if (n < 0 && errno == EINTR) {
+      continue;
+    } else if (n == 0 || (n < 0 && errno == EAGAIN)) {
+      /* Source drained (or its peer closed): push what we have and let the
+         caller wait for readability. */
+      break;
+    } else {
+      return false;
+    }
+    drained = splice_drain_pipe(ctx, dst_fd, bytes_written);
+    if (drained < 0) return false;
+    if (drained == 0) break;
+  }
+  return true;
+}
+
+void grpc_tcp_splice_ctx_destroy(grpc_tcp_splice_ctx* ctx) {
+  if (ctx == nullptr) return;
+  close(ctx->pipe_fds[0]);
+  close(ctx->pipe_fds[1]);
+  delete ctx;
+}
+
+#else /* GRPC_LINUX_SPLICE */
+
+grpc_tcp_splice_ctx* grpc_tcp_splice_ctx_create(void) { return nullptr; }
+
+size_t grpc_tcp_splice_ctx_pending(const grpc_tcp_splice_ctx* /*ctx*/) {
+  return 0;
+}
+
+bool grpc_tcp_splice(grpc_tcp_splice_ctx* /*ctx*/, grpc_endpoint* /*src*/,
+                     grpc_endpoint* /*dst*/, size_t /*count*/,
+                     size_t* bytes_read, size_t* bytes_written) {
+  *bytes_read = 0;
+  *bytes_written = 0;
+  return false;
+}
+
+void grpc_tcp_splice_ctx_destroy(grpc_tcp_splice_ctx* /*ctx*/) {}
+
+#endif /* GRPC_LINUX_SPLICE */
+
 void grpc_tcp_posix_init() { g_backup_poller_mu = new grpc_core::Mutex; }
 
 void grpc_tcp_posix_shutdown() {
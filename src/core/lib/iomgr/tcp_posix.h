@@ -56,6 +56,44 @@ int grpc_tcp_fd(grpc_endpoint* ep);
 void grpc_tcp_destroy_and_release_fd(grpc_endpoint* ep, int* fd,
                                      grpc_closure* done);
 
+/* --- Kernel-side pass-through between two tcp endpoints. ---
+
+   A splice context owns the intermediate pipe used by splice(2) and tracks
+   bytes that have been pulled out of the source socket but not yet pushed
+   into the destination socket. A proxy that has already parsed framing (e.g.
+   an HTTP/2 frame header) keeps one context per direction of a proxied
+   connection and calls grpc_tcp_splice() to forward the payload bytes that
+   follow, re-invoking it when its polling indicates the source is readable
+   or the destination writable. Payloads forwarded this way never enter
+   userspace. */
+typedef struct grpc_tcp_splice_ctx grpc_tcp_splice_ctx;
+
+/// Creates a splice context. Returns nullptr when kernel-side splicing is not
+/// supported on this platform; callers must then fall back to endpoint
+/// reads/writes.
+grpc_tcp_splice_ctx* grpc_tcp_splice_ctx_create(void);
+
+/// Returns the number of bytes sitting in the context's pipe: consumed from
+/// the source but not yet written to the destination. Such bytes are flushed
+/// by the next grpc_tcp_splice() call on this context.
+size_t grpc_tcp_splice_ctx_pending(const grpc_tcp_splice_ctx* ctx);
+
+/// Moves up to \a count bytes from \a src to \a dst without copying them
+/// through userspace. Both endpoints must expose a file descriptor carrying
+/// cleartext bytes (unencrypted connections, or sockets whose encryption is
+/// offloaded to the kernel). Never blocks: stops early once the source has no
+/// more data or the destination's socket buffer is full. On return,
+/// *bytes_read is the number of bytes consumed from \a src and *bytes_written
+/// the number delivered to \a dst; the difference stays buffered in the
+/// context. Returns false on unrecoverable error, after which the context
+/// must not be reused for these endpoints.
+bool grpc_tcp_splice(grpc_tcp_splice_ctx* ctx, grpc_endpoint* src,
+                     grpc_endpoint* dst, size_t count, size_t* bytes_read,
+                     size_t* bytes_written);
+
+/// Destroys a splice context, discarding any bytes still in its pipe.
+void grpc_tcp_splice_ctx_destroy(grpc_tcp_splice_ctx* ctx);
+
 #ifdef GRPC_POSIX_SOCKET_TCP
 
 void grpc_tcp_posix_init();
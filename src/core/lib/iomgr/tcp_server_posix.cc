@@ -38,6 +38,7 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <string>
 
 #include "absl/strings/str_cat.h"
@@ -80,6 +81,14 @@ static grpc_error_handle tcp_server_create(grpc_closure* shutdown_complete,
   if (value.has_value()) {
     s->expand_wildcard_addrs = (*value != 0);
   }
+  value = config.GetInt(GRPC_ARG_TCP_ACCEPT_SHARDS);
+  if (value.has_value()) {
+    s->n_accept_shards = std::max(0, *value);
+  }
+  value = config.GetInt(GRPC_ARG_TCP_ACCEPT_SHARD_MAX_IMBALANCE);
+  if (value.has_value()) {
+    s->accept_shard_max_imbalance = std::max(0, *value);
+  }
   gpr_ref_init(&s->refs, 1);
   gpr_mu_init(&s->mu);
   s->active_ports = 0;
@@ -212,6 +221,36 @@ static void on_read(void* arg, grpc_error_handle err) {
       }
     }
 
+    if (sp->server->accept_shard_max_imbalance > 0 &&
+        sp->group_head->group_size > 1) {
+      // Close accepts on a shard that has run too far ahead of the
+      // least-loaded shard of its group; the client's reconnect re-enters
+      // the kernel's SO_REUSEPORT hash from a new source port and usually
+      // lands elsewhere. The listener list is immutable once started, so
+      // the walk needs no lock.
+      const gpr_atm mine = gpr_atm_no_barrier_load(&sp->connections_accepted);
+      gpr_atm min_accepted = mine;
+      grpc_tcp_listener* l = sp->group_head;
+      for (unsigned i = 0; i < sp->group_head->group_size; i++, l = l->next) {
+        min_accepted = std::min(
+            min_accepted, gpr_atm_no_barrier_load(&l->connections_accepted));
+      }
+      if (mine - min_accepted >
+          static_cast<gpr_atm>(sp->server->accept_shard_max_imbalance)) {
+        int64_t rejected =
+            gpr_atm_no_barrier_fetch_add(&sp->connections_rejected, 1) + 1;
+        if (rejected % 1000 == 1) {
+          gpr_log(GPR_INFO,
+                  "Rejected >= %" PRId64
+                  " connections on an overloaded acceptor shard",
+                  rejected);
+        }
+        close(fd);
+        continue;
+      }
+    }
+    gpr_atm_no_barrier_fetch_add(&sp->connections_accepted, 1);
+
     if (sp->server->memory_quota->IsMemoryPressureHigh()) {
       int64_t dropped_connections_count =
           num_dropped_connections.fetch_add(1, std::memory_order_relaxed) + 1;
@@ -400,11 +439,16 @@ static grpc_error_handle clone_port(grpc_tcp_listener* listener,
     sp->port = port;
     sp->port_index = listener->port_index;
     sp->fd_index = listener->fd_index + count - i;
+    sp->group_head = listener;
+    sp->group_size = 0;
+    gpr_atm_no_barrier_store(&sp->connections_accepted, 0);
+    gpr_atm_no_barrier_store(&sp->connections_rejected, 0);
     GPR_ASSERT(sp->emfd);
     while (listener->server->tail->next != nullptr) {
       listener->server->tail = listener->server->tail->next;
     }
   }
+  listener->group_size = count + 1;
 
   return absl::OkStatus();
 }
@@ -502,6 +546,20 @@ static int tcp_server_port_fd(grpc_tcp_server* s, unsigned port_index,
   return -1;
 }
 
+std::vector<grpc_tcp_server_shard_counts> grpc_tcp_server_shard_accept_counts(
+    grpc_tcp_server* s, unsigned port_index) {
+  std::vector<grpc_tcp_server_shard_counts> counts;
+  gpr_mu_lock(&s->mu);
+  for (grpc_tcp_listener* sp = s->head; sp; sp = sp->next) {
+    if (sp->port_index != port_index) continue;
+    counts.push_back(grpc_tcp_server_shard_counts{
+        sp->fd, gpr_atm_no_barrier_load(&sp->connections_accepted),
+        gpr_atm_no_barrier_load(&sp->connections_rejected)});
+  }
+  gpr_mu_unlock(&s->mu);
+  return counts;
+}
+
 static void tcp_server_start(grpc_tcp_server* s,
                              const std::vector<grpc_pollset*>* pollsets,
                              grpc_tcp_server_cb on_accept_cb,
@@ -517,12 +575,18 @@ static void tcp_server_start(grpc_tcp_server* s,
   s->pollsets = pollsets;
   sp = s->head;
   while (sp != nullptr) {
-    if (s->so_reuseport && !grpc_is_unix_socket(&sp->addr) &&
-        pollsets->size() > 1) {
+    // One acceptor shard per pollset by default; GRPC_ARG_TCP_ACCEPT_SHARDS
+    // overrides the shard count explicitly.
+    const size_t n_shards = s->n_accept_shards > 0
+                                ? static_cast<size_t>(s->n_accept_shards)
+                                : pollsets->size();
+    if (s->so_reuseport && !grpc_is_unix_socket(&sp->addr) && n_shards > 1) {
       GPR_ASSERT(GRPC_LOG_IF_ERROR(
-          "clone_port", clone_port(sp, (unsigned)(pollsets->size() - 1))));
-      for (i = 0; i < pollsets->size(); i++) {
-        grpc_pollset_add_fd((*pollsets)[i], sp->emfd);
+          "clone_port", clone_port(sp, static_cast<unsigned>(n_shards - 1))));
+      for (i = 0; i < n_shards; i++) {
+        // Each shard gets a dedicated poller (shards beyond the pollset
+        // count wrap around and share).
+        grpc_pollset_add_fd((*pollsets)[i % pollsets->size()], sp->emfd);
         GRPC_CLOSURE_INIT(&sp->read_closure, on_read, sp,
                           grpc_schedule_on_exec_ctx);
         grpc_fd_notify_on_read(sp->emfd, &sp->read_closure);
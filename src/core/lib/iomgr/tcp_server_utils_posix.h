@@ -21,6 +21,8 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <vector>
+
 #include "src/core/lib/iomgr/ev_posix.h"
 #include "src/core/lib/iomgr/resolve_address.h"
 #include "src/core/lib/iomgr/socket_utils_posix.h"
@@ -47,6 +49,14 @@ typedef struct grpc_tcp_listener {
      identified while iterating through 'next'. */
   struct grpc_tcp_listener* sibling;
   int is_sibling;
+  /* Accept-shard bookkeeping. group_head points at the listener this one was
+     cloned from (itself for originals); group_size is the number of shards in
+     the group and is only meaningful on the group head. The counters are
+     updated with relaxed atomics from the shard's poller. */
+  struct grpc_tcp_listener* group_head;
+  unsigned group_size;
+  gpr_atm connections_accepted;
+  gpr_atm connections_rejected;
 } grpc_tcp_listener;
 
 /* the overall server */
@@ -69,6 +79,11 @@ struct grpc_tcp_server {
   bool shutdown_listeners = false;
   /* use SO_REUSEPORT */
   bool so_reuseport = false;
+  /* number of SO_REUSEPORT acceptor shards per address; 0 = one per pollset */
+  int n_accept_shards = 0;
+  /* reject accepts on a shard this many connections ahead of the
+     least-loaded shard of the same address; 0 = never reject */
+  int accept_shard_max_imbalance = 0;
   /* expand wildcard addresses to a list of all local addresses */
   bool expand_wildcard_addrs = false;
 
@@ -126,4 +141,16 @@ grpc_error_handle grpc_tcp_server_prepare_socket(
 /* Ruturn true if the platform supports ifaddrs */
 bool grpc_tcp_server_have_ifaddrs(void);
 
+/* Per-acceptor-shard counters for one listening fd. */
+struct grpc_tcp_server_shard_counts {
+  int fd;
+  int64_t connections_accepted;
+  int64_t connections_rejected;
+};
+
+/* Return the accept counters for every listening fd (shard) serving
+   port_index, in fd order. Accept rates can be derived by sampling. */
+std::vector<grpc_tcp_server_shard_counts> grpc_tcp_server_shard_accept_counts(
+    grpc_tcp_server* s, unsigned port_index);
+
 #endif /* GRPC_CORE_LIB_IOMGR_TCP_SERVER_UTILS_POSIX_H */
@@ -118,6 +118,10 @@ static grpc_error_handle add_socket_to_server(grpc_tcp_server* s, int fd,
   sp->fd_index = fd_index;
   sp->is_sibling = 0;
   sp->sibling = nullptr;
+  sp->group_head = sp;
+  sp->group_size = 1;
+  gpr_atm_no_barrier_store(&sp->connections_accepted, 0);
+  gpr_atm_no_barrier_store(&sp->connections_rejected, 0);
   GPR_ASSERT(sp->emfd);
   gpr_mu_unlock(&s->mu);
 
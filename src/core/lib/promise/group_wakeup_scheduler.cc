@@ -0,0 +1,63 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/promise/group_wakeup_scheduler.h"
+
+#include "absl/status/status.h"
+
+#include "src/core/lib/gprpp/debug_location.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+
+namespace grpc_core {
+
+void WakeupGroup::Schedule(void (*run)(void* arg), void* arg) {
+  bool schedule_batch;
+  {
+    MutexLock lock(&mu_);
+    pending_.push_back(Wakeup{run, arg});
+    schedule_batch = !batch_scheduled_;
+    batch_scheduled_ = true;
+  }
+  if (schedule_batch) {
+    // The closure holds a ref so the group's owner may drop its ref while a
+    // batch is in flight.
+    GRPC_CLOSURE_INIT(&closure_, RunBatch, Ref().release(),
+                      grpc_schedule_on_exec_ctx);
+    ExecCtx::Run(DEBUG_LOCATION, &closure_, absl::OkStatus());
+  }
+}
+
+void WakeupGroup::RunBatch(void* arg, grpc_error_handle /*error*/) {
+  RefCountedPtr<WakeupGroup> group(static_cast<WakeupGroup*>(arg));
+  absl::InlinedVector<Wakeup, 8> batch;
+  for (;;) {
+    {
+      MutexLock lock(&group->mu_);
+      if (group->pending_.empty()) {
+        group->batch_scheduled_ = false;
+        return;
+      }
+      batch.swap(group->pending_);
+    }
+    // Wakeups enqueued while polling - one activity in the batch readying
+    // another, for instance - join this batch rather than scheduling a fresh
+    // closure.
+    for (const Wakeup& wakeup : batch) wakeup.run(wakeup.arg);
+    batch.clear();
+  }
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,86 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_CORE_LIB_PROMISE_GROUP_WAKEUP_SCHEDULER_H
+#define GRPC_CORE_LIB_PROMISE_GROUP_WAKEUP_SCHEDULER_H
+
+#include <grpc/support/port_platform.h>
+
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/inlined_vector.h"
+
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/error.h"
+
+namespace grpc_core {
+
+// Collects wakeups for a set of related activities - typically all the
+// activities belonging to one call or transport - and runs them together from
+// a single closure on the exec ctx. When one event readies many activities
+// (say a transport read that unblocks fifty pipes) the group schedules one
+// callback instead of fifty, and every ready activity is polled within the
+// same ExecCtx flush.
+class WakeupGroup : public RefCounted<WakeupGroup> {
+ public:
+  // Enqueue one activity wakeup: run(arg) must invoke RunScheduledWakeup() on
+  // the woken activity - GroupWakeupScheduler below supplies a suitable
+  // thunk. May be called from any thread.
+  void Schedule(void (*run)(void* arg), void* arg);
+
+ private:
+  struct Wakeup {
+    void (*run)(void* arg);
+    void* arg;
+  };
+
+  static void RunBatch(void* arg, grpc_error_handle error);
+
+  Mutex mu_;
+  bool batch_scheduled_ ABSL_GUARDED_BY(mu_) = false;
+  absl::InlinedVector<Wakeup, 8> pending_ ABSL_GUARDED_BY(mu_);
+  grpc_closure closure_;
+};
+
+// A callback scheduler for activities that funnels wakeups through a shared
+// WakeupGroup. Construct one scheduler per activity, all referencing the same
+// group, and pass it to MakeActivity in place of ExecCtxWakeupScheduler.
+class GroupWakeupScheduler {
+ public:
+  explicit GroupWakeupScheduler(RefCountedPtr<WakeupGroup> group)
+      : group_(std::move(group)) {}
+
+  template <typename ActivityType>
+  void ScheduleWakeup(ActivityType* activity) {
+    // The activity machinery guarantees the activity stays alive and is not
+    // rescheduled until RunScheduledWakeup() is invoked, so a raw pointer is
+    // sufficient here.
+    group_->Schedule(
+        [](void* arg) {
+          static_cast<ActivityType*>(arg)->RunScheduledWakeup();
+        },
+        activity);
+  }
+
+ private:
+  RefCountedPtr<WakeupGroup> group_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_CORE_LIB_PROMISE_GROUP_WAKEUP_SCHEDULER_H
@@ -20,6 +20,7 @@
 #include <stdint.h>
 
 #include <utility>
+#include <vector>
 
 #include "absl/types/optional.h"
 #include "absl/types/variant.h"
@@ -86,15 +87,27 @@ template <typename T>
 class Push;
 template <typename T>
 class Next;
-
-// Center sits between a sender and a receiver to provide a one-deep buffer of
-// Ts
+template <typename T>
+class PushMany;
+template <typename T>
+class NextBatch;
+
+// Center sits between a sender and a receiver to provide a buffer of Ts.
+// By default the buffer is one deep and every message is individually acked
+// (a push does not resolve until the receiver has consumed the message).
+// With max_buffered > 1 the pipe buffers up to max_buffered messages and a
+// push resolves as soon as its message is accepted; backpressure is applied
+// by refusing pushes at the high watermark and resuming a blocked sender once
+// the buffer drains below the low watermark.
 template <typename T>
 class Center {
  public:
   // Initialize with one send ref (held by PipeSender) and one recv ref (held by
   // PipeReceiver)
-  Center() {
+  explicit Center(uint8_t max_buffered = 1)
+      : max_buffered_(max_buffered),
+        resume_below_(max_buffered == 1 ? 1 : (max_buffered + 1) / 2) {
+    GPR_DEBUG_ASSERT(max_buffered >= 1);
     send_refs_ = 1;
     recv_refs_ = 1;
     value_state_ = ValueState::kEmpty;
@@ -153,15 +166,25 @@ class Center {
   Poll<bool> Push(T* value) {
     GPR_DEBUG_ASSERT(send_refs_ != 0);
     if (recv_refs_ == 0) return false;
-    if (value_state_ != ValueState::kEmpty) return on_empty_.pending();
-    value_state_ = ValueState::kReady;
-    value_ = std::move(*value);
-    on_full_.Wake();
-    return true;
+    if (value_state_ == ValueState::kEmpty) {
+      value_state_ = ValueState::kReady;
+      value_ = std::move(*value);
+      on_full_.Wake();
+      return true;
+    }
+    if (value_state_ == ValueState::kReady &&
+        1 + queue_.size() < max_buffered_) {
+      // Buffered pipe with spare capacity: accept behind the ready value.
+      queue_.push_back(std::move(*value));
+      return true;
+    }
+    return on_empty_.pending();
   }
 
   Poll<bool> PollAck() {
     GPR_DEBUG_ASSERT(send_refs_ != 0);
+    // Buffered pipes apply backpressure at Push: acceptance is the ack.
+    if (max_buffered_ > 1) return true;
     if (recv_refs_ == 0) return value_state_ == ValueState::kAcked;
     if (value_state_ != ValueState::kAcked) return on_empty_.pending();
     value_state_ = ValueState::kEmpty;
@@ -181,10 +204,54 @@ class Center {
     return NextResult<T>(RefRecv());
   }
 
+  // Take up to max ready messages from the pipe in one poll, appending them
+  // to *batch.
+  // Return Pending if no message is ready.
+  // Return false if the send end closed with nothing buffered.
+  // Return true if 1..max messages were taken. Taken messages are acked
+  // immediately (there is no NextResult holding them).
+  Poll<bool> TakeBatch(size_t max, std::vector<T>* batch) {
+    GPR_DEBUG_ASSERT(recv_refs_ != 0);
+    GPR_DEBUG_ASSERT(max > 0);
+    if (value_state_ != ValueState::kReady) {
+      if (send_refs_ == 0) return false;
+      return on_full_.pending();
+    }
+    size_t taken = 0;
+    while (taken < max && value_state_ == ValueState::kReady) {
+      batch->push_back(std::move(value_));
+      ++taken;
+      if (!queue_.empty()) {
+        value_ = std::move(queue_.front());
+        queue_.erase(queue_.begin());
+      } else if (max_buffered_ == 1) {
+        // One-deep pipe: the sender's PollAck consumes the ack.
+        value_state_ = ValueState::kAcked;
+      } else {
+        value_state_ = ValueState::kEmpty;
+      }
+    }
+    if (max_buffered_ == 1) {
+      on_empty_.Wake();
+    } else {
+      MaybeResumeSender();
+    }
+    return true;
+  }
+
   void AckNext() {
     GPR_DEBUG_ASSERT(value_state_ == ValueState::kReady);
-    value_state_ = ValueState::kAcked;
-    on_empty_.Wake();
+    if (max_buffered_ == 1) {
+      value_state_ = ValueState::kAcked;
+      on_empty_.Wake();
+    } else if (!queue_.empty()) {
+      value_ = std::move(queue_.front());
+      queue_.erase(queue_.begin());
+      MaybeResumeSender();
+    } else {
+      value_state_ = ValueState::kEmpty;
+      MaybeResumeSender();
+    }
     UnrefRecv();
   }
 
@@ -196,8 +263,17 @@ class Center {
     // Fancy dance to move out of value in the off chance that we reclaim some
     // memory earlier.
     [](T) {}(std::move(value_));
+    queue_.clear();
     value_state_ = ValueState::kEmpty;
   }
+  // Wake a sender blocked on backpressure once the buffer has drained below
+  // the low watermark, so that it refills in batches rather than one slot at
+  // a time.
+  void MaybeResumeSender() {
+    const size_t buffered =
+        (value_state_ == ValueState::kReady ? 1 : 0) + queue_.size();
+    if (buffered < resume_below_) on_empty_.Wake();
+  }
   // State of value_.
   enum class ValueState : uint8_t {
     // No value is set, it's possible to send.
@@ -220,6 +296,14 @@ class Center {
     GPR_UNREACHABLE_CODE(return "unknown");
   }
   T value_;
+  // Messages accepted behind value_ (buffered pipes only; front is oldest).
+  std::vector<T> queue_;
+  // High watermark: maximum number of buffered (pushed but unreceived)
+  // messages. 1 => classic one-deep ack-per-message pipe.
+  uint8_t max_buffered_;
+  // Low watermark: resume a blocked sender once fewer than this many messages
+  // remain buffered.
+  uint8_t resume_below_;
   // Number of sending objects.
   // 0 => send is closed.
   // 1 ref each for PipeSender and Push.
@@ -241,6 +325,7 @@ template <typename T>
 class PipeSender {
  public:
   using PushType = pipe_detail::Push<T>;
+  using PushManyType = pipe_detail::PushMany<T>;
 
   PipeSender(const PipeSender&) = delete;
   PipeSender& operator=(const PipeSender&) = delete;
@@ -269,6 +354,12 @@ class PipeSender {
   // receiver is either closed or able to receive another message.
   PushType Push(T value);
 
+  // Send several messages along the pipe in one operation.
+  // Returns a promise that will resolve to a bool - true once every message
+  // has been accepted, false if the receiver closed first. On a buffered pipe
+  // as many messages as there is capacity for are accepted per poll.
+  PushManyType PushMany(std::vector<T> values);
+
  private:
   friend struct Pipe<T>;
   explicit PipeSender(pipe_detail::Center<T>* center) : center_(center) {}
@@ -280,6 +371,7 @@ template <typename T>
 class PipeReceiver {
  public:
   using NextType = pipe_detail::Next<T>;
+  using NextBatchType = pipe_detail::NextBatch<T>;
 
   PipeReceiver(const PipeReceiver&) = delete;
   PipeReceiver& operator=(const PipeReceiver&) = delete;
@@ -304,6 +396,13 @@ class PipeReceiver {
   // available.
   NextType Next();
 
+  // Receive up to max_messages queued messages from the pipe in one poll.
+  // Returns a promise that will resolve to an optional<std::vector<T>> - with
+  // 1..max_messages messages if any were available, or no value if the other
+  // end of the pipe was closed with nothing buffered. Received messages are
+  // acked as they are taken.
+  NextBatchType NextBatch(size_t max_messages);
+
  private:
   friend struct Pipe<T>;
   explicit PipeReceiver(pipe_detail::Center<T>* center) : center_(center) {}
@@ -390,6 +489,94 @@ class Next {
   Center<T>* center_;
 };
 
+// Implementation of PipeSender::PushMany promise.
+template <typename T>
+class PushMany {
+ public:
+  PushMany(const PushMany&) = delete;
+  PushMany& operator=(const PushMany&) = delete;
+  PushMany(PushMany&& other) noexcept
+      : center_(other.center_),
+        values_(std::move(other.values_)),
+        next_(other.next_) {
+    other.center_ = nullptr;
+  }
+  PushMany& operator=(PushMany&& other) noexcept {
+    if (center_ != nullptr) center_->UnrefSend();
+    center_ = other.center_;
+    other.center_ = nullptr;
+    values_ = std::move(other.values_);
+    next_ = other.next_;
+    return *this;
+  }
+
+  ~PushMany() {
+    if (center_ != nullptr) center_->UnrefSend();
+  }
+
+  Poll<bool> operator()() {
+    while (next_ < values_.size()) {
+      auto r = center_->Push(&values_[next_]);
+      if (auto* ok = absl::get_if<bool>(&r)) {
+        if (!*ok) return false;
+        ++next_;
+      } else {
+        return Pending{};
+      }
+    }
+    return center_->PollAck();
+  }
+
+ private:
+  friend class PipeSender<T>;
+  PushMany(pipe_detail::Center<T>* center, std::vector<T> values)
+      : center_(center), values_(std::move(values)) {}
+  Center<T>* center_;
+  std::vector<T> values_;
+  size_t next_ = 0;
+};
+
+// Implementation of PipeReceiver::NextBatch promise.
+template <typename T>
+class NextBatch {
+ public:
+  NextBatch(const NextBatch&) = delete;
+  NextBatch& operator=(const NextBatch&) = delete;
+  NextBatch(NextBatch&& other) noexcept
+      : center_(other.center_), max_(other.max_) {
+    other.center_ = nullptr;
+  }
+  NextBatch& operator=(NextBatch&& other) noexcept {
+    if (center_ != nullptr) center_->UnrefRecv();
+    center_ = other.center_;
+    other.center_ = nullptr;
+    max_ = other.max_;
+    return *this;
+  }
+
+  ~NextBatch() {
+    if (center_ != nullptr) center_->UnrefRecv();
+  }
+
+  Poll<absl::optional<std::vector<T>>> operator()() {
+    std::vector<T> batch;
+    auto r = center_->TakeBatch(max_, &batch);
+    if (auto* taken = absl::get_if<bool>(&r)) {
+      std::exchange(center_, nullptr)->UnrefRecv();
+      if (!*taken) return absl::optional<std::vector<T>>();
+      return absl::optional<std::vector<T>>(std::move(batch));
+    }
+    return Pending{};
+  }
+
+ private:
+  friend class PipeReceiver<T>;
+  NextBatch(pipe_detail::Center<T>* center, size_t max)
+      : center_(center), max_(max) {}
+  Center<T>* center_;
+  size_t max_;
+};
+
 }  // namespace pipe_detail
 
 template <typename T>
@@ -397,11 +584,21 @@ pipe_detail::Push<T> PipeSender<T>::Push(T value) {
   return pipe_detail::Push<T>(center_->RefSend(), std::move(value));
 }
 
+template <typename T>
+pipe_detail::PushMany<T> PipeSender<T>::PushMany(std::vector<T> values) {
+  return pipe_detail::PushMany<T>(center_->RefSend(), std::move(values));
+}
+
 template <typename T>
 pipe_detail::Next<T> PipeReceiver<T>::Next() {
   return pipe_detail::Next<T>(center_->RefRecv());
 }
 
+template <typename T>
+pipe_detail::NextBatch<T> PipeReceiver<T>::NextBatch(size_t max_messages) {
+  return pipe_detail::NextBatch<T>(center_->RefRecv(), max_messages);
+}
+
 template <typename T>
 bool NextResult<T>::has_value() const {
   return center_ != nullptr;
@@ -443,7 +640,13 @@ void NextResult<T>::reset() {
 template <typename T>
 struct Pipe {
   Pipe() : Pipe(GetContext<Arena>()) {}
-  explicit Pipe(Arena* arena) : Pipe(arena->New<pipe_detail::Center<T>>()) {}
+  explicit Pipe(Arena* arena) : Pipe(arena, 1) {}
+  // Construct a pipe buffering up to max_buffered messages: pushes resolve as
+  // soon as their message is accepted, block at the high watermark, and a
+  // blocked sender resumes once the buffer drains below the low watermark.
+  // With max_buffered == 1 this is the classic one-deep ack-per-message pipe.
+  Pipe(Arena* arena, uint8_t max_buffered)
+      : Pipe(arena->New<pipe_detail::Center<T>>(max_buffered)) {}
   Pipe(const Pipe&) = delete;
   Pipe& operator=(const Pipe&) = delete;
   Pipe(Pipe&&) noexcept = default;
@@ -65,6 +65,11 @@ class ResolverFactory {
   /// Returns a new resolver instance.
   virtual OrphanablePtr<Resolver> CreateResolver(ResolverArgs args) const = 0;
 
+  /// Returns true if resolvers created by this factory report their result
+  /// inline from StartLocked() without performing any I/O (e.g., resolvers
+  /// for literal address targets).
+  virtual bool ResolvesSynchronously() const { return false; }
+
   /// Returns a string representing the default authority to use for this
   /// scheme.
   virtual std::string GetDefaultAuthority(const URI& uri) const {
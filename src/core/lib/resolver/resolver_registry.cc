@@ -119,18 +119,21 @@ ResolverFactory* ResolverRegistry::LookupResolverFactory(
 ResolverFactory* ResolverRegistry::FindResolverFactory(
     absl::string_view target, URI* uri, std::string* canonical_target) const {
   GPR_ASSERT(uri != nullptr);
-  absl::StatusOr<URI> tmp_uri = URI::Parse(target);
+  // Probe the scheme with a non-owning view first; the owning URI (which
+  // allocates and percent-decodes every component) is only materialized
+  // once we know a factory exists for the scheme.
+  absl::StatusOr<URIView> tmp_uri = URIView::Parse(target);
   ResolverFactory* factory =
       tmp_uri.ok() ? LookupResolverFactory(tmp_uri->scheme()) : nullptr;
   if (factory != nullptr) {
-    *uri = std::move(*tmp_uri);
+    *uri = tmp_uri->ToURI();
     return factory;
   }
   *canonical_target = absl::StrCat(state_.default_prefix, target);
-  absl::StatusOr<URI> tmp_uri2 = URI::Parse(*canonical_target);
+  absl::StatusOr<URIView> tmp_uri2 = URIView::Parse(*canonical_target);
   factory = tmp_uri2.ok() ? LookupResolverFactory(tmp_uri2->scheme()) : nullptr;
   if (factory != nullptr) {
-    *uri = std::move(*tmp_uri2);
+    *uri = tmp_uri2->ToURI();
     return factory;
   }
   if (!tmp_uri.ok() || !tmp_uri2.ok()) {
@@ -36,6 +36,7 @@
 
 #include "src/core/lib/address_utils/sockaddr_utils.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/sync.h"
 
 // IWYU pragma: no_include <sys/socket.h>
 
@@ -51,48 +52,69 @@ const char* ServerAddressWeightAttribute::kServerAddressWeightAttributeKey =
 // ServerAddress
 //
 
+ServerAddress::Inner::Inner(
+    const grpc_resolved_address& address, const ChannelArgs& args,
+    std::map<const char*, std::unique_ptr<AttributeInterface>> attributes)
+    : address(address), args(args), attributes(std::move(attributes)) {}
+
 ServerAddress::ServerAddress(
     const grpc_resolved_address& address, const ChannelArgs& args,
     std::map<const char*, std::unique_ptr<AttributeInterface>> attributes)
-    : address_(address), args_(args), attributes_(std::move(attributes)) {}
+    : inner_(Intern(new Inner(address, args, std::move(attributes)))) {}
 
 ServerAddress::ServerAddress(
     const void* address, size_t address_len, const ChannelArgs& args,
-    std::map<const char*, std::unique_ptr<AttributeInterface>> attributes)
-    : args_(args), attributes_(std::move(attributes)) {
-  memcpy(address_.addr, address, address_len);
-  address_.len = static_cast<socklen_t>(address_len);
+    std::map<const char*, std::unique_ptr<AttributeInterface>> attributes) {
+  grpc_resolved_address addr;
+  memcpy(addr.addr, address, address_len);
+  addr.len = static_cast<socklen_t>(address_len);
+  inner_ = Intern(new Inner(addr, args, std::move(attributes)));
 }
 
-ServerAddress::ServerAddress(const ServerAddress& other)
-    : address_(other.address_), args_(other.args_) {
-  for (const auto& p : other.attributes_) {
-    attributes_[p.first] = p.second->Copy();
-  }
-}
-ServerAddress& ServerAddress::operator=(const ServerAddress& other) {
-  if (&other == this) {
-    return *this;
-  }
-  address_ = other.address_;
-  args_ = other.args_;
-  attributes_.clear();
-  for (const auto& p : other.attributes_) {
-    attributes_[p.first] = p.second->Copy();
+std::shared_ptr<const ServerAddress::Inner> ServerAddress::Intern(
+    Inner* candidate) {
+  // Hash-consing table for address innards.  Keys are the canonical
+  // instances themselves, compared by value; each entry holds only a weak
+  // reference, and the shared_ptr deleter removes the entry when the last
+  // address referencing it goes away, so the table never pins dead
+  // endpoints.
+  struct Table {
+    Mutex mu;
+    struct ByValue {
+      bool operator()(const Inner* a, const Inner* b) const {
+        return a->Cmp(*b) < 0;
+      }
+    };
+    std::map<const Inner*, std::weak_ptr<const Inner>, ByValue> entries
+        ABSL_GUARDED_BY(mu);
+  };
+  static Table* table = new Table;
+  MutexLock lock(&table->mu);
+  auto it = table->entries.find(candidate);
+  if (it != table->entries.end()) {
+    std::shared_ptr<const Inner> existing = it->second.lock();
+    if (existing != nullptr) {
+      delete candidate;
+      return existing;
+    }
+    // The last owner is concurrently destroying this entry; drop it so
+    // that the candidate becomes the canonical instance.
+    table->entries.erase(it);
   }
-  return *this;
-}
-
-ServerAddress::ServerAddress(ServerAddress&& other) noexcept
-    : address_(other.address_),
-      args_(std::move(other.args_)),
-      attributes_(std::move(other.attributes_)) {}
-
-ServerAddress& ServerAddress::operator=(ServerAddress&& other) noexcept {
-  address_ = other.address_;
-  args_ = std::move(other.args_);
-  attributes_ = std::move(other.attributes_);
-  return *this;
+  std::shared_ptr<const Inner> interned(candidate, [](const Inner* inner) {
+    {
+      MutexLock lock(&table->mu);
+      auto it = table->entries.find(inner);
+      // Erase only our own entry: an equal instance may have replaced it
+      // if interning raced with this deletion.
+      if (it != table->entries.end() && it->first == inner) {
+        table->entries.erase(it);
+      }
+    }
+    delete inner;
+  });
+  table->entries.emplace(candidate, interned);
+  return interned;
 }
 
 namespace {
@@ -124,20 +146,26 @@ int CompareAttributes(
 
 }  // namespace
 
-int ServerAddress::Cmp(const ServerAddress& other) const {
-  if (address_.len > other.address_.len) return 1;
-  if (address_.len < other.address_.len) return -1;
-  int retval = memcmp(address_.addr, other.address_.addr, address_.len);
+int ServerAddress::Inner::Cmp(const Inner& other) const {
+  if (address.len > other.address.len) return 1;
+  if (address.len < other.address.len) return -1;
+  int retval = memcmp(address.addr, other.address.addr, address.len);
   if (retval != 0) return retval;
-  retval = QsortCompare(args_, other.args_);
+  retval = QsortCompare(args, other.args);
   if (retval != 0) return retval;
-  return CompareAttributes(attributes_, other.attributes_);
+  return CompareAttributes(attributes, other.attributes);
+}
+
+int ServerAddress::Cmp(const ServerAddress& other) const {
+  // Interning makes equality a pointer comparison.
+  if (inner_ == other.inner_) return 0;
+  return inner_->Cmp(*other.inner_);
 }
 
 const ServerAddress::AttributeInterface* ServerAddress::GetAttribute(
     const char* key) const {
-  auto it = attributes_.find(key);
-  if (it == attributes_.end()) return nullptr;
+  auto it = inner_->attributes.find(key);
+  if (it == inner_->attributes.end()) return nullptr;
   return it->second.get();
 }
 
@@ -145,26 +173,29 @@ const ServerAddress::AttributeInterface* ServerAddress::GetAttribute(
 // If the new value is null, the attribute is removed.
 ServerAddress ServerAddress::WithAttribute(
     const char* key, std::unique_ptr<AttributeInterface> value) const {
-  ServerAddress address = *this;
+  std::map<const char*, std::unique_ptr<AttributeInterface>> attributes;
+  for (const auto& p : inner_->attributes) {
+    attributes[p.first] = p.second->Copy();
+  }
   if (value == nullptr) {
-    address.attributes_.erase(key);
+    attributes.erase(key);
   } else {
-    address.attributes_[key] = std::move(value);
+    attributes[key] = std::move(value);
   }
-  return address;
+  return ServerAddress(inner_->address, inner_->args, std::move(attributes));
 }
 
 std::string ServerAddress::ToString() const {
-  auto addr_str = grpc_sockaddr_to_string(&address_, false);
+  auto addr_str = grpc_sockaddr_to_string(&inner_->address, false);
   std::vector<std::string> parts = {
       addr_str.ok() ? addr_str.value() : addr_str.status().ToString(),
   };
-  if (args_ != ChannelArgs()) {
-    parts.emplace_back(absl::StrCat("args=", args_.ToString()));
+  if (inner_->args != ChannelArgs()) {
+    parts.emplace_back(absl::StrCat("args=", inner_->args.ToString()));
   }
-  if (!attributes_.empty()) {
+  if (!inner_->attributes.empty()) {
     std::vector<std::string> attrs;
-    for (const auto& p : attributes_) {
+    for (const auto& p : inner_->attributes) {
       attrs.emplace_back(absl::StrCat(p.first, "=", p.second->ToString()));
     }
     parts.emplace_back(
@@ -74,20 +74,18 @@ class ServerAddress {
                 std::map<const char*, std::unique_ptr<AttributeInterface>>
                     attributes = {});
 
-  // Copyable.
-  ServerAddress(const ServerAddress& other);
-  ServerAddress& operator=(const ServerAddress& other);
-
-  // Movable.
-  ServerAddress(ServerAddress&& other) noexcept;
-  ServerAddress& operator=(ServerAddress&& other) noexcept;
+  // Copies and moves share the interned innards, so both are cheap.
+  ServerAddress(const ServerAddress& other) = default;
+  ServerAddress& operator=(const ServerAddress& other) = default;
+  ServerAddress(ServerAddress&& other) noexcept = default;
+  ServerAddress& operator=(ServerAddress&& other) noexcept = default;
 
   bool operator==(const ServerAddress& other) const { return Cmp(other) == 0; }
 
   int Cmp(const ServerAddress& other) const;
 
-  const grpc_resolved_address& address() const { return address_; }
-  const ChannelArgs& args() const { return args_; }
+  const grpc_resolved_address& address() const { return inner_->address; }
+  const ChannelArgs& args() const { return inner_->args; }
 
   const AttributeInterface* GetAttribute(const char* key) const;
 
@@ -102,9 +100,29 @@ class ServerAddress {
   std::string ToString() const;
 
  private:
-  grpc_resolved_address address_;
-  ChannelArgs args_;
-  std::map<const char*, std::unique_ptr<AttributeInterface>> attributes_;
+  // The immutable innards of an address.  Instances are hash-consed in a
+  // process-wide table (see Intern() in the .cc file), so equal addresses
+  // produced by any resolver in the process -- e.g. 40k channels resolving
+  // the same target -- share a single allocation, and copying an address
+  // or an address list is a refcount bump per element.
+  struct Inner {
+    Inner(const grpc_resolved_address& address, const ChannelArgs& args,
+          std::map<const char*, std::unique_ptr<AttributeInterface>>
+              attributes);
+
+    int Cmp(const Inner& other) const;
+
+    grpc_resolved_address address;
+    ChannelArgs args;
+    std::map<const char*, std::unique_ptr<AttributeInterface>> attributes;
+  };
+
+  // Returns the canonical shared instance equal to *candidate, taking
+  // ownership of candidate (which becomes the canonical instance if no
+  // equal one is live).
+  static std::shared_ptr<const Inner> Intern(Inner* candidate);
+
+  std::shared_ptr<const Inner> inner_;
 };
 
 //
@@ -26,20 +26,102 @@
 #include <grpc/support/alloc.h>
 
 #include "src/core/lib/gpr/alloc.h"
+#include "src/core/lib/gprpp/no_destruct.h"
+#include "src/core/lib/gprpp/sync.h"
 
 namespace {
 
-void* ArenaStorage(size_t initial_size) {
+// Zones freed when one call's arena is destroyed are very frequently
+// re-allocated at the same size by the next call: streaming calls overflow
+// their initial zone with similarly sized allocations at a steady rate. So
+// poolable zone allocations are rounded up to a power-of-two size class and
+// recycled through a small bounded pool rather than returned to malloc. Only
+// the storage is recycled - every zone still reserves and releases memory
+// quota as before, so memory pressure semantics are unchanged.
+constexpr size_t kMinPooledZoneSize = 1024;
+constexpr size_t kMaxPooledZoneSize = 64 * 1024;
+constexpr size_t kNumZoneSizeClasses = 7;
+
+class ZonePool {
+ public:
+  // Take a zone block of exactly `size` bytes, or nullptr if none is pooled.
+  void* TryTake(size_t size) {
+    Bucket* bucket = BucketForSize(size);
+    if (bucket == nullptr) return nullptr;
+    grpc_core::MutexLock lock(&bucket->mu);
+    if (bucket->count == 0) return nullptr;
+    return bucket->zones[--bucket->count];
+  }
+
+  // Donate a zone block of `size` bytes to the pool. Returns false (leaving
+  // the caller to free it) if the size isn't pooled or the bucket is full.
+  bool TryPut(void* zone, size_t size) {
+    Bucket* bucket = BucketForSize(size);
+    if (bucket == nullptr) return false;
+    grpc_core::MutexLock lock(&bucket->mu);
+    if (bucket->count == kMaxZonesPerBucket) return false;
+    bucket->zones[bucket->count++] = zone;
+    return true;
+  }
+
+ private:
+  // Bounds the retained memory to ~1MB: 8 * (1K + 2K + ... + 64K).
+  static constexpr size_t kMaxZonesPerBucket = 8;
+
+  struct Bucket {
+    grpc_core::Mutex mu;
+    void* zones[kMaxZonesPerBucket] ABSL_GUARDED_BY(mu);
+    size_t count ABSL_GUARDED_BY(mu) = 0;
+  };
+
+  Bucket* BucketForSize(size_t size) {
+    if (size < kMinPooledZoneSize || size > kMaxPooledZoneSize) return nullptr;
+    // Only exact size classes are pooled.
+    if ((size & (size - 1)) != 0) return nullptr;
+    size_t idx = 0;
+    for (size_t s = kMinPooledZoneSize; s < size; s <<= 1) ++idx;
+    return &buckets_[idx];
+  }
+
+  Bucket buckets_[kNumZoneSizeClasses];
+};
+
+ZonePool* GetZonePool() {
+  static grpc_core::NoDestruct<ZonePool> pool;
+  return pool.get();
+}
+
+// Everything that might be recycled through the pool is allocated with the
+// strongest alignment any pool user needs, so that a block freed as an
+// overflow zone can be reused as an arena spine and vice versa.
+constexpr size_t kPoolableAlignment =
+    (GPR_CACHELINE_SIZE > GPR_MAX_ALIGNMENT &&
+     GPR_CACHELINE_SIZE % GPR_MAX_ALIGNMENT == 0)
+        ? GPR_CACHELINE_SIZE
+        : GPR_MAX_ALIGNMENT;
+
+// Total storage size for an arena spine (the Arena header plus its initial
+// zone), rounded up to a pool size class where possible so that back-to-back
+// calls can reuse each other's still-cache-hot spines.
+size_t ArenaStorageSize(size_t initial_size) {
   static constexpr size_t base_size =
       GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(grpc_core::Arena));
   initial_size = GPR_ROUND_UP_TO_ALIGNMENT_SIZE(initial_size);
   size_t alloc_size = base_size + initial_size;
-  static constexpr size_t alignment =
-      (GPR_CACHELINE_SIZE > GPR_MAX_ALIGNMENT &&
-       GPR_CACHELINE_SIZE % GPR_MAX_ALIGNMENT == 0)
-          ? GPR_CACHELINE_SIZE
-          : GPR_MAX_ALIGNMENT;
-  return gpr_malloc_aligned(alloc_size, alignment);
+  if (alloc_size <= kMaxPooledZoneSize) {
+    size_t pooled_size = kMinPooledZoneSize;
+    while (pooled_size < alloc_size) pooled_size <<= 1;
+    return pooled_size;
+  }
+  return alloc_size;
+}
+
+void* ArenaStorage(size_t alloc_size) {
+  void* storage = GetZonePool()->TryTake(alloc_size);
+  if (storage == nullptr) {
+    storage = gpr_malloc_aligned(alloc_size, kPoolableAlignment);
+  }
+  return storage;
 }
 
 }  // namespace
@@ -50,23 +132,30 @@ Arena::~Arena() {
   Zone* z = last_zone_;
   while (z) {
     Zone* prev_z = z->prev;
+    size_t alloc_size = z->alloc_size;
     Destruct(z);
-    gpr_free_aligned(z);
+    if (!GetZonePool()->TryPut(z, alloc_size)) gpr_free_aligned(z);
     z = prev_z;
   }
 }
 
 Arena* Arena::Create(size_t initial_size, MemoryAllocator* memory_allocator) {
-  return new (ArenaStorage(initial_size))
-      Arena(initial_size, 0, memory_allocator);
+  static constexpr size_t base_size =
+      GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(Arena));
+  // Any storage gained by size class rounding becomes initial zone, so that
+  // allocations that would otherwise narrowly overflow stay in the spine.
+  const size_t storage_size = ArenaStorageSize(initial_size);
+  return new (ArenaStorage(storage_size))
+      Arena(storage_size - base_size, 0, memory_allocator);
 }
 
 std::pair<Arena*, void*> Arena::CreateWithAlloc(
     size_t initial_size, size_t alloc_size, MemoryAllocator* memory_allocator) {
   static constexpr size_t base_size =
       GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(Arena));
-  auto* new_arena = new (ArenaStorage(initial_size))
-      Arena(initial_size, alloc_size, memory_allocator);
+  const size_t storage_size = ArenaStorageSize(initial_size);
+  auto* new_arena = new (ArenaStorage(storage_size))
+      Arena(storage_size - base_size, alloc_size, memory_allocator);
   void* first_alloc = reinterpret_cast<char*>(new_arena) + base_size;
   return std::make_pair(new_arena, first_alloc);
 }
@@ -84,8 +173,13 @@ size_t Arena::Destroy() {
   }
   size_t size = total_used_.load(std::memory_order_relaxed);
   memory_allocator_->Release(total_allocated_.load(std::memory_order_relaxed));
+  static constexpr size_t base_size =
+      GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(Arena));
+  const size_t storage_size = base_size + initial_zone_size_;
   this->~Arena();
-  gpr_free_aligned(this);
+  // Keep the spine warm for the next call if it fits a pool size class;
+  // TryPut rejects anything unpooled and we free it as before.
+  if (!GetZonePool()->TryPut(this, storage_size)) gpr_free_aligned(this);
   return size;
 }
 
@@ -98,9 +192,21 @@ void* Arena::AllocZone(size_t size) {
   static constexpr size_t zone_base_size =
       GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(Zone));
   size_t alloc_size = zone_base_size + size;
+  // Round poolable sizes up to their power-of-two size class so that freed
+  // zones can be recycled by later arenas.
+  if (alloc_size <= kMaxPooledZoneSize) {
+    size_t pooled_size = kMinPooledZoneSize;
+    while (pooled_size < alloc_size) pooled_size <<= 1;
+    alloc_size = pooled_size;
+  }
   memory_allocator_->Reserve(alloc_size);
   total_allocated_.fetch_add(alloc_size, std::memory_order_relaxed);
-  Zone* z = new (gpr_malloc_aligned(alloc_size, GPR_MAX_ALIGNMENT)) Zone();
+  void* storage = GetZonePool()->TryTake(alloc_size);
+  if (storage == nullptr) {
+    storage = gpr_malloc_aligned(alloc_size, kPoolableAlignment);
+  }
+  Zone* z = new (storage) Zone();
+  z->alloc_size = alloc_size;
   auto* prev = last_zone_.load(std::memory_order_relaxed);
   do {
     z->prev = prev;
@@ -91,6 +91,9 @@ class Arena {
  private:
   struct Zone {
     Zone* prev;
+    // Total allocation size of this zone (header included), so that the zone
+    // can be routed back to the right recycling pool bucket on destruction.
+    size_t alloc_size = 0;
   };
 
   struct ManagedNewObject {
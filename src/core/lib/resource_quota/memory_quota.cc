@@ -26,6 +26,7 @@
 #include "absl/strings/str_cat.h"
 
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/mpscq.h"
 #include "src/core/lib/promise/exec_ctx_wakeup_scheduler.h"
@@ -33,6 +34,7 @@
 #include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/race.h"
 #include "src/core/lib/promise/seq.h"
+#include "src/core/lib/promise/sleep.h"
 #include "src/core/lib/resource_quota/trace.h"
 
 namespace grpc_core {
@@ -161,6 +163,12 @@ GrpcMemoryAllocatorImpl::GrpcMemoryAllocatorImpl(
 }
 
 GrpcMemoryAllocatorImpl::~GrpcMemoryAllocatorImpl() {
+  // Fold any remaining per-CPU grants back into the shared pool so the
+  // accounting check below sees the whole free pool.
+  for (PerCpuFreeBytes& cpu_cache : per_cpu_free_) {
+    free_bytes_.fetch_add(cpu_cache.bytes.exchange(0, std::memory_order_acq_rel),
+                          std::memory_order_acq_rel);
+  }
   GPR_ASSERT(free_bytes_.load(std::memory_order_acquire) +
                  sizeof(GrpcMemoryAllocatorImpl) ==
              taken_bytes_.load(std::memory_order_relaxed));
@@ -226,6 +234,20 @@ absl::optional<size_t> GrpcMemoryAllocatorImpl::TryReserve(
 
   // How much do we want to reserve?
   const size_t reserve = request.min() + scaled_size_over_min;
+  // Fast path: satisfy the reservation from this CPU's local grant, avoiding
+  // the shared free pool (and its cache line) entirely. PerCpu keys off the
+  // current ExecCtx, so skip the local grant if there isn't one.
+  if (ExecCtx::Get() != nullptr) {
+    PerCpuFreeBytes& cpu_cache = per_cpu_free_.this_cpu();
+    size_t cached = cpu_cache.bytes.load(std::memory_order_acquire);
+    while (cached >= reserve) {
+      if (cpu_cache.bytes.compare_exchange_weak(cached, cached - reserve,
+                                                std::memory_order_acq_rel,
+                                                std::memory_order_acquire)) {
+        return reserve;
+      }
+    }
+  }
   // See how many bytes are available.
   size_t available = free_bytes_.load(std::memory_order_acquire);
   while (true) {
@@ -302,8 +324,12 @@ void GrpcMemoryAllocatorImpl::MaybeRegisterReclaimer() {
     if (self == nullptr) return;
     auto* p = static_cast<GrpcMemoryAllocatorImpl*>(self.get());
     p->registered_reclaimer_.store(false, std::memory_order_relaxed);
-    // Figure out how many bytes we can return to the quota.
+    // Figure out how many bytes we can return to the quota: the shared free
+    // pool plus whatever is sitting in the per-CPU grants.
     size_t return_bytes = p->free_bytes_.exchange(0, std::memory_order_acq_rel);
+    for (PerCpuFreeBytes& cpu_cache : p->per_cpu_free_) {
+      return_bytes += cpu_cache.bytes.exchange(0, std::memory_order_acq_rel);
+    }
     if (return_bytes == 0) return;
     // Subtract that from our outstanding balance.
     p->taken_bytes_.fetch_sub(return_bytes);
@@ -390,16 +416,41 @@ void BasicMemoryQuota::Start() {
         // destroyed, we'll be able to proceed.
         return WaitForSweepPromise(self, token);
       },
-      []() -> LoopCtl<absl::Status> {
+      [self]() {
+        // Pace successive sweeps by how deep we remain in overcommit, so
+        // that reclamation interleaves with normal work instead of running
+        // reclaimers back to back in one multi-ms burst. A quota that is
+        // deeply underwater (>= 5% of its size) sweeps without pause; a
+        // quota that is barely past its limit spreads sweeps out by up to
+        // kMaxReclamationPause. Reclamation is advisory - no allocation
+        // blocks on it - so pacing trades a slightly longer overcommit for
+        // smoother tail latency.
+        constexpr Duration kMaxReclamationPause = Duration::Milliseconds(100);
+        constexpr double kFullSpeedDeficit = 0.05;
+        const double free =
+            self->free_bytes_.load(std::memory_order_relaxed);
+        const double size = self->quota_size_.load(std::memory_order_relaxed);
+        Duration pause = Duration::Zero();
+        if (free < 0 && size >= 1) {
+          const double deficit_fraction =
+              std::min(1.0, (-free / size) / kFullSpeedDeficit);
+          pause = kMaxReclamationPause * (1.0 - deficit_fraction);
+        }
+        return Sleep(Timestamp::Now() + pause);
+      },
+      [](absl::Status) -> LoopCtl<absl::Status> {
         // Continue the loop!
         return Continue{};
       }));
 
+  reclaimer_event_engine_ =
+      grpc_event_engine::experimental::GetDefaultEventEngine();
   reclaimer_activity_ =
       MakeActivity(std::move(reclamation_loop), ExecCtxWakeupScheduler(),
                    [](absl::Status status) {
                      GPR_ASSERT(status.code() == absl::StatusCode::kCancelled);
-                   });
+                   },
+                   reclaimer_event_engine_.get());
 }
 
 void BasicMemoryQuota::Stop() { reclaimer_activity_.reset(); }
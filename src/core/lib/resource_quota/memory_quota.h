@@ -30,15 +30,18 @@
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 
+#include <grpc/event_engine/event_engine.h>
 #include <grpc/event_engine/memory_allocator.h>
 #include <grpc/event_engine/memory_request.h>
 #include <grpc/support/log.h>
 
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/per_cpu.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/promise/activity.h"
 #include "src/core/lib/promise/poll.h"
 #include "src/core/lib/resource_quota/periodic_update.h"
@@ -333,6 +336,10 @@ class BasicMemoryQuota final
   // The reclaimer activity consumes reclaimers whenever we are in overcommit to
   // try and get back under memory limits.
   ActivityPtr reclaimer_activity_;
+  // Engine used by the reclaimer activity for pacing sleeps between sweeps;
+  // held here so it outlives the activity.
+  std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+      reclaimer_event_engine_;
   // Each time we do a reclamation sweep, we increment this counter and give it
   // to the sweep in question. In this way, should we choose to cancel a sweep
   // we can do so and not get confused when the sweep reports back that it's
@@ -361,19 +368,25 @@ class GrpcMemoryAllocatorImpl final : public EventEngineMemoryAllocatorImpl {
 
   // Release some bytes that were previously reserved.
   void Release(size_t n) override {
-    // Add the released memory to our free bytes counter... if this increases
-    // from  0 to non-zero, then we have more to do, otherwise, we're actually
-    // done.
-    size_t prev_free = free_bytes_.fetch_add(n, std::memory_order_release);
-    if ((!IsUnconstrainedMaxQuotaBufferSizeEnabled() &&
-         prev_free + n > kMaxQuotaBufferSize) ||
-        (IsPeriodicResourceQuotaReclamationEnabled() &&
-         donate_back_.Tick([](Duration) {}))) {
-      // Try to immediately return some free'ed memory back to the total quota.
-      MaybeDonateBack();
+    // Return the memory to this CPU's share of the free pool, so that
+    // reserve/release traffic mostly touches a CPU-local counter instead of
+    // contending on an allocator-wide one.
+    // PerCpu keys off the current ExecCtx; without one, fall back to the
+    // shared pool directly.
+    if (ExecCtx::Get() == nullptr) {
+      ReturnFreeToSharedPool(n);
+      return;
+    }
+    PerCpuFreeBytes& cpu_cache = per_cpu_free_.this_cpu();
+    size_t prev_cached =
+        cpu_cache.bytes.fetch_add(n, std::memory_order_release);
+    // Donate-back and reclaimer decisions need the allocator-wide picture, so
+    // flush the local grant to the shared pool once it grows large, and
+    // periodically so that bytes don't strand on CPUs that have gone quiet.
+    if (prev_cached + n > kMaxCpuCacheBytes ||
+        reconcile_per_cpu_free_.Tick([](Duration) {})) {
+      FlushCpuCache(&cpu_cache);
     }
-    if (prev_free != 0) return;
-    MaybeRegisterReclaimer();
   }
 
   // Post a reclamation function.
@@ -397,6 +410,35 @@ class GrpcMemoryAllocatorImpl final : public EventEngineMemoryAllocatorImpl {
 
  private:
   static constexpr size_t kMaxQuotaBufferSize = 1024 * 1024;
+  // Maximum number of free bytes a single CPU holds in its local grant before
+  // we flush back to the shared pool.
+  static constexpr size_t kMaxCpuCacheBytes = 128 * 1024;
+  // One CPU's slice of the allocator's free pool, padded so that adjacent
+  // CPUs don't false-share a cache line.
+  struct alignas(GPR_CACHELINE_SIZE) PerCpuFreeBytes {
+    std::atomic<size_t> bytes{0};
+  };
+  // Flush one CPU's cached free bytes back to the shared pool.
+  void FlushCpuCache(PerCpuFreeBytes* cpu_cache) {
+    size_t flushed = cpu_cache->bytes.exchange(0, std::memory_order_acq_rel);
+    if (flushed != 0) ReturnFreeToSharedPool(flushed);
+  }
+  // Add some released (or flushed) bytes to the shared free pool, donating
+  // back to the quota or registering a reclaimer as appropriate.
+  void ReturnFreeToSharedPool(size_t n) {
+    // Add the memory to our free bytes counter... if this increases from 0 to
+    // non-zero, then we have more to do, otherwise, we're actually done.
+    size_t prev_free = free_bytes_.fetch_add(n, std::memory_order_release);
+    if ((!IsUnconstrainedMaxQuotaBufferSizeEnabled() &&
+         prev_free + n > kMaxQuotaBufferSize) ||
+        (IsPeriodicResourceQuotaReclamationEnabled() &&
+         donate_back_.Tick([](Duration) {}))) {
+      // Try to immediately return some free'ed memory back to the total quota.
+      MaybeDonateBack();
+    }
+    if (prev_free != 0) return;
+    MaybeRegisterReclaimer();
+  }
   // Primitive reservation function.
   absl::optional<size_t> TryReserve(MemoryRequest request) GRPC_MUST_USE_RESULT;
   // This function may be invoked during a memory release operation.
@@ -422,6 +464,11 @@ class GrpcMemoryAllocatorImpl final : public EventEngineMemoryAllocatorImpl {
   // it is immediately using, and the quota can pull it back under memory
   // pressure.
   std::atomic<size_t> free_bytes_{0};
+  // Per-CPU grants carved out of free_bytes_: the fast paths of Reserve and
+  // Release operate against the current CPU's grant only.
+  PerCpu<PerCpuFreeBytes> per_cpu_free_;
+  // Periodically reconcile the per-CPU grants back into free_bytes_.
+  PeriodicUpdate reconcile_per_cpu_free_{Duration::Seconds(1)};
   // Amount of memory taken from the quota by this allocator.
   std::atomic<size_t> taken_bytes_{sizeof(GrpcMemoryAllocatorImpl)};
   std::atomic<bool> registered_reclaimer_{false};
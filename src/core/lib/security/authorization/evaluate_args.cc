@@ -39,16 +39,18 @@ namespace {
 EvaluateArgs::PerChannelArgs::Address ParseEndpointUri(
     absl::string_view uri_text) {
   EvaluateArgs::PerChannelArgs::Address address;
-  absl::StatusOr<URI> uri = URI::Parse(uri_text);
+  // This runs for every connection; a non-owning view plus an on-demand
+  // decode of the path avoids materializing the full owning URI.
+  absl::StatusOr<URIView> uri = URIView::Parse(uri_text);
   if (!uri.ok()) {
     gpr_log(GPR_DEBUG, "Failed to parse uri.");
     return address;
   }
+  std::string path = URI::PercentDecode(uri->path());
   absl::string_view host_view;
   absl::string_view port_view;
-  if (!SplitHostPort(uri->path(), &host_view, &port_view)) {
-    gpr_log(GPR_DEBUG, "Failed to split %s into host and port.",
-            uri->path().c_str());
+  if (!SplitHostPort(path, &host_view, &port_view)) {
+    gpr_log(GPR_DEBUG, "Failed to split %s into host and port.", path.c_str());
     return address;
   }
   if (!absl::SimpleAtoi(port_view, &address.port)) {
@@ -56,10 +58,10 @@ EvaluateArgs::PerChannelArgs::Address ParseEndpointUri(
             std::string(port_view).c_str());
   }
   address.address_str = std::string(host_view);
-  auto resolved_address = StringToSockaddr(uri->path());
+  auto resolved_address = StringToSockaddr(path);
   if (!resolved_address.ok()) {
     gpr_log(GPR_DEBUG, "Address \"%s\" is not IPv4/IPv6. Error: %s",
-            uri->path().c_str(), resolved_address.status().ToString().c_str());
+            path.c_str(), resolved_address.status().ToString().c_str());
     memset(&address.address, 0, sizeof(address.address));
   } else {
     address.address = *resolved_address;
@@ -20,10 +20,86 @@
 #include <map>
 #include <utility>
 
+#include "absl/strings/match.h"
+
 namespace grpc_core {
 
+namespace {
+
+// Collects path matchers such that \a permission can only match a request
+// whose path matches one of them, i.e. a necessary condition. Returns false
+// if no such condition could be established, in which case the policy must
+// always be treated as a candidate. Deliberately does not descend into kNot
+// (negation inverts conditions) or non-path rules.
+bool ExtractPathConstraints(const Rbac::Permission& permission,
+                            std::vector<const StringMatcher*>* out) {
+  switch (permission.type) {
+    case Rbac::Permission::RuleType::kPath:
+      // Only constraint types the index can evaluate exactly are usable.
+      switch (permission.string_matcher.type()) {
+        case StringMatcher::Type::kExact:
+        case StringMatcher::Type::kPrefix:
+          if (!permission.string_matcher.case_sensitive()) return false;
+          break;
+        case StringMatcher::Type::kSafeRegex:
+          break;
+        default:
+          return false;
+      }
+      out->push_back(&permission.string_matcher);
+      return true;
+    case Rbac::Permission::RuleType::kAnd:
+      // Any one conjunct's necessary condition is a necessary condition of
+      // the conjunction.
+      for (const auto& child : permission.permissions) {
+        std::vector<const StringMatcher*> child_matchers;
+        if (ExtractPathConstraints(*child, &child_matchers)) {
+          out->insert(out->end(), child_matchers.begin(),
+                      child_matchers.end());
+          return true;
+        }
+      }
+      return false;
+    case Rbac::Permission::RuleType::kOr: {
+      // Every disjunct must contribute a condition, or none holds.
+      std::vector<const StringMatcher*> all_matchers;
+      for (const auto& child : permission.permissions) {
+        std::vector<const StringMatcher*> child_matchers;
+        if (!ExtractPathConstraints(*child, &child_matchers)) return false;
+        all_matchers.insert(all_matchers.end(), child_matchers.begin(),
+                            child_matchers.end());
+      }
+      out->insert(out->end(), all_matchers.begin(), all_matchers.end());
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+void SetPolicyBit(std::vector<uint64_t>* bits, size_t num_words,
+                  size_t index) {
+  bits->resize(num_words, 0);
+  (*bits)[index / 64] |= uint64_t{1} << (index % 64);
+}
+
+}  // namespace
+
 GrpcAuthorizationEngine::GrpcAuthorizationEngine(Rbac policy)
     : action_(policy.action) {
+  // Extract each policy's path constraints while the Rbac config is still
+  // intact, then compile them into the shared path index.
+  std::vector<std::vector<const StringMatcher*>> constraints;
+  std::vector<bool> constrained;
+  constraints.reserve(policy.policies.size());
+  constrained.reserve(policy.policies.size());
+  for (const auto& sub_policy : policy.policies) {
+    std::vector<const StringMatcher*> matchers;
+    constrained.push_back(
+        ExtractPathConstraints(sub_policy.second.permissions, &matchers));
+    constraints.push_back(std::move(matchers));
+  }
+  BuildPathIndex(constraints, constrained);
   for (auto& sub_policy : policy.policies) {
     Policy policy;
     policy.name = sub_policy.first;
@@ -33,14 +109,85 @@ GrpcAuthorizationEngine::GrpcAuthorizationEngine(Rbac policy)
   }
 }
 
+void GrpcAuthorizationEngine::BuildPathIndex(
+    const std::vector<std::vector<const StringMatcher*>>& constraints,
+    const std::vector<bool>& constrained) {
+  const size_t num_policies = constraints.size();
+  if (num_policies == 0) return;
+  const size_t num_words = (num_policies + 63) / 64;
+  PathIndex index;
+  std::vector<std::pair<std::string, PathIndex::PolicyBits>> regexes;
+  for (size_t i = 0; i < num_policies; ++i) {
+    if (!constrained[i]) {
+      SetPolicyBit(&index.unconstrained, num_words, i);
+      continue;
+    }
+    for (const StringMatcher* matcher : constraints[i]) {
+      switch (matcher->type()) {
+        case StringMatcher::Type::kExact:
+          SetPolicyBit(&index.exact_paths[matcher->string_matcher()],
+                       num_words, i);
+          break;
+        case StringMatcher::Type::kPrefix: {
+          auto it = std::find_if(
+              index.path_prefixes.begin(), index.path_prefixes.end(),
+              [&](const std::pair<std::string, PathIndex::PolicyBits>& p) {
+                return p.first == matcher->string_matcher();
+              });
+          if (it == index.path_prefixes.end()) {
+            index.path_prefixes.emplace_back(matcher->string_matcher(),
+                                             PathIndex::PolicyBits());
+            it = index.path_prefixes.end() - 1;
+          }
+          SetPolicyBit(&it->second, num_words, i);
+          break;
+        }
+        case StringMatcher::Type::kSafeRegex: {
+          const std::string& pattern = matcher->regex_matcher()->pattern();
+          auto it = std::find_if(
+              regexes.begin(), regexes.end(),
+              [&](const std::pair<std::string, PathIndex::PolicyBits>& p) {
+                return p.first == pattern;
+              });
+          if (it == regexes.end()) {
+            regexes.emplace_back(pattern, PathIndex::PolicyBits());
+            it = regexes.end() - 1;
+          }
+          SetPolicyBit(&it->second, num_words, i);
+          break;
+        }
+        default:
+          // ExtractPathConstraints only emits the types above.
+          return;
+      }
+    }
+  }
+  if (!regexes.empty()) {
+    // One combined regex set; anchored both ways to reproduce the full-match
+    // semantics of StringMatcher's kSafeRegex.
+    index.regex_set =
+        std::make_unique<RE2::Set>(RE2::Options(), RE2::ANCHOR_BOTH);
+    for (auto& regex : regexes) {
+      if (index.regex_set->Add(regex.first, nullptr) < 0) return;
+      index.regex_policies.push_back(std::move(regex.second));
+    }
+    if (!index.regex_set->Compile()) return;
+  }
+  index.built = true;
+  path_index_ = std::move(index);
+}
+
 GrpcAuthorizationEngine::GrpcAuthorizationEngine(
     GrpcAuthorizationEngine&& other) noexcept
-    : action_(other.action_), policies_(std::move(other.policies_)) {}
+    : action_(other.action_),
+      policies_(std::move(other.policies_)),
+      path_index_(std::move(other.path_index_)) {}
 
 GrpcAuthorizationEngine& GrpcAuthorizationEngine::operator=(
     GrpcAuthorizationEngine&& other) noexcept {
   action_ = other.action_;
   policies_ = std::move(other.policies_);
+  path_index_ = std::move(other.path_index_);
   return *this;
 }
 
@@ -48,11 +195,51 @@ AuthorizationEngine::Decision GrpcAuthorizationEngine::Evaluate(
     const EvaluateArgs& args) const {
   Decision decision;
   bool matches = false;
-  for (const auto& policy : policies_) {
-    if (policy.matcher->Matches(args)) {
-      matches = true;
-      decision.matching_policy_name = policy.name;
-      break;
+  if (path_index_.built) {
+    // One pass over the shared path structures yields the candidate set;
+    // only those policies' full matcher trees run below.
+    PathIndex::PolicyBits candidates = path_index_.unconstrained;
+    candidates.resize((policies_.size() + 63) / 64, 0);
+    auto or_in = [&candidates](const PathIndex::PolicyBits& bits) {
+      for (size_t word = 0; word < bits.size(); ++word) {
+        candidates[word] |= bits[word];
+      }
+    };
+    absl::string_view path = args.GetPath();
+    auto exact_it = path_index_.exact_paths.find(path);
+    if (exact_it != path_index_.exact_paths.end()) or_in(exact_it->second);
+    for (const auto& prefix : path_index_.path_prefixes) {
+      if (absl::StartsWith(path, prefix.first)) or_in(prefix.second);
+    }
+    if (path_index_.regex_set != nullptr) {
+      std::vector<int> matched_regexes;
+      if (path_index_.regex_set->Match(
+              re2::StringPiece(path.data(), path.size()), &matched_regexes)) {
+        for (int regex : matched_regexes) {
+          or_in(path_index_.regex_policies[regex]);
+        }
+      }
+    }
+    for (size_t i = 0; i < policies_.size(); ++i) {
+      if (candidates[i / 64] == 0) {
+        // skip the whole word of non-candidates
+        i |= 63;
+        continue;
+      }
+      if ((candidates[i / 64] & (uint64_t{1} << (i % 64))) == 0) continue;
+      if (policies_[i].matcher->Matches(args)) {
+        matches = true;
+        decision.matching_policy_name = policies_[i].name;
+        break;
+      }
+    }
+  } else {
+    for (const auto& policy : policies_) {
+      if (policy.matcher->Matches(args)) {
+        matches = true;
+        decision.matching_policy_name = policy.name;
+        break;
+      }
     }
   }
   decision.type = (matches == (action_ == Rbac::Action::kAllow))
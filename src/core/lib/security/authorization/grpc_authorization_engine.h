@@ -18,11 +18,16 @@
 #include <grpc/support/port_platform.h>
 
 #include <stddef.h>
+#include <stdint.h>
 
+#include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "re2/set.h"
+
 #include "src/core/lib/security/authorization/authorization_engine.h"
 #include "src/core/lib/security/authorization/evaluate_args.h"
 #include "src/core/lib/security/authorization/matchers.h"
@@ -60,8 +65,36 @@ class GrpcAuthorizationEngine : public AuthorizationEngine {
     std::string name;
     std::unique_ptr<AuthorizationMatcher> matcher;
   };
+
+  // Index over the policies' path constraints, compiled once at
+  // construction. For every policy whose permissions imply "the request
+  // path must match one of these matchers", the matchers are merged into
+  // shared lookup structures (an exact-path table, a prefix table, and one
+  // combined RE2 set), each mapping to a bitset of candidate policies.
+  // Evaluate() then consults the index once per request and only runs the
+  // full matcher trees of the candidate policies, so the per-call cost is
+  // governed by the number of distinct path patterns rather than the number
+  // of rules. Policies without a recognizable path constraint are always
+  // candidates; if the index cannot be built it stays unused and evaluation
+  // falls back to the sequential scan.
+  struct PathIndex {
+    // One bit per policy, in policies_ order.
+    using PolicyBits = std::vector<uint64_t>;
+    bool built = false;
+    PolicyBits unconstrained;
+    std::map<std::string, PolicyBits, std::less<>> exact_paths;
+    std::vector<std::pair<std::string, PolicyBits>> path_prefixes;
+    std::unique_ptr<RE2::Set> regex_set;
+    std::vector<PolicyBits> regex_policies;
+  };
+
+  void BuildPathIndex(
+      const std::vector<std::vector<const StringMatcher*>>& constraints,
+      const std::vector<bool>& constrained);
+
   Rbac::Action action_;
   std::vector<Policy> policies_;
+  PathIndex path_index_;
 };
 
 }  // namespace grpc_core
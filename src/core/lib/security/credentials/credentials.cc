@@ -107,6 +107,8 @@ void grpc_server_credentials::set_auth_metadata_processor(
       3, (this, (void*)(intptr_t)processor.process, processor.state));
   DestroyProcessor();
   processor_ = processor;
+  // Results cached for the previous processor are meaningless for this one.
+  InvalidateAuthResultCache();
 }
 
 void grpc_server_credentials_set_auth_metadata_processor(
@@ -115,6 +117,14 @@ void grpc_server_credentials_set_auth_metadata_processor(
   creds->set_auth_metadata_processor(processor);
 }
 
+void grpc_server_credentials_invalidate_auth_result_cache(
+    grpc_server_credentials* creds) {
+  GRPC_API_TRACE("grpc_server_credentials_invalidate_auth_result_cache(creds=%p)",
+                 1, (creds));
+  GPR_DEBUG_ASSERT(creds != nullptr);
+  creds->InvalidateAuthResultCache();
+}
+
 static void server_credentials_pointer_arg_destroy(void* p) {
   static_cast<grpc_server_credentials*>(p)->Unref();
 }
@@ -21,6 +21,7 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <atomic>
 #include <string>
 #include <utility>
 #include <vector>
@@ -279,6 +280,17 @@ struct grpc_server_credentials
   void set_auth_metadata_processor(
       const grpc_auth_metadata_processor& processor);
 
+  // Caches of auth metadata processor results (see
+  // GRPC_ARG_SERVER_AUTH_RESULT_CACHE_TTL_MS) snapshot this generation and
+  // drop their entries when it no longer matches, so bumping it invalidates
+  // every cached result for these credentials.
+  int64_t auth_result_cache_generation() const {
+    return auth_result_cache_generation_.load(std::memory_order_relaxed);
+  }
+  void InvalidateAuthResultCache() {
+    auth_result_cache_generation_.fetch_add(1, std::memory_order_relaxed);
+  }
+
  private:
   void DestroyProcessor() {
     if (processor_.destroy != nullptr && processor_.state != nullptr) {
@@ -288,6 +300,7 @@ struct grpc_server_credentials
 
   grpc_auth_metadata_processor processor_ =
       grpc_auth_metadata_processor();  // Zero-initialize the C struct.
+  std::atomic<int64_t> auth_result_cache_generation_{0};
 };
 
 grpc_arg grpc_server_credentials_to_arg(grpc_server_credentials* c);
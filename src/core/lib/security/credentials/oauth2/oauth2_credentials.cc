@@ -253,15 +253,22 @@ void grpc_oauth2_token_fetcher_credentials::on_http_response(
   // Update cache and grab list of pending requests.
   gpr_mu_lock(&mu_);
   token_fetch_pending_ = false;
-  if (access_token_value.has_value()) {
-    access_token_value_ = access_token_value->Ref();
-  } else {
-    access_token_value_ = absl::nullopt;
+  if (status == GRPC_CREDENTIALS_OK && access_token_value.has_value()) {
+    const gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
+    auto token = std::make_shared<CachedToken>();
+    token->token_value = access_token_value->Ref();
+    token->expiration = gpr_time_add(now, token_lifetime.as_timespec());
+    token->refresh_after = gpr_time_add(
+        now, gpr_time_from_millis(static_cast<int64_t>(token_refresh_fraction_ *
+                                                       token_lifetime.millis()),
+                                  GPR_TIMESPAN));
+    std::atomic_store_explicit(&cached_token_,
+                               std::shared_ptr<const CachedToken>(token),
+                               std::memory_order_release);
   }
-  token_expiration_ = status == GRPC_CREDENTIALS_OK
-                          ? gpr_time_add(gpr_now(GPR_CLOCK_MONOTONIC),
-                                         token_lifetime.as_timespec())
-                          : gpr_inf_past(GPR_CLOCK_MONOTONIC);
+  // On failure any previously cached token is kept: it may still be inside
+  // its lifetime (the failed fetch was then an ahead-of-expiry refresh, and
+  // a later call will retry), and if it has expired readers ignore it.
   grpc_oauth2_pending_get_request_metadata* pending_request = pending_requests_;
   pending_requests_ = nullptr;
   gpr_mu_unlock(&mu_);
@@ -292,36 +299,53 @@ grpc_core::ArenaPromise<absl::StatusOr<grpc_core::ClientMetadataHandle>>
 grpc_oauth2_token_fetcher_credentials::GetRequestMetadata(
     grpc_core::ClientMetadataHandle initial_metadata,
     const grpc_call_credentials::GetRequestMetadataArgs*) {
-  // Check if we can use the cached token.
-  absl::optional<grpc_core::Slice> cached_access_token_value;
-  gpr_mu_lock(&mu_);
-  if (access_token_value_.has_value() &&
+  // Check if we can use the cached token. The snapshot is read with an
+  // atomic load, so calls with a fresh token never touch mu_.
+  const gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
+  std::shared_ptr<const CachedToken> cached = std::atomic_load_explicit(
+      &cached_token_, std::memory_order_acquire);
+  if (cached != nullptr &&
       gpr_time_cmp(
-          gpr_time_sub(token_expiration_, gpr_now(GPR_CLOCK_MONOTONIC)),
+          gpr_time_sub(cached->expiration, now),
           gpr_time_from_seconds(GRPC_SECURE_TOKEN_REFRESH_THRESHOLD_SECS,
                                 GPR_TIMESPAN)) > 0) {
-    cached_access_token_value = access_token_value_->Ref();
-  }
-  if (cached_access_token_value.has_value()) {
-    gpr_mu_unlock(&mu_);
+    // Ahead-of-expiry refresh: past the refresh point, keep serving the
+    // cached token but fetch its replacement in the background so it is in
+    // place before anyone has to wait for it.
+    if (gpr_time_cmp(now, cached->refresh_after) >= 0) {
+      maybe_start_fetch();
+    }
     initial_metadata->Append(
-        GRPC_AUTHORIZATION_METADATA_KEY, std::move(*cached_access_token_value),
+        GRPC_AUTHORIZATION_METADATA_KEY, cached->token_value.Ref(),
         [](absl::string_view, const grpc_core::Slice&) { abort(); });
     return grpc_core::Immediate(std::move(initial_metadata));
   }
   // Couldn't get the token from the cache.
   // Add request to pending_requests_ and start a new fetch if needed.
-  grpc_core::Duration refresh_threshold =
-      grpc_core::Duration::Seconds(GRPC_SECURE_TOKEN_REFRESH_THRESHOLD_SECS);
   auto pending_request =
       grpc_core::MakeRefCounted<grpc_oauth2_pending_get_request_metadata>();
   pending_request->pollent = grpc_core::GetContext<grpc_polling_entity>();
   pending_request->waker = grpc_core::Activity::current()->MakeNonOwningWaker();
   grpc_polling_entity_add_to_pollset_set(
       pending_request->pollent, grpc_polling_entity_pollset_set(&pollent_));
-  pending_request->next = pending_requests_;
   pending_request->md = std::move(initial_metadata);
+  gpr_mu_lock(&mu_);
+  pending_request->next = pending_requests_;
   pending_requests_ = pending_request->Ref().release();
+  gpr_mu_unlock(&mu_);
+  maybe_start_fetch();
+  return
+      [pending_request]()
+          -> grpc_core::Poll<absl::StatusOr<grpc_core::ClientMetadataHandle>> {
+        if (!pending_request->done.load(std::memory_order_acquire)) {
+          return grpc_core::Pending{};
+        }
+        return std::move(pending_request->result);
+      };
+}
+
+void grpc_oauth2_token_fetcher_credentials::maybe_start_fetch() {
+  gpr_mu_lock(&mu_);
   bool start_fetch = false;
   if (!token_fetch_pending_) {
     token_fetch_pending_ = true;
@@ -331,20 +355,16 @@ grpc_oauth2_token_fetcher_credentials::GetRequestMetadata(
   if (start_fetch) {
     fetch_oauth2(new grpc_credentials_metadata_request(Ref()), &pollent_,
                  on_oauth2_token_fetcher_http_response,
-                 grpc_core::Timestamp::Now() + refresh_threshold);
+                 grpc_core::Timestamp::Now() +
+                     grpc_core::Duration::Seconds(
+                         GRPC_SECURE_TOKEN_REFRESH_THRESHOLD_SECS));
   }
-  return
-      [pending_request]()
-          -> grpc_core::Poll<absl::StatusOr<grpc_core::ClientMetadataHandle>> {
-        if (!pending_request->done.load(std::memory_order_acquire)) {
-          return grpc_core::Pending{};
-        }
-        return std::move(pending_request->result);
-      };
 }
 
-grpc_oauth2_token_fetcher_credentials::grpc_oauth2_token_fetcher_credentials()
-    : token_expiration_(gpr_inf_past(GPR_CLOCK_MONOTONIC)),
+grpc_oauth2_token_fetcher_credentials::grpc_oauth2_token_fetcher_credentials(
+    double token_refresh_fraction)
+    : token_refresh_fraction_(
+          grpc_core::Clamp(token_refresh_fraction, 0.1, 1.0)),
       pollent_(grpc_polling_entity_create_from_pollset_set(
           grpc_pollset_set_create())) {
   gpr_mu_init(&mu_);
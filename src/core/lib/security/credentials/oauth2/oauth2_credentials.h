@@ -22,6 +22,7 @@
 #include <grpc/support/port_platform.h>
 
 #include <atomic>
+#include <memory>
 #include <string>
 #include <utility>
 
@@ -111,7 +112,12 @@ struct grpc_oauth2_pending_get_request_metadata
 
 class grpc_oauth2_token_fetcher_credentials : public grpc_call_credentials {
  public:
-  grpc_oauth2_token_fetcher_credentials();
+  // token_refresh_fraction controls ahead-of-expiry refresh: once a token has
+  // lived that fraction of its lifetime, the next call using it also kicks
+  // off a background fetch, so in steady state the token is replaced long
+  // before any call would have to block on it.
+  explicit grpc_oauth2_token_fetcher_credentials(
+      double token_refresh_fraction = 0.8);
   ~grpc_oauth2_token_fetcher_credentials() override;
 
   grpc_core::ArenaPromise<absl::StatusOr<grpc_core::ClientMetadataHandle>>
@@ -130,15 +136,29 @@ class grpc_oauth2_token_fetcher_credentials : public grpc_call_credentials {
                             grpc_core::Timestamp deadline) = 0;
 
  private:
+  // An immutable fetched-token snapshot, published with atomic shared_ptr
+  // stores so that calls read the current token without taking mu_.
+  struct CachedToken {
+    grpc_core::Slice token_value;
+    // Hard expiry (minus the refresh threshold the token is unusable).
+    gpr_timespec expiration;
+    // Point at which calls start kicking off a background refresh while
+    // still using this token.
+    gpr_timespec refresh_after;
+  };
+
   int cmp_impl(const grpc_call_credentials* other) const override {
     // TODO(yashykt): Check if we can do something better here
     return grpc_core::QsortCompare(
         static_cast<const grpc_call_credentials*>(this), other);
   }
 
+  // Starts a fetch unless one is already in flight.
+  void maybe_start_fetch();
+
+  const double token_refresh_fraction_;
   gpr_mu mu_;
-  absl::optional<grpc_core::Slice> access_token_value_;
-  gpr_timespec token_expiration_;
+  std::shared_ptr<const CachedToken> cached_token_;
   bool token_fetch_pending_ = false;
   grpc_oauth2_pending_get_request_metadata* pending_requests_ = nullptr;
   grpc_polling_entity pollent_;
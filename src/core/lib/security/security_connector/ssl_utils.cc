@@ -95,6 +95,21 @@ static void init_cipher_suites(void) {
   cipher_suites = value.release();
 }
 
+/* -- Verified certificate cache. -- */
+
+// Each channel credentials object creates its own handshaker factory, so the
+// cache is naturally keyed by (credentials, peer chain hash).
+GPR_GLOBAL_CONFIG_DEFINE_INT32(
+    grpc_ssl_verified_cert_cache_ttl_secs, 0,
+    "TTL in seconds for caching peer certificate chains that already passed "
+    "full X509 verification, so that reconnects presenting an identical chain "
+    "skip redundant signature checks. 0 disables the cache.")
+
+static size_t grpc_ssl_verified_cert_cache_ttl_secs(void) {
+  int32_t ttl = GPR_GLOBAL_CONFIG_GET(grpc_ssl_verified_cert_cache_ttl_secs);
+  return ttl > 0 ? static_cast<size_t>(ttl) : 0;
+}
+
 /* --- Util --- */
 
 const char* grpc_get_ssl_cipher_suites(void) {
@@ -463,6 +478,7 @@ grpc_security_status grpc_ssl_tsi_client_handshaker_factory_init(
   options.min_tls_version = min_tls_version;
   options.max_tls_version = max_tls_version;
   options.crl_directory = crl_directory;
+  options.verified_cert_cache_ttl_secs = grpc_ssl_verified_cert_cache_ttl_secs();
   const tsi_result result =
       tsi_create_ssl_client_handshaker_factory_with_options(&options,
                                                             handshaker_factory);
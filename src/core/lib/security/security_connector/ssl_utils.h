@@ -23,6 +23,7 @@
 
 #include <stddef.h>
 
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -142,42 +143,47 @@ class DefaultSslRootStore {
   static grpc_slice default_pem_root_certs_;
 };
 
+// An immutable snapshot of one PEM private key and certificate chain.  The
+// payload is refcounted: copying a PemKeyCertPair (and hence a
+// PemKeyCertPairList) shares the underlying bytes, so fanning identity
+// material out from a certificate distributor to many security connectors
+// does not duplicate the PEM data per connector.
 class PemKeyCertPair {
  public:
   PemKeyCertPair(absl::string_view private_key, absl::string_view cert_chain)
-      : private_key_(private_key), cert_chain_(cert_chain) {}
+      : private_key_(std::make_shared<const std::string>(private_key)),
+        cert_chain_(std::make_shared<const std::string>(cert_chain)) {}
 
-  // Movable.
-  PemKeyCertPair(PemKeyCertPair&& other) noexcept {
-    private_key_ = std::move(other.private_key_);
-    cert_chain_ = std::move(other.cert_chain_);
-  }
+  // Movable.  Moves share rather than transfer the payload so that the
+  // moved-from pair remains usable.
+  PemKeyCertPair(PemKeyCertPair&& other) noexcept
+      : private_key_(other.private_key_), cert_chain_(other.cert_chain_) {}
   PemKeyCertPair& operator=(PemKeyCertPair&& other) noexcept {
-    private_key_ = std::move(other.private_key_);
-    cert_chain_ = std::move(other.cert_chain_);
+    private_key_ = other.private_key_;
+    cert_chain_ = other.cert_chain_;
     return *this;
   }
 
   // Copyable.
-  PemKeyCertPair(const PemKeyCertPair& other)
-      : private_key_(other.private_key()), cert_chain_(other.cert_chain()) {}
-  PemKeyCertPair& operator=(const PemKeyCertPair& other) {
-    private_key_ = other.private_key();
-    cert_chain_ = other.cert_chain();
-    return *this;
-  }
+  PemKeyCertPair(const PemKeyCertPair& other) = default;
+  PemKeyCertPair& operator=(const PemKeyCertPair& other) = default;
 
   bool operator==(const PemKeyCertPair& other) const {
+    // Pairs sharing their payload compare equal without touching the bytes.
+    if (private_key_ == other.private_key_ &&
+        cert_chain_ == other.cert_chain_) {
+      return true;
+    }
     return this->private_key() == other.private_key() &&
            this->cert_chain() == other.cert_chain();
   }
 
-  const std::string& private_key() const { return private_key_; }
-  const std::string& cert_chain() const { return cert_chain_; }
+  const std::string& private_key() const { return *private_key_; }
+  const std::string& cert_chain() const { return *cert_chain_; }
 
  private:
-  std::string private_key_;
-  std::string cert_chain_;
+  std::shared_ptr<const std::string> private_key_;
+  std::shared_ptr<const std::string> cert_chain_;
 };
 
 using PemKeyCertPairList = std::vector<PemKeyCertPair>;
@@ -20,10 +20,14 @@
 
 #include "src/core/lib/security/security_connector/tls/tls_security_connector.h"
 
+#include <stdint.h>
 #include <string.h>
 
 #include <algorithm>
+#include <deque>
+#include <map>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -223,6 +227,106 @@ tsi_ssl_pem_key_cert_pair* ConvertToTsiPemKeyCertPair(
   return tsi_pairs;
 }
 
+// Appends a length-prefixed field to a factory cache key, so that
+// concatenated fields cannot collide.
+void AppendKeyField(absl::string_view value, std::string* key) {
+  absl::StrAppend(key, value.size(), ":", value);
+}
+
+// Appends the key material shared by client and server cache keys.
+void AppendKeyMaterialFields(
+    const absl::optional<absl::string_view>& pem_root_certs,
+    const absl::optional<PemKeyCertPairList>& pem_key_cert_pair_list,
+    const std::string& crl_directory, tsi_tls_version min_tls_version,
+    tsi_tls_version max_tls_version, std::string* key) {
+  AppendKeyField(pem_root_certs.has_value() ? *pem_root_certs : "", key);
+  if (pem_key_cert_pair_list.has_value()) {
+    for (const PemKeyCertPair& pair : *pem_key_cert_pair_list) {
+      AppendKeyField(pair.private_key(), key);
+      AppendKeyField(pair.cert_chain(), key);
+    }
+  }
+  AppendKeyField(crl_directory, key);
+  absl::StrAppend(key, static_cast<int>(min_tls_version), ":",
+                  static_cast<int>(max_tls_version), ":");
+}
+
+// Bounded cache of parsed handshaker factories, keyed by the exact inputs
+// used to build them. When a certificate rotation fans out to many
+// per-subchannel security connectors, only the first connector pays for
+// parsing the PEM material into an SSL_CTX; the others share the factory by
+// reference, making rotation O(1) in the number of subchannels. Entries are
+// evicted in insertion order once the cache is full; connectors holding a
+// ref keep their factory alive past eviction.
+class HandshakerFactoryCache {
+ public:
+  static HandshakerFactoryCache* Get() {
+    static HandshakerFactoryCache* cache = new HandshakerFactoryCache();
+    return cache;
+  }
+
+  // On hit, returns the cached factory with a new ref. Returns nullptr on
+  // miss.
+  tsi_ssl_client_handshaker_factory* GetClient(const std::string& key) {
+    MutexLock lock(&mu_);
+    auto it = client_factories_.find(key);
+    if (it == client_factories_.end()) return nullptr;
+    return tsi_ssl_client_handshaker_factory_ref(it->second);
+  }
+
+  tsi_ssl_server_handshaker_factory* GetServer(const std::string& key) {
+    MutexLock lock(&mu_);
+    auto it = server_factories_.find(key);
+    if (it == server_factories_.end()) return nullptr;
+    return tsi_ssl_server_handshaker_factory_ref(it->second);
+  }
+
+  // Takes its own ref to the factory; the caller keeps its ref.
+  void PutClient(const std::string& key,
+                 tsi_ssl_client_handshaker_factory* factory) {
+    MutexLock lock(&mu_);
+    if (!client_factories_.emplace(key, factory).second) return;
+    tsi_ssl_client_handshaker_factory_ref(factory);
+    client_insertion_order_.push_back(key);
+    if (client_insertion_order_.size() > kMaxEntriesPerMap) {
+      auto victim = client_factories_.find(client_insertion_order_.front());
+      tsi_ssl_client_handshaker_factory_unref(victim->second);
+      client_factories_.erase(victim);
+      client_insertion_order_.pop_front();
+    }
+  }
+
+  void PutServer(const std::string& key,
+                 tsi_ssl_server_handshaker_factory* factory) {
+    MutexLock lock(&mu_);
+    if (!server_factories_.emplace(key, factory).second) return;
+    tsi_ssl_server_handshaker_factory_ref(factory);
+    server_insertion_order_.push_back(key);
+    if (server_insertion_order_.size() > kMaxEntriesPerMap) {
+      auto victim = server_factories_.find(server_insertion_order_.front());
+      tsi_ssl_server_handshaker_factory_unref(victim->second);
+      server_factories_.erase(victim);
+      server_insertion_order_.pop_front();
+    }
+  }
+
+ private:
+  // Rotations replace an old entry with a new one for every distinct
+  // credential configuration in the process, so only a handful of live
+  // entries are ever needed at once.
+  static constexpr size_t kMaxEntriesPerMap = 16;
+
+  Mutex mu_;
+  std::map<std::string, tsi_ssl_client_handshaker_factory*> client_factories_
+      ABSL_GUARDED_BY(mu_);
+  std::deque<std::string> client_insertion_order_ ABSL_GUARDED_BY(mu_);
+  std::map<std::string, tsi_ssl_server_handshaker_factory*> server_factories_
+      ABSL_GUARDED_BY(mu_);
+  std::deque<std::string> server_insertion_order_ ABSL_GUARDED_BY(mu_);
+};
+
+constexpr size_t HandshakerFactoryCache::kMaxEntriesPerMap;
+
 }  // namespace
 
 // -------------------channel security connector-------------------
@@ -525,6 +629,28 @@ TlsChannelSecurityConnector::UpdateHandshakerFactoryLocked() {
   if (client_handshaker_factory_ != nullptr) {
     tsi_ssl_client_handshaker_factory_unref(client_handshaker_factory_);
   }
+  bool use_default_roots = !options_->watch_root_cert();
+  // Check whether another connector has already parsed the same material into
+  // a factory. The session cache and the session key logger are baked into
+  // the factory, so a factory is only shared between connectors created from
+  // the same credentials object -- in particular, between the
+  // per-subchannel connectors a certificate rotation fans out to.
+  std::string cache_key = "client:";
+  absl::StrAppend(&cache_key, use_default_roots ? 1 : 0,
+                  skip_server_certificate_verification ? 1 : 0, ":",
+                  reinterpret_cast<uintptr_t>(ssl_session_cache_), ":",
+                  reinterpret_cast<uintptr_t>(tls_session_key_logger_.get()),
+                  ":");
+  AppendKeyMaterialFields(pem_root_certs_, pem_key_cert_pair_list_,
+                          options_->crl_directory(),
+                          grpc_get_tsi_tls_version(options_->min_tls_version()),
+                          grpc_get_tsi_tls_version(options_->max_tls_version()),
+                          &cache_key);
+  client_handshaker_factory_ =
+      HandshakerFactoryCache::Get()->GetClient(cache_key);
+  if (client_handshaker_factory_ != nullptr) {
+    return GRPC_SECURITY_OK;
+  }
   std::string pem_root_certs;
   if (pem_root_certs_.has_value()) {
     // TODO(ZhenLian): update the underlying TSI layer to use C++ types like
@@ -535,7 +661,6 @@ TlsChannelSecurityConnector::UpdateHandshakerFactoryLocked() {
   if (pem_key_cert_pair_list_.has_value()) {
     pem_key_cert_pair = ConvertToTsiPemKeyCertPair(*pem_key_cert_pair_list_);
   }
-  bool use_default_roots = !options_->watch_root_cert();
   grpc_security_status status = grpc_ssl_tsi_client_handshaker_factory_init(
       pem_key_cert_pair,
       pem_root_certs.empty() || use_default_roots ? nullptr
@@ -549,6 +674,10 @@ TlsChannelSecurityConnector::UpdateHandshakerFactoryLocked() {
   if (pem_key_cert_pair != nullptr) {
     grpc_tsi_ssl_pem_key_cert_pairs_destroy(pem_key_cert_pair, 1);
   }
+  if (status == GRPC_SECURITY_OK) {
+    HandshakerFactoryCache::Get()->PutClient(cache_key,
+                                             client_handshaker_factory_);
+  }
   return status;
 }
 
@@ -801,6 +930,23 @@ TlsServerSecurityConnector::UpdateHandshakerFactoryLocked() {
   // The identity certs on the server side shouldn't be empty.
   GPR_ASSERT(pem_key_cert_pair_list_.has_value());
   GPR_ASSERT(!(*pem_key_cert_pair_list_).empty());
+  // Check whether another connector has already parsed the same material
+  // into a factory (see the note on sharing in the client counterpart).
+  std::string cache_key = "server:";
+  absl::StrAppend(&cache_key, static_cast<int>(options_->cert_request_type()),
+                  ":",
+                  reinterpret_cast<uintptr_t>(tls_session_key_logger_.get()),
+                  ":");
+  AppendKeyMaterialFields(pem_root_certs_, pem_key_cert_pair_list_,
+                          options_->crl_directory(),
+                          grpc_get_tsi_tls_version(options_->min_tls_version()),
+                          grpc_get_tsi_tls_version(options_->max_tls_version()),
+                          &cache_key);
+  server_handshaker_factory_ =
+      HandshakerFactoryCache::Get()->GetServer(cache_key);
+  if (server_handshaker_factory_ != nullptr) {
+    return GRPC_SECURITY_OK;
+  }
   std::string pem_root_certs;
   if (pem_root_certs_.has_value()) {
     // TODO(ZhenLian): update the underlying TSI layer to use C++ types like
@@ -821,6 +967,10 @@ TlsServerSecurityConnector::UpdateHandshakerFactoryLocked() {
   /* Free memory. */
   grpc_tsi_ssl_pem_key_cert_pairs_destroy(pem_key_cert_pairs,
                                           num_key_cert_pairs);
+  if (status == GRPC_SECURITY_OK) {
+    HandshakerFactoryCache::Get()->PutServer(cache_key,
+                                             server_handshaker_factory_);
+  }
   return status;
 }
 
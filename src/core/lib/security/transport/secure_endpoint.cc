@@ -383,7 +383,8 @@ static void flush_write_staging_buffer(secure_endpoint* ep, uint8_t** cur,
 }
 
 static void endpoint_write(grpc_endpoint* secure_ep, grpc_slice_buffer* slices,
-                           grpc_closure* cb, void* arg, int max_frame_size) {
+                           grpc_closure* cb, void* arg, int max_frame_size,
+                           bool more_coming) {
   unsigned i;
   tsi_result result = TSI_OK;
   secure_endpoint* ep = reinterpret_cast<secure_endpoint*>(secure_ep);
@@ -492,7 +493,7 @@ static void endpoint_write(grpc_endpoint* secure_ep, grpc_slice_buffer* slices,
   }
 
   grpc_endpoint_write(ep->wrapped_ep, &ep->output_buffer, cb, arg,
-                      max_frame_size);
+                      max_frame_size, more_coming);
 }
 
 static void endpoint_shutdown(grpc_endpoint* secure_ep, grpc_error_handle why) {
@@ -556,6 +557,16 @@ static const grpc_endpoint_vtable vtable = {endpoint_read,
                                             endpoint_get_fd,
                                             endpoint_can_track_err};
 
+// NOTE: Kernel TLS offload (installing the negotiated traffic secrets via
+// setsockopt(SOL_TLS) and bypassing the frame protector) has been
+// considered for this endpoint, but it is not implementable with the
+// current TSI architecture: the TSI SSL handshaker runs the TLS session
+// over in-memory BIO pairs rather than the socket itself, and neither
+// BoringSSL nor the OpenSSL versions we support expose the post-handshake
+// traffic secrets needed to populate tls_crypto_info. If the SSL stack
+// ever grows such an API, the offload belongs here: install the secrets
+// on the wrapped endpoint's fd at creation time and, on success, skip the
+// protect/unprotect calls in endpoint_read()/endpoint_write().
 grpc_endpoint* grpc_secure_endpoint_create(
     struct tsi_frame_protector* protector,
     struct tsi_zero_copy_grpc_protector* zero_copy_protector,
@@ -25,10 +25,13 @@
 #include <string.h>
 
 #include <algorithm>
+#include <deque>
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "absl/base/attributes.h"
+#include "absl/functional/any_invocable.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
@@ -39,11 +42,14 @@
 #include <grpc/slice.h>
 #include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
 
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channelz.h"
 #include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/sync.h"
@@ -70,6 +76,59 @@ namespace grpc_core {
 
 namespace {
 
+// Runs TSI handshake computations on EventEngine threads with bounded
+// concurrency, so that a storm of new connections cannot occupy the whole
+// thread pool and starve established traffic. Computations beyond the
+// concurrency limit are queued and started as running ones finish.
+class HandshakeComputeQueue {
+ public:
+  static HandshakeComputeQueue* Get() {
+    static HandshakeComputeQueue* queue = new HandshakeComputeQueue();
+    return queue;
+  }
+
+  void Schedule(absl::AnyInvocable<void()> fn) {
+    MutexLock lock(&mu_);
+    if (num_running_ < max_running_) {
+      ++num_running_;
+      RunOnEventEngine(std::move(fn));
+    } else {
+      queued_.push_back(std::move(fn));
+    }
+  }
+
+ private:
+  HandshakeComputeQueue()
+      : max_running_(Clamp(gpr_cpu_num_cores() / 2, 1u, 16u)) {}
+
+  void RunOnEventEngine(absl::AnyInvocable<void()> fn) {
+    grpc_event_engine::experimental::GetDefaultEventEngine()->Run(
+        [this, fn = std::move(fn)]() mutable {
+          fn();
+          ScheduleNextQueued();
+        });
+  }
+
+  void ScheduleNextQueued() {
+    absl::AnyInvocable<void()> next;
+    {
+      MutexLock lock(&mu_);
+      if (queued_.empty()) {
+        --num_running_;
+        return;
+      }
+      next = std::move(queued_.front());
+      queued_.pop_front();
+    }
+    RunOnEventEngine(std::move(next));
+  }
+
+  const unsigned max_running_;
+  Mutex mu_;
+  unsigned num_running_ ABSL_GUARDED_BY(mu_) = 0;
+  std::deque<absl::AnyInvocable<void()>> queued_ ABSL_GUARDED_BY(mu_);
+};
+
 class SecurityHandshaker : public Handshaker {
  public:
   SecurityHandshaker(tsi_handshaker* handshaker,
@@ -83,6 +142,8 @@ class SecurityHandshaker : public Handshaker {
   const char* name() const override { return "security"; }
 
  private:
+  void StartHandshakerNextLocked(RefCountedPtr<SecurityHandshaker> self,
+                                 size_t bytes_received_size);
   grpc_error_handle DoHandshakerNextLocked(const unsigned char* bytes_received,
                                            size_t bytes_received_size);
 
@@ -110,6 +171,7 @@ class SecurityHandshaker : public Handshaker {
   // State set at creation time.
   tsi_handshaker* handshaker_;
   RefCountedPtr<grpc_security_connector> connector_;
+  const bool offload_enabled_;
 
   Mutex mu_;
 
@@ -139,6 +201,8 @@ SecurityHandshaker::SecurityHandshaker(tsi_handshaker* handshaker,
                                        const ChannelArgs& args)
     : handshaker_(handshaker),
       connector_(connector->Ref(DEBUG_LOCATION, "handshake")),
+      offload_enabled_(
+          args.GetBool(GRPC_ARG_TSI_HANDSHAKE_OFFLOAD).value_or(false)),
       handshake_buffer_size_(GRPC_INITIAL_HANDSHAKE_BUFFER_SIZE),
       handshake_buffer_(
           static_cast<uint8_t*>(gpr_malloc(handshake_buffer_size_))),
@@ -468,6 +532,45 @@ grpc_error_handle SecurityHandshaker::DoHandshakerNextLocked(
                                    hs_result);
 }
 
+// Runs DoHandshakerNextLocked(), either inline or -- if handshake offload
+// is enabled -- on the bounded offload queue, so that the CPU-heavy TSI
+// computation does not block the polling thread. Takes ownership of the
+// caller's ref via |self| (where self.get() == this); as with direct
+// callers of DoHandshakerNextLocked(), the ref is released on success to
+// keep the handshaker alive for the next pipeline step, and dropped on
+// failure after HandshakeFailedLocked() has run.
+void SecurityHandshaker::StartHandshakerNextLocked(
+    RefCountedPtr<SecurityHandshaker> self, size_t bytes_received_size) {
+  if (!offload_enabled_) {
+    grpc_error_handle error =
+        DoHandshakerNextLocked(handshake_buffer_, bytes_received_size);
+    if (!error.ok()) {
+      HandshakeFailedLocked(error);
+    } else {
+      self.release();  // Avoid unref
+    }
+    return;
+  }
+  HandshakeComputeQueue::Get()->Schedule(
+      [self = std::move(self), bytes_received_size]() mutable {
+        ApplicationCallbackExecCtx app_exec_ctx;
+        ExecCtx exec_ctx;
+        MutexLock lock(&self->mu_);
+        if (self->is_shutdown_) {
+          // Generates a "Handshaker shutdown" error.
+          self->HandshakeFailedLocked(absl::OkStatus());
+          return;
+        }
+        grpc_error_handle error = self->DoHandshakerNextLocked(
+            self->handshake_buffer_, bytes_received_size);
+        if (!error.ok()) {
+          self->HandshakeFailedLocked(error);
+        } else {
+          self.release();  // Avoid unref
+        }
+      });
+}
+
 // This callback might be run inline while we are still holding on to the mutex,
 // so schedule OnHandshakeDataReceivedFromPeerFn on ExecCtx to avoid a deadlock.
 void SecurityHandshaker::OnHandshakeDataReceivedFromPeerFnScheduler(
@@ -493,12 +596,8 @@ void SecurityHandshaker::OnHandshakeDataReceivedFromPeerFn(
   // Copy all slices received.
   size_t bytes_received_size = h->MoveReadBufferIntoHandshakeBuffer();
   // Call TSI handshaker.
-  error = h->DoHandshakerNextLocked(h->handshake_buffer_, bytes_received_size);
-  if (!error.ok()) {
-    h->HandshakeFailedLocked(error);
-  } else {
-    h.release();  // Avoid unref
-  }
+  SecurityHandshaker* handshaker = h.get();
+  handshaker->StartHandshakerNextLocked(std::move(h), bytes_received_size);
 }
 
 // This callback might be run inline while we are still holding on to the mutex,
@@ -560,18 +659,15 @@ void SecurityHandshaker::Shutdown(grpc_error_handle why) {
 void SecurityHandshaker::DoHandshake(grpc_tcp_server_acceptor* /*acceptor*/,
                                      grpc_closure* on_handshake_done,
                                      HandshakerArgs* args) {
-  auto ref = Ref();
+  // Take a ref for the handshake computation; it is adopted by
+  // StartHandshakerNextLocked() below.
+  Ref().release();
   MutexLock lock(&mu_);
   args_ = args;
   on_handshake_done_ = on_handshake_done;
   size_t bytes_received_size = MoveReadBufferIntoHandshakeBuffer();
-  grpc_error_handle error =
-      DoHandshakerNextLocked(handshake_buffer_, bytes_received_size);
-  if (!error.ok()) {
-    HandshakeFailedLocked(error);
-  } else {
-    ref.release();  // Avoid unref
-  }
+  StartHandshakerNextLocked(RefCountedPtr<SecurityHandshaker>(this),
+                            bytes_received_size);
 }
 
 //
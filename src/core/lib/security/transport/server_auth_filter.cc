@@ -18,12 +18,19 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <limits.h>
+#include <stdint.h>
 #include <string.h>
 
 #include <algorithm>
+#include <map>
+#include <memory>
 #include <new>
+#include <string>
+#include <vector>
 
 #include "absl/status/status.h"
+#include "absl/strings/string_view.h"
 
 #include <grpc/grpc.h>
 #include <grpc/grpc_security.h>
@@ -33,12 +40,15 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/atm.h>
 #include <grpc/support/log.h>
+#include <grpc/support/time.h>
 
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_fwd.h"
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/context.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/call_combiner.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/error.h"
@@ -62,13 +72,130 @@ enum async_state {
   STATE_CANCELLED,
 };
 
+// Caches successful auth metadata processor results for one connection, keyed
+// by the serialized metadata entries the processor consumed (typically the
+// authorization token), so that thousands of RPCs reusing the same token pay
+// one crypto verification instead of one per RPC. Only the metadata removal
+// needs replaying on a hit: any auth context properties the processor added
+// were applied to the connection-wide auth context by the original call.
+// Entries expire after a TTL and are dropped wholesale whenever the
+// credentials' cache generation changes (explicit invalidation or processor
+// replacement).
+class AuthResultCache {
+ public:
+  AuthResultCache(grpc_server_credentials* creds, int ttl_ms)
+      : creds_(creds),
+        ttl_(gpr_time_from_millis(ttl_ms, GPR_TIMESPAN)),
+        generation_(creds->auth_result_cache_generation()) {}
+
+  // Returns true if md carries auth metadata whose successful validation is
+  // still cached, in which case the previously consumed entries are removed
+  // from batch exactly as on the original call and the processor can be
+  // skipped.
+  bool Lookup(const grpc_metadata_array* md, grpc_metadata_batch* batch) {
+    grpc_core::MutexLock lock(&mu_);
+    FlushIfInvalidatedLocked();
+    if (consumed_keys_.empty()) return false;
+    std::string buffer;
+    for (const std::string& key : consumed_keys_) {
+      const grpc_metadata* found = nullptr;
+      for (size_t i = 0; i < md->count; i++) {
+        if (grpc_core::StringViewFromSlice(md->metadata[i].key) == key) {
+          found = &md->metadata[i];
+          break;
+        }
+      }
+      if (found == nullptr) return false;
+      AppendEntry(key, grpc_core::StringViewFromSlice(found->value), &buffer);
+    }
+    auto it = entries_.find(buffer);
+    if (it == entries_.end()) return false;
+    if (gpr_time_cmp(gpr_now(GPR_CLOCK_MONOTONIC), it->second) >= 0) {
+      entries_.erase(it);
+      return false;
+    }
+    for (const std::string& key : consumed_keys_) {
+      batch->Remove(absl::string_view(key));
+    }
+    return true;
+  }
+
+  // Remembers a successful processor result keyed by the consumed metadata.
+  void Record(const grpc_metadata* consumed_md, size_t num_consumed_md) {
+    // A processor that consumed nothing leaves us no key that distinguishes
+    // one call's credentials from another's; such results cannot be cached.
+    if (num_consumed_md == 0) return;
+    grpc_core::MutexLock lock(&mu_);
+    FlushIfInvalidatedLocked();
+    consumed_keys_.clear();
+    std::string buffer;
+    for (size_t i = 0; i < num_consumed_md; i++) {
+      absl::string_view key =
+          grpc_core::StringViewFromSlice(consumed_md[i].key);
+      consumed_keys_.emplace_back(key);
+      AppendEntry(key, grpc_core::StringViewFromSlice(consumed_md[i].value),
+                  &buffer);
+    }
+    if (entries_.size() >= kMaxEntries &&
+        entries_.find(buffer) == entries_.end()) {
+      // Evict the entry closest to expiry.
+      auto victim = entries_.begin();
+      for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+        if (gpr_time_cmp(it->second, victim->second) < 0) victim = it;
+      }
+      entries_.erase(victim);
+    }
+    entries_[std::move(buffer)] =
+        gpr_time_add(gpr_now(GPR_CLOCK_MONOTONIC), ttl_);
+  }
+
+ private:
+  static constexpr size_t kMaxEntries = 64;
+
+  void FlushIfInvalidatedLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    int64_t current = creds_->auth_result_cache_generation();
+    if (generation_ != current) {
+      generation_ = current;
+      consumed_keys_.clear();
+      entries_.clear();
+    }
+  }
+
+  static void AppendEntry(absl::string_view key, absl::string_view value,
+                          std::string* buffer) {
+    buffer->append(key.data(), key.size());
+    buffer->push_back('\0');
+    buffer->append(value.data(), value.size());
+    buffer->push_back('\0');
+  }
+
+  grpc_server_credentials* creds_;
+  const gpr_timespec ttl_;
+  grpc_core::Mutex mu_;
+  int64_t generation_ ABSL_GUARDED_BY(mu_);
+  // Metadata keys the processor consumed on the most recent successful call;
+  // these are the entries that determine (and are removed on) a cache hit.
+  std::vector<std::string> consumed_keys_ ABSL_GUARDED_BY(mu_);
+  // Serialized consumed metadata -> expiry deadline. Keyed by the full
+  // byte string (not a hash): the key bytes are the authentication
+  // decision, so a lookup must compare them exactly.
+  std::map<std::string, gpr_timespec> entries_ ABSL_GUARDED_BY(mu_);
+};
+
 struct channel_data {
-  channel_data(grpc_auth_context* auth_context, grpc_server_credentials* creds)
-      : auth_context(auth_context->Ref()), creds(creds->Ref()) {}
+  channel_data(grpc_auth_context* auth_context, grpc_server_credentials* creds,
+               int auth_result_cache_ttl_ms)
+      : auth_context(auth_context->Ref()), creds(creds->Ref()) {
+    if (auth_result_cache_ttl_ms > 0) {
+      auth_result_cache = std::make_unique<AuthResultCache>(
+          this->creds.get(), auth_result_cache_ttl_ms);
+    }
+  }
   ~channel_data() { auth_context.reset(DEBUG_LOCATION, "server_auth_filter"); }
 
   grpc_core::RefCountedPtr<grpc_auth_context> auth_context;
   grpc_core::RefCountedPtr<grpc_server_credentials> creds;
+  std::unique_ptr<AuthResultCache> auth_result_cache;
 };
 
 struct call_data {
@@ -173,6 +300,10 @@ static void on_md_processing_done_inner(grpc_call_element* elem,
             "Ignoring...");
   }
   if (error.ok()) {
+    channel_data* chand = static_cast<channel_data*>(elem->channel_data);
+    if (chand->auth_result_cache != nullptr) {
+      chand->auth_result_cache->Record(consumed_md, num_consumed_md);
+    }
     for (size_t i = 0; i < num_consumed_md; i++) {
       batch->payload->recv_initial_metadata.recv_initial_metadata->Remove(
           grpc_core::StringViewFromSlice(consumed_md[i].key));
@@ -243,22 +374,36 @@ static void recv_initial_metadata_ready(void* arg, grpc_error_handle error) {
   if (error.ok()) {
     if (chand->creds != nullptr &&
         chand->creds->auth_metadata_processor().process != nullptr) {
-      // We're calling out to the application, so we need to make sure
-      // to drop the call combiner early if we get cancelled.
-      // TODO(yashykt): We would not need this ref if call combiners used
-      // Closure::Run() instead of ExecCtx::Run()
-      GRPC_CALL_STACK_REF(calld->owning_call, "cancel_call");
-      GRPC_CLOSURE_INIT(&calld->cancel_closure, cancel_call, elem,
-                        grpc_schedule_on_exec_ctx);
-      calld->call_combiner->SetNotifyOnCancel(&calld->cancel_closure);
-      GRPC_CALL_STACK_REF(calld->owning_call, "server_auth_metadata");
       calld->md = metadata_batch_to_md_array(
           batch->payload->recv_initial_metadata.recv_initial_metadata);
-      chand->creds->auth_metadata_processor().process(
-          chand->creds->auth_metadata_processor().state,
-          chand->auth_context.get(), calld->md.metadata, calld->md.count,
-          on_md_processing_done, elem);
-      return;
+      if (chand->auth_result_cache != nullptr &&
+          chand->auth_result_cache->Lookup(
+              &calld->md,
+              batch->payload->recv_initial_metadata.recv_initial_metadata)) {
+        // This call's auth metadata already passed verification within the
+        // cache TTL; Lookup() consumed it, so skip the processor and
+        // continue as if it had just succeeded.
+        for (size_t i = 0; i < calld->md.count; i++) {
+          grpc_core::CSliceUnref(calld->md.metadata[i].key);
+          grpc_core::CSliceUnref(calld->md.metadata[i].value);
+        }
+        grpc_metadata_array_destroy(&calld->md);
+      } else {
+        // We're calling out to the application, so we need to make sure
+        // to drop the call combiner early if we get cancelled.
+        // TODO(yashykt): We would not need this ref if call combiners used
+        // Closure::Run() instead of ExecCtx::Run()
+        GRPC_CALL_STACK_REF(calld->owning_call, "cancel_call");
+        GRPC_CLOSURE_INIT(&calld->cancel_closure, cancel_call, elem,
+                          grpc_schedule_on_exec_ctx);
+        calld->call_combiner->SetNotifyOnCancel(&calld->cancel_closure);
+        GRPC_CALL_STACK_REF(calld->owning_call, "server_auth_metadata");
+        chand->creds->auth_metadata_processor().process(
+            chand->creds->auth_metadata_processor().state,
+            chand->auth_context.get(), calld->md.metadata, calld->md.count,
+            on_md_processing_done, elem);
+        return;
+      }
     }
   }
   grpc_closure* closure = calld->original_recv_initial_metadata_ready;
@@ -333,7 +478,11 @@ static grpc_error_handle server_auth_init_channel_elem(
   GPR_ASSERT(auth_context != nullptr);
   grpc_server_credentials* creds =
       grpc_find_server_credentials_in_args(args->channel_args);
-  new (elem->channel_data) channel_data(auth_context, creds);
+  const int auth_result_cache_ttl_ms = grpc_channel_args_find_integer(
+      args->channel_args, GRPC_ARG_SERVER_AUTH_RESULT_CACHE_TTL_MS,
+      {0, 0, INT_MAX});
+  new (elem->channel_data)
+      channel_data(auth_context, creds, auth_result_cache_ttl_ms);
   return absl::OkStatus();
 }
 
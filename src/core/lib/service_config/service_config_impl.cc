@@ -20,10 +20,14 @@
 
 #include <string.h>
 
+#include <atomic>
+#include <list>
 #include <map>
 #include <string>
+#include <tuple>
 #include <utility>
 
+#include "absl/hash/hash.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
@@ -33,6 +37,7 @@
 
 #include "src/core/lib/config/core_configuration.h"
 #include "src/core/lib/gprpp/memory.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/json/json.h"
 #include "src/core/lib/service_config/service_config_parser.h"
 #include "src/core/lib/slice/slice.h"
@@ -40,17 +45,126 @@
 
 namespace grpc_core {
 
+namespace {
+
+// Bounded process-wide cache of parsed service configs. Resolvers
+// re-deliver a byte-identical config string on almost every update, so
+// without the cache Create() reparses the JSON and reruns every registered
+// parser for an identical result. Entries are keyed by the generation of
+// the active CoreConfiguration (parsed configs are indexed by parser
+// registration order, so a rebuilt configuration invalidates them), the
+// channel args, and a hash of the config string; the string itself is
+// compared on hit so a hash collision degrades to a miss. Entries pin
+// their channel args until evicted; the small bound keeps that retention
+// negligible.
+class ParsedConfigCache {
+ public:
+  static ParsedConfigCache* Get() {
+    static ParsedConfigCache* cache = new ParsedConfigCache;
+    return cache;
+  }
+
+  RefCountedPtr<ServiceConfig> Lookup(const ChannelArgs& args,
+                                      absl::string_view json_string) {
+    const Key key = MakeKey(args, json_string);
+    MutexLock lock(&mu_);
+    auto it = index_.find(key);
+    if (it == index_.end() ||
+        it->second->config->json_string() != json_string) {
+      misses_.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    lru_.splice(lru_.begin(), lru_, it->second);
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    return it->second->config;
+  }
+
+  void Insert(const ChannelArgs& args, RefCountedPtr<ServiceConfig> config) {
+    const Key key = MakeKey(args, config->json_string());
+    MutexLock lock(&mu_);
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+      // Raced with another insert (or collided): keep the entry fresh.
+      it->second->config = std::move(config);
+      lru_.splice(lru_.begin(), lru_, it->second);
+      return;
+    }
+    lru_.push_front(Entry{key, std::move(config)});
+    index_.emplace(key, lru_.begin());
+    if (lru_.size() > kMaxEntries) {
+      index_.erase(lru_.back().key);
+      lru_.pop_back();
+      evictions_.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  ServiceConfigImpl::CacheStats stats() const {
+    ServiceConfigImpl::CacheStats stats;
+    stats.hits = hits_.load(std::memory_order_relaxed);
+    stats.misses = misses_.load(std::memory_order_relaxed);
+    stats.evictions = evictions_.load(std::memory_order_relaxed);
+    return stats;
+  }
+
+  void Clear() {
+    MutexLock lock(&mu_);
+    index_.clear();
+    lru_.clear();
+    hits_.store(0, std::memory_order_relaxed);
+    misses_.store(0, std::memory_order_relaxed);
+    evictions_.store(0, std::memory_order_relaxed);
+  }
+
+ private:
+  // A handful of entries covers one config per active channel target.
+  static constexpr size_t kMaxEntries = 16;
+
+  using Key = std::tuple<uint64_t /*configuration generation*/, ChannelArgs,
+                         uint64_t /*json string hash*/>;
+  struct Entry {
+    Key key;
+    RefCountedPtr<ServiceConfig> config;
+  };
+
+  static Key MakeKey(const ChannelArgs& args, absl::string_view json_string) {
+    return Key(CoreConfiguration::Get().generation(), args,
+               absl::HashOf(json_string));
+  }
+
+  mutable Mutex mu_;
+  // Front of the list is the most recently used entry.
+  std::list<Entry> lru_ ABSL_GUARDED_BY(mu_);
+  std::map<Key, std::list<Entry>::iterator> index_ ABSL_GUARDED_BY(mu_);
+  std::atomic<uint64_t> hits_{0};
+  std::atomic<uint64_t> misses_{0};
+  std::atomic<uint64_t> evictions_{0};
+};
+
+}  // namespace
+
 absl::StatusOr<RefCountedPtr<ServiceConfig>> ServiceConfigImpl::Create(
     const ChannelArgs& args, absl::string_view json_string) {
+  RefCountedPtr<ServiceConfig> cached =
+      ParsedConfigCache::Get()->Lookup(args, json_string);
+  if (cached != nullptr) return cached;
   auto json = Json::Parse(json_string);
   if (!json.ok()) return json.status();
   absl::Status status;
   auto service_config = MakeRefCounted<ServiceConfigImpl>(
       args, std::string(json_string), std::move(*json), &status);
   if (!status.ok()) return status;
+  ParsedConfigCache::Get()->Insert(args, service_config);
   return service_config;
 }
 
+ServiceConfigImpl::CacheStats ServiceConfigImpl::cache_stats() {
+  return ParsedConfigCache::Get()->stats();
+}
+
+void ServiceConfigImpl::TestOnlyClearCache() {
+  ParsedConfigCache::Get()->Clear();
+}
+
 ServiceConfigImpl::ServiceConfigImpl(const ChannelArgs& args,
                                      std::string json_string, Json json,
                                      absl::Status* status)
@@ -20,6 +20,7 @@
 #include <grpc/support/port_platform.h>
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <memory>
 #include <string>
@@ -69,9 +70,22 @@ namespace grpc_core {
 class ServiceConfigImpl final : public ServiceConfig {
  public:
   /// Creates a new service config from parsing \a json_string.
+  /// Consults a bounded process-wide cache of parsed configs first:
+  /// resolvers re-deliver a byte-identical config string on almost every
+  /// update, in which case the previously parsed (immutable, refcounted)
+  /// config is shared instead of reparsed.
   static absl::StatusOr<RefCountedPtr<ServiceConfig>> Create(
       const ChannelArgs& args, absl::string_view json_string);
 
+  /// Statistics for the process-wide cache of parsed configs.
+  struct CacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+  };
+  static CacheStats cache_stats();
+  static void TestOnlyClearCache();
+
   ServiceConfigImpl(const ChannelArgs& args, std::string json_string, Json json,
                     absl::Status* status);
   ~ServiceConfigImpl() override;
@@ -29,6 +29,14 @@
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/slice/slice.h"
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define GRPC_B64_X86_DISPATCH 1
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define GRPC_B64_NEON 1
+#include <arm_neon.h>
+#endif
+
 /* --- Constants. --- */
 
 static const int8_t base64_bytes[] = {
@@ -54,6 +62,206 @@ static const char base64_url_safe_chars[] =
 #define GRPC_BASE64_MULTILINE_LINE_LEN 76
 #define GRPC_BASE64_MULTILINE_NUM_BLOCKS (GRPC_BASE64_MULTILINE_LINE_LEN / 4)
 
+/* --- Vectorized kernels. ---
+   These mirror the kernels in chttp2's bin_encoder/bin_decoder, extended to
+   select between the standard and url-safe alphabets. They only consume
+   whole blocks of fully regular input (no padding, no line breaks), leaving
+   tails and anything unusual to the scalar code below. */
+
+#ifdef GRPC_B64_X86_DISPATCH
+
+static bool b64_have_avx2(void) {
+  static const bool result = __builtin_cpu_supports("avx2");
+  return result;
+}
+
+/* Vectorized base64: each iteration turns 24 input bytes into 32 output
+   characters with the classic lookup-shuffle scheme. Consumes a multiple of
+   three bytes so the scalar code below can finish the job. */
+__attribute__((target("avx2"))) static const unsigned char* b64_encode_avx2(
+    const unsigned char* in, const unsigned char* end, char** out_ptr,
+    int url_safe) {
+  char* out = *out_ptr;
+  /* For each output dword we want the input triplet bytes (a, b, c)
+     arranged as b | a<<8 | c<<16 | b<<24, per 128-bit lane. */
+  const __m256i shuf = _mm256_setr_epi8(
+      1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,  //
+      1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+  /* Offset from a 6-bit group value to its base64 character, indexed by the
+     value's range: 0 -> 'A'..'Z', 1 -> 'a'..'z', 2..11 -> '0'..'9',
+     12 -> '+' or '-', 13 -> '/' or '_'. */
+  const __m256i lut =
+      url_safe ? _mm256_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4,
+                                  -4, -17, 32, 0, 0,  //
+                                  65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4,
+                                  -4, -17, 32, 0, 0)
+               : _mm256_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4,
+                                  -4, -19, -16, 0, 0,  //
+                                  65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4,
+                                  -4, -19, -16, 0, 0);
+  /* Each iteration consumes 24 bytes but loads 16 bytes from in + 12, so
+     require 28 readable bytes. */
+  while (end - in >= 28) {
+    const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+    const __m128i hi =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 12));
+    __m256i x = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+    x = _mm256_shuffle_epi8(x, shuf);
+    /* Isolate the four 6-bit groups of each triplet into one byte each. */
+    const __m256i t0 = _mm256_and_si256(x, _mm256_set1_epi32(0x0fc0fc00));
+    const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    const __m256i t2 = _mm256_and_si256(x, _mm256_set1_epi32(0x003f03f0));
+    const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+    const __m256i group = _mm256_or_si256(t1, t3);
+    /* Translate group values to alphabet characters. */
+    __m256i range = _mm256_subs_epu8(group, _mm256_set1_epi8(51));
+    range = _mm256_sub_epi8(range,
+                            _mm256_cmpgt_epi8(group, _mm256_set1_epi8(25)));
+    const __m256i chars =
+        _mm256_add_epi8(group, _mm256_shuffle_epi8(lut, range));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), chars);
+    in += 24;
+    out += 32;
+  }
+  *out_ptr = out;
+  return in;
+}
+
+/* Vectorized base64 decode: each iteration validates 32 input characters at
+   once and decodes them to 24 output bytes (the store writes 32 bytes, so 32
+   bytes of output headroom are required). Stops at the first block containing
+   any character outside the chosen alphabet -- including '=' padding and line
+   breaks -- and leaves it to the scalar code, which reports errors and
+   handles tails. */
+__attribute__((target("avx2"))) static const char* b64_decode_avx2(
+    const char* in, const char* in_end, unsigned char** out_ptr,
+    const unsigned char* out_end, int url_safe) {
+  unsigned char* out = *out_ptr;
+  /* Validation nibble luts: a character is in the alphabet iff
+     lut_lo[c & 0xf] & lut_hi[c >> 4] == 0. The url-safe variant gives the
+     high nibble 5 its own bit (0x20) so that '_' can be accepted while 0x7f
+     stays rejected. */
+  const __m256i lut_lo =
+      url_safe ? _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                  0x11, 0x11, 0x11, 0x13, 0x3B, 0x3B, 0x3A,
+                                  0x3B, 0x1B,  //
+                                  0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                  0x11, 0x11, 0x11, 0x13, 0x3B, 0x3B, 0x3A,
+                                  0x3B, 0x1B)
+               : _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                  0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B,
+                                  0x1B, 0x1A,  //
+                                  0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                  0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B,
+                                  0x1B, 0x1A);
+  const __m256i lut_hi =
+      url_safe ? _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x20, 0x04,
+                                  0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+                                  0x10, 0x10,  //
+                                  0x10, 0x10, 0x01, 0x02, 0x04, 0x20, 0x04,
+                                  0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+                                  0x10, 0x10)
+               : _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04,
+                                  0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+                                  0x10, 0x10,  //
+                                  0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04,
+                                  0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+                                  0x10, 0x10);
+  /* Offset from an alphabet character to its 6-bit value. For the standard
+     alphabet the index is the high nibble with '/' singled out via a compare;
+     for the url-safe alphabet the high nibble 2 holds only '-', and '_' is
+     singled out and rolled through index 13. */
+  const __m256i lut_roll =
+      url_safe ? _mm256_setr_epi8(0, 0, 17, 4, -65, -65, -71, -71, 0, 0, 0, 0,
+                                  0, -32, 0, 0,  //
+                                  0, 0, 17, 4, -65, -65, -71, -71, 0, 0, 0, 0,
+                                  0, -32, 0, 0)
+               : _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0,
+                                  0, 0, 0, 0,  //
+                                  0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0,
+                                  0, 0, 0, 0);
+  while (in_end - in >= 32 && out_end - out >= 32) {
+    const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in));
+    const __m256i hi_nib =
+        _mm256_and_si256(_mm256_srli_epi32(x, 4), _mm256_set1_epi8(0x0f));
+    const __m256i lo_nib = _mm256_and_si256(x, _mm256_set1_epi8(0x0f));
+    const __m256i lo = _mm256_shuffle_epi8(lut_lo, lo_nib);
+    const __m256i hi = _mm256_shuffle_epi8(lut_hi, hi_nib);
+    if (!_mm256_testz_si256(lo, hi)) break;
+    __m256i roll_index;
+    if (url_safe) {
+      const __m256i eq_5f = _mm256_cmpeq_epi8(x, _mm256_set1_epi8(0x5f));
+      roll_index =
+          _mm256_add_epi8(hi_nib, _mm256_and_si256(eq_5f, _mm256_set1_epi8(8)));
+    } else {
+      const __m256i eq_2f = _mm256_cmpeq_epi8(x, _mm256_set1_epi8(0x2f));
+      roll_index = _mm256_add_epi8(eq_2f, hi_nib);
+    }
+    const __m256i values =
+        _mm256_add_epi8(x, _mm256_shuffle_epi8(lut_roll, roll_index));
+    /* Pack each quad of 6-bit values into three bytes. */
+    const __m256i merge_ab_and_bc =
+        _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+    const __m256i merged =
+        _mm256_madd_epi16(merge_ab_and_bc, _mm256_set1_epi32(0x00011000));
+    const __m256i shuffled = _mm256_shuffle_epi8(
+        merged,
+        _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1,
+                         -1,  //
+                         2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1,
+                         -1));
+    const __m256i packed = _mm256_permutevar8x32_epi32(
+        shuffled, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), packed);
+    in += 32;
+    out += 24;
+  }
+  *out_ptr = out;
+  return in;
+}
+
+#endif /* GRPC_B64_X86_DISPATCH */
+
+#ifdef GRPC_B64_NEON
+
+/* Vectorized base64: each iteration de-interleaves 48 input bytes into 16
+   triplets and emits 64 output characters, using the 64-entry table lookup
+   to translate 6-bit groups. Consumes a multiple of three bytes so the
+   scalar code below can finish the job. */
+static const unsigned char* b64_encode_neon(const unsigned char* in,
+                                            const unsigned char* end,
+                                            char** out_ptr,
+                                            const char* base64_chars) {
+  uint8_t* out = reinterpret_cast<uint8_t*>(*out_ptr);
+  uint8x16x4_t tbl;
+  tbl.val[0] = vld1q_u8(reinterpret_cast<const uint8_t*>(base64_chars));
+  tbl.val[1] = vld1q_u8(reinterpret_cast<const uint8_t*>(base64_chars + 16));
+  tbl.val[2] = vld1q_u8(reinterpret_cast<const uint8_t*>(base64_chars + 32));
+  tbl.val[3] = vld1q_u8(reinterpret_cast<const uint8_t*>(base64_chars + 48));
+  while (end - in >= 48) {
+    const uint8x16x3_t d = vld3q_u8(in);
+    uint8x16x4_t groups;
+    groups.val[0] = vshrq_n_u8(d.val[0], 2);
+    groups.val[1] = vorrq_u8(vshlq_n_u8(vandq_u8(d.val[0], vdupq_n_u8(0x3)), 4),
+                             vshrq_n_u8(d.val[1], 4));
+    groups.val[2] = vorrq_u8(vshlq_n_u8(vandq_u8(d.val[1], vdupq_n_u8(0xf)), 2),
+                             vshrq_n_u8(d.val[2], 6));
+    groups.val[3] = vandq_u8(d.val[2], vdupq_n_u8(0x3f));
+    uint8x16x4_t chars;
+    chars.val[0] = vqtbl4q_u8(tbl, groups.val[0]);
+    chars.val[1] = vqtbl4q_u8(tbl, groups.val[1]);
+    chars.val[2] = vqtbl4q_u8(tbl, groups.val[2]);
+    chars.val[3] = vqtbl4q_u8(tbl, groups.val[3]);
+    vst4q_u8(out, chars);
+    in += 48;
+    out += 64;
+  }
+  *out_ptr = reinterpret_cast<char*>(out);
+  return in;
+}
+
+#endif /* GRPC_B64_NEON */
+
 /* --- base64 functions. --- */
 
 char* grpc_base64_encode(const void* vdata, size_t data_size, int url_safe,
@@ -86,6 +294,27 @@ void grpc_base64_encode_core(char* result, const void* vdata, size_t data_size,
   size_t num_blocks = 0;
   size_t i = 0;
 
+  /* Bulk-encode whole triplets; the line-break bookkeeping below only works
+     block by block, so multiline output stays on the scalar path. */
+  if (!multiline) {
+#ifdef GRPC_B64_X86_DISPATCH
+    if (b64_have_avx2()) {
+      const unsigned char* consumed_to =
+          b64_encode_avx2(data + i, data + i + data_size, &current, url_safe);
+      data_size -= static_cast<size_t>(consumed_to - (data + i));
+      i = static_cast<size_t>(consumed_to - data);
+    }
+#endif
+#ifdef GRPC_B64_NEON
+    {
+      const unsigned char* consumed_to = b64_encode_neon(
+          data + i, data + i + data_size, &current, base64_chars);
+      data_size -= static_cast<size_t>(consumed_to - (data + i));
+      i = static_cast<size_t>(consumed_to - data);
+    }
+#endif
+  }
+
   /* Encode each block. */
   while (data_size >= 3) {
     *current++ = base64_chars[(data[i] >> 2) & 0x3F];
@@ -196,6 +425,21 @@ grpc_slice grpc_base64_decode_with_len(const char* b64, size_t b64_len,
   unsigned char codes[4];
   size_t num_codes = 0;
 
+#ifdef GRPC_B64_X86_DISPATCH
+  /* Bulk-decode fully regular blocks; anything the kernel does not consume
+     (tails, padding, line breaks, invalid characters) is handled by the
+     scalar code below, which starts on a group boundary because the kernel
+     only consumes whole groups of four. */
+  if (b64_have_avx2()) {
+    unsigned char* out = current + result_size;
+    const char* consumed_to = b64_decode_avx2(
+        b64, b64 + b64_len, &out, GRPC_SLICE_END_PTR(result), url_safe);
+    result_size = static_cast<size_t>(out - current);
+    b64_len -= static_cast<size_t>(consumed_to - b64);
+    b64 = consumed_to;
+  }
+#endif
+
   while (b64_len--) {
     unsigned char c = static_cast<unsigned char>(*b64++);
     signed char code;
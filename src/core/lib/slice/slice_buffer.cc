@@ -98,6 +98,36 @@ static void GPR_ATTRIBUTE_NOINLINE do_embiggen(grpc_slice_buffer* sb,
   }
 }
 
+/* Make room for n more slice entries at sb->slices + sb->count, compacting
+   the used region to the front or growing the array as needed. */
+static void reserve_n(grpc_slice_buffer* sb, size_t n) {
+  size_t slice_offset = static_cast<size_t>(sb->slices - sb->base_slices);
+  if (slice_offset + sb->count + n <= sb->capacity) return;
+  if (sb->count + n <= sb->capacity) {
+    /* Make room by moving elements if there's still space unused */
+    memmove(sb->base_slices, sb->slices, sb->count * sizeof(grpc_slice));
+    sb->slices = sb->base_slices;
+    return;
+  }
+  size_t new_capacity = sb->capacity;
+  do {
+    new_capacity = GROW(new_capacity);
+  } while (sb->count + n > new_capacity);
+  if (sb->base_slices == sb->inlined) {
+    grpc_slice* new_base =
+        static_cast<grpc_slice*>(gpr_malloc(new_capacity * sizeof(grpc_slice)));
+    memcpy(new_base, sb->slices, sb->count * sizeof(grpc_slice));
+    sb->base_slices = new_base;
+  } else {
+    sb->base_slices = static_cast<grpc_slice*>(
+        gpr_realloc(sb->base_slices, new_capacity * sizeof(grpc_slice)));
+    memmove(sb->base_slices, sb->base_slices + slice_offset,
+            sb->count * sizeof(grpc_slice));
+  }
+  sb->slices = sb->base_slices;
+  sb->capacity = new_capacity;
+}
+
 static void maybe_embiggen(grpc_slice_buffer* sb) {
   if (sb->count == 0) {
     sb->slices = sb->base_slices;
@@ -298,10 +328,16 @@ void grpc_slice_buffer_move_into(grpc_slice_buffer* src,
     grpc_slice_buffer_swap(src, dst);
     return;
   }
-  /* both buffers have data - copy, and reset src */
-  grpc_slice_buffer_addn(dst, src->slices, src->count);
+  /* both buffers have data - splice the whole run across with one copy
+     rather than appending slice by slice */
+  reserve_n(dst, src->count);
+  memcpy(dst->slices + dst->count, src->slices,
+         src->count * sizeof(grpc_slice));
+  dst->count += src->count;
+  dst->length += src->length;
   src->count = 0;
   src->length = 0;
+  src->slices = src->base_slices;
 }
 
 template <bool incref>
@@ -407,11 +443,16 @@ void grpc_slice_buffer_trim_end(grpc_slice_buffer* sb, size_t n,
     grpc_slice slice = sb->slices[idx];
     size_t slice_len = GRPC_SLICE_LENGTH(slice);
     if (slice_len > n) {
-      sb->slices[idx] = grpc_slice_split_head(&slice, slice_len - n);
       if (garbage) {
+        sb->slices[idx] = grpc_slice_split_head(&slice, slice_len - n);
         grpc_slice_buffer_add_indexed(garbage, slice);
+      } else if (slice.refcount != nullptr) {
+        /* Discarding the tail: shrink the slice in place. The retained head
+           keeps the refcount it already holds, so no ref/unref traffic. */
+        sb->slices[idx].data.refcounted.length = slice_len - n;
       } else {
-        grpc_core::CSliceUnref(slice);
+        sb->slices[idx].data.inlined.length =
+            static_cast<uint8_t>(slice_len - n);
       }
       return;
     } else if (slice_len == n) {
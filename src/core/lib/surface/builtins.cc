@@ -20,6 +20,7 @@
 
 #include "src/core/lib/channel/channel_stack_builder.h"
 #include "src/core/lib/channel/connected_channel.h"
+#include "src/core/lib/channel/promise_based_filter.h"
 #include "src/core/lib/config/core_configuration.h"
 #include "src/core/lib/surface/channel_init.h"
 #include "src/core/lib/surface/channel_stack_type.h"
@@ -29,6 +30,7 @@
 namespace grpc_core {
 
 void RegisterBuiltins(CoreConfiguration::Builder* builder) {
+  builder->channel_init()->SetFusedFilterFactory(MakeFusedFilter);
   builder->channel_init()->RegisterStage(GRPC_CLIENT_SUBCHANNEL,
                                          GRPC_CHANNEL_INIT_BUILTIN_PRIORITY,
                                          grpc_add_connected_filter);
@@ -27,6 +27,7 @@
 #include <grpc/slice.h>
 #include <grpc/support/log.h>
 
+#include "src/core/lib/debug/stats.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/slice/slice.h"
 
@@ -99,3 +100,23 @@ grpc_slice grpc_byte_buffer_reader_readall(grpc_byte_buffer_reader* reader) {
 
   return out_slice;
 }
+
+grpc_slice grpc_byte_buffer_reader_view(grpc_byte_buffer_reader* reader) {
+  grpc_core::ExecCtx exec_ctx;
+  switch (reader->buffer_in->type) {
+    case GRPC_BB_RAW: {
+      grpc_slice_buffer* slice_buffer =
+          &reader->buffer_out->data.raw.slice_buffer;
+      if (slice_buffer->count == 1) {
+        /* The whole message is one slice: hand back a reference to it rather
+           than copying it out. */
+        GRPC_STATS_INC_BYTE_BUFFER_VIEW_HITS();
+        reader->current.index = slice_buffer->count;
+        return grpc_core::CSliceRef(slice_buffer->slices[0]);
+      }
+      break;
+    }
+  }
+  GRPC_STATS_INC_BYTE_BUFFER_VIEW_COPIES();
+  return grpc_byte_buffer_reader_readall(reader);
+}
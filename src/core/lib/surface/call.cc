@@ -281,7 +281,7 @@ void Call::PublishToParent(Call* parent) {
         cc->sibling_prev->child_->sibling_next = this;
   }
   if (parent->Completed()) {
-    CancelWithError(absl::CancelledError());
+    CancelWithError(grpc_error_cancelled());
   }
 }
 
@@ -324,7 +324,7 @@ void Call::PropagateCancellationToChildren() {
         Call* next_child_call = child->child_->sibling_next;
         if (child->cancellation_is_inherited_) {
           child->InternalRef("propagate_cancel");
-          child->CancelWithError(GRPC_ERROR_CANCELLED);
+          child->CancelWithError(grpc_error_cancelled());
           child->InternalUnref("propagate_cancel");
         }
         child = next_child_call;
@@ -779,7 +779,7 @@ void FilterStackCall::ExternalUnref() {
   destroy_called_ = true;
   bool cancel = gpr_atm_acq_load(&received_final_op_atm_) == 0;
   if (cancel) {
-    CancelWithError(absl::CancelledError());
+    CancelWithError(grpc_error_cancelled());
   } else {
     // Unset the call combiner cancellation closure.  This has the
     // effect of scheduling the previously set cancellation closure, if
@@ -2914,7 +2914,7 @@ grpc_call_error grpc_call_cancel(grpc_call* call, void* reserved) {
   GPR_ASSERT(reserved == nullptr);
   grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
   grpc_core::ExecCtx exec_ctx;
-  grpc_core::Call::FromC(call)->CancelWithError(absl::CancelledError());
+  grpc_core::Call::FromC(call)->CancelWithError(grpc_error_cancelled());
   return GRPC_CALL_OK;
 }
 
@@ -2934,7 +2934,7 @@ grpc_call_error grpc_call_cancel_with_status(grpc_call* c,
 }
 
 void grpc_call_cancel_internal(grpc_call* call) {
-  grpc_core::Call::FromC(call)->CancelWithError(absl::CancelledError());
+  grpc_core::Call::FromC(call)->CancelWithError(grpc_error_cancelled());
 }
 
 grpc_compression_algorithm grpc_call_test_only_get_compression_algorithm(
@@ -2974,6 +2974,37 @@ grpc_call_error grpc_call_start_batch(grpc_call* call, const grpc_op* ops,
   }
 }
 
+grpc_call_error grpc_call_start_batch_bulk(grpc_call_batch* batches,
+                                           size_t count,
+                                           size_t* first_error_index,
+                                           void* reserved) {
+  GRPC_API_TRACE(
+      "grpc_call_start_batch_bulk(batches=%p, count=%lu, "
+      "first_error_index=%p, reserved=%p)",
+      4, (batches, (unsigned long)count, first_error_index, reserved));
+
+  if (reserved != nullptr) {
+    if (first_error_index != nullptr) *first_error_index = 0;
+    return GRPC_CALL_ERROR;
+  }
+  grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
+  // One ExecCtx across every batch: the closures each StartBatch schedules
+  // (call combiner work, transport stream ops) run at the single flush below,
+  // so a transport shared by several of the calls sees all their ops in one
+  // combiner drain and initiates one write cycle for the lot.
+  grpc_core::ExecCtx exec_ctx;
+  for (size_t i = 0; i < count; i++) {
+    grpc_call_error err = grpc_core::Call::FromC(batches[i].call)
+                              ->StartBatch(batches[i].ops, batches[i].nops,
+                                           batches[i].tag, false);
+    if (err != GRPC_CALL_OK) {
+      if (first_error_index != nullptr) *first_error_index = i;
+      return err;
+    }
+  }
+  return GRPC_CALL_OK;
+}
+
 grpc_call_error grpc_call_start_batch_and_execute(grpc_call* call,
                                                   const grpc_op* ops,
                                                   size_t nops,
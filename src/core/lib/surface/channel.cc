@@ -33,6 +33,7 @@
 #include <grpc/compression.h>
 #include <grpc/grpc.h>
 #include <grpc/impl/codegen/gpr_types.h>
+#include <grpc/slice.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
@@ -56,6 +57,7 @@
 #include "src/core/lib/surface/channel_init.h"
 #include "src/core/lib/surface/channel_stack_type.h"
 #include "src/core/lib/surface/init_internally.h"
+#include "src/core/lib/surface/validate_metadata.h"
 #include "src/core/lib/transport/transport.h"
 
 // IWYU pragma: no_include <type_traits>
@@ -369,6 +371,20 @@ void* grpc_channel_register_call(grpc_channel* channel, const char* method,
       "grpc_channel_register_call(channel=%p, method=%s, host=%s, reserved=%p)",
       4, (channel, method, host, reserved));
   GPR_ASSERT(!reserved);
+  // Validate the method and host here, once, so that calls created from the
+  // returned handle can trust the pre-built slices without re-checking them.
+  if (method == nullptr ||
+      !GRPC_LOG_IF_ERROR("validate_metadata",
+                         grpc_validate_header_nonbin_value_is_legal(
+                             grpc_slice_from_static_string(method)))) {
+    return nullptr;
+  }
+  if (host != nullptr &&
+      !GRPC_LOG_IF_ERROR("validate_metadata",
+                         grpc_validate_header_nonbin_value_is_legal(
+                             grpc_slice_from_static_string(host)))) {
+    return nullptr;
+  }
   grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
   grpc_core::ExecCtx exec_ctx;
   return grpc_core::Channel::FromC(channel)->RegisterCall(method, host);
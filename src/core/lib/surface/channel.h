@@ -87,6 +87,12 @@ void grpc_channel_update_call_size_estimate(grpc_channel* channel, size_t size);
 
 namespace grpc_core {
 
+// A method/host pair that was pre-built (and pre-validated) by
+// grpc_channel_register_call. Every call created from the handle refs these
+// slices rather than copying the strings, so all calls for one registered
+// method share a single backing store - which also lets the HPACK encoder
+// recognize repeat sends of the path/authority by identity instead of by
+// byte comparison.
 struct RegisteredCall {
   Slice path;
   absl::optional<Slice> authority;
@@ -22,6 +22,8 @@
 
 #include <algorithm>
 
+#include <grpc/impl/codegen/grpc_types.h>
+
 namespace grpc_core {
 
 void ChannelInit::Builder::RegisterStage(grpc_channel_stack_type type,
@@ -29,6 +31,17 @@ void ChannelInit::Builder::RegisterStage(grpc_channel_stack_type type,
   slots_[type].emplace_back(std::move(stage), priority);
 }
 
+void ChannelInit::Builder::RegisterFusableFilter(
+    const grpc_channel_filter* filter, uint8_t flags) {
+  fusable_filters_[filter] = FusableFilter{filter, flags};
+}
+
+void ChannelInit::Builder::RegisterFusedFilterSpecialization(
+    std::vector<const grpc_channel_filter*> children,
+    const grpc_channel_filter* composite) {
+  fused_specializations_[std::move(children)] = composite;
+}
+
 ChannelInit ChannelInit::Builder::Build() {
   ChannelInit result;
   for (int i = 0; i < GRPC_NUM_CHANNEL_STACK_TYPES; i++) {
@@ -42,6 +55,9 @@ ChannelInit ChannelInit::Builder::Build() {
       result_slots.emplace_back(std::move(slot.stage));
     }
   }
+  result.fusable_filters_ = std::move(fusable_filters_);
+  result.fused_specializations_ = std::move(fused_specializations_);
+  result.fused_filter_factory_ = fused_filter_factory_;
   return result;
 }
 
@@ -49,7 +65,59 @@ bool ChannelInit::CreateStack(ChannelStackBuilder* builder) const {
   for (const auto& stage : slots_[builder->channel_stack_type()]) {
     if (!stage(builder)) return false;
   }
+  if (fused_filter_factory_ != nullptr && !fusable_filters_.empty() &&
+      builder->channel_args()
+          .GetBool(GRPC_ARG_ENABLE_FILTER_FUSION)
+          .value_or(false)) {
+    FuseFilters(builder);
+  }
   return true;
 }
 
+void ChannelInit::FuseFilters(ChannelStackBuilder* builder) const {
+  std::vector<const grpc_channel_filter*>* stack = builder->mutable_stack();
+  if (stack->size() < 3) return;
+  const bool is_client =
+      grpc_channel_stack_type_is_client(builder->channel_stack_type());
+  std::vector<const grpc_channel_filter*> fused;
+  std::vector<FusableFilter> run;
+  fused.reserve(stack->size());
+  // The final entry terminates the stack (e.g. connected channel) and is
+  // never fused, so every composite keeps a downstream element to chain to.
+  const size_t last = stack->size() - 1;
+  size_t i = 0;
+  while (i < last) {
+    run.clear();
+    while (i < last) {
+      auto it = fusable_filters_.find((*stack)[i]);
+      if (it == fusable_filters_.end()) break;
+      run.push_back(it->second);
+      ++i;
+    }
+    if (run.size() >= 2) {
+      // Prefer a statically composed specialization for this exact run, then
+      // fall back to dynamic composition.
+      std::vector<const grpc_channel_filter*> key;
+      key.reserve(run.size());
+      for (const FusableFilter& f : run) key.push_back(f.filter);
+      auto sp = fused_specializations_.find(key);
+      const grpc_channel_filter* composite =
+          sp != fused_specializations_.end()
+              ? sp->second
+              : fused_filter_factory_(is_client,
+                                      absl::Span<const FusableFilter>(run));
+      if (composite != nullptr) {
+        fused.push_back(composite);
+        continue;
+      }
+    }
+    // Not a fusable run: emit the filters unchanged (including the
+    // non-fusable filter that ended the scan, if any).
+    for (const FusableFilter& f : run) fused.push_back(f.filter);
+    if (i < last) fused.push_back((*stack)[i++]);
+  }
+  fused.push_back((*stack)[last]);
+  *stack = std::move(fused);
+}
+
 }  // namespace grpc_core
@@ -21,10 +21,15 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stdint.h>
+
 #include <functional>
+#include <map>
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "src/core/lib/channel/channel_stack_builder.h"
 #include "src/core/lib/surface/channel_stack_type.h"
 
@@ -43,6 +48,21 @@ class ChannelInit {
   /// finally constructed channel stack
   using Stage = std::function<bool(ChannelStackBuilder* builder)>;
 
+  /// A promise-based filter that has been declared safe to fuse with adjacent
+  /// fusable filters into one composite filter at stack construction time.
+  /// \a flags are the MakePromiseBasedFilter flags the filter was built with,
+  /// so that the composite can reproduce their union.
+  struct FusableFilter {
+    const grpc_channel_filter* filter;
+    uint8_t flags;
+  };
+  /// Constructs (or returns a previously constructed) composite filter
+  /// equivalent to running \a filters adjacently in order. Returns nullptr if
+  /// the combination cannot be fused. Implemented by the promise filter
+  /// machinery and injected here so that this module need not depend on it.
+  using FusedFilterFactory = const grpc_channel_filter* (*)(
+      bool is_client, absl::Span<const FusableFilter> filters);
+
   class Builder {
    public:
     /// Register one stage of mutators.
@@ -57,6 +77,27 @@ class ChannelInit {
     /// to decide whether to add a filter or not.
     void RegisterStage(grpc_channel_stack_type type, int priority, Stage stage);
 
+    /// Declare \a filter (built with MakePromiseBasedFilter using \a flags)
+    /// safe to fuse with adjacent fusable filters. Only filters whose per-call
+    /// behavior is fully expressed through their call promise should be
+    /// registered here.
+    void RegisterFusableFilter(const grpc_channel_filter* filter,
+                               uint8_t flags);
+
+    /// Register a statically composed filter (e.g. a MakePromiseBasedFilter
+    /// instantiation of StaticFusedFilter) to be used in place of a
+    /// dynamically built composite whenever a fusable run matches
+    /// \a children exactly.
+    void RegisterFusedFilterSpecialization(
+        std::vector<const grpc_channel_filter*> children,
+        const grpc_channel_filter* composite);
+
+    /// Install the function used to build composite filters. Called once,
+    /// by the promise filter machinery's registration.
+    void SetFusedFilterFactory(FusedFilterFactory factory) {
+      fused_filter_factory_ = factory;
+    }
+
     /// Finalize registration. No more calls to grpc_channel_init_register_stage
     /// are allowed.
     ChannelInit Build();
@@ -69,6 +110,11 @@ class ChannelInit {
       int priority;
     };
     std::vector<Slot> slots_[GRPC_NUM_CHANNEL_STACK_TYPES];
+    std::map<const grpc_channel_filter*, FusableFilter> fusable_filters_;
+    std::map<std::vector<const grpc_channel_filter*>,
+             const grpc_channel_filter*>
+        fused_specializations_;
+    FusedFilterFactory fused_filter_factory_ = nullptr;
   };
 
   /// Construct a channel stack of some sort: see channel_stack.h for details
@@ -76,7 +122,16 @@ class ChannelInit {
   bool CreateStack(ChannelStackBuilder* builder) const;
 
  private:
+  // Replace maximal runs of two or more adjacent fusable filters in the
+  // built stack with composite filters. Only run when enabled via
+  // GRPC_ARG_ENABLE_FILTER_FUSION.
+  void FuseFilters(ChannelStackBuilder* builder) const;
+
   std::vector<Stage> slots_[GRPC_NUM_CHANNEL_STACK_TYPES];
+  std::map<const grpc_channel_filter*, FusableFilter> fusable_filters_;
+  std::map<std::vector<const grpc_channel_filter*>, const grpc_channel_filter*>
+      fused_specializations_;
+  FusedFilterFactory fused_filter_factory_ = nullptr;
 };
 
 }  // namespace grpc_core
@@ -29,6 +29,7 @@
 #include <utility>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/str_join.h"
@@ -40,11 +41,16 @@
 #include <grpc/support/log.h>
 #include <grpc/support/sync.h>
 
+#include "src/core/lib/debug/call_stage_profiler.h"
 #include "src/core/lib/debug/stats.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/event_engine/thread_pool.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gpr/spinlock.h"
 #include "src/core/lib/gprpp/atomic_utils.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
@@ -213,6 +219,9 @@ struct cq_vtable {
                  void* done_arg, grpc_cq_completion* storage, bool internal);
   grpc_event (*next)(grpc_completion_queue* cq, gpr_timespec deadline,
                      void* reserved);
+  size_t (*next_batch)(grpc_completion_queue* cq, grpc_event* events,
+                       size_t max_events, gpr_timespec deadline,
+                       void* reserved);
   grpc_event (*pluck)(grpc_completion_queue* cq, void* tag,
                       gpr_timespec deadline, void* reserved);
 };
@@ -270,6 +279,13 @@ struct cq_next_data {
       Initial count is dropped by grpc_completion_queue_shutdown */
   std::atomic<intptr_t> pending_events{1};
 
+  /** Number of threads currently blocked (or just about to block) in pollset
+      work on behalf of this cq. Producers only pay for a pollset kick - and
+      the cq mutex it needs - when this is non-zero; see the seq_cst fences in
+      cq_next_batch and cq_end_op_for_next for the protocol that makes the
+      skipped kick safe */
+  std::atomic<intptr_t> pollers_waiting{0};
+
   /** 0 initially. 1 once we initiated shutdown */
   bool shutdown_called = false;
 };
@@ -398,6 +414,10 @@ static void cq_end_op_for_callback(
 static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
                           void* reserved);
 
+static size_t cq_next_batch(grpc_completion_queue* cq, grpc_event* events,
+                            size_t max_events, gpr_timespec deadline,
+                            void* reserved);
+
 static grpc_event cq_pluck(grpc_completion_queue* cq, void* tag,
                            gpr_timespec deadline, void* reserved);
 
@@ -417,15 +437,15 @@ static const cq_vtable g_cq_vtable[] = {
     /* GRPC_CQ_NEXT */
     {GRPC_CQ_NEXT, sizeof(cq_next_data), cq_init_next, cq_shutdown_next,
      cq_destroy_next, cq_begin_op_for_next, cq_end_op_for_next, cq_next,
-     nullptr},
+     cq_next_batch, nullptr},
     /* GRPC_CQ_PLUCK */
     {GRPC_CQ_PLUCK, sizeof(cq_pluck_data), cq_init_pluck, cq_shutdown_pluck,
      cq_destroy_pluck, cq_begin_op_for_pluck, cq_end_op_for_pluck, nullptr,
-     cq_pluck},
+     nullptr, cq_pluck},
     /* GRPC_CQ_CALLBACK */
     {GRPC_CQ_CALLBACK, sizeof(cq_callback_data), cq_init_callback,
      cq_shutdown_callback, cq_destroy_callback, cq_begin_op_for_callback,
-     cq_end_op_for_callback, nullptr, nullptr},
+     cq_end_op_for_callback, nullptr, nullptr, nullptr},
 };
 
 #define DATA_FROM_CQ(cq) ((void*)((cq) + 1))
@@ -690,6 +710,8 @@ static void cq_end_op_for_next(
     grpc_completion_queue* cq, void* tag, grpc_error_handle error,
     void (*done)(void* done_arg, grpc_cq_completion* storage), void* done_arg,
     grpc_cq_completion* storage, bool /*internal*/) {
+  grpc_core::ScopedCallStageTimer stage_timer(
+      grpc_core::CallStage::kSurfaceCompletion);
   if (GRPC_TRACE_FLAG_ENABLED(grpc_api_trace) ||
       (GRPC_TRACE_FLAG_ENABLED(grpc_trace_operation_failures) && !error.ok())) {
     std::string errmsg = grpc_error_std_string(error);
@@ -724,16 +746,25 @@ static void cq_end_op_for_next(
        (done via pending_events.fetch_sub(1, ACQ_REL)) in cq_shutdown_next
        */
     if (cqd->pending_events.load(std::memory_order_acquire) != 1) {
-      /* Only kick if this is the first item queued */
+      /* Only kick if this is the first item queued and a poller is blocked
+         (or about to block) in pollset work. A consumer that is still
+         harvesting re-checks the queue after advertising itself in
+         pollers_waiting and before blocking, so if we observe
+         pollers_waiting == 0 here - after the fence that orders our Push
+         before the load - no wakeup is needed and the completion path stays
+         lock-free */
       if (is_first) {
-        gpr_mu_lock(cq->mu);
-        grpc_error_handle kick_error =
-            cq->poller_vtable->kick(POLLSET_FROM_CQ(cq), nullptr);
-        gpr_mu_unlock(cq->mu);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (cqd->pollers_waiting.load(std::memory_order_relaxed) > 0) {
+          gpr_mu_lock(cq->mu);
+          grpc_error_handle kick_error =
+              cq->poller_vtable->kick(POLLSET_FROM_CQ(cq), nullptr);
+          gpr_mu_unlock(cq->mu);
 
-        if (!kick_error.ok()) {
-          gpr_log(GPR_ERROR, "Kick failed: %s",
-                  grpc_error_std_string(kick_error).c_str());
+          if (!kick_error.ok()) {
+            gpr_log(GPR_ERROR, "Kick failed: %s",
+                    grpc_error_std_string(kick_error).c_str());
+          }
         }
       }
       if (cqd->pending_events.fetch_sub(1, std::memory_order_acq_rel) == 1) {
@@ -819,6 +850,92 @@ static void functor_callback(void* arg, grpc_error_handle error) {
   functor->functor_run(functor, error.ok());
 }
 
+namespace {
+
+// A batch of callback functors accumulated on one thread and handed to the
+// executor as a single closure. Completing several events in one drain cycle
+// (a transport read finishing a read and a write for the same reactor, say)
+// previously scheduled one executor closure per event; batching delivers them
+// all in one. The functor's internal_next/internal_success fields are reused
+// for the intrusive list, exactly as ApplicationCallbackExecCtx does.
+struct FunctorBatch {
+  grpc_core::Mutex mu;
+  grpc_completion_queue_functor* head ABSL_GUARDED_BY(mu) = nullptr;
+  grpc_completion_queue_functor* tail ABSL_GUARDED_BY(mu) = nullptr;
+  // Set when the executor closure drains the batch; no more appends after.
+  bool taken ABSL_GUARDED_BY(mu) = false;
+  grpc_closure closure;
+  // One ref held by the enqueuing thread's slot, one by the closure.
+  std::atomic<int> refs{2};
+
+  void Unref() {
+    if (refs.fetch_sub(1, std::memory_order_acq_rel) == 1) delete this;
+  }
+};
+
+// The batch currently accepting functors from this thread, if any. The
+// wrapper releases the thread's ref when the thread exits.
+struct FunctorBatchTls {
+  FunctorBatch* batch = nullptr;
+  ~FunctorBatchTls() {
+    if (batch != nullptr) batch->Unref();
+  }
+};
+thread_local FunctorBatchTls g_functor_batch;
+
+void functor_batch_run(void* arg, grpc_error_handle /*error*/) {
+  FunctorBatch* batch = static_cast<FunctorBatch*>(arg);
+  grpc_completion_queue_functor* head;
+  {
+    grpc_core::MutexLock lock(&batch->mu);
+    batch->taken = true;
+    head = batch->head;
+    batch->head = batch->tail = nullptr;
+  }
+  // Deliver the whole batch within one ApplicationCallbackExecCtx:
+  // continuations that complete further inlineable events enqueue here and
+  // run before this closure unwinds instead of bouncing through the executor
+  // again.
+  grpc_core::ApplicationCallbackExecCtx callback_exec_ctx(
+      GRPC_APP_CALLBACK_EXEC_CTX_FLAG_IS_INTERNAL_THREAD);
+  while (head != nullptr) {
+    auto* functor = head;
+    head = functor->internal_next;
+    functor->functor_run(functor, functor->internal_success);
+  }
+  batch->Unref();
+}
+
+// Route a functor to the executor, coalescing with any other functors this
+// thread produces before the scheduled closure runs.
+void functor_batch_enqueue(grpc_completion_queue_functor* functor, bool ok) {
+  functor->internal_success = ok;
+  functor->internal_next = nullptr;
+  FunctorBatch* batch = g_functor_batch.batch;
+  if (batch != nullptr) {
+    grpc_core::MutexLock lock(&batch->mu);
+    if (!batch->taken) {
+      batch->tail->internal_next = functor;
+      batch->tail = functor;
+      return;
+    }
+  }
+  if (batch != nullptr) {
+    batch->Unref();
+    g_functor_batch.batch = nullptr;
+  }
+  batch = new FunctorBatch;
+  {
+    grpc_core::MutexLock lock(&batch->mu);
+    batch->head = batch->tail = functor;
+  }
+  g_functor_batch.batch = batch;
+  GRPC_CLOSURE_INIT(&batch->closure, functor_batch_run, batch, nullptr);
+  grpc_core::Executor::Run(&batch->closure, absl::OkStatus());
+}
+
+}  // namespace
+
 /* Complete an event on a completion queue of type GRPC_CQ_CALLBACK */
 static void cq_end_op_for_callback(
     grpc_completion_queue* cq, void* tag, grpc_error_handle error,
@@ -863,10 +980,39 @@ static void cq_end_op_for_callback(
     return;
   }
 
+  // With the event_engine_callback_cq experiment the functor goes straight
+  // to the EventEngine, skipping the executor queue hop entirely: inline if
+  // this thread is already an EventEngine worker, scheduled on the engine
+  // otherwise.
+  if (grpc_core::IsEventEngineCallbackCqEnabled()) {
+    if (grpc_event_engine::experimental::ThreadPool::IsThreadPoolThread()) {
+      // Already on an EventEngine worker: defer to the stack-base callback
+      // exec ctx when one exists, otherwise deliver within a fresh one.
+      if (grpc_core::ApplicationCallbackExecCtx::Available()) {
+        grpc_core::ApplicationCallbackExecCtx::Enqueue(functor, error.ok());
+      } else {
+        grpc_core::ApplicationCallbackExecCtx callback_exec_ctx(
+            GRPC_APP_CALLBACK_EXEC_CTX_FLAG_IS_INTERNAL_THREAD);
+        functor->functor_run(functor, error.ok());
+      }
+      return;
+    }
+    const bool ok = error.ok();
+    grpc_event_engine::experimental::GetDefaultEventEngine()->Run(
+        [functor, ok]() {
+          grpc_core::ApplicationCallbackExecCtx callback_exec_ctx(
+              GRPC_APP_CALLBACK_EXEC_CTX_FLAG_IS_INTERNAL_THREAD);
+          grpc_core::ExecCtx exec_ctx;
+          functor->functor_run(functor, ok);
+        });
+    return;
+  }
+
   // Schedule the callback on a closure if not internal or triggered
-  // from a background poller thread.
-  grpc_core::Executor::Run(
-      GRPC_CLOSURE_CREATE(functor_callback, functor, nullptr), error);
+  // from a background poller thread, coalescing with any other callbacks
+  // this thread completes before the closure runs so that the whole batch is
+  // delivered in one scheduled closure.
+  functor_batch_enqueue(functor, error.ok());
 }
 
 void grpc_cq_end_op(grpc_completion_queue* cq, void* tag,
@@ -938,21 +1084,20 @@ static void dump_pending_tags(grpc_completion_queue* cq) {
 static void dump_pending_tags(grpc_completion_queue* /*cq*/) {}
 #endif
 
-static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
-                          void* reserved) {
-  grpc_event ret;
+/* Harvests up to max_events events in one call. Blocks like cq_next until at
+   least one completion is available, then additionally drains (without
+   further blocking) whatever completions are already queued, so that the
+   synchronization cost of waking up is amortized over the batch. Returns the
+   number of events written: either some completions, or a single
+   GRPC_QUEUE_SHUTDOWN/GRPC_QUEUE_TIMEOUT event if none arrived. */
+static size_t cq_next_batch(grpc_completion_queue* cq, grpc_event* events,
+                            size_t max_events, gpr_timespec deadline,
+                            void* reserved) {
   cq_next_data* cqd = static_cast<cq_next_data*> DATA_FROM_CQ(cq);
+  size_t count = 0;
 
-  GRPC_API_TRACE(
-      "grpc_completion_queue_next("
-      "cq=%p, "
-      "deadline=gpr_timespec { tv_sec: %" PRId64
-      ", tv_nsec: %d, clock_type: %d }, "
-      "reserved=%p)",
-      5,
-      (cq, deadline.tv_sec, deadline.tv_nsec, (int)deadline.clock_type,
-       reserved));
   GPR_ASSERT(!reserved);
+  GPR_ASSERT(max_events > 0);
 
   dump_pending_tags(cq);
 
@@ -974,30 +1119,32 @@ static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
     if (is_finished_arg.stolen_completion != nullptr) {
       grpc_cq_completion* c = is_finished_arg.stolen_completion;
       is_finished_arg.stolen_completion = nullptr;
-      ret.type = GRPC_OP_COMPLETE;
-      ret.success = c->next & 1u;
-      ret.tag = c->tag;
+      events[count].type = GRPC_OP_COMPLETE;
+      events[count].success = c->next & 1u;
+      events[count].tag = c->tag;
       c->done(c->done_arg, c);
-      break;
+      ++count;
     }
 
-    grpc_cq_completion* c = cqd->queue.Pop();
-
-    if (c != nullptr) {
-      ret.type = GRPC_OP_COMPLETE;
-      ret.success = c->next & 1u;
-      ret.tag = c->tag;
+    /* Drain as many queued completions as we have room for in one pass. */
+    while (count < max_events) {
+      grpc_cq_completion* c = cqd->queue.Pop();
+      if (c == nullptr) break;
+      events[count].type = GRPC_OP_COMPLETE;
+      events[count].success = c->next & 1u;
+      events[count].tag = c->tag;
       c->done(c->done_arg, c);
-      break;
-    } else {
-      /* If c == NULL it means either the queue is empty OR in an transient
-         inconsistent state. If it is the latter, we shold do a 0-timeout poll
-         so that the thread comes back quickly from poll to make a second
-         attempt at popping. Not doing this can potentially deadlock this
-         thread forever (if the deadline is infinity) */
-      if (cqd->queue.num_items() > 0) {
-        iteration_deadline = grpc_core::Timestamp::ProcessEpoch();
-      }
+      ++count;
+    }
+    if (count > 0) break;
+
+    /* If Pop() returned NULL it means either the queue is empty OR in an
+       transient inconsistent state. If it is the latter, we shold do a
+       0-timeout poll so that the thread comes back quickly from poll to make
+       a second attempt at popping. Not doing this can potentially deadlock
+       this thread forever (if the deadline is infinity) */
+    if (cqd->queue.num_items() > 0) {
+      iteration_deadline = grpc_core::Timestamp::ProcessEpoch();
     }
 
     if (cqd->pending_events.load(std::memory_order_acquire) == 0) {
@@ -1013,35 +1160,52 @@ static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
         continue;
       }
 
-      ret.type = GRPC_QUEUE_SHUTDOWN;
-      ret.success = 0;
+      events[count].type = GRPC_QUEUE_SHUTDOWN;
+      events[count].success = 0;
+      events[count].tag = nullptr;
+      ++count;
       break;
     }
 
     if (!is_finished_arg.first_loop &&
         grpc_core::Timestamp::Now() >= deadline_millis) {
-      ret.type = GRPC_QUEUE_TIMEOUT;
-      ret.success = 0;
+      events[count].type = GRPC_QUEUE_TIMEOUT;
+      events[count].success = 0;
+      events[count].tag = nullptr;
+      ++count;
       dump_pending_tags(cq);
       break;
     }
 
+    /* Advertise this thread as a waiting poller, then re-check the queue:
+       paired with the fence in cq_end_op_for_next this guarantees that a
+       producer either sees us here and kicks, or that we see its completion
+       and poll with a zero timeout instead of blocking */
+    cqd->pollers_waiting.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (cqd->queue.num_items() > 0) {
+      iteration_deadline = grpc_core::Timestamp::ProcessEpoch();
+    }
+
     /* The main polling work happens in grpc_pollset_work */
     gpr_mu_lock(cq->mu);
     cq->num_polls++;
     grpc_error_handle err = cq->poller_vtable->work(
         POLLSET_FROM_CQ(cq), nullptr, iteration_deadline);
     gpr_mu_unlock(cq->mu);
+    cqd->pollers_waiting.fetch_sub(1, std::memory_order_relaxed);
 
     if (!err.ok()) {
       gpr_log(GPR_ERROR, "Completion queue next failed: %s",
               grpc_error_std_string(err).c_str());
       if (err == absl::CancelledError()) {
-        ret.type = GRPC_QUEUE_SHUTDOWN;
+        events[count].type = GRPC_QUEUE_SHUTDOWN;
       } else {
-        ret.type = GRPC_QUEUE_TIMEOUT;
+        events[count].type = GRPC_QUEUE_TIMEOUT;
       }
-      ret.success = 0;
+      events[count].success = 0;
+      events[count].tag = nullptr;
+      ++count;
       dump_pending_tags(cq);
       break;
     }
@@ -1050,16 +1214,43 @@ static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
 
   if (cqd->queue.num_items() > 0 &&
       cqd->pending_events.load(std::memory_order_acquire) > 0) {
-    gpr_mu_lock(cq->mu);
-    (void)cq->poller_vtable->kick(POLLSET_FROM_CQ(cq), nullptr);
-    gpr_mu_unlock(cq->mu);
+    /* Leftover items: wake another poller to keep draining, but only if one
+       is actually blocked - any thread still harvesting will find the items
+       itself */
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (cqd->pollers_waiting.load(std::memory_order_relaxed) > 0) {
+      gpr_mu_lock(cq->mu);
+      (void)cq->poller_vtable->kick(POLLSET_FROM_CQ(cq), nullptr);
+      gpr_mu_unlock(cq->mu);
+    }
   }
 
-  GRPC_SURFACE_TRACE_RETURNED_EVENT(cq, &ret);
+  for (size_t i = 0; i < count; i++) {
+    GRPC_SURFACE_TRACE_RETURNED_EVENT(cq, &events[i]);
+  }
   GRPC_CQ_INTERNAL_UNREF(cq, "next");
 
   GPR_ASSERT(is_finished_arg.stolen_completion == nullptr);
 
+  return count;
+}
+
+static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
+                          void* reserved) {
+  grpc_event ret;
+
+  GRPC_API_TRACE(
+      "grpc_completion_queue_next("
+      "cq=%p, "
+      "deadline=gpr_timespec { tv_sec: %" PRId64
+      ", tv_nsec: %d, clock_type: %d }, "
+      "reserved=%p)",
+      5,
+      (cq, deadline.tv_sec, deadline.tv_nsec, (int)deadline.clock_type,
+       reserved));
+
+  GPR_ASSERT(cq_next_batch(cq, &ret, 1, deadline, reserved) == 1);
+
   return ret;
 }
 
@@ -1110,6 +1301,22 @@ grpc_event grpc_completion_queue_next(grpc_completion_queue* cq,
   return cq->vtable->next(cq, deadline, reserved);
 }
 
+size_t grpc_completion_queue_next_batch(grpc_completion_queue* cq,
+                                        grpc_event* events, size_t max_events,
+                                        gpr_timespec deadline, void* reserved) {
+  GRPC_API_TRACE(
+      "grpc_completion_queue_next_batch("
+      "cq=%p, events=%p, max_events=%" PRIuPTR
+      ", "
+      "deadline=gpr_timespec { tv_sec: %" PRId64
+      ", tv_nsec: %d, clock_type: %d }, "
+      "reserved=%p)",
+      7,
+      (cq, events, max_events, deadline.tv_sec, deadline.tv_nsec,
+       (int)deadline.clock_type, reserved));
+  return cq->vtable->next_batch(cq, events, max_events, deadline, reserved);
+}
+
 static int add_plucker(grpc_completion_queue* cq, void* tag,
                        grpc_pollset_worker** worker) {
   cq_pluck_data* cqd = static_cast<cq_pluck_data*> DATA_FROM_CQ(cq);
@@ -36,6 +36,7 @@
 #include <grpc/byte_buffer.h>
 #include <grpc/impl/codegen/connectivity_state.h>
 #include <grpc/status.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
 #include <grpc/support/time.h>
 
@@ -44,6 +45,7 @@
 #include "src/core/lib/channel/channel_trace.h"
 #include "src/core/lib/channel/channelz.h"
 #include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/mpscq.h"
@@ -188,6 +190,69 @@ class Server::RequestMatcherInterface {
   virtual Server* server() const = 0;
 };
 
+namespace {
+
+// The set of application-requested calls associated with one server CQ,
+// sharded by CPU so that many threads calling grpc_server_request_call (and
+// many transport threads matching incoming RPCs) do not serialize on a single
+// consumer lock. Push lands on the caller's shard; pop scans all shards
+// starting from the caller's shard, so requests parked by other CPUs are
+// stolen rather than stranded. A nullptr return from PopAll therefore really
+// does mean every shard was empty at some point during the call, which is the
+// property the matcher's slow path relies on.
+class ShardedRequestQueue {
+ public:
+  ShardedRequestQueue() : shards_(NumShards()) {}
+
+  // Push a request onto the current CPU's shard. Returns true if this was
+  // possibly the first node in that shard (same sporadic-true contract as
+  // LockedMultiProducerSingleConsumerQueue::Push).
+  bool Push(MultiProducerSingleConsumerQueue::Node* node) {
+    return shards_[CurrentShardIndex()].Push(node);
+  }
+
+  // Opportunistically pop a request, stealing from other shards if the
+  // current CPU's shard is empty or its consumer lock is held. May return
+  // nullptr even if requests exist (TryPop semantics).
+  MultiProducerSingleConsumerQueue::Node* TryPop() {
+    const size_t start = CurrentShardIndex();
+    for (size_t i = 0; i < shards_.size(); i++) {
+      MultiProducerSingleConsumerQueue::Node* node =
+          shards_[(start + i) % shards_.size()].TryPop();
+      if (node != nullptr) return node;
+    }
+    return nullptr;
+  }
+
+  // Pop a request, checking every shard. Returns nullptr only if each shard
+  // was empty at some point during this call.
+  MultiProducerSingleConsumerQueue::Node* PopAll() {
+    for (size_t i = 0; i < shards_.size(); i++) {
+      MultiProducerSingleConsumerQueue::Node* node = shards_[i].Pop();
+      if (node != nullptr) return node;
+    }
+    return nullptr;
+  }
+
+ private:
+  static size_t NumShards() {
+    return Clamp(static_cast<size_t>(gpr_cpu_num_cores()), size_t(1),
+                 size_t(32));
+  }
+
+  size_t CurrentShardIndex() const {
+    // Shutdown and destruction paths may run without an ExecCtx; any shard
+    // works there since PopAll scans all of them.
+    ExecCtx* exec_ctx = ExecCtx::Get();
+    return (exec_ctx == nullptr ? 0 : exec_ctx->starting_cpu()) %
+           shards_.size();
+  }
+
+  std::vector<LockedMultiProducerSingleConsumerQueue> shards_;
+};
+
+}  // namespace
+
 // The RealRequestMatcher is an implementation of RequestMatcherInterface that
 // actually uses all the features of RequestMatcherInterface: expecting the
 // application to explicitly request RPCs and then matching those to incoming
@@ -199,8 +264,8 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
       : server_(server), requests_per_cq_(server->cqs_.size()) {}
 
   ~RealRequestMatcher() override {
-    for (LockedMultiProducerSingleConsumerQueue& queue : requests_per_cq_) {
-      GPR_ASSERT(queue.Pop() == nullptr);
+    for (ShardedRequestQueue& queue : requests_per_cq_) {
+      GPR_ASSERT(queue.PopAll() == nullptr);
     }
   }
 
@@ -217,7 +282,7 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
     for (size_t i = 0; i < requests_per_cq_.size(); i++) {
       RequestedCall* rc;
       while ((rc = reinterpret_cast<RequestedCall*>(
-                  requests_per_cq_[i].Pop())) != nullptr) {
+                  requests_per_cq_[i].PopAll())) != nullptr) {
         server_->FailCall(i, rc, error);
       }
     }
@@ -230,8 +295,8 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
   void RequestCallWithPossiblePublish(size_t request_queue_index,
                                       RequestedCall* call) override {
     if (requests_per_cq_[request_queue_index].Push(&call->mpscq_node)) {
-      /* this was the first queued request: we need to lock and start
-         matching calls */
+      /* this was the first request queued on its shard: we need to lock and
+         start matching calls */
       struct PendingCall {
         RequestedCall* rc = nullptr;
         CallData* calld;
@@ -242,7 +307,7 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
           MutexLock lock(&server_->mu_call_);
           if (!pending_.empty()) {
             pending_call.rc = reinterpret_cast<RequestedCall*>(
-                requests_per_cq_[request_queue_index].Pop());
+                requests_per_cq_[request_queue_index].PopAll());
             if (pending_call.rc != nullptr) {
               pending_call.calld = pending_.front();
               pending_.pop();
@@ -289,7 +354,8 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
       for (loop_count = 0; loop_count < requests_per_cq_.size(); loop_count++) {
         cq_idx =
             (start_request_queue_index + loop_count) % requests_per_cq_.size();
-        rc = reinterpret_cast<RequestedCall*>(requests_per_cq_[cq_idx].Pop());
+        rc = reinterpret_cast<RequestedCall*>(
+            requests_per_cq_[cq_idx].PopAll());
         if (rc != nullptr) {
           break;
         }
@@ -309,7 +375,7 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
  private:
   Server* const server_;
   std::queue<CallData*> pending_;
-  std::vector<LockedMultiProducerSingleConsumerQueue> requests_per_cq_;
+  std::vector<ShardedRequestQueue> requests_per_cq_;
 };
 
 // AllocatingRequestMatchers don't allow the application to request an RPC in
@@ -441,10 +507,34 @@ class ChannelBroadcaster {
     channels_ = std::move(channels);
   }
 
-  // Broadcasts a shutdown on each channel.
+  // Broadcasts a shutdown on each channel.  Large channel sets are sharded
+  // across EventEngine threads so that draining many thousands of
+  // connections does not serialize every GOAWAY/disconnect op on the calling
+  // thread; the per-connection teardown itself stays asynchronous in the
+  // transport as before.
   void BroadcastShutdown(bool send_goaway, grpc_error_handle force_disconnect) {
-    for (const RefCountedPtr<Channel>& channel : channels_) {
-      SendShutdown(channel->c_ptr(), send_goaway, force_disconnect);
+    static constexpr size_t kShardSize = 256;
+    if (channels_.size() > kShardSize) {
+      auto event_engine =
+          grpc_event_engine::experimental::GetDefaultEventEngine();
+      for (size_t begin = 0; begin < channels_.size(); begin += kShardSize) {
+        const size_t end = std::min(begin + kShardSize, channels_.size());
+        std::vector<RefCountedPtr<Channel>> shard(
+            std::make_move_iterator(channels_.begin() + begin),
+            std::make_move_iterator(channels_.begin() + end));
+        event_engine->Run(
+            [shard = std::move(shard), send_goaway, force_disconnect]() {
+              ApplicationCallbackExecCtx callback_exec_ctx;
+              ExecCtx exec_ctx;
+              for (const RefCountedPtr<Channel>& channel : shard) {
+                SendShutdown(channel->c_ptr(), send_goaway, force_disconnect);
+              }
+            });
+      }
+    } else {
+      for (const RefCountedPtr<Channel>& channel : channels_) {
+        SendShutdown(channel->c_ptr(), send_goaway, force_disconnect);
+      }
     }
     channels_.clear();  // just for safety against double broadcast
   }
@@ -568,6 +658,7 @@ void Server::Start() {
       rm->matcher = std::make_unique<RealRequestMatcher>(this);
     }
   }
+  BuildRegisteredMethodRoutingTable();
   {
     MutexLock lock(&mu_global_);
     starting_ = true;
@@ -687,6 +778,104 @@ Server::RegisteredMethod* Server::RegisterMethod(
   return registered_methods_.back().get();
 }
 
+namespace {
+
+uint32_t SeededMethodHash(uint32_t seed, uint32_t host_hash,
+                          uint32_t method_hash) {
+  // Mix the seed into each input before combining: mixed in only
+  // afterwards, two methods colliding in MixHash32(host_hash, method_hash)
+  // would collide under every seed and no table size could separate them.
+  return MixHash32(MixHash32(seed, host_hash), MixHash32(seed, method_hash));
+}
+
+}  // namespace
+
+// The registered-method set is static once the server starts, so instead of
+// an open-addressed table with probe chains we search for a (table size,
+// seed) pair under which every method hashes to a distinct slot. Lookup is
+// then a single probe with zero collisions. The search is cheap: for each
+// size we try a handful of seeds and otherwise double the table, and method
+// counts are small (tens to hundreds). The search is bounded: two methods
+// whose host and method hashes both collide can never be separated by any
+// seed or size, so after a few doublings we fall back to linear probing,
+// which lookup handles by scanning the probe chain.
+void Server::BuildRegisteredMethodRoutingTable() {
+  const size_t num_registered_methods = registered_methods_.size();
+  if (num_registered_methods == 0) return;
+  struct HashedMethod {
+    RegisteredMethod* rm;
+    uint32_t host_hash;
+    uint32_t method_hash;
+  };
+  std::vector<HashedMethod> hashed;
+  hashed.reserve(num_registered_methods);
+  for (std::unique_ptr<RegisteredMethod>& rm : registered_methods_) {
+    const bool has_host = !rm->host.empty();
+    hashed.push_back(
+        {rm.get(),
+         has_host ? Slice::FromExternalString(rm->host).Hash() : 0,
+         Slice::FromExternalString(rm->method).Hash()});
+  }
+  const uint32_t min_slots = RoundUpToPowerOf2(
+      static_cast<uint32_t>(2 * num_registered_methods));
+  auto fill_slot = [&](size_t i, uint32_t slot) {
+    RegisteredMethod* rm = hashed[i].rm;
+    ChannelRegisteredMethod* crm = &registered_method_table_[slot];
+    crm->server_registered_method = rm;
+    crm->flags = rm->flags;
+    crm->has_host = !rm->host.empty();
+    if (crm->has_host) {
+      crm->host = Slice::FromExternalString(rm->host);
+    }
+    crm->method = Slice::FromExternalString(rm->method);
+  };
+  std::vector<uint32_t> slot_of(num_registered_methods);
+  uint32_t slots = min_slots;
+  for (int doubling = 0; doubling < 4 && slots != 0; doubling++, slots *= 2) {
+    for (uint32_t seed = 0; seed < 64; seed++) {
+      std::vector<bool> used(slots, false);
+      bool ok = true;
+      for (size_t i = 0; i < num_registered_methods; i++) {
+        const uint32_t slot = SeededMethodHash(seed, hashed[i].host_hash,
+                                               hashed[i].method_hash) &
+                              (slots - 1);
+        if (used[slot]) {
+          ok = false;
+          break;
+        }
+        used[slot] = true;
+        slot_of[i] = slot;
+      }
+      if (!ok) continue;
+      // Found a collision-free layout: publish it.
+      registered_method_table_.clear();
+      registered_method_table_.resize(slots);
+      for (size_t i = 0; i < num_registered_methods; i++) {
+        fill_slot(i, slot_of[i]);
+      }
+      registered_method_seed_ = seed;
+      return;
+    }
+  }
+  // No collision-free layout within bounds (e.g. two methods collide in
+  // both 32-bit hashes): publish a linear-probed layout instead. The table
+  // is at most half full, so probe chains stay short and always terminate
+  // at an empty slot.
+  registered_method_table_.clear();
+  registered_method_table_.resize(min_slots);
+  registered_method_seed_ = 0;
+  for (size_t i = 0; i < num_registered_methods; i++) {
+    uint32_t slot = SeededMethodHash(0, hashed[i].host_hash,
+                                     hashed[i].method_hash) &
+                    (min_slots - 1);
+    while (registered_method_table_[slot].server_registered_method !=
+           nullptr) {
+      slot = (slot + 1) & (min_slots - 1);
+    }
+    fill_slot(i, slot);
+  }
+}
+
 void Server::DoneRequestEvent(void* req, grpc_cq_completion* /*c*/) {
   delete static_cast<RequestedCall*>(req);
 }
@@ -802,7 +991,9 @@ void Server::ShutdownAndNotify(grpc_completion_queue* cq, void* tag) {
       return;
     }
     last_shutdown_message_time_ = gpr_now(GPR_CLOCK_REALTIME);
-    broadcaster.FillChannelsLocked(GetChannelsLocked());
+    std::vector<RefCountedPtr<Channel>> channels = GetChannelsLocked();
+    channels_at_shutdown_ = channels.size();
+    broadcaster.FillChannelsLocked(std::move(channels));
     // Collect all unregistered then registered calls.
     {
       MutexLock lock(&mu_call_);
@@ -856,6 +1047,30 @@ void Server::SendGoaways() {
   broadcaster.BroadcastShutdown(/*send_goaway=*/true, absl::OkStatus());
 }
 
+void Server::GetShutdownDrainProgress(size_t* channels_at_shutdown,
+                                      size_t* channels_remaining) {
+  MutexLock lock(&mu_global_);
+  if (!ShutdownCalled()) {
+    *channels_at_shutdown = 0;
+    *channels_remaining = 0;
+    return;
+  }
+  *channels_at_shutdown = channels_at_shutdown_;
+  // Connections accepted between the shutdown call and the listeners going
+  // away can momentarily leave more channels than were counted at shutdown;
+  // never report more remaining than the initial total.
+  *channels_remaining = std::min(channels_.size(), channels_at_shutdown_);
+}
+
+void Server::RebalanceConnectionCqAssignments() {
+  MutexLock lock(&mu_global_);
+  if (cqs_.empty()) return;
+  size_t next_cq_idx = 0;
+  for (ChannelData* chand : channels_) {
+    chand->set_cq_idx(next_cq_idx++ % cqs_.size());
+  }
+}
+
 void Server::Orphan() {
   {
     MutexLock lock(&mu_global_);
@@ -982,7 +1197,6 @@ class Server::ChannelData::ConnectivityWatcher
 //
 
 Server::ChannelData::~ChannelData() {
-  registered_methods_.reset();
   if (server_ != nullptr) {
     if (server_->channelz_node_ != nullptr && channelz_socket_uuid_ != 0) {
       server_->channelz_node_->RemoveChildSocket(channelz_socket_uuid_);
@@ -1007,41 +1221,9 @@ void Server::ChannelData::InitTransport(RefCountedPtr<Server> server,
   channel_ = channel;
   cq_idx_ = cq_idx;
   channelz_socket_uuid_ = channelz_socket_uuid;
-  // Build a lookup table phrased in terms of mdstr's in this channels context
-  // to quickly find registered methods.
-  size_t num_registered_methods = server_->registered_methods_.size();
-  if (num_registered_methods > 0) {
-    uint32_t max_probes = 0;
-    size_t slots = 2 * num_registered_methods;
-    registered_methods_ =
-        std::make_unique<std::vector<ChannelRegisteredMethod>>(slots);
-    for (std::unique_ptr<RegisteredMethod>& rm : server_->registered_methods_) {
-      Slice host;
-      Slice method = Slice::FromExternalString(rm->method);
-      const bool has_host = !rm->host.empty();
-      if (has_host) {
-        host = Slice::FromExternalString(rm->host.c_str());
-      }
-      uint32_t hash = MixHash32(has_host ? host.Hash() : 0, method.Hash());
-      uint32_t probes = 0;
-      for (probes = 0; (*registered_methods_)[(hash + probes) % slots]
-                           .server_registered_method != nullptr;
-           probes++) {
-      }
-      if (probes > max_probes) max_probes = probes;
-      ChannelRegisteredMethod* crm =
-          &(*registered_methods_)[(hash + probes) % slots];
-      crm->server_registered_method = rm.get();
-      crm->flags = rm->flags;
-      crm->has_host = has_host;
-      if (has_host) {
-        crm->host = std::move(host);
-      }
-      crm->method = std::move(method);
-    }
-    GPR_ASSERT(slots <= UINT32_MAX);
-    registered_method_max_probes_ = max_probes;
-  }
+  // Registered-method routing uses the server's single-probe table (see
+  // BuildRegisteredMethodRoutingTable()); there is no per-channel state to
+  // set up.
   // Publish channel.
   {
     MutexLock lock(&server_->mu_global_);
@@ -1063,30 +1245,34 @@ void Server::ChannelData::InitTransport(RefCountedPtr<Server> server,
 
 Server::ChannelRegisteredMethod* Server::ChannelData::GetRegisteredMethod(
     const grpc_slice& host, const grpc_slice& path) {
-  if (registered_methods_ == nullptr) return nullptr;
-  /* TODO(ctiller): unify these two searches */
+  std::vector<ChannelRegisteredMethod>& table =
+      server_->registered_method_table_;
+  if (table.empty()) return nullptr;
+  const uint32_t mask = static_cast<uint32_t>(table.size()) - 1;
+  const uint32_t seed = server_->registered_method_seed_;
+  const uint32_t path_hash = grpc_slice_hash(path);
+  // The table is usually collision-free and each search is a single probe,
+  // but the build may have fallen back to linear probing; walk the probe
+  // chain until a match or the first empty slot.
+  auto probe = [&](uint32_t host_hash,
+                   bool has_host) -> ChannelRegisteredMethod* {
+    uint32_t slot = SeededMethodHash(seed, host_hash, path_hash) & mask;
+    for (uint32_t probes = 0; probes <= mask;
+         probes++, slot = (slot + 1) & mask) {
+      ChannelRegisteredMethod* rm = &table[slot];
+      if (rm->server_registered_method == nullptr) return nullptr;
+      if (rm->has_host == has_host && rm->method == path &&
+          (!has_host || rm->host == host)) {
+        return rm;
+      }
+    }
+    return nullptr;
+  };
   /* check for an exact match with host */
-  uint32_t hash = MixHash32(grpc_slice_hash(host), grpc_slice_hash(path));
-  for (size_t i = 0; i <= registered_method_max_probes_; i++) {
-    ChannelRegisteredMethod* rm =
-        &(*registered_methods_)[(hash + i) % registered_methods_->size()];
-    if (rm->server_registered_method == nullptr) break;
-    if (!rm->has_host) continue;
-    if (rm->host != host) continue;
-    if (rm->method != path) continue;
-    return rm;
-  }
+  ChannelRegisteredMethod* rm = probe(grpc_slice_hash(host), true);
+  if (rm != nullptr) return rm;
   /* check for a wildcard method definition (no host set) */
-  hash = MixHash32(0, grpc_slice_hash(path));
-  for (size_t i = 0; i <= registered_method_max_probes_; i++) {
-    ChannelRegisteredMethod* rm =
-        &(*registered_methods_)[(hash + i) % registered_methods_->size()];
-    if (rm->server_registered_method == nullptr) break;
-    if (rm->has_host) continue;
-    if (rm->method != path) continue;
-    return rm;
-  }
-  return nullptr;
+  return probe(0, false);
 }
 
 void Server::ChannelData::AcceptStream(void* arg, grpc_transport* /*transport*/,
@@ -1483,6 +1669,17 @@ void grpc_server_shutdown_and_notify(grpc_server* server,
   grpc_core::Server::FromC(server)->ShutdownAndNotify(cq, tag);
 }
 
+void grpc_server_drain_progress(grpc_server* server,
+                                size_t* channels_at_shutdown,
+                                size_t* channels_remaining) {
+  GRPC_API_TRACE(
+      "grpc_server_drain_progress(server=%p, channels_at_shutdown=%p, "
+      "channels_remaining=%p)",
+      3, (server, channels_at_shutdown, channels_remaining));
+  grpc_core::Server::FromC(server)->GetShutdownDrainProgress(
+      channels_at_shutdown, channels_remaining);
+}
+
 void grpc_server_cancel_all_calls(grpc_server* server) {
   grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
   grpc_core::ExecCtx exec_ctx;
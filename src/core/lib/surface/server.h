@@ -199,6 +199,21 @@ class Server : public InternallyRefCounted<Server>,
 
   void SendGoaways() ABSL_LOCKS_EXCLUDED(mu_global_, mu_call_);
 
+  // Reports graceful-drain progress after ShutdownAndNotify(): the number of
+  // connections that were open when shutdown began, and the number that are
+  // still draining. Both are zero before shutdown is called.
+  void GetShutdownDrainProgress(size_t* channels_at_shutdown,
+                                size_t* channels_remaining)
+      ABSL_LOCKS_EXCLUDED(mu_global_);
+
+  // Spreads the starting completion queue of every established connection
+  // evenly across the server's queues. A connection's starting queue is fixed
+  // at accept time, so a set of long-lived connections accepted before later
+  // queues were busy can leave the call load skewed toward a few worker
+  // threads; calling this re-homes where each connection's new incoming calls
+  // are published. In-flight calls are unaffected.
+  void RebalanceConnectionCqAssignments() ABSL_LOCKS_EXCLUDED(mu_global_);
+
  private:
   struct RequestedCall;
 
@@ -228,7 +243,10 @@ class Server : public InternallyRefCounted<Server>,
 
     RefCountedPtr<Server> server() const { return server_; }
     Channel* channel() const { return channel_.get(); }
-    size_t cq_idx() const { return cq_idx_; }
+    size_t cq_idx() const { return cq_idx_.load(std::memory_order_relaxed); }
+    void set_cq_idx(size_t cq_idx) {
+      cq_idx_.store(cq_idx, std::memory_order_relaxed);
+    }
 
     ChannelRegisteredMethod* GetRegisteredMethod(const grpc_slice& host,
                                                  const grpc_slice& path);
@@ -251,15 +269,10 @@ class Server : public InternallyRefCounted<Server>,
     RefCountedPtr<Server> server_;
     RefCountedPtr<Channel> channel_;
     // The index into Server::cqs_ of the CQ used as a starting point for
-    // where to publish new incoming calls.
-    size_t cq_idx_;
+    // where to publish new incoming calls. Read on the call path and updated
+    // by RebalanceConnectionCqAssignments(), hence atomic.
+    std::atomic<size_t> cq_idx_{0};
     absl::optional<std::list<ChannelData*>::iterator> list_position_;
-    // A hash-table of the methods and hosts of the registered methods.
-    // TODO(vjpai): Convert this to an STL map type as opposed to a direct
-    // bucket implementation. (Consider performance impact, hash function to
-    // use, etc.)
-    std::unique_ptr<std::vector<ChannelRegisteredMethod>> registered_methods_;
-    uint32_t registered_method_max_probes_;
     grpc_closure finish_destroy_channel_closure_;
     intptr_t channelz_socket_uuid_;
   };
@@ -395,6 +408,10 @@ class Server : public InternallyRefCounted<Server>,
 
   std::vector<RefCountedPtr<Channel>> GetChannelsLocked() const;
 
+  // Builds registered_method_table_; called from Start() once the method set
+  // is final.
+  void BuildRegisteredMethodRoutingTable();
+
   // Take a shutdown ref for a request (increment by 2) and return if shutdown
   // has not been called.
   bool ShutdownRefOnRequest() {
@@ -465,6 +482,14 @@ class Server : public InternallyRefCounted<Server>,
 
   std::vector<std::unique_ptr<RegisteredMethod>> registered_methods_;
 
+  // Collision-free routing table over the registered methods, built in
+  // Start() once the method set is frozen and shared by every channel: the
+  // table size (a power of two) and hash seed are chosen so that each entry
+  // lands in a distinct slot, making call routing a single probe per lookup.
+  // Empty if no methods are registered.
+  std::vector<ChannelRegisteredMethod> registered_method_table_;
+  uint32_t registered_method_seed_ = 0;
+
   // Request matcher for unregistered methods.
   std::unique_ptr<RequestMatcherInterface> unregistered_request_matcher_;
 
@@ -480,6 +505,9 @@ class Server : public InternallyRefCounted<Server>,
   std::unique_ptr<Notification> requests_complete_ ABSL_GUARDED_BY(mu_global_);
 
   std::list<ChannelData*> channels_;
+  // Number of connections open when ShutdownAndNotify() began its drain;
+  // compared against channels_.size() to report drain progress.
+  size_t channels_at_shutdown_ ABSL_GUARDED_BY(mu_global_) = 0;
 
   std::list<Listener> listeners_;
   size_t listeners_destroyed_ = 0;
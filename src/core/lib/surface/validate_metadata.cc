@@ -30,11 +30,115 @@
 #include "src/core/lib/gprpp/memory.h"
 #include "src/core/lib/iomgr/error.h"
 
+#if defined(__x86_64__) || defined(_M_AMD64) || defined(_M_X64)
+#define GRPC_VALIDATE_METADATA_SSE2 1
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define GRPC_VALIDATE_METADATA_NEON 1
+#include <arm_neon.h>
+#endif
+
+#ifdef GRPC_VALIDATE_METADATA_SSE2
+
+/* All-lanes unsigned range test: 0xff where lo <= x <= hi. */
+static __m128i bytes_in_range(__m128i x, uint8_t lo, uint8_t hi) {
+  return _mm_and_si128(
+      _mm_cmpeq_epi8(_mm_max_epu8(x, _mm_set1_epi8(static_cast<char>(lo))), x),
+      _mm_cmpeq_epi8(_mm_min_epu8(x, _mm_set1_epi8(static_cast<char>(hi))), x));
+}
+
+/* Advances p past 16-byte chunks that contain only legal header-key bytes
+   ([a-z0-9-_.]); the scalar loop below locates the exact offender in the
+   remainder. */
+static const uint8_t* scan_legal_key_bytes(const uint8_t* p, const uint8_t* e) {
+  while (e - p >= 16) {
+    const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    __m128i legal = bytes_in_range(x, 'a', 'z');
+    legal = _mm_or_si128(legal, bytes_in_range(x, '0', '9'));
+    legal = _mm_or_si128(legal, _mm_cmpeq_epi8(x, _mm_set1_epi8('-')));
+    legal = _mm_or_si128(legal, _mm_cmpeq_epi8(x, _mm_set1_epi8('_')));
+    legal = _mm_or_si128(legal, _mm_cmpeq_epi8(x, _mm_set1_epi8('.')));
+    if (_mm_movemask_epi8(legal) != 0xffff) break;
+    p += 16;
+  }
+  return p;
+}
+
+/* As above for non-binary header values (printable ASCII, 32..126). */
+static const uint8_t* scan_legal_value_bytes(const uint8_t* p,
+                                             const uint8_t* e) {
+  while (e - p >= 16) {
+    const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    if (_mm_movemask_epi8(bytes_in_range(x, 32, 126)) != 0xffff) break;
+    p += 16;
+  }
+  return p;
+}
+
+#endif /* GRPC_VALIDATE_METADATA_SSE2 */
+
+#ifdef GRPC_VALIDATE_METADATA_NEON
+
+/* Advances p past 16-byte chunks that contain only legal header-key bytes
+   ([a-z0-9-_.]); the scalar loop below locates the exact offender in the
+   remainder. */
+static const uint8_t* scan_legal_key_bytes(const uint8_t* p, const uint8_t* e) {
+  while (e - p >= 16) {
+    const uint8x16_t x = vld1q_u8(p);
+    uint8x16_t legal = vandq_u8(vcgeq_u8(x, vdupq_n_u8('a')),
+                                vcleq_u8(x, vdupq_n_u8('z')));
+    legal = vorrq_u8(legal, vandq_u8(vcgeq_u8(x, vdupq_n_u8('0')),
+                                     vcleq_u8(x, vdupq_n_u8('9'))));
+    legal = vorrq_u8(legal, vceqq_u8(x, vdupq_n_u8('-')));
+    legal = vorrq_u8(legal, vceqq_u8(x, vdupq_n_u8('_')));
+    legal = vorrq_u8(legal, vceqq_u8(x, vdupq_n_u8('.')));
+    if (vminvq_u8(legal) != 0xff) break;
+    p += 16;
+  }
+  return p;
+}
+
+/* As above for non-binary header values (printable ASCII, 32..126). */
+static const uint8_t* scan_legal_value_bytes(const uint8_t* p,
+                                             const uint8_t* e) {
+  while (e - p >= 16) {
+    const uint8x16_t x = vld1q_u8(p);
+    const uint8x16_t legal = vandq_u8(vcgeq_u8(x, vdupq_n_u8(32)),
+                                      vcleq_u8(x, vdupq_n_u8(126)));
+    if (vminvq_u8(legal) != 0xff) break;
+    p += 16;
+  }
+  return p;
+}
+
+#endif /* GRPC_VALIDATE_METADATA_NEON */
+
+#if !defined(GRPC_VALIDATE_METADATA_SSE2) && !defined(GRPC_VALIDATE_METADATA_NEON)
+
+static const uint8_t* scan_legal_key_bytes(const uint8_t* p,
+                                           const uint8_t* /*e*/) {
+  return p;
+}
+
+static const uint8_t* scan_legal_value_bytes(const uint8_t* p,
+                                             const uint8_t* /*e*/) {
+  return p;
+}
+
+#endif
+
+typedef const uint8_t* (*legal_byte_scanner)(const uint8_t* p,
+                                             const uint8_t* e);
+
 static grpc_error_handle conforms_to(const grpc_slice& slice,
                                      const grpc_core::BitSet<256>& legal_bits,
-                                     const char* err_desc) {
+                                     const char* err_desc,
+                                     legal_byte_scanner scanner) {
   const uint8_t* p = GRPC_SLICE_START_PTR(slice);
   const uint8_t* e = GRPC_SLICE_END_PTR(slice);
+  /* Vector fast path: skip whole chunks of legal bytes, then fall through to
+     the bitset probe for the tail (and to pinpoint any offending byte). */
+  p = scanner(p, e);
   for (; p != e; p++) {
     if (!legal_bits.is_set(*p)) {
       size_t len;
@@ -84,7 +188,8 @@ grpc_error_handle grpc_validate_header_key_is_legal(const grpc_slice& slice) {
     return GRPC_ERROR_CREATE_FROM_STATIC_STRING(
         "Metadata keys cannot start with :");
   }
-  return conforms_to(slice, g_legal_header_key_bits, "Illegal header key");
+  return conforms_to(slice, g_legal_header_key_bits, "Illegal header key",
+                     scan_legal_key_bytes);
 }
 
 int grpc_header_key_is_legal(grpc_slice slice) {
@@ -106,7 +211,7 @@ constexpr LegalHeaderNonBinValueBits g_legal_header_non_bin_value_bits;
 grpc_error_handle grpc_validate_header_nonbin_value_is_legal(
     const grpc_slice& slice) {
   return conforms_to(slice, g_legal_header_non_bin_value_bits,
-                     "Illegal header value");
+                     "Illegal header value", scan_legal_value_bytes);
 }
 
 int grpc_header_nonbin_value_is_legal(grpc_slice slice) {
@@ -29,6 +29,13 @@ grpc_core::TraceFlag grpc_bdp_estimator_trace(false, "bdp_estimator");
 
 namespace grpc_core {
 
+namespace {
+// Ceiling for the exponential probe backoff once the estimate is stable.
+// Idle transports stop probing entirely, so this bounds the wakeup rate
+// only on connections that keep carrying traffic.
+const Duration kMaxInterPingDelay = Duration::Seconds(60);
+}  // namespace
+
 BdpEstimator::BdpEstimator(const char* name)
     : ping_state_(PingState::UNSCHEDULED),
       accumulator_(0),
@@ -63,12 +70,17 @@ Timestamp BdpEstimator::CompletePing() {
     }
     inter_ping_delay_ /= 2;  // if the ping estimate changes,
                              // exponentially get faster at probing
-  } else if (inter_ping_delay_ < Duration::Seconds(10)) {
+  } else if (inter_ping_delay_ < kMaxInterPingDelay) {
     stable_estimate_count_++;
     if (stable_estimate_count_ >= 2) {
-      // if the ping estimate is steady, slowly ramp down the probe time
-      inter_ping_delay_ += Duration::Milliseconds(
-          100 + static_cast<int>(rand() * 100.0 / RAND_MAX));
+      // if the ping estimate is steady, back off probing exponentially
+      // (jittered so that probes across many connections do not
+      // synchronize)
+      inter_ping_delay_ = std::min(
+          kMaxInterPingDelay,
+          inter_ping_delay_ * 2 +
+              Duration::Milliseconds(
+                  static_cast<int>(rand() * 100.0 / RAND_MAX)));
     }
   }
   if (start_inter_ping_delay != inter_ping_delay_) {
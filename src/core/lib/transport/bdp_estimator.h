@@ -73,6 +73,19 @@ class BdpEstimator {
   // Completes a previously started ping, returns when to schedule the next one
   Timestamp CompletePing();
 
+  // Call when traffic resumes after the transport quiesced probing on an
+  // idle connection: resets the probe cadence so the (possibly changed)
+  // path is re-measured quickly.
+  void ResumeProbing() {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_bdp_estimator_trace)) {
+      gpr_log(GPR_INFO, "bdp[%s]:resume est=%" PRId64, name_, estimate_);
+    }
+    inter_ping_delay_ = Duration::Milliseconds(100);
+    stable_estimate_count_ = 0;
+  }
+
+  Duration inter_ping_delay() const { return inter_ping_delay_; }
+
   int64_t accumulator() { return accumulator_; }
 
  private:
@@ -105,8 +105,9 @@ ConnectivityStateTracker::~ConnectivityStateTracker() {
   grpc_connectivity_state current_state =
       state_.load(std::memory_order_relaxed);
   if (current_state == GRPC_CHANNEL_SHUTDOWN) return;
+  const bool tracing = GRPC_TRACE_FLAG_ENABLED(grpc_connectivity_state_trace);
   for (const auto& p : watchers_) {
-    if (GRPC_TRACE_FLAG_ENABLED(grpc_connectivity_state_trace)) {
+    if (tracing) {
       gpr_log(GPR_INFO,
               "ConnectivityStateTracker %s[%p]: notifying watcher %p: %s -> %s",
               name_, this, p.first, ConnectivityStateName(current_state),
@@ -163,8 +164,9 @@ void ConnectivityStateTracker::SetState(grpc_connectivity_state state,
   }
   state_.store(state, std::memory_order_relaxed);
   status_ = status;
+  const bool tracing = GRPC_TRACE_FLAG_ENABLED(grpc_connectivity_state_trace);
   for (const auto& p : watchers_) {
-    if (GRPC_TRACE_FLAG_ENABLED(grpc_connectivity_state_trace)) {
+    if (tracing) {
       gpr_log(GPR_INFO,
               "ConnectivityStateTracker %s[%p]: notifying watcher %p: %s -> %s",
               name_, this, p.first, ConnectivityStateName(current_state),
@@ -22,10 +22,10 @@
 #include <grpc/support/port_platform.h>
 
 #include <atomic>
-#include <map>
 #include <memory>
 #include <utility>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/status.h"
 
 #include <grpc/impl/codegen/connectivity_state.h>
@@ -132,10 +132,11 @@ class ConnectivityStateTracker {
   const char* name_;
   std::atomic<grpc_connectivity_state> state_{grpc_connectivity_state()};
   absl::Status status_;
-  // TODO(roth): Once we can use C++-14 heterogeneous lookups, this can
-  // be a set instead of a map.
-  std::map<ConnectivityStateWatcherInterface*,
-           OrphanablePtr<ConnectivityStateWatcherInterface>>
+  // Flat storage keeps a state broadcast to a large watcher set (e.g. many
+  // streams watching one subchannel) a cache-friendly linear sweep rather
+  // than a pointer chase, and makes add/remove O(1).
+  absl::flat_hash_map<ConnectivityStateWatcherInterface*,
+                      OrphanablePtr<ConnectivityStateWatcherInterface>>
       watchers_;
 };
 
@@ -25,12 +25,21 @@
 #include <vector>
 
 #include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
 
 #include <grpc/support/string_util.h>
 
 #include "src/core/lib/gprpp/status_helper.h"
 #include "src/core/lib/transport/status_conversion.h"
 
+static bool error_has_payloads(const grpc_error_handle& error) {
+  bool has_payloads = false;
+  error.ForEachPayload(
+      [&has_payloads](absl::string_view /*type_url*/,
+                      const absl::Cord& /*payload*/) { has_payloads = true; });
+  return has_payloads;
+}
+
 static grpc_error_handle recursively_find_error_with_field(
     grpc_error_handle error, grpc_error_ints which) {
   intptr_t unused;
@@ -130,6 +139,18 @@ void grpc_error_get_status(grpc_error_handle error,
 }
 
 absl::Status grpc_error_to_absl_status(grpc_error_handle error) {
+  if (error.ok()) return error;
+  // Move-through: an error with no payloads is already exactly the status
+  // this conversion would compute -- the code maps through unchanged and the
+  // message doubles as the description -- so return it as-is instead of
+  // re-encoding. Cancelled and ResourceExhausted are excluded because
+  // grpc_error_get_str substitutes fixed messages for them.
+  if (!error.message().empty() &&
+      error.code() != absl::StatusCode::kCancelled &&
+      error.code() != absl::StatusCode::kResourceExhausted &&
+      !error_has_payloads(error)) {
+    return error;
+  }
   grpc_status_code status;
   // TODO(yashykt): This should be updated once we decide on how to use the
   // absl::Status payload to capture all the contents of grpc_error.
@@ -137,7 +158,10 @@ absl::Status grpc_error_to_absl_status(grpc_error_handle error) {
   grpc_error_get_status(error, grpc_core::Timestamp::InfFuture(), &status,
                         &message, nullptr /* http_error */,
                         nullptr /* error_string */);
-  return absl::Status(static_cast<absl::StatusCode>(status), message);
+  // The result carries no payloads, so common pairs like "Deadline Exceeded"
+  // are served from the intern table rather than allocated per conversion.
+  return grpc_core::StatusIntern(static_cast<absl::StatusCode>(status),
+                                 message);
 }
 
 grpc_error_handle absl_status_to_grpc_error(absl::Status status) {
@@ -145,6 +169,16 @@ grpc_error_handle absl_status_to_grpc_error(absl::Status status) {
   if (status.ok()) {
     return absl::OkStatus();
   }
+  // Move-through: a status that has round-tripped through this conversion
+  // before already carries its own code as the grpc-status payload;
+  // re-wrapping it would allocate a new representation with the same
+  // observable code and message.
+  absl::optional<intptr_t> rpc_status = grpc_core::StatusGetInt(
+      status, grpc_core::StatusIntProperty::kRpcStatus);
+  if (rpc_status.has_value() &&
+      *rpc_status == static_cast<intptr_t>(status.code())) {
+    return status;
+  }
   return grpc_error_set_int(
       GRPC_ERROR_CREATE_FROM_STRING_VIEW(status.message()),
       GRPC_ERROR_INT_GRPC_STATUS, static_cast<grpc_status_code>(status.code()));
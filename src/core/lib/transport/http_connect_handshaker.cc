@@ -213,7 +213,8 @@ void HttpConnectHandshaker::OnReadDone(void* arg, grpc_error_handle error) {
         handshaker->HandshakeFailedLocked(error);
         goto done;
       }
-      if (handshaker->http_parser_.state == GRPC_HTTP_BODY) {
+      if (handshaker->http_parser_.state == GRPC_HTTP_BODY ||
+          handshaker->http_parser_.state == GRPC_HTTP_END) {
         // Remove the data we've already read from the read buffer,
         // leaving only the leftover bytes (if any).
         grpc_slice_buffer tmp_buffer;
@@ -245,7 +246,8 @@ void HttpConnectHandshaker::OnReadDone(void* arg, grpc_error_handle error) {
   // need to fix the HTTP parser to understand when the body is
   // complete (e.g., handling chunked transfer encoding or looking
   // at the Content-Length: header).
-  if (handshaker->http_parser_.state != GRPC_HTTP_BODY) {
+  if (handshaker->http_parser_.state != GRPC_HTTP_BODY &&
+      handshaker->http_parser_.state != GRPC_HTTP_END) {
     grpc_slice_buffer_reset_and_unref(handshaker->args_->read_buffer);
     grpc_endpoint_read(
         handshaker->args_->endpoint, handshaker->args_->read_buffer,
@@ -38,6 +38,13 @@ void UnknownMap::Append(absl::string_view key, Slice value) {
   unknown_.EmplaceBack(Slice::FromCopiedString(key), value.Ref());
 }
 
+void UnknownMap::TakeFrom(UnknownMap* other) {
+  for (auto it = other->unknown_.begin(); it != other->unknown_.end(); ++it) {
+    unknown_.EmplaceBack(std::move((*it).first), std::move((*it).second));
+  }
+  other->unknown_.Clear();
+}
+
 void UnknownMap::Remove(absl::string_view key) {
   unknown_.SetEnd(std::remove_if(unknown_.begin(), unknown_.end(),
                                  [key](const std::pair<Slice, Slice>& p) {
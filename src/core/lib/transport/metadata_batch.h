@@ -302,6 +302,15 @@ struct GrpcPreviousRpcAttemptsMetadata
   static absl::string_view key() { return "grpc-previous-rpc-attempts"; }
 };
 
+// grpc-dictionary metadata trait: id of the pre-shared compression dictionary
+// (see RegisterCompressionDictionary) the sender's compressed messages are
+// primed with; 0 (the invalid value) means no dictionary.
+struct GrpcCompressionDictionaryMetadata
+    : public SimpleIntBasedMetadata<uint32_t, 0> {
+  static constexpr bool kRepeatable = false;
+  static absl::string_view key() { return "grpc-dictionary"; }
+};
+
 // grpc-retry-pushback-ms metadata trait.
 struct GrpcRetryPushbackMsMetadata {
   static constexpr bool kRepeatable = false;
@@ -860,6 +869,30 @@ struct ForEachWrapper {
   }
 };
 
+// Encoder that fans each visited field out to two encoders, so that two
+// consumers of a batch (e.g. wire encoding and accounting) share a single
+// traversal of the underlying table.
+template <typename A, typename B>
+class TeeEncoder {
+ public:
+  TeeEncoder(A* a, B* b) : a_(a), b_(b) {}
+
+  void Encode(const Slice& key, const Slice& value) {
+    a_->Encode(key, value);
+    b_->Encode(key, value);
+  }
+
+  template <typename Which, typename Value>
+  void Encode(Which which, const Value& value) {
+    a_->Encode(which, value);
+    b_->Encode(which, value);
+  }
+
+ private:
+  A* const a_;
+  B* const b_;
+};
+
 // Callable for the ForEach in Log()
 struct LogWrapper {
   LogFn log_fn;
@@ -906,6 +939,11 @@ class UnknownMap {
   using BackingType = ChunkedVector<std::pair<Slice, Slice>, 10>;
 
   void Append(absl::string_view key, Slice value);
+  // Moves all entries of *other into this map without copying metadata
+  // bytes: the key and value slices change hands by reference transfer and
+  // only the per-entry bookkeeping is re-chunked into this map's arena.
+  // *other is left empty.
+  void TakeFrom(UnknownMap* other);
   void Remove(absl::string_view key);
   absl::optional<absl::string_view> GetStringValue(absl::string_view key,
                                                    std::string* backing) const;
@@ -1060,6 +1098,7 @@ class MetadataMap {
   //    void Encode(string_view key, Slice value);
   template <typename Encoder>
   void Encode(Encoder* encoder) const {
+    ++traversal_count_;
     table_.template ForEachIn<metadata_detail::EncodeWrapper<Encoder>,
                               Value<Traits>...>(
         metadata_detail::EncodeWrapper<Encoder>{encoder});
@@ -1068,9 +1107,19 @@ class MetadataMap {
     }
   }
 
+  // Fused form of Encode: visits each field exactly once and hands it to
+  // \a a then \a b, so that paths needing two views of the batch do not pay
+  // one traversal per consumer.
+  template <typename EncoderA, typename EncoderB>
+  void Encode(EncoderA* a, EncoderB* b) const {
+    metadata_detail::TeeEncoder<EncoderA, EncoderB> tee(a, b);
+    Encode(&tee);
+  }
+
   // Like Encode, but also visit the non-encodable fields.
   template <typename Encoder>
   void ForEach(Encoder* encoder) const {
+    ++traversal_count_;
     table_.ForEach(metadata_detail::ForEachWrapper<Encoder>{encoder});
     for (const auto& unk : unknown_) {
       encoder->Encode(unk.first, unk.second);
@@ -1080,6 +1129,7 @@ class MetadataMap {
   // Similar to Encode, but targeted at logging: for each metadatum,
   // call f(key, value) as absl::string_views.
   void Log(metadata_detail::LogFn log_fn) const {
+    ++traversal_count_;
     table_.ForEach(metadata_detail::LogWrapper{log_fn});
     for (const auto& unk : unknown_) {
       log_fn(unk.first.as_string_view(), unk.second.as_string_view());
@@ -1109,6 +1159,8 @@ class MetadataMap {
   // Causes a compilation error if Which is not an element of Traits.
   template <typename Which>
   typename metadata_detail::Value<Which>::StorageType* get_pointer(Which) {
+    // The caller may mutate the value through the returned pointer.
+    InvalidateTransportSizeCache();
     if (auto* p = table_.template get<Value<Which>>()) return &p->value;
     return nullptr;
   }
@@ -1119,6 +1171,7 @@ class MetadataMap {
   template <typename Which>
   typename metadata_detail::Value<Which>::StorageType* GetOrCreatePointer(
       Which) {
+    InvalidateTransportSizeCache();
     return &table_.template get_or_create<Value<Which>>()->value;
   }
 
@@ -1136,6 +1189,7 @@ class MetadataMap {
   template <typename Which, typename... Args>
   absl::enable_if_t<Which::kRepeatable == false, void> Set(Which,
                                                            Args&&... args) {
+    InvalidateTransportSizeCache();
     table_.template set<Value<Which>>(std::forward<Args>(args)...);
   }
   template <typename Which, typename... Args>
@@ -1147,11 +1201,13 @@ class MetadataMap {
   // Remove a specific piece of known metadata.
   template <typename Which>
   void Remove(Which) {
+    InvalidateTransportSizeCache();
     table_.template clear<Value<Which>>();
   }
 
   // Remove some metadata by name
   void Remove(absl::string_view key) {
+    InvalidateTransportSizeCache();
     metadata_detail::RemoveHelper<Derived> helper(static_cast<Derived*>(this));
     metadata_detail::NameLookup<void, Traits...>::Lookup(key, &helper);
   }
@@ -1211,12 +1267,14 @@ class MetadataMap {
 
   // Set a value from a parsed metadata object.
   void Set(const ParsedMetadata<Derived>& m) {
+    InvalidateTransportSizeCache();
     m.SetOnContainer(static_cast<Derived*>(this));
   }
 
   // Append a key/value pair - takes ownership of value
   void Append(absl::string_view key, Slice value,
               MetadataParseErrorFn on_error) {
+    InvalidateTransportSizeCache();
     metadata_detail::AppendHelper<Derived> helper(static_cast<Derived*>(this),
                                                   value.TakeOwned(), on_error);
     metadata_detail::NameLookup<void, Traits...>::Lookup(key, &helper);
@@ -1225,9 +1283,21 @@ class MetadataMap {
   void Clear();
   size_t TransportSize() const;
   Derived Copy() const;
+  // Replaces the contents of this batch with those of *other -- which may
+  // live on a different arena -- without copying metadata bytes: typed
+  // values are moved and unknown key/value slices change hands by
+  // reference transfer.  Only the unknown-entry bookkeeping is re-chunked
+  // into this batch's arena, so the result holds no references into the
+  // source arena.  *other is left empty.
+  void TakeFrom(MetadataMap* other);
   bool empty() const { return table_.empty() && unknown_.empty(); }
   size_t count() const { return table_.count() + unknown_.size(); }
 
+  // Number of complete traversals (Encode/ForEach/Log) made over this batch.
+  // Lets hot paths verify they walk the underlying table exactly once per
+  // send.
+  size_t TraversalCount() const { return traversal_count_; }
+
  private:
   friend class metadata_detail::AppendHelper<Derived>;
   friend class metadata_detail::GetStringValueHelper<Derived>;
@@ -1238,9 +1308,17 @@ class MetadataMap {
   template <typename Which>
   using Value = metadata_detail::Value<Which>;
 
+  void InvalidateTransportSizeCache() { transport_size_cache_valid_ = false; }
+
   // Table of known metadata types.
   PackedTable<Value<Traits>...> table_;
   metadata_detail::UnknownMap unknown_;
+  // TransportSize() is a full traversal and the send path (e.g. retry
+  // buffering accounting) may ask for it repeatedly without mutating the
+  // batch, so the last answer is remembered until the next mutation.
+  mutable uint32_t cached_transport_size_ = 0;
+  mutable bool transport_size_cache_valid_ = false;
+  mutable uint32_t traversal_count_ = 0;
 };
 
 // Ok/not-ok check for metadata maps that contain GrpcStatusMetadata, so that
@@ -1256,7 +1334,11 @@ MetadataMap<Derived, Traits...>::MetadataMap(Arena* arena) : unknown_(arena) {}
 
 template <typename Derived, typename... Traits>
 MetadataMap<Derived, Traits...>::MetadataMap(MetadataMap&& other) noexcept
-    : table_(std::move(other.table_)), unknown_(std::move(other.unknown_)) {}
+    : table_(std::move(other.table_)),
+      unknown_(std::move(other.unknown_)),
+      cached_transport_size_(other.cached_transport_size_),
+      transport_size_cache_valid_(other.transport_size_cache_valid_),
+      traversal_count_(other.traversal_count_) {}
 
 // We never create MetadataMap directly, instead we create Derived, but we
 // want to be able to move it without redeclaring this.
@@ -1266,6 +1348,9 @@ Derived& MetadataMap<Derived, Traits...>::operator=(
     MetadataMap&& other) noexcept {
   table_ = std::move(other.table_);
   unknown_ = std::move(other.unknown_);
+  cached_transport_size_ = other.cached_transport_size_;
+  transport_size_cache_valid_ = other.transport_size_cache_valid_;
+  traversal_count_ = other.traversal_count_;
   return static_cast<Derived&>(*this);
 }
 
@@ -1274,15 +1359,20 @@ MetadataMap<Derived, Traits...>::~MetadataMap() = default;
 
 template <typename Derived, typename... Traits>
 void MetadataMap<Derived, Traits...>::Clear() {
+  InvalidateTransportSizeCache();
   table_.ClearAll();
   unknown_.Clear();
 }
 
 template <typename Derived, typename... Traits>
 size_t MetadataMap<Derived, Traits...>::TransportSize() const {
-  metadata_detail::TransportSizeEncoder enc;
-  Encode(&enc);
-  return enc.size();
+  if (!transport_size_cache_valid_) {
+    metadata_detail::TransportSizeEncoder enc;
+    Encode(&enc);
+    cached_transport_size_ = enc.size();
+    transport_size_cache_valid_ = true;
+  }
+  return cached_transport_size_;
 }
 
 template <typename Derived, typename... Traits>
@@ -1293,6 +1383,15 @@ Derived MetadataMap<Derived, Traits...>::Copy() const {
   return out;
 }
 
+template <typename Derived, typename... Traits>
+void MetadataMap<Derived, Traits...>::TakeFrom(MetadataMap* other) {
+  InvalidateTransportSizeCache();
+  table_ = std::move(other->table_);
+  unknown_.Clear();
+  unknown_.TakeFrom(&other->unknown_);
+  other->Clear();
+}
+
 }  // namespace grpc_core
 
 struct grpc_metadata_batch;
@@ -1306,7 +1405,8 @@ using grpc_metadata_batch_base = grpc_core::MetadataMap<
     // Non-colon prefixed headers begin here
     grpc_core::ContentTypeMetadata, grpc_core::TeMetadata,
     grpc_core::GrpcEncodingMetadata, grpc_core::GrpcInternalEncodingRequest,
-    grpc_core::GrpcAcceptEncodingMetadata, grpc_core::GrpcStatusMetadata,
+    grpc_core::GrpcAcceptEncodingMetadata,
+    grpc_core::GrpcCompressionDictionaryMetadata, grpc_core::GrpcStatusMetadata,
     grpc_core::GrpcTimeoutMetadata, grpc_core::GrpcPreviousRpcAttemptsMetadata,
     grpc_core::GrpcRetryPushbackMsMetadata, grpc_core::UserAgentMetadata,
     grpc_core::GrpcMessageMetadata, grpc_core::HostMetadata,
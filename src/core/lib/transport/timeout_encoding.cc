@@ -20,8 +20,6 @@
 
 #include "src/core/lib/transport/timeout_encoding.h"
 
-#include "absl/base/attributes.h"
-
 #include <grpc/support/log.h>
 #include <grpc/support/time.h>
 
@@ -42,6 +40,67 @@ bool IsAllSpace(const uint8_t* p, const uint8_t* end) {
   return p == end;
 }
 
+// Trailing output for each Timeout::Unit, in enum order: the unit letter,
+// preceded by the zeros implied by the Ten/Hundred variants.
+constexpr const char* kUnitSuffix[] = {"n", "m",  "0m",  "00m", "S",  "0S",
+                                       "00S", "M", "0M", "00M", "H"};
+constexpr size_t kNumUnits = sizeof(kUnitSuffix) / sizeof(kUnitSuffix[0]);
+
+// Writes the wire form of a timeout into buf (which must hold at least 10
+// bytes) and returns the number of bytes written. Constexpr so that the
+// encode cache below can be built entirely at compile time.
+constexpr size_t EncodeTimeoutTo(uint16_t value, size_t unit_index,
+                                 char* buf) {
+  size_t len = 0;
+  uint32_t div = 10000;
+  while (div > 1 && value < div) div /= 10;
+  uint32_t n = value;
+  for (; div > 0; div /= 10) {
+    buf[len++] = static_cast<char>('0' + n / div);
+    n %= div;
+  }
+  for (const char* s = kUnitSuffix[unit_index]; *s != 0; ++s) {
+    buf[len++] = *s;
+  }
+  return len;
+}
+
+// Every quantized timeout value below 1000 (i.e. everything Timeout's
+// rounding produces except multi-thousand hour counts), pre-encoded for
+// each unit so that Encode() on the send path is a table lookup yielding a
+// refcount-free static slice instead of digit arithmetic plus a copy.
+constexpr uint16_t kEncodeCacheLimit = 1000;
+
+struct EncodeCache {
+  struct Entry {
+    uint8_t length;
+    char bytes[6];
+  };
+  Entry entries[kNumUnits][kEncodeCacheLimit] = {};
+  constexpr EncodeCache() {
+    for (size_t unit = 0; unit < kNumUnits; ++unit) {
+      for (uint16_t value = 0; value < kEncodeCacheLimit; ++value) {
+        entries[unit][value].length = static_cast<uint8_t>(
+            EncodeTimeoutTo(value, unit, entries[unit][value].bytes));
+      }
+    }
+  }
+};
+
+constexpr EncodeCache g_encode_cache;
+
+// 0..9 for ASCII digits, 0xff for every other byte, so the parse loop below
+// classifies and converts each character with a single table load.
+struct DigitValueTable {
+  uint8_t value[256];
+  constexpr DigitValueTable() : value{} {
+    for (int i = 0; i < 256; ++i) value[i] = 0xff;
+    for (int i = '0'; i <= '9'; ++i) value[i] = static_cast<uint8_t>(i - '0');
+  }
+};
+
+constexpr DigitValueTable g_digit_table;
+
 }  // namespace
 
 Timeout Timeout::FromDuration(Duration duration) {
@@ -89,77 +148,15 @@ Duration Timeout::AsDuration() const {
 }
 
 Slice Timeout::Encode() const {
-  char buf[10];
-  char* p = buf;
-  uint16_t n = value_;
-  int digits;
-  if (n >= 10000) {
-    digits = 5;
-  } else if (n >= 1000) {
-    digits = 4;
-  } else if (n >= 100) {
-    digits = 3;
-  } else if (n >= 10) {
-    digits = 2;
-  } else {
-    digits = 1;
-  }
-  switch (digits) {
-    case 5:
-      *p++ = '0' + n / 10000;
-      n %= 10000;
-      ABSL_FALLTHROUGH_INTENDED;
-    case 4:
-      *p++ = '0' + n / 1000;
-      n %= 1000;
-      ABSL_FALLTHROUGH_INTENDED;
-    case 3:
-      *p++ = '0' + n / 100;
-      n %= 100;
-      ABSL_FALLTHROUGH_INTENDED;
-    case 2:
-      *p++ = '0' + n / 10;
-      n %= 10;
-      ABSL_FALLTHROUGH_INTENDED;
-    case 1:
-      *p++ = '0' + n;
-  }
-  switch (unit_) {
-    case Unit::kNanoseconds:
-      *p++ = 'n';
-      break;
-    case Unit::kHundredMilliseconds:
-      *p++ = '0';
-      ABSL_FALLTHROUGH_INTENDED;
-    case Unit::kTenMilliseconds:
-      *p++ = '0';
-      ABSL_FALLTHROUGH_INTENDED;
-    case Unit::kMilliseconds:
-      *p++ = 'm';
-      break;
-    case Unit::kHundredSeconds:
-      *p++ = '0';
-      ABSL_FALLTHROUGH_INTENDED;
-    case Unit::kTenSeconds:
-      *p++ = '0';
-      ABSL_FALLTHROUGH_INTENDED;
-    case Unit::kSeconds:
-      *p++ = 'S';
-      break;
-    case Unit::kHundredMinutes:
-      *p++ = '0';
-      ABSL_FALLTHROUGH_INTENDED;
-    case Unit::kTenMinutes:
-      *p++ = '0';
-      ABSL_FALLTHROUGH_INTENDED;
-    case Unit::kMinutes:
-      *p++ = 'M';
-      break;
-    case Unit::kHours:
-      *p++ = 'H';
-      break;
+  const size_t unit_index = static_cast<size_t>(unit_);
+  if (value_ < kEncodeCacheLimit) {
+    const EncodeCache::Entry& entry = g_encode_cache.entries[unit_index][value_];
+    return Slice::FromStaticBuffer(entry.bytes, entry.length);
   }
-  return Slice::FromCopiedBuffer(buf, p - buf);
+  // Only multi-thousand hour counts miss the cache.
+  char buf[10];
+  const size_t len = EncodeTimeoutTo(value_, unit_index, buf);
+  return Slice::FromCopiedBuffer(buf, len);
 }
 
 Timeout Timeout::FromMillis(int64_t millis) {
@@ -226,26 +223,25 @@ Timeout Timeout::FromHours(int64_t hours) {
 }
 
 absl::optional<Duration> ParseTimeout(const Slice& text) {
-  int32_t x = 0;
+  int64_t x = 0;
   const uint8_t* p = text.begin();
   const uint8_t* end = text.end();
-  int have_digit = 0;
+  constexpr int64_t kMaxValue = 1000 * 1000 * 1000;
   /* skip whitespace */
   for (; p != end && *p == ' '; p++) {
   }
-  /* decode numeric part */
-  for (; p != end && *p >= '0' && *p <= '9'; p++) {
-    int32_t digit = static_cast<int32_t>(*p - static_cast<uint8_t>('0'));
-    have_digit = 1;
-    /* spec allows max. 8 digits, but we allow values up to 1,000,000,000 */
-    if (x >= (100 * 1000 * 1000)) {
-      if (x != (100 * 1000 * 1000) || digit != 0) {
-        return Duration::Infinity();
-      }
-    }
-    x = x * 10 + digit;
+  /* decode numeric part: a table load classifies and converts each byte, and
+     the accumulator saturates just past the cap so overflow is a single check
+     after the loop instead of a branch per digit */
+  const uint8_t* digits_start = p;
+  for (; p != end; p++) {
+    const uint8_t digit = g_digit_table.value[*p];
+    if (digit > 9) break;
+    if (x <= kMaxValue) x = x * 10 + digit;
   }
-  if (!have_digit) return absl::nullopt;
+  if (p == digits_start) return absl::nullopt;
+  /* spec allows max. 8 digits, but we allow values up to 1,000,000,000 */
+  if (x > kMaxValue) return Duration::Infinity();
   /* skip whitespace */
   for (; p != end && *p == ' '; p++) {
   }
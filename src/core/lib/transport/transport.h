@@ -411,6 +411,17 @@ typedef struct grpc_transport_op {
   void (*set_make_promise_fn)(void* user_data, grpc_transport* transport,
                               const void* server_data) = nullptr;
   void* set_make_promise_user_data = nullptr;
+  /** set the callback to be invoked when new streams cannot be started
+      because the peer's concurrency limit has been reached;
+      this is a permanent callback, unlike the other one-shot closures.
+      If true, the callback is set to set_streams_saturated_fn (which may
+      be null to clear a previously set callback), with its user_data
+      argument set to set_streams_saturated_user_data.  The callback may
+      be invoked from within the transport's internal lock and must not
+      call back into the transport synchronously. */
+  bool set_streams_saturated = false;
+  void (*set_streams_saturated_fn)(void* user_data) = nullptr;
+  void* set_streams_saturated_user_data = nullptr;
   /** add this transport to a pollset */
   grpc_pollset* bind_pollset = nullptr;
   /** add this transport to a pollset_set */
@@ -206,32 +206,32 @@ std::string URI::PercentDecode(absl::string_view str) {
   return out;
 }
 
-absl::StatusOr<URI> URI::Parse(absl::string_view uri_text) {
-  absl::StatusOr<std::string> decoded;
+absl::StatusOr<URIView> URIView::Parse(absl::string_view uri_text) {
+  URIView result;
   absl::string_view remaining = uri_text;
   // parse scheme
   size_t offset = remaining.find(':');
   if (offset == remaining.npos || offset == 0) {
     return MakeInvalidURIStatus("scheme", uri_text, "Scheme not found.");
   }
-  std::string scheme(remaining.substr(0, offset));
-  if (scheme.find_first_not_of("ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-                               "abcdefghijklmnopqrstuvwxyz"
-                               "0123456789+-.") != std::string::npos) {
+  result.scheme_ = remaining.substr(0, offset);
+  if (result.scheme_.find_first_not_of("ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                                       "abcdefghijklmnopqrstuvwxyz"
+                                       "0123456789+-.") !=
+      absl::string_view::npos) {
     return MakeInvalidURIStatus("scheme", uri_text,
                                 "Scheme contains invalid characters.");
   }
-  if (!isalpha(scheme[0])) {
+  if (!isalpha(result.scheme_[0])) {
     return MakeInvalidURIStatus(
         "scheme", uri_text,
         "Scheme must begin with an alpha character [A-Za-z].");
   }
   remaining.remove_prefix(offset + 1);
   // parse authority
-  std::string authority;
   if (absl::ConsumePrefix(&remaining, "//")) {
     offset = remaining.find_first_of("/?#");
-    authority = PercentDecode(remaining.substr(0, offset));
+    result.authority_ = remaining.substr(0, offset);
     if (offset == remaining.npos) {
       remaining = "";
     } else {
@@ -239,10 +239,9 @@ absl::StatusOr<URI> URI::Parse(absl::string_view uri_text) {
     }
   }
   // parse path
-  std::string path;
   if (!remaining.empty()) {
     offset = remaining.find_first_of("?#");
-    path = PercentDecode(remaining.substr(0, offset));
+    result.path_ = remaining.substr(0, offset);
     if (offset == remaining.npos) {
       remaining = "";
     } else {
@@ -250,40 +249,53 @@ absl::StatusOr<URI> URI::Parse(absl::string_view uri_text) {
     }
   }
   // parse query
-  std::vector<QueryParam> query_param_pairs;
   if (absl::ConsumePrefix(&remaining, "?")) {
     offset = remaining.find('#');
-    absl::string_view tmp_query = remaining.substr(0, offset);
-    if (tmp_query.empty()) {
+    result.query_ = remaining.substr(0, offset);
+    if (result.query_.empty()) {
       return MakeInvalidURIStatus("query", uri_text, "Invalid query string.");
     }
-    if (!IsQueryOrFragmentString(tmp_query)) {
+    if (!IsQueryOrFragmentString(result.query_)) {
       return MakeInvalidURIStatus("query string", uri_text,
                                   "Query string contains invalid characters.");
     }
-    for (absl::string_view query_param : absl::StrSplit(tmp_query, '&')) {
-      const std::pair<absl::string_view, absl::string_view> possible_kv =
-          absl::StrSplit(query_param, absl::MaxSplits('=', 1));
-      if (possible_kv.first.empty()) continue;
-      query_param_pairs.push_back({PercentDecode(possible_kv.first),
-                                   PercentDecode(possible_kv.second)});
-    }
     if (offset == remaining.npos) {
       remaining = "";
     } else {
       remaining.remove_prefix(offset);
     }
   }
-  std::string fragment;
+  // parse fragment
   if (absl::ConsumePrefix(&remaining, "#")) {
     if (!IsQueryOrFragmentString(remaining)) {
       return MakeInvalidURIStatus("fragment", uri_text,
                                   "Fragment contains invalid characters.");
     }
-    fragment = PercentDecode(remaining);
+    result.fragment_ = remaining;
   }
-  return URI(std::move(scheme), std::move(authority), std::move(path),
-             std::move(query_param_pairs), std::move(fragment));
+  return result;
+}
+
+URI URIView::ToURI() const {
+  std::vector<URI::QueryParam> query_param_pairs;
+  if (!query_.empty()) {
+    for (absl::string_view query_param : absl::StrSplit(query_, '&')) {
+      const std::pair<absl::string_view, absl::string_view> possible_kv =
+          absl::StrSplit(query_param, absl::MaxSplits('=', 1));
+      if (possible_kv.first.empty()) continue;
+      query_param_pairs.push_back({URI::PercentDecode(possible_kv.first),
+                                   URI::PercentDecode(possible_kv.second)});
+    }
+  }
+  return URI(std::string(scheme_), URI::PercentDecode(authority_),
+             URI::PercentDecode(path_), std::move(query_param_pairs),
+             URI::PercentDecode(fragment_));
+}
+
+absl::StatusOr<URI> URI::Parse(absl::string_view uri_text) {
+  absl::StatusOr<URIView> view = URIView::Parse(uri_text);
+  if (!view.ok()) return view.status();
+  return view->ToURI();
 }
 
 absl::StatusOr<URI> URI::Create(std::string scheme, std::string authority,
@@ -28,6 +28,8 @@
 
 namespace grpc_core {
 
+class URIView;
+
 class URI {
  public:
   struct QueryParam {
@@ -86,6 +88,8 @@ class URI {
   std::string ToString() const;
 
  private:
+  friend class URIView;
+
   URI(std::string scheme, std::string authority, std::string path,
       std::vector<QueryParam> query_parameter_pairs, std::string fragment);
 
@@ -96,6 +100,42 @@ class URI {
   std::vector<QueryParam> query_parameter_pairs_;
   std::string fragment_;
 };
+
+// A non-owning view of a parsed URI. The component accessors return views
+// into the string passed to Parse() -- which must outlive this object --
+// and are still percent-encoded; use URI::PercentDecode() on the components
+// you actually need, or ToURI() to materialize an owning, decoded URI.
+// Useful on hot paths that parse repeatedly but only inspect a component or
+// two (e.g. dispatching on the scheme), where the owning URI's per-component
+// allocation and decoding is wasted work.
+class URIView {
+ public:
+  // Parses an rfc3986 URI string, applying the same validation as
+  // URI::Parse() but without allocating. Returns an InvalidArgumentError on
+  // failure.
+  static absl::StatusOr<URIView> Parse(absl::string_view uri_text);
+
+  URIView() = default;
+
+  absl::string_view scheme() const { return scheme_; }
+  absl::string_view authority() const { return authority_; }
+  absl::string_view path() const { return path_; }
+  // The raw query string, without the leading '?'. Empty if the URI has no
+  // query (an empty query string fails to parse).
+  absl::string_view query() const { return query_; }
+  absl::string_view fragment() const { return fragment_; }
+
+  // Materializes an owning URI with percent-decoded components and split
+  // query parameters, equivalent to URI::Parse() on the original string.
+  URI ToURI() const;
+
+ private:
+  absl::string_view scheme_;
+  absl::string_view authority_;
+  absl::string_view path_;
+  absl::string_view query_;
+  absl::string_view fragment_;
+};
 }  // namespace grpc_core
 
 #endif  // GRPC_CORE_LIB_URI_URI_PARSER_H
@@ -54,6 +54,7 @@ extern void RegisterWeightedTargetLbPolicy(CoreConfiguration::Builder* builder);
 extern void RegisterPickFirstLbPolicy(CoreConfiguration::Builder* builder);
 extern void RegisterRoundRobinLbPolicy(CoreConfiguration::Builder* builder);
 extern void RegisterRingHashLbPolicy(CoreConfiguration::Builder* builder);
+extern void RegisterLeastRequestLbPolicy(CoreConfiguration::Builder* builder);
 extern void RegisterHttpProxyMapper(CoreConfiguration::Builder* builder);
 #ifndef GRPC_NO_RLS
 extern void RegisterRlsLbPolicy(CoreConfiguration::Builder* builder);
@@ -62,45 +63,62 @@ extern void RegisterRlsLbPolicy(CoreConfiguration::Builder* builder);
 extern void RegisterBinderResolver(CoreConfiguration::Builder* builder);
 #endif
 
-void BuildCoreConfiguration(CoreConfiguration::Builder* builder) {
-  // The order of the handshaker registration is crucial here.
-  // We want TCP connect handshaker to be registered last so that it is added to
-  // the start of the handshaker list.
-  RegisterHttpConnectHandshaker(builder);
-  RegisterTCPConnectHandshaker(builder);
-  RegisterPriorityLbPolicy(builder);
-  RegisterOutlierDetectionLbPolicy(builder);
-  RegisterWeightedTargetLbPolicy(builder);
-  RegisterPickFirstLbPolicy(builder);
-  RegisterRoundRobinLbPolicy(builder);
-  RegisterRingHashLbPolicy(builder);
-  BuildClientChannelConfiguration(builder);
-  SecurityRegisterHandshakerFactories(builder);
-  RegisterClientAuthorityFilter(builder);
-  RegisterChannelIdleFilters(builder);
-  RegisterGrpcLbPolicy(builder);
-  RegisterHttpFilters(builder);
-  RegisterDeadlineFilter(builder);
-  RegisterMessageSizeFilter(builder);
-  RegisterServiceConfigChannelArgFilter(builder);
-  RegisterResourceQuota(builder);
-  FaultInjectionFilterRegister(builder);
-  RegisterAresDnsResolver(builder);
-  RegisterNativeDnsResolver(builder);
-  RegisterSockaddrResolver(builder);
-  RegisterFakeResolver(builder);
-  RegisterHttpProxyMapper(builder);
+namespace {
+
+// The static plugin list as a link-time-resolved constant table: no dynamic
+// registration machinery (std::function, heap nodes) is involved for the
+// built-in plugins, and the configuration build is a tight loop over rodata.
+// The table is only walked on the first CoreConfiguration::Get(), so
+// processes that never create a channel or server never pay for it.
+//
+// The order of the handshaker registration is crucial here.
+// We want TCP connect handshaker to be registered last so that it is added to
+// the start of the handshaker list.
+constexpr void (*kStaticPluginRegistrations[])(CoreConfiguration::Builder*) = {
+    RegisterHttpConnectHandshaker,
+    RegisterTCPConnectHandshaker,
+    RegisterPriorityLbPolicy,
+    RegisterOutlierDetectionLbPolicy,
+    RegisterWeightedTargetLbPolicy,
+    RegisterPickFirstLbPolicy,
+    RegisterRoundRobinLbPolicy,
+    RegisterRingHashLbPolicy,
+    RegisterLeastRequestLbPolicy,
+    BuildClientChannelConfiguration,
+    SecurityRegisterHandshakerFactories,
+    RegisterClientAuthorityFilter,
+    RegisterChannelIdleFilters,
+    RegisterGrpcLbPolicy,
+    RegisterHttpFilters,
+    RegisterDeadlineFilter,
+    RegisterMessageSizeFilter,
+    RegisterServiceConfigChannelArgFilter,
+    RegisterResourceQuota,
+    FaultInjectionFilterRegister,
+    RegisterAresDnsResolver,
+    RegisterNativeDnsResolver,
+    RegisterSockaddrResolver,
+    RegisterFakeResolver,
+    RegisterHttpProxyMapper,
 #ifdef GPR_SUPPORT_BINDER_TRANSPORT
-  RegisterBinderResolver(builder);
+    RegisterBinderResolver,
 #endif
 #ifndef GRPC_NO_RLS
-  RegisterRlsLbPolicy(builder);
+    RegisterRlsLbPolicy,
 #endif  // !GRPC_NO_RLS
-  // Run last so it gets a consistent location.
-  // TODO(ctiller): Is this actually necessary?
-  RegisterSecurityFilters(builder);
-  RegisterExtraFilters(builder);
-  RegisterBuiltins(builder);
+    // Run last so it gets a consistent location.
+    // TODO(ctiller): Is this actually necessary?
+    RegisterSecurityFilters,
+    RegisterExtraFilters,
+    RegisterBuiltins,
+};
+
+}  // namespace
+
+void BuildCoreConfiguration(CoreConfiguration::Builder* builder) {
+  for (auto registration : kStaticPluginRegistrations) {
+    registration(builder);
+  }
 }
 
 }  // namespace grpc_core
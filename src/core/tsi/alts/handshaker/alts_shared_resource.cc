@@ -20,9 +20,14 @@
 
 #include "src/core/tsi/alts/handshaker/alts_shared_resource.h"
 
+#include <string.h>
+
+#include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
+#include <grpc/support/string_util.h>
 
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/surface/channel.h"
 #include "src/core/tsi/alts/handshaker/alts_handshaker_client.h"
 
 static alts_shared_resource_dedicated g_alts_resource_dedicated;
@@ -89,3 +94,96 @@ void grpc_alts_shared_resource_dedicated_shutdown() {
   }
   gpr_mu_destroy(&g_alts_resource_dedicated.mu);
 }
+
+/* Channels to the handshaker service, shared by all handshakes that target
+ * the same service url, so that concurrent handshakes do not each pay for a
+ * separate connection to the (typically local) handshaker service. An entry
+ * is destroyed as soon as its last user releases it: an idle cached channel
+ * would hold a gRPC initialization ref and prevent clean shutdown. */
+typedef struct alts_shared_channel_entry {
+  char* url;
+  grpc_channel* channel;
+  size_t use_count;
+  struct alts_shared_channel_entry* next;
+} alts_shared_channel_entry;
+
+static gpr_once g_shared_channel_once = GPR_ONCE_INIT;
+static gpr_mu g_shared_channel_mu;
+static alts_shared_channel_entry* g_shared_channel_list = nullptr;
+
+static void shared_channel_init(void) { gpr_mu_init(&g_shared_channel_mu); }
+
+grpc_channel* grpc_alts_get_shared_channel(const char* handshaker_service_url) {
+  GPR_ASSERT(handshaker_service_url != nullptr);
+  gpr_once_init(&g_shared_channel_once, shared_channel_init);
+  gpr_mu_lock(&g_shared_channel_mu);
+  for (alts_shared_channel_entry* entry = g_shared_channel_list;
+       entry != nullptr; entry = entry->next) {
+    if (strcmp(entry->url, handshaker_service_url) == 0) {
+      entry->use_count++;
+      grpc_channel* channel = entry->channel;
+      gpr_mu_unlock(&g_shared_channel_mu);
+      return channel;
+    }
+  }
+  gpr_mu_unlock(&g_shared_channel_mu);
+  // Create the channel outside the lock: channel creation acquires g_init_mu
+  // and must not nest under the cache mutex.
+  grpc_channel_credentials* creds = grpc_insecure_credentials_create();
+  // Disable retries so that we quickly get a signal when the
+  // handshake server is not reachable.
+  grpc_arg disable_retries_arg = grpc_channel_arg_integer_create(
+      const_cast<char*>(GRPC_ARG_ENABLE_RETRIES), 0);
+  grpc_channel_args args = {1, &disable_retries_arg};
+  grpc_channel* channel =
+      grpc_channel_create(handshaker_service_url, creds, &args);
+  grpc_channel_credentials_release(creds);
+  gpr_mu_lock(&g_shared_channel_mu);
+  for (alts_shared_channel_entry* entry = g_shared_channel_list;
+       entry != nullptr; entry = entry->next) {
+    if (strcmp(entry->url, handshaker_service_url) == 0) {
+      // Another handshake raced us to create the channel; use its entry and
+      // drop ours.
+      entry->use_count++;
+      grpc_channel* existing = entry->channel;
+      gpr_mu_unlock(&g_shared_channel_mu);
+      grpc_channel_destroy_internal(channel);
+      return existing;
+    }
+  }
+  alts_shared_channel_entry* entry = static_cast<alts_shared_channel_entry*>(
+      gpr_zalloc(sizeof(alts_shared_channel_entry)));
+  entry->url = gpr_strdup(handshaker_service_url);
+  entry->channel = channel;
+  entry->use_count = 1;
+  entry->next = g_shared_channel_list;
+  g_shared_channel_list = entry;
+  gpr_mu_unlock(&g_shared_channel_mu);
+  return channel;
+}
+
+void grpc_alts_release_shared_channel(grpc_channel* channel) {
+  if (channel == nullptr) {
+    return;
+  }
+  alts_shared_channel_entry* defunct = nullptr;
+  gpr_mu_lock(&g_shared_channel_mu);
+  for (alts_shared_channel_entry** prev = &g_shared_channel_list;
+       *prev != nullptr; prev = &(*prev)->next) {
+    alts_shared_channel_entry* entry = *prev;
+    if (entry->channel == channel) {
+      GPR_ASSERT(entry->use_count > 0);
+      if (--entry->use_count == 0) {
+        *prev = entry->next;
+        defunct = entry;
+      }
+      break;
+    }
+  }
+  gpr_mu_unlock(&g_shared_channel_mu);
+  if (defunct != nullptr) {
+    grpc_channel_destroy_internal(defunct->channel);
+    gpr_free(defunct->url);
+    gpr_free(defunct);
+  }
+}
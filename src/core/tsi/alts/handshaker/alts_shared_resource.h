@@ -69,5 +69,21 @@ void grpc_alts_shared_resource_dedicated_init();
 void grpc_alts_shared_resource_dedicated_start(
     const char* handshaker_service_url);
 
+/**
+ * This method returns a channel to the handshaker service at \a
+ * handshaker_service_url, creating the channel on first use and sharing it
+ * with all concurrent ALTS TSI handshakes that target the same url. The
+ * channel must be returned with grpc_alts_release_shared_channel() and must
+ * not be destroyed directly.
+ */
+grpc_channel* grpc_alts_get_shared_channel(const char* handshaker_service_url);
+
+/**
+ * This method returns a channel previously obtained from
+ * grpc_alts_get_shared_channel(). The channel is destroyed once its last
+ * concurrent user has released it.
+ */
+void grpc_alts_release_shared_channel(grpc_channel* channel);
+
 #endif /* GRPC_CORE_TSI_ALTS_HANDSHAKER_ALTS_SHARED_RESOURCE_H \
         */
@@ -501,15 +501,11 @@ static void alts_tsi_handshaker_create_channel(
       static_cast<alts_tsi_handshaker_continue_handshaker_next_args*>(arg);
   alts_tsi_handshaker* handshaker = next_args->handshaker;
   GPR_ASSERT(handshaker->channel == nullptr);
-  grpc_channel_credentials* creds = grpc_insecure_credentials_create();
-  // Disable retries so that we quickly get a signal when the
-  // handshake server is not reachable.
-  grpc_arg disable_retries_arg = grpc_channel_arg_integer_create(
-      const_cast<char*>(GRPC_ARG_ENABLE_RETRIES), 0);
-  grpc_channel_args args = {1, &disable_retries_arg};
-  handshaker->channel = grpc_channel_create(
-      next_args->handshaker->handshaker_service_url, creds, &args);
-  grpc_channel_credentials_release(creds);
+  // Use the channel shared by all handshakes that target the same handshaker
+  // service, so that concurrent handshakes do not each set up their own
+  // connection to it.
+  handshaker->channel = grpc_alts_get_shared_channel(
+      next_args->handshaker->handshaker_service_url);
   tsi_result continue_next_result =
       alts_tsi_handshaker_continue_handshaker_next(
           handshaker, next_args->received_bytes.get(),
@@ -615,7 +611,7 @@ static void handshaker_destroy(tsi_handshaker* self) {
   grpc_core::CSliceUnref(handshaker->target_name);
   grpc_alts_credentials_options_destroy(handshaker->options);
   if (handshaker->channel != nullptr) {
-    grpc_channel_destroy_internal(handshaker->channel);
+    grpc_alts_release_shared_channel(handshaker->channel);
   }
   gpr_free(handshaker->handshaker_service_url);
   delete handshaker;
@@ -33,6 +33,32 @@
 
 /* --- alts_grpc_record_protocol methods implementation. --- */
 
+/**
+ * Protects the contents of unprotected_slices into protected_iovec, whose
+ * length must be exactly the unprotected data length plus the frame overhead
+ * (header and tag). The input slice buffer is cleared on success, although
+ * the actual unprotected data bytes are not modified.
+ */
+static tsi_result protect_one_frame(alts_grpc_record_protocol* rp,
+                                    grpc_slice_buffer* unprotected_slices,
+                                    iovec_t protected_iovec) {
+  /* Calls alts_iovec_record_protocol protect.  */
+  char* error_details = nullptr;
+  alts_grpc_record_protocol_convert_slice_buffer_to_iovec(rp,
+                                                          unprotected_slices);
+  grpc_status_code status =
+      alts_iovec_record_protocol_privacy_integrity_protect(
+          rp->iovec_rp, rp->iovec_buf, unprotected_slices->count,
+          protected_iovec, &error_details);
+  if (status != GRPC_STATUS_OK) {
+    gpr_log(GPR_ERROR, "Failed to protect, %s", error_details);
+    gpr_free(error_details);
+    return TSI_INTERNAL_ERROR;
+  }
+  grpc_slice_buffer_reset_and_unref(unprotected_slices);
+  return TSI_OK;
+}
+
 static tsi_result alts_grpc_privacy_integrity_protect(
     alts_grpc_record_protocol* rp, grpc_slice_buffer* unprotected_slices,
     grpc_slice_buffer* protected_slices) {
@@ -51,22 +77,63 @@ static tsi_result alts_grpc_privacy_integrity_protect(
   grpc_slice protected_slice = GRPC_SLICE_MALLOC(protected_frame_size);
   iovec_t protected_iovec = {GRPC_SLICE_START_PTR(protected_slice),
                              GRPC_SLICE_LENGTH(protected_slice)};
-  /* Calls alts_iovec_record_protocol protect.  */
-  char* error_details = nullptr;
-  alts_grpc_record_protocol_convert_slice_buffer_to_iovec(rp,
-                                                          unprotected_slices);
-  grpc_status_code status =
-      alts_iovec_record_protocol_privacy_integrity_protect(
-          rp->iovec_rp, rp->iovec_buf, unprotected_slices->count,
-          protected_iovec, &error_details);
-  if (status != GRPC_STATUS_OK) {
-    gpr_log(GPR_ERROR, "Failed to protect, %s", error_details);
-    gpr_free(error_details);
+  tsi_result result =
+      protect_one_frame(rp, unprotected_slices, protected_iovec);
+  if (result != TSI_OK) {
     grpc_core::CSliceUnref(protected_slice);
-    return TSI_INTERNAL_ERROR;
+    return result;
+  }
+  grpc_slice_buffer_add(protected_slices, protected_slice);
+  return TSI_OK;
+}
+
+static tsi_result alts_grpc_privacy_integrity_protect_batched(
+    alts_grpc_record_protocol* rp, grpc_slice_buffer* unprotected_slices,
+    size_t max_unprotected_data_size, grpc_slice_buffer* protected_slices) {
+  /* Input sanity check.  */
+  if (rp == nullptr || unprotected_slices == nullptr ||
+      max_unprotected_data_size == 0 || protected_slices == nullptr) {
+    gpr_log(GPR_ERROR,
+            "Invalid arguments to alts_grpc_record_protocol protect_batched.");
+    return TSI_INVALID_ARGUMENT;
+  }
+  /* Allocates a single output buffer covering every frame in the batch, so
+   * that per-frame allocation and downstream slice management costs are paid
+   * once per batch instead of once per frame.  */
+  size_t frame_overhead = rp->header_length +
+                          alts_iovec_record_protocol_get_tag_length(
+                              rp->iovec_rp);
+  size_t num_frames = (unprotected_slices->length +
+                       max_unprotected_data_size - 1) /
+                      max_unprotected_data_size;
+  if (num_frames == 0) num_frames = 1;
+  grpc_slice protected_slice = GRPC_SLICE_MALLOC(
+      unprotected_slices->length + num_frames * frame_overhead);
+  uint8_t* cur = GRPC_SLICE_START_PTR(protected_slice);
+  grpc_slice_buffer staging_sb;
+  grpc_slice_buffer_init(&staging_sb);
+  tsi_result result = TSI_OK;
+  /* Encrypts each frame into consecutive regions of the shared buffer.  */
+  do {
+    grpc_slice_buffer* frame_sb = unprotected_slices;
+    if (unprotected_slices->length > max_unprotected_data_size) {
+      grpc_slice_buffer_move_first(unprotected_slices,
+                                   max_unprotected_data_size, &staging_sb);
+      frame_sb = &staging_sb;
+    }
+    size_t protected_frame_size = frame_sb->length + frame_overhead;
+    iovec_t protected_iovec = {cur, protected_frame_size};
+    result = protect_one_frame(rp, frame_sb, protected_iovec);
+    if (result != TSI_OK) break;
+    cur += protected_frame_size;
+  } while (unprotected_slices->length > 0);
+  grpc_slice_buffer_destroy(&staging_sb);
+  if (result != TSI_OK) {
+    grpc_slice_buffer_reset_and_unref(unprotected_slices);
+    grpc_core::CSliceUnref(protected_slice);
+    return result;
   }
   grpc_slice_buffer_add(protected_slices, protected_slice);
-  grpc_slice_buffer_reset_and_unref(unprotected_slices);
   return TSI_OK;
 }
 
@@ -119,7 +186,8 @@ static tsi_result alts_grpc_privacy_integrity_unprotect(
 static const alts_grpc_record_protocol_vtable
     alts_grpc_privacy_integrity_record_protocol_vtable = {
         alts_grpc_privacy_integrity_protect,
-        alts_grpc_privacy_integrity_unprotect, nullptr};
+        alts_grpc_privacy_integrity_unprotect, nullptr,
+        alts_grpc_privacy_integrity_protect_batched};
 
 tsi_result alts_grpc_privacy_integrity_record_protocol_create(
     gsec_aead_crypter* crypter, size_t overflow_size, bool is_client,
@@ -50,6 +50,30 @@ tsi_result alts_grpc_record_protocol_protect(
     alts_grpc_record_protocol* self, grpc_slice_buffer* unprotected_slices,
     grpc_slice_buffer* protected_slices);
 
+/**
+ * This method performs protect operation on unprotected data spanning multiple
+ * frames in one pass, splitting the input into frames of at most
+ * max_unprotected_data_size bytes and appending all resulting protected frames
+ * to protected_slices. Record protocols that allocate a new output buffer per
+ * frame implement this by sharing a single allocation across the whole batch,
+ * amortizing per-frame allocation and slice management overhead. The input
+ * unprotected data slice buffer will be cleared, although the actual
+ * unprotected data bytes are not modified.
+ *
+ * - self: an alts_grpc_record_protocol instance.
+ * - unprotected_slices: the unprotected data to be protected.
+ * - max_unprotected_data_size: maximum unprotected data size per frame.
+ * - protected_slices: slice buffer where the protected frames are appended.
+ *
+ * This method returns TSI_OK in case of success or a specific error code in
+ * case of failure. Record protocols for which batching buys nothing (e.g.
+ * integrity-only, which emits the input slices directly) return
+ * TSI_UNIMPLEMENTED, and the caller should fall back to per-frame protect.
+ */
+tsi_result alts_grpc_record_protocol_protect_batched(
+    alts_grpc_record_protocol* self, grpc_slice_buffer* unprotected_slices,
+    size_t max_unprotected_data_size, grpc_slice_buffer* protected_slices);
+
 /**
  * This methods performs unprotect operation on a full frame of protected data
  * and appends unprotected data to unprotected_slices. It is the caller's
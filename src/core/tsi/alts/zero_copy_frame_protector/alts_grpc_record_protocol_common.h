@@ -39,6 +39,12 @@ struct alts_grpc_record_protocol_vtable {
                           grpc_slice_buffer* protected_slices,
                           grpc_slice_buffer* unprotected_slices);
   void (*destruct)(alts_grpc_record_protocol* self);
+  /* Optional multi-frame protect; may be nullptr, in which case callers fall
+   * back to calling protect once per frame.  */
+  tsi_result (*protect_batched)(alts_grpc_record_protocol* self,
+                                grpc_slice_buffer* unprotected_slices,
+                                size_t max_unprotected_data_size,
+                                grpc_slice_buffer* protected_slices);
 };
 /* Main struct for alts_grpc_record_protocol implementation, shared by both
  * integrity-only record protocol and privacy-integrity record protocol.
@@ -156,6 +156,18 @@ static tsi_result alts_zero_copy_grpc_protector_protect(
   }
   alts_zero_copy_grpc_protector* protector =
       reinterpret_cast<alts_zero_copy_grpc_protector*>(self);
+  /* Multi-frame inputs first try the batched path, which encrypts all frames
+   * in one pass into a single shared output allocation. Record protocols
+   * without a batched implementation report TSI_UNIMPLEMENTED, and we fall
+   * through to the per-frame loop below.  */
+  if (unprotected_slices->length > protector->max_unprotected_data_size) {
+    tsi_result status = alts_grpc_record_protocol_protect_batched(
+        protector->record_protocol, unprotected_slices,
+        protector->max_unprotected_data_size, protected_slices);
+    if (status != TSI_UNIMPLEMENTED) {
+      return status;
+    }
+  }
   /* Calls alts_grpc_record_protocol protect repeatly.  */
   while (unprotected_slices->length > protector->max_unprotected_data_size) {
     grpc_slice_buffer_move_first(unprotected_slices,
@@ -20,15 +20,30 @@
 
 #include "src/core/tsi/ssl/session_cache/ssl_session_cache.h"
 
+#include <functional>
+
 #include <grpc/support/log.h>
 #include <grpc/support/string_util.h>
 
+#include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/tsi/ssl/session_cache/ssl_session.h"
 
 namespace tsi {
 
+namespace {
+
+// Upper bound on the number of shards; more shards than concurrently
+// handshaking threads buys nothing.
+constexpr size_t kMaxShards = 16;
+// Minimum per-shard capacity.  Caches smaller than 2 * this stay single
+// sharded and therefore keep exact global LRU semantics; only large caches
+// pay the (slight) policy approximation that comes with per-shard LRU.
+constexpr size_t kMinSessionsPerShard = 32;
+
+}  // namespace
+
 /// Node for single cached session.
 class SslSessionLRUCache::Node {
  public:
@@ -60,120 +75,157 @@ class SslSessionLRUCache::Node {
   Node* prev_ = nullptr;
 };
 
-SslSessionLRUCache::SslSessionLRUCache(size_t capacity) : capacity_(capacity) {
+SslSessionLRUCache::SslSessionLRUCache(size_t capacity) {
   GPR_ASSERT(capacity > 0);
+  size_t num_shards = grpc_core::Clamp(capacity / kMinSessionsPerShard,
+                                       size_t(1), kMaxShards);
+  shards_ = std::vector<Shard>(num_shards);
+  // Distribute the capacity over the shards, giving the remainder to the
+  // first shards so that the total stays exactly at capacity.
+  size_t base_capacity = capacity / num_shards;
+  size_t remainder = capacity % num_shards;
+  for (size_t i = 0; i < num_shards; i++) {
+    shards_[i].capacity = base_capacity + (i < remainder ? 1 : 0);
+  }
 }
 
 SslSessionLRUCache::~SslSessionLRUCache() {
-  Node* node = use_order_list_head_;
-  while (node) {
-    Node* next = node->next_;
-    delete node;
-    node = next;
+  for (Shard& shard : shards_) {
+    Node* node = shard.use_order_list_head;
+    while (node) {
+      Node* next = node->next_;
+      delete node;
+      node = next;
+    }
   }
 }
 
 size_t SslSessionLRUCache::Size() {
-  grpc_core::MutexLock lock(&lock_);
-  return use_order_list_size_;
+  size_t size = 0;
+  for (Shard& shard : shards_) {
+    grpc_core::MutexLock lock(&shard.lock);
+    size += shard.use_order_list_size;
+  }
+  return size;
 }
 
-SslSessionLRUCache::Node* SslSessionLRUCache::FindLocked(
+SslSessionLRUCache::Shard& SslSessionLRUCache::ShardForKey(
     const std::string& key) {
-  auto it = entry_by_key_.find(key);
-  if (it == entry_by_key_.end()) {
+  return shards_[std::hash<std::string>()(key) % shards_.size()];
+}
+
+SslSessionLRUCache::Node* SslSessionLRUCache::FindLocked(
+    Shard& shard, const std::string& key) {
+  auto it = shard.entry_by_key.find(key);
+  if (it == shard.entry_by_key.end()) {
     return nullptr;
   }
   Node* node = it->second;
   // Move to the beginning.
-  Remove(node);
-  PushFront(node);
-  AssertInvariants();
+  Remove(shard, node);
+  PushFront(shard, node);
+  AssertInvariants(shard);
   return node;
 }
 
 void SslSessionLRUCache::Put(const char* key, SslSessionPtr session) {
-  grpc_core::MutexLock lock(&lock_);
-  Node* node = FindLocked(key);
+  std::string key_str(key);
+  Shard& shard = ShardForKey(key_str);
+  grpc_core::MutexLock lock(&shard.lock);
+  Node* node = FindLocked(shard, key_str);
   if (node != nullptr) {
     node->SetSession(std::move(session));
     return;
   }
-  node = new Node(key, std::move(session));
-  PushFront(node);
-  entry_by_key_.emplace(key, node);
-  AssertInvariants();
-  if (use_order_list_size_ > capacity_) {
-    GPR_ASSERT(use_order_list_tail_);
-    node = use_order_list_tail_;
-    Remove(node);
+  node = new Node(key_str, std::move(session));
+  PushFront(shard, node);
+  shard.entry_by_key.emplace(std::move(key_str), node);
+  AssertInvariants(shard);
+  if (shard.use_order_list_size > shard.capacity) {
+    GPR_ASSERT(shard.use_order_list_tail);
+    node = shard.use_order_list_tail;
+    Remove(shard, node);
     // Order matters, key is destroyed after deleting node.
-    entry_by_key_.erase(node->key());
+    shard.entry_by_key.erase(node->key());
     delete node;
-    AssertInvariants();
+    evictions_.fetch_add(1, std::memory_order_relaxed);
+    AssertInvariants(shard);
   }
 }
 
 SslSessionPtr SslSessionLRUCache::Get(const char* key) {
-  grpc_core::MutexLock lock(&lock_);
+  std::string key_str(key);
+  Shard& shard = ShardForKey(key_str);
+  grpc_core::MutexLock lock(&shard.lock);
   // Key is only used for lookups.
-  Node* node = FindLocked(key);
+  Node* node = FindLocked(shard, key_str);
   if (node == nullptr) {
+    misses_.fetch_add(1, std::memory_order_relaxed);
     return nullptr;
   }
+  hits_.fetch_add(1, std::memory_order_relaxed);
   return node->CopySession();
 }
 
-void SslSessionLRUCache::Remove(SslSessionLRUCache::Node* node) {
+SslSessionLRUCache::Stats SslSessionLRUCache::stats() const {
+  Stats stats;
+  stats.hits = hits_.load(std::memory_order_relaxed);
+  stats.misses = misses_.load(std::memory_order_relaxed);
+  stats.evictions = evictions_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+void SslSessionLRUCache::Remove(Shard& shard, SslSessionLRUCache::Node* node) {
   if (node->prev_ == nullptr) {
-    use_order_list_head_ = node->next_;
+    shard.use_order_list_head = node->next_;
   } else {
     node->prev_->next_ = node->next_;
   }
   if (node->next_ == nullptr) {
-    use_order_list_tail_ = node->prev_;
+    shard.use_order_list_tail = node->prev_;
   } else {
     node->next_->prev_ = node->prev_;
   }
-  GPR_ASSERT(use_order_list_size_ >= 1);
-  use_order_list_size_--;
+  GPR_ASSERT(shard.use_order_list_size >= 1);
+  shard.use_order_list_size--;
 }
 
-void SslSessionLRUCache::PushFront(SslSessionLRUCache::Node* node) {
-  if (use_order_list_head_ == nullptr) {
-    use_order_list_head_ = node;
-    use_order_list_tail_ = node;
+void SslSessionLRUCache::PushFront(Shard& shard,
+                                   SslSessionLRUCache::Node* node) {
+  if (shard.use_order_list_head == nullptr) {
+    shard.use_order_list_head = node;
+    shard.use_order_list_tail = node;
     node->next_ = nullptr;
     node->prev_ = nullptr;
   } else {
-    node->next_ = use_order_list_head_;
+    node->next_ = shard.use_order_list_head;
     node->next_->prev_ = node;
-    use_order_list_head_ = node;
+    shard.use_order_list_head = node;
     node->prev_ = nullptr;
   }
-  use_order_list_size_++;
+  shard.use_order_list_size++;
 }
 
 #ifndef NDEBUG
-void SslSessionLRUCache::AssertInvariants() {
+void SslSessionLRUCache::AssertInvariants(Shard& shard) {
   size_t size = 0;
   Node* prev = nullptr;
-  Node* current = use_order_list_head_;
+  Node* current = shard.use_order_list_head;
   while (current != nullptr) {
     size++;
     GPR_ASSERT(current->prev_ == prev);
-    auto it = entry_by_key_.find(current->key());
-    GPR_ASSERT(it != entry_by_key_.end());
+    auto it = shard.entry_by_key.find(current->key());
+    GPR_ASSERT(it != shard.entry_by_key.end());
     GPR_ASSERT(it->second == current);
     prev = current;
     current = current->next_;
   }
-  GPR_ASSERT(prev == use_order_list_tail_);
-  GPR_ASSERT(size == use_order_list_size_);
-  GPR_ASSERT(entry_by_key_.size() == use_order_list_size_);
+  GPR_ASSERT(prev == shard.use_order_list_tail);
+  GPR_ASSERT(size == shard.use_order_list_size);
+  GPR_ASSERT(shard.entry_by_key.size() == shard.use_order_list_size);
 }
 #else
-void SslSessionLRUCache::AssertInvariants() {}
+void SslSessionLRUCache::AssertInvariants(Shard&) {}
 #endif
 
 }  // namespace tsi
@@ -21,7 +21,10 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <atomic>
+#include <cstdint>
 #include <map>
+#include <vector>
 
 #include <openssl/ssl.h>
 
@@ -42,6 +45,12 @@
 /// name. Note that servers are required to share session ticket encryption keys
 /// in order for cache to be effective.
 ///
+/// Large caches are split internally into independently locked shards
+/// (selected by hashing the key), so that threads completing handshakes
+/// concurrently do not all serialize on one mutex; the LRU policy and the
+/// capacity limit then apply per shard. Small caches keep a single shard
+/// and thus exact global LRU behavior.
+///
 /// This class is thread safe.
 
 namespace tsi {
@@ -68,6 +77,13 @@ class SslSessionLRUCache
     return GRPC_SSL_SESSION_CACHE_ARG;
   }
 
+  /// Cumulative counters for cache effectiveness.
+  struct Stats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+  };
+
   /// Returns current number of sessions in the cache.
   size_t Size();
   /// Add \a session in the cache using \a key. This operation may discard older
@@ -76,22 +92,33 @@ class SslSessionLRUCache
   /// Returns the session from the cache associated with \a key or null if not
   /// found.
   SslSessionPtr Get(const char* key);
+  /// Returns a snapshot of the cache's hit/miss/eviction counters.
+  Stats stats() const;
 
  private:
   class Node;
 
-  Node* FindLocked(const std::string& key);
-  void Remove(Node* node);
-  void PushFront(Node* node);
-  void AssertInvariants();
-
-  grpc_core::Mutex lock_;
-  size_t capacity_;
-
-  Node* use_order_list_head_ = nullptr;
-  Node* use_order_list_tail_ = nullptr;
-  size_t use_order_list_size_ = 0;
-  std::map<std::string, Node*> entry_by_key_;
+  // One independently locked slice of the cache with its own LRU list.
+  struct Shard {
+    grpc_core::Mutex lock;
+    size_t capacity = 0;
+
+    Node* use_order_list_head = nullptr;
+    Node* use_order_list_tail = nullptr;
+    size_t use_order_list_size = 0;
+    std::map<std::string, Node*> entry_by_key;
+  };
+
+  Shard& ShardForKey(const std::string& key);
+  Node* FindLocked(Shard& shard, const std::string& key);
+  static void Remove(Shard& shard, Node* node);
+  static void PushFront(Shard& shard, Node* node);
+  void AssertInvariants(Shard& shard);
+
+  std::vector<Shard> shards_;
+  std::atomic<uint64_t> hits_{0};
+  std::atomic<uint64_t> misses_{0};
+  std::atomic<uint64_t> evictions_{0};
 };
 
 }  // namespace tsi
@@ -33,12 +33,14 @@
 #include <sys/socket.h>
 #endif
 
+#include <algorithm>
 #include <string>
 
 #include <openssl/bio.h>
 #include <openssl/crypto.h> /* For OPENSSL_free */
 #include <openssl/engine.h>
 #include <openssl/err.h>
+#include <openssl/sha.h>
 #include <openssl/ssl.h>
 #include <openssl/tls1.h>
 #include <openssl/x509.h>
@@ -49,17 +51,21 @@
 #include "absl/strings/string_view.h"
 
 #include <grpc/grpc_security.h>
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 #include <grpc/support/string_util.h>
 #include <grpc/support/sync.h>
 #include <grpc/support/thd_id.h>
+#include <grpc/support/time.h>
 
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/tsi/ssl/key_logging/ssl_key_logging.h"
 #include "src/core/tsi/ssl/session_cache/ssl_session_cache.h"
 #include "src/core/tsi/ssl_types.h"
 #include "src/core/tsi/transport_security.h"
+#include "src/core/tsi/transport_security_grpc.h"
 
 /* --- Constants. ---*/
 
@@ -86,6 +92,28 @@ struct tsi_ssl_root_certs_store {
   X509_STORE* store;
 };
 
+/* Number of slots in the verified certificate cache. The cache is
+   direct-mapped: a colliding chain simply overwrites the slot, which is
+   acceptable since entries only save work and are never load-bearing. */
+#define TSI_SSL_VERIFIED_CERT_CACHE_SIZE 256
+
+typedef struct {
+  bool valid;
+  uint8_t chain_hash[SHA256_DIGEST_LENGTH];
+  gpr_timespec expiry;
+} tsi_ssl_verified_cert_cache_entry;
+
+/* Remembers SHA256 hashes of DER-encoded peer certificate chains that already
+   passed full X509 verification against this factory's roots, so that
+   reconnects presenting a byte-identical chain within the TTL can skip the
+   redundant signature checks. */
+struct tsi_ssl_verified_cert_cache {
+  gpr_mu mu;
+  gpr_timespec ttl;
+  tsi_ssl_verified_cert_cache_entry
+      entries[TSI_SSL_VERIFIED_CERT_CACHE_SIZE];
+};
+
 struct tsi_ssl_handshaker_factory {
   const tsi_ssl_handshaker_factory_vtable* vtable;
   gpr_refcount refcount;
@@ -98,6 +126,7 @@ struct tsi_ssl_client_handshaker_factory {
   size_t alpn_protocol_list_length;
   grpc_core::RefCountedPtr<tsi::SslSessionLRUCache> session_cache;
   grpc_core::RefCountedPtr<TlsSessionKeyLogger> key_logger;
+  tsi_ssl_verified_cert_cache* verified_cert_cache;
 };
 
 struct tsi_ssl_server_handshaker_factory {
@@ -941,6 +970,108 @@ static int NullVerifyCallback(int /*preverify_ok*/, X509_STORE_CTX* /*ctx*/) {
   return 1;
 }
 
+/* --- Verified certificate cache. --- */
+
+static void tsi_ssl_verified_cert_cache_destroy(
+    tsi_ssl_verified_cert_cache* cache) {
+  if (cache == nullptr) return;
+  gpr_mu_destroy(&cache->mu);
+  gpr_free(cache);
+}
+
+#if OPENSSL_VERSION_NUMBER >= 0x10100000
+
+static tsi_ssl_verified_cert_cache* tsi_ssl_verified_cert_cache_create(
+    size_t ttl_secs) {
+  tsi_ssl_verified_cert_cache* cache =
+      static_cast<tsi_ssl_verified_cert_cache*>(gpr_zalloc(sizeof(*cache)));
+  gpr_mu_init(&cache->mu);
+  cache->ttl =
+      gpr_time_from_seconds(static_cast<int64_t>(ttl_secs), GPR_TIMESPAN);
+  return cache;
+}
+
+static size_t tsi_ssl_verified_cert_cache_slot(const uint8_t* chain_hash) {
+  uint64_t value;
+  memcpy(&value, chain_hash, sizeof(value));
+  return value % TSI_SSL_VERIFIED_CERT_CACHE_SIZE;
+}
+
+static bool tsi_ssl_verified_cert_cache_lookup(
+    tsi_ssl_verified_cert_cache* cache, const uint8_t* chain_hash) {
+  tsi_ssl_verified_cert_cache_entry* entry =
+      &cache->entries[tsi_ssl_verified_cert_cache_slot(chain_hash)];
+  gpr_mu_lock(&cache->mu);
+  bool fresh =
+      entry->valid &&
+      memcmp(entry->chain_hash, chain_hash, SHA256_DIGEST_LENGTH) == 0 &&
+      gpr_time_cmp(gpr_now(GPR_CLOCK_MONOTONIC), entry->expiry) < 0;
+  gpr_mu_unlock(&cache->mu);
+  return fresh;
+}
+
+static void tsi_ssl_verified_cert_cache_insert(
+    tsi_ssl_verified_cert_cache* cache, const uint8_t* chain_hash) {
+  tsi_ssl_verified_cert_cache_entry* entry =
+      &cache->entries[tsi_ssl_verified_cert_cache_slot(chain_hash)];
+  gpr_mu_lock(&cache->mu);
+  entry->valid = true;
+  memcpy(entry->chain_hash, chain_hash, SHA256_DIGEST_LENGTH);
+  entry->expiry = gpr_time_add(gpr_now(GPR_CLOCK_MONOTONIC), cache->ttl);
+  gpr_mu_unlock(&cache->mu);
+}
+
+/* Hashes the DER encoding of the peer's presented certificate chain (leaf
+   included). Returns false if the chain cannot be encoded, in which case the
+   caller must fall back to full verification. */
+static bool tsi_ssl_compute_peer_chain_hash(X509_STORE_CTX* ctx,
+                                            uint8_t* chain_hash) {
+  X509* leaf = X509_STORE_CTX_get0_cert(ctx);
+  if (leaf == nullptr) return false;
+  SHA256_CTX sha;
+  SHA256_Init(&sha);
+  unsigned char* der = nullptr;
+  int der_length = i2d_X509(leaf, &der);
+  if (der_length < 0) return false;
+  SHA256_Update(&sha, der, static_cast<size_t>(der_length));
+  OPENSSL_free(der);
+  STACK_OF(X509)* chain = X509_STORE_CTX_get0_untrusted(ctx);
+  if (chain != nullptr) {
+    const auto chain_len = sk_X509_num(chain);
+    for (auto i = decltype(chain_len){0}; i < chain_len; i++) {
+      der = nullptr;
+      der_length = i2d_X509(sk_X509_value(chain, i), &der);
+      if (der_length < 0) return false;
+      SHA256_Update(&sha, der, static_cast<size_t>(der_length));
+      OPENSSL_free(der);
+    }
+  }
+  SHA256_Final(chain_hash, &sha);
+  return true;
+}
+
+/* Replaces the default chain verification when the verified certificate cache
+   is enabled. A chain that verified successfully within the TTL is accepted
+   without re-running the signature checks; everything else goes through
+   X509_verify_cert as usual and successful results are cached. */
+static int tsi_ssl_verified_cert_cache_verify(X509_STORE_CTX* ctx, void* arg) {
+  tsi_ssl_verified_cert_cache* cache =
+      static_cast<tsi_ssl_verified_cert_cache*>(arg);
+  uint8_t chain_hash[SHA256_DIGEST_LENGTH];
+  if (!tsi_ssl_compute_peer_chain_hash(ctx, chain_hash)) {
+    return X509_verify_cert(ctx);
+  }
+  if (tsi_ssl_verified_cert_cache_lookup(cache, chain_hash)) {
+    X509_STORE_CTX_set_error(ctx, X509_V_OK);
+    return 1;
+  }
+  int ok = X509_verify_cert(ctx);
+  if (ok == 1) tsi_ssl_verified_cert_cache_insert(cache, chain_hash);
+  return ok;
+}
+
+#endif /* OPENSSL_VERSION_NUMBER >= 0x10100000 */
+
 // Sets the min and max TLS version of |ssl_context| to |min_tls_version| and
 // |max_tls_version|, respectively. Calling this method is a no-op when using
 // OpenSSL versions < 1.1.
@@ -1200,6 +1331,153 @@ static const tsi_frame_protector_vtable frame_protector_vtable = {
     ssl_protector_destroy,
 };
 
+/* --- tsi_zero_copy_grpc_protector methods implementation. ---
+
+   Unlike the byte-pointer frame protector above, this implementation reads
+   plaintext directly from the caller's slices and writes TLS records into
+   freshly allocated output slices, so the secure endpoint does not need to
+   stage data through contiguous buffers on either path. The data still
+   passes through the SSL memory BIO, but the protector-level staging buffer
+   and the endpoint-level staging copies are gone. */
+
+typedef struct {
+  tsi_zero_copy_grpc_protector base;
+  SSL* ssl;
+  BIO* network_io;
+  /* Maximum number of plaintext bytes fed to a single SSL_write, bounding
+     the size of the TLS records we produce. */
+  size_t max_write_size;
+  size_t max_protected_frame_size;
+} tsi_ssl_zero_copy_grpc_protector;
+
+/* Drains all pending protected bytes out of the memory BIO into slices. */
+static tsi_result ssl_zero_copy_drain_bio(tsi_ssl_zero_copy_grpc_protector* impl,
+                                          grpc_slice_buffer* protected_slices) {
+  int pending;
+  while ((pending = static_cast<int>(BIO_pending(impl->network_io))) > 0) {
+    grpc_slice slice = GRPC_SLICE_MALLOC(static_cast<size_t>(pending));
+    int read_from_ssl =
+        BIO_read(impl->network_io, GRPC_SLICE_START_PTR(slice), pending);
+    if (read_from_ssl <= 0) {
+      grpc_slice_unref(slice);
+      gpr_log(GPR_ERROR,
+              "Could not read from BIO even though some data is pending");
+      return TSI_INTERNAL_ERROR;
+    }
+    if (static_cast<size_t>(read_from_ssl) < GRPC_SLICE_LENGTH(slice)) {
+      slice = grpc_slice_sub_no_ref(slice, 0,
+                                    static_cast<size_t>(read_from_ssl));
+    }
+    grpc_slice_buffer_add(protected_slices, slice);
+  }
+  return TSI_OK;
+}
+
+static tsi_result ssl_zero_copy_grpc_protector_protect(
+    tsi_zero_copy_grpc_protector* self, grpc_slice_buffer* unprotected_slices,
+    grpc_slice_buffer* protected_slices) {
+  if (self == nullptr || unprotected_slices == nullptr ||
+      protected_slices == nullptr) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  /* Encrypt each slice straight from its backing storage. */
+  for (size_t i = 0; i < unprotected_slices->count; i++) {
+    const grpc_slice* slice = &unprotected_slices->slices[i];
+    size_t offset = 0;
+    size_t length = GRPC_SLICE_LENGTH(*slice);
+    while (offset < length) {
+      size_t write_size = std::min(impl->max_write_size, length - offset);
+      tsi_result result = do_ssl_write(
+          impl->ssl, GRPC_SLICE_START_PTR(*slice) + offset, write_size);
+      if (result != TSI_OK) return result;
+      offset += write_size;
+    }
+  }
+  grpc_slice_buffer_reset_and_unref(unprotected_slices);
+  return ssl_zero_copy_drain_bio(impl, protected_slices);
+}
+
+static tsi_result ssl_zero_copy_grpc_protector_unprotect(
+    tsi_zero_copy_grpc_protector* self, grpc_slice_buffer* protected_slices,
+    grpc_slice_buffer* unprotected_slices, int* min_progress_size) {
+  if (self == nullptr || protected_slices == nullptr ||
+      unprotected_slices == nullptr) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  /* Feed the protected records to SSL... */
+  for (size_t i = 0; i < protected_slices->count; i++) {
+    const grpc_slice* slice = &protected_slices->slices[i];
+    size_t length = GRPC_SLICE_LENGTH(*slice);
+    if (length == 0) continue;
+    GPR_ASSERT(length <= INT_MAX);
+    int written_into_ssl = BIO_write(
+        impl->network_io, GRPC_SLICE_START_PTR(*slice),
+        static_cast<int>(length));
+    if (written_into_ssl < 0 ||
+        static_cast<size_t>(written_into_ssl) != length) {
+      gpr_log(GPR_ERROR, "Sending protected frame to ssl failed with %d",
+              written_into_ssl);
+      return TSI_INTERNAL_ERROR;
+    }
+  }
+  grpc_slice_buffer_reset_and_unref(protected_slices);
+  /* ...then pull out whatever plaintext is now available. */
+  while (true) {
+    grpc_slice slice = GRPC_SLICE_MALLOC(impl->max_write_size);
+    size_t read_size = GRPC_SLICE_LENGTH(slice);
+    tsi_result result =
+        do_ssl_read(impl->ssl, GRPC_SLICE_START_PTR(slice), &read_size);
+    if (result != TSI_OK) {
+      grpc_slice_unref(slice);
+      return result;
+    }
+    if (read_size == 0) {
+      grpc_slice_unref(slice);
+      break;
+    }
+    if (read_size < GRPC_SLICE_LENGTH(slice)) {
+      slice = grpc_slice_sub_no_ref(slice, 0, read_size);
+    }
+    grpc_slice_buffer_add(unprotected_slices, slice);
+  }
+  if (min_progress_size != nullptr) {
+    /* SSL does not tell us how many bytes the next record still needs. */
+    *min_progress_size = 1;
+  }
+  return TSI_OK;
+}
+
+static void ssl_zero_copy_grpc_protector_destroy(
+    tsi_zero_copy_grpc_protector* self) {
+  if (self == nullptr) return;
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  if (impl->ssl != nullptr) SSL_free(impl->ssl);
+  if (impl->network_io != nullptr) BIO_free(impl->network_io);
+  gpr_free(impl);
+}
+
+static tsi_result ssl_zero_copy_grpc_protector_max_frame_size(
+    tsi_zero_copy_grpc_protector* self, size_t* max_frame_size) {
+  if (self == nullptr || max_frame_size == nullptr) return TSI_INVALID_ARGUMENT;
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  *max_frame_size = impl->max_protected_frame_size;
+  return TSI_OK;
+}
+
+static const tsi_zero_copy_grpc_protector_vtable
+    zero_copy_grpc_protector_vtable = {
+        ssl_zero_copy_grpc_protector_protect,
+        ssl_zero_copy_grpc_protector_unprotect,
+        ssl_zero_copy_grpc_protector_destroy,
+        ssl_zero_copy_grpc_protector_max_frame_size,
+};
+
 /* --- tsi_server_handshaker_factory methods implementation. --- */
 
 static void tsi_ssl_handshaker_factory_destroy(
@@ -1337,7 +1615,46 @@ static tsi_result ssl_handshaker_result_extract_peer(
 static tsi_result ssl_handshaker_result_get_frame_protector_type(
     const tsi_handshaker_result* /*self*/,
     tsi_frame_protector_type* frame_protector_type) {
-  *frame_protector_type = TSI_FRAME_PROTECTOR_NORMAL;
+  *frame_protector_type = TSI_FRAME_PROTECTOR_NORMAL_OR_ZERO_COPY;
+  return TSI_OK;
+}
+
+static tsi_result ssl_handshaker_result_create_zero_copy_grpc_protector(
+    const tsi_handshaker_result* self, size_t* max_output_protected_frame_size,
+    tsi_zero_copy_grpc_protector** protector) {
+  size_t actual_max_output_protected_frame_size =
+      TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
+  tsi_ssl_handshaker_result* impl =
+      reinterpret_cast<tsi_ssl_handshaker_result*>(
+          const_cast<tsi_handshaker_result*>(self));
+  tsi_ssl_zero_copy_grpc_protector* protector_impl =
+      static_cast<tsi_ssl_zero_copy_grpc_protector*>(
+          gpr_zalloc(sizeof(*protector_impl)));
+
+  if (max_output_protected_frame_size != nullptr) {
+    if (*max_output_protected_frame_size >
+        TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND) {
+      *max_output_protected_frame_size =
+          TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
+    } else if (*max_output_protected_frame_size <
+               TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND) {
+      *max_output_protected_frame_size =
+          TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND;
+    }
+    actual_max_output_protected_frame_size = *max_output_protected_frame_size;
+  }
+  protector_impl->max_protected_frame_size =
+      actual_max_output_protected_frame_size;
+  protector_impl->max_write_size =
+      actual_max_output_protected_frame_size - TSI_SSL_MAX_PROTECTION_OVERHEAD;
+
+  /* Transfer ownership of ssl and network_io to the protector. */
+  protector_impl->ssl = impl->ssl;
+  impl->ssl = nullptr;
+  protector_impl->network_io = impl->network_io;
+  impl->network_io = nullptr;
+  protector_impl->base.vtable = &zero_copy_grpc_protector_vtable;
+  *protector = &protector_impl->base;
   return TSI_OK;
 }
 
@@ -1408,7 +1725,7 @@ static void ssl_handshaker_result_destroy(tsi_handshaker_result* self) {
 static const tsi_handshaker_result_vtable handshaker_result_vtable = {
     ssl_handshaker_result_extract_peer,
     ssl_handshaker_result_get_frame_protector_type,
-    nullptr, /* create_zero_copy_grpc_protector */
+    ssl_handshaker_result_create_zero_copy_grpc_protector,
     ssl_handshaker_result_create_frame_protector,
     ssl_handshaker_result_get_unused_bytes,
     ssl_handshaker_result_destroy,
@@ -1804,6 +2121,13 @@ tsi_result tsi_ssl_client_handshaker_factory_create_handshaker(
       ssl_bio_buf_size, &factory->base, handshaker);
 }
 
+tsi_ssl_client_handshaker_factory* tsi_ssl_client_handshaker_factory_ref(
+    tsi_ssl_client_handshaker_factory* factory) {
+  if (factory == nullptr) return nullptr;
+  tsi_ssl_handshaker_factory_ref(&factory->base);
+  return factory;
+}
+
 void tsi_ssl_client_handshaker_factory_unref(
     tsi_ssl_client_handshaker_factory* factory) {
   if (factory == nullptr) return;
@@ -1819,6 +2143,7 @@ static void tsi_ssl_client_handshaker_factory_destroy(
   if (self->alpn_protocol_list != nullptr) gpr_free(self->alpn_protocol_list);
   self->session_cache.reset();
   self->key_logger.reset();
+  tsi_ssl_verified_cert_cache_destroy(self->verified_cert_cache);
   gpr_free(self);
 }
 
@@ -1845,6 +2170,13 @@ tsi_result tsi_ssl_server_handshaker_factory_create_handshaker(
                                    &factory->base, handshaker);
 }
 
+tsi_ssl_server_handshaker_factory* tsi_ssl_server_handshaker_factory_ref(
+    tsi_ssl_server_handshaker_factory* factory) {
+  if (factory == nullptr) return nullptr;
+  tsi_ssl_handshaker_factory_ref(&factory->base);
+  return factory;
+}
+
 void tsi_ssl_server_handshaker_factory_unref(
     tsi_ssl_server_handshaker_factory* factory) {
   if (factory == nullptr) return;
@@ -2071,6 +2403,14 @@ tsi_result tsi_create_ssl_client_handshaker_factory_with_options(
     SSL_CTX_sess_set_new_cb(ssl_context,
                             server_handshaker_factory_new_session_callback);
     SSL_CTX_set_session_cache_mode(ssl_context, SSL_SESS_CACHE_CLIENT);
+#ifdef OPENSSL_IS_BORINGSSL
+    if (options->enable_client_early_data) {
+      /* Resumed TLS 1.3 sessions may then send the first flight of
+         application data as 0-RTT early data. See the caveats on
+         enable_client_early_data in ssl_transport_security.h. */
+      SSL_CTX_set_early_data_enabled(ssl_context, 1);
+    }
+#endif
   }
 
 #if OPENSSL_VERSION_NUMBER >= 0x10101000 && !defined(LIBRESSL_VERSION_NUMBER)
@@ -2142,6 +2482,19 @@ tsi_result tsi_create_ssl_client_handshaker_factory_with_options(
     SSL_CTX_set_verify(ssl_context, SSL_VERIFY_PEER, NullVerifyCallback);
   } else {
     SSL_CTX_set_verify(ssl_context, SSL_VERIFY_PEER, nullptr);
+    if (options->verified_cert_cache_ttl_secs > 0) {
+#if OPENSSL_VERSION_NUMBER >= 0x10100000
+      impl->verified_cert_cache = tsi_ssl_verified_cert_cache_create(
+          options->verified_cert_cache_ttl_secs);
+      SSL_CTX_set_cert_verify_callback(ssl_context,
+                                       tsi_ssl_verified_cert_cache_verify,
+                                       impl->verified_cert_cache);
+#else
+      gpr_log(GPR_INFO,
+              "verified certificate caching requires OpenSSL >= 1.1; "
+              "ignoring verified_cert_cache_ttl_secs.");
+#endif
+    }
   }
 
 #if OPENSSL_VERSION_NUMBER >= 0x10100000
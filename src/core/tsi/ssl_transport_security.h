@@ -179,6 +179,26 @@ struct tsi_ssl_client_handshaker_options {
      > 1.1 is supported for CRL checking*/
   const char* crl_directory;
 
+  /* verified_cert_cache_ttl_secs, if non-zero, enables a per-factory cache of
+     peer certificate chains that already passed full X509 verification. A
+     reconnect that presents a byte-identical chain within the TTL skips the
+     redundant signature checks; after the TTL expires the chain is verified
+     from scratch again. The cache is scoped to this factory (and thus to one
+     set of credentials), so chains are never shared across different root
+     configurations. Only OpenSSL version > 1.1 is supported; 0 (the default)
+     disables the cache. */
+  size_t verified_cert_cache_ttl_secs;
+
+  /* enable_client_early_data allows TLS 1.3 sessions resumed from
+     session_cache to negotiate 0-RTT early data, so the first flight of
+     application bytes rides with the ClientHello on reconnects. Only
+     supported with BoringSSL; ignored elsewhere. Callers must only enable
+     this when they can tolerate the 0-RTT caveats: early data is replayable
+     by an attacker, and a server that rejects it fails the connection (this
+     implementation does not retransmit rejected early data). Requires
+     session_cache to be set. Off by default. */
+  bool enable_client_early_data;
+
   tsi_ssl_client_handshaker_options()
       : pem_key_cert_pair(nullptr),
         pem_root_certs(nullptr),
@@ -191,7 +211,9 @@ struct tsi_ssl_client_handshaker_options {
         skip_server_certificate_verification(false),
         min_tls_version(tsi_tls_version::TSI_TLS1_2),
         max_tls_version(tsi_tls_version::TSI_TLS1_3),
-        crl_directory(nullptr) {}
+        crl_directory(nullptr),
+        verified_cert_cache_ttl_secs(0),
+        enable_client_early_data(false) {}
 };
 
 /* Creates a client handshaker factory.
@@ -220,6 +242,11 @@ tsi_result tsi_ssl_client_handshaker_factory_create_handshaker(
     const char* server_name_indication, size_t network_bio_buf_size,
     size_t ssl_bio_buf_size, tsi_handshaker** handshaker);
 
+/* Increments reference count of the handshaker factory. Returns factory for
+ * convenience. */
+tsi_ssl_client_handshaker_factory* tsi_ssl_client_handshaker_factory_ref(
+    tsi_ssl_client_handshaker_factory* factory);
+
 /* Decrements reference count of the handshaker factory. Handshaker factory will
  * be destroyed once no references exist. */
 void tsi_ssl_client_handshaker_factory_unref(
@@ -360,6 +387,11 @@ tsi_result tsi_ssl_server_handshaker_factory_create_handshaker(
     tsi_ssl_server_handshaker_factory* factory, size_t network_bio_buf_size,
     size_t ssl_bio_buf_size, tsi_handshaker** handshaker);
 
+/* Increments reference count of the handshaker factory. Returns factory for
+ * convenience. */
+tsi_ssl_server_handshaker_factory* tsi_ssl_server_handshaker_factory_ref(
+    tsi_ssl_server_handshaker_factory* factory);
+
 /* Decrements reference count of the handshaker factory. Handshaker factory will
  * be destroyed once no references exist. */
 void tsi_ssl_server_handshaker_factory_unref(
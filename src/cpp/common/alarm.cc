@@ -17,9 +17,14 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <atomic>
 #include <functional>
+#include <memory>
 #include <utility>
 
+#include "absl/status/status.h"
+
+#include <grpc/event_engine/event_engine.h>
 #include <grpc/impl/codegen/gpr_types.h>
 #include <grpc/impl/codegen/grpc_types.h>
 #include <grpc/support/log.h>
@@ -29,22 +34,27 @@
 #include <grpcpp/impl/codegen/completion_queue_tag.h>
 #include <grpcpp/impl/grpc_library.h>
 
+#include "src/core/lib/event_engine/default_event_engine.h"
 #include "src/core/lib/gprpp/time.h"
-#include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
-#include "src/core/lib/iomgr/executor.h"
-#include "src/core/lib/iomgr/timer.h"
 #include "src/core/lib/surface/completion_queue.h"
 
 namespace grpc {
 
 namespace internal {
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::GetDefaultEventEngine;
+
 class AlarmImpl : public grpc::internal::CompletionQueueTag {
  public:
-  AlarmImpl() : cq_(nullptr), tag_(nullptr) {
+  // The EventEngine is acquired once at construction and kept for the
+  // lifetime of the alarm: rearming is a Cancel + RunAfter pair on this
+  // same object, with no per-Set state allocated here.
+  AlarmImpl()
+      : event_engine_(GetDefaultEventEngine()), cq_(nullptr), tag_(nullptr) {
     gpr_ref_init(&refs_, 1);
-    grpc_timer_init_unset(&timer_);
   }
   ~AlarmImpl() override {}
   bool FinalizeResult(void** tag, bool* /*status*/) override {
@@ -59,55 +69,39 @@ class AlarmImpl : public grpc::internal::CompletionQueueTag {
     cq_ = cq->cq();
     tag_ = tag;
     GPR_ASSERT(grpc_cq_begin_op(cq_, this));
-    GRPC_CLOSURE_INIT(
-        &on_alarm_,
-        [](void* arg, grpc_error_handle error) {
-          // queue the op on the completion queue
-          AlarmImpl* alarm = static_cast<AlarmImpl*>(arg);
-          alarm->Ref();
-          // Preserve the cq and reset the cq_ so that the alarm
-          // can be reset when the alarm tag is delivered.
-          grpc_completion_queue* cq = alarm->cq_;
-          alarm->cq_ = nullptr;
-          grpc_cq_end_op(
-              cq, alarm, error,
-              [](void* /*arg*/, grpc_cq_completion* /*completion*/) {}, arg,
-              &alarm->completion_);
-          GRPC_CQ_INTERNAL_UNREF(cq, "alarm");
-        },
-        this, grpc_schedule_on_exec_ctx);
-    grpc_timer_init(&timer_,
-                    grpc_core::Timestamp::FromTimespecRoundUp(deadline),
-                    &on_alarm_);
+    Ref();
+    GPR_ASSERT(!cq_armed_.exchange(true));
+    timer_handle_ = event_engine_->RunAfter(
+        grpc_core::Timestamp::FromTimespecRoundUp(deadline) -
+            grpc_core::ExecCtx::Get()->Now(),
+        [this] { OnCQAlarm(absl::OkStatus()); });
   }
   void Set(gpr_timespec deadline, std::function<void(bool)> f) {
     grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
     grpc_core::ExecCtx exec_ctx;
-    // Don't use any CQ at all. Instead just use the timer to fire the function
+    // Don't use any CQ at all. Instead just deliver the callback on the
+    // EventEngine thread that fires the timer.
     callback_ = std::move(f);
     Ref();
-    GRPC_CLOSURE_INIT(
-        &on_alarm_,
-        [](void* arg, grpc_error_handle error) {
-          grpc_core::Executor::Run(GRPC_CLOSURE_CREATE(
-                                       [](void* arg, grpc_error_handle error) {
-                                         AlarmImpl* alarm =
-                                             static_cast<AlarmImpl*>(arg);
-                                         alarm->callback_(error.ok());
-                                         alarm->Unref();
-                                       },
-                                       arg, nullptr),
-                                   error);
-        },
-        this, grpc_schedule_on_exec_ctx);
-    grpc_timer_init(&timer_,
-                    grpc_core::Timestamp::FromTimespecRoundUp(deadline),
-                    &on_alarm_);
+    GPR_ASSERT(!callback_armed_.exchange(true));
+    timer_handle_ = event_engine_->RunAfter(
+        grpc_core::Timestamp::FromTimespecRoundUp(deadline) -
+            grpc_core::ExecCtx::Get()->Now(),
+        [this] { OnCallbackAlarm(/*is_ok=*/true); });
   }
   void Cancel() {
     grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
     grpc_core::ExecCtx exec_ctx;
-    grpc_timer_cancel(&timer_);
+    if (event_engine_->Cancel(timer_handle_)) {
+      // The expiry callback will never run; deliver the cancellation
+      // ourselves, off this thread so Cancel never runs user code inline.
+      if (callback_armed_.load()) {
+        event_engine_->Run([this] { OnCallbackAlarm(/*is_ok=*/false); });
+      }
+      if (cq_armed_.load()) {
+        event_engine_->Run([this] { OnCQAlarm(absl::CancelledError()); });
+      }
+    }
   }
   void Destroy() {
     Cancel();
@@ -115,6 +109,29 @@ class AlarmImpl : public grpc::internal::CompletionQueueTag {
   }
 
  private:
+  void OnCQAlarm(grpc_error_handle error) {
+    GPR_ASSERT(cq_armed_.exchange(false));
+    grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
+    grpc_core::ExecCtx exec_ctx;
+    // Preserve the cq and reset cq_ so that the alarm can be re-Set once
+    // the tag is delivered.
+    grpc_completion_queue* cq = cq_;
+    cq_ = nullptr;
+    grpc_cq_end_op(
+        cq, this, error,
+        [](void* /*arg*/, grpc_cq_completion* /*completion*/) {}, nullptr,
+        &completion_);
+    GRPC_CQ_INTERNAL_UNREF(cq, "alarm");
+  }
+
+  void OnCallbackAlarm(bool is_ok) {
+    GPR_ASSERT(callback_armed_.exchange(false));
+    grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
+    grpc_core::ExecCtx exec_ctx;
+    callback_(is_ok);
+    Unref();
+  }
+
   void Ref() { gpr_ref(&refs_); }
   void Unref() {
     if (gpr_unref(&refs_)) {
@@ -122,9 +139,12 @@ class AlarmImpl : public grpc::internal::CompletionQueueTag {
     }
   }
 
-  grpc_timer timer_;
+  std::shared_ptr<EventEngine> event_engine_;
+  // The most recently armed timer; reused (overwritten) on every Set.
+  EventEngine::TaskHandle timer_handle_{-1, -1};
+  std::atomic<bool> cq_armed_{false};
+  std::atomic<bool> callback_armed_{false};
   gpr_refcount refs_;
-  grpc_closure on_alarm_;
   grpc_cq_completion completion_;
   // completion queue where events about this alarm will be posted
   grpc_completion_queue* cq_;
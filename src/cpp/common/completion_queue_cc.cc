@@ -15,6 +15,7 @@
  *
  */
 
+#include <algorithm>
 #include <vector>
 
 #include "absl/base/thread_annotations.h"
@@ -167,6 +168,37 @@ CompletionQueue::NextStatus CompletionQueue::AsyncNextInternal(
   }
 }
 
+CompletionQueue::NextStatus CompletionQueue::AsyncNextBatchInternal(
+    void** tags, bool* oks, size_t max_events, size_t* num_events,
+    gpr_timespec deadline) {
+  // Harvest into a fixed-size chunk of raw events; FinalizeResult may consume
+  // some events internally, so loop until at least one surfaces (or the queue
+  // times out / shuts down).
+  static constexpr size_t kEventChunkSize = 64;
+  grpc_event events[kEventChunkSize];
+  *num_events = 0;
+  for (;;) {
+    size_t n = grpc_completion_queue_next_batch(
+        cq_, events, std::min(max_events, kEventChunkSize), deadline, nullptr);
+    GPR_ASSERT(n >= 1);
+    // A batch is either all completions or a single status event.
+    if (events[0].type == GRPC_QUEUE_TIMEOUT) return TIMEOUT;
+    if (events[0].type == GRPC_QUEUE_SHUTDOWN) return SHUTDOWN;
+    for (size_t i = 0; i < n; i++) {
+      auto core_cq_tag =
+          static_cast<grpc::internal::CompletionQueueTag*>(events[i].tag);
+      bool ok = events[i].success != 0;
+      void* tag = core_cq_tag;
+      if (core_cq_tag->FinalizeResult(&tag, &ok)) {
+        tags[*num_events] = tag;
+        oks[*num_events] = ok;
+        ++*num_events;
+      }
+    }
+    if (*num_events > 0) return GOT_EVENT;
+  }
+}
+
 CompletionQueue::CompletionQueueTLSCache::CompletionQueueTLSCache(
     CompletionQueue* cq)
     : cq_(cq), flushed_(false) {
@@ -57,6 +57,7 @@
 #include "src/cpp/ext/filters/census/context.h"
 #include "src/cpp/ext/filters/census/grpc_plugin.h"
 #include "src/cpp/ext/filters/census/measures.h"
+#include "src/cpp/ext/filters/census/stats_buffer.h"
 
 namespace grpc {
 
@@ -71,9 +72,11 @@ constexpr uint32_t
 
 grpc_error_handle CensusClientChannelData::Init(
     grpc_channel_element* /*elem*/, grpc_channel_element_args* args) {
-  tracing_enabled_ = grpc_core::ChannelArgs::FromC(args->channel_args)
-                         .GetInt(GRPC_ARG_ENABLE_OBSERVABILITY)
-                         .value_or(true);
+  grpc_core::ChannelArgs channel_args =
+      grpc_core::ChannelArgs::FromC(args->channel_args);
+  tracing_enabled_ =
+      channel_args.GetInt(GRPC_ARG_ENABLE_OBSERVABILITY).value_or(true);
+  sampler_ = channel_args.GetObjectRef<grpc_core::CallTracerSampler>();
   return GRPC_ERROR_NONE;
 }
 
@@ -83,6 +86,12 @@ grpc_error_handle CensusClientChannelData::Init(
 
 grpc_error_handle CensusClientChannelData::CensusClientCallData::Init(
     grpc_call_element* elem, const grpc_call_element_args* args) {
+  auto* chand = static_cast<CensusClientChannelData*>(elem->channel_data);
+  // Sampling decision happens here, before any tracer state exists: an
+  // unsampled call carries no tracer at all and pays nothing further.
+  if (chand->sampler_ != nullptr && !chand->sampler_->ShouldSample()) {
+    return absl::OkStatus();
+  }
   tracer_ = args->arena->New<OpenCensusCallTracer>(
       args, (static_cast<CensusClientChannelData*>(elem->channel_data))
                 ->tracing_enabled_);
@@ -101,7 +110,7 @@ void CensusClientChannelData::CensusClientCallData::StartTransportStreamOpBatch(
   // `grpc_census_call_set_context` which allows the application to set the
   // census context for a call anytime before the first call to
   // `grpc_call_start_batch`.
-  if (op->op()->send_initial_metadata &&
+  if (op->op()->send_initial_metadata && tracer_ != nullptr &&
       (static_cast<CensusClientChannelData*>(elem->channel_data))
           ->tracing_enabled_) {
     tracer_->GenerateContext();
@@ -127,7 +136,11 @@ OpenCensusCallTracer::OpenCensusCallAttemptTracer::OpenCensusCallAttemptTracer(
   std::vector<std::pair<opencensus::tags::TagKey, std::string>> tags =
       context_.tags().tags();
   tags.emplace_back(ClientMethodTagKey(), std::string(parent_->method_));
-  ::opencensus::stats::Record({{RpcClientStartedRpcs(), 1}}, tags);
+  if (CensusStatsBufferingEnabled()) {
+    RecordBuffered({{RpcMeasure::kClientStartedRpcs, 1}}, std::move(tags));
+  } else {
+    ::opencensus::stats::Record({{RpcClientStartedRpcs(), 1}}, tags);
+  }
 }
 
 void OpenCensusCallTracer::OpenCensusCallAttemptTracer::
@@ -190,14 +203,25 @@ void OpenCensusCallTracer::OpenCensusCallAttemptTracer::
   tags.emplace_back(ClientMethodTagKey(), std::string(parent_->method_));
   std::string final_status = absl::StatusCodeToString(status_code_);
   tags.emplace_back(ClientStatusTagKey(), final_status);
-  ::opencensus::stats::Record(
-      {{RpcClientSentBytesPerRpc(),
-        static_cast<double>(transport_stream_stats->outgoing.data_bytes)},
-       {RpcClientReceivedBytesPerRpc(),
-        static_cast<double>(transport_stream_stats->incoming.data_bytes)},
-       {RpcClientServerLatency(),
-        ToDoubleMilliseconds(absl::Nanoseconds(elapsed_time))}},
-      tags);
+  if (CensusStatsBufferingEnabled()) {
+    RecordBuffered(
+        {{RpcMeasure::kClientSentBytesPerRpc,
+          static_cast<double>(transport_stream_stats->outgoing.data_bytes)},
+         {RpcMeasure::kClientReceivedBytesPerRpc,
+          static_cast<double>(transport_stream_stats->incoming.data_bytes)},
+         {RpcMeasure::kClientServerLatency,
+          ToDoubleMilliseconds(absl::Nanoseconds(elapsed_time))}},
+        std::move(tags));
+  } else {
+    ::opencensus::stats::Record(
+        {{RpcClientSentBytesPerRpc(),
+          static_cast<double>(transport_stream_stats->outgoing.data_bytes)},
+         {RpcClientReceivedBytesPerRpc(),
+          static_cast<double>(transport_stream_stats->incoming.data_bytes)},
+         {RpcClientServerLatency(),
+          ToDoubleMilliseconds(absl::Nanoseconds(elapsed_time))}},
+        tags);
+  }
 }
 
 void OpenCensusCallTracer::OpenCensusCallAttemptTracer::RecordCancel(
@@ -212,11 +236,20 @@ void OpenCensusCallTracer::OpenCensusCallAttemptTracer::RecordEnd(
       context_.tags().tags();
   tags.emplace_back(ClientMethodTagKey(), std::string(parent_->method_));
   tags.emplace_back(ClientStatusTagKey(), StatusCodeToString(status_code_));
-  ::opencensus::stats::Record(
-      {{RpcClientRoundtripLatency(), latency_ms},
-       {RpcClientSentMessagesPerRpc(), sent_message_count_},
-       {RpcClientReceivedMessagesPerRpc(), recv_message_count_}},
-      tags);
+  if (CensusStatsBufferingEnabled()) {
+    RecordBuffered({{RpcMeasure::kClientRoundtripLatency, latency_ms},
+                    {RpcMeasure::kClientSentMessagesPerRpc,
+                     static_cast<double>(sent_message_count_)},
+                    {RpcMeasure::kClientReceivedMessagesPerRpc,
+                     static_cast<double>(recv_message_count_)}},
+                   std::move(tags));
+  } else {
+    ::opencensus::stats::Record(
+        {{RpcClientRoundtripLatency(), latency_ms},
+         {RpcClientSentMessagesPerRpc(), sent_message_count_},
+         {RpcClientReceivedMessagesPerRpc(), recv_message_count_}},
+        tags);
+  }
   if (parent_->tracing_enabled_) {
     if (status_code_ != absl::StatusCode::kOk) {
       context_.Span().SetStatus(opencensus::trace::StatusCode(status_code_),
@@ -251,11 +284,22 @@ OpenCensusCallTracer::~OpenCensusCallTracer() {
   std::vector<std::pair<opencensus::tags::TagKey, std::string>> tags =
       context_.tags().tags();
   tags.emplace_back(ClientMethodTagKey(), std::string(method_));
-  ::opencensus::stats::Record(
-      {{RpcClientRetriesPerCall(), retries_ - 1},  // exclude first attempt
-       {RpcClientTransparentRetriesPerCall(), transparent_retries_},
-       {RpcClientRetryDelayPerCall(), ToDoubleMilliseconds(retry_delay_)}},
-      tags);
+  if (CensusStatsBufferingEnabled()) {
+    RecordBuffered(
+        {{RpcMeasure::kClientRetriesPerCall,
+          static_cast<double>(retries_ - 1)},  // exclude first attempt
+         {RpcMeasure::kClientTransparentRetriesPerCall,
+          static_cast<double>(transparent_retries_)},
+         {RpcMeasure::kClientRetryDelayPerCall,
+          ToDoubleMilliseconds(retry_delay_)}},
+        std::move(tags));
+  } else {
+    ::opencensus::stats::Record(
+        {{RpcClientRetriesPerCall(), retries_ - 1},  // exclude first attempt
+         {RpcClientTransparentRetriesPerCall(), transparent_retries_},
+         {RpcClientRetryDelayPerCall(), ToDoubleMilliseconds(retry_delay_)}},
+        tags);
+  }
   if (tracing_enabled_) {
     context_.EndSpan();
   }
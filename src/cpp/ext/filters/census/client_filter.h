@@ -21,6 +21,9 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <memory>
+
+#include "src/core/lib/channel/call_tracer_sampler.h"
 #include "src/core/lib/channel/channel_fwd.h"
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/iomgr/error.h"
@@ -51,6 +54,9 @@ class CensusClientChannelData : public ChannelData {
 
  private:
   bool tracing_enabled_ = true;
+  // When set (via GRPC_ARG_CALL_TRACER_SAMPLER), decides per call whether a
+  // tracer is attached at all; unsampled calls skip tracer construction.
+  std::shared_ptr<grpc_core::CallTracerSampler> sampler_;
 };
 
 }  // namespace grpc
@@ -36,6 +36,7 @@
 #include "src/cpp/ext/filters/census/context.h"
 #include "src/cpp/ext/filters/census/measures.h"
 #include "src/cpp/ext/filters/census/server_filter.h"
+#include "src/cpp/ext/filters/census/stats_buffer.h"
 
 namespace grpc {
 
@@ -69,6 +70,14 @@ void RegisterOpenCensusPlugin() {
   RpcServerReceivedMessagesPerRpc();
 }
 
+namespace experimental {
+
+void EnableOpenCensusStatsBuffering() {
+  grpc::internal::EnableCensusStatsBuffering();
+}
+
+}  // namespace experimental
+
 ::opencensus::trace::Span GetSpanFromServerContext(
     grpc::ServerContext* context) {
   if (context == nullptr) return opencensus::trace::Span::BlankSpan();
@@ -40,6 +40,7 @@
 #include "src/cpp/ext/filters/census/channel_filter.h"
 #include "src/cpp/ext/filters/census/grpc_plugin.h"
 #include "src/cpp/ext/filters/census/measures.h"
+#include "src/cpp/ext/filters/census/stats_buffer.h"
 
 namespace grpc {
 
@@ -107,8 +108,14 @@ void CensusServerCallData::OnDoneRecvInitialMetadataCb(
                           calld->qualified_method_, &calld->context_);
     grpc_census_call_set_context(
         calld->gc_, reinterpret_cast<census_context*>(&calld->context_));
-    ::opencensus::stats::Record({{RpcServerStartedRpcs(), 1}},
-                                {{ServerMethodTagKey(), calld->method_}});
+    if (CensusStatsBufferingEnabled()) {
+      RecordBuffered(
+          {{RpcMeasure::kServerStartedRpcs, 1}},
+          {{ServerMethodTagKey(), std::string(calld->method_)}});
+    } else {
+      ::opencensus::stats::Record({{RpcServerStartedRpcs(), 1}},
+                                  {{ServerMethodTagKey(), calld->method_}});
+    }
   }
   grpc_core::Closure::Run(DEBUG_LOCATION,
                           calld->initial_on_done_recv_initial_metadata_, error);
@@ -168,14 +175,29 @@ void CensusServerCallData::Destroy(grpc_call_element* /*elem*/,
   const uint64_t response_size = GetIncomingDataSize(final_info);
   double elapsed_time_ms = absl::ToDoubleMilliseconds(elapsed_time_);
   grpc_auth_context_release(auth_context_);
-  ::opencensus::stats::Record(
-      {{RpcServerSentBytesPerRpc(), static_cast<double>(response_size)},
-       {RpcServerReceivedBytesPerRpc(), static_cast<double>(request_size)},
-       {RpcServerServerLatency(), elapsed_time_ms},
-       {RpcServerSentMessagesPerRpc(), sent_message_count_},
-       {RpcServerReceivedMessagesPerRpc(), recv_message_count_}},
-      {{ServerMethodTagKey(), method_},
-       {ServerStatusTagKey(), StatusCodeToString(final_info->final_status)}});
+  if (CensusStatsBufferingEnabled()) {
+    RecordBuffered(
+        {{RpcMeasure::kServerSentBytesPerRpc,
+          static_cast<double>(response_size)},
+         {RpcMeasure::kServerReceivedBytesPerRpc,
+          static_cast<double>(request_size)},
+         {RpcMeasure::kServerServerLatency, elapsed_time_ms},
+         {RpcMeasure::kServerSentMessagesPerRpc,
+          static_cast<double>(sent_message_count_)},
+         {RpcMeasure::kServerReceivedMessagesPerRpc,
+          static_cast<double>(recv_message_count_)}},
+        {{ServerMethodTagKey(), std::string(method_)},
+         {ServerStatusTagKey(), StatusCodeToString(final_info->final_status)}});
+  } else {
+    ::opencensus::stats::Record(
+        {{RpcServerSentBytesPerRpc(), static_cast<double>(response_size)},
+         {RpcServerReceivedBytesPerRpc(), static_cast<double>(request_size)},
+         {RpcServerServerLatency(), elapsed_time_ms},
+         {RpcServerSentMessagesPerRpc(), sent_message_count_},
+         {RpcServerReceivedMessagesPerRpc(), recv_message_count_}},
+        {{ServerMethodTagKey(), method_},
+         {ServerStatusTagKey(), StatusCodeToString(final_info->final_status)}});
+  }
   context_.EndSpan();
 }
 
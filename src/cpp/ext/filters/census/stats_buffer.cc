@@ -0,0 +1,219 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/cpp/ext/filters/census/stats_buffer.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/inlined_vector.h"
+#include "opencensus/stats/stats.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/gprpp/per_cpu.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/cpp/ext/filters/census/measures.h"
+
+namespace grpc {
+
+namespace {
+
+// How long a measurement may sit in a CPU's buffer before it reaches the
+// opencensus stats maps.
+constexpr std::chrono::milliseconds kFlushInterval{100};
+
+std::atomic<bool> g_buffering_enabled{false};
+
+// Replays one buffered measurement into opencensus. Integer measures take
+// their value back as int64; it was only widened to double for the buffer.
+void RecordToOpenCensus(
+    const BufferedMeasurement& m,
+    const std::vector<std::pair<::opencensus::tags::TagKey, std::string>>&
+        tags) {
+  switch (m.measure) {
+    case RpcMeasure::kClientStartedRpcs:
+      ::opencensus::stats::Record(
+          {{RpcClientStartedRpcs(), static_cast<int64_t>(m.value)}}, tags);
+      break;
+    case RpcMeasure::kClientSentMessagesPerRpc:
+      ::opencensus::stats::Record(
+          {{RpcClientSentMessagesPerRpc(), static_cast<int64_t>(m.value)}},
+          tags);
+      break;
+    case RpcMeasure::kClientSentBytesPerRpc:
+      ::opencensus::stats::Record({{RpcClientSentBytesPerRpc(), m.value}},
+                                  tags);
+      break;
+    case RpcMeasure::kClientReceivedMessagesPerRpc:
+      ::opencensus::stats::Record(
+          {{RpcClientReceivedMessagesPerRpc(), static_cast<int64_t>(m.value)}},
+          tags);
+      break;
+    case RpcMeasure::kClientReceivedBytesPerRpc:
+      ::opencensus::stats::Record({{RpcClientReceivedBytesPerRpc(), m.value}},
+                                  tags);
+      break;
+    case RpcMeasure::kClientRoundtripLatency:
+      ::opencensus::stats::Record({{RpcClientRoundtripLatency(), m.value}},
+                                  tags);
+      break;
+    case RpcMeasure::kClientServerLatency:
+      ::opencensus::stats::Record({{RpcClientServerLatency(), m.value}}, tags);
+      break;
+    case RpcMeasure::kClientRetriesPerCall:
+      ::opencensus::stats::Record(
+          {{RpcClientRetriesPerCall(), static_cast<int64_t>(m.value)}}, tags);
+      break;
+    case RpcMeasure::kClientTransparentRetriesPerCall:
+      ::opencensus::stats::Record({{RpcClientTransparentRetriesPerCall(),
+                                    static_cast<int64_t>(m.value)}},
+                                  tags);
+      break;
+    case RpcMeasure::kClientRetryDelayPerCall:
+      ::opencensus::stats::Record({{RpcClientRetryDelayPerCall(), m.value}},
+                                  tags);
+      break;
+    case RpcMeasure::kServerStartedRpcs:
+      ::opencensus::stats::Record(
+          {{RpcServerStartedRpcs(), static_cast<int64_t>(m.value)}}, tags);
+      break;
+    case RpcMeasure::kServerSentMessagesPerRpc:
+      ::opencensus::stats::Record(
+          {{RpcServerSentMessagesPerRpc(), static_cast<int64_t>(m.value)}},
+          tags);
+      break;
+    case RpcMeasure::kServerSentBytesPerRpc:
+      ::opencensus::stats::Record({{RpcServerSentBytesPerRpc(), m.value}},
+                                  tags);
+      break;
+    case RpcMeasure::kServerReceivedMessagesPerRpc:
+      ::opencensus::stats::Record(
+          {{RpcServerReceivedMessagesPerRpc(), static_cast<int64_t>(m.value)}},
+          tags);
+      break;
+    case RpcMeasure::kServerReceivedBytesPerRpc:
+      ::opencensus::stats::Record({{RpcServerReceivedBytesPerRpc(), m.value}},
+                                  tags);
+      break;
+    case RpcMeasure::kServerServerLatency:
+      ::opencensus::stats::Record({{RpcServerServerLatency(), m.value}}, tags);
+      break;
+  }
+}
+
+class StatsBuffer {
+ public:
+  static StatsBuffer* Get() {
+    static StatsBuffer* buffer = new StatsBuffer;
+    return buffer;
+  }
+
+  void Record(
+      std::initializer_list<BufferedMeasurement> measurements,
+      std::vector<std::pair<::opencensus::tags::TagKey, std::string>> tags) {
+    Shard& shard = shards_.this_cpu();
+    {
+      grpc_core::MutexLock lock(&shard.mu);
+      shard.pending.emplace_back();
+      PendingRecord& record = shard.pending.back();
+      record.measurements.assign(measurements.begin(), measurements.end());
+      record.tags = std::move(tags);
+    }
+    MaybeScheduleFlush();
+  }
+
+  void Flush() {
+    for (Shard& shard : shards_) {
+      std::vector<PendingRecord> drained;
+      {
+        grpc_core::MutexLock lock(&shard.mu);
+        drained.swap(shard.pending);
+      }
+      for (const PendingRecord& record : drained) {
+        for (const BufferedMeasurement& m : record.measurements) {
+          RecordToOpenCensus(m, record.tags);
+        }
+      }
+    }
+  }
+
+ private:
+  struct PendingRecord {
+    // The filters record at most five measurements at a time.
+    absl::InlinedVector<BufferedMeasurement, 5> measurements;
+    std::vector<std::pair<::opencensus::tags::TagKey, std::string>> tags;
+  };
+
+  struct Shard {
+    grpc_core::Mutex mu;
+    std::vector<PendingRecord> pending ABSL_GUARDED_BY(mu);
+  };
+
+  StatsBuffer()
+      : engine_(grpc_event_engine::experimental::GetDefaultEventEngine()) {}
+
+  void MaybeScheduleFlush() {
+    {
+      grpc_core::MutexLock lock(&timer_mu_);
+      if (flush_scheduled_) return;
+      flush_scheduled_ = true;
+    }
+    engine_->RunAfter(kFlushInterval, [this] {
+      // Clear the flag before draining: a measurement recorded while we
+      // flush re-arms the timer and is picked up next period at the latest.
+      {
+        grpc_core::MutexLock lock(&timer_mu_);
+        flush_scheduled_ = false;
+      }
+      Flush();
+    });
+  }
+
+  grpc_core::PerCpu<Shard> shards_;
+  std::shared_ptr<grpc_event_engine::experimental::EventEngine> engine_;
+  grpc_core::Mutex timer_mu_;
+  bool flush_scheduled_ ABSL_GUARDED_BY(timer_mu_) = false;
+};
+
+}  // namespace
+
+bool CensusStatsBufferingEnabled() {
+  return g_buffering_enabled.load(std::memory_order_relaxed);
+}
+
+void RecordBuffered(
+    std::initializer_list<BufferedMeasurement> measurements,
+    std::vector<std::pair<::opencensus::tags::TagKey, std::string>> tags) {
+  StatsBuffer::Get()->Record(measurements, std::move(tags));
+}
+
+void FlushCensusStatsBuffers() {
+  if (!CensusStatsBufferingEnabled()) return;
+  StatsBuffer::Get()->Flush();
+}
+
+namespace internal {
+
+void EnableCensusStatsBuffering() {
+  g_buffering_enabled.store(true, std::memory_order_relaxed);
+}
+
+}  // namespace internal
+}  // namespace grpc
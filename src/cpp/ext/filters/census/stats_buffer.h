@@ -0,0 +1,88 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_INTERNAL_CPP_EXT_FILTERS_CENSUS_STATS_BUFFER_H
+#define GRPC_INTERNAL_CPP_EXT_FILTERS_CENSUS_STATS_BUFFER_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stdint.h>
+
+#include <initializer_list>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "opencensus/tags/tag_key.h"
+
+namespace grpc {
+
+// Identifies one of the RPC measures in measures.h without touching the
+// measure itself, so that a measurement can be carried in a buffer and
+// recorded later.
+enum class RpcMeasure : uint8_t {
+  kClientStartedRpcs,
+  kClientSentMessagesPerRpc,
+  kClientSentBytesPerRpc,
+  kClientReceivedMessagesPerRpc,
+  kClientReceivedBytesPerRpc,
+  kClientRoundtripLatency,
+  kClientServerLatency,
+  kClientRetriesPerCall,
+  kClientTransparentRetriesPerCall,
+  kClientRetryDelayPerCall,
+  kServerStartedRpcs,
+  kServerSentMessagesPerRpc,
+  kServerSentBytesPerRpc,
+  kServerReceivedMessagesPerRpc,
+  kServerReceivedBytesPerRpc,
+  kServerServerLatency,
+};
+
+// One measurement destined for \a measure. Values for integer measures are
+// converted back to int64 when the buffer is flushed.
+struct BufferedMeasurement {
+  RpcMeasure measure;
+  double value;
+};
+
+// Returns true if measurements should go through RecordBuffered() instead of
+// directly into ::opencensus::stats::Record(). Enabled (irreversibly) by
+// grpc::experimental::EnableOpenCensusStatsBuffering().
+bool CensusStatsBufferingEnabled();
+
+// Appends measurements to the calling CPU's buffer. A periodic timer drains
+// the buffers into ::opencensus::stats::Record(), so the cost of the
+// contended opencensus stats maps is paid once per flush instead of once per
+// RPC. View data lags recording by up to the flush interval; the samples
+// themselves are recorded exactly as given, so distribution aggregations are
+// unaffected.
+void RecordBuffered(
+    std::initializer_list<BufferedMeasurement> measurements,
+    std::vector<std::pair<::opencensus::tags::TagKey, std::string>> tags);
+
+// Drains every CPU's buffer synchronously. Invoked by the flush timer, and
+// usable directly by anyone who needs up-to-date view data (e.g. tests).
+// No-op if buffering is not enabled.
+void FlushCensusStatsBuffers();
+
+namespace internal {
+
+// Implementation of grpc::experimental::EnableOpenCensusStatsBuffering().
+void EnableCensusStatsBuffering();
+
+}  // namespace internal
+}  // namespace grpc
+
+#endif  // GRPC_INTERNAL_CPP_EXT_FILTERS_CENSUS_STATS_BUFFER_H
@@ -35,6 +35,7 @@
 
 #include <grpc/support/log.h>
 
+#include "src/core/ext/filters/load_reporting/server_load_reporting_filter.h"
 #include "src/cpp/server/load_reporter/constants.h"
 #include "src/cpp/server/load_reporter/get_cpu_stats.h"
 
@@ -204,6 +205,10 @@ CensusViewProviderDefaultImpl::CensusViewProviderDefaultImpl() {
 
 CensusViewProvider::ViewDataMap CensusViewProviderDefaultImpl::FetchViewData() {
   gpr_log(GPR_DEBUG, "[CVP %p] Starts fetching Census view data.", this);
+  // Merge the load reporting filter's per-CPU call counters into the
+  // measures before snapshotting the views, so this report sees every call
+  // recorded up to now.
+  grpc_core::FlushServerLoadReportingCounters();
   ViewDataMap view_data_map;
   for (auto& p : view_map_) {
     const std::string& view_name = p.first;
@@ -0,0 +1,92 @@
+/*
+ *
+ * Copyright 2022 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <grpc/support/port_platform.h>
+
+#include "src/cpp/server/numa_placement.h"
+
+#ifdef GPR_LINUX
+#include <stdio.h>
+#include <stdlib.h>
+#endif
+
+namespace grpc {
+namespace internal {
+
+#ifdef GPR_LINUX
+
+namespace {
+
+// Parse a sysfs cpulist such as "0-7,16-23" into individual CPU numbers.
+// Returns false on malformed input.
+bool ParseCpuList(const char* list, std::vector<int>* cpus) {
+  const char* p = list;
+  while (*p != '\0' && *p != '\n') {
+    char* end;
+    long first = strtol(p, &end, 10);
+    if (end == p || first < 0) return false;
+    long last = first;
+    p = end;
+    if (*p == '-') {
+      p++;
+      last = strtol(p, &end, 10);
+      if (end == p || last < first) return false;
+      p = end;
+    }
+    for (long cpu = first; cpu <= last; cpu++) {
+      cpus->push_back(static_cast<int>(cpu));
+    }
+    if (*p == ',') p++;
+  }
+  return true;
+}
+
+}  // namespace
+
+NumaTopology DetectNumaTopology() {
+  NumaTopology topology;
+  for (int node = 0;; node++) {
+    char path[128];
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist",
+             node);
+    FILE* f = fopen(path, "r");
+    if (f == nullptr) break;
+    char buf[1024];
+    std::vector<int> cpus;
+    if (fgets(buf, sizeof(buf), f) != nullptr && ParseCpuList(buf, &cpus) &&
+        !cpus.empty()) {
+      topology.node_cpus.push_back(std::move(cpus));
+      fclose(f);
+    } else {
+      fclose(f);
+      return NumaTopology();
+    }
+  }
+  // A single node offers nothing to place across.
+  if (topology.node_cpus.size() < 2) return NumaTopology();
+  return topology;
+}
+
+#else  // !GPR_LINUX
+
+NumaTopology DetectNumaTopology() { return NumaTopology(); }
+
+#endif  // GPR_LINUX
+
+}  // namespace internal
+}  // namespace grpc
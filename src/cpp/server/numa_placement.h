@@ -0,0 +1,41 @@
+/*
+ *
+ * Copyright 2022 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_INTERNAL_CPP_SERVER_NUMA_PLACEMENT_H
+#define GRPC_INTERNAL_CPP_SERVER_NUMA_PLACEMENT_H
+
+#include <vector>
+
+namespace grpc {
+namespace internal {
+
+/// CPU topology of the machine: one entry per NUMA node, each listing the
+/// CPUs owned by that node.
+struct NumaTopology {
+  std::vector<std::vector<int>> node_cpus;
+};
+
+/// Read the NUMA topology from the OS (sysfs). Returns an empty topology on
+/// non-Linux platforms, on single-node machines, or if the topology cannot be
+/// determined; callers should not pin in that case.
+NumaTopology DetectNumaTopology();
+
+}  // namespace internal
+}  // namespace grpc
+
+#endif  // GRPC_INTERNAL_CPP_SERVER_NUMA_PLACEMENT_H
@@ -0,0 +1,39 @@
+/*
+ *
+ * Copyright 2022 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <memory>
+#include <vector>
+
+#include <grpc/impl/codegen/grpc_types.h>
+#include <grpcpp/ext/numa_placement_server_builder_option.h>
+#include <grpcpp/impl/server_builder_plugin.h>
+#include <grpcpp/support/channel_arguments.h>
+
+namespace grpc {
+
+NumaPlacementServerBuilderOption::NumaPlacementServerBuilderOption(bool enabled)
+    : enabled_(enabled) {}
+
+void NumaPlacementServerBuilderOption::UpdateArguments(ChannelArguments* args) {
+  args->SetInt(GRPC_ARG_SERVER_NUMA_PLACEMENT, enabled_ ? 1 : 0);
+}
+
+void NumaPlacementServerBuilderOption::UpdatePlugins(
+    std::vector<std::unique_ptr<ServerBuilderPlugin>>* /*plugins*/) {}
+
+}  // namespace grpc
@@ -78,6 +78,7 @@
 #include "src/cpp/client/create_channel_internal.h"
 #include "src/cpp/server/external_connection_acceptor_impl.h"
 #include "src/cpp/server/health/default_health_check_service.h"
+#include "src/cpp/server/numa_placement.h"
 #include "src/cpp/thread_manager/thread_manager.h"
 
 namespace grpc {
@@ -907,10 +908,36 @@ Server::Server(
       default_rq_created = true;
     }
 
+    // If NUMA placement was requested, distribute the completion queues
+    // across nodes round robin and pin each queue's pollers to the CPUs of
+    // the node owning the queue.
+    grpc::internal::NumaTopology numa_topology;
+    {
+      grpc_channel_args numa_probe_args;
+      args->SetChannelArgs(&numa_probe_args);
+      for (size_t i = 0; i < numa_probe_args.num_args; i++) {
+        if (0 == strcmp(numa_probe_args.args[i].key,
+                        GRPC_ARG_SERVER_NUMA_PLACEMENT) &&
+            numa_probe_args.args[i].type == GRPC_ARG_INTEGER &&
+            numa_probe_args.args[i].value.integer != 0) {
+          numa_topology = grpc::internal::DetectNumaTopology();
+          break;
+        }
+      }
+    }
+
+    size_t cq_index = 0;
     for (const auto& it : *sync_server_cqs_) {
-      sync_req_mgrs_.emplace_back(new SyncRequestThreadManager(
+      auto* manager = new SyncRequestThreadManager(
           this, it.get(), global_callbacks_, server_rq, min_pollers,
-          max_pollers, sync_cq_timeout_msec));
+          max_pollers, sync_cq_timeout_msec);
+      if (!numa_topology.node_cpus.empty()) {
+        manager->SetThreadAffinity(
+            numa_topology
+                .node_cpus[cq_index % numa_topology.node_cpus.size()]);
+      }
+      sync_req_mgrs_.emplace_back(manager);
+      ++cq_index;
     }
 
     if (default_rq_created) {
@@ -20,8 +20,14 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
 #include <climits>
 
+#ifdef GPR_LINUX
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 #include <grpc/support/log.h>
 
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
@@ -30,6 +36,15 @@
 
 namespace grpc {
 
+namespace {
+// Bounds for the adaptive spin performed before a parking thread sleeps.
+constexpr int kMinParkSpin = 128;
+constexpr int kInitialParkSpin = 1024;
+constexpr int kMaxParkSpin = 16384;
+// Default cap on cached (parked) threads when max_pollers is unbounded.
+constexpr int kDefaultMaxPooledThreads = 32;
+}  // namespace
+
 ThreadManager::WorkerThread::WorkerThread(ThreadManager* thd_mgr)
     : thd_mgr_(thd_mgr) {
   // Make thread creation exclusive with respect to its join happening in
@@ -62,7 +77,13 @@ ThreadManager::ThreadManager(const char*, grpc_resource_quota* resource_quota,
       min_pollers_(min_pollers),
       max_pollers_(max_pollers == -1 ? INT_MAX : max_pollers),
       num_threads_(0),
-      max_active_threads_sofar_(0) {}
+      max_active_threads_sofar_(0),
+      max_pooled_threads_(std::min(
+          max_pollers == -1 ? INT_MAX : max_pollers, kDefaultMaxPooledThreads)),
+      num_parked_(0),
+      park_spin_limit_(kInitialParkSpin),
+      total_parks_(0),
+      total_unparks_(0) {}
 
 ThreadManager::~ThreadManager() {
   {
@@ -83,6 +104,8 @@ void ThreadManager::Wait() {
 void ThreadManager::Shutdown() {
   grpc_core::MutexLock lock(&mu_);
   shutdown_ = true;
+  // Release any parked threads so they can exit.
+  park_cv_.SignalAll();
 }
 
 bool ThreadManager::IsShutdown() {
@@ -147,7 +170,46 @@ void ThreadManager::Initialize() {
   }
 }
 
+void ThreadManager::SetThreadAffinity(std::vector<int> cpus) {
+  affinity_cpus_ = std::move(cpus);
+}
+
+void ThreadManager::SetMaxPooledThreads(int max_pooled_threads) {
+  grpc_core::MutexLock lock(&mu_);
+  max_pooled_threads_ = max_pooled_threads;
+}
+
+int ThreadManager::GetNumParkedThreads() {
+  grpc_core::MutexLock lock(&mu_);
+  return num_parked_;
+}
+
+int64_t ThreadManager::GetTotalParks() {
+  grpc_core::MutexLock lock(&mu_);
+  return total_parks_;
+}
+
+int64_t ThreadManager::GetTotalUnparks() {
+  grpc_core::MutexLock lock(&mu_);
+  return total_unparks_;
+}
+
+void ThreadManager::ApplyThreadAffinity() {
+#ifdef GPR_LINUX
+  if (affinity_cpus_.empty()) return;
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (int cpu : affinity_cpus_) {
+    CPU_SET(cpu, &cpu_set);
+  }
+  if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) != 0) {
+    gpr_log(GPR_INFO, "Could not set thread affinity; continuing unpinned");
+  }
+#endif
+}
+
 void ThreadManager::MainWorkLoop() {
+  ApplyThreadAffinity();
   while (true) {
     void* tag;
     bool ok;
@@ -172,7 +234,16 @@ void ThreadManager::MainWorkLoop() {
         // quota available to create a new thread, start a new poller thread
         bool resource_exhausted = false;
         if (!shutdown_ && num_pollers_ < min_pollers_) {
-          if (thread_quota_->Reserve(1)) {
+          if (num_parked_ > unpark_requests_.load(std::memory_order_relaxed)) {
+            // Reuse a parked thread instead of spawning a new one. The poller
+            // slot is claimed here on its behalf; the unparked thread resumes
+            // polling without touching the counters itself.
+            unpark_requests_.fetch_add(1, std::memory_order_relaxed);
+            num_pollers_++;
+            total_unparks_++;
+            park_cv_.Signal();
+            lock.Release();
+          } else if (thread_quota_->Reserve(1)) {
             // We can allocate a new poller thread
             num_pollers_++;
             num_threads_++;
@@ -218,8 +289,12 @@ void ThreadManager::MainWorkLoop() {
         if (shutdown_) done = true;
         break;
     }
-    // If we decided to finish the thread, break out of the while loop
-    if (done) break;
+    // If we decided to finish the thread because of shutdown, break out of the
+    // while loop. Threads that merely became surplus (TIMEOUT with excess
+    // pollers, or losing the num_pollers_ < max_pollers_ race below) fall
+    // through to the parking logic instead of exiting, so they can be reused
+    // by a later PollForWork cycle without paying thread creation costs.
+    if (done && (shutdown_ || work_status == SHUTDOWN)) break;
 
     // Otherwise go back to polling as long as it doesn't exceed max_pollers_
     //
@@ -248,11 +323,52 @@ void ThreadManager::MainWorkLoop() {
     // pollset mutex) that makes DoWork() take longer to finish thereby causing
     // new poller threads to be created even faster. This results in a thread
     // avalanche.
-    if (num_pollers_ < max_pollers_) {
+    if (!done && num_pollers_ < max_pollers_) {
       num_pollers_++;
-    } else {
-      break;
+      continue;
+    }
+
+    // This thread is no longer needed as a poller. If the pool has room, park
+    // it for reuse rather than exiting; otherwise finish the thread. Parked
+    // threads stay counted in num_threads_ and keep their quota reservation.
+    if (num_parked_ >= max_pooled_threads_) break;
+    num_parked_++;
+    total_parks_++;
+    lock.Release();
+
+    // Spin briefly before sleeping: under bursty load an unpark request often
+    // arrives within the spin window, and taking it without a condvar wait
+    // saves a wakeup round-trip. The spin budget adapts: it grows when spins
+    // succeed and shrinks when they waste cycles.
+    int spin_limit = park_spin_limit_.load(std::memory_order_relaxed);
+    bool spin_hit = false;
+    for (int i = 0; i < spin_limit; i++) {
+      if (unpark_requests_.load(std::memory_order_relaxed) > 0) {
+        spin_hit = true;
+        break;
+      }
+    }
+    park_spin_limit_.store(
+        spin_hit ? std::min(spin_limit * 2, kMaxParkSpin)
+                 : std::max(spin_limit / 2, kMinParkSpin),
+        std::memory_order_relaxed);
+
+    lock.Lock();
+    while (!shutdown_ &&
+           unpark_requests_.load(std::memory_order_relaxed) == 0) {
+      park_cv_.Wait(&mu_);
+    }
+    num_parked_--;
+    if (unpark_requests_.load(std::memory_order_relaxed) > 0) {
+      unpark_requests_.fetch_sub(1, std::memory_order_relaxed);
+      // The requester already took a poller slot on our behalf; go straight
+      // back to polling.
+      if (!shutdown_) continue;
+      // The unpark raced with shutdown; return the poller slot the requester
+      // claimed for us before exiting.
+      num_pollers_--;
     }
+    break;
   };
 
   // This thread is exiting. Do some cleanup work i.e delete already completed
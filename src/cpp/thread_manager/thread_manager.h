@@ -19,7 +19,10 @@
 #ifndef GRPC_INTERNAL_CPP_THREAD_MANAGER_H
 #define GRPC_INTERNAL_CPP_THREAD_MANAGER_H
 
+#include <atomic>
+#include <cstdint>
 #include <list>
+#include <vector>
 
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/thd.h"
@@ -37,6 +40,25 @@ class ThreadManager {
   // Initializes and Starts the Rpc Manager threads
   void Initialize();
 
+  // Pin every thread spawned by this ThreadManager to the given CPUs (e.g.
+  // the CPUs of the NUMA node owning the completion queue being polled).
+  // Must be called before Initialize(). An empty list leaves threads
+  // unpinned. Only effective on Linux; a no-op elsewhere.
+  void SetThreadAffinity(std::vector<int> cpus);
+
+  // Maximum number of idle worker threads to cache for reuse. Threads that
+  // are no longer needed as pollers park and wait to be reused by a later
+  // PollForWork cycle instead of exiting, avoiding thread creation churn
+  // under bursty load. 0 disables pooling (threads exit as before). Must be
+  // called before Initialize(). Defaults to max_pollers capped at 32.
+  void SetMaxPooledThreads(int max_pooled_threads);
+
+  // Pool observability, for gauges: the number of threads currently parked,
+  // and cumulative park/unpark counts (callers diff these to derive rates).
+  int GetNumParkedThreads();
+  int64_t GetTotalParks();
+  int64_t GetTotalUnparks();
+
   // The return type of PollForWork() function
   enum WorkStatus { WORK_FOUND, SHUTDOWN, TIMEOUT };
 
@@ -136,6 +158,9 @@ class ThreadManager {
   // The main function in ThreadManager
   void MainWorkLoop();
 
+  // Pin the calling thread to affinity_cpus_, if any were configured.
+  void ApplyThreadAffinity();
+
   void MarkAsCompleted(WorkerThread* thd);
   void CleanupCompletedThreads();
 
@@ -146,6 +171,10 @@ class ThreadManager {
   bool shutdown_;
   grpc_core::CondVar shutdown_cv_;
 
+  // CPUs to pin spawned threads to; empty => unpinned. Set before
+  // Initialize() and immutable afterwards, so no lock is needed.
+  std::vector<int> affinity_cpus_;
+
   // The resource user object to use when requesting quota to create threads
   //
   // Note: The user of this ThreadManager object must create grpc_resource_quota
@@ -170,6 +199,22 @@ class ThreadManager {
   // ever set so far
   int max_active_threads_sofar_;
 
+  // Thread pool state: threads that are no longer needed as pollers park on
+  // park_cv_ (after a short adaptive spin) until either an unpark request
+  // reuses them or shutdown releases them. Parked threads stay counted in
+  // num_threads_ and keep their quota reservation.
+  grpc_core::CondVar park_cv_;
+  int max_pooled_threads_;
+  int num_parked_;
+  // Outstanding unpark requests. Modified only under mu_; atomic so parking
+  // threads may spin on it without the lock.
+  std::atomic<int> unpark_requests_{0};
+  // Adaptive spin budget for parking threads; grows when unparks arrive
+  // within the spin window and shrinks when they do not.
+  std::atomic<int> park_spin_limit_;
+  int64_t total_parks_;
+  int64_t total_unparks_;
+
   grpc_core::Mutex list_mu_;
   std::list<WorkerThread*> completed_threads_;
 };
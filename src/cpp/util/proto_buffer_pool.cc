@@ -0,0 +1,111 @@
+/*
+ *
+ * Copyright 2022 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <stddef.h>
+
+#include <grpc/slice.h>
+#include <grpc/support/alloc.h>
+#include <grpcpp/support/proto_buffer_writer.h>
+
+#include "src/core/lib/gprpp/sync.h"
+
+namespace grpc {
+namespace internal {
+namespace {
+
+// Requests below the smallest bucket are cheap enough to leave to the
+// allocator; requests above the largest bucket are rare (bounded by
+// kProtoBufferWriterMaxBufferLength) and not worth retaining.
+constexpr size_t kMinPooledBlockSize = 4096;
+constexpr size_t kMaxPooledBlockSize = 1024 * 1024;
+constexpr size_t kNumBuckets = 9;  // 4KB, 8KB, ..., 1MB
+// Caps the memory retained per bucket so an idle process does not hold on to
+// serialization blocks indefinitely.
+constexpr int kMaxBlocksPerBucket = 8;
+// Keeps the payload cache-line aligned while leaving room for the freelist
+// link and the owning bucket index in front of it.
+constexpr size_t kBlockHeaderSize = 64;
+
+struct Block {
+  Block* next;
+  size_t bucket;
+};
+
+static_assert(sizeof(Block) <= kBlockHeaderSize,
+              "Block header must fit in the space reserved ahead of the "
+              "payload");
+
+struct Bucket {
+  grpc_core::Mutex mu;
+  Block* free_list ABSL_GUARDED_BY(mu) = nullptr;
+  int free_count ABSL_GUARDED_BY(mu) = 0;
+};
+
+Bucket* GetBucket(size_t index) {
+  static Bucket* buckets = new Bucket[kNumBuckets];
+  return &buckets[index];
+}
+
+void ReturnBlock(void* arg) {
+  Block* block = static_cast<Block*>(arg);
+  Bucket* bucket = GetBucket(block->bucket);
+  {
+    grpc_core::MutexLock lock(&bucket->mu);
+    if (bucket->free_count < kMaxBlocksPerBucket) {
+      block->next = bucket->free_list;
+      bucket->free_list = block;
+      bucket->free_count++;
+      return;
+    }
+  }
+  gpr_free(block);
+}
+
+}  // namespace
+
+grpc_slice AcquireProtoBufferBlock(size_t length) {
+  if (length < kMinPooledBlockSize || length > kMaxPooledBlockSize) {
+    return grpc_slice_malloc(length);
+  }
+  size_t bucket_index = 0;
+  size_t bucket_size = kMinPooledBlockSize;
+  while (bucket_size < length) {
+    bucket_size <<= 1;
+    bucket_index++;
+  }
+  Bucket* bucket = GetBucket(bucket_index);
+  Block* block = nullptr;
+  {
+    grpc_core::MutexLock lock(&bucket->mu);
+    if (bucket->free_list != nullptr) {
+      block = bucket->free_list;
+      bucket->free_list = block->next;
+      bucket->free_count--;
+    }
+  }
+  if (block == nullptr) {
+    block = static_cast<Block*>(gpr_malloc(kBlockHeaderSize + bucket_size));
+    block->bucket = bucket_index;
+  }
+  return grpc_slice_new_with_user_data(
+      reinterpret_cast<char*>(block) + kBlockHeaderSize, bucket_size,
+      ReturnBlock, block);
+}
+
+}  // namespace internal
+}  // namespace grpc
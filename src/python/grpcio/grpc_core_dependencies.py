@@ -29,6 +29,7 @@ CORE_SOURCE_FILES = [
     'src/core/ext/filters/client_channel/dynamic_filters.cc',
     'src/core/ext/filters/client_channel/global_subchannel_pool.cc',
     'src/core/ext/filters/client_channel/health/health_check_client.cc',
+    'src/core/ext/filters/client_channel/health/health_check_stream_registry.cc',
     'src/core/ext/filters/client_channel/http_proxy.cc',
     'src/core/ext/filters/client_channel/lb_policy/address_filtering.cc',
     'src/core/ext/filters/client_channel/lb_policy/child_policy_handler.cc',
@@ -37,6 +38,7 @@ CORE_SOURCE_FILES = [
     'src/core/ext/filters/client_channel/lb_policy/grpclb/grpclb_balancer_addresses.cc',
     'src/core/ext/filters/client_channel/lb_policy/grpclb/grpclb_client_stats.cc',
     'src/core/ext/filters/client_channel/lb_policy/grpclb/load_balancer_api.cc',
+    'src/core/ext/filters/client_channel/lb_policy/least_request/least_request.cc',
     'src/core/ext/filters/client_channel/lb_policy/oob_backend_metric.cc',
     'src/core/ext/filters/client_channel/lb_policy/outlier_detection/outlier_detection.cc',
     'src/core/ext/filters/client_channel/lb_policy/pick_first/pick_first.cc',
@@ -94,6 +96,7 @@ CORE_SOURCE_FILES = [
     'src/core/ext/transport/chttp2/transport/chttp2_transport.cc',
     'src/core/ext/transport/chttp2/transport/context_list.cc',
     'src/core/ext/transport/chttp2/transport/decode_huff.cc',
+    'src/core/ext/transport/chttp2/transport/decode_huff_fast.cc',
     'src/core/ext/transport/chttp2/transport/flow_control.cc',
     'src/core/ext/transport/chttp2/transport/frame_data.cc',
     'src/core/ext/transport/chttp2/transport/frame_goaway.cc',
@@ -114,6 +117,8 @@ CORE_SOURCE_FILES = [
     'src/core/ext/transport/chttp2/transport/writing.cc',
     'src/core/ext/transport/inproc/inproc_plugin.cc',
     'src/core/ext/transport/inproc/inproc_transport.cc',
+    'src/core/ext/transport/shm/shm_endpoint.cc',
+    'src/core/ext/transport/shm/shm_transport.cc',
     'src/core/ext/upb-generated/envoy/admin/v3/certs.upb.c',
     'src/core/ext/upb-generated/envoy/admin/v3/clusters.upb.c',
     'src/core/ext/upb-generated/envoy/admin/v3/config_dump.upb.c',
@@ -425,6 +430,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/address_utils/parse_address.cc',
     'src/core/lib/address_utils/sockaddr_utils.cc',
     'src/core/lib/backoff/backoff.cc',
+    'src/core/lib/channel/call_tracer_sampler.cc',
     'src/core/lib/channel/channel_args.cc',
     'src/core/lib/channel/channel_args_preconditioning.cc',
     'src/core/lib/channel/channel_stack.cc',
@@ -440,6 +446,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/compression/compression_internal.cc',
     'src/core/lib/compression/message_compress.cc',
     'src/core/lib/config/core_configuration.cc',
+    'src/core/lib/debug/call_stage_profiler.cc',
     'src/core/lib/debug/event_log.cc',
     'src/core/lib/debug/stats.cc',
     'src/core/lib/debug/stats_data.cc',
@@ -474,6 +481,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/gpr/cpu_windows.cc',
     'src/core/lib/gpr/log.cc',
     'src/core/lib/gpr/log_android.cc',
+    'src/core/lib/gpr/log_async.cc',
     'src/core/lib/gpr/log_linux.cc',
     'src/core/lib/gpr/log_posix.cc',
     'src/core/lib/gpr/log_windows.cc',
@@ -598,6 +606,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/load_balancing/lb_policy_registry.cc',
     'src/core/lib/matchers/matchers.cc',
     'src/core/lib/promise/activity.cc',
+    'src/core/lib/promise/group_wakeup_scheduler.cc',
     'src/core/lib/promise/sleep.cc',
     'src/core/lib/resolver/resolver.cc',
     'src/core/lib/resolver/resolver_registry.cc',
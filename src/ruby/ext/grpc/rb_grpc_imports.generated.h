@@ -116,6 +116,9 @@ extern grpc_completion_queue_create_type grpc_completion_queue_create_import;
 typedef grpc_event(*grpc_completion_queue_next_type)(grpc_completion_queue* cq, gpr_timespec deadline, void* reserved);
 extern grpc_completion_queue_next_type grpc_completion_queue_next_import;
 #define grpc_completion_queue_next grpc_completion_queue_next_import
+typedef size_t(*grpc_completion_queue_next_batch_type)(grpc_completion_queue* cq, grpc_event* events, size_t max_events, gpr_timespec deadline, void* reserved);
+extern grpc_completion_queue_next_batch_type grpc_completion_queue_next_batch_import;
+#define grpc_completion_queue_next_batch grpc_completion_queue_next_batch_import
 typedef grpc_event(*grpc_completion_queue_pluck_type)(grpc_completion_queue* cq, void* tag, gpr_timespec deadline, void* reserved);
 extern grpc_completion_queue_pluck_type grpc_completion_queue_pluck_import;
 #define grpc_completion_queue_pluck grpc_completion_queue_pluck_import
@@ -158,6 +161,9 @@ extern grpc_call_arena_alloc_type grpc_call_arena_alloc_import;
 typedef grpc_call_error(*grpc_call_start_batch_type)(grpc_call* call, const grpc_op* ops, size_t nops, void* tag, void* reserved);
 extern grpc_call_start_batch_type grpc_call_start_batch_import;
 #define grpc_call_start_batch grpc_call_start_batch_import
+typedef grpc_call_error(*grpc_call_start_batch_bulk_type)(grpc_call_batch* batches, size_t count, size_t* first_error_index, void* reserved);
+extern grpc_call_start_batch_bulk_type grpc_call_start_batch_bulk_import;
+#define grpc_call_start_batch_bulk grpc_call_start_batch_bulk_import
 typedef char*(*grpc_call_get_peer_type)(grpc_call* call);
 extern grpc_call_get_peer_type grpc_call_get_peer_import;
 #define grpc_call_get_peer grpc_call_get_peer_import
@@ -239,6 +245,9 @@ extern grpc_server_start_type grpc_server_start_import;
 typedef void(*grpc_server_shutdown_and_notify_type)(grpc_server* server, grpc_completion_queue* cq, void* tag);
 extern grpc_server_shutdown_and_notify_type grpc_server_shutdown_and_notify_import;
 #define grpc_server_shutdown_and_notify grpc_server_shutdown_and_notify_import
+typedef void(*grpc_server_drain_progress_type)(grpc_server* server, size_t* channels_at_shutdown, size_t* channels_remaining);
+extern grpc_server_drain_progress_type grpc_server_drain_progress_import;
+#define grpc_server_drain_progress grpc_server_drain_progress_import
 typedef void(*grpc_server_cancel_all_calls_type)(grpc_server* server);
 extern grpc_server_cancel_all_calls_type grpc_server_cancel_all_calls_import;
 #define grpc_server_cancel_all_calls grpc_server_cancel_all_calls_import
@@ -287,6 +296,12 @@ extern grpc_channelz_get_top_channels_type grpc_channelz_get_top_channels_import
 typedef char*(*grpc_channelz_get_servers_type)(intptr_t start_server_id);
 extern grpc_channelz_get_servers_type grpc_channelz_get_servers_import;
 #define grpc_channelz_get_servers grpc_channelz_get_servers_import
+typedef char*(*grpc_channelz_get_top_channels_batch_type)(intptr_t start_channel_id, intptr_t max_results, intptr_t* next_channel_id);
+extern grpc_channelz_get_top_channels_batch_type grpc_channelz_get_top_channels_batch_import;
+#define grpc_channelz_get_top_channels_batch grpc_channelz_get_top_channels_batch_import
+typedef char*(*grpc_channelz_get_servers_batch_type)(intptr_t start_server_id, intptr_t max_results, intptr_t* next_server_id);
+extern grpc_channelz_get_servers_batch_type grpc_channelz_get_servers_batch_import;
+#define grpc_channelz_get_servers_batch grpc_channelz_get_servers_batch_import
 typedef char*(*grpc_channelz_get_server_type)(intptr_t server_id);
 extern grpc_channelz_get_server_type grpc_channelz_get_server_import;
 #define grpc_channelz_get_server grpc_channelz_get_server_import
@@ -302,6 +317,9 @@ extern grpc_channelz_get_subchannel_type grpc_channelz_get_subchannel_import;
 typedef char*(*grpc_channelz_get_socket_type)(intptr_t socket_id);
 extern grpc_channelz_get_socket_type grpc_channelz_get_socket_import;
 #define grpc_channelz_get_socket grpc_channelz_get_socket_import
+typedef char*(*grpc_call_stage_timings_json_type)(void);
+extern grpc_call_stage_timings_json_type grpc_call_stage_timings_json_import;
+#define grpc_call_stage_timings_json grpc_call_stage_timings_json_import
 typedef const grpc_arg_pointer_vtable*(*grpc_authorization_policy_provider_arg_vtable_type)(void);
 extern grpc_authorization_policy_provider_arg_vtable_type grpc_authorization_policy_provider_arg_vtable_import;
 #define grpc_authorization_policy_provider_arg_vtable grpc_authorization_policy_provider_arg_vtable_import
@@ -437,6 +455,9 @@ extern grpc_call_set_credentials_type grpc_call_set_credentials_import;
 typedef void(*grpc_server_credentials_set_auth_metadata_processor_type)(grpc_server_credentials* creds, grpc_auth_metadata_processor processor);
 extern grpc_server_credentials_set_auth_metadata_processor_type grpc_server_credentials_set_auth_metadata_processor_import;
 #define grpc_server_credentials_set_auth_metadata_processor grpc_server_credentials_set_auth_metadata_processor_import
+typedef void(*grpc_server_credentials_invalidate_auth_result_cache_type)(grpc_server_credentials* creds);
+extern grpc_server_credentials_invalidate_auth_result_cache_type grpc_server_credentials_invalidate_auth_result_cache_import;
+#define grpc_server_credentials_invalidate_auth_result_cache grpc_server_credentials_invalidate_auth_result_cache_import
 typedef grpc_alts_credentials_options*(*grpc_alts_credentials_client_options_create_type)(void);
 extern grpc_alts_credentials_client_options_create_type grpc_alts_credentials_client_options_create_import;
 #define grpc_alts_credentials_client_options_create grpc_alts_credentials_client_options_create_import
@@ -563,6 +584,9 @@ extern grpc_byte_buffer_reader_peek_type grpc_byte_buffer_reader_peek_import;
 typedef grpc_slice(*grpc_byte_buffer_reader_readall_type)(grpc_byte_buffer_reader* reader);
 extern grpc_byte_buffer_reader_readall_type grpc_byte_buffer_reader_readall_import;
 #define grpc_byte_buffer_reader_readall grpc_byte_buffer_reader_readall_import
+typedef grpc_slice(*grpc_byte_buffer_reader_view_type)(grpc_byte_buffer_reader* reader);
+extern grpc_byte_buffer_reader_view_type grpc_byte_buffer_reader_view_import;
+#define grpc_byte_buffer_reader_view grpc_byte_buffer_reader_view_import
 typedef grpc_byte_buffer*(*grpc_raw_byte_buffer_from_reader_type)(grpc_byte_buffer_reader* reader);
 extern grpc_raw_byte_buffer_from_reader_type grpc_raw_byte_buffer_from_reader_import;
 #define grpc_raw_byte_buffer_from_reader grpc_raw_byte_buffer_from_reader_import
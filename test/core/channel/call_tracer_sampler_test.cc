@@ -0,0 +1,86 @@
+//
+//
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/lib/channel/call_tracer_sampler.h"
+
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include <grpc/support/time.h>
+
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
+
+namespace grpc_core {
+namespace {
+
+TEST(RateLimitedSamplerTest, HonorsPerSecondLimit) {
+  auto sampler = MakeRateLimitedCallTracerSampler(10);
+  int sampled = 0;
+  for (int i = 0; i < 100; ++i) {
+    if (sampler->ShouldSample()) ++sampled;
+  }
+  // The bucket holds exactly one second of allowance and a refill cannot
+  // happen within this loop.
+  EXPECT_EQ(sampled, 10);
+}
+
+TEST(ReservoirSamplerTest, FirstTargetCallsAlwaysSampled) {
+  auto sampler = MakeReservoirCallTracerSampler(5, Duration::Hours(1));
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_TRUE(sampler->ShouldSample());
+  }
+}
+
+TEST(ReservoirSamplerTest, DecaysWithVolume) {
+  constexpr uint64_t kTarget = 100;
+  auto sampler = MakeReservoirCallTracerSampler(kTarget, Duration::Hours(1));
+  uint64_t sampled = 0;
+  for (int i = 0; i < 100000; ++i) {
+    if (sampler->ShouldSample()) ++sampled;
+  }
+  // At least the guaranteed first kTarget, but the decaying acceptance
+  // probability must keep the total far below the call volume.
+  EXPECT_GE(sampled, kTarget);
+  EXPECT_LT(sampled, 5000u);
+}
+
+TEST(MethodStatsCollectorTest, RecordsDigest) {
+  auto* collector = MethodStatsCollector::Get();
+  CallTracer* tracer = collector->MakeCallTracer("/test.Service/Method");
+  CallTracer::CallAttemptTracer* attempt =
+      tracer->StartNewAttempt(/*is_transparent_retry=*/false);
+  SliceBuffer message;
+  message.Append(Slice::FromCopiedString("hello world"));
+  attempt->RecordSendMessage(message);
+  attempt->RecordReceivedMessage(message);
+  attempt->RecordEnd(gpr_time_from_micros(1500, GPR_TIMESPAN));
+  delete tracer;
+  std::string report = collector->ReportAsJson();
+  EXPECT_NE(report.find("/test.Service/Method"), std::string::npos);
+  EXPECT_NE(report.find("\"calls\":1"), std::string::npos);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
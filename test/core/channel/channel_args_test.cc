@@ -69,6 +69,36 @@ TEST(ChannelArgsTest, SetGetRemove) {
   gpr_free(ptr);
 }
 
+TEST(ChannelArgsTest, BuilderMatchesSequentialSet) {
+  ChannelArgs sequential = ChannelArgs()
+                               .Set("answer", 42)
+                               .Set("foo", "bar")
+                               .Set("alpha", "beta");
+  ChannelArgs::Builder builder;
+  builder.Set("foo", "bar").Set("alpha", "beta").Set("answer", 42);
+  ChannelArgs built = builder.Build();
+  EXPECT_EQ(built, sequential);
+  EXPECT_EQ(built.GetInt("answer"), 42);
+  EXPECT_EQ(built.GetString("foo"), "bar");
+}
+
+TEST(ChannelArgsTest, BuilderLastSetOfDuplicateKeyWins) {
+  ChannelArgs args =
+      ChannelArgs::Builder().Set("key", 1).Set("key", 2).Build();
+  EXPECT_EQ(args.GetInt("key"), 2);
+}
+
+TEST(ChannelArgsTest, BuilderLayersOverBase) {
+  ChannelArgs base = ChannelArgs().Set("shared", 1).Set("overridden", 1);
+  ChannelArgs derived =
+      ChannelArgs::Builder(base).Set("overridden", 2).Set("extra", 3).Build();
+  EXPECT_EQ(base.GetInt("overridden"), 1);
+  EXPECT_FALSE(base.Contains("extra"));
+  EXPECT_EQ(derived.GetInt("shared"), 1);
+  EXPECT_EQ(derived.GetInt("overridden"), 2);
+  EXPECT_EQ(derived.GetInt("extra"), 3);
+}
+
 TEST(ChannelArgsTest, StoreRefCountedPtr) {
   struct Test : public RefCounted<Test> {
     explicit Test(int n) : n(n) {}
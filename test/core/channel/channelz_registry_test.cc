@@ -128,6 +128,58 @@ TEST_F(ChannelzRegistryTest, TestUnregistration) {
   }
 }
 
+static size_t CountOccurrences(const std::string& haystack,
+                               const std::string& needle) {
+  size_t count = 0;
+  for (size_t pos = haystack.find(needle); pos != std::string::npos;
+       pos = haystack.find(needle, pos + needle.size())) {
+    ++count;
+  }
+  return count;
+}
+
+TEST_F(ChannelzRegistryTest, GetServersBatchPaginatesInBoundedChunks) {
+  std::vector<RefCountedPtr<BaseNode>> servers;
+  // Interleave unrelated entity types to make sure they are neither
+  // returned nor counted against the batch size.
+  std::vector<RefCountedPtr<BaseNode>> sockets;
+  for (int i = 0; i < 10; ++i) {
+    servers.push_back(MakeRefCounted<ServerNode>(0));
+    sockets.push_back(CreateTestNode());
+  }
+  intptr_t cursor = 0;
+  std::string json = ChannelzRegistry::GetServersBatch(0, 4, &cursor);
+  EXPECT_EQ(CountOccurrences(json, "\"serverId\""), 4u);
+  EXPECT_EQ(json.find("\"end\""), std::string::npos);
+  ASSERT_GT(cursor, 0);
+  json = ChannelzRegistry::GetServersBatch(cursor, 4, &cursor);
+  EXPECT_EQ(CountOccurrences(json, "\"serverId\""), 4u);
+  EXPECT_EQ(json.find("\"end\""), std::string::npos);
+  ASSERT_GT(cursor, 0);
+  json = ChannelzRegistry::GetServersBatch(cursor, 4, &cursor);
+  EXPECT_EQ(CountOccurrences(json, "\"serverId\""), 2u);
+  EXPECT_NE(json.find("\"end\""), std::string::npos);
+  EXPECT_EQ(cursor, 0);
+}
+
+TEST_F(ChannelzRegistryTest, BatchCursorStableAcrossUnregistration) {
+  std::vector<RefCountedPtr<BaseNode>> servers;
+  for (int i = 0; i < 6; ++i) {
+    servers.push_back(MakeRefCounted<ServerNode>(0));
+  }
+  intptr_t cursor = 0;
+  std::string json = ChannelzRegistry::GetServersBatch(0, 3, &cursor);
+  EXPECT_EQ(CountOccurrences(json, "\"serverId\""), 3u);
+  ASSERT_GT(cursor, 0);
+  // Destroying an entity between batches must not shift the cursor: the
+  // remaining entities are still returned exactly once.
+  servers[3].reset();
+  json = ChannelzRegistry::GetServersBatch(cursor, 3, &cursor);
+  EXPECT_EQ(CountOccurrences(json, "\"serverId\""), 2u);
+  EXPECT_NE(json.find("\"end\""), std::string::npos);
+  EXPECT_EQ(cursor, 0);
+}
+
 }  // namespace testing
 }  // namespace channelz
 }  // namespace grpc_core
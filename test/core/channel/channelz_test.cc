@@ -542,6 +542,91 @@ TEST_F(ChannelzRegistryBasedTest, ManyServersTest) {
   ValidateGetServers(10);
 }
 
+TEST(ChannelzSocketTest, RecordsAggregateAcrossShards) {
+  ExecCtx exec_ctx;
+  RefCountedPtr<SocketNode> socket = MakeRefCounted<SocketNode>(
+      "ipv4:127.0.0.1:1234", "ipv4:127.0.0.1:5678", "test_socket", nullptr);
+  socket->RecordStreamStartedFromLocal();
+  socket->RecordStreamStartedFromRemote();
+  socket->RecordStreamSucceeded();
+  socket->RecordStreamFailed();
+  socket->RecordMessagesSent(2);
+  socket->RecordMessageReceived();
+  socket->RecordKeepaliveSent();
+  auto json = Json::Parse(socket->RenderJsonString());
+  ASSERT_TRUE(json.ok()) << json.status();
+  ASSERT_EQ(json->type(), Json::Type::OBJECT);
+  auto it = json->object_value().find("data");
+  ASSERT_NE(it, json->object_value().end());
+  ASSERT_EQ(it->second.type(), Json::Type::OBJECT);
+  const Json::Object& data = it->second.object_value();
+  ValidateChildInteger(data, "streamsStarted", 2);
+  ValidateChildInteger(data, "streamsSucceeded", 1);
+  ValidateChildInteger(data, "streamsFailed", 1);
+  ValidateChildInteger(data, "messagesSent", 2);
+  ValidateChildInteger(data, "messagesReceived", 1);
+  ValidateChildInteger(data, "keepAlivesSent", 1);
+}
+
+TEST(ChannelzSocketTest, UnsampledSocketRendersWithoutCounters) {
+  ExecCtx exec_ctx;
+  RefCountedPtr<SocketNode> socket = MakeRefCounted<SocketNode>(
+      "ipv4:127.0.0.1:1234", "ipv4:127.0.0.1:5678", "test_socket", nullptr,
+      /*record_counters=*/false);
+  socket->RecordStreamStartedFromLocal();
+  socket->RecordMessagesSent(2);
+  auto json = Json::Parse(socket->RenderJsonString());
+  ASSERT_TRUE(json.ok()) << json.status();
+  ASSERT_EQ(json->type(), Json::Type::OBJECT);
+  auto it = json->object_value().find("data");
+  ASSERT_NE(it, json->object_value().end());
+  ASSERT_EQ(it->second.type(), Json::Type::OBJECT);
+  const Json::Object& data = it->second.object_value();
+  ValidateChildInteger(data, "streamsStarted", 0);
+  ValidateChildInteger(data, "messagesSent", 0);
+}
+
+TEST(ChannelzSocketTest, RendersWriteStallStats) {
+  ExecCtx exec_ctx;
+  RefCountedPtr<SocketNode> socket = MakeRefCounted<SocketNode>(
+      "ipv4:127.0.0.1:1234", "ipv4:127.0.0.1:5678", "test_socket", nullptr);
+  socket->RecordWriteStallStats(
+      /*transport_window_stalls=*/3, /*transport_window_stalled_bytes=*/300,
+      /*transport_window_stalled_millis=*/30, /*stream_window_stalls=*/2,
+      /*stream_window_stalled_bytes=*/200, /*stream_window_stalled_millis=*/20,
+      /*endpoint_write_millis=*/10, /*endpoint_write_bytes=*/1000,
+      /*no_data_write_cycles=*/5);
+  auto json = Json::Parse(socket->RenderJsonString());
+  ASSERT_TRUE(json.ok()) << json.status();
+  ASSERT_EQ(json->type(), Json::Type::OBJECT);
+  auto it = json->object_value().find("data");
+  ASSERT_NE(it, json->object_value().end());
+  ASSERT_EQ(it->second.type(), Json::Type::OBJECT);
+  const Json::Object& data = it->second.object_value();
+  ValidateChildInteger(data, "transportWindowStalls", 3);
+  ValidateChildInteger(data, "transportWindowStalledBytes", 300);
+  ValidateChildInteger(data, "transportWindowStalledMillis", 30);
+  ValidateChildInteger(data, "streamWindowStalls", 2);
+  ValidateChildInteger(data, "streamWindowStalledBytes", 200);
+  ValidateChildInteger(data, "streamWindowStalledMillis", 20);
+  ValidateChildInteger(data, "endpointWriteMillis", 10);
+  ValidateChildInteger(data, "endpointWriteBytes", 1000);
+  ValidateChildInteger(data, "noDataWriteCycles", 5);
+}
+
+TEST(ChannelzSocketTest, SampleNewSocketPeriod) {
+  // Periods of 0 and 1 always sample.
+  EXPECT_TRUE(SocketNode::SampleNewSocket(0));
+  EXPECT_TRUE(SocketNode::SampleNewSocket(1));
+  // Exactly one socket out of every four is sampled, regardless of where in
+  // the process-wide sequence we start.
+  int sampled = 0;
+  for (int i = 0; i < 40; ++i) {
+    if (SocketNode::SampleNewSocket(4)) ++sampled;
+  }
+  EXPECT_EQ(sampled, 10);
+}
+
 INSTANTIATE_TEST_SUITE_P(ChannelzChannelTestSweep, ChannelzChannelTest,
                          ::testing::Values(0, 8, 64, 1024, 1024 * 1024));
 
@@ -196,6 +196,23 @@ TEST_F(ServiceConfigTest, BasicTest1) {
   ASSERT_TRUE(service_config.ok()) << service_config.status();
 }
 
+TEST_F(ServiceConfigTest, CacheReturnsSameParsedConfig) {
+  ServiceConfigImpl::TestOnlyClearCache();
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), "{}");
+  ASSERT_TRUE(service_config.ok()) << service_config.status();
+  // A byte-identical config string yields the same parsed object.
+  auto again = ServiceConfigImpl::Create(ChannelArgs(), "{}");
+  ASSERT_TRUE(again.ok()) << again.status();
+  EXPECT_EQ(service_config->get(), again->get());
+  auto stats = ServiceConfigImpl::cache_stats();
+  EXPECT_EQ(stats.hits, 1);
+  EXPECT_EQ(stats.misses, 1);
+  // A different string misses the cache and is parsed afresh.
+  auto different = ServiceConfigImpl::Create(ChannelArgs(), "{ }");
+  ASSERT_TRUE(different.ok()) << different.status();
+  EXPECT_NE(service_config->get(), different->get());
+}
+
 TEST_F(ServiceConfigTest, SkipMethodConfigWithNoNameOrEmptyName) {
   const char* test_json =
       "{\"methodConfig\": ["
@@ -22,6 +22,8 @@
 
 #include "gtest/gtest.h"
 
+#include "src/core/lib/iomgr/exec_ctx.h"
+
 namespace grpc_core {
 namespace testing {
 
@@ -100,6 +102,76 @@ TEST(IdleFilterStateTest, StressTest) {
   for (auto& thread : threads) thread.join();
 }
 
+TEST(PerCpuIdleStateTest, TimerStartsExactlyOnce) {
+  PerCpuIdleState s;
+  EXPECT_TRUE(s.TryStartTimer());
+  for (int i = 0; i < 10; i++) {
+    EXPECT_FALSE(s.TryStartTimer());
+  }
+}
+
+TEST(PerCpuIdleStateTest, IdleAfterOneQuietCycle) {
+  ExecCtx exec_ctx;
+  PerCpuIdleState s;
+  s.RecordCallStart();
+  // Call in flight: not idle.
+  EXPECT_FALSE(s.CheckIdle());
+  s.RecordCallFinish();
+  // Activity since the previous probe: not idle yet.
+  EXPECT_FALSE(s.CheckIdle());
+  // A full quiet cycle: idle.
+  EXPECT_TRUE(s.CheckIdle());
+  // And it stays idle until the next call.
+  EXPECT_TRUE(s.CheckIdle());
+  s.RecordCallStart();
+  EXPECT_FALSE(s.CheckIdle());
+}
+
+TEST(PerCpuIdleStateTest, StressTest) {
+  PerCpuIdleState s;
+  std::atomic<bool> done{false};
+  std::vector<std::thread> threads;
+  for (int idx = 0; idx < 10; idx++) {
+    threads.emplace_back([&] {
+      ExecCtx exec_ctx;
+      std::mt19937 g{std::random_device()()};
+      int ctr = 0;
+      while (!done.load(std::memory_order_relaxed)) {
+        for (int i = 0; i < 100; i++) {
+          if (g() & 1) {
+            s.RecordCallStart();
+            ctr++;
+          } else if (ctr > 0) {
+            s.RecordCallFinish();
+            ctr--;
+          }
+        }
+        while (ctr > 0) {
+          s.RecordCallFinish();
+          ctr--;
+        }
+      }
+    });
+  }
+  // Probe concurrently with the mutators: idleness may or may not be
+  // observed, but the counters must never report more finishes than starts
+  // in a way that flags idleness while this thread holds a call open.
+  {
+    ExecCtx exec_ctx;
+    s.RecordCallStart();
+    for (int i = 0; i < 1000; i++) {
+      EXPECT_FALSE(s.CheckIdle());
+    }
+    s.RecordCallFinish();
+  }
+  done.store(true, std::memory_order_relaxed);
+  for (auto& thread : threads) thread.join();
+  // Once everything has quiesced, two probes in a row must report idle.
+  ExecCtx exec_ctx;
+  (void)s.CheckIdle();
+  EXPECT_TRUE(s.CheckIdle());
+}
+
 }  // namespace testing
 }  // namespace grpc_core
 
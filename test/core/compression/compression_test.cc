@@ -35,11 +35,12 @@
 
 TEST(CompressionTest, CompressionAlgorithmParse) {
   size_t i;
-  const char* valid_names[] = {"identity", "gzip", "deflate"};
+  const char* valid_names[] = {"identity", "gzip", "deflate", "zstd"};
   const grpc_compression_algorithm valid_algorithms[] = {
       GRPC_COMPRESS_NONE,
       GRPC_COMPRESS_GZIP,
       GRPC_COMPRESS_DEFLATE,
+      GRPC_COMPRESS_ZSTD,
   };
   const char* invalid_names[] = {"gzip2", "foo", "", "2gzip"};
 
@@ -69,11 +70,12 @@ TEST(CompressionTest, CompressionAlgorithmName) {
   int success;
   const char* name;
   size_t i;
-  const char* valid_names[] = {"identity", "gzip", "deflate"};
+  const char* valid_names[] = {"identity", "gzip", "deflate", "zstd"};
   const grpc_compression_algorithm valid_algorithms[] = {
       GRPC_COMPRESS_NONE,
       GRPC_COMPRESS_GZIP,
       GRPC_COMPRESS_DEFLATE,
+      GRPC_COMPRESS_ZSTD,
   };
 
   gpr_log(GPR_DEBUG, "test_compression_algorithm_name");
@@ -161,6 +163,36 @@ TEST(CompressionTest, CompressionAlgorithmForLevel) {
                                                    accepted_encodings));
   }
 
+  {
+    /* accept only zstd: selected for every level when compiled in, never
+       selected otherwise */
+    uint32_t accepted_encodings = 0;
+    grpc_core::SetBit(&accepted_encodings, GRPC_COMPRESS_NONE); /* always */
+    grpc_core::SetBit(&accepted_encodings, GRPC_COMPRESS_ZSTD);
+
+#ifdef GRPC_HAVE_ZSTD
+    const grpc_compression_algorithm expected = GRPC_COMPRESS_ZSTD;
+#else
+    const grpc_compression_algorithm expected = GRPC_COMPRESS_NONE;
+#endif
+
+    ASSERT_EQ(GRPC_COMPRESS_NONE,
+              grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_NONE,
+                                                   accepted_encodings));
+
+    ASSERT_EQ(expected,
+              grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_LOW,
+                                                   accepted_encodings));
+
+    ASSERT_EQ(expected,
+              grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_MED,
+                                                   accepted_encodings));
+
+    ASSERT_EQ(expected,
+              grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_HIGH,
+                                                   accepted_encodings));
+  }
+
   {
     /* accept gzip and deflate */
     uint32_t accepted_encodings = 0;
@@ -221,7 +253,11 @@ TEST(CompressionTest, CompressionEnableDisableAlgorithm) {
        algorithm < GRPC_COMPRESS_ALGORITHMS_COUNT;
        algorithm = static_cast<grpc_compression_algorithm>(
            static_cast<int>(algorithm) + 1)) {
-    /* all algorithms are enabled by default */
+#ifndef GRPC_HAVE_ZSTD
+    /* zstd defaults to disabled when not compiled in */
+    if (algorithm == GRPC_COMPRESS_ZSTD) continue;
+#endif
+    /* all other algorithms are enabled by default */
     ASSERT_NE(
         grpc_compression_options_is_algorithm_enabled(&options, algorithm), 0);
   }
@@ -245,6 +281,31 @@ TEST(CompressionTest, CompressionEnableDisableAlgorithm) {
   }
 }
 
+TEST(CompressionTest, CompressionDictionaryRegistry) {
+  /* id 0 is reserved to mean "no dictionary" */
+  ASSERT_FALSE(grpc_core::RegisterCompressionDictionary(
+      0, grpc_core::Slice::FromCopiedString("reserved")));
+  ASSERT_TRUE(grpc_core::RegisterCompressionDictionary(
+      42, grpc_core::Slice::FromCopiedString("some shared bytes")));
+  /* duplicate registration is rejected */
+  ASSERT_FALSE(grpc_core::RegisterCompressionDictionary(
+      42, grpc_core::Slice::FromCopiedString("other bytes")));
+
+  absl::optional<absl::string_view> dict =
+      grpc_core::LookupCompressionDictionary(42);
+  ASSERT_TRUE(dict.has_value());
+  ASSERT_EQ(*dict, "some shared bytes");
+  ASSERT_FALSE(grpc_core::LookupCompressionDictionary(43).has_value());
+
+  ASSERT_TRUE(
+      grpc_core::CompressionAlgorithmSupportsDictionary(GRPC_COMPRESS_DEFLATE));
+  /* the gzip format has no preset-dictionary support */
+  ASSERT_FALSE(
+      grpc_core::CompressionAlgorithmSupportsDictionary(GRPC_COMPRESS_GZIP));
+  ASSERT_FALSE(
+      grpc_core::CompressionAlgorithmSupportsDictionary(GRPC_COMPRESS_NONE));
+}
+
 TEST(CompressionTest, ChannelArgsSetCompressionAlgorithm) {
   grpc_core::ExecCtx exec_ctx;
   const grpc_channel_args* ch_args;
@@ -265,10 +326,13 @@ TEST(CompressionTest, ChannelArgsCompressionAlgorithmStates) {
 
   const grpc_channel_args* ch_args =
       grpc_channel_args_copy_and_add(nullptr, nullptr, 0);
-  /* by default, all enabled */
+  /* by default, all enabled (except zstd when not compiled in) */
   states = grpc_core::CompressionAlgorithmSet::FromChannelArgs(ch_args);
 
   for (size_t i = 0; i < GRPC_COMPRESS_ALGORITHMS_COUNT; i++) {
+#ifndef GRPC_HAVE_ZSTD
+    if (i == GRPC_COMPRESS_ZSTD) continue;
+#endif
     ASSERT_TRUE(states.IsSet(static_cast<grpc_compression_algorithm>(i)));
   }
 
@@ -285,6 +349,9 @@ TEST(CompressionTest, ChannelArgsCompressionAlgorithmStates) {
   states = grpc_core::CompressionAlgorithmSet::FromChannelArgs(
       ch_args_wo_gzip_deflate);
   for (size_t i = 0; i < GRPC_COMPRESS_ALGORITHMS_COUNT; i++) {
+#ifndef GRPC_HAVE_ZSTD
+    if (i == GRPC_COMPRESS_ZSTD) continue;
+#endif
     if (i == GRPC_COMPRESS_GZIP || i == GRPC_COMPRESS_DEFLATE) {
       ASSERT_FALSE(states.IsSet(static_cast<grpc_compression_algorithm>(i)));
     } else {
@@ -299,6 +366,9 @@ TEST(CompressionTest, ChannelArgsCompressionAlgorithmStates) {
 
   states = grpc_core::CompressionAlgorithmSet::FromChannelArgs(ch_args_wo_gzip);
   for (size_t i = 0; i < GRPC_COMPRESS_ALGORITHMS_COUNT; i++) {
+#ifndef GRPC_HAVE_ZSTD
+    if (i == GRPC_COMPRESS_ZSTD) continue;
+#endif
     if (i == GRPC_COMPRESS_DEFLATE) {
       ASSERT_FALSE(states.IsSet(static_cast<grpc_compression_algorithm>(i)));
     } else {
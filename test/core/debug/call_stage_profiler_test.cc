@@ -0,0 +1,90 @@
+/*
+ *
+ * Copyright 2022 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "src/core/lib/debug/call_stage_profiler.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+#include <grpc/support/alloc.h>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+
+#ifndef GRPC_DISABLE_CALL_STAGE_PROFILER
+
+TEST(CallStageProfilerTest, RecordedCyclesLandInLog2Bucket) {
+  CallStageTimings before;
+  CallStageTimingsCollect(&before);
+
+  ExecCtx exec_ctx;
+  // 1000 cycles => bucket 9 (2^9 = 512 <= 1000 < 1024 = 2^10).
+  CallStageRecordCycles(CallStage::kLbPick, 1000);
+
+  CallStageTimings after;
+  CallStageTimingsCollect(&after);
+  EXPECT_EQ(after.buckets[static_cast<size_t>(CallStage::kLbPick)][9] -
+                before.buckets[static_cast<size_t>(CallStage::kLbPick)][9],
+            1);
+}
+
+TEST(CallStageProfilerTest, ScopedTimerRecordsSomething) {
+  CallStageTimings before;
+  CallStageTimingsCollect(&before);
+
+  ExecCtx exec_ctx;
+  { ScopedCallStageTimer timer(CallStage::kWrite); }
+
+  CallStageTimings after;
+  CallStageTimingsCollect(&after);
+  gpr_atm count_before = 0;
+  gpr_atm count_after = 0;
+  for (size_t i = 0; i < kCallStageBuckets; i++) {
+    count_before += before.buckets[static_cast<size_t>(CallStage::kWrite)][i];
+    count_after += after.buckets[static_cast<size_t>(CallStage::kWrite)][i];
+  }
+  EXPECT_EQ(count_after - count_before, 1);
+}
+
+#endif  // GRPC_DISABLE_CALL_STAGE_PROFILER
+
+TEST(CallStageProfilerTest, JsonSnapshotNamesAllStages) {
+  char* json_c = grpc_call_stage_timings_json();
+  std::string json(json_c);
+  gpr_free(json_c);
+  for (size_t i = 0; i < kCallStageCount; i++) {
+    EXPECT_NE(json.find(call_stage_name[i]), std::string::npos) << json;
+  }
+}
+
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
@@ -0,0 +1,68 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/debug/trace.h"
+
+#include <gtest/gtest.h>
+
+#include <grpc/grpc.h>
+
+#include "test/core/util/test_config.h"
+#include "test/core/util/tracer_util.h"
+
+static grpc_core::TraceFlag test_flag(false, "trace_test_flag");
+
+namespace grpc_core {
+namespace {
+
+int CurrentEnabledCount() {
+#ifdef GRPC_THREADSAFE_TRACER
+  return trace_detail::g_num_enabled_tracers.load(std::memory_order_relaxed);
+#else
+  return trace_detail::g_num_enabled_tracers;
+#endif
+}
+
+TEST(TraceFlagTest, MergedEnabledCountTracksToggles) {
+  EXPECT_FALSE(GRPC_TRACE_FLAG_ENABLED(test_flag));
+  testing::grpc_tracer_enable_flag(&test_flag);
+  // Enabling any flag must light up the merged fast-path check.
+  EXPECT_TRUE(trace_detail::AnyTracerEnabled());
+  EXPECT_TRUE(test_flag.enabled());
+  EXPECT_TRUE(GRPC_TRACE_FLAG_ENABLED(test_flag));
+  grpc_tracer_set_enabled("trace_test_flag", 0);
+  EXPECT_FALSE(test_flag.enabled());
+  EXPECT_FALSE(GRPC_TRACE_FLAG_ENABLED(test_flag));
+}
+
+TEST(TraceFlagTest, RedundantTogglesDoNotSkewCount) {
+  // Setting the same value twice must not double-count in the merged
+  // enabled-tracer counter.
+  const int baseline = CurrentEnabledCount();
+  grpc_tracer_set_enabled("trace_test_flag", 1);
+  grpc_tracer_set_enabled("trace_test_flag", 1);
+  EXPECT_EQ(CurrentEnabledCount(), baseline + 1);
+  grpc_tracer_set_enabled("trace_test_flag", 0);
+  EXPECT_EQ(CurrentEnabledCount(), baseline);
+  EXPECT_FALSE(test_flag.enabled());
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -212,9 +212,26 @@ static void test_invoke_10_simple_requests(grpc_end2end_test_config config) {
   config.tear_down_data(&f);
 }
 
+static void test_register_invalid_method(grpc_end2end_test_config config) {
+  grpc_end2end_test_fixture f =
+      begin_test(config, "test_register_invalid_method", nullptr, nullptr);
+  // Methods and hosts are validated at registration time; illegal header
+  // values must be rejected rather than handed to calls.
+  GPR_ASSERT(grpc_channel_register_call(f.client, "/foo\nbar", nullptr,
+                                        nullptr) == nullptr);
+  GPR_ASSERT(grpc_channel_register_call(f.client, "/foo", "host\r\n",
+                                        nullptr) == nullptr);
+  // A legal pair is still accepted.
+  GPR_ASSERT(grpc_channel_register_call(f.client, "/foo", "example.com",
+                                        nullptr) != nullptr);
+  end_test(&f);
+  config.tear_down_data(&f);
+}
+
 void registered_call(grpc_end2end_test_config config) {
   test_invoke_simple_request(config);
   test_invoke_10_simple_requests(config);
+  test_register_invalid_method(config);
 }
 
 void registered_call_pre_init(void) {}
@@ -15,6 +15,7 @@
 
 #include "src/core/lib/event_engine/work_queue.h"
 
+#include <atomic>
 #include <thread>
 #include <vector>
 
@@ -139,6 +140,94 @@ TEST(WorkQueueTest, OldestEnqueuedTimestampOrderingIsCorrect) {
   ASSERT_GT(youngest_ts, oldest_ts);
 }
 
+TEST(WorkQueueTest, SingleProducerBasicOps) {
+  WorkQueue queue(/*single_producer=*/true);
+  ASSERT_TRUE(queue.Empty());
+  int flag = 0;
+  queue.Add([&flag] { flag |= 1; });
+  queue.Add([&flag] { flag |= 2; });
+  ASSERT_FALSE(queue.Empty());
+  // Owner pops are LIFO.
+  queue.PopBack()->Run();
+  EXPECT_FALSE(flag & 1);
+  EXPECT_TRUE(flag & 2);
+  queue.PopBack()->Run();
+  EXPECT_TRUE(flag & 1);
+  ASSERT_TRUE(queue.Empty());
+  // Thief pops are FIFO.
+  flag = 0;
+  queue.Add([&flag] { flag |= 1; });
+  queue.Add([&flag] { flag |= 2; });
+  queue.PopFront()->Run();
+  EXPECT_TRUE(flag & 1);
+  EXPECT_FALSE(flag & 2);
+  queue.PopFront()->Run();
+  EXPECT_TRUE(flag & 2);
+  ASSERT_TRUE(queue.Empty());
+}
+
+TEST(WorkQueueTest, SingleProducerRingOverflow) {
+  // Push far more elements than the ring can hold so the overflow path into
+  // the mutex-guarded deque is exercised, then drain everything.
+  WorkQueue queue(/*single_producer=*/true);
+  constexpr int element_count = 1000;
+  int run_count = 0;
+  for (int i = 0; i < element_count; i++) {
+    queue.Add([&run_count] { ++run_count; });
+  }
+  ASSERT_FALSE(queue.Empty());
+  while (auto* closure = queue.PopBack()) {
+    closure->Run();
+  }
+  EXPECT_EQ(run_count, element_count);
+  EXPECT_TRUE(queue.Empty());
+}
+
+TEST(WorkQueueTest, SingleProducerThreadedStealStress) {
+  WorkQueue queue(/*single_producer=*/true);
+  constexpr int thief_count = 8;
+  constexpr int element_count = 10000;
+  std::atomic<int> run_count{0};
+  std::atomic<bool> done{false};
+  class TestClosure : public EventEngine::Closure {
+   public:
+    explicit TestClosure(std::atomic<int>* run_count)
+        : run_count_(run_count) {}
+    void Run() override {
+      run_count_->fetch_add(1, std::memory_order_relaxed);
+      delete this;
+    }
+
+   private:
+    std::atomic<int>* run_count_;
+  };
+  std::vector<std::thread> thieves;
+  thieves.reserve(thief_count);
+  for (int i = 0; i < thief_count; i++) {
+    thieves.emplace_back([&] {
+      while (!done.load(std::memory_order_relaxed)) {
+        if (auto* c = queue.PopFront()) c->Run();
+      }
+    });
+  }
+  // The owner interleaves pushes with LIFO pops.
+  for (int i = 0; i < element_count; i++) {
+    queue.Add(new TestClosure(&run_count));
+    if (i % 3 == 0) {
+      if (auto* c = queue.PopBack()) c->Run();
+    }
+  }
+  while (auto* c = queue.PopBack()) c->Run();
+  while (run_count.load(std::memory_order_relaxed) < element_count) {
+    absl::SleepFor(absl::Milliseconds(1));
+    while (auto* c = queue.PopBack()) c->Run();
+  }
+  done.store(true, std::memory_order_relaxed);
+  for (auto& thief : thieves) thief.join();
+  EXPECT_EQ(run_count.load(), element_count);
+  EXPECT_TRUE(queue.Empty());
+}
+
 TEST(WorkQueueTest, ThreadedStress) {
   WorkQueue queue;
   constexpr int thd_count = 33;
@@ -0,0 +1,100 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/gprpp/adaptive_mutex.h"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+TEST(AdaptiveMutexTest, LockUnlock) {
+  AdaptiveMutex mu;
+  mu.Lock();
+  mu.Unlock();
+  EXPECT_EQ(mu.stats().contentions, 0u);
+  EXPECT_EQ(mu.stats().parks, 0u);
+}
+
+TEST(AdaptiveMutexTest, TryLock) {
+  AdaptiveMutex mu;
+  EXPECT_TRUE(mu.TryLock());
+  EXPECT_FALSE(mu.TryLock());
+  mu.Unlock();
+  EXPECT_TRUE(mu.TryLock());
+  mu.Unlock();
+}
+
+TEST(AdaptiveMutexTest, ScopedLock) {
+  AdaptiveMutex mu;
+  {
+    AdaptiveMutexLock lock(&mu);
+    EXPECT_FALSE(mu.TryLock());
+  }
+  EXPECT_TRUE(mu.TryLock());
+  mu.Unlock();
+}
+
+TEST(AdaptiveMutexTest, MutualExclusionStress) {
+  AdaptiveMutex mu;
+  int counter = 0;
+  constexpr int kThreads = 8;
+  constexpr int kIncrementsPerThread = 100000;
+  std::vector<std::thread> threads;
+  threads.reserve(kThreads);
+  for (int i = 0; i < kThreads; i++) {
+    threads.emplace_back([&mu, &counter] {
+      for (int j = 0; j < kIncrementsPerThread; j++) {
+        AdaptiveMutexLock lock(&mu);
+        counter++;
+      }
+    });
+  }
+  for (auto& t : threads) t.join();
+  EXPECT_EQ(counter, kThreads * kIncrementsPerThread);
+  // Stats are heuristics, but parking implies contention.
+  AdaptiveMutex::Stats stats = mu.stats();
+  EXPECT_GE(stats.contentions, stats.parks);
+}
+
+TEST(AdaptiveMutexTest, ParksUnderLongHold) {
+  AdaptiveMutex mu;
+  mu.Lock();
+  std::thread waiter([&mu] {
+    // Contends against a hold far longer than any spin budget, so this
+    // Lock() must eventually park rather than spin forever.
+    mu.Lock();
+    mu.Unlock();
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  mu.Unlock();
+  waiter.join();
+  AdaptiveMutex::Stats stats = mu.stats();
+  EXPECT_GE(stats.contentions, 1u);
+  EXPECT_GE(stats.parks, 1u);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
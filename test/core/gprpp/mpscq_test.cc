@@ -61,6 +61,56 @@ TEST(MpscqTest, Serial) {
   }
 }
 
+TEST(MpscqTest, PopAllSerial) {
+  gpr_log(GPR_DEBUG, "test_pop_all_serial");
+  MultiProducerSingleConsumerQueue q;
+  EXPECT_EQ(q.PopAll(), nullptr);
+  for (size_t i = 0; i < 100000; i++) {
+    q.Push(&new_node(i, nullptr)->node);
+  }
+  MultiProducerSingleConsumerQueue::Node* list = q.PopAll();
+  for (size_t i = 0; i < 100000; i++) {
+    ASSERT_NE(list, nullptr);
+    test_node* n = reinterpret_cast<test_node*>(list);
+    list = n->node.next.load(std::memory_order_relaxed);
+    ASSERT_EQ(n->i, i);
+    delete n;
+  }
+  ASSERT_EQ(list, nullptr);
+  EXPECT_EQ(q.PopAll(), nullptr);
+  // The queue must remain usable after a drain.
+  q.Push(&new_node(0, nullptr)->node);
+  test_node* n = reinterpret_cast<test_node*>(q.Pop());
+  ASSERT_NE(n, nullptr);
+  ASSERT_EQ(n->i, 0);
+  delete n;
+}
+
+TEST(MpscqTest, PopAllAfterPartialPop) {
+  gpr_log(GPR_DEBUG, "test_pop_all_after_partial_pop");
+  MultiProducerSingleConsumerQueue q;
+  for (size_t i = 0; i < 100; i++) {
+    q.Push(&new_node(i, nullptr)->node);
+  }
+  // Pop part of the chain one node at a time, then drain the rest in one
+  // go; PopAll must cope with the stub being mid-chain.
+  for (size_t i = 0; i < 40; i++) {
+    test_node* n = reinterpret_cast<test_node*>(q.Pop());
+    ASSERT_NE(n, nullptr);
+    ASSERT_EQ(n->i, i);
+    delete n;
+  }
+  MultiProducerSingleConsumerQueue::Node* list = q.PopAll();
+  for (size_t i = 40; i < 100; i++) {
+    ASSERT_NE(list, nullptr);
+    test_node* n = reinterpret_cast<test_node*>(list);
+    list = n->node.next.load(std::memory_order_relaxed);
+    ASSERT_EQ(n->i, i);
+    delete n;
+  }
+  ASSERT_EQ(list, nullptr);
+}
+
 typedef struct {
   size_t ctr;
   MultiProducerSingleConsumerQueue* q;
@@ -111,6 +161,42 @@ TEST(MpscqTest, Mt) {
   }
 }
 
+TEST(MpscqTest, MtPopAll) {
+  gpr_log(GPR_DEBUG, "test_mt_pop_all");
+  gpr_event start;
+  gpr_event_init(&start);
+  grpc_core::Thread thds[100];
+  thd_args ta[GPR_ARRAY_SIZE(thds)];
+  MultiProducerSingleConsumerQueue q;
+  for (size_t i = 0; i < GPR_ARRAY_SIZE(thds); i++) {
+    ta[i].ctr = 0;
+    ta[i].q = &q;
+    ta[i].start = &start;
+    thds[i] = grpc_core::Thread("grpc_mt_popall_test", test_thread, &ta[i]);
+    thds[i].Start();
+  }
+  size_t num_done = 0;
+  size_t drains = 0;
+  gpr_event_set(&start, reinterpret_cast<void*>(1));
+  while (num_done != GPR_ARRAY_SIZE(thds)) {
+    MultiProducerSingleConsumerQueue::Node* list = q.PopAll();
+    if (list == nullptr) continue;
+    drains++;
+    while (list != nullptr) {
+      test_node* tn = reinterpret_cast<test_node*>(list);
+      list = tn->node.next.load(std::memory_order_relaxed);
+      ASSERT_EQ(*tn->ctr, tn->i - 1);
+      *tn->ctr = tn->i;
+      if (tn->i == THREAD_ITERATIONS) num_done++;
+      delete tn;
+    }
+  }
+  gpr_log(GPR_DEBUG, "drains: %" PRIdPTR, drains);
+  for (auto& th : thds) {
+    th.Join();
+  }
+}
+
 typedef struct {
   thd_args* ta;
   size_t num_thds;
@@ -21,6 +21,7 @@
 #include <memory>
 #include <new>
 #include <set>
+#include <thread>
 #include <type_traits>
 
 #include "gmock/gmock.h"
@@ -53,6 +54,53 @@ TEST(RefCounted, ExtraRef) {
   foo->Unref();
 }
 
+class BiasedFoo : public RefCounted<BiasedFoo, PolymorphicRefCount,
+                                    kUnrefDelete, BiasedRefCount> {
+ public:
+  explicit BiasedFoo(bool* destroyed) : destroyed_(destroyed) {}
+  ~BiasedFoo() { *destroyed_ = true; }
+
+ private:
+  bool* destroyed_;
+};
+
+TEST(BiasedRefCounted, Basic) {
+  bool destroyed = false;
+  BiasedFoo* foo = new BiasedFoo(&destroyed);
+  foo->Ref().release();
+  foo->Unref();
+  EXPECT_FALSE(destroyed);
+  foo->Unref();
+  EXPECT_TRUE(destroyed);
+}
+
+TEST(BiasedRefCounted, CrossThreadUnrefLast) {
+  bool destroyed = false;
+  BiasedFoo* foo = new BiasedFoo(&destroyed);
+  std::thread ref_thread([foo] { foo->Ref().release(); });
+  ref_thread.join();
+  // Dropping the owner's only ref retires the bias; the cross-thread ref
+  // keeps the object alive.
+  foo->Unref();
+  EXPECT_FALSE(destroyed);
+  std::thread unref_thread([foo] { foo->Unref(); });
+  unref_thread.join();
+  EXPECT_TRUE(destroyed);
+}
+
+TEST(BiasedRefCounted, OwnerReleasesCrossThreadRef) {
+  bool destroyed = false;
+  BiasedFoo* foo = new BiasedFoo(&destroyed);
+  std::thread ref_thread([foo] { foo->Ref().release(); });
+  ref_thread.join();
+  foo->Unref();  // retires the bias
+  EXPECT_FALSE(destroyed);
+  // The owner releases the ref taken on the other thread, now in shared
+  // atomic mode.
+  foo->Unref();
+  EXPECT_TRUE(destroyed);
+}
+
 class Value : public RefCounted<Value, PolymorphicRefCount, kUnrefNoDelete> {
  public:
   Value(int value, std::set<std::unique_ptr<Value>>* registry) : value_(value) {
@@ -27,6 +27,8 @@
 #include "gtest/gtest.h"
 #include "upb/upb.hpp"
 
+#include "test/core/util/tracer_util.h"
+
 namespace grpc_core {
 namespace {
 
@@ -40,11 +42,32 @@ TEST(StatusUtilTest, CreateStatus) {
   EXPECT_EQ(true, StatusGetStr(s, StatusStrProperty::kFile).has_value());
   EXPECT_EQ(true, StatusGetInt(s, StatusIntProperty::kFileLine).has_value());
 #endif
-  EXPECT_EQ(true, StatusGetTime(s, StatusTimeProperty::kCreated).has_value());
+  // Creation time is only materialized when the status_details tracer is
+  // enabled.
+  EXPECT_EQ(false, StatusGetTime(s, StatusTimeProperty::kCreated).has_value());
   EXPECT_THAT(StatusGetChildren(s),
               ::testing::ElementsAre(absl::CancelledError()));
 }
 
+TEST(StatusUtilTest, InternStatus) {
+  absl::Status s = StatusIntern(absl::StatusCode::kUnavailable, "test");
+  EXPECT_EQ(absl::StatusCode::kUnavailable, s.code());
+  EXPECT_EQ("test", s.message());
+  EXPECT_EQ(s, StatusIntern(absl::StatusCode::kUnavailable, "test"));
+  // Attaching a payload must not affect the interned singleton.
+  StatusSetInt(&s, StatusIntProperty::kErrorNo, 2021);
+  absl::Status s2 = StatusIntern(absl::StatusCode::kUnavailable, "test");
+  EXPECT_EQ(absl::optional<intptr_t>(),
+            StatusGetInt(s2, StatusIntProperty::kErrorNo));
+}
+
+TEST(StatusUtilTest, CreateStatusWithDetailsTracer) {
+  testing::grpc_tracer_enable_flag(&grpc_status_details_trace);
+  absl::Status s =
+      StatusCreate(absl::StatusCode::kUnknown, "Test", DEBUG_LOCATION, {});
+  EXPECT_EQ(true, StatusGetTime(s, StatusTimeProperty::kCreated).has_value());
+}
+
 TEST(StatusUtilTest, SetAndGetInt) {
   absl::Status s = absl::CancelledError();
   StatusSetInt(&s, StatusIntProperty::kErrorNo, 2021);
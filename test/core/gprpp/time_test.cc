@@ -41,6 +41,18 @@ TEST(TimestampTest, ToString) {
   EXPECT_EQ(Timestamp::InfPast().ToString(), "@-∞");
 }
 
+TEST(TimestampTest, CoarseNowTracksNow) {
+  for (int i = 0; i < 1000; i++) {
+    Timestamp before = Timestamp::Now();
+    Timestamp coarse = Timestamp::NowCoarse();
+    Timestamp after = Timestamp::Now();
+    // The coarse clock may lag by up to its refresh interval, but must
+    // never run ahead of a subsequent precise reading.
+    EXPECT_GE(coarse, before - Duration::Milliseconds(5));
+    EXPECT_LE(coarse, after);
+  }
+}
+
 TEST(DurationTest, Empty) { EXPECT_EQ(Duration(), Duration::Zero()); }
 
 TEST(DurationTest, Scales) {
@@ -41,7 +41,6 @@ TEST(FormatRequestTest, FormatGetRequest) {
   ASSERT_EQ(grpc_core::StringViewFromSlice(slice),
             "GET /index.html HTTP/1.1\r\n"
             "Host: example.com\r\n"
-            "Connection: close\r\n"
             "User-Agent: " GRPC_HTTPCLI_USER_AGENT
             "\r\n"
             "x-yz: abc\r\n"
@@ -67,7 +66,6 @@ TEST(FormatRequestTest, FormatPostRequest) {
   ASSERT_EQ(grpc_core::StringViewFromSlice(slice),
             "POST /index.html HTTP/1.1\r\n"
             "Host: example.com\r\n"
-            "Connection: close\r\n"
             "User-Agent: " GRPC_HTTPCLI_USER_AGENT
             "\r\n"
             "x-yz: abc\r\n"
@@ -94,7 +92,6 @@ TEST(FormatRequestTest, FormatPostRequestNoBody) {
   ASSERT_EQ(grpc_core::StringViewFromSlice(slice),
             "POST /index.html HTTP/1.1\r\n"
             "Host: example.com\r\n"
-            "Connection: close\r\n"
             "User-Agent: " GRPC_HTTPCLI_USER_AGENT
             "\r\n"
             "x-yz: abc\r\n"
@@ -124,7 +121,6 @@ TEST(FormatRequestTest, FormatPostRequestContentTypeOverride) {
   ASSERT_EQ(grpc_core::StringViewFromSlice(slice),
             "POST /index.html HTTP/1.1\r\n"
             "Host: example.com\r\n"
-            "Connection: close\r\n"
             "User-Agent: " GRPC_HTTPCLI_USER_AGENT
             "\r\n"
             "x-yz: abc\r\n"
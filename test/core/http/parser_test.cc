@@ -267,6 +267,23 @@ TEST(ParserTest, MainTest) {
                   "\r\n",
                   200, "HTTP Trailers are also supported.", "Transfer-Encoding",
                   "chunked", "abc", "xyz", NULL);
+    test_succeeds(split_modes[i],
+                  "HTTP/1.1 200 OK\r\n"
+                  "Content-Length: 12\r\n"
+                  "\r\n"
+                  "hello world!",
+                  200, "hello world!", "Content-Length", "12", NULL);
+    test_succeeds(split_modes[i],
+                  "HTTP/1.1 204 No Content\r\n"
+                  "Content-Length: 0\r\n"
+                  "\r\n",
+                  204, nullptr, "Content-Length", "0", NULL);
+    /* bytes past the declared Content-Length are rejected */
+    test_fails(split_modes[i],
+               "HTTP/1.1 200 OK\r\n"
+               "Content-Length: 1\r\n"
+               "\r\n"
+               "ab");
     test_request_succeeds(split_modes[i],
                           "GET / HTTP/1.0\r\n"
                           "\r\n",
@@ -14,6 +14,8 @@
 
 #include "src/core/lib/promise/arena_promise.h"
 
+#include <stdint.h>
+
 #include <memory>
 
 #include "absl/types/variant.h"
@@ -52,6 +54,43 @@ TEST(ArenaPromiseTest, AllocatedWorks) {
   EXPECT_EQ(p(), Poll<int>(43));
 }
 
+TEST(ArenaPromiseTest, InlineCallableAvoidsArenaAllocation) {
+  ExecCtx exec_ctx;
+  auto arena = MakeScopedArena(1024, g_memory_allocator);
+  TestContext<Arena> context(arena.get());
+#ifndef NDEBUG
+  ArenaPromiseAllocationStats stats;
+  TestContext<ArenaPromiseAllocationStats> stats_context(&stats);
+#endif
+  // Three words of trivially copyable captures fit in the inline slots.
+  uint64_t a = 1, b = 2, c = 39;
+  ArenaPromise<int> p(
+      [a, b, c] { return Poll<int>(static_cast<int>(a + b + c)); });
+  ArenaPromise<int> q(std::move(p));
+  EXPECT_EQ(q(), Poll<int>(42));
+#ifndef NDEBUG
+  EXPECT_EQ(stats.allocation_count, 0u);
+  EXPECT_EQ(stats.allocated_bytes, 0u);
+#endif
+}
+
+#ifndef NDEBUG
+TEST(ArenaPromiseTest, AllocationStatsCountArenaSpills) {
+  ExecCtx exec_ctx;
+  auto arena = MakeScopedArena(1024, g_memory_allocator);
+  TestContext<Arena> context(arena.get());
+  ArenaPromiseAllocationStats stats;
+  TestContext<ArenaPromiseAllocationStats> stats_context(&stats);
+  // Four words of captures exceed the inline slots and spill to the arena.
+  uint64_t a = 1, b = 2, c = 3, d = 36;
+  ArenaPromise<int> p(
+      [a, b, c, d] { return Poll<int>(static_cast<int>(a + b + c + d)); });
+  EXPECT_EQ(p(), Poll<int>(42));
+  EXPECT_EQ(stats.allocation_count, 1u);
+  EXPECT_EQ(stats.allocated_bytes, 4 * sizeof(uint64_t));
+}
+#endif
+
 TEST(ArenaPromiseTest, DestructionWorks) {
   ExecCtx exec_ctx;
   auto arena = MakeScopedArena(1024, g_memory_allocator);
@@ -0,0 +1,104 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/promise/group_wakeup_scheduler.h"
+
+#include <memory>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "gtest/gtest.h"
+
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/promise/activity.h"
+#include "src/core/lib/promise/poll.h"
+
+namespace grpc_core {
+
+TEST(GroupWakeupSchedulerTest, Works) {
+  auto group = MakeRefCounted<WakeupGroup>();
+  int state = 0;
+  bool done = false;
+  auto activity = MakeActivity(
+      [&state]() mutable -> Poll<absl::Status> {
+        ++state;
+        switch (state) {
+          case 1:
+            return Pending();
+          case 2:
+            return absl::OkStatus();
+          default:
+            abort();
+        }
+      },
+      GroupWakeupScheduler(group),
+      [&done](absl::Status status) {
+        EXPECT_EQ(status, absl::OkStatus());
+        done = true;
+      });
+
+  EXPECT_EQ(state, 1);
+  EXPECT_FALSE(done);
+  {
+    ExecCtx exec_ctx;
+    EXPECT_FALSE(exec_ctx.HasWork());
+    activity->ForceWakeup();
+    EXPECT_TRUE(exec_ctx.HasWork());
+    EXPECT_EQ(state, 1);
+    EXPECT_FALSE(done);
+  }
+  EXPECT_EQ(state, 2);
+  EXPECT_TRUE(done);
+}
+
+TEST(GroupWakeupSchedulerTest, BatchesWakeupsAcrossActivities) {
+  auto group = MakeRefCounted<WakeupGroup>();
+  static constexpr int kActivities = 5;
+  std::vector<int> polls(kActivities, 0);
+  int done = 0;
+  std::vector<ActivityPtr> activities;
+  for (int i = 0; i < kActivities; i++) {
+    activities.emplace_back(MakeActivity(
+        [&polls, i]() mutable -> Poll<absl::Status> {
+          if (++polls[i] == 1) return Pending();
+          return absl::OkStatus();
+        },
+        GroupWakeupScheduler(group),
+        [&done](absl::Status status) {
+          EXPECT_EQ(status, absl::OkStatus());
+          ++done;
+        }));
+  }
+
+  for (int i = 0; i < kActivities; i++) EXPECT_EQ(polls[i], 1);
+  EXPECT_EQ(done, 0);
+  {
+    ExecCtx exec_ctx;
+    // Waking every activity enqueues exactly one closure for the group.
+    for (auto& activity : activities) activity->ForceWakeup();
+    EXPECT_TRUE(exec_ctx.HasWork());
+    EXPECT_EQ(done, 0);
+  }
+  // All activities were polled to completion by the one batched wakeup.
+  for (int i = 0; i < kActivities; i++) EXPECT_EQ(polls[i], 2);
+  EXPECT_EQ(done, kActivities);
+}
+
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -60,6 +60,19 @@ TEST(ArenaTest, ManagedNew) {
   arena->Destroy();
 }
 
+TEST(ArenaTest, RecycledZones) {
+  ExecCtx exec_ctx;
+  // Overflow zones are recycled through a pool between arenas; repeatedly
+  // overflowing the initial zone at the same size exercises both the take and
+  // put sides of the pool, and the writes check the storage is usable.
+  for (int i = 0; i < 100; i++) {
+    Arena* arena = Arena::Create(1, g_memory_allocator);
+    char* p = static_cast<char*>(arena->Alloc(4000));
+    memset(p, 42, 4000);
+    arena->Destroy();
+  }
+}
+
 struct AllocShape {
   size_t initial_size;
   std::vector<size_t> allocs;
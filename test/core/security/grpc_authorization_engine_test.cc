@@ -19,6 +19,8 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "test/core/util/evaluate_args_test_util.h"
+
 namespace grpc_core {
 
 TEST(GrpcAuthorizationEngineTest, AllowEngineWithMatchingPolicy) {
@@ -95,6 +97,65 @@ TEST(GrpcAuthorizationEngineTest, DenyEngineWithNoMatchingPolicy) {
   EXPECT_TRUE(decision.matching_policy_name.empty());
 }
 
+namespace {
+
+// Policies whose permissions are all path rules, so the engine's compiled
+// path index (exact table, prefix table, regex set) picks the candidates.
+Rbac MakePathConstrainedRbac(Rbac::Action action) {
+  std::map<std::string, Rbac::Policy> policies;
+  policies["exact"] = Rbac::Policy(
+      Rbac::Permission::MakePathPermission(
+          StringMatcher::Create(StringMatcher::Type::kExact, "/pkg.svc/Foo")
+              .value()),
+      Rbac::Principal::MakeAnyPrincipal());
+  policies["prefix"] = Rbac::Policy(
+      Rbac::Permission::MakePathPermission(
+          StringMatcher::Create(StringMatcher::Type::kPrefix, "/pkg.svc/Bar")
+              .value()),
+      Rbac::Principal::MakeAnyPrincipal());
+  policies["regex"] = Rbac::Policy(
+      Rbac::Permission::MakePathPermission(
+          StringMatcher::Create(StringMatcher::Type::kSafeRegex,
+                                "/pkg\\.svc/Baz.*")
+              .value()),
+      Rbac::Principal::MakeAnyPrincipal());
+  return Rbac(action, std::move(policies));
+}
+
+}  // namespace
+
+TEST(GrpcAuthorizationEngineTest, PathIndexSelectsMatchingPolicy) {
+  GrpcAuthorizationEngine engine(MakePathConstrainedRbac(Rbac::Action::kAllow));
+  struct {
+    const char* path;
+    const char* expected_policy;
+  } cases[] = {
+      {"/pkg.svc/Foo", "exact"},
+      {"/pkg.svc/BarSomething", "prefix"},
+      {"/pkg.svc/BazMethod", "regex"},
+  };
+  for (const auto& test : cases) {
+    EvaluateArgsTestUtil util;
+    util.AddPairToMetadata(":path", test.path);
+    AuthorizationEngine::Decision decision =
+        engine.Evaluate(util.MakeEvaluateArgs());
+    EXPECT_EQ(decision.type, AuthorizationEngine::Decision::Type::kAllow)
+        << test.path;
+    EXPECT_EQ(decision.matching_policy_name, test.expected_policy)
+        << test.path;
+  }
+}
+
+TEST(GrpcAuthorizationEngineTest, PathIndexRejectsNonMatchingPath) {
+  GrpcAuthorizationEngine engine(MakePathConstrainedRbac(Rbac::Action::kAllow));
+  EvaluateArgsTestUtil util;
+  util.AddPairToMetadata(":path", "/other.svc/Method");
+  AuthorizationEngine::Decision decision =
+      engine.Evaluate(util.MakeEvaluateArgs());
+  EXPECT_EQ(decision.type, AuthorizationEngine::Decision::Type::kDeny);
+  EXPECT_TRUE(decision.matching_policy_name.empty());
+}
+
 TEST(GrpcAuthorizationEngineTest, DenyEngineWithEmptyPolicies) {
   GrpcAuthorizationEngine engine(Rbac::Action::kDeny);
   AuthorizationEngine::Decision decision =
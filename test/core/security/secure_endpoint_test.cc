@@ -53,7 +53,8 @@ static void me_read(grpc_endpoint* ep, grpc_slice_buffer* slices,
 }
 
 static void me_write(grpc_endpoint* ep, grpc_slice_buffer* slices,
-                     grpc_closure* cb, void* arg, int max_frame_size) {
+                     grpc_closure* cb, void* arg, int max_frame_size,
+                     bool more_coming) {
   intercept_endpoint* m = reinterpret_cast<intercept_endpoint*>(ep);
   int remaining = slices->length;
   while (remaining > 0) {
@@ -68,7 +69,8 @@ static void me_write(grpc_endpoint* ep, grpc_slice_buffer* slices,
     remaining -= next_frame_size;
   }
   grpc_slice_buffer_swap(&m->staging_buffer, slices);
-  grpc_endpoint_write(m->wrapped_ep, slices, cb, arg, max_frame_size);
+  grpc_endpoint_write(m->wrapped_ep, slices, cb, arg, max_frame_size,
+                      more_coming);
 }
 
 static void me_add_to_pollset(grpc_endpoint* /*ep*/,
@@ -142,6 +142,66 @@ void test_slice_buffer_move_first() {
   ASSERT_EQ(dst.length, dst_len);
 }
 
+void test_slice_buffer_move_into() {
+  grpc_slice_buffer src;
+  grpc_slice_buffer dst;
+
+  grpc_slice_buffer_init(&src);
+  grpc_slice_buffer_init(&dst);
+  grpc_slice_buffer_add(&dst, grpc_slice_from_copied_string("aaa"));
+  /* Populate src with more slices than fit in its inline storage so that the
+     splice into dst must grow dst's slice array. */
+  for (int idx = 0; idx < 3 * GRPC_SLICE_BUFFER_INLINE_ELEMENTS; idx++) {
+    grpc_slice_buffer_add_indexed(&src, grpc_slice_from_copied_string("bb"));
+  }
+  size_t src_len = src.length;
+  size_t dst_len = dst.length;
+
+  grpc_slice_buffer_move_into(&src, &dst);
+  ASSERT_EQ(src.count, 0);
+  ASSERT_EQ(src.length, 0);
+  ASSERT_EQ(dst.length, src_len + dst_len);
+
+  /* Moving into an empty buffer swaps the contents across. */
+  grpc_slice_buffer_move_into(&dst, &src);
+  ASSERT_EQ(dst.count, 0);
+  ASSERT_EQ(dst.length, 0);
+  ASSERT_EQ(src.length, src_len + dst_len);
+
+  grpc_slice_buffer_destroy(&src);
+  grpc_slice_buffer_destroy(&dst);
+}
+
+void test_slice_buffer_trim_end() {
+  grpc_slice_buffer buf;
+
+  grpc_slice_buffer_init(&buf);
+  grpc_slice_buffer_add_indexed(&buf, grpc_slice_from_copied_string("aaa"));
+  grpc_slice_buffer_add_indexed(&buf, grpc_slice_from_copied_string("bbbb"));
+
+  /* Trim part of the last slice, discarding the removed bytes. */
+  grpc_slice_buffer_trim_end(&buf, 2, nullptr);
+  ASSERT_EQ(buf.count, 2);
+  ASSERT_EQ(buf.length, 5);
+  grpc_slice tail = grpc_slice_buffer_take_first(&buf);
+  grpc_slice_unref(tail);
+  tail = grpc_slice_buffer_take_first(&buf);
+  ASSERT_EQ(grpc_slice_str_cmp(tail, "bb"), 0);
+  grpc_slice_unref(tail);
+
+  /* Trim across a slice boundary, keeping the removed bytes. */
+  grpc_slice_buffer_add_indexed(&buf, grpc_slice_from_copied_string("ccc"));
+  grpc_slice_buffer_add_indexed(&buf, grpc_slice_from_copied_string("dd"));
+  grpc_slice_buffer garbage;
+  grpc_slice_buffer_init(&garbage);
+  grpc_slice_buffer_trim_end(&buf, 3, &garbage);
+  ASSERT_EQ(buf.length, 2);
+  ASSERT_EQ(garbage.length, 3);
+
+  grpc_slice_buffer_destroy(&buf);
+  grpc_slice_buffer_destroy(&garbage);
+}
+
 void test_slice_buffer_first() {
   grpc_slice slices[3];
   slices[0] = grpc_slice_from_copied_string("aaa");
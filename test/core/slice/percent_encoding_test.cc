@@ -116,6 +116,11 @@ TEST(PercentEncodingTest, MainTest) {
   TEST_VECTOR("\xff", "%FF", grpc_core::PercentEncodingType::URL);
   TEST_VECTOR("\xee", "%EE", grpc_core::PercentEncodingType::URL);
   TEST_VECTOR("%2", "%252", grpc_core::PercentEncodingType::URL);
+  // long runs of clean bytes around escapes exercise the bulk-copy paths
+  TEST_VECTOR(
+      " leading-and-trailing-escapes-with-a-long-clean-run-in-the-middle ",
+      "%20leading-and-trailing-escapes-with-a-long-clean-run-in-the-middle%20",
+      grpc_core::PercentEncodingType::URL);
   TEST_NONCONFORMANT_VECTOR("%", "%");
   TEST_NONCONFORMANT_VECTOR("%A", "%A");
   TEST_NONCONFORMANT_VECTOR("%AG", "%AG");
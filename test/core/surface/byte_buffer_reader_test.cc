@@ -224,6 +224,70 @@ TEST(GrpcByteBufferReaderTest, TestReadall) {
   grpc_byte_buffer_destroy(buffer);
 }
 
+TEST(GrpcByteBufferReaderTest, TestViewSingleSlice) {
+  char* lotsa_as[512];
+  grpc_slice slice;
+  grpc_byte_buffer* buffer;
+  grpc_byte_buffer_reader reader;
+  grpc_slice slice_out;
+
+  LOG_TEST("test_view_single_slice");
+
+  memset(lotsa_as, 'a', 512 * sizeof(lotsa_as[0]));
+  /* use a slice large enough to overflow inlining */
+  slice = grpc_slice_malloc(512);
+  memcpy(GRPC_SLICE_START_PTR(slice), lotsa_as, 512);
+
+  buffer = grpc_raw_byte_buffer_create(&slice, 1);
+
+  ASSERT_TRUE(grpc_byte_buffer_reader_init(&reader, buffer) &&
+              "Couldn't init byte buffer reader");
+  slice_out = grpc_byte_buffer_reader_view(&reader);
+
+  ASSERT_EQ(GRPC_SLICE_LENGTH(slice_out), 512);
+  ASSERT_EQ(memcmp(GRPC_SLICE_START_PTR(slice_out), lotsa_as, 512), 0);
+  /* the view must be zero-copy: same backing storage as the input slice */
+  ASSERT_EQ(GRPC_SLICE_START_PTR(slice_out), GRPC_SLICE_START_PTR(slice));
+  grpc_slice_unref(slice);
+  grpc_byte_buffer_destroy(buffer);
+  /* the view holds its own reference, so the data stays valid */
+  ASSERT_EQ(memcmp(GRPC_SLICE_START_PTR(slice_out), lotsa_as, 512), 0);
+  grpc_slice_unref(slice_out);
+}
+
+TEST(GrpcByteBufferReaderTest, TestViewMultipleSlices) {
+  char* lotsa_as[512];
+  char* lotsa_bs[1024];
+  grpc_slice slices[2];
+  grpc_byte_buffer* buffer;
+  grpc_byte_buffer_reader reader;
+  grpc_slice slice_out;
+
+  LOG_TEST("test_view_multiple_slices");
+
+  memset(lotsa_as, 'a', 512 * sizeof(lotsa_as[0]));
+  memset(lotsa_bs, 'b', 1024 * sizeof(lotsa_bs[0]));
+  /* use slices large enough to overflow inlining */
+  slices[0] = grpc_slice_malloc(512);
+  memcpy(GRPC_SLICE_START_PTR(slices[0]), lotsa_as, 512);
+  slices[1] = grpc_slice_malloc(1024);
+  memcpy(GRPC_SLICE_START_PTR(slices[1]), lotsa_bs, 1024);
+
+  buffer = grpc_raw_byte_buffer_create(slices, 2);
+  grpc_slice_unref(slices[0]);
+  grpc_slice_unref(slices[1]);
+
+  ASSERT_TRUE(grpc_byte_buffer_reader_init(&reader, buffer) &&
+              "Couldn't init byte buffer reader");
+  slice_out = grpc_byte_buffer_reader_view(&reader);
+
+  ASSERT_EQ(GRPC_SLICE_LENGTH(slice_out), 512 + 1024);
+  ASSERT_EQ(memcmp(GRPC_SLICE_START_PTR(slice_out), lotsa_as, 512), 0);
+  ASSERT_EQ(memcmp(&(GRPC_SLICE_START_PTR(slice_out)[512]), lotsa_bs, 1024), 0);
+  grpc_slice_unref(slice_out);
+  grpc_byte_buffer_destroy(buffer);
+}
+
 TEST(GrpcByteBufferReaderTest, TestByteBufferCopy) {
   char* lotsa_as[512];
   char* lotsa_bs[1024];
@@ -93,6 +93,7 @@ int main(int argc, char **argv) {
   printf("%lx", (unsigned long) grpc_completion_queue_create_for_callback);
   printf("%lx", (unsigned long) grpc_completion_queue_create);
   printf("%lx", (unsigned long) grpc_completion_queue_next);
+  printf("%lx", (unsigned long) grpc_completion_queue_next_batch);
   printf("%lx", (unsigned long) grpc_completion_queue_pluck);
   printf("%lx", (unsigned long) grpc_completion_queue_shutdown);
   printf("%lx", (unsigned long) grpc_completion_queue_destroy);
@@ -107,6 +108,7 @@ int main(int argc, char **argv) {
   printf("%lx", (unsigned long) grpc_channel_create_registered_call);
   printf("%lx", (unsigned long) grpc_call_arena_alloc);
   printf("%lx", (unsigned long) grpc_call_start_batch);
+  printf("%lx", (unsigned long) grpc_call_start_batch_bulk);
   printf("%lx", (unsigned long) grpc_call_get_peer);
   printf("%lx", (unsigned long) grpc_census_call_set_context);
   printf("%lx", (unsigned long) grpc_census_call_get_context);
@@ -134,6 +136,7 @@ int main(int argc, char **argv) {
   printf("%lx", (unsigned long) grpc_server_add_http2_port);
   printf("%lx", (unsigned long) grpc_server_start);
   printf("%lx", (unsigned long) grpc_server_shutdown_and_notify);
+  printf("%lx", (unsigned long) grpc_server_drain_progress);
   printf("%lx", (unsigned long) grpc_server_cancel_all_calls);
   printf("%lx", (unsigned long) grpc_server_destroy);
   printf("%lx", (unsigned long) grpc_tracer_set_enabled);
@@ -150,6 +153,8 @@ int main(int argc, char **argv) {
   printf("%lx", (unsigned long) grpc_resource_quota_arg_vtable);
   printf("%lx", (unsigned long) grpc_channelz_get_top_channels);
   printf("%lx", (unsigned long) grpc_channelz_get_servers);
+  printf("%lx", (unsigned long) grpc_channelz_get_top_channels_batch);
+  printf("%lx", (unsigned long) grpc_channelz_get_servers_batch);
   printf("%lx", (unsigned long) grpc_channelz_get_server);
   printf("%lx", (unsigned long) grpc_channelz_get_server_sockets);
   printf("%lx", (unsigned long) grpc_channelz_get_channel);
@@ -240,6 +245,7 @@ int main(int argc, char **argv) {
   printf("%lx", (unsigned long) grpc_byte_buffer_reader_next);
   printf("%lx", (unsigned long) grpc_byte_buffer_reader_peek);
   printf("%lx", (unsigned long) grpc_byte_buffer_reader_readall);
+  printf("%lx", (unsigned long) grpc_byte_buffer_reader_view);
   printf("%lx", (unsigned long) grpc_raw_byte_buffer_from_reader);
   printf("%lx", (unsigned long) gpr_log_severity_string);
   printf("%lx", (unsigned long) gpr_log);
@@ -0,0 +1,86 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/surface/validate_metadata.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include <grpc/slice.h>
+
+#include "src/core/lib/iomgr/error.h"
+#include "test/core/util/test_config.h"
+
+namespace {
+
+bool KeyIsLegal(const std::string& key) {
+  grpc_slice slice = grpc_slice_from_copied_buffer(key.data(), key.size());
+  grpc_error_handle error = grpc_validate_header_key_is_legal(slice);
+  grpc_slice_unref(slice);
+  return error.ok();
+}
+
+bool NonBinValueIsLegal(const std::string& value) {
+  grpc_slice slice = grpc_slice_from_copied_buffer(value.data(), value.size());
+  grpc_error_handle error = grpc_validate_header_nonbin_value_is_legal(slice);
+  grpc_slice_unref(slice);
+  return error.ok();
+}
+
+TEST(ValidateMetadataTest, Keys) {
+  EXPECT_TRUE(KeyIsLegal("key"));
+  EXPECT_TRUE(KeyIsLegal("abcdefghijklmnopqrstuvwxyz0123456789-_."));
+  EXPECT_FALSE(KeyIsLegal(""));
+  EXPECT_FALSE(KeyIsLegal(":path"));
+  EXPECT_FALSE(KeyIsLegal("KEY"));
+  EXPECT_FALSE(KeyIsLegal("key with space"));
+}
+
+TEST(ValidateMetadataTest, LongKeys) {
+  // Spans several 16-byte chunks to exercise the vectorized scan.
+  std::string key(100, 'a');
+  EXPECT_TRUE(KeyIsLegal(key));
+  // An illegal byte anywhere must be caught: in a full chunk and in the tail.
+  for (size_t i : {size_t{0}, size_t{15}, size_t{16}, size_t{50}, size_t{99}}) {
+    std::string bad = key;
+    bad[i] = 'A';
+    EXPECT_FALSE(KeyIsLegal(bad)) << "offset " << i;
+  }
+}
+
+TEST(ValidateMetadataTest, NonBinValues) {
+  EXPECT_TRUE(NonBinValueIsLegal(""));
+  EXPECT_TRUE(NonBinValueIsLegal("any printable ASCII: ~!@#$%^&*()"));
+  EXPECT_FALSE(NonBinValueIsLegal(std::string("embedded\0nul", 12)));
+  EXPECT_FALSE(NonBinValueIsLegal("tab\tseparated"));
+}
+
+TEST(ValidateMetadataTest, LongNonBinValues) {
+  std::string value(500, ' ');
+  EXPECT_TRUE(NonBinValueIsLegal(value));
+  for (size_t i : {size_t{0}, size_t{31}, size_t{32}, size_t{499}}) {
+    std::string bad = value;
+    bad[i] = '\x7f';
+    EXPECT_FALSE(NonBinValueIsLegal(bad)) << "offset " << i;
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
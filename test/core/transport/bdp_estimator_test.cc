@@ -98,6 +98,18 @@ TEST(BdpEstimatorTest, GetEstimate3Samples) {
   est.EstimateBdp();
 }
 
+TEST(BdpEstimatorTest, ProbeBackoffAndResume) {
+  BdpEstimator est("test");
+  // A steady estimate backs off the probe cadence exponentially.
+  for (int i = 0; i < 10; i++) {
+    AddSample(&est, 100);
+  }
+  EXPECT_GT(est.inter_ping_delay(), Duration::Milliseconds(100));
+  // Traffic resumption after quiescence restores the aggressive cadence.
+  est.ResumeProbing();
+  EXPECT_EQ(est.inter_ping_delay(), Duration::Milliseconds(100));
+}
+
 namespace {
 int64_t NextPow2(int64_t v) {
   v--;
@@ -0,0 +1,69 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+
+#include <grpc/slice.h>
+
+#include "src/core/ext/transport/chttp2/transport/bin_decoder.h"
+#include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
+
+bool squelch = true;
+bool leak_check = true;
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+  // Round trip: whatever the encoder produces, both decoders must restore,
+  // regardless of which (vectorized or scalar) code path handles it.
+  grpc_slice original =
+      grpc_slice_from_copied_buffer(reinterpret_cast<const char*>(data), size);
+  grpc_slice encoded = grpc_chttp2_base64_encode(original);
+  grpc_slice decoded = grpc_chttp2_base64_decode_with_length(encoded, size);
+  if (!grpc_slice_eq(original, decoded)) {
+    fprintf(stderr, "Failed: decode_with_length round trip, size %zu\n", size);
+    abort();
+  }
+  grpc_slice_unref(decoded);
+
+  // The padded variant: grpc_chttp2_base64_decode requires '=' padding to a
+  // multiple of four characters.
+  std::string padded(reinterpret_cast<const char*>(GRPC_SLICE_START_PTR(encoded)),
+                     GRPC_SLICE_LENGTH(encoded));
+  while (padded.size() % 4 != 0) padded.push_back('=');
+  grpc_slice padded_slice =
+      grpc_slice_from_copied_buffer(padded.data(), padded.size());
+  grpc_slice padded_decoded = grpc_chttp2_base64_decode(padded_slice);
+  if (!grpc_slice_eq(original, padded_decoded)) {
+    fprintf(stderr, "Failed: padded decode round trip, size %zu\n", size);
+    abort();
+  }
+  grpc_slice_unref(padded_decoded);
+  grpc_slice_unref(padded_slice);
+  grpc_slice_unref(encoded);
+
+  // Arbitrary (usually invalid) input must be rejected without crashing.
+  grpc_slice raw =
+      grpc_slice_from_copied_buffer(reinterpret_cast<const char*>(data), size);
+  size_t inferred = grpc_chttp2_base64_infer_length_after_decode(raw);
+  grpc_slice_unref(grpc_chttp2_base64_decode_with_length(raw, inferred));
+  if (size % 4 == 0) {
+    grpc_slice_unref(grpc_chttp2_base64_decode(raw));
+  }
+  grpc_slice_unref(raw);
+  grpc_slice_unref(original);
+  return 0;
+}
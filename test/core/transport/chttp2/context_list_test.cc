@@ -21,6 +21,7 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <string>
 #include <vector>
 
 #include "absl/status/status.h"
@@ -30,6 +31,7 @@
 #include <grpc/slice.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/atm.h>
+#include <grpc/support/time.h>
 
 #include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
 #include "src/core/ext/transport/chttp2/transport/internal.h"
@@ -167,6 +169,50 @@ TEST_F(ContextListTest, NonEmptyListEmptyTimestamp) {
   exec_ctx.Flush();
 }
 
+/** Tests that, with TX byte-latency tracing enabled and no external tracing
+ * callbacks registered, an ACKed write is recorded against the transport's
+ * channelz socket with its stream id.
+ */
+TEST_F(ContextListTest, TxByteAckLatencyReportedToChannelz) {
+  grpc_http2_set_write_timestamps_callback(nullptr);
+  grpc_http2_set_fn_get_copied_context(nullptr);
+  ContextList* list = nullptr;
+  ExecCtx exec_ctx;
+  grpc_stream_refcount ref;
+  GRPC_STREAM_REF_INIT(&ref, 1, nullptr, nullptr, "phony ref");
+  grpc_endpoint* mock_endpoint = grpc_mock_endpoint_create(discard_write);
+  auto args = CoreConfiguration::Get()
+                  .channel_args_preconditioning()
+                  .PreconditionChannelArgs(nullptr)
+                  .Set(GRPC_ARG_HTTP2_TX_BYTE_LATENCY_TRACING, 1)
+                  .Set(GRPC_ARG_ENABLE_CHANNELZ, 1);
+  grpc_transport* t = grpc_create_chttp2_transport(args, mock_endpoint, true);
+  grpc_chttp2_transport* ct = reinterpret_cast<grpc_chttp2_transport*>(t);
+  ASSERT_TRUE(ct->tx_byte_latency_tracing);
+  ASSERT_NE(ct->channelz_socket, nullptr);
+  grpc_chttp2_stream* s = static_cast<grpc_chttp2_stream*>(
+      gpr_malloc(grpc_transport_stream_size(t)));
+  grpc_transport_init_stream(t, reinterpret_cast<grpc_stream*>(s), &ref,
+                             nullptr, nullptr);
+  s->id = 1;
+  s->byte_counter = kByteOffset;
+  ContextList::Append(&list, s);
+  ASSERT_NE(list, nullptr);
+  Timestamps ts;
+  ts.sendmsg_time.time = gpr_now(GPR_CLOCK_REALTIME);
+  ts.acked_time.time = gpr_time_add(ts.sendmsg_time.time,
+                                    gpr_time_from_millis(5, GPR_TIMESPAN));
+  ContextList::Execute(list, &ts, absl::OkStatus());
+  std::string json = ct->channelz_socket->RenderJson().Dump();
+  EXPECT_NE(json.find("txByteAckLatencyCount"), std::string::npos) << json;
+  EXPECT_NE(json.find("\"streamId\":\"1\""), std::string::npos) << json;
+  grpc_transport_destroy_stream(t, reinterpret_cast<grpc_stream*>(s), nullptr);
+  exec_ctx.Flush();
+  gpr_free(s);
+  grpc_transport_destroy(t);
+  exec_ctx.Flush();
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc_core
@@ -25,6 +25,7 @@
 #include "absl/types/optional.h"
 
 #include "src/core/ext/transport/chttp2/transport/decode_huff.h"
+#include "src/core/ext/transport/chttp2/transport/decode_huff_fast.h"
 #include "src/core/ext/transport/chttp2/transport/huffsyms.h"
 
 bool squelch = true;
@@ -87,13 +88,25 @@ absl::optional<std::vector<uint8_t>> DecodeHuffFast(const uint8_t* begin,
   return v;
 }
 
+absl::optional<std::vector<uint8_t>> DecodeHuffChunked(const uint8_t* begin,
+                                                       const uint8_t* end) {
+  std::vector<uint8_t> v;
+  auto f = [&](uint8_t x) { v.push_back(x); };
+  if (!grpc_core::HuffDecodeFast<decltype(f)>(f, begin, end)) {
+    return absl::nullopt;
+  }
+  return v;
+}
+
 extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
   auto slow = DecodeHuffSlow(data, data + size);
   auto fast = DecodeHuffFast(data, data + size);
-  if (slow != fast) {
-    fprintf(stderr, "MISMATCH:\ninpt: %s\nslow: %s\nfast: %s\n",
+  auto chunked = DecodeHuffChunked(data, data + size);
+  if (slow != fast || slow != chunked) {
+    fprintf(stderr, "MISMATCH:\ninpt: %s\nslow: %s\nfast: %s\nchnk: %s\n",
             ToString(std::vector<uint8_t>(data, data + size)).c_str(),
-            ToString(slow).c_str(), ToString(fast).c_str());
+            ToString(slow).c_str(), ToString(fast).c_str(),
+            ToString(chunked).c_str());
     abort();
   }
   return 0;
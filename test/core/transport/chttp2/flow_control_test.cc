@@ -145,6 +145,7 @@ TEST(FlowControl, GradualReadsUpdate) {
   StreamFlowControl sfc(&tfc);
   int immediate_updates = 0;
   int queued_updates = 0;
+  int deferred_updates = 0;
   for (int i = 0; i < 65535; i++) {
     StreamFlowControl::IncomingUpdateContext sfc_upd(&sfc);
     EXPECT_EQ(sfc_upd.RecvData(1), absl::OkStatus());
@@ -157,12 +158,60 @@ TEST(FlowControl, GradualReadsUpdate) {
         queued_updates++;
         break;
       case FlowControlAction::Urgency::NO_ACTION_NEEDED:
+        deferred_updates++;
         break;
     }
   }
-  EXPECT_GT(immediate_updates, 0);
+  // Sub-threshold updates are deferred entirely; once an eighth of the
+  // window is pending they get queued, and at 8k they force a write.
+  EXPECT_GT(deferred_updates, 0);
   EXPECT_GT(queued_updates, 0);
-  EXPECT_EQ(immediate_updates + queued_updates, 65535);
+  EXPECT_GT(immediate_updates, 0);
+  EXPECT_EQ(immediate_updates + queued_updates + deferred_updates, 65535);
+}
+
+TEST(FlowControl, SmallUpdatesAreDeferred) {
+  ExecCtx exec_ctx;
+  TransportFlowControl tfc("test", true, g_memory_owner);
+  StreamFlowControl sfc(&tfc);
+  {
+    StreamFlowControl::IncomingUpdateContext sfc_upd(&sfc);
+    EXPECT_EQ(sfc_upd.RecvData(1024), absl::OkStatus());
+    sfc_upd.SetPendingSize(0);
+    EXPECT_EQ(sfc_upd.MakeAction().send_stream_update(),
+              FlowControlAction::Urgency::NO_ACTION_NEEDED);
+  }
+  // Far below an eighth of the window: nothing is emitted, even though a
+  // write is happening anyway.
+  EXPECT_EQ(sfc.MaybeSendUpdate(), 0);
+  EXPECT_EQ(sfc.announced_window_delta(), -1024);
+  // An outstanding read forces the pending update out regardless of size.
+  {
+    StreamFlowControl::IncomingUpdateContext sfc_upd(&sfc);
+    sfc_upd.SetMinProgressSize(1);
+    sfc_upd.MakeAction();
+  }
+  EXPECT_GT(sfc.MaybeSendUpdate(), 0);
+  EXPECT_EQ(sfc.announced_window_delta(), 1);
+}
+
+TEST(FlowControl, TransportPiggybackedUpdateDeferred) {
+  ExecCtx exec_ctx;
+  TransportFlowControl tfc("test", true, g_memory_owner);
+  {
+    TransportFlowControl::IncomingUpdateContext tfc_upd(&tfc);
+    EXPECT_EQ(tfc_upd.RecvData(1024), absl::OkStatus());
+    tfc_upd.MakeAction();
+  }
+  // 1024 pending out of 65535 is below the piggyback threshold.
+  EXPECT_EQ(tfc.MaybeSendUpdate(true), 0);
+  {
+    TransportFlowControl::IncomingUpdateContext tfc_upd(&tfc);
+    EXPECT_EQ(tfc_upd.RecvData(16384), absl::OkStatus());
+    tfc_upd.MakeAction();
+  }
+  // Now more than an eighth of the window is pending.
+  EXPECT_EQ(tfc.MaybeSendUpdate(true), 1024u + 16384u);
 }
 
 }  // namespace chttp2
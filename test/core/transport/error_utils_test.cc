@@ -123,6 +123,19 @@ TEST(ErrorUtilsTest, GrpcErrorUnavailableToAbslStatus) {
             "weighted_target: all children report state TRANSIENT_FAILURE");
 }
 
+TEST(ErrorUtilsTest, PlainAbslStatusToAbslStatusPassesThrough) {
+  absl::Status status = absl::UnavailableError("Making more tea");
+  ASSERT_EQ(grpc_error_to_absl_status(status), status);
+}
+
+TEST(ErrorUtilsTest, AbslStatusToGrpcErrorPassesThroughRoundTrippedStatus) {
+  grpc_error_handle error =
+      absl_status_to_grpc_error(absl::UnavailableError("Making tea"));
+  // A status that already carries its own code as the grpc-status payload is
+  // not re-wrapped.
+  ASSERT_EQ(absl_status_to_grpc_error(error), error);
+}
+
 }  // namespace
 
 int main(int argc, char** argv) {
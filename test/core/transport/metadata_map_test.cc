@@ -83,6 +83,26 @@ TEST(MetadataMapTest, SimpleOps) {
   EXPECT_EQ(map.get(GrpcTimeoutMetadata()), absl::nullopt);
 }
 
+TEST(MetadataMapTest, TakeFromMovesAcrossArenas) {
+  auto src_arena = MakeScopedArena(1024, g_memory_allocator);
+  auto dst_arena = MakeScopedArena(1024, g_memory_allocator);
+  TimeoutOnlyMetadataMap src(src_arena.get());
+  src.Set(GrpcTimeoutMetadata(),
+          Timestamp::FromMillisecondsAfterProcessEpoch(1234));
+  src.Append("unknown-key", Slice::FromStaticString("value"),
+             [](absl::string_view, const Slice&) { abort(); });
+  TimeoutOnlyMetadataMap dst(dst_arena.get());
+  dst.TakeFrom(&src);
+  EXPECT_TRUE(src.empty());
+  EXPECT_EQ(dst.get(GrpcTimeoutMetadata()),
+            Timestamp::FromMillisecondsAfterProcessEpoch(1234));
+  std::string backing;
+  EXPECT_EQ(dst.GetStringValue("unknown-key", &backing), "value");
+  // The destination must not reference the source arena.
+  src = TimeoutOnlyMetadataMap(src_arena.get());
+  EXPECT_EQ(dst.GetStringValue("unknown-key", &backing), "value");
+}
+
 // Target for MetadataMap::Encode.
 // Writes down some string representation of what it receives, so we can
 // EXPECT_EQ it later.
@@ -122,6 +142,37 @@ TEST(MetadataMapTest, TimeoutEncodeTest) {
   EXPECT_EQ(encoder.output(), "grpc-timeout: deadline=1234\n");
 }
 
+TEST(MetadataMapTest, FusedEncodeTraversesOnce) {
+  FakeEncoder encoder_a;
+  FakeEncoder encoder_b;
+  auto arena = MakeScopedArena(1024, g_memory_allocator);
+  TimeoutOnlyMetadataMap map(arena.get());
+  map.Set(GrpcTimeoutMetadata(),
+          Timestamp::FromMillisecondsAfterProcessEpoch(1234));
+  const size_t traversals_before = map.TraversalCount();
+  map.Encode(&encoder_a, &encoder_b);
+  EXPECT_EQ(encoder_a.output(), "grpc-timeout: deadline=1234\n");
+  EXPECT_EQ(encoder_b.output(), "grpc-timeout: deadline=1234\n");
+  EXPECT_EQ(map.TraversalCount(), traversals_before + 1);
+}
+
+TEST(MetadataMapTest, TransportSizeIsMemoized) {
+  auto arena = MakeScopedArena(1024, g_memory_allocator);
+  TimeoutOnlyMetadataMap map(arena.get());
+  map.Set(GrpcTimeoutMetadata(),
+          Timestamp::FromMillisecondsAfterProcessEpoch(1234));
+  const size_t size = map.TransportSize();
+  const size_t traversals_after_first = map.TraversalCount();
+  // Asking again without mutating should not traverse again.
+  EXPECT_EQ(map.TransportSize(), size);
+  EXPECT_EQ(map.TraversalCount(), traversals_after_first);
+  // Mutation invalidates the memoized size, forcing a fresh traversal.
+  map.Set(GrpcTimeoutMetadata(),
+          Timestamp::FromMillisecondsAfterProcessEpoch(1234567));
+  map.TransportSize();
+  EXPECT_GT(map.TraversalCount(), traversals_after_first);
+}
+
 TEST(MetadataMapTest, NonEncodableTrait) {
   struct EncoderWithNoTraitEncodeFunctions {
     void Encode(const Slice&, const Slice&) {
@@ -142,6 +142,35 @@ TEST(SslSessionCacheTest, LruCache) {
   EXPECT_EQ(tracker.AliveCount(), 0);
 }
 
+TEST(SslSessionCacheTest, Stats) {
+  SessionTracker tracker;
+  RefCountedPtr<tsi::SslSessionLRUCache> cache =
+      tsi::SslSessionLRUCache::Create(3);
+  // Lookup on an empty cache is a miss.
+  EXPECT_FALSE(cache->Get("first.dropbox.com"));
+  tsi::SslSessionLRUCache::Stats stats = cache->stats();
+  EXPECT_EQ(stats.hits, 0);
+  EXPECT_EQ(stats.misses, 1);
+  EXPECT_EQ(stats.evictions, 0);
+  // Lookup after insertion is a hit.
+  cache->Put("first.dropbox.com", tracker.NewSession(1));
+  EXPECT_TRUE(cache->Get("first.dropbox.com"));
+  stats = cache->stats();
+  EXPECT_EQ(stats.hits, 1);
+  EXPECT_EQ(stats.misses, 1);
+  EXPECT_EQ(stats.evictions, 0);
+  // Overflowing the capacity evicts the oldest session.
+  for (long id = 2; id < 6; id++) {
+    std::string domain = std::to_string(id) + ".random.domain";
+    cache->Put(domain.c_str(), tracker.NewSession(id));
+  }
+  stats = cache->stats();
+  EXPECT_EQ(stats.hits, 1);
+  EXPECT_EQ(stats.misses, 1);
+  EXPECT_EQ(stats.evictions, 2);
+  EXPECT_EQ(cache->Size(), 3);
+}
+
 }  // namespace
 }  // namespace grpc_core
 
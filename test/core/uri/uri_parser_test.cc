@@ -217,6 +217,48 @@ TEST_F(URIParserTest, InvalidURIsResultInFailureStatuses) {
   TestFails("0invalid_scheme:must_start/with?alpha");
 }
 
+TEST(URIViewTest, ComponentsAreViewsIntoOriginalStringAndStillEncoded) {
+  std::string uri_text =
+      "https://www.google.com:555/path%2Fwith%2Fslashes?a=1%26b%3D2&c=3#frag";
+  absl::StatusOr<URIView> view = URIView::Parse(uri_text);
+  ASSERT_TRUE(view.ok()) << view.status();
+  EXPECT_EQ(view->scheme(), "https");
+  EXPECT_EQ(view->authority(), "www.google.com:555");
+  // Components are not percent-decoded.
+  EXPECT_EQ(view->path(), "/path%2Fwith%2Fslashes");
+  EXPECT_EQ(view->query(), "a=1%26b%3D2&c=3");
+  EXPECT_EQ(view->fragment(), "frag");
+  // And they point into the original buffer.
+  EXPECT_GE(view->path().data(), uri_text.data());
+  EXPECT_LE(view->path().data() + view->path().size(),
+            uri_text.data() + uri_text.size());
+}
+
+TEST(URIViewTest, ToURIMatchesDirectParse) {
+  std::string uri_text =
+      "https://foo.com:5555/v1/token-exchange?subject_token=eyJhbGciO&"
+      "subject_token_type=urn:ietf:params:oauth:token-type:id_token#frag";
+  absl::StatusOr<URIView> view = URIView::Parse(uri_text);
+  ASSERT_TRUE(view.ok()) << view.status();
+  absl::StatusOr<URI> direct = URI::Parse(uri_text);
+  ASSERT_TRUE(direct.ok()) << direct.status();
+  URI materialized = view->ToURI();
+  EXPECT_EQ(materialized.scheme(), direct->scheme());
+  EXPECT_EQ(materialized.authority(), direct->authority());
+  EXPECT_EQ(materialized.path(), direct->path());
+  EXPECT_THAT(materialized.query_parameter_pairs(),
+              ContainerEq(direct->query_parameter_pairs()));
+  EXPECT_EQ(materialized.fragment(), direct->fragment());
+  EXPECT_EQ(materialized.ToString(), direct->ToString());
+}
+
+TEST(URIViewTest, AppliesSameValidationAsOwningParse) {
+  EXPECT_FALSE(URIView::Parse("xyz").ok());
+  EXPECT_FALSE(URIView::Parse("http://foo?[bar]").ok());
+  EXPECT_FALSE(URIView::Parse(":no_scheme").ok());
+  EXPECT_FALSE(URIView::Parse("").ok());
+}
+
 TEST(URITest, PercentEncodePath) {
   EXPECT_EQ(URI::PercentEncodePath(
                 // These chars are allowed.
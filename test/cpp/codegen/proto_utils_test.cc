@@ -89,6 +89,21 @@ TEST_F(ProtoUtilsTest, TinyBackupThenNext) {
   EXPECT_EQ(block_size, size);
 }
 
+TEST_F(ProtoUtilsTest, PooledBlockIsReused) {
+  grpc_slice s1 = AcquireProtoBufferBlock(4096);
+  const uint8_t* p1 = GRPC_SLICE_START_PTR(s1);
+  grpc_slice_unref(s1);
+  grpc_slice s2 = AcquireProtoBufferBlock(4096);
+  EXPECT_EQ(p1, GRPC_SLICE_START_PTR(s2));
+  grpc_slice_unref(s2);
+}
+
+TEST_F(ProtoUtilsTest, PooledBlockRoundsUpToBucketSize) {
+  grpc_slice s = AcquireProtoBufferBlock(5000);
+  EXPECT_EQ(static_cast<size_t>(8192), GRPC_SLICE_LENGTH(s));
+  grpc_slice_unref(s);
+}
+
 namespace {
 
 // Set backup_size to 0 to indicate no backup is needed.
@@ -38,6 +38,7 @@
 #include "src/cpp/ext/filters/census/context.h"
 #include "src/cpp/ext/filters/census/grpc_plugin.h"
 #include "src/cpp/ext/filters/census/open_census_call_tracer.h"
+#include "src/cpp/ext/filters/census/stats_buffer.h"
 #include "src/proto/grpc/testing/echo.grpc.pb.h"
 #include "test/core/util/test_config.h"
 #include "test/cpp/end2end/test_service_impl.h"
@@ -781,6 +782,39 @@ TEST_F(StatsPluginEnd2EndTest, TestObservabilityDisabledChannelArg) {
   ASSERT_EQ(attempt_span_data, recorded_spans.end());
 }
 
+TEST_F(StatsPluginEnd2EndTest, BufferedStatsRecording) {
+  // Buffering is sticky-global: measurements recorded after this point go
+  // through the per-CPU buffers for the remainder of the process. Any test
+  // that runs after this one still passes, because the buffers' flush period
+  // is well below the sleeps the tests already perform.
+  grpc::experimental::EnableOpenCensusStatsBuffering();
+  View client_started_rpcs_view(ClientStartedRpcsCumulative());
+  View server_started_rpcs_view(ServerStartedRpcsCumulative());
+
+  EchoRequest request;
+  request.set_message("foo");
+  EchoResponse response;
+  const int count = 5;
+  for (int i = 0; i < count; ++i) {
+    grpc::ClientContext context;
+    grpc::Status status = stub_->Echo(&context, request, &response);
+    ASSERT_TRUE(status.ok());
+    EXPECT_EQ("foo", response.message());
+  }
+  // Drain the per-CPU buffers synchronously rather than waiting for the
+  // flush timer.
+  FlushCensusStatsBuffers();
+  absl::SleepFor(absl::Milliseconds(500 * grpc_test_slowdown_factor()));
+  TestUtils::Flush();
+
+  EXPECT_THAT(client_started_rpcs_view.GetData().int_data(),
+              ::testing::UnorderedElementsAre(::testing::Pair(
+                  ::testing::ElementsAre(client_method_name_), count)));
+  EXPECT_THAT(server_started_rpcs_view.GetData().int_data(),
+              ::testing::UnorderedElementsAre(::testing::Pair(
+                  ::testing::ElementsAre(server_method_name_), count)));
+}
+
 }  // namespace
 
 }  // namespace testing
@@ -20,6 +20,7 @@
 #include <benchmark/benchmark.h>
 
 #include "absl/container/btree_map.h"
+#include "absl/strings/str_cat.h"
 
 #include <grpcpp/support/channel_arguments.h>
 
@@ -50,6 +51,41 @@ void BM_grpc_channel_args(benchmark::State& state) {
 }
 BENCHMARK(BM_grpc_channel_args);
 
+void BM_ChannelArgsBuildSequential(benchmark::State& state) {
+  std::vector<std::string> keys;
+  for (int i = 0; i < 32; i++) keys.push_back(absl::StrCat("key_", i));
+  for (auto s : state) {
+    grpc_core::ChannelArgs args;
+    for (const auto& key : keys) args = args.Set(key, 42);
+    benchmark::DoNotOptimize(args);
+  }
+}
+BENCHMARK(BM_ChannelArgsBuildSequential);
+
+void BM_ChannelArgsBuildBatch(benchmark::State& state) {
+  std::vector<std::string> keys;
+  for (int i = 0; i < 32; i++) keys.push_back(absl::StrCat("key_", i));
+  for (auto s : state) {
+    grpc_core::ChannelArgs::Builder builder;
+    for (const auto& key : keys) builder.Set(key, 42);
+    benchmark::DoNotOptimize(builder.Build());
+  }
+}
+BENCHMARK(BM_ChannelArgsBuildBatch);
+
+void BM_ChannelArgsBuildFromTemplate(benchmark::State& state) {
+  grpc_core::ChannelArgs::Builder base_builder;
+  for (int i = 0; i < 32; i++) base_builder.Set(absl::StrCat("key_", i), 42);
+  const grpc_core::ChannelArgs base = base_builder.Build();
+  for (auto s : state) {
+    benchmark::DoNotOptimize(grpc_core::ChannelArgs::Builder(base)
+                                 .Set("key_7", 1)
+                                 .Set("extra", 2)
+                                 .Build());
+  }
+}
+BENCHMARK(BM_ChannelArgsBuildFromTemplate);
+
 void BM_ChannelArgsAsKeyIntoMap(benchmark::State& state) {
   std::map<grpc_core::ChannelArgs, int> m;
   std::vector<grpc_core::ChannelArgs> v;
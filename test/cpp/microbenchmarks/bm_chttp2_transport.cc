@@ -102,7 +102,8 @@ class PhonyEndpoint : public grpc_endpoint {
   }
 
   static void write(grpc_endpoint* /*ep*/, grpc_slice_buffer* /*slices*/,
-                    grpc_closure* cb, void* /*arg*/, int /*max_frame_size*/) {
+                    grpc_closure* cb, void* /*arg*/, int /*max_frame_size*/,
+                    bool /*more_coming*/) {
     grpc_core::ExecCtx::Run(DEBUG_LOCATION, cb, absl::OkStatus());
   }
 
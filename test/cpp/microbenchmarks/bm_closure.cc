@@ -25,6 +25,7 @@
 #include <grpc/grpc.h>
 
 #include "src/core/lib/gpr/spinlock.h"
+#include "src/core/lib/iomgr/call_combiner.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/combiner.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
@@ -243,6 +244,47 @@ static void BM_TryAcquireSpinlock(benchmark::State& state) {
 }
 BENCHMARK(BM_TryAcquireSpinlock);
 
+// The uncontended single-batch pattern of a unary call: one closure in
+// flight, Start executes it immediately, Stop finds the queue empty.
+static void BM_CallCombinerStartStop(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_core::CallCombiner call_combiner;
+  grpc_closure c;
+  GRPC_CLOSURE_INIT(&c, DoNothing, nullptr, nullptr);
+  grpc_core::ExecCtx exec_ctx;
+  for (auto _ : state) {
+    GRPC_CALL_COMBINER_START(&call_combiner, &c, absl::OkStatus(), "benchmark");
+    grpc_core::ExecCtx::Get()->Flush();
+    GRPC_CALL_COMBINER_STOP(&call_combiner, "benchmark");
+  }
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_CallCombinerStartStop);
+
+// Two batches in flight: the second Start queues and Stop drains it,
+// exercising the contended MPSC path.
+static void BM_CallCombinerStartStopContended(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_core::CallCombiner call_combiner;
+  grpc_closure c1;
+  grpc_closure c2;
+  GRPC_CLOSURE_INIT(&c1, DoNothing, nullptr, nullptr);
+  GRPC_CLOSURE_INIT(&c2, DoNothing, nullptr, nullptr);
+  grpc_core::ExecCtx exec_ctx;
+  for (auto _ : state) {
+    GRPC_CALL_COMBINER_START(&call_combiner, &c1, absl::OkStatus(),
+                             "benchmark");
+    GRPC_CALL_COMBINER_START(&call_combiner, &c2, absl::OkStatus(),
+                             "benchmark");
+    grpc_core::ExecCtx::Get()->Flush();
+    GRPC_CALL_COMBINER_STOP(&call_combiner, "benchmark");
+    grpc_core::ExecCtx::Get()->Flush();
+    GRPC_CALL_COMBINER_STOP(&call_combiner, "benchmark");
+  }
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_CallCombinerStartStopContended);
+
 static void BM_ClosureSchedOnCombiner(benchmark::State& state) {
   TrackCounters track_counters;
   grpc_core::Combiner* combiner = grpc_combiner_create();
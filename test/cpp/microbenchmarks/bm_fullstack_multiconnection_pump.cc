@@ -0,0 +1,65 @@
+/*
+ *
+ * Copyright 2022 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Benchmark gRPC end2end streaming throughput at multi-connection scale */
+
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/fullstack_multiconnection_pump.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+
+/*******************************************************************************
+ * CONFIGURATIONS
+ */
+
+// Axes: (connections, streams per connection, message size, cq threads).
+// The 64x100 points are where production regressions have been observed.
+BENCHMARK_TEMPLATE(BM_StreamingPumpMultiConnection, TCP)
+    ->ArgNames({"conns", "streams", "msg_sz", "threads"})
+    ->Args({1, 1, 4096, 1})
+    ->Args({4, 25, 4096, 2})
+    ->Args({16, 100, 4096, 4})
+    ->Args({64, 100, 4096, 4})
+    ->Args({64, 100, 65536, 4})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_StreamingPumpMultiConnection, InProcess)
+    ->ArgNames({"conns", "streams", "msg_sz", "threads"})
+    ->Args({1, 1, 4096, 1})
+    ->Args({4, 25, 4096, 2})
+    ->Args({64, 100, 4096, 4})
+    ->UseRealTime();
+
+}  // namespace testing
+}  // namespace grpc
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
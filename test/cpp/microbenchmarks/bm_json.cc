@@ -0,0 +1,90 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Benchmark JSON parsing on service-config-shaped inputs. */
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_join.h"
+
+#include <grpc/support/log.h>
+
+#include "src/core/lib/json/json.h"
+#include "test/core/util/test_config.h"
+
+namespace {
+
+// Builds a service-config-like document: an array of method-config objects
+// with long string values, the shape that resolver updates parse.
+std::string MakeServiceConfigLikeJson(size_t num_methods) {
+  std::vector<std::string> methods;
+  for (size_t i = 0; i < num_methods; i++) {
+    methods.push_back(absl::StrCat(
+        "{\"name\":[{\"service\":\"acme.inventory.v1.WarehouseService",
+        i,
+        "\",\"method\":\"StreamInventoryUpdatesForRegionalDistribution"
+        "Centers\"}],\"timeout\":\"1.500000001s\",\"retryPolicy\":{"
+        "\"maxAttempts\":5,\"initialBackoff\":\"0.1s\",\"maxBackoff\":"
+        "\"30s\",\"backoffMultiplier\":1.6,\"retryableStatusCodes\":["
+        "\"UNAVAILABLE\",\"RESOURCE_EXHAUSTED\"]}}"));
+  }
+  return absl::StrCat("{\"loadBalancingConfig\":[{\"round_robin\":{}}],",
+                      "\"methodConfig\":[", absl::StrJoin(methods, ","), "]}");
+}
+
+void BM_ParseServiceConfigLikeJson(benchmark::State& state) {
+  const std::string json = MakeServiceConfigLikeJson(state.range(0));
+  for (auto _ : state) {
+    auto parsed = grpc_core::Json::Parse(json);
+    GPR_ASSERT(parsed.ok());
+    benchmark::DoNotOptimize(parsed);
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_ParseServiceConfigLikeJson)->Range(1, 1024);
+
+void BM_ParseEscapeHeavyJson(benchmark::State& state) {
+  // Strings full of escapes exercise the slow byte-at-a-time path.
+  std::string value;
+  for (int i = 0; i < state.range(0); i++) {
+    absl::StrAppend(&value, "line\\n\\ttab \\u00e9 ");
+  }
+  const std::string json = absl::StrCat("{\"description\":\"", value, "\"}");
+  for (auto _ : state) {
+    auto parsed = grpc_core::Json::Parse(json);
+    GPR_ASSERT(parsed.ok());
+    benchmark::DoNotOptimize(parsed);
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_ParseEscapeHeavyJson)->Range(1, 1024);
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
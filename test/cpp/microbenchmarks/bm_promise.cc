@@ -0,0 +1,237 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Microbenchmarks for the promise primitives that are taking over the call
+// path, so the migration can be held to the legacy stack's per-call cost.
+
+#include <array>
+#include <tuple>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+
+#include <grpc/event_engine/memory_allocator.h>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/promise/activity.h"
+#include "src/core/lib/promise/arena_promise.h"
+#include "src/core/lib/promise/context.h"
+#include "src/core/lib/promise/join.h"
+#include "src/core/lib/promise/latch.h"
+#include "src/core/lib/promise/map.h"
+#include "src/core/lib/promise/pipe.h"
+#include "src/core/lib/promise/seq.h"
+#include "src/core/lib/promise/try_seq.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+auto* g_memory_allocator = new MemoryAllocator(
+    ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator(
+        "bm_promise"));
+
+// Runs wakeups immediately, so the benchmarks below measure the promise
+// machinery rather than a scheduler.
+struct InlineWakeupScheduler {
+  template <typename ActivityType>
+  void ScheduleWakeup(ActivityType* activity) {
+    activity->RunScheduledWakeup();
+  }
+};
+
+//
+// Seq/TrySeq/Map composition depth
+//
+
+void BM_Seq3(benchmark::State& state) {
+  for (auto _ : state) {
+    auto p = Seq([] { return 1; }, [](int i) { return i + 1; },
+                 [](int i) { return i + 1; });
+    benchmark::DoNotOptimize(p());
+  }
+}
+BENCHMARK(BM_Seq3);
+
+void BM_Seq10(benchmark::State& state) {
+  auto inc = [](int i) { return i + 1; };
+  for (auto _ : state) {
+    auto p = Seq([] { return 1; }, inc, inc, inc, inc, inc, inc, inc, inc, inc);
+    benchmark::DoNotOptimize(p());
+  }
+}
+BENCHMARK(BM_Seq10);
+
+void BM_TrySeq3(benchmark::State& state) {
+  for (auto _ : state) {
+    auto p = TrySeq([] { return absl::StatusOr<int>(1); },
+                    [](int i) { return absl::StatusOr<int>(i + 1); },
+                    [](int i) { return absl::StatusOr<int>(i + 1); });
+    benchmark::DoNotOptimize(p());
+  }
+}
+BENCHMARK(BM_TrySeq3);
+
+void BM_TrySeq10(benchmark::State& state) {
+  auto inc = [](int i) { return absl::StatusOr<int>(i + 1); };
+  for (auto _ : state) {
+    auto p = TrySeq([] { return absl::StatusOr<int>(1); }, inc, inc, inc, inc,
+                    inc, inc, inc, inc, inc);
+    benchmark::DoNotOptimize(p());
+  }
+}
+BENCHMARK(BM_TrySeq10);
+
+void BM_Map10(benchmark::State& state) {
+  auto inc = [](int i) { return i + 1; };
+  for (auto _ : state) {
+    auto p = Map(
+        Map(Map(Map(Map(Map(Map(Map(Map(Map([] { return 1; }, inc), inc), inc),
+                                    inc),
+                                inc),
+                            inc),
+                        inc),
+                    inc),
+                inc),
+        inc);
+    benchmark::DoNotOptimize(p());
+  }
+}
+BENCHMARK(BM_Map10);
+
+//
+// Pipe push/pull cycles
+//
+
+void BM_PipePushPull(benchmark::State& state) {
+  for (auto _ : state) {
+    ActivityPtr activity = MakeActivity(
+        [] {
+          Pipe<int> pipe;
+          return Seq(Join(pipe.sender.Push(42),
+                          Map(pipe.receiver.Next(),
+                              [](NextResult<int> r) { return r.value(); })),
+                     [](std::tuple<bool, int>) { return absl::OkStatus(); });
+        },
+        InlineWakeupScheduler(), [](absl::Status) {},
+        MakeScopedArena(1024, g_memory_allocator));
+  }
+}
+BENCHMARK(BM_PipePushPull);
+
+//
+// Activity wakeup latency
+//
+
+void BM_ActivityCreateDestroy(benchmark::State& state) {
+  // Baseline for BM_ActivityForceWakeup: an activity that completes on its
+  // first poll.
+  for (auto _ : state) {
+    ActivityPtr activity = MakeActivity([] { return absl::OkStatus(); },
+                                        InlineWakeupScheduler(),
+                                        [](absl::Status) {});
+  }
+}
+BENCHMARK(BM_ActivityCreateDestroy);
+
+void BM_ActivityForceWakeup(benchmark::State& state) {
+  // The activity never resolves, so every wakeup runs one full poll cycle.
+  ActivityPtr activity = MakeActivity(
+      [] {
+        return []() -> Poll<absl::Status> { return Pending{}; };
+      },
+      InlineWakeupScheduler(), [](absl::Status) {});
+  for (auto _ : state) {
+    activity->ForceWakeup();
+  }
+}
+BENCHMARK(BM_ActivityForceWakeup);
+
+//
+// Latch wait/set cycles
+//
+
+void BM_LatchSetWait(benchmark::State& state) {
+  for (auto _ : state) {
+    ActivityPtr activity = MakeActivity(
+        [] {
+          auto* latch = GetContext<Arena>()->New<Latch<int>>();
+          return Seq(Join(latch->Wait(),
+                          [latch]() {
+                            latch->Set(42);
+                            return true;
+                          }),
+                     [](std::tuple<int*, bool>) { return absl::OkStatus(); });
+        },
+        InlineWakeupScheduler(), [](absl::Status) {},
+        MakeScopedArena(1024, g_memory_allocator));
+  }
+}
+BENCHMARK(BM_LatchSetWait);
+
+//
+// ArenaPromise construction
+//
+
+void BM_ArenaPromiseInlineCapture(benchmark::State& state) {
+  ExecCtx exec_ctx;
+  auto arena = MakeScopedArena(1024, g_memory_allocator);
+  promise_detail::Context<Arena> context(arena.get());
+  int x = 42;
+  for (auto _ : state) {
+    ArenaPromise<int> p([x] { return Poll<int>(x); });
+    benchmark::DoNotOptimize(p());
+  }
+}
+BENCHMARK(BM_ArenaPromiseInlineCapture);
+
+void BM_ArenaPromiseArenaAllocatedCapture(benchmark::State& state) {
+  // A capture too large for the inline slots, so construction allocates from
+  // the arena; the arena is created per iteration to keep memory bounded.
+  ExecCtx exec_ctx;
+  std::array<uint64_t, 8> big = {1, 2, 3, 4, 5, 6, 7, 8};
+  for (auto _ : state) {
+    auto arena = MakeScopedArena(1024, g_memory_allocator);
+    promise_detail::Context<Arena> context(arena.get());
+    ArenaPromise<int> p(
+        [big] { return Poll<int>(static_cast<int>(big[0] + big[7])); });
+    benchmark::DoNotOptimize(p());
+  }
+}
+BENCHMARK(BM_ArenaPromiseArenaAllocatedCapture);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -66,7 +66,8 @@ class BaseFixture : public TrackCounters {};
 class FullstackFixture : public BaseFixture {
  public:
   FullstackFixture(Service* service, const FixtureConfiguration& config,
-                   const std::string& address) {
+                   const std::string& address)
+      : address_(address) {
     ServerBuilder b;
     if (address.length() > 0) {
       b.AddListeningPort(address, InsecureServerCredentials());
@@ -104,7 +105,27 @@ class FullstackFixture : public BaseFixture {
   ServerCompletionQueue* cq() { return cq_.get(); }
   std::shared_ptr<Channel> channel() { return channel_; }
 
+  // Opens an additional client channel to the same server that carries its
+  // own connection: a local subchannel pool plus a distinguishing channel arg
+  // keep it from sharing a subchannel (and thus a transport) with any other
+  // channel. For the in-process fixture every call creates a fresh in-process
+  // transport, so the same multi-connection semantics apply.
+  std::shared_ptr<Channel> NewIndependentChannel(
+      int channel_id,
+      const FixtureConfiguration& config = FixtureConfiguration()) {
+    ChannelArguments args;
+    config.ApplyCommonChannelArguments(&args);
+    args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+    args.SetInt("grpc.testing.independent_channel_id", channel_id);
+    if (address_.length() > 0) {
+      return grpc::CreateCustomChannel(address_, InsecureChannelCredentials(),
+                                       args);
+    }
+    return server_->InProcessChannel(args);
+  }
+
  private:
+  std::string address_;
   std::unique_ptr<Server> server_;
   std::unique_ptr<ServerCompletionQueue> cq_;
   std::shared_ptr<Channel> channel_;
@@ -0,0 +1,281 @@
+/*
+ *
+ * Copyright 2022 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Benchmark gRPC end2end streaming throughput at multi-connection scale.
+   bm_fullstack_streaming_pump measures one stream on one connection; the
+   kernel here is parameterized over (connections, streams per connection,
+   message size, completion queue threads) so scaling cliffs in the combiner
+   and poller show up pre-release. */
+
+#ifndef TEST_CPP_MICROBENCHMARKS_FULLSTACK_MULTICONNECTION_PUMP_H
+#define TEST_CPP_MICROBENCHMARKS_FULLSTACK_MULTICONNECTION_PUMP_H
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <grpcpp/alarm.h>
+
+#include "src/core/lib/gprpp/notification.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/util/histogram.h"
+#include "test/cpp/microbenchmarks/fullstack_context_mutators.h"
+#include "test/cpp/microbenchmarks/fullstack_fixtures.h"
+
+namespace grpc {
+namespace testing {
+
+/*******************************************************************************
+ * BENCHMARKING KERNELS
+ */
+
+namespace multiconnection_pump {
+
+// Messages each stream pumps per batch: enough to amortize stream setup
+// without making the largest configurations take minutes.
+constexpr int kWritesPerStream = 64;
+
+class StreamState;
+
+// Completion queue tags. A cell with a null stream is the sentinel that tells
+// a completion queue thread to exit.
+struct TagCell {
+  StreamState* stream;
+  bool is_client;
+};
+
+// One bidi stream pumping client->server. The client and server sides each
+// keep exactly one operation in flight, so each side's events arrive
+// sequentially (though possibly on different completion queue threads) and
+// per-side state needs no locking.
+class StreamState {
+ public:
+  StreamState(EchoTestService::Stub* stub, EchoTestService::AsyncService* service,
+              ServerCompletionQueue* cq, const EchoRequest* send_request,
+              std::atomic<int>* active_streams,
+              grpc_core::Notification* all_done)
+      : response_rw_(&svr_ctx_),
+        send_request_(send_request),
+        active_streams_(active_streams),
+        all_done_(all_done) {
+    client_tag_.stream = this;
+    client_tag_.is_client = true;
+    server_tag_.stream = this;
+    server_tag_.is_client = false;
+    latencies_ = grpc_histogram_create(0.01, 60e9);
+    service->RequestBidiStream(&svr_ctx_, &response_rw_, cq, cq, &server_tag_);
+    request_rw_ = stub->AsyncBidiStream(&cli_ctx_, cq, &client_tag_);
+  }
+
+  ~StreamState() { grpc_histogram_destroy(latencies_); }
+
+  void OnClientEvent(bool ok) {
+    switch (client_phase_) {
+      case Phase::kStarting:
+        GPR_ASSERT(ok);
+        client_phase_ = Phase::kRunning;
+        StartWrite();
+        break;
+      case Phase::kRunning:
+        GPR_ASSERT(ok);
+        grpc_histogram_add(latencies_, MicrosSince(write_start_));
+        if (++writes_completed_ < kWritesPerStream) {
+          StartWrite();
+        } else {
+          client_phase_ = Phase::kHalfClosing;
+          request_rw_->WritesDone(&client_tag_);
+        }
+        break;
+      case Phase::kHalfClosing:
+        GPR_ASSERT(ok);
+        client_phase_ = Phase::kFinishing;
+        request_rw_->Finish(&final_status_, &client_tag_);
+        break;
+      case Phase::kFinishing:
+        GPR_ASSERT(final_status_.ok());
+        client_phase_ = Phase::kDone;
+        SideDone();
+        break;
+      case Phase::kDone:
+        GPR_ASSERT(false);
+    }
+  }
+
+  void OnServerEvent(bool ok) {
+    switch (server_phase_) {
+      case Phase::kStarting:
+        GPR_ASSERT(ok);
+        server_phase_ = Phase::kRunning;
+        response_rw_.Read(&recv_request_, &server_tag_);
+        break;
+      case Phase::kRunning:
+        if (ok) {
+          response_rw_.Read(&recv_request_, &server_tag_);
+        } else {
+          // Reads fail once the client half-closes.
+          server_phase_ = Phase::kFinishing;
+          response_rw_.Finish(Status::OK, &server_tag_);
+        }
+        break;
+      case Phase::kFinishing:
+        server_phase_ = Phase::kDone;
+        SideDone();
+        break;
+      case Phase::kHalfClosing:
+      case Phase::kDone:
+        GPR_ASSERT(false);
+    }
+  }
+
+  // Only meaningful once the stream has fully completed.
+  void MergeLatenciesInto(grpc_histogram* dst) {
+    grpc_histogram_merge(dst, latencies_);
+  }
+
+ private:
+  enum class Phase { kStarting, kRunning, kHalfClosing, kFinishing, kDone };
+
+  static double MicrosSince(gpr_timespec start) {
+    gpr_timespec diff = gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), start);
+    return static_cast<double>(diff.tv_sec) * 1e6 +
+           static_cast<double>(diff.tv_nsec) / 1e3;
+  }
+
+  void StartWrite() {
+    write_start_ = gpr_now(GPR_CLOCK_MONOTONIC);
+    request_rw_->Write(*send_request_, &client_tag_);
+  }
+
+  void SideDone() {
+    if (sides_pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      if (active_streams_->fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        all_done_->Notify();
+      }
+    }
+  }
+
+  ClientContext cli_ctx_;
+  ServerContext svr_ctx_;
+  ServerAsyncReaderWriter<EchoResponse, EchoRequest> response_rw_;
+  std::unique_ptr<ClientAsyncReaderWriter<EchoRequest, EchoResponse>>
+      request_rw_;
+  const EchoRequest* send_request_;
+  EchoRequest recv_request_;
+  Status final_status_;
+  TagCell client_tag_;
+  TagCell server_tag_;
+  Phase client_phase_ = Phase::kStarting;
+  Phase server_phase_ = Phase::kStarting;
+  int writes_completed_ = 0;
+  gpr_timespec write_start_;
+  grpc_histogram* latencies_;
+  std::atomic<int> sides_pending_{2};
+  std::atomic<int>* active_streams_;
+  grpc_core::Notification* all_done_;
+};
+
+}  // namespace multiconnection_pump
+
+template <class Fixture>
+static void BM_StreamingPumpMultiConnection(benchmark::State& state) {
+  using multiconnection_pump::kWritesPerStream;
+  using multiconnection_pump::StreamState;
+  using multiconnection_pump::TagCell;
+
+  const int connections = static_cast<int>(state.range(0));
+  const int streams_per_connection = static_cast<int>(state.range(1));
+  const int msg_size = static_cast<int>(state.range(2));
+  const int cq_threads = static_cast<int>(state.range(3));
+  const int total_streams = connections * streams_per_connection;
+
+  EchoTestService::AsyncService service;
+  std::unique_ptr<Fixture> fixture(new Fixture(&service));
+  EchoRequest send_request;
+  if (msg_size > 0) {
+    send_request.set_message(std::string(msg_size, 'a'));
+  }
+  grpc_histogram* latencies = grpc_histogram_create(0.01, 60e9);
+  TagCell stop_tag = {nullptr, false};
+
+  while (state.KeepRunningBatch(static_cast<int64_t>(total_streams) *
+                                kWritesPerStream)) {
+    std::atomic<int> active_streams{total_streams};
+    grpc_core::Notification all_done;
+    std::vector<std::unique_ptr<EchoTestService::Stub>> stubs;
+    stubs.reserve(connections);
+    for (int i = 0; i < connections; i++) {
+      stubs.push_back(
+          EchoTestService::NewStub(fixture->NewIndependentChannel(i)));
+    }
+    std::vector<std::unique_ptr<StreamState>> streams;
+    streams.reserve(total_streams);
+    for (int i = 0; i < connections; i++) {
+      for (int j = 0; j < streams_per_connection; j++) {
+        streams.emplace_back(new StreamState(stubs[i].get(), &service,
+                                             fixture->cq(), &send_request,
+                                             &active_streams, &all_done));
+      }
+    }
+    std::vector<std::thread> workers;
+    workers.reserve(cq_threads);
+    for (int i = 0; i < cq_threads; i++) {
+      workers.emplace_back([&fixture] {
+        void* t;
+        bool ok;
+        while (fixture->cq()->Next(&t, &ok)) {
+          TagCell* cell = static_cast<TagCell*>(t);
+          if (cell->stream == nullptr) return;
+          if (cell->is_client) {
+            cell->stream->OnClientEvent(ok);
+          } else {
+            cell->stream->OnServerEvent(ok);
+          }
+        }
+      });
+    }
+    all_done.WaitForNotification();
+    // One sentinel per completion queue thread to unblock it.
+    std::vector<std::unique_ptr<Alarm>> stop_alarms;
+    stop_alarms.reserve(cq_threads);
+    for (int i = 0; i < cq_threads; i++) {
+      stop_alarms.emplace_back(new Alarm);
+      stop_alarms.back()->Set(fixture->cq(), gpr_now(GPR_CLOCK_MONOTONIC),
+                              &stop_tag);
+    }
+    for (auto& w : workers) {
+      w.join();
+    }
+    for (auto& stream : streams) {
+      stream->MergeLatenciesInto(latencies);
+    }
+  }
+
+  fixture->Finish(state);
+  fixture.reset();
+  state.SetBytesProcessed(static_cast<int64_t>(msg_size) * state.iterations());
+  state.counters["p99_latency_us"] = grpc_histogram_percentile(latencies, 99);
+  grpc_histogram_destroy(latencies);
+}
+
+}  // namespace testing
+}  // namespace grpc
+
+#endif  // TEST_CPP_MICROBENCHMARKS_FULLSTACK_MULTICONNECTION_PUMP_H
@@ -17,6 +17,7 @@
  */
 
 #include <cstring>
+#include <utility>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -66,6 +67,24 @@ TEST_F(ByteBufferTest, CreateFromVector) {
   EXPECT_EQ(strlen(kContent1) + strlen(kContent2), buffer.Length());
 }
 
+TEST_F(ByteBufferTest, MoveCtorStealsContents) {
+  Slice s(kContent1);
+  ByteBuffer buffer1(&s, 1);
+  ByteBuffer buffer2(std::move(buffer1));
+  EXPECT_FALSE(buffer1.Valid());
+  EXPECT_EQ(strlen(kContent1), buffer2.Length());
+}
+
+TEST_F(ByteBufferTest, MoveAssignmentStealsContents) {
+  Slice s(kContent1);
+  ByteBuffer buffer1(&s, 1);
+  Slice s2(kContent2);
+  ByteBuffer buffer2(&s2, 1);
+  buffer2 = std::move(buffer1);
+  EXPECT_FALSE(buffer1.Valid());
+  EXPECT_EQ(strlen(kContent1), buffer2.Length());
+}
+
 TEST_F(ByteBufferTest, Clear) {
   Slice s(kContent1);
   ByteBuffer buffer(&s, 1);
@@ -326,7 +326,7 @@ static int rfc_6724_compare(const void* a, const void* b) {
   return (int)(first->original_index - second->original_index);
 }
 
-void address_sorting_override_source_addr_factory_for_testing(
+void address_sorting_override_source_addr_factory(
     address_sorting_source_addr_factory* factory) {
   if (g_current_source_addr_factory == NULL) {
     abort();
@@ -335,6 +335,11 @@ void address_sorting_override_source_addr_factory_for_testing(
   g_current_source_addr_factory = factory;
 }
 
+void address_sorting_override_source_addr_factory_for_testing(
+    address_sorting_source_addr_factory* factory) {
+  address_sorting_override_source_addr_factory(factory);
+}
+
 static void sanity_check_private_fields_are_unused(
     const address_sorting_sortable* sortable) {
   address_sorting_address expected_source_addr;
@@ -90,6 +90,18 @@ typedef struct address_sorting_source_addr_factory {
   const address_sorting_source_addr_factory_vtable* vtable;
 } address_sorting_source_addr_factory;
 
+/* Creates the source address factory that address_sorting_init() installs
+ * for the current platform. Exposed so that callers can build factories
+ * that wrap the platform's source address lookup. */
+address_sorting_source_addr_factory*
+address_sorting_create_source_addr_factory_for_current_platform();
+
+/* Replaces the currently installed source address factory (which must
+ * exist) with *factory*, taking ownership of it. The previous factory is
+ * destroyed. */
+void address_sorting_override_source_addr_factory(
+    address_sorting_source_addr_factory* factory);
+
 /* Platform-compatible address family types */
 typedef enum {
   ADDRESS_SORTING_AF_INET,
@@ -160,10 +160,39 @@ with open('src/core/lib/experiments/experiments.h', 'w') as H:
     print(file=H)
     print("namespace grpc_core {", file=H)
     print(file=H)
+    print("#ifdef GRPC_EXPERIMENTS_ARE_FINAL", file=H)
+    print(
+        "// Experiments are frozen to their default values at compile time: gated",
+        file=H)
+    print(
+        "// code paths fold to constants and the losing side is dead-stripped.",
+        file=H)
+    print("// GRPC_EXPERIMENTS has no effect in this build mode.", file=H)
+    for attr in attrs:
+        fn = snake_to_pascal(attr['name'])
+        default = DEFAULTS[attr['default']]
+        if default in ('kDefaultForDebugOnly', 'kDefaultForReleaseOnly'):
+            dbg = 'true' if default == 'kDefaultForDebugOnly' else 'false'
+            rel = 'false' if default == 'kDefaultForDebugOnly' else 'true'
+            print("#ifdef NDEBUG", file=H)
+            print("inline constexpr bool Is%sEnabled() { return %s; }" %
+                  (fn, rel),
+                  file=H)
+            print("#else", file=H)
+            print("inline constexpr bool Is%sEnabled() { return %s; }" %
+                  (fn, dbg),
+                  file=H)
+            print("#endif", file=H)
+        else:
+            print("inline constexpr bool Is%sEnabled() { return %s; }" %
+                  (fn, default),
+                  file=H)
+    print("#else", file=H)
     for i, attr in enumerate(attrs):
         print("inline bool Is%sEnabled() { return IsExperimentEnabled(%d); }" %
               (snake_to_pascal(attr['name']), i),
               file=H)
+    print("#endif  // GRPC_EXPERIMENTS_ARE_FINAL", file=H)
     print(file=H)
     print(EXPERIMENT_METADATA, file=H)
     print(file=H)